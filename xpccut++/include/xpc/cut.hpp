@@ -200,9 +200,38 @@ public:
     */
 
    bool load (const test_function test);
+   bool load
+   (
+      const test_function test,
+      int testgroup,
+      int testcase,
+      const char * groupname,
+      const char * casename
+   );
+   bool load_registered ();
+   bool load_fixture
+   (
+      int testgroup,
+      unit_test_setup_func_t setup,
+      unit_test_teardown_func_t teardown = nullptr
+   );
+   bool load_timeout (int timeout);
+   bool load_spread ();
+   bool load_serial ();
    bool c_load (unit_test_func_t test);
    bool run ();
 
+   /**
+    * \accessor unit_test_fixture_data()
+    *    Provides the state shared by the cases of the group of the running
+    *    test, as made by the setup function given to load_fixture().
+    */
+
+   static void * fixture_data ()
+   {
+      return unit_test_fixture_data();
+   }
+
    static void exclaim (const cut_options & option, const std::string & msg);
    static void inform (const cut_options & option, const std::string & msg);
    static void show (const cut_options & option, const std::string & msg);
@@ -212,6 +241,12 @@ private:
 
    cut_status run_a_test (test_function test);
    bool c_run ();
+   static unit_test_status_t job_runner
+   (
+      void * context,
+      int testnumber,
+      const unit_test_options_t * options
+   );
    void initialize
    (
       int argc,
@@ -266,6 +301,15 @@ private:
       return unit_test_failures(&m_UnitTest);
    }
 
+   /**
+    * \accessor unit_test_run_count()
+    */
+
+   int run_count () const
+   {
+      return unit_test_run_count(&m_UnitTest);
+   }
+
    /**
     * \accessor unit_test_first_failed_test()
     */
@@ -0,0 +1,356 @@
+#if ! defined XPC_CUT_ARENA_HPP
+#define XPC_CUT_ARENA_HPP
+
+/**
+ * \file          cut_arena.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_arena class, a C++ wrapper
+ *    for the xpccut_arena_t structure of the C library, and the
+ *    xpc::cut_arena_allocator template, which lets the containers of the
+ *    standard library take their memory from an arena.  Also see the
+ *    cut_arena.cpp module.
+ */
+
+#include <xpc/arena.h>                 /* xpccut_arena_t and functions        */
+#include <cstddef>                     /* std::size_t, std::ptrdiff_t         */
+#include <new>                         /* std::bad_alloc                      */
+#include <string>                      /* std::basic_string                   */
+#include <vector>                      /* std::vector                         */
+
+namespace xpc
+{
+
+/**
+ *    Provides an arena that frees all of its memory when it goes out of
+ *    scope.  It can also wrap the test arena of the thread, which it then
+ *    only rewinds to where it was when the object was made:
+ *
+\verbatim
+      {
+         xpc::cut_arena scratch(xpc::cut_arena::test_arena());
+         char * buffer = scratch.allocate_array<char>(65536);
+         . . .                         // no need to free the buffer
+      }
+\endverbatim
+ */
+
+class cut_arena
+{
+
+public:
+
+   /**
+    *    Selects the test arena of the thread in the constructor.
+    */
+
+   enum test_arena_t
+   {
+      test_arena
+   };
+
+private:
+
+   /**
+    *    The C arena that this object owns, if it owns one.
+    */
+
+   xpccut_arena_t m_Own_Arena;
+
+   /**
+    *    The arena that the blocks come from: m_Own_Arena, or the test arena
+    *    of the thread.
+    */
+
+   xpccut_arena_t * m_Arena;
+
+   /**
+    *    The position of the test arena when this object was made.  It is not
+    *    used when the arena is owned.
+    */
+
+   xpccut_arena_mark_t m_Mark;
+
+private:
+
+   cut_arena (const cut_arena &);
+   cut_arena & operator = (const cut_arena &);
+
+public:
+
+   explicit cut_arena
+   (
+      std::size_t chunksize = 0,
+      xpccut_arena_flags_t flags = XPCCUT_ARENA_NORMAL
+   );
+   explicit cut_arena (test_arena_t);
+   ~cut_arena ();
+
+   void * allocate (std::size_t size);
+
+   /**
+    *    Allocates an uninitialized array of \a count objects of type T.
+    *    Since the memory is never destroyed one block at a time, T should
+    *    be a type that needs no destructor.
+    */
+
+   template <typename T>
+   T * allocate_array (std::size_t count)
+   {
+      return static_cast<T *>
+      (
+         xpccut_arena_calloc(m_Arena, count, sizeof(T))
+      );
+   }
+
+   /**
+    * \accessor xpccut_arena_strdup()
+    */
+
+   char * copy (const char * text)
+   {
+      return xpccut_arena_strdup(m_Arena, text);
+   }
+
+   void reset ();
+
+   /**
+    * \accessor xpccut_arena_allocated()
+    */
+
+   std::size_t allocated () const
+   {
+      return xpccut_arena_allocated(m_Arena);
+   }
+
+   /**
+    * \accessor xpccut_arena_capacity()
+    */
+
+   std::size_t capacity () const
+   {
+      return xpccut_arena_capacity(m_Arena);
+   }
+
+   /**
+    * \getter m_Arena
+    *    Provides the C arena, for the C functions, such as
+    *    xpccut_arena_fuzz().
+    */
+
+   xpccut_arena_t * arena ()
+   {
+      return m_Arena;
+   }
+
+};             /* class cut_arena      */
+
+/**
+ *    Provides an allocator for the containers of the standard library that
+ *    takes its memory from an arena: by default, the test arena of the
+ *    thread that makes the allocator.  The memory is given back only when
+ *    the arena is rewound, so deallocate() does nothing, and a container
+ *    should not outlive the test (or the xpc::cut_arena) that it belongs to.
+ *
+ *    Two allocators are equal if they use the same arena.
+ */
+
+template <typename T>
+class cut_arena_allocator
+{
+
+   template <typename U> friend class cut_arena_allocator;
+
+public:
+
+   typedef T value_type;
+   typedef T * pointer;
+   typedef const T * const_pointer;
+   typedef T & reference;
+   typedef const T & const_reference;
+   typedef std::size_t size_type;
+   typedef std::ptrdiff_t difference_type;
+
+   /**
+    *    Provides the allocator for another type, as the containers need.
+    */
+
+   template <typename U>
+   struct rebind
+   {
+      typedef cut_arena_allocator<U> other;
+   };
+
+private:
+
+   /**
+    *    The arena that the blocks come from.
+    */
+
+   xpccut_arena_t * m_Arena;
+
+public:
+
+   /**
+    *    Uses the test arena of the calling thread.
+    */
+
+   cut_arena_allocator ()
+    :
+      m_Arena     (xpccut_test_arena())
+   {
+      // no code
+   }
+
+   /**
+    *    Uses the arena of an xpc::cut_arena object, which must outlive the
+    *    containers that use this allocator.
+    */
+
+   cut_arena_allocator (cut_arena & a)
+    :
+      m_Arena     (a.arena())
+   {
+      // no code
+   }
+
+   /**
+    *    Converts an allocator of another type, using the same arena.
+    */
+
+   template <typename U>
+   cut_arena_allocator (const cut_arena_allocator<U> & other)
+    :
+      m_Arena     (other.m_Arena)
+   {
+      // no code
+   }
+
+   /**
+    *    Allocates room for \a n objects of type T.
+    *
+    * \exception std::bad_alloc
+    *    Thrown if the arena cannot provide the memory.
+    */
+
+   T * allocate (std::size_t n, const void * /* hint */ = nullptr)
+   {
+      void * result = nullptr;
+      if (n <= max_size())
+         result = xpccut_arena_alloc(m_Arena, n * sizeof(T));
+
+      if (result == nullptr)
+         throw std::bad_alloc();
+
+      return static_cast<T *>(result);
+   }
+
+   /**
+    *    Does nothing; the memory is given back when the arena is rewound.
+    */
+
+   void deallocate (T * /* p */, std::size_t /* n */)
+   {
+      // no code
+   }
+
+   /**
+    *    Provides the largest number of objects that can be requested.
+    */
+
+   std::size_t max_size () const
+   {
+      return static_cast<std::size_t>(-1) / sizeof(T);
+   }
+
+   /**
+    *    Constructs an object in memory from allocate().
+    */
+
+   void construct (T * p, const T & value)
+   {
+      new (static_cast<void *>(p)) T(value);
+   }
+
+   /**
+    *    Destroys an object made by construct().
+    */
+
+   void destroy (T * p)
+   {
+      p->~T();
+   }
+
+   /**
+    * \getter m_Arena
+    */
+
+   xpccut_arena_t * arena () const
+   {
+      return m_Arena;
+   }
+
+};             /* class cut_arena_allocator  */
+
+/**
+ *    Compares two arena allocators.
+ */
+
+template <typename T, typename U>
+inline bool
+operator ==
+(
+   const cut_arena_allocator<T> & a,
+   const cut_arena_allocator<U> & b
+)
+{
+   return a.arena() == b.arena();
+}
+
+/**
+ *    Compares two arena allocators.
+ */
+
+template <typename T, typename U>
+inline bool
+operator !=
+(
+   const cut_arena_allocator<T> & a,
+   const cut_arena_allocator<U> & b
+)
+{
+   return a.arena() != b.arena();
+}
+
+/**
+ *    Provides a string whose characters come from an arena.
+ */
+
+typedef std::basic_string
+<
+   char, std::char_traits<char>, cut_arena_allocator<char>
+> cut_arena_string;
+
+/**
+ *    Provides a vector of bytes whose memory comes from an arena.
+ */
+
+typedef std::vector
+<
+   unsigned char, cut_arena_allocator<unsigned char>
+> cut_arena_bytes;
+
+}              /* namespace xpc        */
+
+#endif         /* XPC_CUT_ARENA_HPP */
+
+/*
+ * cut_arena.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
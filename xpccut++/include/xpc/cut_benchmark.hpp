@@ -0,0 +1,415 @@
+#if ! defined XPC_CUT_BENCHMARK_HPP
+#define XPC_CUT_BENCHMARK_HPP
+
+/**
+ * \file          cut_benchmark.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_benchmark class, a small
+ *    micro-benchmark harness that runs inside a normal unit-test function.
+ *    Also see the cut_benchmark.cpp module.
+ *
+ *    A benchmark is one sub-test of the cut_status object it is given, so
+ *    it shows up in the normal report, and is selected or skipped by the
+ *    --group, --case, and --sub-test options like any other test.
+ */
+
+#include <string>                      /* std::string                         */
+#include <vector>                      /* std::vector                         */
+#include <xpc/cut_status.hpp>          /* xpc::cut_status                     */
+
+/**
+ *    The default number of timed samples collected by a benchmark.
+ */
+
+#define XPCCUT_BENCH_SAMPLES             50
+
+/**
+ *    The default number of untimed warm-up samples run by a benchmark
+ *    after the iteration count has been calibrated.
+ */
+
+#define XPCCUT_BENCH_WARMUPS              2
+
+/**
+ *    The default minimum duration of one sample, in nanoseconds.  The
+ *    iteration count is calibrated so that each sample takes at least this
+ *    long, which keeps the clock overhead and resolution out of the
+ *    results.
+ */
+
+#define XPCCUT_BENCH_SAMPLE_NS       100000
+
+/**
+ *    The upper limit on the calibrated iteration count of one sample.
+ */
+
+#define XPCCUT_BENCH_ITERATIONS_MAX  100000000LL
+
+namespace xpc
+{
+
+/**
+ *    Keeps the compiler from optimizing away the computation of a value
+ *    that a benchmark does not otherwise use.  The value is made to look
+ *    as if it is read by code the compiler cannot see.
+ *
+ * \param value
+ *    The value to be preserved.
+ */
+
+template <typename T>
+inline void
+do_not_optimize (const T & value)
+{
+#if defined __GNUC__
+   __asm__ __volatile__ ("" : : "r" (&value) : "memory");
+#else
+   static const volatile void * s_sink;
+   s_sink = &value;
+#endif
+}
+
+/**
+ *    Provides a micro-benchmark that runs as a sub-test of a cut_status
+ *    object.
+ *
+ *    The benchmark first calibrates the number of iterations per sample,
+ *    so that each sample lasts at least min_sample_ns().  It then runs a
+ *    few warm-up samples, and finally times sample_count() samples.  The
+ *    time of each sample, divided by the iteration count, gives the time
+ *    of one iteration, in nanoseconds, from which the minimum, median,
+ *    99th percentile, mean, and standard deviation are computed.
+ *
+\verbatim
+      xpc::cut_benchmark bench(status, "std::string append");
+      bench.run([] ()
+      {
+         std::string s("abc");
+         s += "def";
+         xpc::do_not_optimize(s);
+      });
+\endverbatim
+ *
+ *    The body is taken as a template parameter, so a lambda is inlined
+ *    into the timing loop, and no indirect call is timed along with it.
+ *
+ *    Under the --perf-counters option, the hardware counters are also read
+ *    around the timed samples, and their counts per iteration are shown
+ *    with the timing results, where the counters are available.
+ */
+
+class cut_benchmark
+{
+
+private:
+
+   /**
+    *    The status object of the unit-test that owns the benchmark.  The
+    *    benchmark is a sub-test of this status.
+    */
+
+   cut_status & m_Status;
+
+   /**
+    *    The name of the benchmark, which is also the sub-test name.
+    */
+
+   std::string m_Name;
+
+   /**
+    *    The number of timed samples.
+    */
+
+   int m_Sample_Count;
+
+   /**
+    *    The number of untimed warm-up samples.
+    */
+
+   int m_Warmup_Count;
+
+   /**
+    *    The minimum duration of one sample, in nanoseconds.
+    */
+
+   long long m_Min_Sample_Ns;
+
+   /**
+    *    The calibrated number of iterations in each sample.
+    */
+
+   long long m_Iterations;
+
+   /**
+    *    The time of one iteration in each sample, in nanoseconds, sorted
+    *    in ascending order once the benchmark has run.
+    */
+
+   std::vector<double> m_Samples;
+
+   /**
+    *    The fastest iteration time, in nanoseconds.
+    */
+
+   double m_Min_Ns;
+
+   /**
+    *    The median iteration time, in nanoseconds.
+    */
+
+   double m_Median_Ns;
+
+   /**
+    *    The 99th-percentile iteration time, in nanoseconds.
+    */
+
+   double m_P99_Ns;
+
+   /**
+    *    The mean iteration time, in nanoseconds.
+    */
+
+   double m_Mean_Ns;
+
+   /**
+    *    The sample standard deviation of the iteration time, in
+    *    nanoseconds.
+    */
+
+   double m_Stddev_Ns;
+
+   /**
+    *    The hardware counts of all of the timed samples together, if the
+    *    --perf-counters option is in force and the counters could be read.
+    *    The counts per iteration are these divided by the number of
+    *    iterations of all of the samples.
+    */
+
+   xpccut_perf_values_t m_Counters;
+
+private:
+
+   cut_benchmark (const cut_benchmark &);
+   cut_benchmark & operator = (const cut_benchmark &);
+
+public:
+
+   cut_benchmark (cut_status & status, const std::string & name);
+
+   /**
+    *    Runs the benchmark.
+    *
+    * \param body
+    *    The code to be benchmarked, usually a lambda that takes no
+    *    parameters.  It is called many times, so it should reset any state
+    *    it changes.
+    *
+    * \return
+    *    Returns 'true' if the benchmark ran.  It returns 'false' if the
+    *    sub-test was not selected, or the test itself is being skipped, in
+    *    which case the body is never called.
+    *
+    * \unittests
+    *    -  cut_unit_test_09_01()
+    */
+
+   template <typename F>
+   bool run (F body)
+   {
+      bool result = start();
+      if (result)
+      {
+         long long iterations = 1;
+         for (;;)                            /* calibrate, warming up, too */
+         {
+            long long ns = time_sample(body, iterations);
+            if (ns >= m_Min_Sample_Ns)
+               break;
+
+            if (iterations >= XPCCUT_BENCH_ITERATIONS_MAX)
+               break;
+
+            iterations = next_iterations(iterations, ns);
+         }
+         m_Iterations = iterations;
+         for (int w = 0; w < m_Warmup_Count; ++w)
+            (void) time_sample(body, iterations);
+
+         xpccut_perf_values_t before;
+         bool counted = count_start(before);
+         for (int s = 0; s < m_Sample_Count; ++s)
+         {
+            long long ns = time_sample(body, iterations);
+            m_Samples.push_back(double(ns) / double(iterations));
+         }
+         if (counted)
+            count_finish(before);
+
+         result = finish();
+      }
+      return result;
+   }
+
+   bool sample_count (int count);
+   bool warmup_count (int count);
+   bool min_sample_ns (long long ns);
+   bool perf_check ();
+
+   /**
+    * \getter m_Name
+    */
+
+   const std::string & name () const
+   {
+      return m_Name;
+   }
+
+   /**
+    * \getter m_Sample_Count
+    */
+
+   int sample_count () const
+   {
+      return m_Sample_Count;
+   }
+
+   /**
+    * \getter m_Warmup_Count
+    */
+
+   int warmup_count () const
+   {
+      return m_Warmup_Count;
+   }
+
+   /**
+    * \getter m_Min_Sample_Ns
+    */
+
+   long long min_sample_ns () const
+   {
+      return m_Min_Sample_Ns;
+   }
+
+   /**
+    * \getter m_Iterations
+    */
+
+   long long iterations () const
+   {
+      return m_Iterations;
+   }
+
+   /**
+    * \getter m_Samples
+    */
+
+   const std::vector<double> & samples () const
+   {
+      return m_Samples;
+   }
+
+   /**
+    * \getter m_Min_Ns
+    */
+
+   double min_ns () const
+   {
+      return m_Min_Ns;
+   }
+
+   /**
+    * \getter m_Median_Ns
+    */
+
+   double median_ns () const
+   {
+      return m_Median_Ns;
+   }
+
+   /**
+    * \getter m_P99_Ns
+    */
+
+   double p99_ns () const
+   {
+      return m_P99_Ns;
+   }
+
+   /**
+    * \getter m_Mean_Ns
+    */
+
+   double mean_ns () const
+   {
+      return m_Mean_Ns;
+   }
+
+   /**
+    * \getter m_Stddev_Ns
+    */
+
+   double stddev_ns () const
+   {
+      return m_Stddev_Ns;
+   }
+
+   /**
+    * \getter m_Counters
+    *    Returns a null pointer if no counts were taken.
+    */
+
+   const xpccut_perf_values_t * counters () const
+   {
+      return m_Counters.m_Is_Valid ? &m_Counters : nullptr ;
+   }
+
+private:
+
+   bool start ();
+   bool finish ();
+   long long next_iterations (long long iterations, long long ns) const;
+   bool count_start (xpccut_perf_values_t & before);
+   void count_finish (const xpccut_perf_values_t & before);
+   static long long now_ns ();
+
+   /**
+    *    Times one sample of the benchmark.
+    *
+    * \param body
+    *    The code to be benchmarked.
+    *
+    * \param iterations
+    *    The number of times to call the code.
+    *
+    * \return
+    *    Returns the duration of the sample, in nanoseconds.
+    */
+
+   template <typename F>
+   static long long time_sample (F & body, long long iterations)
+   {
+      long long start = now_ns();
+      for (long long i = 0; i < iterations; ++i)
+         body();
+
+      return now_ns() - start;
+   }
+
+};             /* class cut_benchmark  */
+
+}              /* namespace xpc        */
+
+#endif         /* XPC_CUT_BENCHMARK_HPP */
+
+/*
+ * cut_benchmark.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
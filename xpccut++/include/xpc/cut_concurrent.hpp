@@ -0,0 +1,820 @@
+#if ! defined XPC_CUT_CONCURRENT_HPP
+#define XPC_CUT_CONCURRENT_HPP
+
+/**
+ * \file          cut_concurrent.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_concurrent class, a
+ *    harness that runs the same code on a number of threads at once, for
+ *    the testing of concurrent code, such as lock-free queues.  Also see
+ *    the cut_concurrent.cpp module.
+ *
+ *    Like a benchmark, a concurrent run is one sub-test of the cut_status
+ *    object it is given, so it shows up in the normal report, and is
+ *    selected or skipped by the --group, --case, and --sub-test options
+ *    like any other test.
+ */
+
+#include <string>                      /* std::string                         */
+#include <utility>                     /* std::pair                           */
+#include <vector>                      /* std::vector                         */
+#include <xpc/cut_status.hpp>          /* xpc::cut_status                     */
+
+/**
+ *    The default number of iterations of each thread.
+ */
+
+#define XPCCUT_CONCURRENT_ITERATIONS     100000LL
+
+/**
+ *    The largest number of threads of one run.
+ */
+
+#define XPCCUT_CONCURRENT_THREADS_MAX    256
+
+/**
+ *    The number of bits of the sub-buckets of each power of 2 in a
+ *    cut_histogram.  With 3 bits, each bucket is no more than 12.5% wide.
+ */
+
+#define XPCCUT_HISTOGRAM_SUB_BITS        3
+
+/**
+ *    The number of buckets of a cut_histogram, enough for any 64-bit
+ *    value.
+ */
+
+#define XPCCUT_HISTOGRAM_BUCKETS         (64 << XPCCUT_HISTOGRAM_SUB_BITS)
+
+namespace xpc
+{
+
+/**
+ *    Provides a histogram of latencies, in nanoseconds, with buckets that
+ *    grow in proportion to their values.  Each power of 2 is split into 8
+ *    buckets, so a percentile is known to within 12.5%, however wide the
+ *    range of the values, and adding a value costs a few instructions.
+ */
+
+class cut_histogram
+{
+
+private:
+
+   /**
+    *    The count of values in each bucket.
+    */
+
+   std::vector<long long> m_Buckets;
+
+   /**
+    *    The number of values added.
+    */
+
+   long long m_Count;
+
+   /**
+    *    The sum of the values added, for the mean.
+    */
+
+   long long m_Sum;
+
+   /**
+    *    The smallest value added.
+    */
+
+   long long m_Min;
+
+   /**
+    *    The largest value added.
+    */
+
+   long long m_Max;
+
+public:
+
+   cut_histogram ();
+
+   void clear ();
+   void merge (const cut_histogram & other);
+   long long percentile (double p) const;
+   double mean () const;
+
+   /**
+    *    Adds a value to the histogram.  A negative value counts as 0.
+    *
+    * \param ns
+    *    The value to add, usually a latency in nanoseconds.
+    */
+
+   void add (long long ns)
+   {
+      if (ns < 0)
+         ns = 0;
+
+      ++m_Buckets[std::size_t(bucket(ns))];
+      ++m_Count;
+      m_Sum += ns;
+      if (ns < m_Min || m_Count == 1)
+         m_Min = ns;
+
+      if (ns > m_Max)
+         m_Max = ns;
+   }
+
+   /**
+    * \getter m_Count
+    */
+
+   long long count () const
+   {
+      return m_Count;
+   }
+
+   /**
+    * \getter m_Min
+    */
+
+   long long min () const
+   {
+      return m_Min;
+   }
+
+   /**
+    * \getter m_Max
+    */
+
+   long long max () const
+   {
+      return m_Max;
+   }
+
+   /**
+    *    Provides the bucket of a value.  The values below 8 have a bucket
+    *    each; above that, the bucket is given by the position of the
+    *    highest bit and the three bits below it.
+    *
+    * \param ns
+    *    The value, which is not negative.
+    *
+    * \return
+    *    Returns the index of the bucket.
+    */
+
+   static int bucket (long long ns)
+   {
+      const int sub = 1 << XPCCUT_HISTOGRAM_SUB_BITS;
+      unsigned long long v = (unsigned long long) ns;
+      int result = int(v);
+      if (v >= (unsigned long long) sub)
+      {
+         int high = 63 - __builtin_clzll(v);
+         int shift = high - XPCCUT_HISTOGRAM_SUB_BITS;
+         result = (shift + 1) * sub + int((v >> shift) & (sub - 1));
+      }
+      return result;
+   }
+
+   static long long bucket_high (int index);
+
+};             /* class cut_histogram  */
+
+class cut_concurrent;                  /* forward reference                   */
+
+/**
+ *    Holds the state and the results of one thread of a concurrent run.
+ *    The code under test gets the cut_thread of the thread that calls it,
+ *    and can make its checks through it, so that the threads share nothing
+ *    while they count.  The checks are merged into the cut_status when the
+ *    threads are done.
+ */
+
+class cut_thread
+{
+   friend class cut_concurrent;
+
+private:
+
+   /**
+    *    The index of the thread, from 0.
+    */
+
+   int m_Index;
+
+   /**
+    *    The CPU to which the thread is pinned, or -1.
+    */
+
+   int m_Cpu;
+
+   /**
+    *    Indicates that the code under test asked the thread to stop.
+    */
+
+   bool m_Stopped;
+
+   /**
+    *    The number of iterations done so far, which is also the index of
+    *    the current iteration.
+    */
+
+   long long m_Iteration;
+
+   /**
+    *    The time from the start of the run to the end of the last
+    *    iteration of the thread, in nanoseconds.
+    */
+
+   long long m_Elapsed_Ns;
+
+   /**
+    *    The number of checks made.
+    */
+
+   long long m_Checks;
+
+   /**
+    *    The number of checks that failed.
+    */
+
+   long long m_Failures;
+
+   /**
+    *    The iteration of the first failed check, or -1.
+    */
+
+   long long m_First_Failure;
+
+   /**
+    *    The latency of each iteration.
+    */
+
+   cut_histogram m_Latency;
+
+   /**
+    *    Keeps the counters of the threads, which each thread updates in
+    *    every iteration, off each other's cache lines.
+    */
+
+   char m_Padding[64];
+
+public:
+
+   cut_thread ();
+
+   /**
+    *    Checks a condition of the code under test.
+    *
+    * \param flag
+    *    The condition that must hold.
+    *
+    * \return
+    *    Returns \a flag.
+    */
+
+   bool check (bool flag)
+   {
+      ++m_Checks;
+      if (! flag)
+      {
+         if (m_Failures == 0)
+            m_First_Failure = m_Iteration;
+
+         ++m_Failures;
+      }
+      return flag;
+   }
+
+   /**
+    *    Checks a value of the code under test.
+    *
+    * \return
+    *    Returns 'true' if the values are equal.
+    */
+
+   bool int_check (long long expected_value, long long actual_value)
+   {
+      return check(expected_value == actual_value);
+   }
+
+   /**
+    *    Stops the thread after the current iteration, for example when a
+    *    producer has produced all of its items.
+    */
+
+   void stop ()
+   {
+      m_Stopped = true;
+   }
+
+   /**
+    * \getter m_Index
+    */
+
+   int index () const
+   {
+      return m_Index;
+   }
+
+   /**
+    * \getter m_Cpu
+    */
+
+   int cpu () const
+   {
+      return m_Cpu;
+   }
+
+   /**
+    * \getter m_Iteration
+    */
+
+   long long iteration () const
+   {
+      return m_Iteration;
+   }
+
+   /**
+    *    Returns the number of iterations done.
+    */
+
+   long long iterations () const
+   {
+      return m_Iteration;
+   }
+
+   /**
+    * \getter m_Elapsed_Ns
+    */
+
+   long long elapsed_ns () const
+   {
+      return m_Elapsed_Ns;
+   }
+
+   /**
+    * \getter m_Checks
+    */
+
+   long long checks () const
+   {
+      return m_Checks;
+   }
+
+   /**
+    * \getter m_Failures
+    */
+
+   long long failures () const
+   {
+      return m_Failures;
+   }
+
+   /**
+    * \getter m_First_Failure
+    */
+
+   long long first_failure () const
+   {
+      return m_First_Failure;
+   }
+
+   /**
+    * \getter m_Latency
+    */
+
+   const cut_histogram & latency () const
+   {
+      return m_Latency;
+   }
+
+   double throughput () const;
+
+};             /* class cut_thread     */
+
+/**
+ *    Provides a run of the same code on a number of threads at once, as a
+ *    sub-test of a cut_status object.
+ *
+ *    The threads are started, and wait at a spin barrier until all of them
+ *    are ready, so that they call the code at the same moment.  Each
+ *    thread then calls the code until it has done iterations() calls, or
+ *    until duration_ms() has passed, whichever comes first, or until the
+ *    code calls cut_thread::stop().  The time of each call goes into a
+ *    latency histogram of the thread, and the iterations per second of each
+ *    thread, and of all of them together, are kept.
+ *
+\verbatim
+      xpc::cut_concurrent stress(status, "queue push/pop");
+      stress.thread_count(4);
+      stress.run([&] (xpc::cut_thread & t)
+      {
+         if (t.index() % 2 == 0)
+            queue.push(t.iteration());
+         else
+            (void) queue.pop();
+      });
+\endverbatim
+ *
+ *    The code is taken as a template parameter, so a lambda is inlined into
+ *    the loop of each thread.  Its checks can go through the cut_thread it
+ *    is given, which costs nothing shared, and each thread whose checks
+ *    failed fails the sub-test once the threads are done.  The checks of
+ *    the cut_status of the test can also be made from the threads, since
+ *    failures are recorded atomically; see unit_test_status_pass().
+ *
+ *    The scale() function runs the code on 1, 2, 4, ... threads, up to
+ *    thread_count(), one sub-test each, for a scalability curve.
+ */
+
+class cut_concurrent
+{
+
+public:
+
+   /**
+    *    The type of the loop of each thread, of which run() provides an
+    *    instance for its code.
+    */
+
+   typedef void (* loop_t)
+   (
+      void * context,
+      cut_concurrent & harness,
+      cut_thread & thread
+   );
+
+private:
+
+   /**
+    *    The status object of the unit-test that owns the run.  The run is
+    *    a sub-test of this status.
+    */
+
+   cut_status & m_Status;
+
+   /**
+    *    The name of the run, which is also the sub-test name.
+    */
+
+   std::string m_Name;
+
+   /**
+    *    The number of threads.
+    */
+
+   int m_Thread_Count;
+
+   /**
+    *    Indicates that each thread is pinned to a CPU of its own, as far
+    *    as there are CPUs.
+    */
+
+   bool m_Pin_Threads;
+
+   /**
+    *    The number of iterations of each thread, or 0 for no limit.
+    */
+
+   long long m_Iterations;
+
+   /**
+    *    The longest duration of the run, in milliseconds, or 0 for no
+    *    limit.
+    */
+
+   double m_Duration_Ms;
+
+   /**
+    *    The threads of the last run.
+    */
+
+   std::vector<cut_thread> m_Threads;
+
+   /**
+    *    The number of threads waiting at the barrier.
+    */
+
+   int m_Ready;
+
+   /**
+    *    Set to 1 to release the threads from the barrier, or to -1 to
+    *    send them away without running the code.
+    */
+
+   int m_Go;
+
+   /**
+    *    The time of the release of the threads, from xpccut_get_ticks().
+    */
+
+   long long m_Start_Ns;
+
+   /**
+    *    The time at which the threads stop, or 0 for none.
+    */
+
+   long long m_Deadline_Ns;
+
+   /**
+    *    The time from the release of the threads to the end of the last
+    *    one, in nanoseconds.
+    */
+
+   long long m_Wall_Ns;
+
+   /**
+    *    The latencies of all of the threads of the last run.
+    */
+
+   cut_histogram m_Latency;
+
+   /**
+    *    The thread counts and the iterations per second of the runs of
+    *    scale().
+    */
+
+   std::vector< std::pair<int, double> > m_Scaling;
+
+private:
+
+   cut_concurrent (const cut_concurrent &);
+   cut_concurrent & operator = (const cut_concurrent &);
+
+public:
+
+   cut_concurrent (cut_status & status, const std::string & name);
+
+   /**
+    *    Runs the code on all of the threads.
+    *
+    * \param body
+    *    The code under test, usually a lambda that takes a reference to
+    *    the cut_thread of the calling thread.
+    *
+    * \return
+    *    Returns 'true' if the run was made and no check failed.  It returns
+    *    'false' if the sub-test was not selected, or the test itself is
+    *    being skipped, in which case the code is never called.
+    *
+    * \unittests
+    *    -  cut_unit_test_14_01()
+    */
+
+   template <typename F>
+   bool run (F body)
+   {
+      bool result = start(m_Name);
+      if (result)
+         result = finish(launch(&cut_concurrent::loop<F>, &body));
+
+      return result;
+   }
+
+   /**
+    *    Runs the code on 1, 2, 4, ... threads, up to thread_count(), as
+    *    one sub-test for each count.
+    *
+    * \param body
+    *    The code under test, as for run().
+    *
+    * \return
+    *    Returns 'true' if all of the runs were made and passed.
+    *
+    * \unittests
+    *    -  cut_unit_test_14_02()
+    */
+
+   template <typename F>
+   bool scale (F body)
+   {
+      int threads = m_Thread_Count;
+      bool result = true;
+      m_Scaling.clear();
+      for (int n = 1; n <= threads; n = next_count(n, threads))
+      {
+         m_Thread_Count = n;
+         if (start(scale_name(n)))
+         {
+            bool ok = finish(launch(&cut_concurrent::loop<F>, &body));
+            if (ok)
+               m_Scaling.push_back(std::make_pair(n, throughput()));
+            else
+               result = false;
+         }
+         else
+            result = false;
+      }
+      m_Thread_Count = threads;
+      if (! m_Scaling.empty())
+         show_scaling();
+
+      return result;
+   }
+
+   bool thread_count (int count);
+   bool iterations (long long count);
+   bool duration_ms (double ms);
+   double throughput () const;
+   long long total_iterations () const;
+   static int cpu_count ();
+
+   /**
+    * \setter m_Pin_Threads
+    */
+
+   void pin_threads (bool flag)
+   {
+      m_Pin_Threads = flag;
+   }
+
+   /**
+    * \getter m_Name
+    */
+
+   const std::string & name () const
+   {
+      return m_Name;
+   }
+
+   /**
+    * \getter m_Thread_Count
+    */
+
+   int thread_count () const
+   {
+      return m_Thread_Count;
+   }
+
+   /**
+    * \getter m_Pin_Threads
+    */
+
+   bool pin_threads () const
+   {
+      return m_Pin_Threads;
+   }
+
+   /**
+    * \getter m_Iterations
+    */
+
+   long long iterations () const
+   {
+      return m_Iterations;
+   }
+
+   /**
+    * \getter m_Duration_Ms
+    */
+
+   double duration_ms () const
+   {
+      return m_Duration_Ms;
+   }
+
+   /**
+    * \getter m_Threads
+    */
+
+   const std::vector<cut_thread> & threads () const
+   {
+      return m_Threads;
+   }
+
+   /**
+    * \getter m_Wall_Ns
+    */
+
+   long long wall_ns () const
+   {
+      return m_Wall_Ns;
+   }
+
+   /**
+    * \getter m_Latency
+    */
+
+   const cut_histogram & latency () const
+   {
+      return m_Latency;
+   }
+
+   /**
+    * \getter m_Scaling
+    */
+
+   const std::vector< std::pair<int, double> > & scaling () const
+   {
+      return m_Scaling;
+   }
+
+private:
+
+   bool start (const std::string & subtestname);
+   bool launch (loop_t loop, void * context);
+   bool finish (bool launched);
+   bool wait_for_start ();
+   void show_scaling () const;
+   std::string scale_name (int threads) const;
+   static int next_count (int count, int limit);
+   static void * thread_main (void * context);
+
+   /**
+    *    Provides the loop of each thread for run(), which waits at the
+    *    barrier, and then calls the code and times it until the thread is
+    *    done.  The clock is read once per iteration, and the time from one
+    *    reading to the next is the latency of the iteration.
+    *
+    * \param context
+    *    The code under test.
+    *
+    * \param harness
+    *    The run to which the thread belongs.
+    *
+    * \param thread
+    *    The state of the thread.
+    */
+
+   template <typename F>
+   static void loop
+   (
+      void * context,
+      cut_concurrent & harness,
+      cut_thread & thread
+   )
+   {
+      F & body = *static_cast<F *>(context);
+      if (harness.wait_for_start())
+      {
+         long long limit = harness.m_Iterations;
+         long long deadline = harness.m_Deadline_Ns;
+         long long previous = (long long) xpccut_get_ticks();
+         while (! thread.m_Stopped)
+         {
+            body(thread);
+
+            long long now = (long long) xpccut_get_ticks();
+            thread.m_Latency.add(now - previous);
+            previous = now;
+            ++thread.m_Iteration;
+            if (thread.m_Iteration == limit)
+               break;
+
+            if (deadline > 0 && now >= deadline)
+               break;
+         }
+         thread.m_Elapsed_Ns = previous - harness.m_Start_Ns;
+      }
+   }
+
+};             /* class cut_concurrent */
+
+/**
+ *    Runs code on a number of threads at once, as a sub-test of the
+ *    status, with the default budget of cut_concurrent.  It is declared as
+ *    part of the cut_status class.
+ *
+ * \param name
+ *    The name of the sub-test.
+ *
+ * \param threads
+ *    The number of threads.
+ *
+ * \param body
+ *    The code under test, as for cut_concurrent::run().
+ *
+ * \return
+ *    Returns the result of cut_concurrent::run().
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+template <typename F>
+bool
+cut_status::run_concurrently (const std::string & name, int threads, F body)
+{
+   cut_concurrent harness(*this, name);
+   bool result = harness.thread_count(threads);
+   if (result)
+      result = harness.run(body);
+
+   return result;
+}
+
+}              /* namespace xpc        */
+
+#endif         /* XPC_CUT_CONCURRENT_HPP */
+
+/*
+ * cut_concurrent.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
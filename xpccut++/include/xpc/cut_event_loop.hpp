@@ -0,0 +1,201 @@
+#if ! defined XPC_CUT_EVENT_LOOP_HPP
+#define XPC_CUT_EVENT_LOOP_HPP
+
+/**
+ * \file          cut_event_loop.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_event_loop class, a small
+ *    event loop on one thread, for tests that spend their time waiting on
+ *    timers and on peers.  Also see the cut_event_loop.cpp module.
+ *
+ *    A test that waits in a blocking call holds up the whole run.  With
+ *    the event loop, the test instead hands the loop the code to run when
+ *    the wait is over, and returns.  Many such tests can then wait at once,
+ *    on one thread, each with a cut_status of its own, so that the run
+ *    takes about as long as the longest wait, rather than the sum of them:
+ *
+\verbatim
+      xpc::cut_event_loop loop;
+      for (int i = 0; i < peers; ++i)
+      {
+         send_request(fd[i]);
+         loop.when_readable
+         (
+            fd[i], [&, i] () { statuses[i].pass(read_reply(fd[i])); }
+         );
+      }
+      status.pass(loop.run(5000.0));
+\endverbatim
+ *
+ *    Each callback is the rest of a test, up to its next wait, much like
+ *    the code after a co_await.  A callback can start the next wait
+ *    itself, so a test can wait any number of times.  The loop runs on the
+ *    thread that calls run(), so the callbacks never run at the same time,
+ *    and need no locks.  The ordinary test functions do not change at all.
+ */
+
+#include <functional>                  /* std::function                       */
+#include <vector>                      /* std::vector                         */
+#include <xpc/portable_subset.h>       /* xpccut_get_ticks()                  */
+
+namespace xpc
+{
+
+/**
+ *    Runs callbacks when timers expire, and when file descriptors become
+ *    readable or writable.  Each timer and each watch of a descriptor runs
+ *    its callback once, and is then gone.
+ *
+ *    The waiting is done by poll(), which is what the --isolate option of
+ *    the C library already uses, and which copes with hundreds of
+ *    descriptors.  Where poll() is missing, only the timers are supported.
+ */
+
+class cut_event_loop
+{
+
+public:
+
+   /**
+    *    Provides the type of the callbacks.  A lambda can capture what the
+    *    rest of its test needs.
+    */
+
+   typedef std::function<void ()> callback;
+
+private:
+
+   /**
+    *    Holds a timer that has not yet expired.
+    */
+
+   struct timer
+   {
+      long long m_Deadline_Ns;         /**< From xpccut_get_ticks().          */
+      long long m_Sequence;            /**< Keeps equal deadlines in order.   */
+      callback m_Callback;             /**< The code to run.                  */
+   };
+
+   /**
+    *    Holds a file descriptor being waited on.
+    */
+
+   struct watch
+   {
+      int m_Fd;                        /**< The descriptor.                   */
+      bool m_Is_Write;                 /**< Wait to write, rather than read.  */
+      callback m_Callback;             /**< The code to run.                  */
+   };
+
+   /**
+    *    The timers, as a heap with the earliest deadline on top.
+    */
+
+   std::vector<timer> m_Timers;
+
+   /**
+    *    The descriptors being waited on, in the order they were given.
+    */
+
+   std::vector<watch> m_Watches;
+
+   /**
+    *    The number of timers made, which orders the timers that expire at
+    *    the same time.
+    */
+
+   long long m_Sequence;
+
+   /**
+    *    The number of callbacks that have been run.
+    */
+
+   long long m_Dispatched;
+
+   /**
+    *    Set by stop(), to make run() return.
+    */
+
+   bool m_Stopped;
+
+public:
+
+   cut_event_loop ();
+
+   bool after (double ms, const callback & code);
+   bool when_readable (int fd, const callback & code);
+   bool when_writable (int fd, const callback & code);
+   bool run (double timeout_ms = -1.0);
+
+   /**
+    *    Makes run() return once the callback that calls this function is
+    *    done.  The timers and watches that are left stay pending.
+    */
+
+   void stop ()
+   {
+      m_Stopped = true;
+   }
+
+   /**
+    *    Provides the number of timers and watches still pending.
+    */
+
+   int pending () const
+   {
+      return int(m_Timers.size() + m_Watches.size());
+   }
+
+   /**
+    * \getter m_Dispatched
+    */
+
+   long long dispatched () const
+   {
+      return m_Dispatched;
+   }
+
+private:
+
+   bool watch_fd (int fd, bool is_write, const callback & code);
+   int wait_ms (long long deadline_ns) const;
+   void wait (int ms);
+   void run_timers ();
+
+   /**
+    *    Orders the timers for the heap functions, so that the earliest
+    *    deadline, and then the earliest timer made, is on top.
+    */
+
+   static bool later (const timer & a, const timer & b)
+   {
+      return a.m_Deadline_Ns != b.m_Deadline_Ns ?
+         a.m_Deadline_Ns > b.m_Deadline_Ns : a.m_Sequence > b.m_Sequence ;
+   }
+
+   /**
+    *    Provides the current time, in nanoseconds.
+    */
+
+   static long long now_ns ()
+   {
+      return (long long) xpccut_get_ticks();
+   }
+
+};             /* class cut_event_loop */
+
+}              /* namespace xpc        */
+
+#endif         /* XPC_CUT_EVENT_LOOP_HPP */
+
+/*
+ * cut_event_loop.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
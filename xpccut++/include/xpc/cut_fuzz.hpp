@@ -6,7 +6,7 @@
  * \library       libxpccut++
  * \author        Chris Ahlstrom
  * \date          2010-03-21
- * \updates       2015-10-06
+ * \updates       2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
@@ -14,10 +14,15 @@
  *
  *    The xpc::RandomNumber class provides an easy object for returning
  *    randomized strings.  The xpc::Fuzz class is meant to provide a way of
- *    generating fuzzed-up strings.
+ *    generating fuzzed-up strings.  The xpc::FuzzStream class provides fuzz
+ *    data of any length, in chunks, and the xpc::GuidedFuzz class provides
+ *    coverage-guided fuzzing.
  */
 
 #include <xpc/fuzz.h>                  /* external C fuzz functions           */
+#include <xpc/fuzz_campaign.h>         /* external C fuzz-campaign functions  */
+#include <xpc/fuzz_corpus.h>           /* external C corpus-file functions    */
+#include <xpc/guided_fuzz.h>           /* external C guided-fuzz functions    */
 #include <string>                      /* std::string                         */
 
 namespace xpc
@@ -94,6 +99,17 @@ public:
       return RAND_MAX;
    }
 
+   /**
+    * \getter m_original_seed
+    *    This is the base seed from which the seeds of the workers of a
+    *    FuzzCampaign can be derived.
+    */
+
+   unsigned int original_seed () const
+   {
+      return m_original_seed;
+   }
+
 protected:
 
    /**
@@ -186,6 +202,428 @@ public:
 
 };             // Fuzz
 
+/**
+ *    Provides a wrapper for the C fuzz-stream functions, which generate
+ *    fuzz data of any length in chunks, so that large inputs need no
+ *    buffer of their own.  See xpccut_fuzz_stream_t.
+ *
+ *    Any part of the stream can be made again from the seed and the
+ *    offset, without making the parts before it:
+ *
+\verbatim
+      xpc::FuzzStream fs(1LL << 32, seed, XPCCUT_FF_DEFAULT, "", "", "<");
+      std::string chunk;
+      while (fs.next(chunk))
+         parser.feed(chunk);
+      std::string again = fs.read(offset, 100);
+\endverbatim
+ *
+ *    The object keeps its own copies of the prologue and epilogue, so it
+ *    cannot be copied.
+ */
+
+class FuzzStream
+{
+
+private:
+
+   /**
+    *    The string that starts the stream.
+    */
+
+   std::string m_prologue;
+
+   /**
+    *    The string that ends the stream.
+    */
+
+   std::string m_epilogue;
+
+   /**
+    *    The C stream, which points to m_prologue and m_epilogue.
+    */
+
+   xpccut_fuzz_stream_t m_stream;
+
+   /**
+    *    Indicates if the stream could be set up.
+    */
+
+   bool m_is_valid;
+
+private:
+
+   FuzzStream (const FuzzStream &);
+   FuzzStream & operator = (const FuzzStream &);
+
+public:
+
+   FuzzStream
+   (
+      long long length,
+      unsigned int seed,
+      xpccut_fuzz_flags_t flags     = XPCCUT_FF_DEFAULT,
+      const std::string & allowed   = "",
+      const std::string & excluded  = "",
+      const std::string & prologue  = "",
+      const std::string & epilogue  = ""
+   );
+
+   std::string read (long long offset, int count);
+   bool next (std::string & chunk, int count = XPCCUT_FUZZ_STREAM_BLOCK);
+
+   /**
+    *    Passes the rest of the stream, from its current position, to a
+    *    function, in chunks of up to XPCCUT_FUZZ_STREAM_BLOCK bytes.
+    *
+    * \param sink
+    *    The function, usually a lambda, that takes a const char pointer
+    *    and an int count, and returns 'false' to stop the stream.
+    *
+    * \return
+    *    Returns 'true' if the end of the stream was reached.
+    */
+
+   template <typename F>
+   bool generate (F sink)
+   {
+      bool result = m_is_valid;
+      if (result)
+      {
+         char chunk[XPCCUT_FUZZ_STREAM_BLOCK];
+         for (;;)
+         {
+            int count = xpccut_fuzz_stream_next(&m_stream, chunk, sizeof chunk);
+            if (count <= 0)
+               break;
+
+            if (! sink(static_cast<const char *>(chunk), count))
+            {
+               result = false;
+               break;
+            }
+         }
+      }
+      return result;
+   }
+
+   /**
+    * \getter m_is_valid
+    */
+
+   bool valid () const
+   {
+      return m_is_valid;
+   }
+
+   /**
+    *    Returns the length of the stream, which is 0 if it is not valid.
+    */
+
+   long long length () const
+   {
+      return xpccut_fuzz_stream_length(&m_stream);
+   }
+
+   /**
+    *    Returns the seed of the stream, which is the one picked if
+    *    XPCCUT_SEED_RANDOMIZE or XPCCUT_SEED_SKIP was given.
+    */
+
+   unsigned int seed () const
+   {
+      return m_is_valid ? xpccut_fuzz_stream_seed(&m_stream) : 0 ;
+   }
+
+};             // FuzzStream
+
+/**
+ *    Provides a wrapper for the C coverage-guided fuzzer.  See
+ *    xpccut_guided_fuzz_t, and guided_fuzz.h for how to get coverage from
+ *    the code under test.
+ *
+\verbatim
+      xpc::GuidedFuzz gf(seed, 256);
+      gf.add("<doc></doc>");
+      bool clean = gf.run
+      (
+         [] (const char * data, int size) { return parse(data, size); },
+         0, 2000.0                        // no iteration limit, 2 seconds
+      );
+      status.pass(clean);
+      if (! clean)
+         std::cerr << "failing input: " << gf.crash() << std::endl;
+\endverbatim
+ */
+
+class GuidedFuzz
+{
+
+private:
+
+   /**
+    *    The C fuzzer.
+    */
+
+   xpccut_guided_fuzz_t m_fuzzer;
+
+   /**
+    *    Indicates if the fuzzer could be set up.
+    */
+
+   bool m_is_valid;
+
+private:
+
+   GuidedFuzz (const GuidedFuzz &);
+   GuidedFuzz & operator = (const GuidedFuzz &);
+
+   /**
+    *    Calls the function given to run(), for the C fuzzer.
+    */
+
+   template <typename F>
+   static cbool_t call_target (void * context, const char * data, int size)
+   {
+      F & target = *static_cast<F *>(context);
+      return target(data, size) ? true : false ;
+   }
+
+public:
+
+   GuidedFuzz
+   (
+      unsigned int seed,
+      int max_size,
+      xpccut_fuzz_flags_t flags     = XPCCUT_FF_DEFAULT,
+      const std::string & allowed   = "",
+      const std::string & excluded  = ""
+   );
+
+   ~GuidedFuzz ();
+
+   bool add (const std::string & input);
+   bool directory (const std::string & name);
+   std::string crash () const;
+   std::string crash_file () const;
+
+   /**
+    *    Fuzzes a function until it fails, or until the budget is used up.
+    *    See xpccut_guided_run().
+    *
+    * \param target
+    *    The function, usually a lambda, that takes a const char pointer and
+    *    an int size, and returns 'false' if the input reveals a bug.
+    *
+    * \param max_iterations
+    *    The largest number of calls, or 0 for no limit.
+    *
+    * \param max_ms
+    *    The longest duration, in milliseconds, or 0 for no limit.
+    *
+    * \return
+    *    Returns 'true' if the budget was used up without a failure.
+    */
+
+   template <typename F>
+   bool run (F target, long long max_iterations, double max_ms = 0.0)
+   {
+      return m_is_valid && xpccut_guided_run
+      (
+         &m_fuzzer, &GuidedFuzz::call_target<F>, &target,
+         max_iterations, max_ms
+      );
+   }
+
+   /**
+    * \getter m_is_valid
+    */
+
+   bool valid () const
+   {
+      return m_is_valid;
+   }
+
+   /**
+    *    Returns the number of inputs in the corpus.
+    */
+
+   int corpus_count () const
+   {
+      return xpccut_guided_corpus_count(&m_fuzzer);
+   }
+
+   /**
+    *    Returns the number of edges reached so far.
+    */
+
+   int edge_count () const
+   {
+      return xpccut_guided_edge_count(&m_fuzzer);
+   }
+
+   /**
+    *    Returns the number of calls of the target so far.
+    */
+
+   long long iterations () const
+   {
+      return xpccut_guided_iterations(&m_fuzzer);
+   }
+
+};             // GuidedFuzz
+
+/**
+ *    Provides a wrapper for the C fuzz campaign, which runs a number of
+ *    guided fuzzers at once, in worker threads, that share what they find.
+ *    The number of workers usually comes from the --fuzz-jobs option.
+ *
+\verbatim
+      xpc::FuzzCampaign fc(options.fuzz_job_count(), rn.original_seed(), 256);
+      bool clean = fc.run(parse_is_sane, 0, 2000.0);
+\endverbatim
+ *
+ *    The target is called from all of the workers at once, so it must be
+ *    thread-safe.
+ */
+
+class FuzzCampaign
+{
+
+private:
+
+   /**
+    *    The C campaign.
+    */
+
+   xpccut_campaign_t m_campaign;
+
+   /**
+    *    Indicates if the campaign could be set up.
+    */
+
+   bool m_is_valid;
+
+private:
+
+   FuzzCampaign (const FuzzCampaign &);
+   FuzzCampaign & operator = (const FuzzCampaign &);
+
+   /**
+    *    Calls the function given to run(), for the C campaign.
+    */
+
+   template <typename F>
+   static cbool_t call_target (void * context, const char * data, int size)
+   {
+      F & target = *static_cast<F *>(context);
+      return target(data, size) ? true : false ;
+   }
+
+public:
+
+   FuzzCampaign
+   (
+      int jobs,
+      unsigned int seed,
+      int max_size,
+      xpccut_fuzz_flags_t flags     = XPCCUT_FF_DEFAULT,
+      const std::string & allowed   = "",
+      const std::string & excluded  = ""
+   );
+
+   ~FuzzCampaign ();
+
+   bool add (const std::string & input);
+   bool directory (const std::string & name);
+   std::string crash () const;
+   std::string crash_file () const;
+
+   /**
+    *    Fuzzes a function with all of the workers until one fails, or until
+    *    the budget is used up.  See xpccut_campaign_run().
+    *
+    * \param target
+    *    The thread-safe function, usually a lambda, that takes a const char
+    *    pointer and an int size, and returns 'false' if the input reveals a
+    *    bug.
+    *
+    * \param max_iterations
+    *    The largest number of calls by each worker, or 0 for no limit.
+    *
+    * \param max_ms
+    *    The longest duration, in milliseconds, or 0 for no limit.
+    *
+    * \return
+    *    Returns 'true' if the budget was used up without a failure.
+    */
+
+   template <typename F>
+   bool run (F target, long long max_iterations, double max_ms = 0.0)
+   {
+      return m_is_valid && xpccut_campaign_run
+      (
+         &m_campaign, &FuzzCampaign::call_target<F>, &target,
+         max_iterations, max_ms
+      );
+   }
+
+   /**
+    * \getter m_is_valid
+    */
+
+   bool valid () const
+   {
+      return m_is_valid;
+   }
+
+   /**
+    *    Returns the number of workers.
+    */
+
+   int job_count () const
+   {
+      return xpccut_campaign_job_count(&m_campaign);
+   }
+
+   /**
+    *    Returns the index of the worker that failed, or -1.
+    */
+
+   int failed_job () const
+   {
+      return xpccut_campaign_failed_job(&m_campaign);
+   }
+
+   /**
+    *    Returns the number of inputs the workers have shared.
+    */
+
+   int shared_count () const
+   {
+      return xpccut_campaign_shared_count(&m_campaign);
+   }
+
+   /**
+    *    Returns the number of edges reached by any worker.
+    */
+
+   int edge_count () const
+   {
+      return xpccut_campaign_edge_count(&m_campaign);
+   }
+
+   /**
+    *    Returns the number of calls of the target by all of the workers.
+    */
+
+   long long iterations () const
+   {
+      return xpccut_campaign_iterations(&m_campaign);
+   }
+
+};             // FuzzCampaign
+
 extern bool fuzzy_line_compare
 (
    const std::string & actual,
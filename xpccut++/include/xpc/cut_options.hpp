@@ -107,6 +107,17 @@ private:
 
    unit_test_options_t m_Options;
 
+   /**
+    *    Points to the options that this object reads.  Normally this is
+    *    &m_Options.  For an object made by the view constructor, it points
+    *    to options that belong to someone else, such as the options that
+    *    xpc::cut::run() shares with every test, and m_Options is not used
+    *    until a setter is called.  Then the shared options are copied into
+    *    m_Options, so that the setting does not change them for everyone.
+    */
+
+   const unit_test_options_t * m_View;
+
    /**
     *    Provides a way for the caller to check if the object is valid.
     *    This check is normally needed only after the constructor is called.
@@ -158,6 +169,12 @@ public:
       const char * additionalhelp
    );
 
+   /*
+    *    View constructor.  Documented in the cpp file.
+    */
+
+   explicit cut_options (const unit_test_options_t & shared);
+
    /*
     *    Copy constructor.  Documented in the cpp file.
     */
@@ -208,6 +225,7 @@ public:
 
    bool init ()
    {
+      m_View = &m_Options;
       return xpccut_boolcast(unit_test_options_init(&m_Options));
    }
 
@@ -236,11 +254,25 @@ public:
     *    which needs to copy the options from
     *    xpc::cut::m_UnitTest.m_App_Options to
     *    cut::m_UnitTest_Options::m_Options.
+    *
+    *    The copy is about the size of a page of memory, so the test
+    *    runners use the view constructor instead.
     */
 
    void copy_options (const unit_test_options_t & options)
    {
       m_Options = options;
+      m_View = &m_Options;
+   }
+
+   /**
+    * \getter m_View
+    *    Returns 'true' if this object reads options that it does not own.
+    */
+
+   bool is_view () const
+   {
+      return m_View != &m_Options;
    }
 
    /*
@@ -270,7 +302,7 @@ public:
 
    void is_verbose (bool f)
    {
-      (void) unit_test_options_is_verbose_set(&m_Options, (cbool_t) f);
+      (void) unit_test_options_is_verbose_set(writable(), (cbool_t) f);
    }
 
    /**
@@ -279,7 +311,7 @@ public:
 
    bool is_verbose () const
    {
-      return xpccut_boolcast(unit_test_options_is_verbose(&m_Options));
+      return xpccut_boolcast(unit_test_options_is_verbose(m_View));
    }
 
    /**
@@ -288,7 +320,7 @@ public:
 
    void show_values (bool f)
    {
-      (void) unit_test_options_show_values_set(&m_Options, f);
+      (void) unit_test_options_show_values_set(writable(), f);
    }
 
    /**
@@ -297,7 +329,7 @@ public:
 
    bool show_values () const
    {
-      return xpccut_boolcast(unit_test_options_show_values(&m_Options));
+      return xpccut_boolcast(unit_test_options_show_values(m_View));
    }
 
    /**
@@ -306,7 +338,7 @@ public:
 
    void use_text_synch (bool f)
    {
-      (void) unit_test_options_use_text_synch_set(&m_Options, f);
+      (void) unit_test_options_use_text_synch_set(writable(), f);
    }
 
    /**
@@ -315,7 +347,7 @@ public:
 
    bool use_text_synch () const
    {
-      return xpccut_boolcast(unit_test_options_use_text_synch(&m_Options));
+      return xpccut_boolcast(unit_test_options_use_text_synch(m_View));
    }
 
    /**
@@ -324,7 +356,7 @@ public:
 
    void show_step_numbers (bool f)
    {
-      (void) unit_test_options_show_step_numbers_set(&m_Options, f);
+      (void) unit_test_options_show_step_numbers_set(writable(), f);
    }
 
    /**
@@ -333,7 +365,7 @@ public:
 
    bool show_step_numbers () const
    {
-      return xpccut_boolcast(unit_test_options_show_step_numbers(&m_Options));
+      return xpccut_boolcast(unit_test_options_show_step_numbers(m_View));
    }
 
    /**
@@ -342,7 +374,7 @@ public:
 
    void show_progress (bool f)
    {
-      (void) unit_test_options_show_progress_set(&m_Options, f);
+      (void) unit_test_options_show_progress_set(writable(), f);
    }
 
    /**
@@ -351,7 +383,7 @@ public:
 
    bool show_progress () const
    {
-      return xpccut_boolcast(unit_test_options_show_progress(&m_Options));
+      return xpccut_boolcast(unit_test_options_show_progress(m_View));
    }
 
    /**
@@ -360,7 +392,7 @@ public:
 
    void stop_on_error (bool f)
    {
-      (void) unit_test_options_stop_on_error_set(&m_Options, f);
+      (void) unit_test_options_stop_on_error_set(writable(), f);
    }
 
    /**
@@ -369,7 +401,7 @@ public:
 
    bool stop_on_error () const
    {
-      return xpccut_boolcast(unit_test_options_stop_on_error(&m_Options));
+      return xpccut_boolcast(unit_test_options_stop_on_error(m_View));
    }
 
    /**
@@ -378,7 +410,7 @@ public:
 
    void batch_mode (bool f)
    {
-      (void) unit_test_options_batch_mode_set(&m_Options, f);
+      (void) unit_test_options_batch_mode_set(writable(), f);
    }
 
    /**
@@ -387,7 +419,7 @@ public:
 
    bool batch_mode () const
    {
-      return xpccut_boolcast(unit_test_options_batch_mode(&m_Options));
+      return xpccut_boolcast(unit_test_options_batch_mode(m_View));
    }
 
    /**
@@ -396,7 +428,7 @@ public:
 
    void is_interactive (bool f)
    {
-      (void) unit_test_options_is_interactive_set(&m_Options, f);
+      (void) unit_test_options_is_interactive_set(writable(), f);
    }
 
    /**
@@ -405,7 +437,7 @@ public:
 
    bool is_interactive () const
    {
-      return xpccut_boolcast(unit_test_options_is_interactive(&m_Options));
+      return xpccut_boolcast(unit_test_options_is_interactive(m_View));
    }
 
    /**
@@ -414,7 +446,7 @@ public:
 
    void do_beep (bool f)
    {
-      (void) unit_test_options_do_beep_set(&m_Options, f);
+      (void) unit_test_options_do_beep_set(writable(), f);
    }
 
    /**
@@ -423,7 +455,7 @@ public:
 
    bool do_beep () const
    {
-      return xpccut_boolcast(unit_test_options_do_beep(&m_Options));
+      return xpccut_boolcast(unit_test_options_do_beep(m_View));
    }
 
    /**
@@ -432,7 +464,7 @@ public:
 
    void need_subtests (bool f)
    {
-      (void) unit_test_options_need_subtests_set(&m_Options, f);
+      (void) unit_test_options_need_subtests_set(writable(), f);
    }
 
    /**
@@ -441,7 +473,7 @@ public:
 
    bool need_subtests () const
    {
-      return xpccut_boolcast(unit_test_options_need_subtests(&m_Options));
+      return xpccut_boolcast(unit_test_options_need_subtests(m_View));
    }
 
    /**
@@ -450,7 +482,7 @@ public:
 
    void force_failure (bool f)
    {
-      (void) unit_test_options_force_failure_set(&m_Options, f);
+      (void) unit_test_options_force_failure_set(writable(), f);
    }
 
    /**
@@ -459,7 +491,7 @@ public:
 
    bool force_failure () const
    {
-      return xpccut_boolcast(unit_test_options_force_failure(&m_Options));
+      return xpccut_boolcast(unit_test_options_force_failure(m_View));
    }
 
    /**
@@ -468,7 +500,7 @@ public:
 
    void is_summary (bool f)
    {
-      (void) unit_test_options_is_summary_set(&m_Options, f);
+      (void) unit_test_options_is_summary_set(writable(), f);
    }
 
    /**
@@ -477,7 +509,7 @@ public:
 
    bool is_summary () const
    {
-      return xpccut_boolcast(unit_test_options_is_summary(&m_Options));
+      return xpccut_boolcast(unit_test_options_is_summary(m_View));
    }
 
    /**
@@ -486,7 +518,7 @@ public:
 
    void is_pause (bool f)
    {
-      (void) unit_test_options_is_pause_set(&m_Options, f);
+      (void) unit_test_options_is_pause_set(writable(), f);
    }
 
    /**
@@ -495,7 +527,7 @@ public:
 
    bool is_pause () const
    {
-      return xpccut_boolcast(unit_test_options_is_pause(&m_Options));
+      return xpccut_boolcast(unit_test_options_is_pause(m_View));
    }
 
    /**
@@ -504,7 +536,7 @@ public:
 
    void single_group (int v)
    {
-      (void) unit_test_options_test_group_set(&m_Options, v);
+      (void) unit_test_options_test_group_set(writable(), v);
    }
 
    /**
@@ -513,7 +545,7 @@ public:
 
    void single_group (const char * v)
    {
-      (void) unit_test_options_named_group_set(&m_Options, v);
+      (void) unit_test_options_named_group_set(writable(), v);
    }
 
    /**
@@ -522,7 +554,7 @@ public:
 
    int single_group () const
    {
-      return unit_test_options_test_group(&m_Options);
+      return unit_test_options_test_group(m_View);
    }
 
    /**
@@ -531,7 +563,7 @@ public:
 
    void single_case (int v)
    {
-      (void) unit_test_options_test_case_set(&m_Options, v);
+      (void) unit_test_options_test_case_set(writable(), v);
    }
 
    /**
@@ -540,7 +572,7 @@ public:
 
    void single_case (const char * v)
    {
-      (void) unit_test_options_named_case_set(&m_Options, v);
+      (void) unit_test_options_named_case_set(writable(), v);
    }
 
    /**
@@ -549,7 +581,7 @@ public:
 
    int single_case () const
    {
-      return unit_test_options_test_case(&m_Options);
+      return unit_test_options_test_case(m_View);
    }
 
    /**
@@ -558,7 +590,7 @@ public:
 
    void single_subtest (int v)
    {
-      (void) unit_test_options_single_subtest_set(&m_Options, v);
+      (void) unit_test_options_single_subtest_set(writable(), v);
    }
 
    /**
@@ -567,7 +599,7 @@ public:
 
    void single_subtest (const char * v)
    {
-      (void) unit_test_options_named_subtest_set(&m_Options, v);
+      (void) unit_test_options_named_subtest_set(writable(), v);
    }
 
    /**
@@ -576,7 +608,7 @@ public:
 
    int single_subtest () const
    {
-      return unit_test_options_single_subtest(&m_Options);
+      return unit_test_options_single_subtest(m_View);
    }
 
    /**
@@ -602,7 +634,7 @@ public:
 
    void current_test (int v)
    {
-      (void) unit_test_options_current_test_set(&m_Options, v);
+      (void) unit_test_options_current_test_set(writable(), v);
    }
 
    /**
@@ -611,7 +643,7 @@ public:
 
    int current_test () const
    {
-      return unit_test_options_current_test(&m_Options);
+      return unit_test_options_current_test(m_View);
    }
 
    /**
@@ -620,7 +652,7 @@ public:
 
    void test_sleep_time (int v)
    {
-      (void) unit_test_options_test_sleep_time_set(&m_Options, v);
+      (void) unit_test_options_test_sleep_time_set(writable(), v);
    }
 
    /**
@@ -629,7 +661,521 @@ public:
 
    int test_sleep_time () const
    {
-      return unit_test_options_test_sleep_time(&m_Options);
+      return unit_test_options_test_sleep_time(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_job_count_set()
+    */
+
+   void job_count (int v)
+   {
+      (void) unit_test_options_job_count_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_job_count()
+    */
+
+   int job_count () const
+   {
+      return unit_test_options_job_count(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_fuzz_job_count_set()
+    */
+
+   void fuzz_job_count (int v)
+   {
+      (void) unit_test_options_fuzz_job_count_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_fuzz_job_count()
+    */
+
+   int fuzz_job_count () const
+   {
+      return unit_test_options_fuzz_job_count(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_is_isolated_set()
+    */
+
+   void is_isolated (bool v)
+   {
+      (void) unit_test_options_is_isolated_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_is_isolated()
+    */
+
+   bool is_isolated () const
+   {
+      return xpccut_boolcast(unit_test_options_is_isolated(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_test_timeout_set()
+    */
+
+   void test_timeout (int v)
+   {
+      (void) unit_test_options_test_timeout_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_test_timeout()
+    */
+
+   int test_timeout () const
+   {
+      return unit_test_options_test_timeout(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_shard_count_set()
+    */
+
+   void shard_count (int v)
+   {
+      (void) unit_test_options_shard_count_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_shard_count()
+    */
+
+   int shard_count () const
+   {
+      return unit_test_options_shard_count(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_shard_index_set()
+    */
+
+   void shard_index (int v)
+   {
+      (void) unit_test_options_shard_index_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_shard_index()
+    */
+
+   int shard_index () const
+   {
+      return unit_test_options_shard_index(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_shard_mode_set()
+    */
+
+   void shard_mode (unit_test_shard_mode_t v)
+   {
+      (void) unit_test_options_shard_mode_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_shard_mode()
+    */
+
+   unit_test_shard_mode_t shard_mode () const
+   {
+      return unit_test_options_shard_mode(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_durations_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void durations_file (const std::string & v)
+   {
+      (void) unit_test_options_durations_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_durations_file()
+    *    Returns an empty string if no file is to be read.
+    */
+
+   std::string durations_file () const
+   {
+      const char * name = unit_test_options_durations_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_save_durations_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void save_durations_file (const std::string & v)
+   {
+      (void) unit_test_options_save_durations_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_save_durations_file()
+    *    Returns an empty string if no file is to be written.
+    */
+
+   std::string save_durations_file () const
+   {
+      const char * name = unit_test_options_save_durations_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_report_format_set()
+    */
+
+   void report_format (unit_test_report_format_t v)
+   {
+      (void) unit_test_options_report_format_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_report_format()
+    */
+
+   unit_test_report_format_t report_format () const
+   {
+      return unit_test_options_report_format(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_report_file_set()
+    *    An empty string restores the default file name.
+    */
+
+   void report_file (const std::string & v)
+   {
+      (void) unit_test_options_report_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_report_file()
+    *    Returns an empty string if no report is to be written.
+    */
+
+   std::string report_file () const
+   {
+      const char * name = unit_test_options_report_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_baseline_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void baseline_file (const std::string & v)
+   {
+      (void) unit_test_options_baseline_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_baseline_file()
+    *    Returns an empty string if no file is to be read.
+    */
+
+   std::string baseline_file () const
+   {
+      const char * name = unit_test_options_baseline_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_write_baseline_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void write_baseline_file (const std::string & v)
+   {
+      (void) unit_test_options_write_baseline_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_write_baseline_file()
+    *    Returns an empty string if no file is to be written.
+    */
+
+   std::string write_baseline_file () const
+   {
+      const char * name = unit_test_options_write_baseline_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_perf_tolerance_set()
+    */
+
+   void perf_tolerance (int v)
+   {
+      (void) unit_test_options_perf_tolerance_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_perf_tolerance()
+    */
+
+   int perf_tolerance () const
+   {
+      return unit_test_options_perf_tolerance(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_is_profiled_set()
+    */
+
+   void is_profiled (bool v)
+   {
+      (void) unit_test_options_is_profiled_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_is_profiled()
+    */
+
+   bool is_profiled () const
+   {
+      return xpccut_boolcast(unit_test_options_is_profiled(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_perf_counters_set()
+    */
+
+   void perf_counters (bool v)
+   {
+      (void) unit_test_options_perf_counters_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_perf_counters()
+    */
+
+   bool perf_counters () const
+   {
+      return xpccut_boolcast(unit_test_options_perf_counters(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_huge_pages_set()
+    */
+
+   void huge_pages (bool v)
+   {
+      (void) unit_test_options_huge_pages_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_huge_pages()
+    */
+
+   bool huge_pages () const
+   {
+      return xpccut_boolcast(unit_test_options_huge_pages(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_trace_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void trace_file (const std::string & v)
+   {
+      (void) unit_test_options_trace_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_trace_file()
+    *    Returns an empty string if no trace is to be recorded.
+    */
+
+   std::string trace_file () const
+   {
+      const char * name = unit_test_options_trace_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_history_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void history_file (const std::string & v)
+   {
+      (void) unit_test_options_history_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_history_file()
+    *    Returns an empty string if no history is kept.
+    */
+
+   std::string history_file () const
+   {
+      const char * name = unit_test_options_history_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_order_set()
+    */
+
+   void order (unit_test_order_t v)
+   {
+      (void) unit_test_options_order_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_order()
+    */
+
+   unit_test_order_t order () const
+   {
+      return unit_test_options_order(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_cache_file_set()
+    *    An empty string unsets the file name.
+    */
+
+   void cache_file (const std::string & v)
+   {
+      (void) unit_test_options_cache_file_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_cache_file()
+    *    Returns an empty string if no results are cached.
+    */
+
+   std::string cache_file () const
+   {
+      const char * name = unit_test_options_cache_file(m_View);
+      return std::string(name != nullptr ? name : "");
+   }
+
+   /**
+    * \setter unit_test_options_cache_key_set()
+    *    An empty string unsets the key.
+    */
+
+   void cache_key (const std::string & v)
+   {
+      (void) unit_test_options_cache_key_set(writable(), v.c_str());
+   }
+
+   /**
+    * \getter unit_test_options_cache_key()
+    *    Returns an empty string if the key is derived from the application.
+    */
+
+   std::string cache_key () const
+   {
+      const char * key = unit_test_options_cache_key(m_View);
+      return std::string(key != nullptr ? key : "");
+   }
+
+   /**
+    * \setter unit_test_options_use_cache_set()
+    */
+
+   void use_cache (bool v)
+   {
+      (void) unit_test_options_use_cache_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_use_cache()
+    */
+
+   bool use_cache () const
+   {
+      return xpccut_boolcast(unit_test_options_use_cache(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_repeat_count_set()
+    */
+
+   void repeat_count (int v)
+   {
+      (void) unit_test_options_repeat_count_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_repeat_count()
+    */
+
+   int repeat_count () const
+   {
+      return unit_test_options_repeat_count(m_View);
+   }
+
+   /**
+    * \setter unit_test_options_until_fail_set()
+    */
+
+   void until_fail (bool v)
+   {
+      (void) unit_test_options_until_fail_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_until_fail()
+    */
+
+   bool until_fail () const
+   {
+      return xpccut_boolcast(unit_test_options_until_fail(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_shuffle_set()
+    */
+
+   void shuffle (bool v)
+   {
+      (void) unit_test_options_shuffle_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_shuffle()
+    */
+
+   bool shuffle () const
+   {
+      return xpccut_boolcast(unit_test_options_shuffle(m_View));
+   }
+
+   /**
+    * \setter unit_test_options_shuffle_seed_set()
+    *    Also turns on the shuffle.
+    */
+
+   void shuffle_seed (unsigned v)
+   {
+      (void) unit_test_options_shuffle_seed_set(writable(), v);
+   }
+
+   /**
+    * \getter unit_test_options_shuffle_seed()
+    */
+
+   unsigned shuffle_seed () const
+   {
+      return unit_test_options_shuffle_seed(m_View);
    }
 
    /**
@@ -638,7 +1184,7 @@ public:
 
    void is_simulated (bool v)
    {
-      (void) unit_test_options_is_simulated_set(&m_Options, v);
+      (void) unit_test_options_is_simulated_set(writable(), v);
    }
 
    /**
@@ -647,7 +1193,7 @@ public:
 
    bool is_simulated () const
    {
-      return xpccut_boolcast(unit_test_options_is_simulated(&m_Options));
+      return xpccut_boolcast(unit_test_options_is_simulated(m_View));
    }
 
    /**
@@ -656,7 +1202,7 @@ public:
 
    void prompt_before (char v)
    {
-      (void) unit_test_options_prompt_before_set(&m_Options, v);
+      (void) unit_test_options_prompt_before_set(writable(), v);
    }
 
    /**
@@ -665,7 +1211,7 @@ public:
 
    char prompt_before () const
    {
-      return unit_test_options_prompt_before(&m_Options);
+      return unit_test_options_prompt_before(m_View);
    }
 
    /**
@@ -674,7 +1220,7 @@ public:
 
    void prompt_after (char v)
    {
-      (void) unit_test_options_prompt_after_set(&m_Options, v);
+      (void) unit_test_options_prompt_after_set(writable(), v);
    }
 
    /**
@@ -683,18 +1229,34 @@ public:
 
    char prompt_after () const
    {
-      return unit_test_options_prompt_after(&m_Options);
+      return unit_test_options_prompt_after(m_View);
    }
 
 private:
 
    /**
-    * \getter m_Options
+    * \getter m_View
     */
 
    const unit_test_options_t & options () const
    {
-      return m_Options;
+      return *m_View;
+   }
+
+   /**
+    *    Provides the options that a setter may change.  If this object is a
+    *    view, the viewed options are first copied into m_Options, and this
+    *    object stops being a view.
+    */
+
+   unit_test_options_t * writable ()
+   {
+      if (is_view())
+      {
+         m_Options = *m_View;
+         m_View = &m_Options;
+      }
+      return &m_Options;
    }
 
 };             /* class cut_options    */
@@ -0,0 +1,426 @@
+#if ! defined XPC_CUT_REGISTRY_HPP
+#define XPC_CUT_REGISTRY_HPP
+
+/**
+ * \file          cut_registry.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_registrar and
+ *    xpc::cut_fixture_registrar classes, and the XPC_CUT_TEST() and
+ *    XPC_CUT_FIXTURE() macros.  Also see the cut_registry.cpp module.
+ *
+ *    A test declared with XPC_CUT_TEST() adds itself, at static
+ *    initialization time, to a list of registered tests, along with its
+ *    group and case information.  xpc::cut::load_registered() then loads
+ *    the whole list in one pass, so no load() call can be forgotten.
+ *    A group fixture declared with XPC_CUT_FIXTURE() is loaded the same
+ *    way.
+ */
+
+#include <xpc/cut_options.hpp>         /* xpc::cut_options                    */
+#include <xpc/cut_status.hpp>          /* xpc::cut_status                     */
+#include <xpc/fixture.h>               /* unit_test_setup_func_t              */
+
+namespace xpc
+{
+
+/**
+ *    Provides one entry of the list of registered tests.
+ *
+ *    Each entry is a static object, and the entries are linked through
+ *    their m_Next members, so registering a test allocates no memory, and
+ *    does not depend on the order in which the translation units are
+ *    initialized.  The list itself is in no useful order;
+ *    cut::load_registered() sorts it by group and case number.
+ *
+ *    Only pointers to the names are kept, so the names must be string
+ *    literals.  They should not be passed through _(), since the text
+ *    domain is not yet set up at static initialization time.
+ */
+
+class cut_registrar
+{
+
+public:
+
+   /**
+    *    Provides the signature of a C++ unit-test function.  It is the same
+    *    as the private xpc::cut::test_function type.
+    */
+
+   typedef cut_status (* test_function)
+   (
+      const cut_options & options   /**< Global options for the unit tests.   */
+   );
+
+private:
+
+   /**
+    *    The registered unit-test function.
+    */
+
+   test_function m_Test;
+
+   /**
+    *    The group number that the test passes to its cut_status.
+    */
+
+   int m_Test_Group;
+
+   /**
+    *    The case number that the test passes to its cut_status.
+    */
+
+   int m_Test_Case;
+
+   /**
+    *    The group name that the test passes to its cut_status.
+    */
+
+   const char * m_Group_Name;
+
+   /**
+    *    The case name that the test passes to its cut_status.
+    */
+
+   const char * m_Case_Name;
+
+   /**
+    *    The timeout of the test, in milliseconds, or 0 to use the
+    *    --test-timeout value.
+    */
+
+   int m_Timeout;
+
+   /**
+    *    Indicates that the test must run alone.  See
+    *    xpc::cut::load_serial().
+    */
+
+   bool m_Is_Serial;
+
+   /**
+    *    The entry registered before this one, or null.
+    */
+
+   const cut_registrar * m_Next;
+
+   /**
+    *    The entry registered last, which is the head of the list.  Being a
+    *    plain pointer, it is set to null before any constructor runs.
+    */
+
+   static const cut_registrar * sm_Head;
+
+   /**
+    *    The number of entries in the list.
+    */
+
+   static int sm_Count;
+
+public:
+
+   cut_registrar
+   (
+      test_function test,
+      int testgroup,
+      int testcase,
+      const char * groupname,
+      const char * casename,
+      int timeout = 0,
+      bool isserial = false
+   );
+
+   /**
+    * \getter sm_Head
+    */
+
+   static const cut_registrar * first ()
+   {
+      return sm_Head;
+   }
+
+   /**
+    * \getter sm_Count
+    */
+
+   static int count ()
+   {
+      return sm_Count;
+   }
+
+   /**
+    * \getter m_Next
+    */
+
+   const cut_registrar * next () const
+   {
+      return m_Next;
+   }
+
+   /**
+    * \getter m_Test
+    */
+
+   test_function test () const
+   {
+      return m_Test;
+   }
+
+   /**
+    * \getter m_Test_Group
+    */
+
+   int group () const
+   {
+      return m_Test_Group;
+   }
+
+   /**
+    * \getter m_Test_Case
+    */
+
+   int test_case () const
+   {
+      return m_Test_Case;
+   }
+
+   /**
+    * \getter m_Group_Name
+    */
+
+   const char * group_name () const
+   {
+      return m_Group_Name;
+   }
+
+   /**
+    * \getter m_Case_Name
+    */
+
+   const char * case_name () const
+   {
+      return m_Case_Name;
+   }
+
+   /**
+    * \getter m_Timeout
+    */
+
+   int timeout () const
+   {
+      return m_Timeout;
+   }
+
+   /**
+    * \getter m_Is_Serial
+    */
+
+   bool is_serial () const
+   {
+      return m_Is_Serial;
+   }
+
+};             /* class cut_registrar  */
+
+/**
+ *    Provides one entry of the list of registered group fixtures.  It works
+ *    like cut_registrar, and cut::load_registered() passes each entry to
+ *    cut::load_fixture().
+ */
+
+class cut_fixture_registrar
+{
+
+private:
+
+   /**
+    *    The group number of the cases that share the fixture.
+    */
+
+   int m_Test_Group;
+
+   /**
+    *    The function that sets up the fixture.
+    */
+
+   unit_test_setup_func_t m_Setup;
+
+   /**
+    *    The function that tears down the fixture, or null.
+    */
+
+   unit_test_teardown_func_t m_Teardown;
+
+   /**
+    *    The entry registered before this one, or null.
+    */
+
+   const cut_fixture_registrar * m_Next;
+
+   /**
+    *    The entry registered last, which is the head of the list.
+    */
+
+   static const cut_fixture_registrar * sm_Head;
+
+public:
+
+   cut_fixture_registrar
+   (
+      int testgroup,
+      unit_test_setup_func_t setup,
+      unit_test_teardown_func_t teardown
+   );
+
+   /**
+    * \getter sm_Head
+    */
+
+   static const cut_fixture_registrar * first ()
+   {
+      return sm_Head;
+   }
+
+   /**
+    * \getter m_Next
+    */
+
+   const cut_fixture_registrar * next () const
+   {
+      return m_Next;
+   }
+
+   /**
+    * \getter m_Test_Group
+    */
+
+   int group () const
+   {
+      return m_Test_Group;
+   }
+
+   /**
+    * \getter m_Setup
+    */
+
+   unit_test_setup_func_t setup () const
+   {
+      return m_Setup;
+   }
+
+   /**
+    * \getter m_Teardown
+    */
+
+   unit_test_teardown_func_t teardown () const
+   {
+      return m_Teardown;
+   }
+
+};             /* class cut_fixture_registrar  */
+
+}              /* namespace xpc        */
+
+/**
+ *    Declares and registers a C++ unit-test function.  The macro is
+ *    followed by the body of the function, which gets its options in the
+ *    \a options parameter, as usual:
+ *
+\verbatim
+      XPC_CUT_TEST(cut_unit_test_08_05, 8, 5, "xpc::cut", "registry")
+      {
+         xpc::cut_status status(options, 8, 5, "xpc::cut", "registry");
+         . . .
+         return status;
+      }
+\endverbatim
+ *
+ *    The group, case, and names should be the same as the ones given to
+ *    the cut_status constructor, since xpc::cut::run() uses them to skip
+ *    the test without calling it.  The function and its registrar are
+ *    static, so they do not clash with other translation units.
+ */
+
+#define XPC_CUT_TEST(testfunc, testgroup, testcase, groupname, casename)     \
+   static xpc::cut_status testfunc (const xpc::cut_options & options);      \
+   static const xpc::cut_registrar testfunc ## _registrar                   \
+   (                                                                        \
+      testfunc, testgroup, testcase, groupname, casename                    \
+   );                                                                       \
+   static xpc::cut_status testfunc (const xpc::cut_options & options)
+
+/**
+ *    Declares and registers a unit-test function, as XPC_CUT_TEST() does,
+ *    and gives it a timeout of its own, in milliseconds, which overrides
+ *    the --test-timeout value.  See xpc::cut::load_timeout().
+ */
+
+#define XPC_CUT_TEST_TIMEOUT(testfunc, testgroup, testcase, groupname,       \
+ casename, timeout)                                                         \
+   static xpc::cut_status testfunc (const xpc::cut_options & options);      \
+   static const xpc::cut_registrar testfunc ## _registrar                   \
+   (                                                                        \
+      testfunc, testgroup, testcase, groupname, casename, timeout           \
+   );                                                                       \
+   static xpc::cut_status testfunc (const xpc::cut_options & options)
+
+/**
+ *    Declares and registers a unit-test function, as XPC_CUT_TEST() does,
+ *    and marks it as one that must run alone, because it changes state
+ *    that all of the tests share, or because it measures time.  See
+ *    xpc::cut::load_serial().
+ */
+
+#define XPC_CUT_TEST_SERIAL(testfunc, testgroup, testcase, groupname,        \
+ casename)                                                                  \
+   XPC_CUT_TEST_SERIAL_TIMEOUT                                              \
+   (                                                                        \
+      testfunc, testgroup, testcase, groupname, casename, 0                 \
+   )
+
+/**
+ *    Declares and registers a unit-test function that must run alone, as
+ *    XPC_CUT_TEST_SERIAL() does, and gives it a timeout of its own, as
+ *    XPC_CUT_TEST_TIMEOUT() does.
+ */
+
+#define XPC_CUT_TEST_SERIAL_TIMEOUT(testfunc, testgroup, testcase,           \
+ groupname, casename, timeout)                                              \
+   static xpc::cut_status testfunc (const xpc::cut_options & options);      \
+   static const xpc::cut_registrar testfunc ## _registrar                   \
+   (                                                                        \
+      testfunc, testgroup, testcase, groupname, casename, timeout, true     \
+   );                                                                       \
+   static xpc::cut_status testfunc (const xpc::cut_options & options)
+
+/**
+ *    Registers a fixture for a test group, to be loaded by
+ *    xpc::cut::load_registered() along with the registered tests.  The
+ *    \a name only has to be unique in the translation unit:
+ *
+\verbatim
+      static cbool_t table_setup (void ** data) { . . . }
+      static void table_teardown (void * data) { . . . }
+      XPC_CUT_FIXTURE(table_fixture, 12, table_setup, table_teardown);
+\endverbatim
+ */
+
+#define XPC_CUT_FIXTURE(name, testgroup, setup, teardown)                  \
+   static const xpc::cut_fixture_registrar name ## _registrar              \
+   (                                                                        \
+      testgroup, setup, teardown                                            \
+   )
+
+#endif         /* XPC_CUT_REGISTRY_HPP */
+
+/*
+ * cut_registry.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
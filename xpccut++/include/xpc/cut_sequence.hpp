@@ -14,10 +14,12 @@
  *    sequence-diagram information.  Also see the cut_sequence.cpp module and
  *    the xpc::Sequencing class.
  *
+ *    While the trace buffer of the C library is enabled (for example, by the
+ *    --trace-file option), the entering and leaving of each scope are
+ *    recorded there, with time-stamps, instead of being printed.
  */
 
 #include <xpc/macros_subset.h>         // nullptr
-#include <string>                      // std::string
 
 #ifdef DOXYGEN
 #define XPC_SEQUENCE_DEBUG             // turn on some documentation
@@ -49,9 +51,17 @@
 
 #define XPC_SEQUENCE_MARK(x)           xpc::Sequencing xpc_seqm(x, true)
 
+/**
+ *    This macro is like XPC_SEQUENCE_MARK(), but the scope is recorded
+ *    only while the trace is enabled, and is never printed.
+ */
+
+#define XPC_SEQUENCE_TRACE(x)          xpc::Sequencing xpc_seqt(x, false)
+
 #else
 #define XPC_SEQUENCE
 #define XPC_SEQUENCE_MARK(x)
+#define XPC_SEQUENCE_TRACE(x)
 #endif
 
 namespace xpc
@@ -80,9 +90,12 @@ private:
     *    Provides the tag name provided to the constructor.
     *
     *    This is normally the name of the function or block to be sequenced.
+    *    Only the pointer is kept, because the trace keeps it until it is
+    *    written out; so the tag must be a string literal, __func__, or some
+    *    other string that lasts, such as one from xpccut_intern().
     */
 
-   std::string m_Tag_Name;
+   const char * m_Tag_Name;
 
    /**
     *    Provides a flag to indicate if the sequencing should be shown
@@ -90,6 +103,13 @@ private:
 
    bool m_Do_Show;
 
+   /**
+    *    Provides a flag to indicate if the entering of the scope went into
+    *    the trace, so that the leaving of it goes there, too.
+    */
+
+   bool m_Is_Traced;
+
    /**
     *    Provides a static counter that covers all instances.
     */
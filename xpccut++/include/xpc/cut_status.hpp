@@ -25,7 +25,10 @@
 
 #define XPC_NO_THISPTR                 /* do not test the C "this" pointers   */
 
+#include <cstddef>                     /* std::size_t                         */
+#include <sstream>                     /* std::ostringstream                  */
 #include <string>                      /* std::string                         */
+#include <type_traits>                 /* std::decay, std::integral_constant  */
 #include <xpc/unit_test_status.h>      /* unit_test_status_t structure        */
 
 namespace xpc
@@ -38,6 +41,20 @@ namespace xpc
 
 class cut;                             /* forward reference                   */
 
+/**
+ *    Provides access to the options of the test, so that a benchmark can
+ *    decide whether to show its results.
+ */
+
+class cut_benchmark;                   /* forward reference                   */
+
+/**
+ *    Provides access to the options of the test, so that a concurrent run
+ *    can decide whether to show its results.
+ */
+
+class cut_concurrent;                  /* forward reference                   */
+
 /**
  *    Provides a class reference so that cut_options class can be used as a
  *    reference parameter.
@@ -55,6 +72,23 @@ class cut_options;                     /* forward reference                   */
 
 class cut_white_box;                   /* forward reference                   */
 
+/**
+ *    Tells whether a type is a C string, a character pointer or array, which
+ *    the templated checks of cut_status compare with strcmp(), rather than
+ *    by address.
+ */
+
+template <typename T>
+struct cut_is_c_string : std::integral_constant
+<
+   bool,
+   std::is_same<typename std::decay<T>::type, char *>::value ||
+   std::is_same<typename std::decay<T>::type, const char *>::value
+>
+{
+   // no code
+};
+
 /**
  *    Provides an object to manage a unit_test_status_t structure.
  *
@@ -80,6 +114,19 @@ class cut_status
 
    friend class cut;
 
+   /**
+    *    The cut_benchmark class is a friend so that it can check the output
+    *    options of the test, via m_Status, before showing its results.
+    */
+
+   friend class cut_benchmark;
+
+   /**
+    *    The cut_concurrent class is a friend for the same reason.
+    */
+
+   friend class cut_concurrent;
+
    /**
     *    Provides a way to perform white-box testing of the cut_status
     *    class.
@@ -298,6 +345,221 @@ public:
       );
    }
 
+   /**
+    * \accessor unit_test_status_string_check()
+    *
+    *    This overload takes C strings, so that a check of string literals
+    *    does not build two temporary std::string objects.
+    */
+
+   bool string_check (const char * expected_value, const char * actual_value)
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_string_check(&m_Status, expected_value, actual_value)
+      );
+   }
+
+   /**
+    *    Checks that two values are equal, as int_check() does, but for any
+    *    types that can be compared with "==" and written to a std::ostream.
+    *    C strings are compared with strcmp(), as string_check() does.
+    *
+    *    A passing check costs the comparison and a store only; the values
+    *    are formatted, and memory allocated, only when the check fails.
+    *    This makes these checks fit for the inner loops of stress tests and
+    *    for no_alloc_check().
+    *
+    * \return
+    *    Returns 'true' if the values are equal.
+    */
+
+   template <typename T, typename U>
+   bool check_eq (const T & expected_value, const U & actual_value)
+   {
+      return equal
+      (
+         expected_value, actual_value,
+         std::integral_constant
+         <
+            bool, cut_is_c_string<T>::value && cut_is_c_string<U>::value
+         >()
+      ) ? checked() : check_failed(expected_value, nullptr, actual_value) ;
+   }
+
+   /**
+    *    Checks that two values differ.  See check_eq().
+    */
+
+   template <typename T, typename U>
+   bool check_ne (const T & lhs, const U & rhs)
+   {
+      return ! equal
+      (
+         lhs, rhs,
+         std::integral_constant
+         <
+            bool, cut_is_c_string<T>::value && cut_is_c_string<U>::value
+         >()
+      ) ? checked() : check_failed(lhs, "!=", rhs) ;
+   }
+
+   /**
+    *    Checks that \a lhs is less than \a rhs.  See check_eq().
+    */
+
+   template <typename T, typename U>
+   bool check_lt (const T & lhs, const U & rhs)
+   {
+      return lhs < rhs ? checked() : check_failed(lhs, "<", rhs) ;
+   }
+
+   /**
+    *    Checks that \a lhs is less than or equal to \a rhs.  See
+    *    check_eq().
+    */
+
+   template <typename T, typename U>
+   bool check_le (const T & lhs, const U & rhs)
+   {
+      return lhs <= rhs ? checked() : check_failed(lhs, "<=", rhs) ;
+   }
+
+   /**
+    *    Checks that a floating-point value is within \a tolerance of the
+    *    expected value.  A NaN is never near anything.  See check_eq().
+    */
+
+   bool check_near
+   (
+      double expected_value,
+      double actual_value,
+      double tolerance
+   )
+   {
+      double difference = actual_value - expected_value;
+      if (difference < 0.0)
+         difference = -difference;
+
+      return difference <= tolerance ?
+         checked() : near_failed(expected_value, actual_value, tolerance) ;
+   }
+
+   /**
+    * \accessor unit_test_status_perf_check()
+    *
+    * \param name
+    *    The name of the measurement in the --baseline file.
+    *
+    * \param measured
+    *    The measured value, such as a median time.  Smaller is better.
+    *
+    * \param noise
+    *    The standard deviation of the measurement, if known.
+    */
+
+   bool perf_check
+   (
+      const std::string & name,
+      double measured,
+      double noise = 0.0
+   )
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_perf_check
+         (
+            &m_Status, name.c_str(), measured, noise
+         )
+      );
+   }
+
+   /**
+    * \accessor unit_test_status_no_alloc_check()
+    *
+    *    Fails if the calling thread allocated any memory since the current
+    *    sub-test started, or since the last call.  A std::string or a
+    *    std::vector that grows counts as well; see alloc_count.h.
+    */
+
+   bool no_alloc_check ()
+   {
+      return xpccut_boolcast(unit_test_status_no_alloc_check(&m_Status));
+   }
+
+   /**
+    * \accessor unit_test_status_buffer_check()
+    *
+    *    Compares two buffers of bytes as one check, and shows only the
+    *    first mismatch, with a hex dump of the bytes around it.
+    */
+
+   bool buffer_check
+   (
+      const void * expected_value,
+      const void * actual_value,
+      std::size_t length
+   )
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_buffer_check
+         (
+            &m_Status, expected_value, actual_value, length
+         )
+      );
+   }
+
+   /**
+    * \accessor unit_test_status_int_array_check()
+    */
+
+   bool int_array_check
+   (
+      const int * expected_value,
+      const int * actual_value,
+      std::size_t count
+   )
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_int_array_check
+         (
+            &m_Status, expected_value, actual_value, count
+         )
+      );
+   }
+
+   /**
+    * \accessor unit_test_status_double_array_check()
+    */
+
+   bool double_array_check
+   (
+      const double * expected_value,
+      const double * actual_value,
+      std::size_t count,
+      double tolerance
+   )
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_double_array_check
+         (
+            &m_Status, expected_value, actual_value, count, tolerance
+         )
+      );
+   }
+
+   /**
+    *    Runs code on a number of threads at once, as a sub-test.  This
+    *    function is defined in cut_concurrent.hpp, which must be included
+    *    to use it.  See the xpc::cut_concurrent class.
+    */
+
+   template <typename F>
+   bool run_concurrently (const std::string & name, int threads, F body);
+
    /**
     * \accessor unit_test_status_fail_deliberately()
     */
@@ -374,6 +636,26 @@ public:
       );
    }
 
+   /**
+    * \accessor unit_test_status_next_record()
+    *
+    * \param table
+    *    The table being walked, from xpccut_table_open() or
+    *    xpccut_table_init_rows().
+    *
+    * \param record
+    *    The previous record, or XPCCUT_RECORD_INIT to start; it receives
+    *    the next record to be checked.
+    */
+
+   bool next_record (const xpccut_table_t * table, xpccut_record_t * record)
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_next_record(&m_Status, table, record)
+      );
+   }
+
    /**
     * \accessor unit_test_status_prompt()
     *
@@ -593,6 +875,27 @@ public:
       return xpccut_boolcast(unit_test_status_is_okay(&m_Status));
    }
 
+   /**
+    * \accessor unit_test_status_failure_count()
+    */
+
+   int failure_count () const
+   {
+      return unit_test_status_failure_count(&m_Status);
+   }
+
+   /**
+    * \accessor unit_test_status_failure()
+    *
+    * \param index
+    *    The entry of the failure log, from 0 to XPCCUT_FAILURE_LOG_SIZE - 1.
+    */
+
+   const unit_test_failure_t * failure (int index) const
+   {
+      return unit_test_status_failure(&m_Status, index);
+   }
+
    /**
     * \accessor unit_test_status_duration_ms()
     */
@@ -602,6 +905,45 @@ public:
       return unit_test_status_duration_ms(&m_Status);
    }
 
+   /**
+    * \accessor unit_test_status_resources()
+    */
+
+   const xpccut_resources_t * resources () const
+   {
+      return unit_test_status_resources(&m_Status);
+   }
+
+   /**
+    * \accessor unit_test_status_counters()
+    */
+
+   const xpccut_perf_values_t * counters () const
+   {
+      return unit_test_status_counters(&m_Status);
+   }
+
+   /**
+    * \accessor unit_test_status_allocations()
+    */
+
+   const xpccut_alloc_counts_t * allocations () const
+   {
+      return unit_test_status_allocations(&m_Status);
+   }
+
+   /**
+    * \accessor unit_test_status_subtest_allocations()
+    */
+
+   bool subtest_allocations (xpccut_alloc_counts_t & counts) const
+   {
+      return xpccut_boolcast
+      (
+         unit_test_status_subtest_allocations(&m_Status, &counts)
+      );
+   }
+
    /**
     * \accessor unit_test_status_show()
     */
@@ -671,6 +1013,91 @@ public:                    /* self-test functions  */
 
 private:
 
+   /**
+    *    Records a passing check, as unit_test_status_pass() does, but
+    *    without the call.
+    */
+
+   bool checked ()
+   {
+#if defined __GNUC__ && defined __ATOMIC_RELAXED
+      __atomic_store_n
+      (
+         &m_Status.m_Test_Result, cbool_t(true), __ATOMIC_RELAXED
+      );
+#else
+      m_Status.m_Test_Result = true;
+#endif
+      return true;
+   }
+
+   /**
+    *    Compares two values with "==", for check_eq() and check_ne().
+    */
+
+   template <typename T, typename U>
+   static bool equal (const T & lhs, const U & rhs, std::false_type)
+   {
+      return lhs == rhs;
+   }
+
+   static bool equal (const char * lhs, const char * rhs, std::true_type);
+
+   /**
+    *    Formats a value for the message of a failed check.  Strings are
+    *    quoted, as string_check() shows them.
+    */
+
+   template <typename T>
+   static std::string format (const T & value)
+   {
+      return format(value, cut_is_c_string<T>());
+   }
+
+   static std::string format (const std::string & value);
+
+   template <typename T>
+   static std::string format (const T & value, std::false_type)
+   {
+      std::ostringstream output;
+      output << std::boolalpha << value;
+      return output.str();
+   }
+
+   static std::string format (const char * value, std::true_type);
+
+   /**
+    *    Records a failed check, and shows the values unless --silent is in
+    *    force.  A null \a relation shows the values in the manner of
+    *    int_check().
+    *
+    * \return
+    *    Always returns 'false'.
+    */
+
+   template <typename T, typename U>
+   bool check_failed (const T & lhs, const char * relation, const U & rhs)
+   {
+      (void) pass(false);
+      if (! xpccut_is_silent())
+         show_check(format(lhs), relation, format(rhs));
+
+      return false;
+   }
+
+   bool near_failed
+   (
+      double expected_value,
+      double actual_value,
+      double tolerance
+   );
+   static void show_check
+   (
+      const std::string & lhs,
+      const char * relation,
+      const std::string & rhs
+   );
+
    /**
     * \accessor unit_test_status_init()
     *    This function is actually dangerous to use, since it will
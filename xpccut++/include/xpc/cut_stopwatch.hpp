@@ -0,0 +1,126 @@
+#if ! defined XPC_CUT_STOPWATCH_HPP
+#define XPC_CUT_STOPWATCH_HPP
+
+/**
+ * \file          cut_stopwatch.hpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the declarations for the xpc::cut_stopwatch class, a C++
+ *    wrapper for the xpccut_stopwatch_t structure of the C library.  Also
+ *    see the cut_stopwatch.cpp module.
+ */
+
+#include <xpc/portable_subset.h>       /* xpccut_stopwatch_t                  */
+
+namespace xpc
+{
+
+/**
+ *    Provides a stopwatch that starts when it is created.
+ *
+ *    Each object has its own state, so stopwatches can be nested, and can
+ *    be used by any number of threads at once, with no locking.  If the
+ *    stopwatch is given a variable to fill in, it stores its elapsed time
+ *    there when it goes out of scope:
+ *
+\verbatim
+      double ms;
+      {
+         xpc::cut_stopwatch sw(ms);
+         . . .                         // code to be timed
+      }
+      // ms now holds the time taken by the block above
+\endverbatim
+ */
+
+class cut_stopwatch
+{
+
+private:
+
+   /**
+    *    The C stopwatch that does the work.
+    */
+
+   xpccut_stopwatch_t m_Stopwatch;
+
+   /**
+    *    The variable that receives the elapsed time, in milliseconds, when
+    *    the stopwatch is destroyed.  It can be null.
+    */
+
+   double * m_Result_ms;
+
+private:
+
+   cut_stopwatch (const cut_stopwatch &);
+   cut_stopwatch & operator = (const cut_stopwatch &);
+
+public:
+
+   cut_stopwatch ();
+   explicit cut_stopwatch (double & result_ms);
+   ~cut_stopwatch ();
+
+   /**
+    * \accessor xpccut_stopwatch_begin()
+    *    Restarts the stopwatch, and clears the history of laps.
+    */
+
+   void restart ()
+   {
+      (void) xpccut_stopwatch_begin(&m_Stopwatch);
+   }
+
+   /**
+    * \accessor xpccut_stopwatch_elapsed()
+    */
+
+   double elapsed_ms () const
+   {
+      return xpccut_stopwatch_elapsed(&m_Stopwatch);
+   }
+
+   /**
+    * \accessor xpccut_stopwatch_next_lap()
+    */
+
+   double next_lap ()
+   {
+      return xpccut_stopwatch_next_lap(&m_Stopwatch);
+   }
+
+   /**
+    * \accessor xpccut_stopwatch_lap_count()
+    */
+
+   int lap_count () const
+   {
+      return xpccut_stopwatch_lap_count(&m_Stopwatch);
+   }
+
+   /**
+    * \accessor xpccut_stopwatch_lap_ms()
+    */
+
+   double lap_ms (int lap) const
+   {
+      return xpccut_stopwatch_lap_ms(&m_Stopwatch, lap);
+   }
+
+};             /* class cut_stopwatch  */
+
+}              /* namespace xpc        */
+
+#endif         /* XPC_CUT_STOPWATCH_HPP */
+
+/*
+ * cut_stopwatch.hpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
@@ -13,8 +13,9 @@
  *    for more information.
  */
 
-#include <iostream>                    /* std::cout and std::cerr             */
+#include <algorithm>                   /* std::stable_sort()                  */
 #include <xpc/cut.hpp>                 /* the xpc::cut class                  */
+#include <xpc/cut_registry.hpp>        /* xpc::cut_registrar                  */
 
 /**
  * \doxygen
@@ -382,6 +383,310 @@ cut::load
    return result;
 }
 
+/**
+ *    Loads the address of a unit-test function into the test container,
+ *    along with the group number, case number, and names that the test
+ *    passes to its cut_status constructor.
+ *
+ *    This is the C++ counterpart of the C function unit_test_register().
+ *    With this information, run() can skip a test that the --group,
+ *    --case, or --shard-index options rule out without calling it, and
+ *    the --summarize option lists the test without calling it.  Only the
+ *    pointers to the names are kept, so string literals should be used.
+ *
+ * \param test
+ *    A unit-test C++ function pointer, with a test_function function
+ *    signature.
+ *
+ * \param testgroup
+ *    The group number used by the test, greater than 0.
+ *
+ * \param testcase
+ *    The case number used by the test, greater than 0.
+ *
+ * \param groupname
+ *    The group name used by the test.
+ *
+ * \param casename
+ *    The case name used by the test.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the test was loaded.
+ *    As with the other load() function, 'false' is returned if c_load()
+ *    has already been called.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_04()
+ */
+
+bool
+cut::load
+(
+   const test_function test,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename
+)
+{
+   bool result = cut_not_nullptr(test);
+   if (result)
+   {
+      result = ! m_Run_C_Unit_Tests;
+      if (! result)
+         xpccut_errprint_func(_("cannot mix C and C++ unit-tests"));
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   if (result)
+   {
+      if (m_Is_Valid)
+      {
+         result = xpccut_boolcast
+         (
+            unit_test_cpp_load_info
+            (
+               &m_UnitTest, testgroup, testcase, groupname, casename
+            )
+         );
+         if (result)
+            m_UnitTest_List.push_back(test);
+      }
+      else
+         xpccut_errprint_func(_("the unit-test object is invalid"));
+   }
+   return result;
+}
+
+/**
+ *    Compares two registered tests by group number, then by case number,
+ *    for cut::load_registered().
+ *
+ * \return
+ *    Returns 'true' if \a a should be loaded before \a b.
+ */
+
+static bool
+registrar_less (const cut_registrar * a, const cut_registrar * b)
+{
+   if (a->group() != b->group())
+      return a->group() < b->group();
+   else
+      return a->test_case() < b->test_case();
+}
+
+/**
+ *    Loads every test declared with the XPC_CUT_TEST() macro, in order of
+ *    group number and case number, along with its group and case
+ *    information.  See the load() function that takes that information.
+ *    A test declared with XPC_CUT_TEST_TIMEOUT() also gets its timeout.
+ *    Then it loads every fixture declared with the XPC_CUT_FIXTURE() macro.
+ *
+ *    The number of registered tests is known in advance, so the test list
+ *    and the case-list of the C unit_test_t structure are each sized just
+ *    once, instead of growing as the tests are loaded.
+ *
+ * \return
+ *    Returns 'true' if every registered test was loaded.  If two tests
+ *    have the same group and case numbers, the second one is not loaded,
+ *    an error is shown, and 'false' is returned, but the other tests are
+ *    still loaded.  Returns 'false' if c_load() has already been called.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_05()
+ */
+
+bool
+cut::load_registered ()
+{
+   bool result = m_Is_Valid;
+   if (result)
+   {
+      result = ! m_Run_C_Unit_Tests;
+      if (! result)
+         xpccut_errprint_func(_("cannot mix C and C++ unit-tests"));
+   }
+   else
+      xpccut_errprint_func(_("the unit-test object is invalid"));
+
+   if (result)
+   {
+      int count = cut_registrar::count();
+      std::vector<const cut_registrar *> entries;
+      entries.reserve(count);
+      for
+      (
+         const cut_registrar * r = cut_registrar::first();
+         r != nullptr;
+         r = r->next()
+      )
+      {
+         entries.push_back(r);
+      }
+      std::stable_sort(entries.begin(), entries.end(), registrar_less);
+      m_UnitTest_List.reserve(m_UnitTest_List.size() + count);
+      if (! unit_test_reserve(&m_UnitTest, m_UnitTest.m_Test_Count + count))
+         result = false;                     /* load() can still grow it   */
+
+      for (size_t i = 0; i < entries.size(); ++i)
+      {
+         const cut_registrar * r = entries[i];
+         if (i > 0 && ! registrar_less(entries[i - 1], r))
+         {
+            xpccut_errprint_ex(_("duplicate group and case"), r->case_name());
+            result = false;
+         }
+         else if
+         (
+            ! load
+            (
+               r->test(), r->group(), r->test_case(),
+               r->group_name(), r->case_name()
+            )
+         )
+         {
+            result = false;
+         }
+         else if (r->timeout() > 0 && ! load_timeout(r->timeout()))
+            result = false;
+         else if (r->is_serial() && ! load_serial())
+            result = false;
+      }
+      for
+      (
+         const cut_fixture_registrar * f = cut_fixture_registrar::first();
+         f != nullptr;
+         f = f->next()
+      )
+      {
+         if (! load_fixture(f->group(), f->setup(), f->teardown()))
+            result = false;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Loads a fixture for a test group, which the cases of the group that
+ *    were loaded with their group information share.  This is the C++
+ *    counterpart of the C function unit_test_fixture(), which describes
+ *    when the \a setup and \a teardown functions are called.
+ *
+ * \param testgroup
+ *    The group number of the cases that share the fixture.
+ *
+ * \param setup
+ *    Makes the shared state, which the cases get from fixture_data().
+ *
+ * \param teardown
+ *    Cleans up the shared state.  It can be null.
+ *
+ * \return
+ *    Returns 'true' if the fixture was loaded.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_06()
+ */
+
+bool
+cut::load_fixture
+(
+   int testgroup,
+   unit_test_setup_func_t setup,
+   unit_test_teardown_func_t teardown
+)
+{
+   bool result = m_Is_Valid;
+   if (result)
+   {
+      result = xpccut_boolcast
+      (
+         unit_test_fixture(&m_UnitTest, testgroup, setup, teardown)
+      );
+   }
+   else
+      xpccut_errprint_func(_("the unit-test object is invalid"));
+
+   return result;
+}
+
+/**
+ *    Gives the test loaded last a timeout of its own, which overrides the
+ *    --test-timeout value.  This is the C++ counterpart of the C function
+ *    unit_test_load_timeout().
+ *
+ * \param timeout
+ *    The timeout of the test, in milliseconds, or 0 to put the test back
+ *    on the --test-timeout value.
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded, and the timeout is valid.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_07()
+ */
+
+bool
+cut::load_timeout (int timeout)
+{
+   bool result = m_Is_Valid;
+   if (result)
+      result = xpccut_boolcast(unit_test_load_timeout(&m_UnitTest, timeout));
+   else
+      xpccut_errprint_func(_("the unit-test object is invalid"));
+
+   return result;
+}
+
+/**
+ *    Marks the test loaded last as one whose records, rather than the test
+ *    itself, are split among the shards.  This is the C++ counterpart of
+ *    the C function unit_test_load_spread().
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded.
+ *
+ * \unittests
+ *    -  cut_unit_test_16_01()
+ */
+
+bool
+cut::load_spread ()
+{
+   bool result = m_Is_Valid;
+   if (result)
+      result = xpccut_boolcast(unit_test_load_spread(&m_UnitTest));
+   else
+      xpccut_errprint_func(_("the unit-test object is invalid"));
+
+   return result;
+}
+
+/**
+ *    Marks the test loaded last as one that must run alone, with no other
+ *    test running in another worker or child.  This is the C++ counterpart
+ *    of the C function unit_test_load_serial().
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_09()
+ */
+
+bool
+cut::load_serial ()
+{
+   bool result = m_Is_Valid;
+   if (result)
+      result = xpccut_boolcast(unit_test_load_serial(&m_UnitTest));
+   else
+      xpccut_errprint_func(_("the unit-test object is invalid"));
+
+   return result;
+}
+
 /**
  *    Load a C function (instead of a C++ function) for testing.
  *
@@ -432,7 +737,8 @@ cut::c_load
  *    Runs a single C++ unit-test function.
  *    After the unit-test returns, the C function
  *    unit_test_run_a_test_after() is run to finish timing the test and
- *    printing out the results, if applicable.
+ *    printing out the results, if applicable.  If the test has a timeout,
+ *    the watchdog watches it while it runs.
  *
  * \param test
  *    A unit-test C++ function pointer, with a test_function function
@@ -461,19 +767,22 @@ cut::run_a_test
       if (ok)
       {
          /**
-          * Unfortunately, the functions in the C unit-test library that
-          * affect the current options act on the options stored in the
-          * unit_test_t structures.
-          *
-          * In the current structuring of the C++ unit-test library, any
-          * changes made have to be copied to the C++ version of the options
-          * structure.  And the option structure is what keeps track of the
-          * test number -- unfortunately.  So we have to provide a
-          * cut_options::copy_options() function and use it.
+          * The test gets a view of the options stored in the unit_test_t
+          * structure, which unit_test_run_init() may have added to (the
+          * shard map, for example) since they were copied into
+          * m_UnitTest_Options.  The number of the test is in the test
+          * context that unit_test_run_a_test_before() set up, rather than
+          * in the options, so nothing needs to be copied.
           */
 
-         m_UnitTest_Options.copy_options(m_UnitTest.m_App_Options);
-         result = (*test)(m_UnitTest_Options);
+         cut_options testoptions(m_UnitTest.m_App_Options);
+         xpccut_watch_t watch;
+         unit_test_watchdog_arm
+         (
+            &m_UnitTest, m_UnitTest.m_Current_Test_Number, &watch
+         );
+         result = (*test)(testoptions);
+         unit_test_watchdog_disarm(&watch, &result.m_Status);
          unit_test_run_a_test_after(&m_UnitTest, &result.m_Status);
       }
    }
@@ -483,6 +792,47 @@ cut::run_a_test
    return result;
 }
 
+/**
+ *    Runs a single C++ unit-test function in a worker thread of the C
+ *    function unit_test_run_jobs().
+ *
+ *    This function is the C++ counterpart of the static C function
+ *    unit_test_run_a_job().  The test gets a view of the options that all
+ *    of the workers share.  The options are not written while the tests
+ *    run, so this is safe, and nothing is copied.
+ *
+ * \param context
+ *    The cut object that owns the test list; run() passes "this".
+ *
+ * \param testnumber
+ *    The index of the test in m_UnitTest_List, in load order.
+ *
+ * \param options
+ *    The C options shared by the workers.
+ *
+ * \return
+ *    Returns the timed C status of the unit-test.
+ *
+ * \unittests
+ *    -  cut_unit_test_04_24()
+ */
+
+unit_test_status_t
+cut::job_runner
+(
+   void * context,
+   int testnumber,
+   const unit_test_options_t * options
+)
+{
+   const cut * self = static_cast<const cut *>(context);
+   cut_options joboptions(*options);
+
+   cut_status result = (*self->m_UnitTest_List[testnumber])(joboptions);
+   (void) result.time_delta();
+   return result.m_Status;
+}
+
 /**
  *    Runs all of the unit-tests that have been loaded by the load()
  *    function.
@@ -504,6 +854,9 @@ cut::run_a_test
 \endverbatim
  *       -  The status structure is a member of cut, instead of being
  *          provided by the caller.
+ *       -  For the --jobs and --isolate options, the worker pool or
+ *          child processes of the C function unit_test_run_jobs() call
+ *          job_runner() instead of run_a_test().
  *
  * \warning
  *    This function has to be kept in synchrony with changes to the C
@@ -530,13 +883,45 @@ cut::run ()
       int length = unit_test_run_init(tests);
       if (length == 0)
          result = false;
+      else if (unit_test_use_jobs(tests))
+      {
+         result = xpccut_boolcast(unit_test_run_jobs(tests, job_runner, this));
+      }
       else
       {
          cbool_t cresult = ctrue;            /* this is a C "boolean"         */
          int testnumber = 0;
          while ((testnumber = unit_test_next_test(tests)) >= 0)
          {
-            cut_status testresult = run_a_test(m_UnitTest_List[testnumber]);
+            cut_status testresult;
+            unit_test_options_context_set(testnumber);
+            if
+            (
+               unit_test_skip_a_test
+               (
+                  tests, testnumber, &m_UnitTest.m_App_Options,
+                  &testresult.m_Status
+               )
+            )
+            {
+               (void) unit_test_run_a_test_after(tests, &testresult.m_Status);
+            }
+            else if
+            (
+               ! unit_test_fixture_enter
+               (
+                  tests, testnumber, &m_UnitTest.m_App_Options,
+                  &testresult.m_Status
+               )
+            )
+            {
+               (void) unit_test_run_a_test_after(tests, &testresult.m_Status);
+            }
+            else
+               testresult = run_a_test(m_UnitTest_List[testnumber]);
+
+            unit_test_fixture_leave(tests, testnumber);
+
             if (unit_test_check_subtests(&m_UnitTest, &testresult.status()) < 0)
                break;
 
@@ -575,7 +960,7 @@ cut::exclaim
 )
 {
    if (options.is_verbose() && ! xpccut_is_silent())
-      std::cout << "! " << message << std::endl;
+      xpccut_print("! %s\n", message.c_str());
 }
 
 /**
@@ -594,7 +979,7 @@ cut::inform
 )
 {
    if (options.is_verbose() && ! xpccut_is_silent())
-      std::cout << "* " << message << std::endl;
+      xpccut_print("* %s\n", message.c_str());
 }
 
 /**
@@ -612,7 +997,7 @@ cut::show
 )
 {
    if (options.show_values() && ! xpccut_is_silent())
-      std::cout << "= " << message << std::endl;
+      xpccut_print("= %s\n", message.c_str());
 }
 
 /**
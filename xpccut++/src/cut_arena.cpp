@@ -0,0 +1,120 @@
+/**
+ * \file          cut_arena.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_arena class.
+ *    Also see the cut_arena.hpp module for more information.
+ */
+
+#include <xpc/cut_arena.hpp>           /* xpc::cut_arena                      */
+
+namespace xpc
+{
+
+/**
+ *    Creates an arena of its own.  No memory is allocated until the first
+ *    block is.
+ *
+ * \param chunksize
+ *    The size of the chunks of the arena, or 0 for the default,
+ *    XPCCUT_ARENA_CHUNK_SIZE.
+ *
+ * \param flags
+ *    The options of the arena, such as XPCCUT_ARENA_HUGE_PAGES.
+ *
+ * \unittests
+ *    -  cut_unit_test_12_01()
+ */
+
+cut_arena::cut_arena (std::size_t chunksize, xpccut_arena_flags_t flags)
+ :
+   m_Own_Arena    (),
+   m_Arena        (&m_Own_Arena),
+   m_Mark         ()
+{
+   (void) xpccut_arena_init(&m_Own_Arena, chunksize, flags);
+   m_Mark.m_Is_Set = false;
+}
+
+/**
+ *    Uses the test arena of the calling thread, and marks it, so that the
+ *    blocks this object allocates are given back when it is destroyed.
+ *
+ * \unittests
+ *    -  cut_unit_test_12_01()
+ */
+
+cut_arena::cut_arena (test_arena_t)
+ :
+   m_Own_Arena    (),
+   m_Arena        (xpccut_test_arena()),
+   m_Mark         ()
+{
+   xpccut_arena_mark(m_Arena, &m_Mark);
+}
+
+/**
+ *    Frees the arena if this object owns it, or else rewinds the test arena
+ *    to where it was when this object was made.
+ *
+ * \unittests
+ *    -  cut_unit_test_12_01()
+ */
+
+cut_arena::~cut_arena ()
+{
+   if (m_Arena == &m_Own_Arena)
+      xpccut_arena_destroy(&m_Own_Arena);
+   else
+      xpccut_arena_rewind(m_Arena, &m_Mark);
+}
+
+/**
+ *    Allocates an uninitialized block.
+ *
+ * \return
+ *    Returns the block, aligned to XPCCUT_ARENA_ALIGNMENT bytes, or null if
+ *    the memory ran out.
+ *
+ * \unittests
+ *    -  cut_unit_test_12_01()
+ */
+
+void *
+cut_arena::allocate (std::size_t size)
+{
+   return xpccut_arena_alloc(m_Arena, size);
+}
+
+/**
+ *    Gives back all of the blocks allocated through this object.  The
+ *    chunks are kept for the blocks to come.
+ *
+ * \unittests
+ *    -  cut_unit_test_12_01()
+ */
+
+void
+cut_arena::reset ()
+{
+   if (m_Arena == &m_Own_Arena)
+      xpccut_arena_reset(&m_Own_Arena);
+   else
+   {
+      xpccut_arena_rewind(m_Arena, &m_Mark);
+      xpccut_arena_mark(m_Arena, &m_Mark);
+   }
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_arena.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
@@ -0,0 +1,355 @@
+/**
+ * \file          cut_benchmark.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_benchmark class.
+ *    Also see the cut_benchmark.hpp module for more information.
+ */
+
+#include <algorithm>                   /* std::sort()                         */
+#include <cmath>                       /* std::sqrt()                         */
+#include <xpc/cut_benchmark.hpp>       /* xpc::cut_benchmark                  */
+
+namespace xpc
+{
+
+/**
+ *    Creates a benchmark with the default settings.  Nothing is timed
+ *    until run() is called.
+ *
+ * \param status
+ *    The status object of the unit-test.  The benchmark is one of its
+ *    sub-tests, and the status must outlive the benchmark.
+ *
+ * \param name
+ *    The name of the benchmark, used as the name of the sub-test.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01()
+ */
+
+cut_benchmark::cut_benchmark (cut_status & status, const std::string & name)
+ :
+   m_Status          (status),
+   m_Name            (name),
+   m_Sample_Count    (XPCCUT_BENCH_SAMPLES),
+   m_Warmup_Count    (XPCCUT_BENCH_WARMUPS),
+   m_Min_Sample_Ns   (XPCCUT_BENCH_SAMPLE_NS),
+   m_Iterations      (0),
+   m_Samples         (),
+   m_Min_Ns          (0.0),
+   m_Median_Ns       (0.0),
+   m_P99_Ns          (0.0),
+   m_Mean_Ns         (0.0),
+   m_Stddev_Ns       (0.0),
+   m_Counters        ()
+{
+   // no code
+}
+
+/**
+ * \setter m_Sample_Count
+ *
+ * \param count
+ *    The number of timed samples, which must be at least 1.
+ *
+ * \return
+ *    Returns 'true' if the count was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01()
+ */
+
+bool
+cut_benchmark::sample_count (int count)
+{
+   bool result = count > 0;
+   if (result)
+      m_Sample_Count = count;
+   else
+      xpccut_errprint_func(_("benchmark sample count must be positive"));
+
+   return result;
+}
+
+/**
+ * \setter m_Warmup_Count
+ *
+ * \param count
+ *    The number of warm-up samples, which can be 0.
+ *
+ * \return
+ *    Returns 'true' if the count was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01()
+ */
+
+bool
+cut_benchmark::warmup_count (int count)
+{
+   bool result = count >= 0;
+   if (result)
+      m_Warmup_Count = count;
+   else
+      xpccut_errprint_func(_("benchmark warm-up count must not be negative"));
+
+   return result;
+}
+
+/**
+ * \setter m_Min_Sample_Ns
+ *
+ * \param ns
+ *    The minimum duration of one sample, in nanoseconds, which must be at
+ *    least 1.
+ *
+ * \return
+ *    Returns 'true' if the duration was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01()
+ */
+
+bool
+cut_benchmark::min_sample_ns (long long ns)
+{
+   bool result = ns > 0;
+   if (result)
+      m_Min_Sample_Ns = ns;
+   else
+      xpccut_errprint_func(_("benchmark sample duration must be positive"));
+
+   return result;
+}
+
+/**
+ *    Checks the median time of the benchmark against its entry in the
+ *    --baseline file, using the standard deviation as the noise.  It is
+ *    called after run() has returned 'true', and it fails the sub-test of
+ *    the benchmark if the time has regressed.
+ *
+ * \return
+ *    Returns 'true' if the benchmark has run and has not regressed.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_02()
+ */
+
+bool
+cut_benchmark::perf_check ()
+{
+   bool result = ! m_Samples.empty();
+   if (result)
+      result = m_Status.perf_check(m_Name, m_Median_Ns, m_Stddev_Ns);
+   else
+      xpccut_errprint_func(_("benchmark has not run"));
+
+   return result;
+}
+
+/**
+ *    Starts the sub-test of the benchmark, and clears the results of any
+ *    previous run.
+ *
+ * \return
+ *    Returns 'true' if the test is runnable and the sub-test is selected.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01() [indirect test]
+ */
+
+bool
+cut_benchmark::start ()
+{
+   bool result = m_Status.valid();
+   if (result)
+      result = m_Status.next_subtest(m_Name);
+
+   m_Iterations = 0;
+   m_Samples.clear();
+   m_Min_Ns = m_Median_Ns = m_P99_Ns = m_Mean_Ns = m_Stddev_Ns = 0.0;
+   m_Counters.m_Is_Valid = false;
+   if (result)
+      m_Samples.reserve(std::size_t(m_Sample_Count));
+
+   return result;
+}
+
+/**
+ *    Provides the next iteration count to try during calibration.  The
+ *    count is scaled by the ratio of the wanted duration to the measured
+ *    one, plus a 10% margin, but it grows by no more than a factor of 10
+ *    at each step, so that one noisy sample cannot blow it up.
+ *
+ * \param iterations
+ *    The iteration count of the sample that was too short.
+ *
+ * \param ns
+ *    The duration of that sample, in nanoseconds.
+ *
+ * \return
+ *    Returns the larger iteration count, no more than
+ *    XPCCUT_BENCH_ITERATIONS_MAX.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01() [indirect test]
+ */
+
+long long
+cut_benchmark::next_iterations (long long iterations, long long ns) const
+{
+   long long result = iterations * 10;
+   if (ns > 0)
+   {
+      double scale = 1.1 * double(m_Min_Sample_Ns) / double(ns);
+      long long scaled = (long long)(double(iterations) * scale) + 1;
+      if (scaled < result)
+         result = scaled;
+   }
+   if (result > XPCCUT_BENCH_ITERATIONS_MAX)
+      result = XPCCUT_BENCH_ITERATIONS_MAX;
+
+   return result;
+}
+
+/**
+ *    Reads the hardware counters before the timed samples, if the
+ *    --perf-counters option is in force.
+ *
+ * \param [out] before
+ *    Receives the reading.
+ *
+ * \return
+ *    Returns 'true' if the counters were read, so that count_finish()
+ *    should be called after the samples.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_03() [indirect test]
+ */
+
+bool
+cut_benchmark::count_start (xpccut_perf_values_t & before)
+{
+   bool result = false;
+   if (unit_test_options_perf_counters(m_Status.m_Status.m_Test_Options))
+      result = xpccut_boolcast(xpccut_perf_read(&before));
+
+   return result;
+}
+
+/**
+ *    Reads the hardware counters after the timed samples, and keeps the
+ *    counts since count_start().
+ *
+ * \param before
+ *    The reading taken by count_start().
+ *
+ * \unittests
+ *    -  cut_unit_test_09_03() [indirect test]
+ */
+
+void
+cut_benchmark::count_finish (const xpccut_perf_values_t & before)
+{
+   xpccut_perf_values_t after;
+   if (xpccut_perf_read(&after))
+      (void) xpccut_perf_difference(&before, &after, &m_Counters);
+}
+
+/**
+ *    Computes the statistics of the samples, shows them (unless
+ *    --no-show-progress or --silent is in force), and passes the sub-test.
+ *
+ *    The percentiles use the nearest-rank method on the sorted samples.
+ *
+ * \return
+ *    Returns 'true' if there were samples to process.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01() [indirect test]
+ */
+
+bool
+cut_benchmark::finish ()
+{
+   bool result = ! m_Samples.empty();
+   if (result)
+   {
+      std::size_t count = m_Samples.size();
+      std::sort(m_Samples.begin(), m_Samples.end());
+      m_Min_Ns = m_Samples[0];
+      m_Median_Ns = (count % 2) == 1 ?
+         m_Samples[count / 2] :
+         (m_Samples[count / 2 - 1] + m_Samples[count / 2]) / 2.0 ;
+
+      std::size_t rank = (99 * count + 99) / 100;    /* ceil(0.99 * count)  */
+      m_P99_Ns = m_Samples[rank - 1];
+
+      double sum = 0.0;
+      for (std::size_t i = 0; i < count; ++i)
+         sum += m_Samples[i];
+
+      m_Mean_Ns = sum / double(count);
+      if (count > 1)
+      {
+         double squares = 0.0;
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            double d = m_Samples[i] - m_Mean_Ns;
+            squares += d * d;
+         }
+         m_Stddev_Ns = std::sqrt(squares / double(count - 1));
+      }
+      if (! xpccut_is_silent())
+      {
+         if (unit_test_options_show_progress(m_Status.m_Status.m_Test_Options))
+         {
+            xpccut_print
+            (
+               "  %s '%s': %lld x %d, "
+               "min %.1f, median %.1f, p99 %.1f, stddev %.1f ns\n",
+               _("Benchmark"), m_Name.c_str(), m_Iterations, int(count),
+               m_Min_Ns, m_Median_Ns, m_P99_Ns, m_Stddev_Ns
+            );
+            if (m_Counters.m_Is_Valid)
+            {
+               double per = double(m_Iterations) * double(count);
+               xpccut_perf_show(_("Per iteration"), &m_Counters, per);
+            }
+         }
+      }
+   }
+   m_Status.pass(result);
+   return result;
+}
+
+/**
+ *    Reads the monotonic clock of the xpccut library, so that benchmarks
+ *    and the test durations are timed alike.
+ *
+ * \return
+ *    Returns the current time, in nanoseconds from an arbitrary epoch.
+ *
+ * \unittests
+ *    -  cut_unit_test_09_01() [indirect test]
+ */
+
+long long
+cut_benchmark::now_ns ()
+{
+   return (long long) xpccut_get_ticks();
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_benchmark.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
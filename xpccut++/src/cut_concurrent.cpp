@@ -0,0 +1,795 @@
+/**
+ * \file          cut_concurrent.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_concurrent class, and the
+ *    xpc::cut_thread and xpc::cut_histogram classes that it uses.
+ *    Also see the cut_concurrent.hpp module for more information.
+ */
+
+#include <climits>                     /* LLONG_MAX                           */
+#include <xpc/cut_concurrent.hpp>      /* xpc::cut_concurrent                 */
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define XPCCUT_USE_CONCURRENT_THREADS 1
+#include <pthread.h>                   /* threads for cut_concurrent::run()   */
+#include <sched.h>                     /* sched_yield(), cpu_set_t            */
+#else
+#define XPCCUT_USE_CONCURRENT_THREADS 0
+#endif
+
+#if XPC_HAVE_UNISTD_H
+#include <unistd.h>                    /* sysconf()                           */
+#endif
+
+/**
+ *    The number of turns a thread spins at the barrier between calls to
+ *    sched_yield(), so that the threads still get going when there are
+ *    more of them than CPUs.
+ */
+
+#define XPCCUT_CONCURRENT_SPINS          1024
+
+namespace xpc
+{
+
+#if XPCCUT_USE_CONCURRENT_THREADS
+
+/**
+ *    Holds what a thread needs to join a concurrent run.
+ */
+
+struct cut_launch
+{
+   cut_concurrent * m_Harness;         /**< The run.                          */
+   cut_thread * m_Thread;              /**< The state of the thread.          */
+   cut_concurrent::loop_t m_Loop;      /**< The loop from run().              */
+   void * m_Context;                   /**< The code under test.              */
+};
+
+#endif
+
+/**
+ *    Creates an empty histogram.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+cut_histogram::cut_histogram ()
+ :
+   m_Buckets   (XPCCUT_HISTOGRAM_BUCKETS, 0),
+   m_Count     (0),
+   m_Sum       (0),
+   m_Min       (0),
+   m_Max       (0)
+{
+   // no code
+}
+
+/**
+ *    Removes all of the values from the histogram.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+void
+cut_histogram::clear ()
+{
+   m_Buckets.assign(XPCCUT_HISTOGRAM_BUCKETS, 0);
+   m_Count = m_Sum = m_Min = m_Max = 0;
+}
+
+/**
+ *    Adds the values of another histogram to this one.
+ *
+ * \param other
+ *    The histogram to add.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+void
+cut_histogram::merge (const cut_histogram & other)
+{
+   if (other.m_Count > 0)
+   {
+      for (std::size_t i = 0; i < m_Buckets.size(); ++i)
+         m_Buckets[i] += other.m_Buckets[i];
+
+      if (other.m_Min < m_Min || m_Count == 0)
+         m_Min = other.m_Min;
+
+      if (other.m_Max > m_Max)
+         m_Max = other.m_Max;
+
+      m_Count += other.m_Count;
+      m_Sum += other.m_Sum;
+   }
+}
+
+/**
+ *    Provides a percentile of the values, by the nearest-rank method.
+ *    The value is the top of the bucket in which the rank falls, but no
+ *    more than the largest value.
+ *
+ * \param p
+ *    The percentile, from 0 to 100.
+ *
+ * \return
+ *    Returns the percentile, or 0 if the histogram is empty.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+long long
+cut_histogram::percentile (double p) const
+{
+   long long result = 0;
+   if (m_Count > 0)
+   {
+      long long rank = (long long)(p / 100.0 * double(m_Count) + 0.999999);
+      long long seen = 0;
+      if (rank < 1)
+         rank = 1;
+      else if (rank > m_Count)
+         rank = m_Count;
+
+      for (int i = 0; i < XPCCUT_HISTOGRAM_BUCKETS; ++i)
+      {
+         seen += m_Buckets[std::size_t(i)];
+         if (seen >= rank)
+         {
+            result = bucket_high(i);
+            break;
+         }
+      }
+      if (result > m_Max)
+         result = m_Max;
+
+      if (result < m_Min)
+         result = m_Min;
+   }
+   return result;
+}
+
+/**
+ *    Provides the mean of the values.
+ *
+ * \return
+ *    Returns the mean, or 0 if the histogram is empty.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+double
+cut_histogram::mean () const
+{
+   return m_Count > 0 ? double(m_Sum) / double(m_Count) : 0.0 ;
+}
+
+/**
+ *    Provides the largest value that falls in a bucket.
+ *
+ * \param index
+ *    The index of the bucket, as returned by bucket().
+ *
+ * \return
+ *    Returns the top of the bucket, but no more than LLONG_MAX.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+long long
+cut_histogram::bucket_high (int index)
+{
+   const int sub = 1 << XPCCUT_HISTOGRAM_SUB_BITS;
+   long long result = index;
+   if (index >= sub)
+   {
+      int shift = index / sub - 1;
+      unsigned long long low = (unsigned long long)(sub + index % sub) << shift;
+      unsigned long long high = low + ((1ULL << shift) - 1);
+      result = high > (unsigned long long) LLONG_MAX ?
+         LLONG_MAX : (long long) high ;
+   }
+   return result;
+}
+
+/**
+ *    Creates the state of a thread that has not run.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+cut_thread::cut_thread ()
+ :
+   m_Index           (0),
+   m_Cpu             (-1),
+   m_Stopped         (false),
+   m_Iteration       (0),
+   m_Elapsed_Ns      (0),
+   m_Checks          (0),
+   m_Failures        (0),
+   m_First_Failure   (-1),
+   m_Latency         (),
+   m_Padding         ()
+{
+   // no code
+}
+
+/**
+ *    Provides the rate of iterations of the thread.
+ *
+ * \return
+ *    Returns the iterations per second, or 0 if the thread has not run.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+double
+cut_thread::throughput () const
+{
+   return m_Elapsed_Ns > 0 ?
+      double(m_Iteration) * 1.0e9 / double(m_Elapsed_Ns) : 0.0 ;
+}
+
+/**
+ *    Creates a concurrent run with the default settings: one thread for
+ *    each CPU, no pinning, and XPCCUT_CONCURRENT_ITERATIONS iterations.
+ *    Nothing is run until run() or scale() is called.
+ *
+ * \param status
+ *    The status object of the unit-test.  The run is one of its sub-tests,
+ *    and the status must outlive the run.
+ *
+ * \param name
+ *    The name of the run, used as the name of the sub-test.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+cut_concurrent::cut_concurrent (cut_status & status, const std::string & name)
+ :
+   m_Status          (status),
+   m_Name            (name),
+   m_Thread_Count    (cpu_count()),
+   m_Pin_Threads     (false),
+   m_Iterations      (XPCCUT_CONCURRENT_ITERATIONS),
+   m_Duration_Ms     (0.0),
+   m_Threads         (),
+   m_Ready           (0),
+   m_Go              (0),
+   m_Start_Ns        (0),
+   m_Deadline_Ns     (0),
+   m_Wall_Ns         (0),
+   m_Latency         (),
+   m_Scaling         ()
+{
+   // no code
+}
+
+/**
+ * \setter m_Thread_Count
+ *
+ * \param count
+ *    The number of threads, from 1 to XPCCUT_CONCURRENT_THREADS_MAX.
+ *
+ * \return
+ *    Returns 'true' if the count was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+bool
+cut_concurrent::thread_count (int count)
+{
+   bool result = count > 0 && count <= XPCCUT_CONCURRENT_THREADS_MAX;
+   if (result)
+      m_Thread_Count = count;
+   else
+      xpccut_errprint_func(_("concurrent thread count out of range"));
+
+   return result;
+}
+
+/**
+ * \setter m_Iterations
+ *
+ * \param count
+ *    The number of iterations of each thread, or 0 to let duration_ms()
+ *    alone end the run.
+ *
+ * \return
+ *    Returns 'true' if the count was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+bool
+cut_concurrent::iterations (long long count)
+{
+   bool result = count >= 0;
+   if (result)
+      m_Iterations = count;
+   else
+      xpccut_errprint_func(_("concurrent iterations must not be negative"));
+
+   return result;
+}
+
+/**
+ * \setter m_Duration_Ms
+ *
+ * \param ms
+ *    The longest duration of the run, in milliseconds, or 0 to let
+ *    iterations() alone end the run.
+ *
+ * \return
+ *    Returns 'true' if the duration was valid and was set.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+bool
+cut_concurrent::duration_ms (double ms)
+{
+   bool result = ms >= 0.0;
+   if (result)
+      m_Duration_Ms = ms;
+   else
+      xpccut_errprint_func(_("concurrent duration must not be negative"));
+
+   return result;
+}
+
+/**
+ *    Provides the rate of iterations of all of the threads together.
+ *
+ * \return
+ *    Returns the iterations per second of the last run, or 0 if there has
+ *    been no run.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+double
+cut_concurrent::throughput () const
+{
+   return m_Wall_Ns > 0 ?
+      double(total_iterations()) * 1.0e9 / double(m_Wall_Ns) : 0.0 ;
+}
+
+/**
+ *    Provides the number of iterations of all of the threads together.
+ *
+ * \return
+ *    Returns the sum of the iterations of the threads of the last run.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+long long
+cut_concurrent::total_iterations () const
+{
+   long long result = 0;
+   for (std::size_t i = 0; i < m_Threads.size(); ++i)
+      result += m_Threads[i].m_Iteration;
+
+   return result;
+}
+
+/**
+ *    Provides the number of CPUs that are online, which is the default
+ *    number of threads.
+ *
+ * \return
+ *    Returns the number of CPUs, at least 1, and no more than
+ *    XPCCUT_CONCURRENT_THREADS_MAX.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01()
+ */
+
+int
+cut_concurrent::cpu_count ()
+{
+   int result = 1;
+#if XPC_HAVE_UNISTD_H && defined _SC_NPROCESSORS_ONLN
+   long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+   if (cpus > XPCCUT_CONCURRENT_THREADS_MAX)
+      result = XPCCUT_CONCURRENT_THREADS_MAX;
+   else if (cpus > 1)
+      result = int(cpus);
+#endif
+   return result;
+}
+
+/**
+ *    Starts the sub-test of a run, and clears the results of any previous
+ *    run.
+ *
+ * \param subtestname
+ *    The name of the sub-test.
+ *
+ * \return
+ *    Returns 'true' if the test is runnable, the sub-test is selected, and
+ *    the run has a budget.  A run with no budget fails the sub-test.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01() [indirect test]
+ */
+
+bool
+cut_concurrent::start (const std::string & subtestname)
+{
+   bool result = m_Status.valid();
+   if (result)
+      result = m_Status.next_subtest(subtestname);
+
+   m_Threads.clear();
+   m_Latency.clear();
+   m_Wall_Ns = 0;
+   if (result)
+   {
+      result = m_Iterations > 0 || m_Duration_Ms > 0.0;
+      if (! result)
+      {
+         xpccut_errprint_func(_("concurrent run needs a budget"));
+         m_Status.pass(false);
+      }
+   }
+   return result;
+}
+
+#if XPCCUT_USE_CONCURRENT_THREADS
+
+/**
+ *    Provides the body of each thread, which pins the thread to its CPU,
+ *    if asked, and runs the loop of run().
+ *
+ * \param context
+ *    The cut_launch of the thread.
+ *
+ * \return
+ *    Returns a null pointer.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01() [indirect test]
+ */
+
+void *
+cut_concurrent::thread_main (void * context)
+{
+   cut_launch * launch = static_cast<cut_launch *>(context);
+   cut_thread & thread = *launch->m_Thread;
+   if (launch->m_Harness->pin_threads())
+   {
+#if defined __linux__ && defined CPU_SET
+      int cpu = thread.index() % cpu_count();
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      if (pthread_setaffinity_np(pthread_self(), sizeof cpus, &cpus) == 0)
+         thread.m_Cpu = cpu;
+#endif
+   }
+   launch->m_Loop(launch->m_Context, *launch->m_Harness, thread);
+   return nullptr;
+}
+
+#endif
+
+/**
+ *    Starts the threads, releases them from the barrier once all of them
+ *    are waiting there, and waits for them to finish.  Without thread
+ *    support, a run of one thread is made in the calling thread.
+ *
+ * \param loop
+ *    The loop of each thread, from run().
+ *
+ * \param context
+ *    The code under test.
+ *
+ * \return
+ *    Returns 'true' if all of the threads were started.  If one could not
+ *    be started, the others are sent away without running the code.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01() [indirect test]
+ */
+
+bool
+cut_concurrent::launch (loop_t loop, void * context)
+{
+   int count = m_Thread_Count;
+   bool result = true;
+   m_Threads.assign(std::size_t(count), cut_thread());
+   for (int i = 0; i < count; ++i)
+      m_Threads[std::size_t(i)].m_Index = i;
+
+   m_Ready = m_Go = 0;
+   m_Start_Ns = m_Deadline_Ns = 0;
+
+#if XPCCUT_USE_CONCURRENT_THREADS
+
+   std::vector<pthread_t> handles(m_Threads.size());
+   std::vector<cut_launch> launches(m_Threads.size());
+   int started = 0;
+   for (int i = 0; i < count; ++i)
+   {
+      cut_launch & l = launches[std::size_t(i)];
+      l.m_Harness = this;
+      l.m_Thread = &m_Threads[std::size_t(i)];
+      l.m_Loop = loop;
+      l.m_Context = context;
+      pthread_t & h = handles[std::size_t(i)];
+      if (pthread_create(&h, nullptr, &cut_concurrent::thread_main, &l) != 0)
+      {
+         xpccut_errprint_func(_("could not start a concurrent thread"));
+         result = false;
+         break;
+      }
+      ++started;
+   }
+   if (result)
+   {
+      while (__atomic_load_n(&m_Ready, __ATOMIC_ACQUIRE) < count)
+         (void) sched_yield();
+
+      m_Start_Ns = (long long) xpccut_get_ticks();
+      if (m_Duration_Ms > 0.0)
+         m_Deadline_Ns = m_Start_Ns + (long long)(m_Duration_Ms * 1.0e6);
+
+      __atomic_store_n(&m_Go, 1, __ATOMIC_RELEASE);
+   }
+   else
+      __atomic_store_n(&m_Go, -1, __ATOMIC_RELEASE);
+
+   for (int i = 0; i < started; ++i)
+      (void) pthread_join(handles[std::size_t(i)], nullptr);
+
+#else
+
+   result = count == 1;
+   if (result)
+   {
+      m_Start_Ns = (long long) xpccut_get_ticks();
+      if (m_Duration_Ms > 0.0)
+         m_Deadline_Ns = m_Start_Ns + (long long)(m_Duration_Ms * 1.0e6);
+
+      m_Go = 1;
+      loop(context, *this, m_Threads[0]);
+   }
+   else
+      xpccut_errprint_func(_("threads are not supported"));
+
+#endif
+
+   if (result)
+   {
+      for (std::size_t i = 0; i < m_Threads.size(); ++i)
+      {
+         if (m_Threads[i].m_Elapsed_Ns > m_Wall_Ns)
+            m_Wall_Ns = m_Threads[i].m_Elapsed_Ns;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Waits at the barrier until the run releases the threads.  Each thread
+ *    spins, with a pause, and yields now and then, so that the threads
+ *    start within a fraction of a microsecond of each other where each has
+ *    a CPU.
+ *
+ * \return
+ *    Returns 'true' if the thread is to run the code, or 'false' if the run
+ *    was called off.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01() [indirect test]
+ */
+
+bool
+cut_concurrent::wait_for_start ()
+{
+   int go;
+   int spins = 0;
+   (void) __atomic_add_fetch(&m_Ready, 1, __ATOMIC_ACQ_REL);
+   while ((go = __atomic_load_n(&m_Go, __ATOMIC_ACQUIRE)) == 0)
+   {
+#if defined __x86_64__ || defined __i386__
+      __builtin_ia32_pause();
+#endif
+      if (++spins == XPCCUT_CONCURRENT_SPINS)
+      {
+         spins = 0;
+#if XPCCUT_USE_CONCURRENT_THREADS
+         (void) sched_yield();
+#endif
+      }
+   }
+   return go > 0;
+}
+
+/**
+ *    Merges the results of the threads, shows them (unless
+ *    --no-show-progress or --silent is in force), and passes or fails the
+ *    sub-test.  Each thread with failed checks fails the sub-test once.
+ *    The results of each thread are shown as well under --verbose.
+ *
+ * \param launched
+ *    The result of launch().
+ *
+ * \return
+ *    Returns 'true' if the run was made and no check failed.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_01() [indirect test]
+ */
+
+bool
+cut_concurrent::finish (bool launched)
+{
+   bool result = launched;
+   if (result)
+   {
+      const unit_test_options_t * options = m_Status.m_Status.m_Test_Options;
+      bool show = ! xpccut_is_silent() &&
+         unit_test_options_show_progress(options);
+
+      for (std::size_t i = 0; i < m_Threads.size(); ++i)
+         m_Latency.merge(m_Threads[i].m_Latency);
+
+      if (show)
+      {
+         xpccut_print
+         (
+            "  %s '%s': %d x %lld, %.0f/s, "
+            "p50 %lld, p99 %lld, max %lld ns\n",
+            _("Concurrent"), m_Name.c_str(), m_Thread_Count,
+            total_iterations(), throughput(), m_Latency.percentile(50.0),
+            m_Latency.percentile(99.0), m_Latency.max()
+         );
+         if (unit_test_options_is_verbose(options))
+         {
+            for (std::size_t i = 0; i < m_Threads.size(); ++i)
+            {
+               const cut_thread & t = m_Threads[i];
+               xpccut_print
+               (
+                  "    %s %d (CPU %d): %lld, %.0f/s, p50 %lld, p99 %lld ns\n",
+                  _("Thread"), t.m_Index, t.m_Cpu, t.m_Iteration,
+                  t.throughput(), t.m_Latency.percentile(50.0),
+                  t.m_Latency.percentile(99.0)
+               );
+            }
+         }
+      }
+      for (std::size_t i = 0; i < m_Threads.size(); ++i)
+      {
+         const cut_thread & t = m_Threads[i];
+         if (t.m_Failures > 0)
+         {
+            if (! xpccut_is_silent())
+            {
+               xpccut_print
+               (
+                  "  %s %d: %lld of %lld %s %lld\n",
+                  _("Thread"), t.m_Index, t.m_Failures, t.m_Checks,
+                  _("checks failed, first in iteration"), t.m_First_Failure
+               );
+            }
+            m_Status.pass(false);
+            result = false;
+         }
+      }
+      if (result)
+         m_Status.pass(true);
+   }
+   else
+      m_Status.pass(false);
+
+   return result;
+}
+
+/**
+ *    Shows the curve made by scale(), as the speed-up of each thread count
+ *    over the first, unless --no-show-progress or --silent is in force.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_02() [indirect test]
+ */
+
+void
+cut_concurrent::show_scaling () const
+{
+   if (! xpccut_is_silent())
+   {
+      if (unit_test_options_show_progress(m_Status.m_Status.m_Test_Options))
+      {
+         double first = m_Scaling.front().second;
+         xpccut_print("  %s '%s':", _("Scaling"), m_Name.c_str());
+         for (std::size_t i = 0; i < m_Scaling.size(); ++i)
+         {
+            double speedup = first > 0.0 ? m_Scaling[i].second / first : 0.0 ;
+            xpccut_print(" %d: %.2fx", m_Scaling[i].first, speedup);
+         }
+         xpccut_print("\n");
+      }
+   }
+}
+
+/**
+ *    Provides the name of the sub-test of one run of scale().
+ *
+ * \param threads
+ *    The number of threads of the run.
+ *
+ * \return
+ *    Returns the name of the run followed by the number of threads.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_02() [indirect test]
+ */
+
+std::string
+cut_concurrent::scale_name (int threads) const
+{
+   return m_Name + " x " + std::to_string(threads);
+}
+
+/**
+ *    Provides the next thread count of scale(), which doubles the count,
+ *    but does not pass over the limit.
+ *
+ * \param count
+ *    The thread count of the run just made.
+ *
+ * \param limit
+ *    The largest thread count.
+ *
+ * \return
+ *    Returns the next count, which is more than \a limit once \a limit has
+ *    been run.
+ *
+ * \unittests
+ *    -  cut_unit_test_14_02() [indirect test]
+ */
+
+int
+cut_concurrent::next_count (int count, int limit)
+{
+   int result = count * 2;
+   if (count < limit && result > limit)
+      result = limit;
+
+   return result;
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_concurrent.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
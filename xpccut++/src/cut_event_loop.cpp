@@ -0,0 +1,324 @@
+/**
+ * \file          cut_event_loop.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_event_loop class.
+ *    Also see the cut_event_loop.hpp module for more information.
+ */
+
+#include <algorithm>                   /* std::push_heap(), std::pop_heap()   */
+#include <xpc/cut_event_loop.hpp>      /* xpc::cut_event_loop                 */
+
+#if XPC_HAVE_POLL_H && ! defined WIN32
+#define XPCCUT_USE_EVENT_POLL 1
+#include <errno.h>                     /* errno and EINTR                     */
+#include <poll.h>                      /* poll()                              */
+#else
+#define XPCCUT_USE_EVENT_POLL 0
+#endif
+
+/**
+ *    The longest wait, in milliseconds, of one call to poll().  The loop
+ *    just waits again if nothing is ready by then.
+ */
+
+#define XPCCUT_EVENT_WAIT_MAX          1000000
+
+namespace xpc
+{
+
+/**
+ *    Creates an event loop with nothing pending.
+ *
+ * \unittests
+ *    -  cut_unit_test_15_01()
+ */
+
+cut_event_loop::cut_event_loop ()
+ :
+   m_Timers       (),
+   m_Watches      (),
+   m_Sequence     (0),
+   m_Dispatched   (0),
+   m_Stopped      (false)
+{
+   // no code
+}
+
+/**
+ *    Starts a timer.  Timers that expire at the same time run in the order
+ *    in which they were started.
+ *
+ * \param ms
+ *    The time to wait, in milliseconds, which can be 0 to run the callback
+ *    as soon as the loop gets to it.
+ *
+ * \param code
+ *    The callback to run when the timer expires.
+ *
+ * \return
+ *    Returns 'true' if the timer was started.  It fails if \a ms is
+ *    negative or \a code is empty.
+ *
+ * \unittests
+ *    -  cut_unit_test_15_01()
+ */
+
+bool
+cut_event_loop::after (double ms, const callback & code)
+{
+   bool result = ms >= 0.0 && bool(code);
+   if (result)
+   {
+      timer t;
+      t.m_Deadline_Ns = now_ns() + (long long) (ms * 1000000.0);
+      t.m_Sequence = m_Sequence++;
+      t.m_Callback = code;
+      m_Timers.push_back(t);
+      std::push_heap(m_Timers.begin(), m_Timers.end(), later);
+   }
+   else
+      xpccut_errprint_func(_("negative time or empty callback"));
+
+   return result;
+}
+
+/**
+ *    Waits for a file descriptor to become readable.  The callback also
+ *    runs when the peer has closed its end, or on an error, so that the
+ *    test finds out by reading.
+ *
+ * \param fd
+ *    The descriptor, such as a socket or the read end of a pipe.
+ *
+ * \param code
+ *    The callback to run when the descriptor is readable.
+ *
+ * \return
+ *    Returns 'true' if the wait was started.
+ *
+ * \unittests
+ *    -  cut_unit_test_15_01()
+ */
+
+bool
+cut_event_loop::when_readable (int fd, const callback & code)
+{
+   return watch_fd(fd, false, code);
+}
+
+/**
+ *    Waits for a file descriptor to become writable.  See
+ *    when_readable().
+ *
+ * \return
+ *    Returns 'true' if the wait was started.
+ *
+ * \unittests
+ *    -  cut_unit_test_15_01()
+ */
+
+bool
+cut_event_loop::when_writable (int fd, const callback & code)
+{
+   return watch_fd(fd, true, code);
+}
+
+/**
+ *    Runs the callbacks of the timers and the descriptors as they come due,
+ *    until nothing is pending, stop() is called, or the time is up.  The
+ *    callbacks can start more timers and watches, which are run within the
+ *    same call.
+ *
+ * \param timeout_ms
+ *    The longest time to run, in milliseconds, or a negative value to run
+ *    until nothing is pending.  A test waiting on peers should give one, so
+ *    that a peer that never answers cannot hang the run.
+ *
+ * \return
+ *    Returns 'true' if everything pending was run.  When the time runs out,
+ *    or stop() is called, the rest stays pending, and a later run() can
+ *    finish it.
+ *
+ * \unittests
+ *    -  cut_unit_test_15_01()
+ */
+
+bool
+cut_event_loop::run (double timeout_ms)
+{
+   long long deadline = timeout_ms < 0.0 ?
+      -1 : now_ns() + (long long) (timeout_ms * 1000000.0) ;
+
+   m_Stopped = false;
+   while (! m_Stopped && pending() > 0)
+   {
+      if (deadline >= 0 && now_ns() >= deadline)
+         break;
+
+      wait(wait_ms(deadline));
+      if (! m_Stopped)
+         run_timers();
+   }
+   return pending() == 0;
+}
+
+/**
+ *    Adds a watch of a descriptor, for when_readable() and
+ *    when_writable().
+ *
+ * \return
+ *    Returns 'true' if the watch was added.  It fails if \a fd is
+ *    negative, \a code is empty, or poll() is not available.
+ */
+
+bool
+cut_event_loop::watch_fd (int fd, bool is_write, const callback & code)
+{
+   bool result = fd >= 0 && bool(code);
+   if (result)
+   {
+#if XPCCUT_USE_EVENT_POLL
+      watch w;
+      w.m_Fd = fd;
+      w.m_Is_Write = is_write;
+      w.m_Callback = code;
+      m_Watches.push_back(w);
+#else
+      xpccut_errprint_func(_("poll() is not available"));
+      result = false;
+#endif
+   }
+   else
+      xpccut_errprint_func(_("negative descriptor or empty callback"));
+
+   return result;
+}
+
+/**
+ *    Provides the time until the next timer expires, or until the deadline
+ *    of run(), whichever comes first, rounded up so that the loop does
+ *    not wake up just before it can do something.
+ *
+ * \param deadline_ns
+ *    The deadline of run(), or -1 for none.
+ *
+ * \return
+ *    Returns the time in milliseconds, or -1 if there is nothing to wait
+ *    for but the descriptors.
+ */
+
+int
+cut_event_loop::wait_ms (long long deadline_ns) const
+{
+   int result = -1;
+   long long target = deadline_ns;
+   if (! m_Timers.empty())
+   {
+      long long next = m_Timers.front().m_Deadline_Ns;
+      if (target < 0 || next < target)
+         target = next;
+   }
+   if (target >= 0)
+   {
+      long long ms = (target - now_ns() + 999999) / 1000000;
+      if (ms < 0)
+         ms = 0;
+      else if (ms > XPCCUT_EVENT_WAIT_MAX)
+         ms = XPCCUT_EVENT_WAIT_MAX;
+
+      result = int(ms);
+   }
+   return result;
+}
+
+/**
+ *    Waits until a descriptor is ready, or the time is up, and runs the
+ *    callbacks of the descriptors that are ready, in the order in which
+ *    their watches were added.  The watches are removed before their
+ *    callbacks run, so that a callback can add a new one.
+ *
+ * \param ms
+ *    The longest time to wait, or -1 to wait for a descriptor.
+ */
+
+void
+cut_event_loop::wait (int ms)
+{
+#if XPCCUT_USE_EVENT_POLL
+   std::size_t count = m_Watches.size();
+   std::vector<struct pollfd> fds(count);
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      fds[i].fd = m_Watches[i].m_Fd;
+      fds[i].events = m_Watches[i].m_Is_Write ? POLLOUT : POLLIN ;
+      fds[i].revents = 0;
+   }
+   int rc = poll(count > 0 ? &fds[0] : nullptr, nfds_t(count), ms);
+   if (rc > 0)
+   {
+      std::vector<callback> ready;
+      std::vector<watch> waiting;
+      waiting.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         if (fds[i].revents != 0)
+            ready.push_back(m_Watches[i].m_Callback);
+         else
+            waiting.push_back(m_Watches[i]);
+      }
+      m_Watches.swap(waiting);
+      for (std::size_t i = 0; i < ready.size(); ++i)
+      {
+         ++m_Dispatched;
+         ready[i]();
+      }
+   }
+   else if (rc < 0 && errno != EINTR)
+   {
+      xpccut_errprint_func(_("poll() failed"));
+      m_Stopped = true;
+   }
+#else
+   if (ms > 0)
+      xpccut_ms_sleep((unsigned long) ms);
+#endif
+}
+
+/**
+ *    Runs the callbacks of the timers that have expired, earliest first.
+ *    A timer started by one of the callbacks waits for the next turn of
+ *    the loop, even if it has no delay, so that the descriptors are not
+ *    starved.
+ */
+
+void
+cut_event_loop::run_timers ()
+{
+   long long now = now_ns();
+   while
+   (
+      ! m_Stopped && ! m_Timers.empty() &&
+      m_Timers.front().m_Deadline_Ns <= now
+   )
+   {
+      std::pop_heap(m_Timers.begin(), m_Timers.end(), later);
+      callback code = m_Timers.back().m_Callback;
+      m_Timers.pop_back();
+      ++m_Dispatched;
+      code();
+   }
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_event_loop.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
@@ -3,12 +3,13 @@
  * \library       libxpccut++
  * \author        Chris Ahlstrom
  * \date          2010-03-21
- * \updates       2015-10-06
+ * \updates       2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
- *    Provides the implementations for methods of the xpc::Fuzz
- *    class, plus some additional "fuzzy" methods.
+ *    Provides the implementations for methods of the xpc::Fuzz,
+ *    xpc::FuzzStream, and xpc::GuidedFuzz classes, plus some additional
+ *    "fuzzy" methods.
  *    Also see the cut_fuzz.h module and the xpc::Fuzz
  *    class.
  */
@@ -91,6 +92,389 @@ Fuzz::~Fuzz ()
    }
 }
 
+/**
+ *    Sets up a fuzz stream.  See xpccut_fuzz_stream_init() for the
+ *    details of the parameters.  An empty string is the same as a null
+ *    pointer there.
+ *
+ * \param length
+ *    The length of the stream, including the prologue and epilogue.
+ *
+ * \param seed
+ *    The seed of the stream.
+ *
+ * \param flags
+ *    The character-set flags, and XPCCUT_FF_RANDOM_SIZE.
+ *
+ * \param allowed
+ *    The characters to use, or empty for the default set.
+ *
+ * \param excluded
+ *    The characters to leave out.
+ *
+ * \param prologue
+ *    The string that starts the stream.
+ *
+ * \param epilogue
+ *    The string that ends the stream.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_01()
+ */
+
+FuzzStream::FuzzStream
+(
+   long long length,
+   unsigned int seed,
+   xpccut_fuzz_flags_t flags,
+   const std::string & allowed,
+   const std::string & excluded,
+   const std::string & prologue,
+   const std::string & epilogue
+) :
+   m_prologue  (prologue),
+   m_epilogue  (epilogue),
+   m_stream    (),
+   m_is_valid  (false)
+{
+   m_is_valid = xpccut_fuzz_stream_init
+   (
+      &m_stream, length, seed, flags, allowed.c_str(), excluded.c_str(),
+      m_prologue.c_str(), m_epilogue.c_str()
+   );
+}
+
+/**
+ *    Copies part of the stream, from any offset.  The position used by
+ *    next() and generate() is not changed.
+ *
+ * \param offset
+ *    The offset of the first byte.
+ *
+ * \param count
+ *    The number of bytes wanted.
+ *
+ * \return
+ *    Returns the bytes, which are fewer than \a count only at the end of
+ *    the stream.  The string is empty if the stream or an argument is not
+ *    valid.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_01()
+ */
+
+std::string
+FuzzStream::read (long long offset, int count)
+{
+   std::string result;
+   if (m_is_valid && count > 0)
+   {
+      result.resize(std::size_t(count));
+      int copied = xpccut_fuzz_stream_read
+      (
+         &m_stream, offset, &result[0], count
+      );
+      result.resize(copied > 0 ? std::size_t(copied) : 0);
+   }
+   return result;
+}
+
+/**
+ *    Gets the next chunk of the stream, and advances its position.
+ *
+ * \param [out] chunk
+ *    Receives the chunk, which is empty at the end of the stream.
+ *
+ * \param count
+ *    The largest number of bytes wanted.
+ *
+ * \return
+ *    Returns 'false' at the end of the stream, or if it is not valid.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_01()
+ */
+
+bool
+FuzzStream::next (std::string & chunk, int count)
+{
+   chunk.clear();
+   if (m_is_valid && count > 0)
+   {
+      chunk.resize(std::size_t(count));
+      int copied = xpccut_fuzz_stream_next(&m_stream, &chunk[0], count);
+      chunk.resize(copied > 0 ? std::size_t(copied) : 0);
+   }
+   return ! chunk.empty();
+}
+
+/**
+ *    Sets up a guided fuzzer.  See xpccut_guided_init() for the details of
+ *    the parameters.
+ *
+ * \param seed
+ *    The seed of the generator of the fuzzer.
+ *
+ * \param max_size
+ *    The largest size of an input.
+ *
+ * \param flags
+ *    The character-set flags for the bytes that the mutations insert.
+ *
+ * \param allowed
+ *    The characters to insert, or empty for the default set.
+ *
+ * \param excluded
+ *    The characters not to insert.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+GuidedFuzz::GuidedFuzz
+(
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const std::string & allowed,
+   const std::string & excluded
+) :
+   m_fuzzer    (),
+   m_is_valid  (false)
+{
+   m_is_valid = xpccut_guided_init
+   (
+      &m_fuzzer, seed, max_size, flags, allowed.c_str(), excluded.c_str()
+   );
+}
+
+/**
+ *    Releases the corpus and the maps of the fuzzer.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+GuidedFuzz::~GuidedFuzz ()
+{
+   xpccut_guided_free(&m_fuzzer);
+}
+
+/**
+ *    Adds an input to the corpus, as a starting point for the mutations.
+ *
+ * \param input
+ *    The input, which can hold any bytes.
+ *
+ * \return
+ *    Returns 'true' if the input was added.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+bool
+GuidedFuzz::add (const std::string & input)
+{
+   return m_is_valid && xpccut_guided_add
+   (
+      &m_fuzzer, input.data(), int(input.size())
+   );
+}
+
+/**
+ *    Gives the fuzzer a corpus directory, from which the inputs saved by
+ *    earlier runs are loaded, and to which new ones are saved.  See
+ *    xpccut_guided_directory().
+ *
+ * \param name
+ *    The name of the directory, which is created if it does not exist.
+ *
+ * \return
+ *    Returns 'true' if the directory was set and read.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+bool
+GuidedFuzz::directory (const std::string & name)
+{
+   return m_is_valid && xpccut_guided_directory(&m_fuzzer, name.c_str());
+}
+
+/**
+ *    Provides the input that made the target fail.
+ *
+ * \return
+ *    Returns the input, which is empty if the target has not failed.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+std::string
+GuidedFuzz::crash () const
+{
+   int size = 0;
+   const char * input = xpccut_guided_crash(&m_fuzzer, &size);
+   return cut_not_nullptr(input) ?
+      std::string(input, std::size_t(size)) : std::string() ;
+}
+
+/**
+ *    Provides the name of the file to which the failing input was written.
+ *
+ * \return
+ *    Returns the name, which is empty if there is no corpus directory, or
+ *    the target has not failed.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_02()
+ */
+
+std::string
+GuidedFuzz::crash_file () const
+{
+   const char * name = xpccut_guided_crash_file(&m_fuzzer);
+   return cut_not_nullptr(name) ? std::string(name) : std::string() ;
+}
+
+/**
+ *    Sets up a fuzz campaign.  See xpccut_campaign_init().
+ *
+ * \param jobs
+ *    The number of workers, usually cut_options::fuzz_job_count().
+ *
+ * \param seed
+ *    The base seed, such as RandomNumber::original_seed().
+ *
+ * \param max_size
+ *    The largest size of an input.
+ *
+ * \param flags
+ *    The character-set flags for the bytes that the mutations insert.
+ *
+ * \param allowed
+ *    The characters to insert, or empty for the default set.
+ *
+ * \param excluded
+ *    The characters not to insert.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+FuzzCampaign::FuzzCampaign
+(
+   int jobs,
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const std::string & allowed,
+   const std::string & excluded
+) :
+   m_campaign  (),
+   m_is_valid  (false)
+{
+   m_is_valid = xpccut_campaign_init
+   (
+      &m_campaign, jobs, seed, max_size, flags,
+      allowed.c_str(), excluded.c_str()
+   );
+}
+
+/**
+ *    Releases the workers of the campaign.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+FuzzCampaign::~FuzzCampaign ()
+{
+   xpccut_campaign_free(&m_campaign);
+}
+
+/**
+ *    Adds an input to the corpus of every worker.
+ *
+ * \param input
+ *    The input, which can hold any bytes.
+ *
+ * \return
+ *    Returns 'true' if the input was added.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+bool
+FuzzCampaign::add (const std::string & input)
+{
+   return m_is_valid && xpccut_campaign_add
+   (
+      &m_campaign, input.data(), int(input.size())
+   );
+}
+
+/**
+ *    Gives every worker the same corpus directory.  See
+ *    xpccut_campaign_directory().
+ *
+ * \param name
+ *    The name of the directory.
+ *
+ * \return
+ *    Returns 'true' if the directory was set and read.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+bool
+FuzzCampaign::directory (const std::string & name)
+{
+   return m_is_valid && xpccut_campaign_directory(&m_campaign, name.c_str());
+}
+
+/**
+ *    Provides the input that made the target fail.
+ *
+ * \return
+ *    Returns the input, which is empty if no worker has failed.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+std::string
+FuzzCampaign::crash () const
+{
+   int size = 0;
+   const char * input = xpccut_campaign_crash(&m_campaign, &size);
+   return cut_not_nullptr(input) ?
+      std::string(input, std::size_t(size)) : std::string() ;
+}
+
+/**
+ *    Provides the name of the file to which the failing input was written.
+ *
+ * \return
+ *    Returns the name, which is empty if there is no corpus directory, or
+ *    no worker has failed.
+ *
+ * \unittests
+ *    -  cut_unit_test_11_03()
+ */
+
+std::string
+FuzzCampaign::crash_file () const
+{
+   const char * name = xpccut_campaign_crash_file(&m_campaign);
+   return cut_not_nullptr(name) ? std::string(name) : std::string() ;
+}
+
 /**
  *    Write a string as it is to a simple file.  Absolutely no adornments,
  *    not even a newline.
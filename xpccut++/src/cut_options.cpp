@@ -54,6 +54,7 @@ cut_options::cut_options
    bool simulate
 ) :
    m_Options      (),
+   m_View         (&m_Options),
    m_Is_Valid     (xpccut_boolcast(unit_test_options_init(&m_Options)))
 {
    is_simulated(simulate);
@@ -114,6 +115,7 @@ cut_options::cut_options
    const std::string & additionalhelp
 ) :
    m_Options      (),
+   m_View         (&m_Options),
    m_Is_Valid     (xpccut_boolcast(unit_test_options_init(&m_Options)))
 {
    if (m_Is_Valid)
@@ -187,6 +189,7 @@ cut_options::cut_options
    const char * additionalhelp
 ) :
    m_Options      (),
+   m_View         (&m_Options),
    m_Is_Valid     (xpccut_boolcast(unit_test_options_init(&m_Options)))
 {
    if (m_Is_Valid)
@@ -211,6 +214,39 @@ cut_options::cut_options
    }
 }
 
+/**
+ *    Provides a view of options that belong to someone else.
+ *
+ * \ctor
+ *    This constructor makes an object that reads the given options in
+ *    place, without copying them.  It is cheap enough to make one for each
+ *    test, and, since nothing is written to the shared options, the
+ *    workers of the --jobs option can each make their own view of the same
+ *    options at the same time.  Calling a setter makes a private copy
+ *    first; see cut_options::writable().
+ *
+ *    The m_Options member is deliberately left unset, as it is not read
+ *    while the object is a view.
+ *
+ * \warning
+ *    The \a shared options must outlive this object, and any object
+ *    copied from it.
+ *
+ * \param shared
+ *    The options to be viewed.
+ *
+ * \unittests
+ *    -  cut_unit_test_03_05()
+ */
+
+cut_options::cut_options (const unit_test_options_t & shared)
+ :
+   m_View         (&shared),
+   m_Is_Valid     (true)
+{
+   /* No other functionality necessary. */
+}
+
 /**
  *    Provides the copy constructor for this class.
  *
@@ -218,7 +254,8 @@ cut_options::cut_options
  *    This function makes a copy of the given object.
  *
  *    The copy constructor can allows this class to be deep-copied, and this
- *    would be the most common case.
+ *    would be the most common case.  A copy of a view is another view of the
+ *    same options, and is just as cheap.
  *
  *    See \ref xpc_nice_classes for more information.
  *
@@ -238,10 +275,14 @@ cut_options::cut_options
 
 cut_options::cut_options (const cut_options & source)
  :
-   m_Options      (source.m_Options),
+   m_View         (source.m_View),
    m_Is_Valid     (source.m_Is_Valid)
 {
-   /* No other functionality necessary. */
+   if (! source.is_view())
+   {
+      m_Options = source.m_Options;
+      m_View = &m_Options;
+   }
 }
 
 /**
@@ -277,7 +318,13 @@ cut_options::operator = (const cut_options & source)
 {
    if (this != &source)
    {
-      m_Options   = source.m_Options;
+      if (source.is_view())
+         m_View   = source.m_View;
+      else
+      {
+         m_Options   = source.m_Options;
+         m_View      = &m_Options;
+      }
       m_Is_Valid  = source.m_Is_Valid;
    }
    return *this;
@@ -0,0 +1,139 @@
+/**
+ * \file          cut_registry.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_registrar and
+ *    xpc::cut_fixture_registrar classes.
+ *    Also see the cut_registry.hpp module for more information.
+ */
+
+#include <xpc/cut_registry.hpp>        /* xpc::cut_registrar                  */
+
+namespace xpc
+{
+
+/**
+ *    The head of the list of registered tests.  It is constant-initialized,
+ *    so it is null before any registrar in any translation unit is
+ *    constructed.
+ */
+
+const cut_registrar * cut_registrar::sm_Head = nullptr;
+
+/**
+ *    The number of registered tests.
+ */
+
+int cut_registrar::sm_Count = 0;
+
+/**
+ *    Adds a test to the head of the list of registered tests.  This
+ *    constructor is normally called by the static registrar object that
+ *    the XPC_CUT_TEST() macro declares.
+ *
+ *    The information is not checked here, since there is no good way to
+ *    report an error at static initialization time.  cut::load_registered()
+ *    checks it as it loads each test.
+ *
+ * \param test
+ *    The unit-test function to register.
+ *
+ * \param testgroup
+ *    The group number used by the test.
+ *
+ * \param testcase
+ *    The case number used by the test.
+ *
+ * \param groupname
+ *    The group name used by the test, a string literal.
+ *
+ * \param casename
+ *    The case name used by the test, a string literal.
+ *
+ * \param timeout
+ *    The timeout of the test, in milliseconds, or 0 to use the
+ *    --test-timeout value.
+ *
+ * \param isserial
+ *    If true, the test must run alone.  See cut::load_serial().
+ *
+ * \unittests
+ *    -  cut_unit_test_08_05()
+ *    -  cut_unit_test_08_07()
+ *    -  cut_unit_test_08_09()
+ */
+
+cut_registrar::cut_registrar
+(
+   test_function test,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename,
+   int timeout,
+   bool isserial
+) :
+   m_Test         (test),
+   m_Test_Group   (testgroup),
+   m_Test_Case    (testcase),
+   m_Group_Name   (groupname),
+   m_Case_Name    (casename),
+   m_Timeout      (timeout),
+   m_Is_Serial    (isserial),
+   m_Next         (sm_Head)
+{
+   sm_Head = this;
+   ++sm_Count;
+}
+
+/**
+ *    The head of the list of registered fixtures.
+ */
+
+const cut_fixture_registrar * cut_fixture_registrar::sm_Head = nullptr;
+
+/**
+ *    Adds a fixture to the head of the list of registered fixtures.  This
+ *    constructor is normally called by the static registrar object that
+ *    the XPC_CUT_FIXTURE() macro declares.  As with cut_registrar, the
+ *    information is checked when it is loaded.
+ *
+ * \param testgroup
+ *    The group number of the cases that share the fixture.
+ *
+ * \param setup
+ *    The function that sets up the fixture.
+ *
+ * \param teardown
+ *    The function that tears down the fixture, or null.
+ *
+ * \unittests
+ *    -  cut_unit_test_08_06()
+ */
+
+cut_fixture_registrar::cut_fixture_registrar
+(
+   int testgroup,
+   unit_test_setup_func_t setup,
+   unit_test_teardown_func_t teardown
+) :
+   m_Test_Group   (testgroup),
+   m_Setup        (setup),
+   m_Teardown     (teardown),
+   m_Next         (sm_Head)
+{
+   sm_Head = this;
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_registry.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
@@ -13,7 +13,8 @@
 
 #include <xpc/portable_subset.h>       /* C::xpccut_infoprintf()              */
 #include <xpc/cut_sequence.hpp>        /* class xpc::Sequencing               */
-#include <stdio.h>                     /* sprintf() [gasp!]                   */
+#include <xpc/trace.h>                 /* C::xpccut_trace_enter(), etc.       */
+#include <stdio.h>                     /* snprintf()                          */
 
 namespace xpc
 {
@@ -21,42 +22,62 @@ namespace xpc
 int Sequencing::gm_Sequence_Value = 0;
 
 /**
+ *    Prints one line of the sequence, numbered from the counter shared by
+ *    all threads.
+ */
+
+static void
+sequence_print (int & counter, const char * direction, const char * tag)
+{
+#if defined __GNUC__
+   int value = __sync_fetch_and_add(&counter, 1);
+#else
+   int value = counter++;
+#endif
+   char temp[128];
+   snprintf(temp, sizeof temp, "%4d: %s: %s", value, direction, tag);
+   xpccut_infoprint(temp);
+}
+
+/**
+ *    If the trace is enabled, the entering of the scope is recorded there,
+ *    whether \a doshow is set or not.  Otherwise, it is printed if \a
+ *    doshow is set.
+ *
  * \param tag
  *    Provides the tag to identify the part of the sequence information
- *    being logged.
+ *    being logged.  It must last until the trace is written out.
  *
  * \param doshow
  *    Provides an indicator if the output is to be seen, or not.
+ *
+ * \unittests
+ *    -  cut_unit_test_13_01()
  */
 
 Sequencing::Sequencing (const char * tag, bool doshow)
  :
    m_Tag_Name     (cut_not_nullptr(tag) ? tag : "???"),
-   m_Do_Show      (cut_not_nullptr(tag) ? doshow : true)
+   m_Do_Show      (cut_not_nullptr(tag) ? doshow : true),
+   m_Is_Traced    (xpccut_trace_is_enabled())
 {
-   if (m_Do_Show)
-   {
-      char temp[64];
-      sprintf(temp, "%4d:  IN: %s", gm_Sequence_Value, m_Tag_Name.c_str());
-      xpccut_infoprint(temp);
-      gm_Sequence_Value++;
-   }
+   if (m_Is_Traced)
+      xpccut_trace_enter(m_Tag_Name);
+   else if (m_Do_Show)
+      sequence_print(gm_Sequence_Value, " IN", m_Tag_Name);
 }
 
 /**
  * \unittests
- *    TBD
+ *    -  cut_unit_test_13_01()
  */
 
 Sequencing::~Sequencing ()
 {
-   if (m_Do_Show)
-   {
-      char temp[64];
-      sprintf(temp, "%4d: OUT: %s", gm_Sequence_Value, m_Tag_Name.c_str());
-      xpccut_infoprint(temp);
-      gm_Sequence_Value++;
-   }
+   if (m_Is_Traced)
+      xpccut_trace_exit(m_Tag_Name);
+   else if (m_Do_Show)
+      sequence_print(gm_Sequence_Value, "OUT", m_Tag_Name);
 }
 
 }           // namespace xpc
@@ -15,9 +15,9 @@
 #include <xpc/cut_status.hpp>          /* xpc::cut_status                     */
 #include <xpc/cut_options.hpp>         /* xpc::cut_options                    */
 
-#if XPC_HAVE_STDIO_H
-#include <stdio.h>                     /* fprintf()                           */
-#endif
+#include <xpc/output.h>                /* xpccut_print()                      */
+
+#include <string.h>                    /* strcmp()                            */
 
 /**
  * \doxygen
@@ -154,9 +154,9 @@ cut_status::cut_status
       }
       else if (! xpccut_is_silent())
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "  %s: %s %d, %s %d\n",
+            "  %s: %s %d, %s %d\n",
             _("unit-test skipped"), _("group"), testgroup,
             _("case"), testcase
          );
@@ -247,6 +247,136 @@ cut_status::~cut_status ()
    m_Is_Valid = false;                 /* prevent last-instant usage          */
 }
 
+/**
+ *    Compares two C strings for check_eq() and check_ne().  Two null
+ *    pointers are equal, as in unit_test_status_string_check().
+ *
+ * \return
+ *    Returns 'true' if the strings are equal.
+ *
+ * \unittests
+ *    -  cut_unit_test_02_32()
+ */
+
+bool
+cut_status::equal (const char * lhs, const char * rhs, std::true_type)
+{
+   bool result;
+   if (cut_is_nullptr(lhs))
+      result = cut_is_nullptr(rhs);
+   else
+      result = cut_not_nullptr(rhs) && strcmp(lhs, rhs) == 0;
+
+   return result;
+}
+
+/**
+ *    Formats a C string for the message of a failed check, quoted as
+ *    unit_test_status_string_check() shows it.
+ *
+ * \return
+ *    Returns the quoted string, or the "null pointer" text.
+ *
+ * \unittests
+ *    -  cut_unit_test_02_32()
+ */
+
+std::string
+cut_status::format (const char * value, std::true_type)
+{
+   return cut_is_nullptr(value) ?
+      std::string(_("null pointer")) : format(std::string(value)) ;
+}
+
+/**
+ *    Formats a std::string for the message of a failed check, quoted as
+ *    unit_test_status_string_check() shows it.
+ *
+ * \return
+ *    Returns the quoted string.
+ *
+ * \unittests
+ *    -  cut_unit_test_02_32()
+ */
+
+std::string
+cut_status::format (const std::string & value)
+{
+   std::string result = "'";
+   result += value;
+   result += "'";
+   return result;
+}
+
+/**
+ *    Records a failed check_near(), and shows the values and the tolerance
+ *    unless --silent is in force.
+ *
+ * \return
+ *    Always returns 'false'.
+ *
+ * \unittests
+ *    -  cut_unit_test_02_32()
+ */
+
+bool
+cut_status::near_failed
+(
+   double expected_value,
+   double actual_value,
+   double tolerance
+)
+{
+   (void) pass(false);
+   if (! xpccut_is_silent())
+   {
+      xpccut_print
+      (
+         "? %.17g %s, %.17g %s, %s %g\n",
+         expected_value, _("expected"), actual_value, _("actual"),
+         _("tolerance"), tolerance
+      );
+   }
+   return false;
+}
+
+/**
+ *    Shows the values of a failed check.  A null \a relation shows them as
+ *    int_check() does; otherwise the relation that was expected to hold is
+ *    shown.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for cut_status::check_eq().
+ *
+ * \unittests
+ *    -  cut_unit_test_02_32()
+ */
+
+void
+cut_status::show_check
+(
+   const std::string & lhs,
+   const char * relation,
+   const std::string & rhs
+)
+{
+   if (cut_is_nullptr(relation))
+   {
+      xpccut_print
+      (
+         "? %s %s, %s %s\n",
+         lhs.c_str(), _("expected"), rhs.c_str(), _("actual")
+      );
+   }
+   else
+   {
+      xpccut_print
+      (
+         "? %s %s %s %s\n", lhs.c_str(), relation, rhs.c_str(), _("expected")
+      );
+   }
+}
+
 }              /* namespace xpc */
 
 /*
@@ -0,0 +1,74 @@
+/**
+ * \file          cut_stopwatch.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the definitions for the xpc::cut_stopwatch class.
+ *    Also see the cut_stopwatch.hpp module for more information.
+ */
+
+#include <xpc/cut_stopwatch.hpp>       /* xpc::cut_stopwatch                  */
+
+namespace xpc
+{
+
+/**
+ *    Creates a stopwatch and starts it.
+ *
+ * \unittests
+ *    -  cut_unit_test_10_01()
+ */
+
+cut_stopwatch::cut_stopwatch ()
+ :
+   m_Stopwatch    (),
+   m_Result_ms    (nullptr)
+{
+   restart();
+}
+
+/**
+ *    Creates a stopwatch that reports its elapsed time when it is
+ *    destroyed, and starts it.
+ *
+ * \param result_ms
+ *    The variable that receives the elapsed time, in milliseconds.  It is
+ *    set to 0.0 here, and must outlive the stopwatch.
+ *
+ * \unittests
+ *    -  cut_unit_test_10_01()
+ */
+
+cut_stopwatch::cut_stopwatch (double & result_ms)
+ :
+   m_Stopwatch    (),
+   m_Result_ms    (&result_ms)
+{
+   result_ms = 0.0;
+   restart();
+}
+
+/**
+ *    Stores the elapsed time in the caller's variable, if one was given.
+ *
+ * \unittests
+ *    -  cut_unit_test_10_01()
+ */
+
+cut_stopwatch::~cut_stopwatch ()
+{
+   if (m_Result_ms != nullptr)
+      *m_Result_ms = elapsed_ms();
+}
+
+}              /* namespace xpc */
+
+/*
+ * cut_stopwatch.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
@@ -0,0 +1,432 @@
+/**
+ * \file          cut_bench.cpp
+ * \library       libxpccut++
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    This application measures the overhead of the C++ wrapper, on top of
+ *    what xpccut/tests/unit_test_bench measures for the C library: running
+ *    a test through xpc::cut, making and copying the cut_status and
+ *    cut_options objects, the sub-tests and checks of a cut_status, and
+ *    the resolution of cut_stopwatch.  It is built along with
+ *    cut_unit_test, and run by "make bench".
+ *
+ *    The results have the same form as those of unit_test_bench, one line
+ *    of JSON per measurement, with "xpccut++" as the library, so the two
+ *    sets of results can be read by the same script.  The options are also
+ *    the same:
+ *
+ *       -  --quick:  Runs a tenth of the iterations, as a smoke test.
+ *       -  --output file:  Writes the results to a file, not stdout.
+ */
+
+#include <algorithm>                   /* std::sort()                         */
+#include <cstdio>                      /* std::fprintf(), std::fopen()        */
+#include <cstdlib>                     /* EXIT_SUCCESS and EXIT_FAILURE       */
+#include <cstring>                     /* std::strcmp()                       */
+#include <string>                      /* std::string                         */
+#include <vector>                      /* std::vector                         */
+#include <xpc/cut.hpp>                 /* xpc::cut unit-test class            */
+#include <xpc/cut_benchmark.hpp>       /* xpc::do_not_optimize()              */
+#include <xpc/cut_stopwatch.hpp>       /* xpc::cut_stopwatch                  */
+#include <xpc/output.h>                /* xpccut_output_set_sink()            */
+
+/**
+ *    The number of times each measurement is taken.
+ */
+
+#define BENCH_ROUNDS             7
+
+/**
+ *    The number of tests run by each round of the per-test measurements.
+ */
+
+#define BENCH_TESTS              2000
+
+/**
+ *    The number of calls timed by each round of the other measurements.
+ */
+
+#define BENCH_CALLS              1000000
+
+/**
+ *    Divides the iteration counts, for the --quick option.
+ */
+
+static int gs_divisor = 1;
+
+/**
+ *    The file that receives the results, stdout by default.
+ */
+
+static std::FILE * gs_results = nullptr;
+
+/**
+ *    Counts the output thrown away by bench_discard().
+ */
+
+static unsigned long gs_discarded = 0;
+
+/**
+ *    Provides an output sink that throws away the output of the tests
+ *    being timed, while counting it, so that it is still formatted.
+ */
+
+static void
+bench_discard
+(
+   void * /* context */,
+   xpccut_output_channel_t /* channel */,
+   const char * /* text */,
+   int length
+)
+{
+   gs_discarded += (unsigned long) length;
+}
+
+/**
+ *    Provides the number of iterations to run, scaled by --quick.
+ */
+
+static int
+bench_count (int count)
+{
+   int result = count / gs_divisor;
+   return result > 0 ? result : 1 ;
+}
+
+/**
+ *    Times \a count calls of \a body.
+ *
+ * \return
+ *    Returns the time of one call, in nanoseconds.
+ */
+
+template <typename F>
+static double
+bench_time (int count, F body)
+{
+   xpccut_ticks_t start = xpccut_get_ticks();
+   for (int i = 0; i < count; ++i)
+      body(i);
+
+   return double(xpccut_get_ticks() - start) / count;
+}
+
+/**
+ *    Writes the result of one measurement as a line of JSON, in the form
+ *    written by unit_test_bench.
+ *
+ * \param bench
+ *    The name of the measurement.
+ *
+ * \param unit
+ *    The unit of the values.
+ *
+ * \param count
+ *    The number of calls in each round.
+ *
+ * \param values
+ *    The value found by each round.
+ */
+
+static void
+bench_report
+(
+   const char * bench,
+   const char * unit,
+   long count,
+   std::vector<double> values
+)
+{
+   std::sort(values.begin(), values.end());
+   std::fprintf
+   (
+      gs_results,
+      "{\"library\":\"xpccut++\",\"bench\":\"%s\",\"unit\":\"%s\","
+      "\"count\":%ld,\"median\":%.3f,\"min\":%.3f,\"max\":%.3f}\n",
+      bench, unit, count,
+      values[values.size() / 2], values.front(), values.back()
+   );
+   std::fflush(gs_results);
+}
+
+/**
+ *    Provides the test run by the per-test measurements, which does the
+ *    least that a test can do: it starts one sub-test, and passes.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+bench_empty_test (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 1, 1, "bench", "empty test");
+   if (status.valid())
+   {
+      if (status.next_subtest("only"))
+         status.pass(true);
+   }
+   return status;
+}
+
+/**
+ *    Times one run of BENCH_TESTS empty tests through xpc::cut::run().
+ *
+ * \param progress
+ *    If true, the tests show their progress messages, as they do by
+ *    default; otherwise --no-show-progress is given.
+ *
+ * \return
+ *    Returns the time of one test, in nanoseconds, or -1.0 if the run
+ *    failed.
+ */
+
+static double
+bench_run_tests (bool progress)
+{
+   double result = -1.0;
+   char * argv[] =
+   {
+      const_cast<char *>("cut_bench"),
+      const_cast<char *>("--no-show-progress"),
+      nullptr
+   };
+   int count = bench_count(BENCH_TESTS);
+   xpc::cut tests(progress ? 1 : 2, argv, "bench");
+   bool ok = tests.valid();
+   for (int i = 0; ok && i < count; ++i)
+      ok = tests.load(bench_empty_test);
+
+   if (ok)
+   {
+      void * context = nullptr;
+      xpccut_output_sink_t sink = xpccut_output_get_sink(&context);
+      xpccut_output_set_sink(bench_discard, nullptr);
+
+      xpccut_ticks_t start = xpccut_get_ticks();
+      ok = tests.run();
+      result = double(xpccut_get_ticks() - start) / count;
+      xpccut_output_flush();
+      xpccut_output_set_sink(sink, context);
+      if (! ok)
+         result = -1.0;
+   }
+   return result;
+}
+
+/**
+ *    Measures the overhead of running a test through xpc::cut, with and
+ *    without the progress messages.
+ *
+ * \return
+ *    Returns 'true' if the runs succeeded.
+ */
+
+static bool
+bench_per_test ()
+{
+   bool result = true;
+   for (int pass = 0; result && pass < 2; ++pass)
+   {
+      std::vector<double> values;
+      for (int r = 0; result && r < BENCH_ROUNDS; ++r)
+      {
+         values.push_back(bench_run_tests(pass == 1));
+         result = values.back() >= 0.0;
+      }
+      if (result)
+      {
+         bench_report
+         (
+            pass == 0 ? "per_test" : "per_test_progress", "ns",
+            long(bench_count(BENCH_TESTS)), values
+         );
+      }
+      else
+         std::fprintf(stderr, "? %s\n", "the run of the tests failed");
+   }
+   return result;
+}
+
+/**
+ *    Measures the costs of the cut_options and cut_status objects, and of
+ *    the sub-tests and checks of a cut_status.
+ *
+ * \return
+ *    Returns 'true' if the checks all passed, as they should.
+ */
+
+static bool
+bench_per_check ()
+{
+   xpc::cut_options options;
+   options.show_progress(false);
+
+   xpc::cut_status status(options, 1, 1, "bench", "status");
+   bool result = options.valid() && status.valid();
+   if (result)
+   {
+      const std::string expected("expected value");
+      const std::string actual("expected value");
+      std::vector<double> construct, copy, optcopy, subtest;
+      std::vector<double> pass, intcheck, checkeq, checkstr;
+      int count = bench_count(BENCH_CALLS);
+      int statuses = bench_count(BENCH_CALLS / 10);
+      for (int r = 0; r < BENCH_ROUNDS; ++r)
+      {
+         construct.push_back
+         (
+            bench_time(statuses, [&options] (int)
+            {
+               xpc::cut_status s(options, 1, 1, "bench", "status");
+               xpc::do_not_optimize(s);
+            })
+         );
+         copy.push_back
+         (
+            bench_time(statuses, [&status] (int)
+            {
+               xpc::cut_status s(status);
+               xpc::do_not_optimize(s);
+            })
+         );
+         optcopy.push_back
+         (
+            bench_time(statuses, [&options] (int)
+            {
+               xpc::cut_options o(options);
+               xpc::do_not_optimize(o);
+            })
+         );
+         subtest.push_back
+         (
+            bench_time(count, [&status] (int)
+            {
+               (void) status.next_subtest("sub-test");
+            })
+         );
+         pass.push_back
+         (
+            bench_time(count, [&status] (int) { (void) status.pass(true); })
+         );
+         intcheck.push_back
+         (
+            bench_time(count, [&status] (int i)
+            {
+               (void) status.int_check(i, i);
+            })
+         );
+         checkeq.push_back
+         (
+            bench_time(count, [&status] (int i)
+            {
+               (void) status.check_eq(i, i);
+            })
+         );
+         checkstr.push_back
+         (
+            bench_time(count, [&] (int)
+            {
+               (void) status.check_eq(expected, actual);
+            })
+         );
+      }
+      bench_report("status_construct", "ns", long(statuses), construct);
+      bench_report("status_copy", "ns", long(statuses), copy);
+      bench_report("options_copy", "ns", long(statuses), optcopy);
+      bench_report("per_subtest", "ns", long(count), subtest);
+      bench_report("check_pass", "ns", long(count), pass);
+      bench_report("check_int", "ns", long(count), intcheck);
+      bench_report("check_eq", "ns", long(count), checkeq);
+      bench_report("check_eq_string", "ns", long(count), checkstr);
+      result = status.passed();
+   }
+   else
+      std::fprintf(stderr, "? %s\n", "the status could not be set up");
+
+   return result;
+}
+
+/**
+ *    Measures the resolution of cut_stopwatch, which is the smallest time
+ *    that it can show.
+ */
+
+static void
+bench_stopwatch ()
+{
+   std::vector<double> values;
+   int count = bench_count(BENCH_CALLS);
+   for (int r = 0; r < BENCH_ROUNDS; ++r)
+   {
+      xpc::cut_stopwatch sw;
+      double ms = 0.0;
+      for (int i = 0; ms <= 0.0 && i < count; ++i)
+         ms = sw.elapsed_ms();
+
+      values.push_back(ms * 1.0e6);
+   }
+   bench_report("stopwatch_resolution", "ns", long(count), values);
+}
+
+/**
+ *    This is the main routine for the cut_bench application.
+ *
+ * \return
+ *    Returns EXIT_SUCCESS if every measurement could be taken.
+ */
+
+int
+main
+(
+   int argc,               /**< Number of command-line arguments.             */
+   char * argv []          /**< The actual array of command-line arguments.   */
+)
+{
+   bool ok = true;
+   gs_results = stdout;
+   for (int i = 1; ok && i < argc; ++i)
+   {
+      if (std::strcmp(argv[i], "--quick") == 0)
+         gs_divisor = 10;
+      else if (std::strcmp(argv[i], "--output") == 0 && (i + 1) < argc)
+      {
+         gs_results = std::fopen(argv[++i], "w");
+         ok = gs_results != nullptr;
+         if (! ok)
+            std::fprintf(stderr, "? %s '%s'\n", "cannot open", argv[i]);
+      }
+      else
+      {
+         std::fprintf
+         (
+            stderr, "Usage: %s [--quick] [--output file]\n", argv[0]
+         );
+         ok = false;
+      }
+   }
+   if (ok)
+      ok = bench_per_test();
+
+   if (ok)
+      ok = bench_per_check();
+
+   if (ok)
+      bench_stopwatch();
+
+   if (gs_results != nullptr && gs_results != stdout)
+      std::fclose(gs_results);
+
+   return ok ? EXIT_SUCCESS : EXIT_FAILURE ;
+}
+
+/*
+ * cut_bench.cpp
+ *
+ * vim: ts=3 sw=3 et ft=cpp
+ */
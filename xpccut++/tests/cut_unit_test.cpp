@@ -36,9 +36,23 @@
  *    No separate public accessors are (yet) provided.
  */
 
+#include <cstdio>                      /* std::sprintf()                      */
+#include <cstdlib>                     /* std::abort()                        */
 #include <stdexcept>                   /* std::logic_error                    */
-#include <iostream>                    /* std::cout and std::cerr             */
+#include <vector>                      /* std::vector                         */
 #include <xpc/cut.hpp>                 /* xpc::cut unit-test class            */
+#include <xpc/cut_arena.hpp>           /* xpc::cut_arena                      */
+#include <xpc/cut_benchmark.hpp>       /* xpc::cut_benchmark                  */
+#include <xpc/cut_concurrent.hpp>      /* xpc::cut_concurrent                 */
+#include <xpc/cut_event_loop.hpp>      /* xpc::cut_event_loop                 */
+#include <xpc/cut_fuzz.hpp>            /* xpc::FuzzStream, xpc::GuidedFuzz    */
+#include <xpc/cut_registry.hpp>        /* XPC_CUT_TEST() and the registry     */
+#include <xpc/cut_sequence.hpp>        /* xpc::Sequencing                     */
+#include <xpc/cut_stopwatch.hpp>       /* xpc::cut_stopwatch                  */
+
+#if XPC_HAVE_UNISTD_H && ! defined WIN32
+#include <unistd.h>                    /* pipe(), read(), write(), close()    */
+#endif
 
 /**
  *    Provides a "null" parameter for some of the tests.
@@ -111,7 +125,7 @@ exclaim
 )
 {
    if (options.is_verbose() && ! xpccut_is_silent())
-      std::cout << "! " << message << std::endl;
+      xpccut_print("! %s\n", message.c_str());
 }
 
 /**
@@ -130,7 +144,7 @@ inform
 )
 {
    if (options.is_verbose() && ! xpccut_is_silent())
-      std::cout << "* " << message << std::endl;
+      xpccut_print("* %s\n", message.c_str());
 }
 
 /**
@@ -149,7 +163,7 @@ show
 )
 {
    if (options.show_values() && ! xpccut_is_silent())
-      std::cout << "  " << message << std::endl;
+      xpccut_print("  %s\n", message.c_str());
 }
 
 /**
@@ -300,10 +314,8 @@ public:
     *    field.
     *
     *    There is no C setter function for this field, so we must access the
-    *    structure and field directly.
-    *
-    *    Note that this function does not test the parameter or the length
-    *    of the string.
+    *    structure and field directly.  The field points to an interned
+    *    string, so the name is interned first.
     */
 
    void Status_Set_Group_Name
@@ -312,7 +324,7 @@ public:
       const char * grpname       /**< The group name to wire into the status. */
    )
    {
-      strcpy(&s.m_Status.m_Group_Name[0], grpname);
+      s.m_Status.m_Group_Name = xpccut_intern(grpname);
    }
 
    /**
@@ -355,23 +367,7 @@ public:
       const char * casename      /**< The case name to wire into the status.  */
    )
    {
-      size_t casesize = sizeof(s.m_Status.m_Case_Description);
-      if (g_use_direct_field_access)
-      {
-         strncpy(&s.m_Status.m_Case_Description[0], casename, casesize);
-         s.m_Status.m_Case_Description[casesize-1] = 0;
-      }
-      else
-      {
-         /*
-          * There is no setter for this value, so we cast away const-ness
-          * from the return value of the C getter function.  This is
-          * cheating.
-          */
-
-         char * cn = (char *) unit_test_status_case_name(&s.m_Status);
-         strncpy(cn, casename, casesize);
-      }
+      s.m_Status.m_Case_Description = xpccut_intern(casename);
    }
 
    /**
@@ -408,17 +404,7 @@ public:
       const char * testname      /**< Sub-test name to wire into the status.  */
    )
    {
-      if (g_use_direct_field_access)
-         strcpy(&s.m_Status.m_Subtest_Name[0], testname);
-      else
-      {
-         /*
-          * There is no setter for this value, so we cast away const-ness from
-          * the return value of the C getter function.
-          */
-
-         strcpy((char *) unit_test_status_subtest_name(&s.m_Status), testname);
-      }
+      s.m_Status.m_Subtest_Name = xpccut_intern(testname);
    }
 
    /**
@@ -730,9 +716,8 @@ public:
       const cut_status & s       /**< The status object to show time values.  */
    )
    {
-      fprintf
+      xpccut_print
       (
-         stdout,
          "\n"
          "? Bad times:\n"
          "\n"
@@ -765,11 +750,10 @@ public:
 
       if (! ok)
       {
-         std::cout
-            << "? m_Test_Duration = "
-            << s.status().m_Test_Duration_ms
-            << std::endl
-            ;
+         xpccut_print
+         (
+            "? m_Test_Duration = %g\n", s.status().m_Test_Duration_ms
+         );
       }
       return ok;
    }
@@ -812,6 +796,72 @@ public:
          return &s.options();
    }
 
+   /*
+    * unit_test_t access functions
+    */
+
+   /**
+    *    White-box access to the private xpc::cut::failures() function.
+    */
+
+   int Cut_Failures
+   (
+      const cut & c              /**< The cut object used for access.        */
+   )
+   {
+      return c.failures();
+   }
+
+   /**
+    *    White-box access to the private xpc::cut::run_count() function.
+    */
+
+   int Cut_Run_Count
+   (
+      const cut & c              /**< The cut object used for access.        */
+   )
+   {
+      return c.run_count();
+   }
+
+   /**
+    *    White-box access to the private xpc::cut::count() function.
+    */
+
+   int Cut_Count
+   (
+      const cut & c              /**< The cut object used for access.        */
+   )
+   {
+      return c.count();
+   }
+
+   /**
+    *    White-box access to the private xpc::cut::first_failed_test()
+    *    function.
+    */
+
+   int Cut_First_Failed_Test
+   (
+      const cut & c              /**< The cut object used for access.        */
+   )
+   {
+      return c.first_failed_test();
+   }
+
+   /**
+    *    White-box access to the private xpc::cut::first_failed_case()
+    *    function.
+    */
+
+   int Cut_First_Failed_Case
+   (
+      const cut & c              /**< The cut object used for access.        */
+   )
+   {
+      return c.first_failed_case();
+   }
+
 };
 
 }           /* namespace xpc  */
@@ -2194,9 +2244,9 @@ s_show_durations
    double actual_duration     /**< The actual duration, in floating-point.    */
 )
 {
-   fprintf
+   xpccut_print
    (
-      stdout, "  %s: %s = %d ms, %s = %f ms\n",
+      "  %s: %s = %d ms, %s = %f ms\n",
       _("Duration"), _("nominal"), nominal_duration,
       _("actual"), float(actual_duration)
    );
@@ -3225,7 +3275,7 @@ cut_unit_test_02_10 (const xpc::cut_options & options)
 
       status.trace(_("Post-constructor in cut_unit_test_02_10"));
       if (options.show_progress())
-         fprintf(stdout, "  %s\n", _("This test plays a beep if interactive."));
+         xpccut_print("  %s\n", _("This test plays a beep if interactive."));
 
       /*  1 */
 
@@ -5502,21 +5552,23 @@ cut_unit_test_02_31 (const xpc::cut_options & options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the basic
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
- *
- *    These default values are defined in the unit_test_options.h module in
- *    the XPC CUT library (libxpccut).
+ *    Provides a unit/regression test to verify that the templated checks
+ *    compare, format their values only on failure, and do not allocate
+ *    when they pass.
  *
  * \group
- *    3. xpc::cut_options functions.
+ *    2. xpc::cut_status functions.
  *
  * \case
- *    1. init().
+ *    32. check_eq() and relatives.
  *
  * \test
- *    -  xpc::cut_options::init()
+ *    -  xpc::cut_status::check_eq()
+ *    -  xpc::cut_status::check_ne()
+ *    -  xpc::cut_status::check_lt()
+ *    -  xpc::cut_status::check_le()
+ *    -  xpc::cut_status::check_near()
+ *    -  xpc::cut_status::string_check() [C strings]
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -5526,194 +5578,315 @@ cut_unit_test_02_31 (const xpc::cut_options & options)
  */
 
 static xpc::cut_status
-cut_unit_test_03_01 (const xpc::cut_options & options)
+cut_unit_test_02_32 (const xpc::cut_options & options)
 {
    xpc::cut_status status
    (
-      options, 3, 1,
-      "xpc::cut_options", "cut_options::init()"
+      options, 2, 32, "xpc::cut_status", "cut_status::check_eq()"
    );
    bool ok = status.valid();        /* note that invalidity is /not/ an error */
    if (ok)
    {
-      /**
-       * Note that the 'simulated' option is used in order better
-       * distinguish test output from the real output.  Also note that this
-       * test would be more robust if we set all the values to the opposite
-       * of their default values before calling the xpc::cut_options::init()
-       * function.
+      /*
+       * The internal status gets options of its own, so that a --group or
+       * --case selection does not skip it.
        */
 
       xpc::cut_options x_options(XPCCUT_OPTIONS_SIMULATED);
+      xpc::cut_status x_status
+      (
+         x_options, 99, 99, "x_status", _("internal test")
+      );
+      ok = x_options.valid() && x_status.valid();
 
       /*  1 */
 
-      if (status.next_subtest("Null 'this'"))
+      if (status.next_subtest("check_eq() of numbers"))
       {
-         inform(options, _("A null 'this' is not possible in C++ code"));
-         // x_options.is_simulated(true);
-         status.pass(true);
-      }
+         if (ok)
+            ok = x_status.check_eq(42, 42) && x_status.check_eq(2.5, 2.5);
 
-      /*  2 */
+         if (ok)
+            ok = x_status.check_eq('x', 'x') && x_status.check_eq(true, true);
+
+         if (ok)
+         {
+            ok = ! x_status.check_eq(42, 24);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 1;
 
-      if (status.next_subtest("Good 'this'"))
-      {
-         ok = x_options.init();
          status.pass(ok);
       }
 
-      /*  3 */
+      /*  2 */
 
-      if (status.next_subtest("is_verbose()"))
+      if (status.next_subtest("check_eq() of strings"))
       {
-         /**
-          * We're not going to bother with any apparatus for checking
-          * the C internals for the cut_options class.  We did that for
-          * cut_status class, and we're not sure it really adds value.
-          * Maybe it does, a little, but enough is enough, time to move on!
-          */
+         char buffer[8] = "abc";
+         const char * text = "abc";
+         const char * none = nullptr;
+         const std::string s = "abc";
+         if (ok)
+            ok = x_status.check_eq(buffer, text);  /* strcmp(), not address */
 
-         ok = x_options.is_verbose() == XPCCUT_IS_VERBOSE;
-         status.pass(ok);
-      }
+         if (ok)
+            ok = x_status.check_eq(s, "abc") && x_status.check_eq(none, none);
 
-      /*  4 */
+         if (ok)
+         {
+            ok = ! x_status.check_eq(text, none);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+         {
+            ok = ! x_status.check_eq(s, "abd");
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 3;
 
-      if (status.next_subtest("show_values()"))
-      {
-         ok = x_options.show_values() == XPCCUT_SHOW_VALUES;
          status.pass(ok);
       }
 
-      /*  5 */
+      /*  3 */
 
-      if (status.next_subtest("use_text_synch()"))
+      if (status.next_subtest("check_ne()"))
       {
-         ok = x_options.use_text_synch() == XPCCUT_TEXT_SYNCH;
-         status.pass(ok);
-      }
+         const char * text = "abc";
+         if (ok)
+            ok = x_status.check_ne(1, 2) && x_status.check_ne(text, "abd");
 
-      /*  6 */
+         if (ok)
+         {
+            ok = ! x_status.check_ne(text, "abc");
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 4;
 
-      if (status.next_subtest("show_step_numbers()"))
-      {
-         ok = x_options.show_step_numbers() == XPCCUT_SHOW_STEP_NUMBERS;
          status.pass(ok);
       }
 
-      /*  7 */
+      /*  4 */
 
-      if (status.next_subtest("show_progress()"))
+      if (status.next_subtest("check_lt() and check_le()"))
       {
-         ok = x_options.show_progress() == XPCCUT_SHOW_PROGRESS;
-         status.pass(ok);
-      }
-
-      /*  8 */
+         const std::string a = "a";
+         const std::string b = "b";
+         if (ok)
+            ok = x_status.check_lt(1, 2) && x_status.check_le(2, 2);
 
-      if (status.next_subtest("stop_on_error()"))
-      {
-         ok = x_options.stop_on_error() == XPCCUT_STOP_ON_ERROR;
-         status.pass(ok);
-      }
+         if (ok)
+            ok = x_status.check_lt(a, b) && x_status.check_le(-1.0, 0.0);
 
-      /*  9 */
+         if (ok)
+         {
+            ok = ! x_status.check_lt(2, 2);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+         {
+            ok = ! x_status.check_le(b, a);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 6;
 
-      if (status.next_subtest("batch_mode()"))
-      {
-         ok = x_options.batch_mode() == XPCCUT_BATCH_MODE;
          status.pass(ok);
       }
 
-      /* 10 */
+      /*  5 */
 
-      if (status.next_subtest("is_interactive()"))
+      if (status.next_subtest("check_near()"))
       {
-         ok = x_options.is_interactive() == XPCCUT_INTERACTIVE;
-         status.pass(ok);
-      }
-
-      /* 11 */
+         volatile double zero = 0.0;
+         double nan = zero / zero;
+         if (ok)
+            ok = x_status.check_near(1.0, 1.0 + 1.0e-9, 1.0e-6);
 
-      if (status.next_subtest("do_beep()"))
-      {
-         ok = x_options.do_beep() == XPCCUT_BEEP;
-         status.pass(ok);
-      }
+         if (ok)
+            ok = x_status.check_near(1.0f, 0.9f, 0.2);
 
-      /* 12 */
+         if (ok)
+         {
+            ok = ! x_status.check_near(1.0, 1.1, 0.01);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+         {
+            ok = ! x_status.check_near(nan, nan, 1.0);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 8;
 
-      if (status.next_subtest("is_summary()"))
-      {
-         ok = x_options.is_summary() == XPCCUT_SUMMARIZE;
          status.pass(ok);
       }
 
-      /* 13 */
+      /*  6 */
 
-      if (status.next_subtest("is_pause()"))
+      if (status.next_subtest("string_check() of C strings"))
       {
-         ok = x_options.is_pause() == XPCCUT_CASE_PAUSE;
-         status.pass(ok);
-      }
-
-      /* 14 */
+         if (ok)
+            ok = x_status.string_check("abc", "abc");
 
-      if (status.next_subtest("single_group()"))
-      {
-         ok = x_options.single_group() == XPCCUT_NO_SINGLE_GROUP;
-         status.pass(ok);
-      }
+         if (ok)
+            ok = x_status.string_check(nullptr, nullptr);
 
-      /* 15 */
+         if (ok)
+         {
+            ok = ! x_status.string_check("abc", nullptr);
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 9;
 
-      if (status.next_subtest("single_case()"))
-      {
-         ok = x_options.single_case() == XPCCUT_NO_SINGLE_CASE;
          status.pass(ok);
       }
 
-      /* 16 */
+      /*  7 */
 
-      if (status.next_subtest("single_subtest()"))
+      if (status.next_subtest("Passing checks do not allocate"))
       {
-         ok = x_options.single_subtest() == XPCCUT_NO_SINGLE_SUB_TEST;
-         status.pass(ok);
-      }
-
-      /* 17 */
+         const std::string s = "a string too long for the small buffer";
+         const char * text = "abc";
+         int passes = 0;
+         for (int i = 0; i < 1000; ++i)
+         {
+            if (x_status.check_eq(i, i) && x_status.check_lt(i, i + 1))
+               ++passes;
 
-      if (status.next_subtest("test_sleep_time()"))
-      {
-         ok = x_options.test_sleep_time() == XPCCUT_TEST_SLEEP_TIME;
-         status.pass(ok);
-      }
+            if (x_status.check_eq(s, s) && x_status.check_ne(text, "abd"))
+               ++passes;
 
-      /* 18 */
+            if (x_status.check_near(0.5 * i, 0.5 * i, 0.0))
+               ++passes;
+         }
+         ok = status.no_alloc_check();
+         if (ok)
+            ok = passes == 3000 && x_status.error_count() == 9;
 
-      if (status.next_subtest("need_subtests()"))
-      {
-         ok = x_options.need_subtests() == XPCCUT_NEED_SUBTESTS;
          status.pass(ok);
       }
+   }
+   return status;
+}
 
-      /* 19 */
-
-      if (status.next_subtest("force_failure()"))
+/**
+ *    Provides a unit/regression test to verify the bulk checks of buffers
+ *    and arrays.  The C tests cover the edge cases; this test covers the
+ *    accessors.
+ *
+ * \group
+ *    2. xpc::cut_status functions.
+ *
+ * \case
+ *    33. Bulk checks.
+ *
+ * \test
+ *    -  xpc::cut_status::buffer_check()
+ *    -  xpc::cut_status::int_array_check()
+ *    -  xpc::cut_status::double_array_check()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_02_33 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 2, 33, "xpc::cut_status", "cut_status::buffer_check()"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      xpc::cut_options x_options(XPCCUT_OPTIONS_SIMULATED);
+      xpc::cut_status x_status
+      (
+         x_options, 99, 99, "x_status", _("internal test")
+      );
+      ok = x_options.valid() && x_status.valid();
+
+      /*  1 */
+
+      if (status.next_subtest("buffer_check()"))
       {
-         ok = x_options.force_failure() == XPCCUT_FORCE_FAILURE;
+         std::string expected(10000, 'x');
+         std::string actual = expected;
+         if (ok)
+         {
+            ok = x_status.buffer_check
+            (
+               expected.data(), actual.data(), expected.size()
+            );
+         }
+         if (ok)
+         {
+            actual[5000] = 'y';
+            ok = ! x_status.buffer_check
+            (
+               expected.data(), actual.data(), expected.size()
+            );
+            show_deliberate_failure(options);
+         }
          status.pass(ok);
       }
 
-      /* 20 */
+      /*  2 */
 
-      if (status.next_subtest("current_test()"))
+      if (status.next_subtest("int_array_check()"))
       {
-         xpc::cut_status x_status;
-         ok = x_options.force_failure() == XPCCUT_FORCE_FAILURE;
+         std::vector<int> expected(100, 7);
+         std::vector<int> actual = expected;
          if (ok)
-            ok = x_status.int_check(x_options.current_test(), -1);
+         {
+            ok = x_status.int_array_check
+            (
+               &expected[0], &actual[0], expected.size()
+            );
+         }
+         if (ok)
+         {
+            actual[0] = 8;
+            ok = ! x_status.int_array_check
+            (
+               &expected[0], &actual[0], expected.size()
+            );
+            show_deliberate_failure(options);
+         }
+         status.pass(ok);
+      }
+
+      /*  3 */
+
+      if (status.next_subtest("double_array_check()"))
+      {
+         std::vector<double> expected(100, 0.5);
+         std::vector<double> actual(100, 0.5 + 1.0e-9);
+         if (ok)
+         {
+            ok = x_status.double_array_check
+            (
+               &expected[0], &actual[0], expected.size(), 1.0e-6
+            );
+         }
+         if (ok)
+         {
+            ok = ! x_status.double_array_check
+            (
+               &expected[0], &actual[0], expected.size(), 0.0
+            );
+            show_deliberate_failure(options);
+         }
+         if (ok)
+            ok = x_status.error_count() == 3;
 
          status.pass(ok);
       }
@@ -5726,15 +5899,17 @@ cut_unit_test_03_01 (const xpc::cut_options & options)
  *    initialization function properly zeros or clears all fields to their
  *    "default" values.
  *
+ *    These default values are defined in the unit_test_options.h module in
+ *    the XPC CUT library (libxpccut).
+ *
  * \group
  *    3. xpc::cut_options functions.
  *
  * \case
- *    2. initialize().  Does not exist; this is a place-filler test to
- *       preserve the parallel to the C version of the unit-test.
+ *    1. init().
  *
  * \test
- *    -  xpc::cut_options::initialize()
+ *    -  xpc::cut_options::init()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -5744,131 +5919,32 @@ cut_unit_test_03_01 (const xpc::cut_options & options)
  */
 
 static xpc::cut_status
-cut_unit_test_03_02 (const xpc::cut_options & options)
+cut_unit_test_03_01 (const xpc::cut_options & options)
 {
    xpc::cut_status status
    (
-      options, 3, 2,
-      "xpc::cut_options", "cut_options::initialize()"
+      options, 3, 1,
+      "xpc::cut_options", "cut_options::init()"
    );
    bool ok = status.valid();        /* note that invalidity is /not/ an error */
    if (ok)
    {
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.
+      /**
+       * Note that the 'simulated' option is used in order better
+       * distinguish test output from the real output.  Also note that this
+       * test would be more robust if we set all the values to the opposite
+       * of their default values before calling the xpc::cut_options::init()
+       * function.
        */
 
-      xpc::cut_options x_options;
-      ok = x_options.valid();
-      if (ok)
-      {
-         /*
-          * Now modify the options structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          *
-          * Note that there is no wrapper for * unit_test_options_initialize(),
-          * so we just call each accessor in succession.  In addition, bu
-          * modify all the unparameterized values as well.
-          */
-
-            x_options.is_verbose(! XPCCUT_IS_VERBOSE);
-            x_options.show_values(! XPCCUT_SHOW_VALUES);
-            x_options.use_text_synch(! XPCCUT_TEXT_SYNCH);
-            x_options.show_step_numbers(! XPCCUT_SHOW_STEP_NUMBERS);
-
-         /*
-          * For now, avoid calling this function here:
-          *
-          *   x_options.show_progress(! XPCCUT_SHOW_PROGRESS);
-          *
-          * This has side-effects on multiple structure members, as
-          * discussed in unit_test_options_show_progress_set().
-          *
-          * \todo
-          *   We need a separate test to test the tricky side-effects
-          *   of unit_test_options_show_progress_set().
-          */
-
-            x_options.stop_on_error(! XPCCUT_STOP_ON_ERROR);
-
-         /*
-          * For now, avoid calling this function here:
-          *
-          *   x_options.batch_mode(! XPCCUT_BATCH_MODE);
-          *
-          * This has side-effects on multiple structure members, as
-          * discussed in unit_test_options_batch_mode_set().
-          *
-          * \todo
-          *   We need a separate test to test the tricky side-effects
-          *   of unit_test_options_batch_mode_set().
-          */
-
-            x_options.is_interactive(! XPCCUT_INTERACTIVE);
-            x_options.do_beep(! XPCCUT_BEEP);
-
-          /*
-           * For now, avoid calling this function here:
-           *
-           *   x_options.is_summary(! XPCCUT_SUMMARIZE);
-           *
-           * This has side-effects on multiple structure members, as
-           * discussed in unit_test_options_is_summary_set().
-           *
-           * \todo
-           *   We need a separate test to test the tricky side-effects
-           *   of unit_test_options_is_summary_set().
-           */
-
-            x_options.is_pause(! XPCCUT_CASE_PAUSE);
-            x_options.single_group(XPCCUT_NO_SINGLE_GROUP+1);
-            x_options.single_case(XPCCUT_NO_SINGLE_CASE+2);
-            x_options.single_subtest(XPCCUT_NO_SINGLE_SUB_TEST+3);
-            x_options.test_sleep_time(XPCCUT_TEST_SLEEP_TIME+4);
-
-         /*
-          * These options are included in the parameter list of the C
-          * function unit_test_options_initialize() anyway.  They
-          * are set in that function nonetheless, and the settings here
-          * are the \e opposite of the settings made in that function.
-          */
-
-            x_options.need_subtests(! XPCCUT_NEED_SUBTESTS);
-            x_options.force_failure(! XPCCUT_FORCE_FAILURE);
-            x_options.is_simulated(! false);
-
-         /*
-          * Same here, except these are string-overloads of the integer
-          * versions used just above, and we cannot assign nulls like
-          * unit_test_options_initialize() does.  Instead, we make up some
-          * bogus strings.
-          *
-          * Actually, these will screw up the integer versions set above, so
-          * we will not call them.
-          *
-          * x_options.single_group("Pooh");
-          * x_options.single_case("Pooh");
-          * x_options.single_subtest("Pooh");
-          */
-
-            x_options.current_test(99);
-
-         /*
-          * Same, but I discovered these functions were missing from the C++
-          * wrapper!
-          */
-
-            x_options.prompt_before('q');
-            x_options.prompt_after('q');
-      }
+      xpc::cut_options x_options(XPCCUT_OPTIONS_SIMULATED);
 
       /*  1 */
 
       if (status.next_subtest("Null 'this'"))
       {
          inform(options, _("A null 'this' is not possible in C++ code"));
+         // x_options.is_simulated(true);
          status.pass(true);
       }
 
@@ -5876,23 +5952,22 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("Good 'this'"))
       {
-         status.pass(true);
+         ok = x_options.init();
+         status.pass(ok);
       }
 
       /*  3 */
 
       if (status.next_subtest("is_verbose()"))
       {
-         /*
-          * Rather than use the recent x_status.bool_check()
-          * function, like we did in 03_01 above, we'll leave these tests as
-          * they are.  This shows another way to do the checks, for more
-          * general comparisons or tests.  We don't need no stinkin'
-          * xpc::cut_status member functions to test xpc::cut_options member
-          * functions!
+         /**
+          * We're not going to bother with any apparatus for checking
+          * the C internals for the cut_options class.  We did that for
+          * cut_status class, and we're not sure it really adds value.
+          * Maybe it does, a little, but enough is enough, time to move on!
           */
 
-         ok = x_options.is_verbose() != XPCCUT_IS_VERBOSE;
+         ok = x_options.is_verbose() == XPCCUT_IS_VERBOSE;
          status.pass(ok);
       }
 
@@ -5900,7 +5975,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_values()"))
       {
-         ok = x_options.show_values() != XPCCUT_SHOW_VALUES;
+         ok = x_options.show_values() == XPCCUT_SHOW_VALUES;
          status.pass(ok);
       }
 
@@ -5908,7 +5983,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("use_text_synch()"))
       {
-         ok = x_options.use_text_synch() != XPCCUT_TEXT_SYNCH;
+         ok = x_options.use_text_synch() == XPCCUT_TEXT_SYNCH;
          status.pass(ok);
       }
 
@@ -5916,7 +5991,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_step_numbers()"))
       {
-         ok = x_options.show_step_numbers() != XPCCUT_SHOW_STEP_NUMBERS;
+         ok = x_options.show_step_numbers() == XPCCUT_SHOW_STEP_NUMBERS;
          status.pass(ok);
       }
 
@@ -5924,12 +5999,6 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_progress()"))
       {
-         /*
-          * Note that we decided to not modify this value above (too many
-          * side-effects for this test-case), so here it should have its
-          * default value.
-          */
-
          ok = x_options.show_progress() == XPCCUT_SHOW_PROGRESS;
          status.pass(ok);
       }
@@ -5938,7 +6007,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("stop_on_error()"))
       {
-         ok = x_options.stop_on_error() != XPCCUT_STOP_ON_ERROR;
+         ok = x_options.stop_on_error() == XPCCUT_STOP_ON_ERROR;
          status.pass(ok);
       }
 
@@ -5946,12 +6015,6 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("batch_mode()"))
       {
-         /*
-          * Note that we decided to not modify this value above (too many
-          * side-effects for this test-case), so here it should have its
-          * default value.
-          */
-
          ok = x_options.batch_mode() == XPCCUT_BATCH_MODE;
          status.pass(ok);
       }
@@ -5960,7 +6023,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_interactive()"))
       {
-         ok = x_options.is_interactive() != XPCCUT_INTERACTIVE;
+         ok = x_options.is_interactive() == XPCCUT_INTERACTIVE;
          status.pass(ok);
       }
 
@@ -5968,7 +6031,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("do_beep()"))
       {
-         ok = x_options.do_beep() != XPCCUT_BEEP;
+         ok = x_options.do_beep() == XPCCUT_BEEP;
          status.pass(ok);
       }
 
@@ -5976,12 +6039,6 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_summary()"))
       {
-         /*
-          * Note that we decided to not modify this value above (too many
-          * side-effects for this test-case), so here it should have its
-          * default value.
-          */
-
          ok = x_options.is_summary() == XPCCUT_SUMMARIZE;
          status.pass(ok);
       }
@@ -5990,31 +6047,31 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_pause()"))
       {
-         ok = x_options.is_pause() != XPCCUT_CASE_PAUSE;
+         ok = x_options.is_pause() == XPCCUT_CASE_PAUSE;
          status.pass(ok);
       }
 
       /* 14 */
 
-      if (status.next_subtest("single_group() [integer version]"))
+      if (status.next_subtest("single_group()"))
       {
-         ok = x_options.single_group() == XPCCUT_NO_SINGLE_GROUP+1;
+         ok = x_options.single_group() == XPCCUT_NO_SINGLE_GROUP;
          status.pass(ok);
       }
 
       /* 15 */
 
-      if (status.next_subtest("single_case() [integer version]"))
+      if (status.next_subtest("single_case()"))
       {
-         ok = x_options.single_case() == XPCCUT_NO_SINGLE_CASE+2;
+         ok = x_options.single_case() == XPCCUT_NO_SINGLE_CASE;
          status.pass(ok);
       }
 
       /* 16 */
 
-      if (status.next_subtest("single_subtest [integer version]"))
+      if (status.next_subtest("single_subtest()"))
       {
-         ok = x_options.single_subtest() == XPCCUT_NO_SINGLE_SUB_TEST+3;
+         ok = x_options.single_subtest() == XPCCUT_NO_SINGLE_SUB_TEST;
          status.pass(ok);
       }
 
@@ -6022,7 +6079,7 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("test_sleep_time()"))
       {
-         ok = x_options.test_sleep_time() == XPCCUT_TEST_SLEEP_TIME+4;
+         ok = x_options.test_sleep_time() == XPCCUT_TEST_SLEEP_TIME;
          status.pass(ok);
       }
 
@@ -6030,17 +6087,26 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 
       if (status.next_subtest("need_subtests()"))
       {
-         ok = x_options.need_subtests() != XPCCUT_NEED_SUBTESTS;
+         ok = x_options.need_subtests() == XPCCUT_NEED_SUBTESTS;
          status.pass(ok);
       }
 
       /* 19 */
 
+      if (status.next_subtest("force_failure()"))
+      {
+         ok = x_options.force_failure() == XPCCUT_FORCE_FAILURE;
+         status.pass(ok);
+      }
+
+      /* 20 */
+
       if (status.next_subtest("current_test()"))
       {
-         ok = x_options.current_test() != XPCCUT_NO_CURRENT_TEST;
+         xpc::cut_status x_status;
+         ok = x_options.force_failure() == XPCCUT_FORCE_FAILURE;
          if (ok)
-            ok = x_options.current_test() == 99;
+            ok = x_status.int_check(x_options.current_test(), -1);
 
          status.pass(ok);
       }
@@ -6049,30 +6115,19 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the parse functionality
- *    handles turning off the options.
+ *    Provides a unit/regression test to verify that the basic
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
  *
  * \group
  *    3. xpc::cut_options functions.
  *
  * \case
- *    3. xpc::cut_options principal constructor.  There is no parse() member
- *       wrapper function provided.
+ *    2. initialize().  Does not exist; this is a place-filler test to
+ *       preserve the parallel to the C version of the unit-test.
  *
  * \test
- *    -  xpc::cut_options::cut_options() principal constructor.
- *
- * \note
- *    One thing we discovered (probably due to the latest version of gcc) is
- *    that using \e argv as an array of non-constant character pointers was
- *    considered deprecated.  So we declare a non-standard \e argv.
- *
-\verbatim
-      const char * argv [FULL_ARG_COUNT+1];
-\endverbatim
- *
- *    This, of course, causes some changes to the same parameter in the C++
- *    functions using \e argv.
+ *    -  xpc::cut_options::initialize()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6081,69 +6136,126 @@ cut_unit_test_03_02 (const xpc::cut_options & options)
  *    Returns the unit-test status object needed by the protocol.
  */
 
-#define FULL_ARG_COUNT           24
-
 static xpc::cut_status
-cut_unit_test_03_03 (const xpc::cut_options & options)
+cut_unit_test_03_02 (const xpc::cut_options & options)
 {
    xpc::cut_status status
    (
-      options, 3, 3,
-      "xpc::cut_options", "cut_options::parse() part 1"
+      options, 3, 2,
+      "xpc::cut_options", "cut_options::initialize()"
    );
    bool ok = status.valid();        /* note that invalidity is /not/ an error */
    if (ok)
    {
-      const char * argv[FULL_ARG_COUNT + 1];
-
       /*
        * Start out with default values so that we can take the opposite tack
        * with the full initialization function.
-       *
-       * However, for xcp::cut_options, parsing is only available when the
-       * object is constructed.  Things are simpler this way.
-       *
-       *    ok = x_options.init();
        */
 
-      /**
-       * Creates the cut_options object with the opposite values (or at
-       * least different values) for every accessible field, so that the
-       * resulting test is a bizarro-clone of test 03_01.
-       *
-       * \todo
-       *    There are probable some relatively new option switches that need
-       *    to be tested here.
-       */
+      xpc::cut_options x_options;
+      ok = x_options.valid();
+      if (ok)
+      {
+         /*
+          * Now modify the options structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          *
+          * Note that there is no wrapper for * unit_test_options_initialize(),
+          * so we just call each accessor in succession.  In addition, bu
+          * modify all the unparameterized values as well.
+          */
 
-      argv[0]  = "unit_test_test";              /* application name        */
-      argv[1]  = "--no-verbose";
-      argv[2]  = "--no-show-progress";          /* "--no-silent"           */
-      argv[3]  = "--no-show-values";
-      argv[4]  = "--no-show-step-numbers";
-      argv[5]  = "--no-text-synch";
-      argv[6]  = "--no-stop-on-error";
-      argv[7]  = "--no-batch-mode";
-      argv[8]  = "--no-interactive";
-      argv[9]  = "--no-beeps";
-      argv[10] = "--no-case-pause";
-      argv[11] = "--no-summarize";
-      argv[12] = "--group";
-      argv[13] = "1";
-      argv[14] = "--case";
-      argv[15] = "2";
-      argv[16] = "--sub-test";
-      argv[17] = "3";
-      argv[18] = "--sleep-time";
-      argv[19] = "4";
-      argv[20] = "--no-verbose";
-      argv[21] = "--no-verbose";
-      int argc = 22;                            /* 1 more than last index  */
-      xpc::cut_options x_options
-      (
-         argc, argv,
-         "Test 03.03", "version", "additionalhelp"
-      );
+            x_options.is_verbose(! XPCCUT_IS_VERBOSE);
+            x_options.show_values(! XPCCUT_SHOW_VALUES);
+            x_options.use_text_synch(! XPCCUT_TEXT_SYNCH);
+            x_options.show_step_numbers(! XPCCUT_SHOW_STEP_NUMBERS);
+
+         /*
+          * For now, avoid calling this function here:
+          *
+          *   x_options.show_progress(! XPCCUT_SHOW_PROGRESS);
+          *
+          * This has side-effects on multiple structure members, as
+          * discussed in unit_test_options_show_progress_set().
+          *
+          * \todo
+          *   We need a separate test to test the tricky side-effects
+          *   of unit_test_options_show_progress_set().
+          */
+
+            x_options.stop_on_error(! XPCCUT_STOP_ON_ERROR);
+
+         /*
+          * For now, avoid calling this function here:
+          *
+          *   x_options.batch_mode(! XPCCUT_BATCH_MODE);
+          *
+          * This has side-effects on multiple structure members, as
+          * discussed in unit_test_options_batch_mode_set().
+          *
+          * \todo
+          *   We need a separate test to test the tricky side-effects
+          *   of unit_test_options_batch_mode_set().
+          */
+
+            x_options.is_interactive(! XPCCUT_INTERACTIVE);
+            x_options.do_beep(! XPCCUT_BEEP);
+
+          /*
+           * For now, avoid calling this function here:
+           *
+           *   x_options.is_summary(! XPCCUT_SUMMARIZE);
+           *
+           * This has side-effects on multiple structure members, as
+           * discussed in unit_test_options_is_summary_set().
+           *
+           * \todo
+           *   We need a separate test to test the tricky side-effects
+           *   of unit_test_options_is_summary_set().
+           */
+
+            x_options.is_pause(! XPCCUT_CASE_PAUSE);
+            x_options.single_group(XPCCUT_NO_SINGLE_GROUP+1);
+            x_options.single_case(XPCCUT_NO_SINGLE_CASE+2);
+            x_options.single_subtest(XPCCUT_NO_SINGLE_SUB_TEST+3);
+            x_options.test_sleep_time(XPCCUT_TEST_SLEEP_TIME+4);
+
+         /*
+          * These options are included in the parameter list of the C
+          * function unit_test_options_initialize() anyway.  They
+          * are set in that function nonetheless, and the settings here
+          * are the \e opposite of the settings made in that function.
+          */
+
+            x_options.need_subtests(! XPCCUT_NEED_SUBTESTS);
+            x_options.force_failure(! XPCCUT_FORCE_FAILURE);
+            x_options.is_simulated(! false);
+
+         /*
+          * Same here, except these are string-overloads of the integer
+          * versions used just above, and we cannot assign nulls like
+          * unit_test_options_initialize() does.  Instead, we make up some
+          * bogus strings.
+          *
+          * Actually, these will screw up the integer versions set above, so
+          * we will not call them.
+          *
+          * x_options.single_group("Pooh");
+          * x_options.single_case("Pooh");
+          * x_options.single_subtest("Pooh");
+          */
+
+            x_options.current_test(99);
+
+         /*
+          * Same, but I discovered these functions were missing from the C++
+          * wrapper!
+          */
+
+            x_options.prompt_before('q');
+            x_options.prompt_after('q');
+      }
 
       /*  1 */
 
@@ -6164,7 +6276,16 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_verbose()"))
       {
-         ok = ! x_options.is_verbose();
+         /*
+          * Rather than use the recent x_status.bool_check()
+          * function, like we did in 03_01 above, we'll leave these tests as
+          * they are.  This shows another way to do the checks, for more
+          * general comparisons or tests.  We don't need no stinkin'
+          * xpc::cut_status member functions to test xpc::cut_options member
+          * functions!
+          */
+
+         ok = x_options.is_verbose() != XPCCUT_IS_VERBOSE;
          status.pass(ok);
       }
 
@@ -6172,7 +6293,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_values()"))
       {
-         ok = ! x_options.show_values();
+         ok = x_options.show_values() != XPCCUT_SHOW_VALUES;
          status.pass(ok);
       }
 
@@ -6180,7 +6301,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("use_text_synch()"))
       {
-         ok = ! x_options.use_text_synch();
+         ok = x_options.use_text_synch() != XPCCUT_TEXT_SYNCH;
          status.pass(ok);
       }
 
@@ -6188,7 +6309,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_step_numbers()"))
       {
-         ok = ! x_options.show_step_numbers();
+         ok = x_options.show_step_numbers() != XPCCUT_SHOW_STEP_NUMBERS;
          status.pass(ok);
       }
 
@@ -6196,7 +6317,13 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("show_progress()"))
       {
-         ok = ! x_options.show_progress();
+         /*
+          * Note that we decided to not modify this value above (too many
+          * side-effects for this test-case), so here it should have its
+          * default value.
+          */
+
+         ok = x_options.show_progress() == XPCCUT_SHOW_PROGRESS;
          status.pass(ok);
       }
 
@@ -6204,7 +6331,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("stop_on_error()"))
       {
-         ok = ! x_options.stop_on_error();
+         ok = x_options.stop_on_error() != XPCCUT_STOP_ON_ERROR;
          status.pass(ok);
       }
 
@@ -6212,7 +6339,13 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("batch_mode()"))
       {
-         ok = ! x_options.batch_mode();
+         /*
+          * Note that we decided to not modify this value above (too many
+          * side-effects for this test-case), so here it should have its
+          * default value.
+          */
+
+         ok = x_options.batch_mode() == XPCCUT_BATCH_MODE;
          status.pass(ok);
       }
 
@@ -6220,7 +6353,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_interactive()"))
       {
-         ok = ! x_options.is_interactive();
+         ok = x_options.is_interactive() != XPCCUT_INTERACTIVE;
          status.pass(ok);
       }
 
@@ -6228,7 +6361,7 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("do_beep()"))
       {
-         ok = ! x_options.do_beep();
+         ok = x_options.do_beep() != XPCCUT_BEEP;
          status.pass(ok);
       }
 
@@ -6236,7 +6369,13 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_summary()"))
       {
-         ok = ! x_options.is_summary();
+         /*
+          * Note that we decided to not modify this value above (too many
+          * side-effects for this test-case), so here it should have its
+          * default value.
+          */
+
+         ok = x_options.is_summary() == XPCCUT_SUMMARIZE;
          status.pass(ok);
       }
 
@@ -6244,7 +6383,261 @@ cut_unit_test_03_03 (const xpc::cut_options & options)
 
       if (status.next_subtest("is_pause()"))
       {
-         ok = ! x_options.is_pause();
+         ok = x_options.is_pause() != XPCCUT_CASE_PAUSE;
+         status.pass(ok);
+      }
+
+      /* 14 */
+
+      if (status.next_subtest("single_group() [integer version]"))
+      {
+         ok = x_options.single_group() == XPCCUT_NO_SINGLE_GROUP+1;
+         status.pass(ok);
+      }
+
+      /* 15 */
+
+      if (status.next_subtest("single_case() [integer version]"))
+      {
+         ok = x_options.single_case() == XPCCUT_NO_SINGLE_CASE+2;
+         status.pass(ok);
+      }
+
+      /* 16 */
+
+      if (status.next_subtest("single_subtest [integer version]"))
+      {
+         ok = x_options.single_subtest() == XPCCUT_NO_SINGLE_SUB_TEST+3;
+         status.pass(ok);
+      }
+
+      /* 17 */
+
+      if (status.next_subtest("test_sleep_time()"))
+      {
+         ok = x_options.test_sleep_time() == XPCCUT_TEST_SLEEP_TIME+4;
+         status.pass(ok);
+      }
+
+      /* 18 */
+
+      if (status.next_subtest("need_subtests()"))
+      {
+         ok = x_options.need_subtests() != XPCCUT_NEED_SUBTESTS;
+         status.pass(ok);
+      }
+
+      /* 19 */
+
+      if (status.next_subtest("current_test()"))
+      {
+         ok = x_options.current_test() != XPCCUT_NO_CURRENT_TEST;
+         if (ok)
+            ok = x_options.current_test() == 99;
+
+         status.pass(ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the parse functionality
+ *    handles turning off the options.
+ *
+ * \group
+ *    3. xpc::cut_options functions.
+ *
+ * \case
+ *    3. xpc::cut_options principal constructor.  There is no parse() member
+ *       wrapper function provided.
+ *
+ * \test
+ *    -  xpc::cut_options::cut_options() principal constructor.
+ *
+ * \note
+ *    One thing we discovered (probably due to the latest version of gcc) is
+ *    that using \e argv as an array of non-constant character pointers was
+ *    considered deprecated.  So we declare a non-standard \e argv.
+ *
+\verbatim
+      const char * argv [FULL_ARG_COUNT+1];
+\endverbatim
+ *
+ *    This, of course, causes some changes to the same parameter in the C++
+ *    functions using \e argv.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+#define FULL_ARG_COUNT           24
+
+static xpc::cut_status
+cut_unit_test_03_03 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 3, 3,
+      "xpc::cut_options", "cut_options::parse() part 1"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      const char * argv[FULL_ARG_COUNT + 1];
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.
+       *
+       * However, for xcp::cut_options, parsing is only available when the
+       * object is constructed.  Things are simpler this way.
+       *
+       *    ok = x_options.init();
+       */
+
+      /**
+       * Creates the cut_options object with the opposite values (or at
+       * least different values) for every accessible field, so that the
+       * resulting test is a bizarro-clone of test 03_01.
+       *
+       * \todo
+       *    There are probable some relatively new option switches that need
+       *    to be tested here.
+       */
+
+      argv[0]  = "unit_test_test";              /* application name        */
+      argv[1]  = "--no-verbose";
+      argv[2]  = "--no-show-progress";          /* "--no-silent"           */
+      argv[3]  = "--no-show-values";
+      argv[4]  = "--no-show-step-numbers";
+      argv[5]  = "--no-text-synch";
+      argv[6]  = "--no-stop-on-error";
+      argv[7]  = "--no-batch-mode";
+      argv[8]  = "--no-interactive";
+      argv[9]  = "--no-beeps";
+      argv[10] = "--no-case-pause";
+      argv[11] = "--no-summarize";
+      argv[12] = "--group";
+      argv[13] = "1";
+      argv[14] = "--case";
+      argv[15] = "2";
+      argv[16] = "--sub-test";
+      argv[17] = "3";
+      argv[18] = "--sleep-time";
+      argv[19] = "4";
+      argv[20] = "--no-verbose";
+      argv[21] = "--no-verbose";
+      int argc = 22;                            /* 1 more than last index  */
+      xpc::cut_options x_options
+      (
+         argc, argv,
+         "Test 03.03", "version", "additionalhelp"
+      );
+
+      /*  1 */
+
+      if (status.next_subtest("Null 'this'"))
+      {
+         inform(options, _("A null 'this' is not possible in C++ code"));
+         status.pass(true);
+      }
+
+      /*  2 */
+
+      if (status.next_subtest("Good 'this'"))
+      {
+         status.pass(true);
+      }
+
+      /*  3 */
+
+      if (status.next_subtest("is_verbose()"))
+      {
+         ok = ! x_options.is_verbose();
+         status.pass(ok);
+      }
+
+      /*  4 */
+
+      if (status.next_subtest("show_values()"))
+      {
+         ok = ! x_options.show_values();
+         status.pass(ok);
+      }
+
+      /*  5 */
+
+      if (status.next_subtest("use_text_synch()"))
+      {
+         ok = ! x_options.use_text_synch();
+         status.pass(ok);
+      }
+
+      /*  6 */
+
+      if (status.next_subtest("show_step_numbers()"))
+      {
+         ok = ! x_options.show_step_numbers();
+         status.pass(ok);
+      }
+
+      /*  7 */
+
+      if (status.next_subtest("show_progress()"))
+      {
+         ok = ! x_options.show_progress();
+         status.pass(ok);
+      }
+
+      /*  8 */
+
+      if (status.next_subtest("stop_on_error()"))
+      {
+         ok = ! x_options.stop_on_error();
+         status.pass(ok);
+      }
+
+      /*  9 */
+
+      if (status.next_subtest("batch_mode()"))
+      {
+         ok = ! x_options.batch_mode();
+         status.pass(ok);
+      }
+
+      /* 10 */
+
+      if (status.next_subtest("is_interactive()"))
+      {
+         ok = ! x_options.is_interactive();
+         status.pass(ok);
+      }
+
+      /* 11 */
+
+      if (status.next_subtest("do_beep()"))
+      {
+         ok = ! x_options.do_beep();
+         status.pass(ok);
+      }
+
+      /* 12 */
+
+      if (status.next_subtest("is_summary()"))
+      {
+         ok = ! x_options.is_summary();
+         status.pass(ok);
+      }
+
+      /* 13 */
+
+      if (status.next_subtest("is_pause()"))
+      {
+         ok = ! x_options.is_pause();
          status.pass(ok);
       }
 
@@ -9653,8 +10046,129 @@ cut_unit_test_03_28 (const xpc::cut_options & options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the basic "default"
- *    initialization function properly zeros or clears all fields to their
+ *    Provides a unit/regression test to verify the view constructor of
+ *    xpc::cut_options, which lets the tests share the options of a run
+ *    without copying them.
+ *
+ * \group
+ *
+ *    xpc::cut_options functions.
+ *
+ * \test
+ *    -  xpc::cut_options::cut_options(const unit_test_options_t &)
+ *    -  xpc::cut_options::is_view()
+ *    -  xpc::cut_options::writable()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_03_29 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 3, 29, "xpc::cut_options", "cut_options view"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      unit_test_options_t shared;
+      ok = xpccut_boolcast(unit_test_options_init(&shared));
+      if (ok)
+      {
+         ok = xpccut_boolcast
+         (
+            unit_test_options_show_progress_set(&shared, false)
+         );
+      }
+
+      /*  1 */
+
+      if (status.next_subtest("Options of the test"))
+      {
+         /*
+          * xpc::cut::run() hands each test a view of the shared options.
+          */
+
+         ok = options.is_view();
+         status.pass(ok);
+      }
+
+      /*  2 */
+
+      if (status.next_subtest("View reads in place"))
+      {
+         xpc::cut_options x_options(shared);
+         ok = x_options.valid() && x_options.is_view();
+         if (ok)
+            ok = ! x_options.show_progress();
+
+         if (ok)
+         {
+            (void) unit_test_options_show_values_set(&shared, true);
+            ok = x_options.show_values();          /* sees the change    */
+            (void) unit_test_options_show_values_set(&shared, false);
+         }
+         status.pass(ok);
+      }
+
+      /*  3 */
+
+      if (status.next_subtest("Copies of a view"))
+      {
+         xpc::cut_options x_options(shared);
+         xpc::cut_options x_copy(x_options);
+         xpc::cut_options x_assigned;
+         x_assigned = x_options;
+         ok = x_copy.is_view() && x_assigned.is_view();
+         if (ok)
+         {
+            (void) unit_test_options_show_values_set(&shared, true);
+            ok = x_copy.show_values() && x_assigned.show_values();
+            (void) unit_test_options_show_values_set(&shared, false);
+         }
+         status.pass(ok);
+      }
+
+      /*  4 */
+
+      if (status.next_subtest("Setter makes a copy"))
+      {
+         xpc::cut_options x_options(shared);
+         x_options.show_values(true);
+         ok = ! x_options.is_view();
+         if (ok)
+            ok = x_options.show_values();
+
+         if (ok)
+            ok = ! xpccut_boolcast(unit_test_options_show_values(&shared));
+
+         if (ok)
+            ok = ! x_options.show_progress();      /* the copy kept it   */
+
+         if (ok)
+         {
+            xpc::cut_options x_copy(x_options);
+            ok = ! x_copy.is_view() && x_copy.show_values();
+            if (ok)
+            {
+               x_options.show_values(false);       /* the copy is its own */
+               ok = x_copy.show_values();
+            }
+         }
+         status.pass(ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the basic "default"
+ *    initialization function properly zeros or clears all fields to their
  *    "default" values.
  *
  *    The function tested is like a "C" version of a "C++" default
@@ -9739,9 +10253,9 @@ cut_unit_test_04_01 (const xpc::cut_options & options)
             ok = strlen(x_test_x.m_Additional_Help) > 0;
             if (ok && options.is_verbose())
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  %s:\n{\n%s\n}\n",
+                  "  %s:\n{\n%s\n}\n",
                   _("The allocated help text is"),
                   x_test_x.m_Additional_Help
                );
@@ -9781,9 +10295,9 @@ cut_unit_test_04_01 (const xpc::cut_options & options)
 
             if (ok && options.is_verbose())
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  %s:\n{\n%s\n}\n",
+                  "  %s:\n{\n%s\n}\n",
                   _("The allocated help text is"),
                   x_test_x.m_Additional_Help
                );
@@ -10624,9 +11138,9 @@ cut_unit_test_04_05 (const xpc::cut_options & options)
                {
                   if (! xpccut_is_silent())
                   {
-                     fprintf
+                     xpccut_print
                      (
-                        stdout, "%s %d %s %d\n",
+                        "%s %d %s %d\n",
                         _("load failed at count"), x_test_x.m_Test_Count,
                         _("and allocation"), x_test_x.m_Allocation_Count
                      );
@@ -10660,9 +11174,9 @@ cut_unit_test_04_05 (const xpc::cut_options & options)
                {
                   if (! xpccut_is_silent())
                   {
-                     fprintf
+                     xpccut_print
                      (
-                        stdout, "%s %d %s %d\n",
+                        "%s %d %s %d\n",
                         _("load failed at count"), x_test_x.m_Test_Count,
                         _("and allocation"), x_test_x.m_Allocation_Count
                      );
@@ -10764,9 +11278,9 @@ cut_unit_test_04_06 (const xpc::cut_options & options)
                {
                   if (! xpccut_is_silent())
                   {
-                     fprintf
+                     xpccut_print
                      (
-                        stdout, "%s %d\n",
+                        "%s %d\n",
                         _("load failed at count"), x_test_x.m_Test_Count
                      );
                   }
@@ -10987,9 +11501,9 @@ cut_unit_test_04_08 (const xpc::cut_options & options)
                {
                   if (! xpccut_is_silent())
                   {
-                     fprintf
+                     xpccut_print
                      (
-                        stdout, "%s %d\n",
+                        "%s %d\n",
                         _("load failed at count"), unit_test_count(&x_test_x)
                      );
                   }
@@ -11104,9 +11618,9 @@ cut_unit_test_04_09 (const xpc::cut_options & options)
                {
                   if (! xpccut_is_silent())
                   {
-                     fprintf
+                     xpccut_print
                      (
-                        stdout, "%s %d\n",
+                        "%s %d\n",
                         _("load failed at count"), x_test_x.m_Test_Count
                      );
                   }
@@ -11319,9 +11833,9 @@ cut_unit_test_04_10 (const xpc::cut_options & options)
                   {
                      if (! xpccut_is_silent())
                      {
-                        fprintf
+                        xpccut_print
                         (
-                           stdout, "%s %d\n", _("test failed at count"), ti
+                           "%s %d\n", _("test failed at count"), ti
                         );
                      }
                      break;
@@ -11358,7 +11872,7 @@ cut_unit_test_04_10 (const xpc::cut_options & options)
                if (! ok)
                {
                   if (! xpccut_is_silent())
-                     fprintf(stdout, "  %s == %d\n", _("time counter"), ti);
+                     xpccut_print("  %s == %d\n", _("time counter"), ti);
                }
             }
          }
@@ -13310,22 +13824,3066 @@ cut_unit_test_05_04 (const xpc::cut_options & options)
       status.pass(true);
       if (options.is_verbose())
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "  %s\n",
+            "  %s\n",
             _("You will see this message only if you didn't answer 'q' before")
          );
       }
-      if (status.next_subtest(_("Continuation test")))
-         (void) unit_test_status_prompt(&status, _("Answer as you wish"));
+      if (status.next_subtest(_("Continuation test")))
+         (void) unit_test_status_prompt(&status, _("Answer as you wish"));
+   }
+   return status;
+}
+
+/**
+ *    Recapitulates cut_unit_test_01_01().
+ *    Why?  To make it easy to check up on some aspects of the --summarize
+ *    option.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_06_01 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 6, 1, _("xpccut"), _("01.01 Smoke Test Recap")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         if (unit_test_options_show_values(options))
+            xpccut_print("  %s\n", _("No values to show in this test"));
+
+         /*  1 */
+
+         if (status.next_subtest("unit_test_status_pass()"))
+         {
+            status.pass(true);
+            ok =
+            (
+               (status.m_Subtest_Error_Count == 0) &&
+               (status.m_Failed_Subtest == 0)
+            );
+            if (! ok)
+            {
+               (void) status.fail();    /* create a failure  */
+               if (options.is_verbose())
+               {
+                  xpccut_print_error
+                  (
+                     "%s %s\n",
+                     "unit_test_status_pass()", _("internal failure")
+                  );
+               }
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if
+         (
+            ok &&
+            status.next_subtest("unit_test_status_fail()")
+         )
+         {
+            ok = status.fail_deliberately();
+            if (ok)
+            {
+               ok =
+               (
+                  (status.m_Subtest_Error_Count == 1) &&
+                  (status.m_Failed_Subtest == 2)
+               );
+               status.pass(ok); /* convert it to a "pass"  */
+               if (ok)
+               {
+                  status.m_Subtest_Error_Count--;  /* direct access (bad) !!! */
+                  status.m_Failed_Subtest = 0;     /* direct access (bad) !!! */
+               }
+            }
+         }
+         /*
+          * A useless visual check.
+          *
+          * if (ok)
+          *    xpccut_ms_sleep(500);               // a visual duration check
+          */
+      }
+   }
+   return status;
+}
+
+#endif      // #if 0
+
+/**
+ *    Provides tests of some of the macros, so we can verify they are being
+ *    defined properly.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    1. cut_not_nullptr() and cut_is_nullptr() macros.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_07_01 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 7, 1, _("xpccut"), _("cut_xxx_nullptr() tests")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         const char * good = "allo";
+         const char * bad = nullptr;
+
+         /*  1 */
+
+         if (status.next_subtest("cut_not_nullptr()"))
+         {
+#ifdef XPC_NO_NULLPTR
+            ok = cut_not_nullptr(good) == true;
+            if (ok)
+               ok = cut_not_nullptr(bad) == true;
+#else
+            ok = cut_not_nullptr(good) == true;
+            if (ok)
+               ok = cut_not_nullptr(bad) == false;
+#endif
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut_not_nullptr()"))
+         {
+#ifdef XPC_NO_NULLPTR
+            ok = cut_is_nullptr(good) == false;
+            if (ok)
+               ok = cut_is_nullptr(bad) == false;
+#else
+            ok = cut_is_nullptr(good) == false;
+            if (ok)
+               ok = cut_is_nullptr(bad) == true;
+#endif
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_01().
+ *    This function passes, and calls next_subtest() once.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_01 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 1, _("Unit-test fake run"), _("cut::run() with jobs")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Do-nothing test"))
+         status.pass(true);
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_01().
+ *    This function always fails.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_01_fail (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 2, _("Unit-test fake fail"), _("cut::run() with jobs")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Deliberate failure"))
+         status.pass(false);
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of running the C++ unit-tests on a pool of worker
+ *    threads.
+ *
+ * \group
+ *    8. xpc::cut extensions.
+ *
+ * \case
+ *    1. The --jobs option.
+ *
+ * \test
+ *    -  xpc::cut_options::job_count()
+ *    -  xpc::cut::run() [with --jobs]
+ *    -  xpc::cut::job_runner() [indirectly]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_08_01 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 1, _("xpc::cut"), _("--jobs")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_white_box cwb;
+
+         /*  1 */
+
+         if (status.next_subtest("cut_options::job_count()"))
+         {
+            xpc::cut_options x_options(true);
+            ok = x_options.job_count() == XPCCUT_JOB_COUNT;
+            if (ok)
+            {
+               x_options.job_count(4);
+               ok = x_options.job_count() == 4;
+            }
+            if (ok)
+            {
+               x_options.job_count(XPCCUT_JOBS_MAX + 1);
+               ok = x_options.job_count() == XPCCUT_JOB_COUNT;
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut::run() with jobs"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               const_cast<char *>("--jobs"),
+               const_cast<char *>("4"),
+               nullptr
+            };
+            xpc::cut x_cut(4, argv, "Test 08.01.2");
+            ok = x_cut.valid();
+            for (int i = 0; i < 9; ++i)
+            {
+               if (ok)
+               {
+                  if (i == 2 || i == 5)
+                     ok = x_cut.load(fake_cut_unit_test_08_01_fail);
+                  else
+                     ok = x_cut.load(fake_cut_unit_test_08_01);
+               }
+            }
+            for (int run = 0; run < 4; ++run)    /* must not vary by run    */
+            {
+               if (ok)
+                  ok = ! x_cut.run();
+
+               if (ok)
+                  ok = cwb.Cut_Failures(x_cut) == 2;
+
+               if (ok)
+                  ok = cwb.Cut_First_Failed_Test(x_cut) == 2;
+
+               if (ok)
+                  ok = cwb.Cut_First_Failed_Case(x_cut) == 2;
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_02().
+ *    This function crashes, unless it is told to pass.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol, but only
+ *    if the test is not isolated.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_02_crash (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 3, _("Unit-test fake crash"), _("cut::run() isolated")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Deliberate crash"))
+      {
+         if (options.is_isolated())
+            std::abort();
+
+         status.pass(true);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of running the C++ unit-tests each in a child process
+ *    of its own.
+ *
+ * \group
+ *    8. xpc::cut extensions.
+ *
+ * \case
+ *    2. The --isolate and --test-timeout options.
+ *
+ * \test
+ *    -  xpc::cut_options::is_isolated()
+ *    -  xpc::cut_options::test_timeout()
+ *    -  xpc::cut::run() [with --isolate]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_08_02 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 2, _("xpc::cut"), _("--isolate")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_white_box cwb;
+
+         /*  1 */
+
+         if (status.next_subtest("cut_options::is_isolated()"))
+         {
+            xpc::cut_options x_options(true);
+            ok = x_options.is_isolated() == bool(XPCCUT_IS_ISOLATED);
+            if (ok)
+            {
+               x_options.is_isolated(true);
+               ok = x_options.is_isolated();
+            }
+            if (ok)
+            {
+               x_options.test_timeout(500);
+               ok = x_options.test_timeout() == 500;
+            }
+            if (ok)
+            {
+               x_options.test_timeout(-1);
+               ok = x_options.test_timeout() == XPCCUT_TEST_TIMEOUT;
+            }
+            status.pass(ok);
+         }
+
+#if XPC_HAVE_UNISTD_H && XPC_HAVE_SYS_WAIT_H && XPC_HAVE_POLL_H && \
+ ! defined WIN32
+
+         /*  2 */
+
+         if (status.next_subtest("cut::run() isolated"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               const_cast<char *>("--isolate"),
+               const_cast<char *>("--jobs"),
+               const_cast<char *>("2"),
+               nullptr
+            };
+            xpc::cut x_cut(5, argv, "Test 08.02.2");
+            ok = x_cut.valid();
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_01);
+
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_02_crash);
+
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_01_fail);
+
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_01);
+
+            if (ok)
+            {
+               bool silent = xpccut_is_silent();
+               xpccut_silence_printing();    /* hide the failure messages  */
+               ok = ! x_cut.run();
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            if (ok)
+               ok = cwb.Cut_Failures(x_cut) == 2;
+
+            if (ok)
+               ok = cwb.Cut_First_Failed_Test(x_cut) == 1;
+
+            status.pass(ok);
+         }
+
+#endif
+
+      }
+   }
+   return status;
+}
+
+
+/**
+ *    Provides a test of running the C++ unit-tests as shards.
+ *
+ * \group
+ *    8. xpc::cut extensions.
+ *
+ * \case
+ *    3. The --shard-count and --shard-index options.
+ *
+ * \test
+ *    -  xpc::cut_options::shard_count()
+ *    -  xpc::cut_options::shard_index()
+ *    -  xpc::cut_options::shard_mode()
+ *    -  xpc::cut_options::durations_file()
+ *    -  xpc::cut_options::save_durations_file()
+ *    -  xpc::cut::run() [with --shard-count]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_08_03 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 3, _("xpc::cut"), _("--shard-count")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_white_box cwb;
+
+         /*  1 */
+
+         if (status.next_subtest("cut_options shard accessors"))
+         {
+            xpc::cut_options x_options(true);
+            ok = x_options.shard_count() == XPCCUT_SHARD_COUNT;
+            if (ok)
+               ok = x_options.shard_index() == XPCCUT_SHARD_INDEX;
+
+            if (ok)
+               ok = x_options.shard_mode() == XPCCUT_SHARD_MODE;
+
+            if (ok)
+               ok = x_options.durations_file().empty();
+
+            if (ok)
+               ok = x_options.save_durations_file().empty();
+
+            if (ok)
+            {
+               x_options.shard_count(4);
+               x_options.shard_index(3);
+               x_options.shard_mode(XPCCUT_SHARD_BY_HASH);
+               x_options.durations_file("in.dur");
+               x_options.save_durations_file("out.dur");
+               ok = x_options.shard_count() == 4;
+            }
+            if (ok)
+               ok = x_options.shard_index() == 3;
+
+            if (ok)
+               ok = x_options.shard_mode() == XPCCUT_SHARD_BY_HASH;
+
+            if (ok)
+               ok = x_options.durations_file() == "in.dur";
+
+            if (ok)
+               ok = x_options.save_durations_file() == "out.dur";
+
+            if (ok)
+            {
+               x_options.shard_count(0);
+               ok = x_options.shard_count() == XPCCUT_SHARD_COUNT;
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut::run() sharded"))
+         {
+            int total = 0;
+            for (int shard = 0; shard < 2; ++shard)
+            {
+               char index[12];
+               char * argv[] =
+               {
+                  const_cast<char *>("cut_unit_test"),
+                  const_cast<char *>("--no-show-progress"),
+                  const_cast<char *>("--shard-count"),
+                  const_cast<char *>("2"),
+                  const_cast<char *>("--shard-index"),
+                  index,
+                  nullptr
+               };
+               (void) std::snprintf(index, sizeof index, "%d", shard);
+               xpc::cut x_cut(6, argv, "Test 08.03.2");
+               ok = x_cut.valid();
+               for (int i = 0; i < 5; ++i)
+               {
+                  if (ok)
+                     ok = x_cut.load(fake_cut_unit_test_08_01);
+               }
+               if (ok)
+               {
+                  bool silent = xpccut_is_silent();
+                  xpccut_silence_printing();    /* hide the SHARD summary  */
+                  ok = x_cut.run();
+                  if (! silent)
+                     xpccut_allow_printing();
+               }
+               if (ok)
+                  ok = cwb.Cut_Run_Count(x_cut) == (shard == 0 ? 3 : 2);
+
+               if (ok)
+                  total += cwb.Cut_Run_Count(x_cut);
+               else
+                  break;
+            }
+            if (ok)
+               ok = total == 5;
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Counts the calls to fake_cut_unit_test_08_04().
+ */
+
+static int gs_calls_08_04 = 0;
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_04().
+ *    This function counts its calls, and passes.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_04 (const xpc::cut_options & options)
+{
+   ++gs_calls_08_04;
+   xpc::cut_status status(options, 8, 4, "xpc::cut fake", "counted");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Counted test"))
+         status.pass(true);
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of loading C++ unit-tests with their group and case
+ *    information, so that filtered tests are not called.
+ *
+ * \group
+ *    8. xpc::cut extensions.
+ *
+ * \case
+ *    4. xpc::cut::load() with group and case information.
+ *
+ * \test
+ *    -  xpc::cut::load() [with group and case information]
+ *    -  xpc::cut::run() [with a --case filter]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+cut_unit_test_08_04 (const xpc::cut_options & options)
+{
+   xpc::cut_status status
+   (
+      options, 8, 4, _("xpc::cut"), _("cut::load() with information")
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("cut::load() bad information"))
+         {
+            xpc::cut x_cut;
+            bool silent = xpccut_is_silent();
+            xpccut_silence_printing();       /* hide the error messages    */
+            ok = ! x_cut.load(fake_cut_unit_test_08_04, 0, 4, "a", "b");
+            if (ok)
+               ok = ! x_cut.load(fake_cut_unit_test_08_04, 8, 4, nullptr, "b");
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut::run() filtered"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               const_cast<char *>("--case"),
+               const_cast<char *>("5"),
+               nullptr
+            };
+            xpc::cut x_cut(4, argv, "Test 08.04.2");
+            ok = x_cut.valid();
+            if (ok)
+            {
+               ok = x_cut.load
+               (
+                  fake_cut_unit_test_08_04, 8, 4, "xpc::cut fake", "counted"
+               );
+            }
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_04);   /* no information */
+
+            if (ok)
+            {
+               gs_calls_08_04 = 0;
+               ok = x_cut.run();
+            }
+            if (ok)
+               ok = gs_calls_08_04 == 1;     /* only the unregistered one  */
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the registry of tests declared with the
+ *    XPC_CUT_TEST() macro.  This test is itself declared that way, and is
+ *    loaded by cut::load_registered() in main().
+ *
+ * \group
+ *    8. xpc::cut extensions.
+ *
+ * \case
+ *    5. XPC_CUT_TEST() and cut::load_registered().
+ *
+ * \test
+ *    -  xpc::cut_registrar
+ *    -  xpc::cut::load_registered()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST(cut_unit_test_08_05, 8, 5, "xpc::cut", "XPC_CUT_TEST()")
+{
+   xpc::cut_status status
+   (
+      options, 8, 5, "xpc::cut", "XPC_CUT_TEST()"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_white_box cwb;
+
+         /*  1 */
+
+         if (status.next_subtest("cut_registrar list"))
+         {
+            int count = 0;
+            bool found = false;
+            for
+            (
+               const xpc::cut_registrar * r = xpc::cut_registrar::first();
+               r != nullptr;
+               r = r->next()
+            )
+            {
+               ++count;
+               if (r->test() == cut_unit_test_08_05)
+               {
+                  found = r->group() == 8 && r->test_case() == 5 &&
+                     std::string(r->case_name()) == "XPC_CUT_TEST()";
+               }
+            }
+            ok = found;
+            if (ok)
+               ok = count == xpc::cut_registrar::count();
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut::load_registered()"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               const_cast<char *>("--case"),
+               const_cast<char *>("99"),
+               nullptr
+            };
+            xpc::cut x_cut(4, argv, "Test 08.05.2");
+            ok = x_cut.valid();
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_08_01);
+
+            if (ok)
+               ok = x_cut.load_registered();
+
+            if (ok)
+               ok = cwb.Cut_Count(x_cut) == 1 + xpc::cut_registrar::count();
+
+            if (ok)
+               ok = x_cut.run();             /* nothing is called here     */
+
+            if (ok)
+               ok = cwb.Cut_Run_Count(x_cut) == 0;
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Holds the counts kept by the fixture functions and the fake tests of
+ *    cut_unit_test_08_06().
+ */
+
+struct fixture_counts_08_06
+{
+   int m_Setups;                    /**< The calls to the setup function.     */
+   int m_Teardowns;                 /**< The calls to the teardown function.  */
+   int m_Uses;                      /**< The fake tests that saw the fixture. */
+   bool m_Fail_Setup;               /**< Makes the setup function fail.       */
+};
+
+/**
+ *    Provides the counts for cut_unit_test_08_06().
+ */
+
+static fixture_counts_08_06 s_Counts_08_06;
+
+/**
+ *    Provides a setup function for cut_unit_test_08_06().  The shared
+ *    state is the s_Counts_08_06 structure.
+ *
+ * \return
+ *    Returns 'true', unless the m_Fail_Setup flag is set.
+ */
+
+static cbool_t
+fixture_setup_08_06 (void ** data)
+{
+   ++s_Counts_08_06.m_Setups;
+   *data = &s_Counts_08_06;
+   return s_Counts_08_06.m_Fail_Setup ? false : true ;
+}
+
+/**
+ *    Provides a teardown function for cut_unit_test_08_06().
+ */
+
+static void
+fixture_teardown_08_06 (void * data)
+{
+   if (data == &s_Counts_08_06)
+      ++s_Counts_08_06.m_Teardowns;
+}
+
+/**
+ *    Registers a fixture for a group that no loaded test is in, so that the
+ *    registry can be checked without the fixture being set up.
+ */
+
+XPC_CUT_FIXTURE(fixture_08_06, 97, fixture_setup_08_06, fixture_teardown_08_06);
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_06().  It passes if
+ *    it gets the shared state of the fixture of its group.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_06 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 98, 1, "Fixture group", "Fixture user");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Shared state"))
+      {
+         fixture_counts_08_06 * counts =
+            static_cast<fixture_counts_08_06 *>(xpc::cut::fixture_data());
+
+         ok = counts == &s_Counts_08_06;
+         if (ok)
+            ++counts->m_Uses;
+
+         status.pass(ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Loads three copies of fake_cut_unit_test_08_06() into group 98 of a
+ *    cut object, along with the fixture of the group, and runs them.
+ *
+ * \return
+ *    Returns the result of cut::run(), or 'false' if the loading failed.
+ */
+
+static bool
+run_fixture_group_08_06 (int argc, char * argv [], const char * name)
+{
+   xpc::cut x_cut(argc, argv, name);
+   bool result = x_cut.valid();
+   s_Counts_08_06.m_Setups = 0;
+   s_Counts_08_06.m_Teardowns = 0;
+   s_Counts_08_06.m_Uses = 0;
+   if (result)
+   {
+      result = x_cut.load_fixture
+      (
+         98, fixture_setup_08_06, fixture_teardown_08_06
+      );
+   }
+   for (int c = 1; result && c <= 3; ++c)
+   {
+      result = x_cut.load
+      (
+         fake_cut_unit_test_08_06, 98, c, "Fixture group", "Fixture user"
+      );
+   }
+   if (result)
+      result = x_cut.run();
+
+   return result;
+}
+
+/**
+ *    Provides a test of the group-level fixtures loaded by
+ *    cut::load_fixture() and XPC_CUT_FIXTURE().
+ *
+ * \group
+ *    8. xpc::cut.
+ *
+ * \case
+ *    6. Group fixtures.
+ *
+ * \test
+ *    -  xpc::cut::load_fixture()
+ *    -  xpc::cut::fixture_data()
+ *    -  xpc::cut_fixture_registrar
+ *    -  unit_test_fixture_enter()
+ *    -  unit_test_fixture_leave()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_08_06, 8, 6, "xpc::cut", "Group fixtures")
+{
+   xpc::cut_status status
+   (
+      options, 8, 6, "xpc::cut", "Group fixtures"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         char * argv[] =
+         {
+            const_cast<char *>("cut_unit_test"),
+            const_cast<char *>("--no-show-progress"),
+            const_cast<char *>("--group"),
+            const_cast<char *>("98"),
+            const_cast<char *>("--jobs"),
+            const_cast<char *>("2"),
+            nullptr
+         };
+         s_Counts_08_06.m_Fail_Setup = false;
+
+         /*  1 */
+
+         if (status.next_subtest("One setup for the group"))
+         {
+            ok = run_fixture_group_08_06(2, argv, "Test 08.06.1");
+            if (ok)
+               ok = s_Counts_08_06.m_Setups == 1;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Uses == 3;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Teardowns == 1;
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Group filtered out"))
+         {
+            argv[3] = const_cast<char *>("97");
+            ok = run_fixture_group_08_06(4, argv, "Test 08.06.2");
+            argv[3] = const_cast<char *>("98");
+            if (ok)
+               ok = s_Counts_08_06.m_Setups == 0;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Uses == 0;
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Failed setup"))
+         {
+            bool silent = xpccut_is_silent() ? true : false ;
+            xpccut_silence_printing();          /* hide the setup error    */
+            s_Counts_08_06.m_Fail_Setup = true;
+            ok = ! run_fixture_group_08_06(4, argv, "Test 08.06.3");
+            s_Counts_08_06.m_Fail_Setup = false;
+            if (! silent)
+               xpccut_allow_printing();
+
+            if (ok)
+               ok = s_Counts_08_06.m_Setups == 1;  /* not tried again     */
+
+            if (ok)
+               ok = s_Counts_08_06.m_Uses == 0;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Teardowns == 0;
+
+            status.pass(ok);
+         }
+
+         /*  4 */
+
+         if (status.next_subtest("Shared by the --jobs workers"))
+         {
+            ok = run_fixture_group_08_06(6, argv, "Test 08.06.4");
+            if (ok)
+               ok = s_Counts_08_06.m_Setups == 1;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Uses == 3;
+
+            if (ok)
+               ok = s_Counts_08_06.m_Teardowns == 1;
+
+            status.pass(ok);
+         }
+
+         /*  5 */
+
+         if (status.next_subtest("XPC_CUT_FIXTURE()"))
+         {
+            bool found = false;
+            for
+            (
+               const xpc::cut_fixture_registrar * f =
+                  xpc::cut_fixture_registrar::first();
+               f != nullptr;
+               f = f->next()
+            )
+            {
+               if (f->group() == 97)
+               {
+                  found = f->setup() == fixture_setup_08_06 &&
+                     f->teardown() == fixture_teardown_08_06;
+               }
+            }
+            ok = found;
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_07().  It runs well
+ *    past the timeout that it is given, and still passes its sub-test.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_07 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 98, 1, "Watchdog", "Late test");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Sleeps too long"))
+      {
+         xpccut_ms_sleep(100);
+         status.pass(true);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the per-test timeouts given by cut::load_timeout()
+ *    and XPC_CUT_TEST_TIMEOUT(), which is used to declare this very test.
+ *
+ * \group
+ *    8. xpc::cut.
+ *
+ * \case
+ *    7. Test timeouts.
+ *
+ * \test
+ *    -  xpc::cut::load_timeout()
+ *    -  xpc::cut_registrar::timeout()
+ *    -  unit_test_watchdog_arm()
+ *    -  unit_test_watchdog_disarm()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL_TIMEOUT
+(
+   cut_unit_test_08_07, 8, 7, "xpc::cut", "Test timeouts", 60000
+)
+{
+   xpc::cut_status status
+   (
+      options, 8, 7, "xpc::cut", "Test timeouts"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         char * argv[] =
+         {
+            const_cast<char *>("cut_unit_test"),
+            const_cast<char *>("--no-show-progress"),
+            const_cast<char *>("--jobs"),
+            const_cast<char *>("2"),
+            nullptr
+         };
+
+         /*  1 */
+
+         if (status.next_subtest("No test loaded"))
+         {
+            xpc::cut x_cut(2, argv, "Test 08.07.1");
+            ok = x_cut.valid();
+            if (ok)
+            {
+               bool silent = xpccut_is_silent() ? true : false ;
+               xpccut_silence_printing();       /* hide the error message  */
+               ok = ! x_cut.load_timeout(100);
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Registered timeout"))
+         {
+            int timeout = 0;
+            for
+            (
+               const xpc::cut_registrar * r = xpc::cut_registrar::first();
+               r != nullptr;
+               r = r->next()
+            )
+            {
+               if (r->group() == 8 && r->test_case() == 7)
+                  timeout = r->timeout();
+            }
+            ok = timeout == 60000;
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Late test fails"))
+         {
+            if (xpccut_watchdog_is_available())
+            {
+               for (int argc = 2; ok && argc <= 4; argc += 2)
+               {
+                  xpc::cut x_cut(argc, argv, "Test 08.07.3");
+                  ok = x_cut.load
+                  (
+                     fake_cut_unit_test_08_07, 98, 1, "Watchdog", "Late test"
+                  );
+                  if (ok)
+                     ok = x_cut.load_timeout(10);
+
+                  if (ok)
+                  {
+                     bool silent = xpccut_is_silent() ? true : false ;
+                     xpccut_silence_printing(); /* hide the timeout report */
+                     ok = ! x_cut.run();
+                     if (! silent)
+                        xpccut_allow_printing();
+                  }
+               }
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in cut_unit_test_08_08().  It grows a
+ *    string inside a sub-test that checks that nothing is allocated, so it
+ *    fails whenever the allocations are counted.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_08_08 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 98, 1, "Allocations", "Grows a string");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Allocates"))
+      {
+         std::string text;
+         text.assign(200, 'x');
+         (void) status.no_alloc_check();
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the allocation counts of cut_status, which the
+ *    test application gets by linking the libxpccut_alloc library.  Where
+ *    the library has nothing to count, the checks must pass quietly.
+ *
+ * \group
+ *    8. xpc::cut.
+ *
+ * \case
+ *    8. Allocation counts.
+ *
+ * \test
+ *    -  xpc::cut_status::no_alloc_check()
+ *    -  xpc::cut_status::subtest_allocations()
+ *    -  xpc::cut_status::allocations()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_08_08, 8, 8, "xpc::cut", "Allocation counts")
+{
+   xpc::cut_status status
+   (
+      options, 8, 8, "xpc::cut", "Allocation counts"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         bool counting = xpccut_boolcast(xpccut_alloc_is_counting());
+
+         /*  1 */
+
+         if (status.next_subtest("new and delete are counted"))
+         {
+            xpccut_alloc_counts_t counts;
+            int * volatile block = new int[32];
+            ok = status.subtest_allocations(counts) == counting;
+            if (ok && counting)
+               ok = counts.m_Allocations == 1 && counts.m_Frees == 0;
+
+            delete [] block;
+            if (ok && counting)
+            {
+               ok = status.subtest_allocations(counts);
+               if (ok)
+               {
+                  ok = counts.m_Frees == 1 &&
+                     counts.m_Bytes_Allocated == counts.m_Bytes_Freed;
+               }
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("no_alloc_check() passes"))
+         {
+            int total = 0;
+            for (int i = 0; i < 100; ++i)
+               total += i;
+
+            ok = status.no_alloc_check();
+            if (ok)
+               ok = total == 4950;
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("no_alloc_check() fails"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               nullptr
+            };
+            xpc::cut x_cut(2, argv, "Test 08.08.3");
+            ok = x_cut.load
+            (
+               fake_cut_unit_test_08_08, 98, 1, "Allocations", "Grows a string"
+            );
+            if (ok)
+            {
+               bool silent = xpccut_is_silent() ? true : false ;
+               xpccut_silence_printing();    /* hide the failure message   */
+               ok = x_cut.run() != counting;
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            status.pass(ok);
+         }
+
+         /*  4 */
+
+         if (status.next_subtest("allocations()"))
+         {
+            ok = status.allocations() == nullptr;    /* not timed yet       */
+            if (ok)
+            {
+               xpc::cut_status x_status;
+               ok = x_status.allocations() == nullptr;
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the marking of tests that must run alone.  The
+ *    running of such tests is tested in the C unit_unit_test_04_35().
+ *
+ * \group
+ *    8. xpc::cut.
+ *
+ * \case
+ *    9. Serial tests.
+ *
+ * \test
+ *    -  xpc::cut::load_serial()
+ *    -  xpc::cut_registrar::is_serial()
+ *    -  XPC_CUT_TEST_SERIAL()
+ *    -  XPC_CUT_TEST_SERIAL_TIMEOUT()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_08_09, 8, 9, "xpc::cut", "Serial tests")
+{
+   xpc::cut_status status
+   (
+      options, 8, 9, "xpc::cut", "Serial tests"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         char * argv[] =
+         {
+            const_cast<char *>("cut_unit_test"),
+            const_cast<char *>("--no-show-progress"),
+            nullptr
+         };
+
+         /*  1 */
+
+         if (status.next_subtest("No test loaded"))
+         {
+            xpc::cut x_cut(2, argv, "Test 08.09.1");
+            ok = x_cut.valid();
+            if (ok)
+            {
+               bool silent = xpccut_is_silent() ? true : false ;
+               xpccut_silence_printing();       /* hide the error message  */
+               ok = ! x_cut.load_serial();
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Serial test runs"))
+         {
+            xpc::cut x_cut(2, argv, "Test 08.09.2");
+            ok = x_cut.load
+            (
+               fake_cut_unit_test_08_04, 98, 1, "Serial", "Runs alone"
+            );
+            if (ok)
+               ok = x_cut.load_serial();
+
+            if (ok)
+               ok = x_cut.run();
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Registered serial tests"))
+         {
+            int found = 0;
+            for
+            (
+               const xpc::cut_registrar * r = xpc::cut_registrar::first();
+               ok && r != nullptr;
+               r = r->next()
+            )
+            {
+               if (r->group() == 8 && r->test_case() == 5)
+               {
+                  ok = ! r->is_serial();
+                  ++found;
+               }
+               else if (r->group() == 8 && r->test_case() == 7)
+               {
+                  ok = r->is_serial() && r->timeout() == 60000;
+                  ++found;
+               }
+               else if (r->group() == 8 && r->test_case() == 9)
+               {
+                  ok = r->is_serial() && r->timeout() == 0;
+                  ++found;
+               }
+            }
+            if (ok)
+               ok = found == 3;
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::cut_benchmark micro-benchmark harness.
+ *    The benchmark itself is sub-test 2, and so it can be selected or
+ *    skipped with the --sub-test option.
+ *
+ * \group
+ *    9. xpc::cut_benchmark.
+ *
+ * \case
+ *    1. Settings and statistics.
+ *
+ * \test
+ *    -  xpc::cut_benchmark
+ *    -  xpc::do_not_optimize()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL
+(
+   cut_unit_test_09_01, 9, 1, "xpc::cut_benchmark", "Statistics"
+)
+{
+   xpc::cut_status status
+   (
+      options, 9, 1, "xpc::cut_benchmark", "Statistics"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_benchmark bench(status, "sum of 64 integers");
+
+         /*  1 */
+
+         if (status.next_subtest("cut_benchmark settings"))
+         {
+            bool silent = xpccut_boolcast(xpccut_is_silent());
+            xpccut_silence_printing();       /* hide the error messages    */
+            ok = ! bench.sample_count(0);
+            if (ok)
+               ok = ! bench.warmup_count(-1);
+
+            if (ok)
+               ok = ! bench.min_sample_ns(0);
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            if (ok)
+               ok = bench.sample_count() == XPCCUT_BENCH_SAMPLES;
+
+            if (ok)
+               ok = bench.sample_count(9) && bench.sample_count() == 9;
+
+            if (ok)
+               ok = bench.warmup_count(0) && bench.warmup_count() == 0;
+
+            if (ok)
+               ok = bench.min_sample_ns(20000);
+
+            if (ok)
+               ok = bench.iterations() == 0 && bench.samples().empty();
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         long long calls = 0;
+         int values[64];
+         for (int i = 0; i < 64; ++i)
+            values[i] = i;
+
+         auto body = [&] ()
+         {
+            int sum = 0;
+            for (int i = 0; i < 64; ++i)
+               sum += values[i];
+
+            xpc::do_not_optimize(sum);
+            ++calls;
+         };
+         if (bench.run(body))             /* sub-test 2, if selected    */
+         {
+            ok = bench.iterations() >= 1;
+            if (ok)
+               ok = bench.samples().size() == 9;
+
+            if (ok)
+               ok = calls >= 9 * bench.iterations();
+
+            if (ok)
+               ok = bench.min_ns() == bench.samples().front();
+
+            if (ok)
+               ok = bench.min_ns() <= bench.median_ns();
+
+            if (ok)
+               ok = bench.median_ns() <= bench.p99_ns();
+
+            if (ok)
+               ok = bench.p99_ns() == bench.samples().back();
+
+            if (ok)
+               ok = bench.min_ns() <= bench.mean_ns();
+
+            if (ok)
+               ok = bench.mean_ns() <= bench.p99_ns();
+
+            if (ok)
+               ok = bench.stddev_ns() >= 0.0;
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides the measurement "made" by fake_cut_unit_test_09_02().
+ */
+
+static double gs_measured_09_02 = 100.0;
+
+/**
+ *    Provides the name of the baseline file written and read by
+ *    cut_unit_test_09_02().
+ */
+
+static const char * const gs_baseline_09_02 = "cut_unit_test_09_02.base";
+
+/**
+ *    Provides a fake test to use in cut_unit_test_09_02().  It checks the
+ *    value of gs_measured_09_02 against the baseline.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_09_02 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 9, 2, "xpc::cut fake", "measured");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (status.next_subtest("Measured test"))
+         (void) status.perf_check("fake time", gs_measured_09_02, 1.0);
+   }
+   return status;
+}
+
+/**
+ *    Runs fake_cut_unit_test_09_02() in a nested unit-test object, with
+ *    one baseline option, and all output silenced.
+ *
+ * \param option
+ *    The baseline option, "--write-baseline" or "--baseline".
+ *
+ * \param measured
+ *    The value for the fake test to measure.
+ *
+ * \return
+ *    Returns the result of xpc::cut::run().
+ */
+
+static bool
+run_cut_unit_test_09_02 (const char * option, double measured)
+{
+   char * argv[] =
+   {
+      const_cast<char *>("cut_unit_test"),
+      const_cast<char *>("--no-show-progress"),
+      const_cast<char *>(option),
+      const_cast<char *>(gs_baseline_09_02),
+      nullptr
+   };
+   bool silent = xpccut_boolcast(xpccut_is_silent());
+   xpccut_silence_printing();
+   gs_measured_09_02 = measured;
+   xpc::cut x_cut(4, argv, "Test 09.02");
+   bool result = x_cut.valid();
+   if (result)
+      result = x_cut.load(fake_cut_unit_test_09_02);
+
+   if (result)
+      result = x_cut.run();
+
+   if (! silent)
+      xpccut_allow_printing();
+
+   return result;
+}
+
+/**
+ *    Provides a test of checking performance measurements against a
+ *    baseline file written by an earlier run.
+ *
+ * \group
+ *    9. xpc::cut_benchmark.
+ *
+ * \case
+ *    2. Performance checks against a baseline.
+ *
+ * \test
+ *    -  xpc::cut_status::perf_check()
+ *    -  xpc::cut_benchmark::perf_check()
+ *    -  The --write-baseline and --baseline options
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL
+(
+   cut_unit_test_09_02, 9, 2, "xpc::cut_benchmark", "perf_check()"
+)
+{
+   xpc::cut_status status
+   (
+      options, 9, 2, "xpc::cut_benchmark", "perf_check()"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("cut_benchmark::perf_check() before run()"))
+         {
+            xpc::cut_benchmark bench(status, "never run");
+            bool silent = xpccut_boolcast(xpccut_is_silent());
+            xpccut_silence_printing();       /* hide the error message     */
+            ok = ! bench.perf_check();
+            if (! silent)
+               xpccut_allow_printing();
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Writing and checking the baseline"))
+         {
+            (void) std::remove(gs_baseline_09_02);
+            ok = run_cut_unit_test_09_02("--write-baseline", 100.0);
+            if (ok)
+               ok = run_cut_unit_test_09_02("--baseline", 90.0);
+
+            if (ok)
+               ok = run_cut_unit_test_09_02("--baseline", 120.0);
+
+            if (ok)
+               ok = ! run_cut_unit_test_09_02("--baseline", 300.0);
+
+            (void) std::remove(gs_baseline_09_02);
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the hardware counters of xpc::cut_benchmark and
+ *    xpc::cut_status, under the --perf-counters option.  A nested status
+ *    object is given a copy of the options with the counters turned on.
+ *    Where the counters are not available, no counts must be provided, and
+ *    the benchmark must run as usual.
+ *
+ * \group
+ *    9. xpc::cut_benchmark.
+ *
+ * \case
+ *    3. Hardware counters.
+ *
+ * \test
+ *    -  xpc::cut_options::perf_counters()
+ *    -  xpc::cut_status::counters()
+ *    -  xpc::cut_benchmark::counters()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_09_03, 9, 3, "xpc::cut_benchmark", "Counters")
+{
+   xpc::cut_status status
+   (
+      options, 9, 3, "xpc::cut_benchmark", "Counters"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         bool available = xpccut_boolcast(xpccut_perf_available());
+         xpc::cut_options x_options(options);
+         bool silent = xpccut_boolcast(xpccut_is_silent());
+         xpccut_silence_printing();          /* hide "not available" note  */
+         x_options.show_progress(false);
+         x_options.perf_counters(true);
+         if (! silent)
+            xpccut_allow_printing();
+
+         /*  1 */
+
+         if (status.next_subtest("cut_options::perf_counters()"))
+         {
+            ok = x_options.perf_counters();
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut_status::counters()"))
+         {
+            xpc::cut_status x_status
+            (
+               x_options, 9, 3, "xpc::cut_benchmark", "Counters"
+            );
+            ok = x_status.valid();
+            if (ok)
+            {
+               (void) x_status.time_delta();
+               ok = (x_status.counters() != nullptr) == available;
+            }
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("cut_benchmark::counters()"))
+         {
+            xpc::cut_status x_status
+            (
+               x_options, 9, 3, "xpc::cut_benchmark", "Counters"
+            );
+            xpc::cut_benchmark bench(x_status, "counted loop");
+            int values[64];
+            for (int i = 0; i < 64; ++i)
+               values[i] = i;
+
+            auto body = [&] ()
+            {
+               int sum = 0;
+               for (int i = 0; i < 64; ++i)
+                  sum += values[i];
+
+               xpc::do_not_optimize(sum);
+            };
+            ok = bench.sample_count(5) && bench.min_sample_ns(20000);
+            if (ok && bench.run(body))       /* unless --sub-test skips it */
+               ok = (bench.counters() != nullptr) == available;
+
+            if (ok && available)
+            {
+               const xpccut_perf_values_t * v = bench.counters();
+               if (v->m_Have[XPCCUT_PERF_INSTRUCTIONS])
+                  ok = v->m_Values[XPCCUT_PERF_INSTRUCTIONS] > 0;
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+
+/**
+ *    Spins until the given time has passed, for cut_unit_test_10_01().
+ *
+ * \param ms
+ *    The time to spin for, in milliseconds.
+ */
+
+static void
+spin_10_01 (double ms)
+{
+   xpc::cut_stopwatch sw;
+   while (sw.elapsed_ms() < ms)
+      ;
+}
+
+/**
+ *    Provides a test of the xpc::cut_stopwatch class.
+ *
+ * \group
+ *   10. xpc::cut_stopwatch.
+ *
+ * \case
+ *    1. Scoped timing and laps.
+ *
+ * \test
+ *    -  xpc::cut_stopwatch
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL
+(
+   cut_unit_test_10_01, 10, 1, "xpc::cut_stopwatch", "Scoped timing"
+)
+{
+   xpc::cut_status status
+   (
+      options, 10, 1, "xpc::cut_stopwatch", "Scoped timing"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("Result at end of scope"))
+         {
+            double outer_ms = -1.0;
+            double inner_ms = -1.0;
+            {
+               xpc::cut_stopwatch outer(outer_ms);
+               ok = outer_ms == 0.0;
+               if (ok)
+               {
+                  xpc::cut_stopwatch inner(inner_ms);
+                  spin_10_01(0.2);
+               }
+               spin_10_01(0.1);
+            }
+            if (ok)
+               ok = inner_ms >= 0.2 && outer_ms >= inner_ms + 0.1;
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Laps and restart"))
+         {
+            xpc::cut_stopwatch sw;
+            double first = sw.next_lap();
+            double second = sw.next_lap();
+            ok = sw.lap_count() == 2;
+            if (ok)
+               ok = sw.lap_ms(0) == first && sw.lap_ms(1) == second;
+
+            if (ok)
+               ok = sw.lap_ms(2) == -1.0 && sw.elapsed_ms() >= first + second;
+
+            if (ok)
+            {
+               sw.restart();
+               ok = sw.lap_count() == 0;
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::FuzzStream class.
+ *
+ * \group
+ *   11. xpc::FuzzStream.
+ *
+ * \case
+ *    1. Chunks, random access, and callbacks.
+ *
+ * \test
+ *    -  xpc::FuzzStream
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_11_01, 11, 1, "xpc::FuzzStream", "Streams")
+{
+   xpc::cut_status status
+   (
+      options, 11, 1, "xpc::FuzzStream", "Streams"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("Chunks match random access"))
+         {
+            xpc::FuzzStream fs
+            (
+               20000, 11010, XPCCUT_FF_NUMBERS_ONLY, "", "", "[", "]"
+            );
+            std::string whole;
+            std::string chunk;
+            ok = fs.valid() && fs.length() == 20000 && fs.seed() == 11010;
+            while (ok && fs.next(chunk, 999))
+               whole += chunk;
+
+            if (ok)
+               ok = whole.size() == 20000 && whole[0] == '[';
+
+            if (ok)
+            {
+               ok = whole[19999] == ']' &&
+                  whole.find_first_of("[]", 1) == 19999;
+            }
+
+            if (ok)
+               ok = fs.read(12345, 50) == whole.substr(12345, 50);
+
+            if (ok)
+               ok = fs.read(19990, 50) == whole.substr(19990);
+
+            if (ok)
+               ok = fs.read(20000, 50).empty() && ! fs.next(chunk);
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("generate()"))
+         {
+            xpc::FuzzStream fs1(50000, 11020);
+            xpc::FuzzStream fs2(50000, 11020);
+            std::string whole;
+            std::string chunk;
+            long long bytes = 0;
+            int chunks = 0;
+            while (fs2.next(chunk))
+               whole += chunk;
+
+            ok = fs1.generate
+            (
+               [&] (const char * data, int count) -> bool
+               {
+                  bool same = whole.compare
+                  (
+                     std::size_t(bytes), std::size_t(count), data,
+                     std::size_t(count)
+                  ) == 0;
+                  bytes += count;
+                  ++chunks;
+                  return same;
+               }
+            );
+            if (ok)
+               ok = bytes == 50000 && chunks > 1;
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Invalid streams"))
+         {
+            bool silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            xpc::FuzzStream fs(3, 11030, XPCCUT_FF_DEFAULT, "", "", "abc", "d");
+            std::string chunk;
+            if (! silent)
+               xpccut_allow_printing();
+
+            ok = ! fs.valid() && fs.length() == 0 && fs.seed() == 0;
+            if (ok)
+               ok = ! fs.next(chunk) && fs.read(0, 4).empty();
+
+            if (ok)
+               ok = ! fs.generate([] (const char *, int) { return true; });
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::GuidedFuzz class.
+ *
+ * \group
+ *   11. xpc::FuzzStream.
+ *
+ * \case
+ *    2. Coverage-guided fuzzing.
+ *
+ * \test
+ *    -  xpc::GuidedFuzz
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST(cut_unit_test_11_02, 11, 2, "xpc::FuzzStream", "GuidedFuzz")
+{
+   xpc::cut_status status
+   (
+      options, 11, 2, "xpc::FuzzStream", "GuidedFuzz"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("Finds a failing input"))
+         {
+            xpc::GuidedFuzz gf(11020, 32, XPCCUT_FF_NUMBERS_ONLY);
+            int calls = 0;
+            ok = gf.valid() && gf.add("1.5");
+            if (ok)
+            {
+               ok = ! gf.run
+               (
+                  [&calls] (const char * data, int size) -> bool
+                  {
+                     ++calls;
+                     bool result = true;
+                     if (size > 1 && data[0] == '-')
+                     {
+                        xpccut_coverage_hit(1);
+                        if (data[1] == '-')
+                        {
+                           xpccut_coverage_hit(2);
+                           result = size < 3 || data[2] != '0';
+                        }
+                     }
+                     return result;
+                  },
+                  1000000, 10000.0
+               );
+            }
+            if (ok)
+               ok = gf.crash().compare(0, 3, "--0") == 0;
+
+            if (ok)
+               ok = gf.iterations() == calls && gf.edge_count() == 2;
+
+            if (ok)
+               ok = gf.corpus_count() >= 3;
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Budget"))
+         {
+            xpc::GuidedFuzz gf(11021, 8);
+            ok = gf.run([] (const char *, int) { return true; }, 100);
+            if (ok)
+               ok = gf.iterations() == 100 && gf.crash().empty();
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Corpus directory"))
+         {
+            const std::string dir("cut-unit-test-11-02.dir");
+            std::string crashfile;
+            auto target = [] (const char * data, int size) -> bool
+            {
+               return ! (size > 0 && data[0] == '#');
+            };
+            {
+               xpc::GuidedFuzz gf(11030, 8);
+               ok = gf.directory(dir) && gf.crash_file().empty();
+               if (ok)
+                  ok = ! gf.run(target, 1000000, 10000.0);
+
+               if (ok)
+               {
+                  crashfile = gf.crash_file();
+                  ok = ! crashfile.empty();
+               }
+            }
+            if (ok)
+            {
+               xpc::GuidedFuzz gf(11031, 8);
+               ok = gf.directory(dir) && ! gf.run(target, 1000000, 10000.0);
+               if (ok)
+                  ok = gf.iterations() == 1 && gf.crash_file() == crashfile;
+            }
+            if (! crashfile.empty())
+               (void) std::remove(crashfile.c_str());
+
+            (void) std::remove((dir + "/" XPCCUT_CORPUS_FILE).c_str());
+            (void) std::remove((dir + "/" XPCCUT_CRASHES_FILE).c_str());
+            (void) std::remove(dir.c_str());
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::FuzzCampaign class, and of the options
+ *    and the seed it is built from.
+ *
+ * \group
+ *   11. xpc::FuzzStream.
+ *
+ * \case
+ *    3. Parallel fuzz campaigns.
+ *
+ * \test
+ *    -  xpc::FuzzCampaign
+ *    -  xpc::cut_options::fuzz_job_count()
+ *    -  xpc::RandomNumber::original_seed()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST(cut_unit_test_11_03, 11, 3, "xpc::FuzzStream", "FuzzCampaign")
+{
+   xpc::cut_status status
+   (
+      options, 11, 3, "xpc::FuzzStream", "FuzzCampaign"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("cut_options::fuzz_job_count()"))
+         {
+            xpc::cut_options x_options(true);
+            ok = x_options.fuzz_job_count() == XPCCUT_FUZZ_JOB_COUNT;
+            if (ok)
+            {
+               x_options.fuzz_job_count(3);
+               ok = x_options.fuzz_job_count() == 3;
+            }
+            if (ok)
+            {
+               x_options.fuzz_job_count(0);
+               ok = x_options.fuzz_job_count() == XPCCUT_FUZZ_JOB_COUNT;
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Finds a failing input"))
+         {
+            xpc::RandomNumber rn(11032);
+            xpc::FuzzCampaign fc(3, rn.original_seed(), 16);
+            ok = fc.valid() && fc.job_count() == 3 && fc.add("ok");
+            if (ok)
+            {
+               ok = ! fc.run
+               (
+                  [] (const char * data, int size) -> bool
+                  {
+                     bool result = true;
+                     if (size > 1 && data[0] == '#')
+                     {
+                        xpccut_coverage_hit(1);
+                        result = data[1] != '!';
+                     }
+                     return result;
+                  },
+                  1000000, 10000.0
+               );
+            }
+            if (ok)
+               ok = fc.crash().compare(0, 2, "#!") == 0;
+
+            if (ok)
+               ok = fc.failed_job() >= 0 && fc.edge_count() == 1;
+
+            if (ok)
+               ok = fc.crash_file().empty() && fc.iterations() > 0;
+
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::cut_arena class and of the
+ *    xpc::cut_arena_allocator template.
+ *
+ * \group
+ *   12. xpc::cut_arena.
+ *
+ * \case
+ *    1. Scratch memory for a test.
+ *
+ * \test
+ *    -  xpc::cut_arena
+ *    -  xpc::cut_arena_allocator
+ *    -  xpc::cut_options::huge_pages()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST(cut_unit_test_12_01, 12, 1, "xpc::cut_arena", "Scratch memory")
+{
+   xpc::cut_status status
+   (
+      options, 12, 1, "xpc::cut_arena", "Scratch memory"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("An arena of its own"))
+         {
+            xpc::cut_arena scratch(4096);
+            char * block = static_cast<char *>(scratch.allocate(100));
+            int * numbers = scratch.allocate_array<int>(10);
+            ok = block != nullptr && numbers != nullptr;
+            if (ok)
+               ok = numbers[9] == 0 && scratch.capacity() == 4096;
+
+            if (ok)
+            {
+               const char * text = scratch.copy("copied");
+               ok = text != nullptr && std::string(text) == "copied";
+            }
+            if (ok)
+            {
+               scratch.reset();
+               ok = scratch.allocated() == 0 && scratch.capacity() == 4096;
+            }
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("The test arena, rewound"))
+         {
+            xpccut_arena_t * a = xpccut_test_arena();
+            std::size_t used = xpccut_arena_allocated(a);
+            {
+               xpc::cut_arena scratch(xpc::cut_arena::test_arena);
+               ok = scratch.arena() == a;
+               if (ok)
+                  ok = scratch.allocate(5000) != nullptr;
+
+               if (ok)
+                  ok = xpccut_arena_allocated(a) >= used + 5000;
+            }
+            if (ok)
+               ok = xpccut_arena_allocated(a) == used;
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Containers in an arena"))
+         {
+            xpc::cut_arena scratch;
+            xpc::cut_arena_allocator<int> alloc(scratch);
+            std::vector<int, xpc::cut_arena_allocator<int> > v(alloc);
+            for (int i = 0; i < 1000; ++i)
+               v.push_back(i);
+
+            ok = v.size() == 1000 && v[999] == 999;
+            if (ok)
+               ok = scratch.allocated() >= 1000 * sizeof(int);
+
+            if (ok)
+            {
+               xpc::cut_arena_allocator<char> other(alloc);
+               xpc::cut_arena_allocator<char> test_alloc;
+               ok = other == alloc && other != test_alloc;
+               if (ok)
+                  ok = test_alloc.arena() == xpccut_test_arena();
+            }
+            if (ok)
+            {
+               xpc::cut_arena_string s("a string longer than the small buffer");
+               s += " of the string class";
+               ok = s.length() == 57 && s[0] == 'a';
+            }
+            if (ok)
+            {
+               xpc::cut_arena_bytes bytes(256, 0x5A);
+               ok = bytes.size() == 256 && bytes[255] == 0x5A;
+            }
+            status.pass(ok);
+         }
+
+         /*  4 */
+
+         if (status.next_subtest("Fuzz strings, huge-page option"))
+         {
+            xpc::cut_arena scratch(0, XPCCUT_ARENA_HUGE_PAGES);
+            unsigned int seed = 77;
+            char * fuzz = xpccut_arena_fuzz
+            (
+               scratch.arena(), 64, &seed, XPCCUT_FF_DEFAULT, "xyz",
+               nullptr, nullptr, nullptr
+            );
+            ok = fuzz != nullptr && seed == 77;
+            if (ok)
+            {
+               ok = std::string(fuzz).find_first_not_of("xyz") ==
+                  std::string::npos;
+            }
+
+            if (ok)
+            {
+               xpc::cut_options x_options(options);
+               x_options.huge_pages(true);
+               ok = x_options.huge_pages();
+               if (ok)
+               {
+                  x_options.huge_pages(false);
+                  ok = ! x_options.huge_pages();
+               }
+            }
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the recording of xpc::Sequencing scopes in the
+ *    trace buffer.
+ *
+ * \group
+ *   13. xpc::Sequencing.
+ *
+ * \case
+ *    1. Sequencing into the trace.
+ *
+ * \test
+ *    -  xpc::Sequencing
+ *    -  xpc::cut_options::trace_file()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL
+(
+   cut_unit_test_13_01, 13, 1, "xpc::Sequencing", "Trace scopes"
+)
+{
+   xpc::cut_status status
+   (
+      options, 13, 1, "xpc::Sequencing", "Trace scopes"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         bool was_enabled = xpccut_trace_is_enabled();
+
+         /*  1 */
+
+         if (status.next_subtest("Scopes recorded while enabled"))
+         {
+            int count = xpccut_trace_thread_count();
+            xpccut_trace_enable(true);
+            {
+               xpc::Sequencing outer("cut_unit_test_13_01");
+               {
+                  xpc::Sequencing inner("inner scope", true);
+               }
+            }
+            xpccut_trace_enable(false);
+            ok = xpccut_trace_thread_count() == count + 4;
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("Nothing recorded while disabled"))
+         {
+            int count = xpccut_trace_thread_count();
+            {
+               xpc::Sequencing quiet("quiet scope");
+            }
+            ok = xpccut_trace_thread_count() == count;
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Trace file option"))
+         {
+            xpc::cut_options x_options(options);
+            x_options.trace_file("cut.json");
+            ok = x_options.trace_file() == "cut.json";
+            if (ok)
+            {
+               x_options.trace_file("");
+               ok = x_options.trace_file().empty();
+            }
+            status.pass(ok);
+         }
+         xpccut_trace_enable(was_enabled);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the xpc::cut_concurrent stress harness and of its
+ *    latency histogram.  The runs themselves are sub-tests 3 to 5, and so
+ *    they can be selected or skipped with the --sub-test option.
+ *
+ * \group
+ *   14. xpc::cut_concurrent.
+ *
+ * \case
+ *    1. Settings, histograms, and runs.
+ *
+ * \test
+ *    -  xpc::cut_concurrent
+ *    -  xpc::cut_histogram
+ *    -  xpc::cut_thread
+ *    -  xpc::cut_status::run_concurrently()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL(cut_unit_test_14_01, 14, 1, "xpc::cut_concurrent", "Runs")
+{
+   xpc::cut_status status
+   (
+      options, 14, 1, "xpc::cut_concurrent", "Runs"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpc::cut_concurrent stress(status, "shared counter");
+
+         /*  1 */
+
+         if (status.next_subtest("cut_concurrent settings"))
+         {
+            bool silent = xpccut_boolcast(xpccut_is_silent());
+            xpccut_silence_printing();       /* hide the error messages    */
+            ok = ! stress.thread_count(0);
+            if (ok)
+               ok = ! stress.thread_count(XPCCUT_CONCURRENT_THREADS_MAX + 1);
+
+            if (ok)
+               ok = ! stress.iterations(-1);
+
+            if (ok)
+               ok = ! stress.duration_ms(-1.0);
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            if (ok)
+               ok = stress.thread_count() == xpc::cut_concurrent::cpu_count();
+
+            if (ok)
+               ok = stress.iterations() == XPCCUT_CONCURRENT_ITERATIONS;
+
+            if (ok)
+               ok = stress.duration_ms() == 0.0 && ! stress.pin_threads();
+
+            if (ok)
+               ok = stress.thread_count(4) && stress.thread_count() == 4;
+
+            if (ok)
+               ok = stress.iterations(2000) && stress.iterations() == 2000;
+
+            if (ok)
+            {
+               stress.pin_threads(true);
+               ok = stress.pin_threads();
+            }
+            if (ok)
+               ok = stress.threads().empty() && stress.wall_ns() == 0;
+
+            status.pass(ok);
+         }
+
+         /*  2 */
+
+         if (status.next_subtest("cut_histogram"))
+         {
+            xpc::cut_histogram h;
+            xpc::cut_histogram h2;
+            ok = h.count() == 0 && h.percentile(50.0) == 0;
+            for (long long v = 0; v < 1000; ++v)
+               h.add(v);
+
+            if (ok)
+               ok = h.count() == 1000 && h.min() == 0 && h.max() == 999;
+
+            if (ok)
+               ok = h.mean() == 499.5;
+
+            if (ok)
+            {
+               long long p50 = h.percentile(50.0);
+               ok = p50 >= 499 && p50 <= 499 + 499 / 8;
+            }
+            if (ok)
+               ok = h.percentile(100.0) == 999 && h.percentile(0.0) == 0;
+
+            for (long long v = 1; ok && v < (1LL << 61); v *= 3)
+            {
+               int b = xpc::cut_histogram::bucket(v);
+               ok = xpc::cut_histogram::bucket_high(b) >= v;
+               if (ok && b > 0)
+                  ok = xpc::cut_histogram::bucket_high(b - 1) < v;
+            }
+            for (int i = 0; ok && i < 8 * 61; ++i)  /* up to LLONG_MAX */
+            {
+               long long high = xpc::cut_histogram::bucket_high(i);
+               ok = xpc::cut_histogram::bucket(high) == i;
+            }
+            if (ok)
+            {
+               h2.add(-5);                   /* counts as 0                */
+               h2.add(1000000);
+               h2.merge(h);
+               ok = h2.count() == 1002 && h2.min() == 0;
+               if (ok)
+                  ok = h2.max() == 1000000;
+            }
+            if (ok)
+            {
+               h.clear();
+               ok = h.count() == 0 && h.max() == 0;
+            }
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         long long counter = 0;
+         auto body = [&] (xpc::cut_thread & t)
+         {
+            (void) __sync_fetch_and_add(&counter, 1LL);
+            (void) t.check(t.iteration() < 2000);
+         };
+         if (stress.run(body))               /* sub-test 3, if selected    */
+         {
+            ok = stress.threads().size() == 4;
+            if (ok)
+               ok = stress.total_iterations() == 8000 && counter == 8000;
+
+            for (int i = 0; ok && i < 4; ++i)
+            {
+               const xpc::cut_thread & t = stress.threads()[std::size_t(i)];
+               ok = t.index() == i && t.iterations() == 2000;
+               if (ok)
+                  ok = t.checks() == 2000 && t.failures() == 0;
+
+               if (ok)
+                  ok = t.first_failure() == -1;
+
+               if (ok)
+                  ok = t.latency().count() == 2000;
+
+               if (ok)
+                  ok = t.cpu() == -1 || t.cpu() < stress.cpu_count();
+            }
+            if (ok)
+               ok = stress.latency().count() == 8000;
+
+            if (ok)
+               ok = stress.wall_ns() > 0 && stress.throughput() > 0.0;
+
+            status.pass(ok);
+         }
+
+         /*  4 */
+
+         stress.pin_threads(false);
+         (void) stress.thread_count(2);
+         (void) stress.iterations(0);
+         (void) stress.duration_ms(20.0);
+         auto stopper = [] (xpc::cut_thread & t)
+         {
+            if (t.index() == 1 && t.iteration() == 9)
+               t.stop();
+         };
+         if (stress.run(stopper))            /* sub-test 4, if selected    */
+         {
+            ok = stress.threads()[1].iterations() == 10;
+            if (ok)
+               ok = stress.threads()[0].iterations() > 10;
+
+            if (ok)
+               ok = stress.threads()[0].elapsed_ns() >= 20000000LL;
+
+            if (ok)
+               ok = stress.wall_ns() >= stress.threads()[1].elapsed_ns();
+
+            status.pass(ok);
+         }
+
+         /*  5 */
+
+         int threads = 0;
+         auto nop = [&] (xpc::cut_thread & t)
+         {
+            if (t.index() == 2 && t.iteration() == 0)
+               threads = 3;
+         };
+         if (status.run_concurrently("run_concurrently()", 3, nop))
+         {
+            ok = threads == 3;
+            status.pass(ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides the failures of the second thread of the run made by
+ *    fake_cut_unit_test_14_02().
+ */
+
+static long long gs_failures_14_02 = 0;
+
+/**
+ *    Provides the iteration of the first failure of that thread.
+ */
+
+static long long gs_first_failure_14_02 = 0;
+
+/**
+ *    Provides the failures in the log of the status of that fake test,
+ *    which its threads check as well, and the sub-test of the first one.
+ */
+
+static int gs_logged_14_02 = 0;
+static int gs_log_subtest_14_02 = 0;
+
+/**
+ *    Provides a fake test to use in cut_unit_test_14_02().  The second of
+ *    its two threads fails a check in every iteration after the fifth, on
+ *    its cut_thread and on the status shared by the threads.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_14_02 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 14, 2, "xpc::cut fake", "failing");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      xpc::cut_concurrent stress(status, "failing checks");
+      (void) stress.thread_count(2);
+      (void) stress.iterations(100);
+      (void) stress.run([&] (xpc::cut_thread & t)
+      {
+         bool failing = t.index() == 1 && t.iteration() >= 5;
+         (void) t.int_check(0, failing);
+         (void) status.bool_check(false, failing);    /* shared status  */
+      });
+      gs_failures_14_02 = gs_first_failure_14_02 = -1;
+      gs_logged_14_02 = status.failure_count();
+      gs_log_subtest_14_02 = -1;
+      if (status.failure(0) != nullptr)
+         gs_log_subtest_14_02 = status.failure(0)->m_Subtest;
+
+      if (stress.threads().size() == 2)
+      {
+         if (stress.threads()[0].failures() == 0)
+         {
+            gs_failures_14_02 = stress.threads()[1].failures();
+            gs_first_failure_14_02 = stress.threads()[1].first_failure();
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the failures of the threads of a concurrent run,
+ *    and of the scalability curve of xpc::cut_concurrent::scale().  The
+ *    failing run is made by a fake test in a nested unit-test object, with
+ *    all output silenced.
+ *
+ * \group
+ *   14. xpc::cut_concurrent.
+ *
+ * \case
+ *    2. Failures and scaling.
+ *
+ * \test
+ *    -  xpc::cut_thread::check()
+ *    -  xpc::cut_status::failure_count()
+ *    -  xpc::cut_status::failure()
+ *    -  xpc::cut_concurrent::scale()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+XPC_CUT_TEST_SERIAL
+(
+   cut_unit_test_14_02, 14, 2, "xpc::cut_concurrent", "Scaling"
+)
+{
+   xpc::cut_status status
+   (
+      options, 14, 2, "xpc::cut_concurrent", "Scaling"
+   );
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      if (! status.can_proceed()) /* is test allowed to run? */
+      {
+         status.pass(true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (status.next_subtest("Failed checks of a thread"))
+         {
+            char * argv[] =
+            {
+               const_cast<char *>("cut_unit_test"),
+               const_cast<char *>("--no-show-progress"),
+               nullptr
+            };
+            bool silent = xpccut_boolcast(xpccut_is_silent());
+            xpccut_silence_printing();
+            xpc::cut x_cut(2, argv, "Test 14.02");
+            ok = x_cut.valid();
+            if (ok)
+               ok = x_cut.load(fake_cut_unit_test_14_02);
+
+            if (ok)
+               ok = ! x_cut.run();
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            if (ok)
+               ok = gs_failures_14_02 == 95 && gs_first_failure_14_02 == 5;
+
+            if (ok)
+               ok = gs_logged_14_02 == 95 + 1 && gs_log_subtest_14_02 == 1;
+
+            status.pass(ok);
+         }
+
+         /*  2, 3, and 4 */
+
+         xpc::cut_concurrent stress(status, "private counters");
+         (void) stress.thread_count(4);
+         (void) stress.iterations(1000);
+         auto body = [] (xpc::cut_thread & t)
+         {
+            (void) t.check(t.iteration() >= 0);
+         };
+         if (stress.scale(body))
+         {
+            ok = stress.scaling().size() == 3;
+            if (ok)
+               ok = stress.scaling()[0].first == 1;
+
+            if (ok)
+               ok = stress.scaling()[1].first == 2;
+
+            if (ok)
+               ok = stress.scaling()[2].first == 4;
+
+            if (ok)
+               ok = stress.thread_count() == 4;
+
+            if (ok)
+               ok = stress.total_iterations() == 4000;
+
+            status.pass(ok);
+         }
+      }
    }
    return status;
 }
 
 /**
- *    Recapitulates cut_unit_test_01_01().
- *    Why?  To make it easy to check up on some aspects of the --summarize
- *    option.
+ *    Provides the number of tests that wait at once in the
+ *    "Tests in flight" sub-test of cut_unit_test_15_01().
+ */
+
+#define FLIGHT_TESTS_15_01       40
+
+/**
+ *    Provides the wait of each of those tests, in milliseconds.
+ */
+
+#define FLIGHT_WAIT_15_01        25.0
+
+/**
+ *    Provides a test of the xpc::cut_event_loop class: timers, readiness of
+ *    descriptors, and many waiting tests, each with a status of its own,
+ *    in flight at once on the one thread.
+ *
+ * \group
+ *   15. xpc::cut_event_loop.
+ *
+ * \case
+ *    1. Timers, descriptors, and tests in flight.
+ *
+ * \test
+ *    -  xpc::cut_event_loop
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13334,96 +16892,300 @@ cut_unit_test_05_04 (const xpc::cut_options & options)
  *    Returns the unit-test status object needed by the protocol.
  */
 
-static xpc::cut_status
-cut_unit_test_06_01 (const xpc::cut_options & options)
+XPC_CUT_TEST_SERIAL(cut_unit_test_15_01, 15, 1, "xpc::cut_event_loop", "Runs")
 {
    xpc::cut_status status
    (
-      options, 6, 1, _("xpccut"), _("01.01 Smoke Test Recap")
+      options, 15, 1, "xpc::cut_event_loop", "Runs"
    );
    bool ok = status.valid();        /* note that invalidity is /not/ an error */
    if (ok)
    {
       if (! status.can_proceed()) /* is test allowed to run? */
       {
-         status.pass(true);     /* no, force it to pass    */
+         status.pass();           /* no, force it to pass */
       }
       else
       {
-         if (unit_test_options_show_values(options))
-            fprintf(stdout, "  %s\n", _("No values to show in this test"));
-
          /*  1 */
 
-         if (status.next_subtest("unit_test_status_pass()"))
+         if (status.next_subtest("Timers"))
          {
-            status.pass(true);
-            ok =
-            (
-               (status.m_Subtest_Error_Count == 0) &&
-               (status.m_Failed_Subtest == 0)
-            );
-            if (! ok)
+            xpc::cut_event_loop loop;
+            std::string order;
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = ! loop.after(-1.0, [&order] () { order += "x"; });
+            if (! silent)
+               xpccut_allow_printing();
+
+            if (ok)
+               ok = loop.after(30.0, [&order] () { order += "3"; });
+
+            if (ok)
+               ok = loop.after(10.0, [&order] () { order += "1"; });
+
+            if (ok)
             {
-               (void) status.fail();    /* create a failure  */
-               if (options.is_verbose())
-               {
-                  fprintf
-                  (
-                     stderr, "%s %s\n",
-                     "unit_test_status_pass()", _("internal failure")
-                  );
-               }
+               ok = loop.after
+               (
+                  20.0, [&order, &loop] ()
+                  {
+                     order += "2";
+                     (void) loop.after(0.0, [&order] () { order += "a"; });
+                     (void) loop.after(0.0, [&order] () { order += "b"; });
+                  }
+               );
             }
+            if (ok)
+               ok = loop.pending() == 3;
+
+            if (ok)
+               ok = loop.run(5000.0);
+
+            if (ok)
+               ok = order == "12ab3";
+
+            if (ok)
+               ok = loop.pending() == 0 && loop.dispatched() == 5;
+
             status.pass(ok);
          }
 
          /*  2 */
 
-         if
-         (
-            ok &&
-            status.next_subtest("unit_test_status_fail()")
-         )
+         if (status.next_subtest("Run time-out and stop()"))
          {
-            ok = status.fail_deliberately();
+            xpc::cut_event_loop loop;
+            int runs = 0;
+            ok = loop.after(60000.0, [&runs] () { ++runs; });
+            if (ok)
+               ok = ! loop.run(10.0);
+
+            if (ok)
+               ok = loop.pending() == 1 && runs == 0;
+
+            if (ok)
+               ok = loop.after(0.0, [&loop] () { loop.stop(); });
+
+            if (ok)
+               ok = loop.after(5.0, [&runs] () { ++runs; });
+
+            if (ok)
+               ok = ! loop.run() && loop.pending() == 2 && runs == 0;
+
+            if (ok)
+               ok = ! loop.run(100.0) && runs == 1;
+
+            status.pass(ok);
+         }
+
+#if XPC_HAVE_UNISTD_H && XPC_HAVE_POLL_H && ! defined WIN32
+
+         /*  3 */
+
+         if (status.next_subtest("Descriptors"))
+         {
+            xpc::cut_event_loop loop;
+            int fds[2] = { -1, -1 };
+            char received = 0;
+            bool writable = false;
+            ok = pipe(fds) == 0;
             if (ok)
             {
-               ok =
+               ok = loop.when_readable
                (
-                  (status.m_Subtest_Error_Count == 1) &&
-                  (status.m_Failed_Subtest == 2)
+                  fds[0], [&fds, &received] ()
+                  {
+                     if (read(fds[0], &received, 1) != 1)
+                        received = '?';
+                  }
+               );
+            }
+            if (ok)
+            {
+               ok = loop.when_writable
+               (
+                  fds[1], [&writable] () { writable = true; }
+               );
+            }
+            if (ok)
+            {
+               ok = loop.after
+               (
+                  10.0, [&fds] ()
+                  {
+                     if (write(fds[1], "!", 1) != 1)
+                        (void) close(fds[1]);
+                  }
+               );
+            }
+            if (ok)
+               ok = loop.run(5000.0);
+
+            if (ok)
+               ok = received == '!' && writable;
+
+            if (fds[0] >= 0)
+            {
+               (void) close(fds[0]);
+               (void) close(fds[1]);
+            }
+            status.pass(ok);
+         }
+
+         /*  4 */
+
+         if (status.next_subtest("Tests in flight"))
+         {
+            xpc::cut_options x_options(XPCCUT_OPTIONS_SIMULATED);
+            std::vector<xpc::cut_status> statuses;
+            std::vector<int> fds(2 * FLIGHT_TESTS_15_01, -1);
+            xpc::cut_event_loop loop;
+            xpc::cut_stopwatch watch;
+            for (int i = 0; ok && i < FLIGHT_TESTS_15_01; ++i)
+            {
+               statuses.push_back
+               (
+                  xpc::cut_status(x_options, 15, 1, "flight", "test")
+               );
+               ok = pipe(&fds[2 * i]) == 0;
+            }
+            for (int i = 0; ok && i < FLIGHT_TESTS_15_01; ++i)
+            {
+               int * p = &fds[2 * i];
+               xpc::cut_status * s = &statuses[i];
+               ok = loop.after                  /* the "peer" answers later  */
+               (
+                  FLIGHT_WAIT_15_01, [p, i] ()
+                  {
+                     char c = char('A' + i % 26);
+                     if (write(p[1], &c, 1) != 1)
+                        (void) close(p[1]);
+                  }
                );
-               status.pass(ok); /* convert it to a "pass"  */
                if (ok)
                {
-                  status.m_Subtest_Error_Count--;  /* direct access (bad) !!! */
-                  status.m_Failed_Subtest = 0;     /* direct access (bad) !!! */
+                  ok = loop.when_readable
+                  (
+                     p[0], [p, s, i] ()
+                     {
+                        char c = 0;
+                        bool got = read(p[0], &c, 1) == 1;
+                        (void) s->pass(got && c == char('A' + i % 26));
+                     }
+                  );
                }
             }
+            if (ok)
+               ok = loop.run(10000.0);
+
+            if (ok)
+            {
+               /*
+                * Run one after the other, the waits would take a second.
+                * Half of that leaves plenty of room for a busy machine.
+                */
+
+               double ms = watch.elapsed_ms();
+               ok = ms < FLIGHT_TESTS_15_01 * FLIGHT_WAIT_15_01 / 2.0;
+            }
+            for (int i = 0; ok && i < FLIGHT_TESTS_15_01; ++i)
+               ok = statuses[i].error_count() == 0;
+
+            if (ok)
+               ok = loop.dispatched() == 2 * FLIGHT_TESTS_15_01;
+
+            for (std::size_t i = 0; i < fds.size(); ++i)
+            {
+               if (fds[i] >= 0)
+                  (void) close(fds[i]);
+            }
+            status.pass(ok);
          }
-         /*
-          * A useless visual check.
-          *
-          * if (ok)
-          *    xpccut_ms_sleep(500);               // a visual duration check
-          */
+
+#endif   // XPC_HAVE_UNISTD_H && XPC_HAVE_POLL_H && ! defined WIN32
+
       }
    }
    return status;
 }
 
-#endif      // #if 0
+/**
+ *    Provides the rows of the tables of cut_unit_test_16_01().
+ */
+
+static const char * const gs_rows_16_01[] =
+{
+   "2 4", "3 9", "4 16", "5 25", "6 36"
+};
 
 /**
- *    Provides tests of some of the macros, so we can verify they are being
- *    defined properly.
+ *    Counts the records walked by fake_cut_unit_test_16_01().
+ */
+
+static int gs_records_16_01 = 0;
+
+/**
+ *    Provides a fake data-driven test to use in cut_unit_test_16_01().  It
+ *    checks that the second field of each record is the square of the
+ *    first.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static xpc::cut_status
+fake_cut_unit_test_16_01 (const xpc::cut_options & options)
+{
+   xpc::cut_status status(options, 98, 1, "Tables", "Squares");
+   bool ok = status.valid();        /* note that invalidity is /not/ an error */
+   if (ok)
+   {
+      xpccut_table_t table;
+      ok = xpccut_table_init_rows(&table, "squares", gs_rows_16_01, 5);
+      if (ok)
+      {
+         xpccut_record_t record = XPCCUT_RECORD_INIT;
+         while (status.next_record(&table, &record))
+         {
+            xpccut_record_t field;
+            long n = 0;
+            long square = 0;
+            ok = xpccut_record_field(&record, 0, &field) &&
+               xpccut_record_long(&field, &n);
+
+            if (ok)
+            {
+               ok = xpccut_record_field(&record, 1, &field) &&
+                  xpccut_record_long(&field, &square);
+            }
+            ++gs_records_16_01;
+            status.pass(ok && n * n == square);
+         }
+         xpccut_table_close(&table);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a test of the data-driven tests, whose records are walked by
+ *    cut_status::next_record(), and spread among the shards by
+ *    cut::load_spread().
  *
  * \group
- *    7. Macro tests
+ *   16. Data-driven tables.
  *
  * \case
- *    1. cut_not_nullptr() and cut_is_nullptr() macros.
+ *    1. Records.
+ *
+ * \test
+ *    -  xpc::cut::load_spread()
+ *    -  xpc::cut_status::next_record()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13432,54 +17194,97 @@ cut_unit_test_06_01 (const xpc::cut_options & options)
  *    Returns the unit-test status object needed by the protocol.
  */
 
-static xpc::cut_status
-cut_unit_test_07_01 (const xpc::cut_options & options)
+XPC_CUT_TEST_SERIAL(cut_unit_test_16_01, 16, 1, "Data-driven tables", "Records")
 {
    xpc::cut_status status
    (
-      options, 7, 1, _("xpccut"), _("cut_xxx_nullptr() tests")
+      options, 16, 1, "Data-driven tables", "Records"
    );
    bool ok = status.valid();        /* note that invalidity is /not/ an error */
    if (ok)
    {
       if (! status.can_proceed()) /* is test allowed to run? */
       {
-         status.pass(true);     /* no, force it to pass    */
+         status.pass();           /* no, force it to pass */
       }
       else
       {
-         const char * good = "allo";
-         const char * bad = nullptr;
+         char * argv[] =
+         {
+            const_cast<char *>("cut_unit_test"),
+            const_cast<char *>("--no-show-progress"),
+            const_cast<char *>("--shard-count"),
+            const_cast<char *>("2"),
+            const_cast<char *>("--shard-index"),
+            const_cast<char *>("0"),
+            nullptr
+         };
 
          /*  1 */
 
-         if (status.next_subtest("cut_not_nullptr()"))
+         if (status.next_subtest("No test loaded"))
          {
-#ifdef XPC_NO_NULLPTR
-            ok = cut_not_nullptr(good) == true;
-            if (ok)
-               ok = cut_not_nullptr(bad) == true;
-#else
-            ok = cut_not_nullptr(good) == true;
+            xpc::cut x_cut(2, argv, "Test 16.01.1");
+            ok = x_cut.valid();
             if (ok)
-               ok = cut_not_nullptr(bad) == false;
-#endif
+            {
+               bool silent = xpccut_is_silent() ? true : false ;
+               xpccut_silence_printing();       /* hide the error message  */
+               ok = ! x_cut.load_spread();
+               if (! silent)
+                  xpccut_allow_printing();
+            }
             status.pass(ok);
          }
 
          /*  2 */
 
-         if (status.next_subtest("cut_not_nullptr()"))
+         if (status.next_subtest("Every record"))
          {
-#ifdef XPC_NO_NULLPTR
-            ok = cut_is_nullptr(good) == false;
+            xpc::cut x_cut(2, argv, "Test 16.01.2");
+            gs_records_16_01 = 0;
+            ok = x_cut.load(fake_cut_unit_test_16_01);
             if (ok)
-               ok = cut_is_nullptr(bad) == false;
-#else
-            ok = cut_is_nullptr(good) == false;
+               ok = x_cut.run();
+
             if (ok)
-               ok = cut_is_nullptr(bad) == true;
-#endif
+               ok = gs_records_16_01 == 5;
+
+            status.pass(ok);
+         }
+
+         /*  3 */
+
+         if (status.next_subtest("Records in two shards"))
+         {
+            int total = 0;
+            for (int shard = 0; ok && shard < 2; ++shard)
+            {
+               argv[5] = const_cast<char *>(shard == 0 ? "0" : "1") ;
+
+               xpc::cut x_cut(6, argv, "Test 16.01.3");
+               gs_records_16_01 = 0;
+               ok = x_cut.load(fake_cut_unit_test_16_01);
+               if (ok)
+                  ok = x_cut.load_spread();
+
+               if (ok)
+               {
+                  bool silent = xpccut_is_silent() ? true : false ;
+                  xpccut_silence_printing();    /* hide the SHARD summary  */
+                  ok = x_cut.run();
+                  if (! silent)
+                     xpccut_allow_printing();
+               }
+               if (ok)
+                  ok = gs_records_16_01 == (shard == 0 ? 3 : 2) ;
+
+               total += gs_records_16_01;
+            }
+            argv[5] = const_cast<char *>("0");
+            if (ok)
+               ok = total == 5;
+
             status.pass(ok);
          }
       }
@@ -13487,7 +17292,6 @@ cut_unit_test_07_01 (const xpc::cut_options & options)
    return status;
 }
 
-
 /**
  *    This is the main routine for the cut_unit_test application.
  *
@@ -13613,6 +17417,7 @@ CUTPP_TEST_NAME "-specific options:\n"
             (void) testbattery.load(cut_unit_test_02_07);
             (void) testbattery.load(cut_unit_test_02_08);
             (void) testbattery.load(cut_unit_test_02_09);
+            (void) testbattery.load_serial();      /* silences printing    */
             (void) testbattery.load(cut_unit_test_02_10);
             (void) testbattery.load(cut_unit_test_02_11);
             (void) testbattery.load(cut_unit_test_02_12);
@@ -13641,7 +17446,9 @@ CUTPP_TEST_NAME "-specific options:\n"
              * lump all tests in one group together.
              */
 
-            ok = testbattery.load(cut_unit_test_02_31);
+            (void) testbattery.load(cut_unit_test_02_31);
+            (void) testbattery.load(cut_unit_test_02_32);
+            ok = testbattery.load(cut_unit_test_02_33);
          }
          if (ok)
          {
@@ -13650,6 +17457,7 @@ CUTPP_TEST_NAME "-specific options:\n"
             (void) testbattery.load(cut_unit_test_03_03);
             (void) testbattery.load(cut_unit_test_03_04);
             (void) testbattery.load(cut_unit_test_03_05);
+            (void) testbattery.load_serial();      /* silences printing    */
 #if 0
             (void) testbattery.load(cut_unit_test_03_06);
             (void) testbattery.load(cut_unit_test_03_07);
@@ -13671,7 +17479,8 @@ CUTPP_TEST_NAME "-specific options:\n"
             (void) testbattery.load(cut_unit_test_03_23);
             (void) testbattery.load(cut_unit_test_03_24);
             (void) testbattery.load(cut_unit_test_03_25);
-            ok = testbattery.load(cut_unit_test_03_26);
+            (void) testbattery.load(cut_unit_test_03_26);
+            ok = testbattery.load(cut_unit_test_03_29);
 #endif
          }
 #if 0
@@ -13736,6 +17545,24 @@ CUTPP_TEST_NAME "-specific options:\n"
          {
             ok = testbattery.load(cut_unit_test_07_01);
          }
+         if (ok)
+         {
+            ok = testbattery.load(cut_unit_test_08_01);
+         }
+         if (ok)
+         {
+            (void) testbattery.load(cut_unit_test_08_02);
+            (void) testbattery.load_serial();      /* silences printing    */
+            (void) testbattery.load(cut_unit_test_08_03);
+            (void) testbattery.load_serial();
+            ok = testbattery.load(cut_unit_test_08_04);
+            if (ok)
+               ok = testbattery.load_serial();
+         }
+         if (ok)
+         {
+            ok = testbattery.load_registered();    /* XPC_CUT_TEST() tests */
+         }
       }
       if (ok)
          ok = testbattery.run();
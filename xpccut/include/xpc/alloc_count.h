@@ -0,0 +1,119 @@
+#ifndef XPCCUT_ALLOC_COUNT_H
+#define XPCCUT_ALLOC_COUNT_H
+
+/**
+ * \file          alloc_count.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the counts of the heap allocations made by each test.  Also
+ *    see the alloc_count.c and alloc_hooks.c modules.
+ *
+ *    The counting is opt-in.  The xpccut library itself only reads the
+ *    counts.  They are kept by the separate libxpccut_alloc library, which
+ *    replaces malloc(), free(), and the rest of the allocator (and so, in
+ *    C++, operator new and delete) when it is linked into a test
+ *    application ahead of the C library:
+ *
+\verbatim
+      unit_test_LDADD = libxpccut_alloc.a -lxpccut -lpthread
+\endverbatim
+ *
+ *    Each thread keeps its own counts, so a --jobs worker sees only the
+ *    allocations of the test it runs.  A block allocated by one thread and
+ *    freed by another is counted as a free in the second thread.
+ *
+ *    If the library is not linked in, xpccut_alloc_read() returns 'false',
+ *    and the status functions that check the counts always pass.
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+/**
+ *    Holds the allocation counts of a thread, or the difference between
+ *    two readings of them.
+ */
+
+typedef struct
+{
+   /**
+    *    Indicates that the counts were read.
+    */
+
+   cbool_t m_Is_Valid;
+
+   /**
+    *    The number of blocks allocated, by malloc(), calloc(), realloc()
+    *    and the aligned allocators.  A realloc() counts as the free of the
+    *    old block and the allocation of the new one.
+    */
+
+   long long m_Allocations;
+
+   /**
+    *    The number of blocks freed.
+    */
+
+   long long m_Frees;
+
+   /**
+    *    The usable size of the blocks allocated, in bytes.
+    */
+
+   long long m_Bytes_Allocated;
+
+   /**
+    *    The usable size of the blocks freed, in bytes.
+    */
+
+   long long m_Bytes_Freed;
+
+   /**
+    *    Stops the counting while it is greater than 0.  The library sets it
+    *    around its own allocations, such as the capture of the output of a
+    *    --jobs worker, so that they are not charged to the test.  It is not
+    *    part of the counts.
+    */
+
+   int m_Paused;
+
+} xpccut_alloc_counts_t;
+
+/**
+ *    Provides the signature of the function with which libxpccut_alloc
+ *    gives the library the counts of the calling thread.
+ */
+
+typedef xpccut_alloc_counts_t * (* xpccut_alloc_source_t) (void);
+
+/*
+ * Global functions for the allocation counts.
+ */
+
+EXTERN_C_DEC
+
+extern void xpccut_alloc_set_source (xpccut_alloc_source_t source);
+extern cbool_t xpccut_alloc_is_counting (void);
+extern cbool_t xpccut_alloc_read (xpccut_alloc_counts_t * counts);
+extern cbool_t xpccut_alloc_difference
+(
+   const xpccut_alloc_counts_t * c1,
+   const xpccut_alloc_counts_t * c2,
+   xpccut_alloc_counts_t * delta
+);
+extern void xpccut_alloc_pause (void);
+extern void xpccut_alloc_resume (void);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_ALLOC_COUNT_H */
+
+/*
+ * alloc_count.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,200 @@
+#ifndef XPCCUT_ARENA_H
+#define XPCCUT_ARENA_H
+
+/**
+ * \file          arena.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the arena, a bump-pointer allocator for the scratch buffers
+ *    of a test.  Also see the arena.c module, and the xpc::cut_arena class
+ *    of the C++ library.
+ *
+ *    An allocation from an arena is a pointer bump in its current chunk of
+ *    memory.  Nothing is freed one block at a time; instead, the arena goes
+ *    back to a mark, or is reset, in one step, and its chunks are kept for
+ *    the next test.  So a test that needs a large buffer in every sub-test
+ *    costs the allocator nothing after the first time.
+ *
+ *    Each thread that runs tests has a test arena, from
+ *    xpccut_test_arena().  The runner marks it before each test, and goes
+ *    back to the mark after the test, so the test need not free what it
+ *    allocated there; and a test that runs a test application of its own
+ *    keeps its own buffers.
+ *
+ *    With the --huge-pages option, the chunks of the test arenas are mapped
+ *    on huge pages where the system allows, which helps the tests that
+ *    sweep through large buffers.
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+#if XPC_HAVE_STDDEF_H
+#include <stddef.h>                    /* size_t                              */
+#endif
+
+/**
+ *    Provides the default size of the chunks of an arena, in bytes.  A
+ *    larger allocation gets a chunk of its own size.
+ */
+
+#define XPCCUT_ARENA_CHUNK_SIZE        (256 * 1024)
+
+/**
+ *    Provides the alignment of the blocks allocated from an arena.  It is
+ *    enough for any of the basic types, and for SSE vectors.
+ */
+
+#define XPCCUT_ARENA_ALIGNMENT         16
+
+/**
+ *    Provides the size of a huge page, to which the chunks are rounded up
+ *    when the arena uses huge pages.
+ */
+
+#define XPCCUT_ARENA_HUGE_PAGE_SIZE    (2 * 1024 * 1024)
+
+/**
+ *    Provides the options of an arena.
+ *
+ * \var XPCCUT_ARENA_NORMAL
+ *    The chunks are allocated with malloc().
+ *
+ * \var XPCCUT_ARENA_HUGE_PAGES
+ *    The chunks are mapped on explicit huge pages, if the system has some
+ *    reserved, or else on ordinary pages with a request for transparent
+ *    huge pages.  If the chunks cannot be mapped at all, malloc() is used.
+ */
+
+typedef enum
+{
+   XPCCUT_ARENA_NORMAL     = 0x00,
+   XPCCUT_ARENA_HUGE_PAGES = 0x01
+
+} xpccut_arena_flags_t;
+
+/**
+ *    Holds one chunk of an arena.  The memory handed out follows the
+ *    header, at the first aligned address.
+ */
+
+typedef struct xpccut_arena_chunk
+{
+   struct xpccut_arena_chunk * m_Next;    /**< The next chunk, or null.       */
+   size_t m_Size;                         /**< The bytes that can be used.    */
+   size_t m_Mapped_Size;                  /**< The size mapped, or 0.         */
+
+} xpccut_arena_chunk_t;
+
+/**
+ *    Holds an arena.  The chunks are kept in a list, in the order they are
+ *    used; the ones after m_Current are empty, and wait to be used again.
+ */
+
+typedef struct
+{
+   /**
+    *    The first chunk, or null if none has been allocated yet.
+    */
+
+   xpccut_arena_chunk_t * m_First;
+
+   /**
+    *    The chunk from which blocks are being allocated.
+    */
+
+   xpccut_arena_chunk_t * m_Current;
+
+   /**
+    *    The number of bytes used in m_Current.
+    */
+
+   size_t m_Used;
+
+   /**
+    *    The number of bytes handed out, including the padding for the
+    *    alignment, since the arena was reset.
+    */
+
+   size_t m_Allocated;
+
+   /**
+    *    The size of a new chunk.
+    */
+
+   size_t m_Chunk_Size;
+
+   /**
+    *    The options of the arena.
+    */
+
+   xpccut_arena_flags_t m_Flags;
+
+} xpccut_arena_t;
+
+/**
+ *    Holds a position in an arena, to which the arena can go back, freeing
+ *    everything allocated after it.
+ */
+
+typedef struct
+{
+   xpccut_arena_chunk_t * m_Chunk;        /**< The chunk in use, or null.     */
+   size_t m_Used;                         /**< The bytes used in m_Chunk.     */
+   size_t m_Allocated;                    /**< m_Allocated of the arena.      */
+   cbool_t m_Is_Set;                      /**< The mark was taken.            */
+
+} xpccut_arena_mark_t;
+
+/*
+ * Global functions for arenas.
+ */
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_arena_init
+(
+   xpccut_arena_t * arena,
+   size_t chunksize,
+   xpccut_arena_flags_t flags
+);
+extern void xpccut_arena_destroy (xpccut_arena_t * arena);
+extern void * xpccut_arena_alloc (xpccut_arena_t * arena, size_t size);
+extern void * xpccut_arena_calloc
+(
+   xpccut_arena_t * arena,
+   size_t count,
+   size_t size
+);
+extern char * xpccut_arena_strdup (xpccut_arena_t * arena, const char * text);
+extern void xpccut_arena_mark
+(
+   xpccut_arena_t * arena,
+   xpccut_arena_mark_t * mark
+);
+extern void xpccut_arena_rewind
+(
+   xpccut_arena_t * arena,
+   xpccut_arena_mark_t * mark
+);
+extern void xpccut_arena_reset (xpccut_arena_t * arena);
+extern void xpccut_arena_trim (xpccut_arena_t * arena);
+extern size_t xpccut_arena_allocated (const xpccut_arena_t * arena);
+extern size_t xpccut_arena_capacity (const xpccut_arena_t * arena);
+extern xpccut_arena_t * xpccut_test_arena (void);
+extern void xpccut_test_arena_flags_set (xpccut_arena_flags_t flags);
+extern void xpccut_test_arena_release (void);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_ARENA_H */
+
+/*
+ * arena.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
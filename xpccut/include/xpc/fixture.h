@@ -0,0 +1,171 @@
+#ifndef XPCCUT_FIXTURE_H
+#define XPCCUT_FIXTURE_H
+
+/**
+ * \file          fixture.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the group-level fixtures loaded by unit_test_fixture() and
+ *    xpc::cut::load_fixture().  Also see the fixture.c module.
+ *
+ *    A fixture is state that the cases of one test group share, such as a
+ *    large table, a parsed configuration, or an open socket.  Its setup
+ *    function is called the first time a case of the group is about to be
+ *    run, so a group that is filtered out by --group, --case, or
+ *    --shard-index never sets it up.  Its teardown function is called
+ *    after the last case of the group is done, or at the end of the run,
+ *    whichever comes first.
+ *
+ *    Only the tests loaded with their group number, by unit_test_register()
+ *    or one of the C++ load functions that take the group information,
+ *    belong to a group.
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+/**
+ *    Provides the signature of the setup function of a fixture.  The
+ *    function makes the shared state, and stores a pointer to it in
+ *    \a data; the pointer can be null, if the state is static.
+ *
+ * \return
+ *    The function returns 'true' if the setup worked.  If it returns
+ *    'false', no case of the group is called; each one fails instead.
+ */
+
+typedef cbool_t (* unit_test_setup_func_t)
+(
+   void ** data                           /**< Receives the shared state.     */
+);
+
+/**
+ *    Provides the signature of the teardown function of a fixture.  It is
+ *    given the pointer stored by the setup function.
+ */
+
+typedef void (* unit_test_teardown_func_t)
+(
+   void * data                            /**< The shared state.              */
+);
+
+/**
+ *    Provides values for the m_State field of unit_test_fixture_t.
+ */
+
+typedef enum
+{
+   XPCCUT_FIXTURE_DOWN,                   /**< Not set up, or torn down.      */
+   XPCCUT_FIXTURE_UP,                     /**< The setup worked.              */
+   XPCCUT_FIXTURE_FAILED                  /**< The setup did not work.        */
+
+} unit_test_fixture_state_t;
+
+/**
+ *    Holds one fixture.
+ */
+
+typedef struct
+{
+   /**
+    *    The group number of the cases that share the fixture.
+    */
+
+   int m_Test_Group;
+
+   /**
+    *    The function that sets up the fixture.
+    */
+
+   unit_test_setup_func_t m_Setup;
+
+   /**
+    *    The function that tears down the fixture, or null.
+    */
+
+   unit_test_teardown_func_t m_Teardown;
+
+   /**
+    *    The pointer stored by m_Setup.
+    */
+
+   void * m_Data;
+
+   /**
+    *    The number of cases of the group that have not been done yet in
+    *    this run.  It is set by xpccut_fixture_expect().
+    */
+
+   int m_Remaining;
+
+   /**
+    *    Indicates if the fixture is set up.  A setup that failed is not
+    *    tried again in the same run.
+    */
+
+   unit_test_fixture_state_t m_State;
+
+} unit_test_fixture_t;
+
+/**
+ *    Holds the fixtures of a unit_test_t structure.
+ */
+
+typedef struct
+{
+   /**
+    *    The fixtures, in no particular order.
+    */
+
+   unit_test_fixture_t * m_Fixtures;
+
+   /**
+    *    The number of fixtures in m_Fixtures.
+    */
+
+   int m_Count;
+
+} unit_test_fixture_list_t;
+
+EXTERN_C_DEC
+
+extern void xpccut_fixture_init (unit_test_fixture_list_t * list);
+extern cbool_t xpccut_fixture_add
+(
+   unit_test_fixture_list_t * list,
+   int testgroup,
+   unit_test_setup_func_t setup,
+   unit_test_teardown_func_t teardown
+);
+extern void xpccut_fixture_expect
+(
+   unit_test_fixture_list_t * list,
+   int testgroup
+);
+extern cbool_t xpccut_fixture_enter
+(
+   unit_test_fixture_list_t * list,
+   int testgroup
+);
+extern void xpccut_fixture_leave
+(
+   unit_test_fixture_list_t * list,
+   int testgroup
+);
+extern void xpccut_fixture_release (unit_test_fixture_list_t * list);
+extern void xpccut_fixture_destroy (unit_test_fixture_list_t * list);
+extern void * xpccut_fixture_data (void);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_FIXTURE_H */
+
+/*
+ * fixture.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -6,13 +6,14 @@
  * \library       xpccut
  * \author        Chris Ahlstrom
  * \date          2010-03-06
- * \updates       2015-10-06
+ * \updates       2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
  *    Provides a function to generate random strings for testing.
  */
 
+#include <xpc/arena.h>                 /* xpccut_arena_t                      */
 #include <xpc/macros_subset.h>         /* support for special XPC features    */
 
 #if XPC_HAVE_STDLIB_H
@@ -56,6 +57,12 @@
  *    by xpccut_fuzz().  The size goes from 0 to the \a number_of_bytes
  *    parameter of the xpc_fuzz() function.
  *
+ * \var XPCCUT_FF_BULK
+ *    Generates the string with xpccut_fuzz_fill(), using the generator of
+ *    the calling thread.  This is much faster for long strings.  A seed
+ *    still always gives the same string, but not the string it gives
+ *    without this flag.
+ *
  * \var XPCCUT_FF_DUMP_CHARSET
  *     Do not generate a fuzz string.  Instead, copy the final character set
  *     to the destination.  This is a test option for the xpccut_fuzz()
@@ -74,6 +81,7 @@ typedef enum
    XPCCUT_FF_LETTERS_ONLY           = 0x0010,
    XPCCUT_FF_NUMBERS_ONLY           = 0x0020,
    XPCCUT_FF_RANDOM_SIZE            = 0x0040,
+   XPCCUT_FF_BULK                   = 0x0080,
    XPCCUT_FF_DUMP_CHARSET           = 0x8000
 
 } xpccut_fuzz_flags_t;
@@ -105,6 +113,208 @@ typedef enum
 
 } xpccut_seed_options_t;
 
+/**
+ *    Provides the size of the ring buffer, or feedback window, of the
+ *    glibc-compatible engine.
+ */
+
+#define XPCCUT_RAND_DEGREES          31
+
+/**
+ *    Selects the engine of an xpccut_rng_t random-number generator.
+ *
+ * \var XPCCUT_RNG_GLIBC
+ *    Duplicates the GNU random() generator, on any platform.  This is the
+ *    default, and seeds used with earlier versions of the library still
+ *    give the same sequences.
+ *
+ * \var XPCCUT_RNG_XOSHIRO
+ *    Uses the xoshiro256** generator, which is faster, and has much better
+ *    statistical properties.
+ */
+
+typedef enum
+{
+   XPCCUT_RNG_GLIBC,
+   XPCCUT_RNG_XOSHIRO
+
+} xpccut_rng_engine_t;
+
+/**
+ *    Holds the state of a random-number generator.  The state is kept in
+ *    this object, rather than in static data, so that generators can be
+ *    owned by the caller, and used in any number of threads.  Use
+ *    xpccut_rng_init() to seed it, and do not touch the fields directly.
+ */
+
+typedef struct
+{
+   /**
+    *    The engine that generates the numbers.
+    */
+
+   xpccut_rng_engine_t m_Engine;
+
+   /**
+    *    The seed last given to xpccut_rng_init().
+    */
+
+   unsigned int m_Seed;
+
+   /**
+    *    The ring buffer of the XPCCUT_RNG_GLIBC engine.
+    */
+
+   unsigned int m_R[XPCCUT_RAND_DEGREES];
+
+   /**
+    *    The cursor in m_R[] of the next value to replace.
+    */
+
+   int m_R_Counter;
+
+   /**
+    *    The state of the XPCCUT_RNG_XOSHIRO engine.
+    */
+
+   unsigned long long m_S[4];
+
+} xpccut_rng_t;
+
+/**
+ *    Holds a character set built by xpccut_fuzz_charset_init(), along with
+ *    the table that maps random bytes onto it for xpccut_fuzz_fill().  Once
+ *    built, it is only read, so one set can be shared by any number of
+ *    threads.  Do not touch the fields directly.
+ */
+
+typedef struct
+{
+   /**
+    *    The number of characters in the set, 0 if the set is empty.
+    */
+
+   int m_Size;
+
+   /**
+    *    The characters of the set.  The null character is never one of
+    *    them.
+    */
+
+   char m_Characters[256];
+
+   /**
+    *    Maps each random byte value to a character of the set.  Each
+    *    character appears equally often in this table, and the byte values
+    *    left over map to 0, meaning that the byte is to be thrown away, so
+    *    that no character is favored.
+    */
+
+   unsigned char m_Map[256];
+
+} xpccut_fuzz_charset_t;
+
+/**
+ *    Provides the number of fuzz characters in each block of a fuzz
+ *    stream.  Each block has a generator of its own, seeded from the seed of
+ *    the stream and the number of the block.
+ */
+
+#define XPCCUT_FUZZ_STREAM_BLOCK   4096
+
+/**
+ *    Receives the chunks of a fuzz stream from xpccut_fuzz_stream_generate().
+ *    It returns 'false' to stop the stream early.
+ */
+
+typedef cbool_t (* xpccut_fuzz_sink_t)
+(
+   void * context,            /**< The pointer given to the generate call.    */
+   const char * data,         /**< The chunk, which is not null-terminated.   */
+   int count                  /**< The number of bytes in the chunk.          */
+);
+
+/**
+ *    Holds a generator of fuzz data of any length, which is made in chunks
+ *    rather than in one caller-owned buffer.  Use xpccut_fuzz_stream_init()
+ *    to set it up, and do not touch the fields directly.
+ *
+ *    The stream is the prologue, then the fuzz characters, then the
+ *    epilogue.  Each fuzz character depends only on the seed, the character
+ *    set, and its own offset, so any chunk can be made again from the seed
+ *    and the offset, without making the chunks before it.
+ *
+ *    The prologue and epilogue are kept by pointer, so they must outlive the
+ *    stream.  A stream can be used by one thread at a time.
+ */
+
+typedef struct
+{
+   /**
+    *    The character set of the fuzz characters.
+    */
+
+   xpccut_fuzz_charset_t m_Charset;
+
+   /**
+    *    The seed of the stream.
+    */
+
+   unsigned int m_Seed;
+
+   /**
+    *    The total length of the stream, including the prologue and
+    *    epilogue.
+    */
+
+   long long m_Length;
+
+   /**
+    *    The string that starts the stream, or null.
+    */
+
+   const char * m_Prologue;
+
+   /**
+    *    The length of m_Prologue.
+    */
+
+   int m_Prologue_Length;
+
+   /**
+    *    The string that ends the stream, or null.
+    */
+
+   const char * m_Epilogue;
+
+   /**
+    *    The length of m_Epilogue.
+    */
+
+   int m_Epilogue_Length;
+
+   /**
+    *    The offset of the next byte returned by xpccut_fuzz_stream_next().
+    */
+
+   long long m_Offset;
+
+   /**
+    *    The number of the block of fuzz characters held in m_Block[], or -1
+    *    if no block has been made yet.
+    */
+
+   long long m_Block_Index;
+
+   /**
+    *    The fuzz characters of the latest block, so that a series of small
+    *    reads makes each block only once.
+    */
+
+   char m_Block[XPCCUT_FUZZ_STREAM_BLOCK];
+
+} xpccut_fuzz_stream_t;
+
 /*
  * Portable C functions.  Global and portable functions for some common, basic
  * tasks.
@@ -126,15 +336,112 @@ extern unsigned int xpccut_fuzz
    const char * epilogue
 );
 
+extern cbool_t xpccut_fuzz_charset_init
+(
+   xpccut_fuzz_charset_t * charset,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+);
+extern cbool_t xpccut_fuzz_fill
+(
+   xpccut_rng_t * rng,
+   const xpccut_fuzz_charset_t * charset,
+   char * destination,
+   int count
+);
+extern cbool_t xpccut_fuzz_stream_init
+(
+   xpccut_fuzz_stream_t * stream,
+   long long length,
+   unsigned int seed,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars,
+   const char * prologue,
+   const char * epilogue
+);
+extern long long xpccut_fuzz_stream_length
+(
+   const xpccut_fuzz_stream_t * stream
+);
+extern unsigned int xpccut_fuzz_stream_seed
+(
+   const xpccut_fuzz_stream_t * stream
+);
+extern int xpccut_fuzz_stream_read
+(
+   xpccut_fuzz_stream_t * stream,
+   long long offset,
+   char * destination,
+   int count
+);
+extern int xpccut_fuzz_stream_next
+(
+   xpccut_fuzz_stream_t * stream,
+   char * destination,
+   int count
+);
+extern cbool_t xpccut_fuzz_stream_generate
+(
+   xpccut_fuzz_stream_t * stream,
+   xpccut_fuzz_sink_t sink,
+   void * context
+);
 extern void xpccut_dump_string (const char * source, int source_length);
 extern unsigned int xpccut_srandom (unsigned int seed);
 extern unsigned int xpccut_random (void);
 extern unsigned int xpccut_rand (int rangemax);
+extern cbool_t xpccut_rng_init
+(
+   xpccut_rng_t * rng,
+   xpccut_rng_engine_t engine,
+   unsigned int seed
+);
+extern unsigned int xpccut_rng_next (xpccut_rng_t * rng);
+extern unsigned int xpccut_rng_range (xpccut_rng_t * rng, int rangemax);
+extern cbool_t xpccut_rng_fill
+(
+   xpccut_rng_t * rng,
+   unsigned int * destination,
+   int count
+);
+extern cbool_t xpccut_rng_fill_bytes
+(
+   xpccut_rng_t * rng,
+   unsigned char * destination,
+   int count
+);
+extern xpccut_rng_t * xpccut_rng_default (void);
 extern int xpccut_garbled_string
 (
    char * source,
    int length
 );
+extern int xpccut_rng_garbled_string
+(
+   xpccut_rng_t * rng,
+   char * source,
+   int length
+);
+extern char * xpccut_arena_fuzz
+(
+   xpccut_arena_t * arena,
+   int number_of_bytes,
+   unsigned int * seed,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars,
+   const char * prologue,
+   const char * epilogue
+);
+extern char * xpccut_arena_garbled_string
+(
+   xpccut_arena_t * arena,
+   const char * source,
+   int length,
+   int * changes
+);
 
 EXTERN_C_END
 
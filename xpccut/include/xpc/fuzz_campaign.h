@@ -0,0 +1,210 @@
+#ifndef XPCCUT_FUZZ_CAMPAIGN_H
+#define XPCCUT_FUZZ_CAMPAIGN_H
+
+/**
+ * \file          fuzz_campaign.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides fuzz campaigns, which run a number of coverage-guided
+ *    fuzzers at once, one per worker thread, so that the fuzzing done in a
+ *    given time grows with the number of cores.  Also see the
+ *    fuzz_campaign.c module.
+ *
+ *    Each worker has its own seed, derived from the base seed of the
+ *    campaign by xpccut_campaign_seed(), and its own corpus.  The workers
+ *    fuzz in rounds of XPCCUT_CAMPAIGN_ROUND runs; between rounds, each
+ *    worker shares the inputs it has kept since the last round, and takes
+ *    in the ones the other workers have shared.  The number of workers is
+ *    usually taken from the --fuzz-jobs option, with
+ *    unit_test_options_fuzz_job_count().
+ *
+ *    The target function is called from all of the workers at once, so it
+ *    must be thread-safe.  A campaign of one worker gives the very same
+ *    runs as a lone xpccut_guided_fuzz_t with the base seed.
+ */
+
+#include <xpc/guided_fuzz.h>           /* xpccut_guided_fuzz_t, etc.          */
+
+/**
+ *    Provides the number of runs of the target that a worker makes between
+ *    exchanges of inputs with the other workers.
+ */
+
+#define XPCCUT_CAMPAIGN_ROUND           1024
+
+/**
+ *    Holds one worker of a fuzz campaign.  Do not touch the fields
+ *    directly.
+ */
+
+typedef struct
+{
+   /**
+    *    The fuzzer of the worker.
+    */
+
+   xpccut_guided_fuzz_t m_Fuzzer;
+
+   /**
+    *    The number of inputs of the corpus of m_Fuzzer that have already
+    *    been shared with, or taken from, the other workers.
+    */
+
+   int m_Published;
+
+   /**
+    *    The number of shared inputs that the worker has already looked at.
+    */
+
+   int m_Imported;
+
+   /**
+    *    The number of runs that the worker has made in the current call of
+    *    xpccut_campaign_run().
+    */
+
+   long long m_Runs;
+
+   /**
+    *    Indicates that the worker has used up its budget, or has failed.
+    */
+
+   cbool_t m_Is_Done;
+
+} xpccut_campaign_worker_t;
+
+/**
+ *    Holds the state of a fuzz campaign.  Use xpccut_campaign_init() to
+ *    set it up, xpccut_campaign_free() to release it, and do not touch the
+ *    fields directly.
+ */
+
+typedef struct
+{
+   /**
+    *    The number of workers.
+    */
+
+   int m_Job_Count;
+
+   /**
+    *    The workers, m_Job_Count of them.
+    */
+
+   xpccut_campaign_worker_t * m_Workers;
+
+   /**
+    *    The inputs shared by the workers, in the order they were shared.
+    */
+
+   char ** m_Shared;
+
+   /**
+    *    The size of each input in m_Shared.
+    */
+
+   int * m_Shared_Sizes;
+
+   /**
+    *    The index of the worker that shared each input in m_Shared.
+    */
+
+   int * m_Shared_Owners;
+
+   /**
+    *    The number of inputs in m_Shared.
+    */
+
+   int m_Shared_Count;
+
+   /**
+    *    The number of inputs that m_Shared can hold before it is enlarged.
+    */
+
+   int m_Shared_Capacity;
+
+   /**
+    *    The index of the worker whose target failed first, or -1.
+    */
+
+   int m_Failed_Job;
+
+   /**
+    *    The lock that protects the shared inputs and m_Failed_Job, or null
+    *    if the workers run in turn in the calling thread.
+    */
+
+   void * m_Lock;
+
+} xpccut_campaign_t;
+
+EXTERN_C_DEC
+
+extern unsigned int xpccut_campaign_seed (unsigned int seed, int job);
+extern cbool_t xpccut_campaign_init
+(
+   xpccut_campaign_t * campaign,
+   int jobs,
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+);
+extern void xpccut_campaign_free (xpccut_campaign_t * campaign);
+extern cbool_t xpccut_campaign_add
+(
+   xpccut_campaign_t * campaign,
+   const char * data,
+   int size
+);
+extern cbool_t xpccut_campaign_directory
+(
+   xpccut_campaign_t * campaign,
+   const char * directory
+);
+extern cbool_t xpccut_campaign_run
+(
+   xpccut_campaign_t * campaign,
+   xpccut_fuzz_target_t target,
+   void * context,
+   long long max_iterations,
+   double max_ms
+);
+extern const char * xpccut_campaign_crash
+(
+   const xpccut_campaign_t * campaign,
+   int * size
+);
+extern const char * xpccut_campaign_crash_file
+(
+   const xpccut_campaign_t * campaign
+);
+extern const xpccut_guided_fuzz_t * xpccut_campaign_fuzzer
+(
+   const xpccut_campaign_t * campaign,
+   int job
+);
+extern int xpccut_campaign_job_count (const xpccut_campaign_t * campaign);
+extern int xpccut_campaign_failed_job (const xpccut_campaign_t * campaign);
+extern int xpccut_campaign_shared_count (const xpccut_campaign_t * campaign);
+extern int xpccut_campaign_edge_count (const xpccut_campaign_t * campaign);
+extern long long xpccut_campaign_iterations
+(
+   const xpccut_campaign_t * campaign
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_FUZZ_CAMPAIGN_H */
+
+/*
+ * fuzz_campaign.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,143 @@
+#ifndef XPCCUT_FUZZ_CORPUS_H
+#define XPCCUT_FUZZ_CORPUS_H
+
+/**
+ * \file          fuzz_corpus.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides corpus files, which keep fuzz inputs from one run to the
+ *    next, so that failing and interesting inputs are not lost.  Also see
+ *    the fuzz_corpus.c module.
+ *
+ *    A corpus file holds any number of inputs in one file, rather than one
+ *    file per input, so that tens of thousands of them can be loaded with
+ *    one open() and one mmap().  The format is the 8-byte magic string
+ *    XPCCUT_CORPUS_MAGIC, followed by the inputs, each of which is its size
+ *    as 4 bytes, least-significant first, followed by its bytes.  Inputs
+ *    are only ever appended, and an input cut short at the end of the file,
+ *    as by a crash during the write, is ignored.
+ */
+
+#include <xpc/guided_fuzz.h>           /* xpccut_fuzz_target_t                */
+
+/**
+ *    Provides the magic string that starts a corpus file.
+ */
+
+#define XPCCUT_CORPUS_MAGIC            "XPCCUTC1"
+
+/**
+ *    Provides the length of XPCCUT_CORPUS_MAGIC.
+ */
+
+#define XPCCUT_CORPUS_MAGIC_SIZE       8
+
+/**
+ *    Provides the name of the corpus file of interesting inputs in a
+ *    corpus directory.
+ */
+
+#define XPCCUT_CORPUS_FILE             "corpus.xcc"
+
+/**
+ *    Provides the name of the corpus file of failing inputs in a corpus
+ *    directory.  Each failing input is also written to a file of its own,
+ *    named "crash-" plus a hash of its bytes, which can be fed to the code
+ *    under test by hand.
+ */
+
+#define XPCCUT_CRASHES_FILE            "crashes.xcc"
+
+/**
+ *    Holds a corpus file loaded for reading.  The file is mapped into
+ *    memory where mmap() is available, and read into memory otherwise, so
+ *    the inputs are used where they lie, without copying.  Use
+ *    xpccut_corpus_open() and xpccut_corpus_close(), and do not touch the
+ *    fields directly.
+ */
+
+typedef struct
+{
+   /**
+    *    The contents of the file, or null if the file is empty or missing.
+    */
+
+   const char * m_Data;
+
+   /**
+    *    The size of the file, in bytes.
+    */
+
+   long long m_Size;
+
+   /**
+    *    The offset just past the last whole input in the file.
+    */
+
+   long long m_End;
+
+   /**
+    *    The number of whole inputs in the file.
+    */
+
+   int m_Count;
+
+   /**
+    *    Indicates that m_Data is mapped, rather than allocated.
+    */
+
+   cbool_t m_Is_Mapped;
+
+} xpccut_corpus_t;
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_corpus_open
+(
+   xpccut_corpus_t * corpus,
+   const char * filename
+);
+extern void xpccut_corpus_close (xpccut_corpus_t * corpus);
+extern int xpccut_corpus_count (const xpccut_corpus_t * corpus);
+extern const char * xpccut_corpus_next
+(
+   const xpccut_corpus_t * corpus,
+   long long * cursor,
+   int * size
+);
+extern cbool_t xpccut_corpus_replay
+(
+   const xpccut_corpus_t * corpus,
+   xpccut_fuzz_target_t target,
+   void * context,
+   int * failed_index
+);
+extern cbool_t xpccut_corpus_create (const char * filename);
+extern cbool_t xpccut_corpus_append
+(
+   const char * filename,
+   const char * data,
+   int size
+);
+extern cbool_t xpccut_corpus_path
+(
+   char * destination,
+   int dlength,
+   const char * directory,
+   const char * filename
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_FUZZ_CORPUS_H */
+
+/*
+ * fuzz_corpus.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,263 @@
+#ifndef XPCCUT_GUIDED_FUZZ_H
+#define XPCCUT_GUIDED_FUZZ_H
+
+/**
+ * \file          guided_fuzz.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides a coverage-guided fuzzer, which keeps the inputs that reach
+ *    new code, and mutates them further, so that deep states of a parser
+ *    are reached in far fewer runs than with purely random input.  Also
+ *    see the guided_fuzz.c module.
+ *
+ *    The coverage comes from the code under test.  Compile that code (but
+ *    not the xpccut library itself) with the GCC or Clang option
+ *    "-fsanitize-coverage=trace-pc-guard", and its edges are recorded by the
+ *    hook functions in this library.  Code that cannot be compiled that way
+ *    can instead mark its own points of interest with
+ *    xpccut_coverage_hit().
+ *
+ *    A fuzzer can also keep its corpus in a directory, given by
+ *    xpccut_guided_directory(), so that the inputs it finds, and the one
+ *    that fails, are run again first by the next run of the fuzzer.  See
+ *    the fuzz_corpus.h module.
+ */
+
+#include <xpc/fuzz.h>                  /* xpccut_rng_t, xpccut_fuzz_charset_t */
+
+/**
+ *    Provides the number of edges in a coverage map.  Edge numbers are
+ *    taken modulo this size.
+ */
+
+#define XPCCUT_COVERAGE_MAP_SIZE       16384
+
+/**
+ *    Provides the largest number of inputs kept in the corpus of a guided
+ *    fuzzer.  Once it is full, inputs that reach new edges still add those
+ *    edges to the coverage, but are not kept.
+ */
+
+#define XPCCUT_GUIDED_CORPUS_MAX        4096
+
+/**
+ *    Provides the largest number of mutations stacked onto one input.
+ */
+
+#define XPCCUT_GUIDED_MUTATIONS            4
+
+/**
+ *    Provides the size of the buffers for the names of the files in a
+ *    corpus directory.
+ */
+
+#define XPCCUT_CORPUS_PATH_MAX          1024
+
+/**
+ *    Provides the signature of the function fuzzed by a guided fuzzer.  It
+ *    returns 'false' if the input reveals a bug, such as a failed check;
+ *    the fuzzer then stops, and keeps that input.
+ */
+
+typedef cbool_t (* xpccut_fuzz_target_t)
+(
+   void * context,            /**< The pointer given to xpccut_guided_run().  */
+   const char * data,         /**< The input, which is not null-terminated.   */
+   int size                   /**< The number of bytes in the input.          */
+);
+
+/**
+ *    Holds the state of a coverage-guided fuzzer.  Use xpccut_guided_init()
+ *    to set it up, xpccut_guided_free() to release it, and do not touch the
+ *    fields directly.  A fuzzer can be used by one thread at a time; only
+ *    the coverage of the thread that calls xpccut_guided_run() is seen.
+ */
+
+typedef struct
+{
+   /**
+    *    The generator that drives the choice and the mutation of inputs.
+    */
+
+   xpccut_rng_t m_Rng;
+
+   /**
+    *    The characters used for inserted and overwritten bytes.  The
+    *    garbling mutation can produce any byte value.
+    */
+
+   xpccut_fuzz_charset_t m_Charset;
+
+   /**
+    *    The largest size of an input.
+    */
+
+   int m_Max_Size;
+
+   /**
+    *    The inputs kept because they reached new edges, plus the ones given
+    *    to xpccut_guided_add().
+    */
+
+   char ** m_Corpus;
+
+   /**
+    *    The size of each input in m_Corpus.
+    */
+
+   int * m_Corpus_Sizes;
+
+   /**
+    *    The number of inputs in m_Corpus.
+    */
+
+   int m_Corpus_Count;
+
+   /**
+    *    The number of inputs that m_Corpus can hold before it is enlarged.
+    */
+
+   int m_Corpus_Capacity;
+
+   /**
+    *    The number of inputs in m_Corpus that have already been run.
+    */
+
+   int m_Corpus_Run;
+
+   /**
+    *    The edges reached by the latest run, one byte per edge.
+    */
+
+   unsigned char * m_Map;
+
+   /**
+    *    The edges reached by any run so far.
+    */
+
+   unsigned char * m_Seen;
+
+   /**
+    *    The number of edges set in m_Seen.
+    */
+
+   int m_Edge_Count;
+
+   /**
+    *    The number of times the target has been called.
+    */
+
+   long long m_Iterations;
+
+   /**
+    *    The buffer in which each input is built, holding m_Max_Size + 1
+    *    bytes.
+    */
+
+   char * m_Input;
+
+   /**
+    *    A copy of the input that made the target fail, holding m_Max_Size +
+    *    1 bytes.
+    */
+
+   char * m_Crash;
+
+   /**
+    *    The size of the input in m_Crash, or -1 if the target has not
+    *    failed.
+    */
+
+   int m_Crash_Size;
+
+   /**
+    *    The corpus directory given to xpccut_guided_directory(), or null if
+    *    the inputs are kept only in memory.
+    */
+
+   char * m_Directory;
+
+   /**
+    *    The name of the file to which the failing input was written, which
+    *    is empty if there is none.  It holds XPCCUT_CORPUS_PATH_MAX bytes,
+    *    and is allocated along with m_Directory.
+    */
+
+   char * m_Crash_File;
+
+} xpccut_guided_fuzz_t;
+
+EXTERN_C_DEC
+
+extern void xpccut_coverage_hit (unsigned int edge);
+extern void __sanitizer_cov_trace_pc_guard_init
+(
+   unsigned int * start,
+   unsigned int * stop
+);
+extern void __sanitizer_cov_trace_pc_guard (unsigned int * guard);
+extern cbool_t xpccut_guided_init
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+);
+extern void xpccut_guided_free (xpccut_guided_fuzz_t * fuzzer);
+extern cbool_t xpccut_guided_add
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   const char * data,
+   int size
+);
+extern cbool_t xpccut_guided_directory
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   const char * directory
+);
+extern cbool_t xpccut_guided_run
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   xpccut_fuzz_target_t target,
+   void * context,
+   long long max_iterations,
+   double max_ms
+);
+extern const char * xpccut_guided_crash
+(
+   const xpccut_guided_fuzz_t * fuzzer,
+   int * size
+);
+extern const char * xpccut_guided_crash_file
+(
+   const xpccut_guided_fuzz_t * fuzzer
+);
+extern const char * xpccut_guided_corpus_entry
+(
+   const xpccut_guided_fuzz_t * fuzzer,
+   int index,
+   int * size
+);
+extern int xpccut_guided_corpus_count (const xpccut_guided_fuzz_t * fuzzer);
+extern int xpccut_guided_edge_count (const xpccut_guided_fuzz_t * fuzzer);
+extern long long xpccut_guided_iterations
+(
+   const xpccut_guided_fuzz_t * fuzzer
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_GUIDED_FUZZ_H */
+
+/*
+ * guided_fuzz.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
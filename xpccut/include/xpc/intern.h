@@ -0,0 +1,113 @@
+#ifndef XPCCUT_INTERN_H
+#define XPCCUT_INTERN_H
+
+/**
+ * \file          intern.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the tables of interned strings that hold the group, case,
+ *    and sub-test names of the unit_test_status_t structure.  Also see the
+ *    intern.c module.
+ *
+ *    Interning a string gives a pointer to one shared copy of it.  A status
+ *    can then hold its names as pointers, which are cheap to copy when the
+ *    status is returned by value, and the names are not cut short at
+ *    XPCCUT_STRLEN.
+ *
+ *    Each unit_test_t has a table of its own, which its options point to,
+ *    so the names of the statuses of a run last until that run is
+ *    destroyed, and no longer.  The same names come up again in every
+ *    round of --repeat, so a table grows with the number of different
+ *    names a run gives, not with the number of times they are given.  A
+ *    status that has no run behind it uses the table of xpccut_intern(),
+ *    which lasts until the last unit_test_t is destroyed (see
+ *    xpccut_intern_acquire()).
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+#if XPC_HAVE_STDDEF_H
+#include <stddef.h>                    /* size_t                              */
+#endif
+
+/**
+ *    Provides the number of stripes of a table.  Each stripe has a lock
+ *    of its own, so that the threads that add different names seldom wait
+ *    for each other.  It must be a power of 2.
+ */
+
+#define XPCCUT_INTERN_STRIPES          8
+
+/**
+ *    Holds one stripe of a table of interned strings, which holds the
+ *    strings whose hash falls in it.  The fields are private to intern.c.
+ */
+
+typedef struct
+{
+   const char ** m_Slots;                 /**< The open-addressed slots.      */
+   int m_Slot_Count;                      /**< The number of m_Slots.         */
+   int m_String_Count;                    /**< The strings in the stripe.     */
+   struct xpccut_intern_block * m_Block;  /**< The newest block of text.      */
+   int m_Block_Room;                      /**< The size of that block.        */
+   int m_Block_Count;                     /**< The number of blocks.          */
+
+} xpccut_intern_stripe_t;
+
+/**
+ *    Holds a table of interned strings.  See
+ *    xpccut_intern_table_init().
+ */
+
+typedef struct
+{
+   /**
+    *    The stripes of the table.
+    */
+
+   xpccut_intern_stripe_t m_Stripes[XPCCUT_INTERN_STRIPES];
+
+   /**
+    *    The number of the table, never used by another one, so that the
+    *    caches of the threads can tell which table an entry came from.
+    */
+
+   unsigned m_Id;
+
+} xpccut_intern_table_t;
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_intern_table_init (xpccut_intern_table_t * table);
+extern void xpccut_intern_table_destroy (xpccut_intern_table_t * table);
+extern const char * xpccut_intern_in
+(
+   xpccut_intern_table_t * table,
+   const char * text
+);
+extern void * xpccut_intern_table_alloc
+(
+   xpccut_intern_table_t * table,
+   size_t size
+);
+extern int xpccut_intern_table_count (xpccut_intern_table_t * table);
+extern int xpccut_intern_table_blocks (xpccut_intern_table_t * table);
+extern const char * xpccut_intern (const char * text);
+extern int xpccut_intern_count (void);
+extern void xpccut_intern_acquire (void);
+extern void xpccut_intern_release (void);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_INTERN_H */
+
+/*
+ * intern.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -502,6 +502,28 @@ typedef int cbool_t;                   /* our C boolean type                  */
 
 #endif                                                /* end of POSIX/Win32   */
 
+/**
+ *    Provides a storage class for static data that each thread needs its
+ *    own copy of.  For example, the state of the xpccut_random() generator
+ *    is thread-local, so that unit-tests run side by side by the --jobs
+ *    option do not draw numbers from each other's sequences.
+ *
+ *    If the compiler is not known to support thread-local storage, the
+ *    macro is empty, and the data is shared by all threads, as before.
+ */
+
+#ifndef XPCCUT_THREAD_LOCAL
+
+#if defined _MSC_VER                                  /* Visual Studio        */
+#define XPCCUT_THREAD_LOCAL   __declspec(thread)
+#elif __GNUC__ >= 4                                   /* GCC, clang, MingW    */
+#define XPCCUT_THREAD_LOCAL   __thread
+#else
+#define XPCCUT_THREAD_LOCAL
+#endif
+
+#endif   /* #ifndef XPCCUT_THREAD_LOCAL */
+
 /**
  *    Place EXTERN_C_DEC before any external function declarations in the C
  *    modules, and place EXTERN_C_END after them.  These macros allow C++
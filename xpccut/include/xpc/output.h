@@ -0,0 +1,114 @@
+#ifndef XPCCUT_OUTPUT_H
+#define XPCCUT_OUTPUT_H
+
+/**
+ * \file          output.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the buffered output layer through which the XPCCUT library
+ *    writes all of its messages.  Also see the output.c module.
+ *
+ *    Each thread collects its output in a buffer of its own, and hands the
+ *    buffer to the sink in one piece when it fills up, when the output
+ *    switches between stdout and stderr, and when xpccut_output_flush() is
+ *    called.  The library calls xpccut_output_flush() after each test,
+ *    before each prompt, and before fork().  The default sink is one
+ *    fwrite() per batch, instead of one locked fprintf() per line.
+ *
+ *    The report channel carries the machine-readable results of the tests,
+ *    which go to the file set by xpccut_output_set_report_file().  It has
+ *    a buffer of its own, so its records do not break up the batches of
+ *    console output, and it is captured and replayed along with the rest.
+ *
+ *    A test function that writes straight to stdout should use
+ *    xpccut_print() instead, or call xpccut_output_flush() first, so that
+ *    its output stays in order with the output of the library.
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+#include <stdarg.h>                    /* va_list                             */
+#include <stdio.h>                     /* FILE                                */
+
+/**
+ *    Provides the size of the output buffer of each thread.
+ */
+
+#define XPCCUT_OUTPUT_BUFFER_SIZE      4096
+
+/**
+ *    Selects the stream that a piece of output is meant for.
+ */
+
+typedef enum
+{
+   XPCCUT_OUTPUT_STDOUT,   /**< Normal output, such as progress and results.  */
+   XPCCUT_OUTPUT_STDERR,   /**< Error messages.                               */
+   XPCCUT_OUTPUT_REPORT    /**< Records for the report file.                  */
+
+} xpccut_output_channel_t;
+
+/**
+ *    Provides the signature of a function that takes a batch of output.
+ *    The text is not null-terminated.  Each thread has a sink of its own,
+ *    which only that thread calls.
+ */
+
+typedef void (* xpccut_output_sink_t)
+(
+   void * context,
+   xpccut_output_channel_t channel,
+   const char * text,
+   int length
+);
+
+EXTERN_C_DEC
+
+extern void xpccut_output_set_sink
+(
+   xpccut_output_sink_t sink,
+   void * context
+);
+extern xpccut_output_sink_t xpccut_output_get_sink (void ** context);
+extern void xpccut_output_write
+(
+   xpccut_output_channel_t channel,
+   const char * text,
+   int length
+);
+extern void xpccut_output_vprintf
+(
+   xpccut_output_channel_t channel,
+   const char * format,
+   va_list args
+);
+extern void xpccut_output_printf
+(
+   xpccut_output_channel_t channel,
+   const char * format,
+   ...
+);
+extern void xpccut_print (const char * format, ...);
+extern void xpccut_print_error (const char * format, ...);
+extern void xpccut_output_flush (void);
+extern void xpccut_output_set_report_file (FILE * report);
+extern FILE * xpccut_output_get_report_file (void);
+extern void xpccut_output_capture_begin (void);
+extern cbool_t xpccut_output_is_capturing (void);
+extern char * xpccut_output_capture_end (int * length);
+extern void xpccut_output_replay (const char * captured, int length);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_OUTPUT_H */
+
+/*
+ * output.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
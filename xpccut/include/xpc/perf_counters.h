@@ -0,0 +1,114 @@
+#ifndef XPCCUT_PERF_COUNTERS_H
+#define XPCCUT_PERF_COUNTERS_H
+
+/**
+ * \file          perf_counters.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides access to the hardware performance counters of the processor,
+ *    for the --perf-counters option.  Also see the perf_counters.c module.
+ *
+ *    Only Linux is supported, through perf_event_open().  On any other
+ *    platform, or if the kernel does not allow the counters to be opened
+ *    (see /proc/sys/kernel/perf_event_paranoid), the functions do nothing
+ *    and report that no counters are available.
+ */
+
+#include <xpc/macros_subset.h>         /* support for special XPC features    */
+
+/**
+ *    Provides the indices of the hardware counters in
+ *    xpccut_perf_values_t.
+ *
+ * \var XPCCUT_PERF_CYCLES
+ *    The number of CPU cycles.
+ *
+ * \var XPCCUT_PERF_INSTRUCTIONS
+ *    The number of instructions retired.
+ *
+ * \var XPCCUT_PERF_CACHE_MISSES
+ *    The number of last-level cache misses.
+ *
+ * \var XPCCUT_PERF_BRANCH_MISSES
+ *    The number of mispredicted branches.
+ *
+ * \var XPCCUT_PERF_COUNT
+ *    The number of counters.  Not a counter.
+ */
+
+typedef enum
+{
+   XPCCUT_PERF_CYCLES,
+   XPCCUT_PERF_INSTRUCTIONS,
+   XPCCUT_PERF_CACHE_MISSES,
+   XPCCUT_PERF_BRANCH_MISSES,
+   XPCCUT_PERF_COUNT
+
+} xpccut_perf_counter_t;
+
+/**
+ *    Holds a reading of the hardware counters of the calling thread, as
+ *    taken by xpccut_perf_read(), or the difference between two readings.
+ */
+
+typedef struct
+{
+   /**
+    *    Indicates that at least one of the counters could be read.
+    */
+
+   cbool_t m_Is_Valid;
+
+   /**
+    *    Indicates, for each counter, that its value could be read.  Not
+    *    every processor (or virtual machine) provides every counter.
+    */
+
+   cbool_t m_Have[XPCCUT_PERF_COUNT];
+
+   /**
+    *    The value of each counter, scaled up for the time the counter was
+    *    not running when the kernel had to share the hardware.
+    */
+
+   long long m_Values[XPCCUT_PERF_COUNT];
+
+} xpccut_perf_values_t;
+
+/*
+ * Global functions for the hardware counters.
+ */
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_perf_available (void);
+extern cbool_t xpccut_perf_read (xpccut_perf_values_t * values);
+extern cbool_t xpccut_perf_difference
+(
+   const xpccut_perf_values_t * v1,
+   const xpccut_perf_values_t * v2,
+   xpccut_perf_values_t * delta
+);
+extern void xpccut_perf_release (void);
+extern const char * xpccut_perf_counter_name (xpccut_perf_counter_t counter);
+extern void xpccut_perf_show
+(
+   const char * label,
+   const xpccut_perf_values_t * values,
+   double divisor
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_PERF_COUNTERS_H */
+
+/*
+ * perf_counters.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -6,7 +6,7 @@
  * \library       xpccut
  * \author        Chris Ahlstrom
  * \date          2008-03-07
- * \updates       2015-10-10
+ * \updates       2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
@@ -17,6 +17,7 @@
 #define USE_XPCCUT_NULLPTR_TEST        /* See unit_test_test_07_01()          */
 
 #include <xpc/macros_subset.h>         /* support for special XPC features    */
+#include <xpc/output.h>                /* xpccut_print() and friends          */
 
 #if XPC_HAVE_WINSOCK2_H
 #include <winsock2.h>				      /* struct timeval (Win32)              */
@@ -93,6 +94,132 @@
 
 #define XPCCUT_STRLEN         128
 
+/**
+ *    Provides a monotonic time-stamp, in nanoseconds from an arbitrary
+ *    starting point, as returned by xpccut_get_ticks().
+ *
+ *    Unlike struct timeval, a tick value is not affected by changes to the
+ *    wall-clock time, so the difference between two of them is never
+ *    negative.  Only differences between tick values are meaningful.  Even
+ *    64 bits of nanoseconds will not overflow for centuries.
+ */
+
+typedef unsigned long long xpccut_ticks_t;
+
+/**
+ *    The number of ticks (nanoseconds) in one millisecond.
+ */
+
+#define XPCCUT_TICKS_PER_MS   1000000ULL
+
+/**
+ *    The number of lap times kept by an xpccut_stopwatch_t.  Once more laps
+ *    than this have been taken, the oldest ones are dropped.
+ */
+
+#define XPCCUT_STOPWATCH_LAPS    16
+
+/**
+ *    Provides a stopwatch that the caller owns.
+ *
+ *    Unlike the global xpccut_stopwatch_start() stopwatch, any number of
+ *    these can exist at once, nested or in different threads, with no
+ *    locking, since all of the state is in the structure.  It also keeps a
+ *    short history of lap times.  See xpccut_stopwatch_init() and the
+ *    related functions.
+ */
+
+typedef struct
+{
+   /**
+    *    Indicates that xpccut_stopwatch_begin() has been called.
+    */
+
+   cbool_t m_Started;
+
+   /**
+    *    The tick value at which the stopwatch was started.
+    */
+
+   xpccut_ticks_t m_Start_Ticks;
+
+   /**
+    *    The tick value of the last lap, or of the start, if no lap has been
+    *    taken yet.
+    */
+
+   xpccut_ticks_t m_Lap_Ticks;
+
+   /**
+    *    The number of laps taken since the start, including any that have
+    *    been dropped from m_Laps_ms.
+    */
+
+   int m_Lap_Count;
+
+   /**
+    *    The most recent lap times, in milliseconds, used as a ring buffer.
+    *    Lap number n is held in m_Laps_ms[n % XPCCUT_STOPWATCH_LAPS].
+    */
+
+   double m_Laps_ms[XPCCUT_STOPWATCH_LAPS];
+
+} xpccut_stopwatch_t;
+
+/**
+ *    Holds a sample of the resources used by the calling thread, as taken
+ *    by xpccut_get_resources(), or the difference between two samples.
+ *    The counts are zero where the platform does not provide them.
+ */
+
+typedef struct
+{
+   /**
+    *    The CPU time spent in user mode, in milliseconds.
+    */
+
+   double m_User_ms;
+
+   /**
+    *    The CPU time spent in the kernel, in milliseconds.
+    */
+
+   double m_System_ms;
+
+   /**
+    *    The peak resident-set size, in kilobytes.  This value is a
+    *    high-water mark of the whole process, even when the other values
+    *    are for the calling thread only.
+    */
+
+   long m_Max_RSS_kb;
+
+   /**
+    *    The number of page faults that were resolved without I/O.
+    */
+
+   long m_Minor_Faults;
+
+   /**
+    *    The number of page faults that needed I/O.
+    */
+
+   long m_Major_Faults;
+
+   /**
+    *    The number of times the thread gave up the CPU by waiting.
+    */
+
+   long m_Voluntary_Switches;
+
+   /**
+    *    The number of times the thread was pre-empted.
+    */
+
+   long m_Involuntary_Switches;
+
+} xpccut_resources_t;
+
 /**
  *    Global and portable functions for some common, basic tasks.
  */
@@ -136,9 +263,32 @@ extern unsigned long xpccut_time_difference_ms
    struct timeval c1,
    struct timeval c2
 );
+extern xpccut_ticks_t xpccut_get_ticks (void);
+extern double xpccut_ticks_difference_ms
+(
+   xpccut_ticks_t t1,
+   xpccut_ticks_t t2
+);
 extern void xpccut_stopwatch_start (void);
 extern double xpccut_stopwatch_duration (void);
 extern double xpccut_stopwatch_lap (void);
+extern cbool_t xpccut_stopwatch_init (xpccut_stopwatch_t * sw);
+extern cbool_t xpccut_stopwatch_begin (xpccut_stopwatch_t * sw);
+extern double xpccut_stopwatch_elapsed (const xpccut_stopwatch_t * sw);
+extern double xpccut_stopwatch_next_lap (xpccut_stopwatch_t * sw);
+extern int xpccut_stopwatch_lap_count (const xpccut_stopwatch_t * sw);
+extern double xpccut_stopwatch_lap_ms
+(
+   const xpccut_stopwatch_t * sw,
+   int lap
+);
+extern cbool_t xpccut_get_resources (xpccut_resources_t * r);
+extern cbool_t xpccut_resources_difference
+(
+   const xpccut_resources_t * r1,
+   const xpccut_resources_t * r2,
+   xpccut_resources_t * delta
+);
 extern cbool_t xpccut_text_domain (void);
 
 /*
@@ -0,0 +1,175 @@
+#ifndef XPCCUT_REPORT_FORMAT_H
+#define XPCCUT_REPORT_FORMAT_H
+
+/**
+ * \file          report_format.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the machine-readable reports written by the --report-format
+ *    option.  Also see the report_format.c module.
+ *
+ *    A report is written as the tests run, one record per sub-test, so
+ *    that nothing but the record being written is kept in memory, and so
+ *    that the records of a run that crashes are not lost.  The records go
+ *    out through the XPCCUT_OUTPUT_REPORT channel of the output layer.
+ */
+
+#include <xpc/output.h>                /* XPCCUT_OUTPUT_REPORT                */
+
+/**
+ *    Selects the format of the report file.
+ */
+
+typedef enum
+{
+   /**
+    *    No report is written.  This is the default.
+    */
+
+   XPCCUT_REPORT_NONE,
+
+   /**
+    *    A JUnit XML file, with one \<testcase\> element per sub-test.  The
+    *    closing tags are written by xpccut_report_end(), so the file is
+    *    only well-formed if the run finishes.
+    */
+
+   XPCCUT_REPORT_JUNIT,
+
+   /**
+    *    JSON Lines, with one JSON object per sub-test, each on a line of its
+    *    own.
+    */
+
+   XPCCUT_REPORT_JSONL,
+
+   /**
+    *    The Test Anything Protocol, version 13, with one "ok" or "not ok"
+    *    line per sub-test, and the plan at the end.
+    */
+
+   XPCCUT_REPORT_TAP
+
+} unit_test_report_format_t;
+
+/**
+ *    Holds the result of one sub-test, for writing to the report.  The
+ *    names are not owned by the record.
+ */
+
+typedef struct
+{
+   /**
+    *    The group number of the test.
+    */
+
+   int m_Group;
+
+   /**
+    *    The group name of the test.
+    */
+
+   const char * m_Group_Name;
+
+   /**
+    *    The case number of the test.
+    */
+
+   int m_Case;
+
+   /**
+    *    The case name of the test.
+    */
+
+   const char * m_Case_Name;
+
+   /**
+    *    The number of the sub-test, or 0 for a test that has no sub-tests.
+    */
+
+   int m_Subtest;
+
+   /**
+    *    The name of the sub-test, or the empty string.
+    */
+
+   const char * m_Subtest_Name;
+
+   /**
+    *    The disposition of the sub-test, "passed", "failed", "skipped",
+    *    "aborted", or "cached" (a pass taken from the --cache-file).
+    */
+
+   const char * m_Disposition;
+
+   /**
+    *    The duration of the sub-test, in milliseconds.
+    */
+
+   double m_Duration_ms;
+
+   /**
+    *    The number of errors found by the sub-test.
+    */
+
+   int m_Error_Count;
+
+} xpccut_report_record_t;
+
+/**
+ *    Holds the durations of the runs of one test, for the summary written
+ *    by xpccut_report_repeats() after a --repeat run.
+ */
+
+typedef struct
+{
+   int m_Runs;                            /**< The number of runs.            */
+   int m_Failures;                        /**< The number that failed.        */
+   double m_Min_ms;                       /**< The shortest run.              */
+   double m_Mean_ms;                      /**< The mean of the runs.          */
+   double m_Max_ms;                       /**< The longest run.               */
+
+} xpccut_report_repeats_t;
+
+EXTERN_C_DEC
+
+extern void xpccut_report_begin
+(
+   unit_test_report_format_t format,
+   const char * name
+);
+extern void xpccut_report_record
+(
+   unit_test_report_format_t format,
+   const xpccut_report_record_t * record
+);
+extern void xpccut_report_repeats
+(
+   unit_test_report_format_t format,
+   const xpccut_report_record_t * record,
+   const xpccut_report_repeats_t * repeats
+);
+extern void xpccut_report_end
+(
+   unit_test_report_format_t format,
+   int count
+);
+extern const char * xpccut_report_default_file
+(
+   unit_test_report_format_t format
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_REPORT_FORMAT_H */
+
+/*
+ * report_format.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
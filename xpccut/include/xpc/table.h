@@ -0,0 +1,153 @@
+#ifndef XPCCUT_TABLE_H
+#define XPCCUT_TABLE_H
+
+/**
+ * \file          table.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the tables of data-driven tests, which feed one test function
+ *    a record at a time, each as a sub-test of its own.  Also see the
+ *    table.c module, and unit_test_status_next_record().
+ *
+ *    A table comes either from an array of strings in the test source, or
+ *    from a file of lines, which is mapped into memory where mmap() is
+ *    available.  The records point into the array or the mapped file, so
+ *    a table of millions of rows is never copied or parsed as a whole; it
+ *    is walked one record at a time, and the test takes what it needs from
+ *    each record with xpccut_record_field() and xpccut_record_long().
+ *
+ *    In a file, each line is a record.  Empty lines, and lines whose first
+ *    character is '#', are skipped, but still counted as lines, so that a
+ *    failure can name the line of the file.  A "\r" before the newline is
+ *    not part of the record.
+ */
+
+#include <xpc/macros_subset.h>         /* cbool_t and EXTERN_C_DEC            */
+
+/**
+ *    Holds a table loaded for reading.  Use xpccut_table_open() or
+ *    xpccut_table_init_rows(), and xpccut_table_close(), and do not touch
+ *    the fields directly.  A table is only read, so several threads can
+ *    walk it at once, each with a cursor of its own.
+ */
+
+typedef struct
+{
+   /**
+    *    The name of the table, which names its sub-tests.  For a file, it
+    *    is the file name.  Only the pointer is kept.
+    */
+
+   const char * m_Name;
+
+   /**
+    *    The contents of the file, or null for a table of rows.
+    */
+
+   const char * m_Data;
+
+   /**
+    *    The size of the file, in bytes.
+    */
+
+   long long m_Size;
+
+   /**
+    *    The rows of a table made by xpccut_table_init_rows(), or null.
+    */
+
+   const char * const * m_Rows;
+
+   /**
+    *    The number of rows of a table of rows.
+    */
+
+   int m_Row_Count;
+
+   /**
+    *    Indicates that m_Data is mapped, rather than allocated.
+    */
+
+   cbool_t m_Is_Mapped;
+
+} xpccut_table_t;
+
+/**
+ *    Holds one record of a table, which points into the table, and is not
+ *    terminated by a null character.  It lasts as long as the table.  A
+ *    record also keeps the place of a walk through the table; it starts out
+ *    as XPCCUT_RECORD_INIT, before the first record.
+ */
+
+typedef struct
+{
+   const char * m_Text;                /**< The start of the record.          */
+   int m_Length;                       /**< The number of characters.         */
+   int m_Number;                       /**< The number of the record, re 1.   */
+   int m_Line;                         /**< The line in the file, re 1.       */
+
+} xpccut_record_t;
+
+/**
+ *    Provides the initial value of a record, before the first record of a
+ *    table.
+ */
+
+#define XPCCUT_RECORD_INIT             { nullptr, 0, 0, 0 }
+
+/*
+ * Global functions for tables.
+ */
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_table_open
+(
+   xpccut_table_t * table,
+   const char * filename
+);
+extern cbool_t xpccut_table_init_rows
+(
+   xpccut_table_t * table,
+   const char * name,
+   const char * const * rows,
+   int count
+);
+extern void xpccut_table_close (xpccut_table_t * table);
+extern const char * xpccut_table_name (const xpccut_table_t * table);
+extern cbool_t xpccut_table_next
+(
+   const xpccut_table_t * table,
+   xpccut_record_t * record
+);
+extern cbool_t xpccut_record_field
+(
+   const xpccut_record_t * record,
+   int index,
+   xpccut_record_t * field
+);
+extern cbool_t xpccut_record_long
+(
+   const xpccut_record_t * field,
+   long * value
+);
+extern cbool_t xpccut_record_equals
+(
+   const xpccut_record_t * field,
+   const char * text
+);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_TABLE_H */
+
+/*
+ * table.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
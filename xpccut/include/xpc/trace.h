@@ -0,0 +1,103 @@
+#ifndef XPCCUT_TRACE_H
+#define XPCCUT_TRACE_H
+
+/**
+ * \file          trace.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the trace buffer, which records the entering and leaving of
+ *    scopes with nanosecond time-stamps, and writes them out in the trace
+ *    event format of Chrome, which the Perfetto UI also reads.  Also see
+ *    the trace.c module.
+ *
+ *    Each thread records into a ring of its own, so that recording an
+ *    event costs a clock reading, a few stores, and no lock.  The rings are
+ *    linked into a list, without a lock, the first time each thread
+ *    records, and they last until the process exits, so the events of the
+ *    --jobs workers can be written out after the workers are gone.  When a
+ *    ring is full, its oldest events are overwritten.
+ *
+ *    Nothing is recorded until xpccut_trace_enable() is called.  The
+ *    --trace-file option enables the trace for a run, records a span for
+ *    each test, and writes the file when the run is done.  The
+ *    XPC_SEQUENCE macros of the C++ library record into the trace, instead
+ *    of printing, while it is enabled.
+ *
+ *    The names given to xpccut_trace_enter() and xpccut_trace_exit() are
+ *    kept as pointers, so they must last until the trace is written out;
+ *    string literals, __func__, and the strings from xpccut_intern() do.
+ */
+
+#include <xpc/portable_subset.h>       /* xpccut_ticks_t                      */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* FILE                                */
+#endif
+
+/**
+ *    Provides the number of events that the ring of each thread holds.  It
+ *    must be a power of 2.
+ */
+
+#define XPCCUT_TRACE_EVENTS            16384
+
+/**
+ *    Provides the kinds of events.  The values are the "ph" (phase)
+ *    letters of the trace event format.
+ *
+ * \var XPCCUT_TRACE_ENTER
+ *    The start of a scope.
+ *
+ * \var XPCCUT_TRACE_EXIT
+ *    The end of the scope last entered by the same thread.
+ */
+
+typedef enum
+{
+   XPCCUT_TRACE_ENTER   = 'B',
+   XPCCUT_TRACE_EXIT    = 'E'
+
+} xpccut_trace_phase_t;
+
+/**
+ *    Holds one event of the trace.
+ */
+
+typedef struct
+{
+   xpccut_ticks_t m_Ticks;                /**< From xpccut_get_ticks().       */
+   const char * m_Name;                   /**< The name of the scope.         */
+   int m_Phase;                           /**< An xpccut_trace_phase_t.       */
+
+} xpccut_trace_event_t;
+
+/*
+ * Global functions for the trace buffer.
+ */
+
+EXTERN_C_DEC
+
+extern void xpccut_trace_enable (cbool_t flag);
+extern cbool_t xpccut_trace_is_enabled (void);
+extern void xpccut_trace_enter (const char * name);
+extern void xpccut_trace_exit (const char * name);
+extern void xpccut_trace_clear (void);
+extern int xpccut_trace_thread_count (void);
+extern long long xpccut_trace_dropped (void);
+extern int xpccut_trace_write (FILE * output);
+extern cbool_t xpccut_trace_export (const char * filename);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_TRACE_H */
+
+/*
+ * trace.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
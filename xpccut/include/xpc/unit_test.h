@@ -16,9 +16,13 @@
  *    number of macros, typedefs, and unit-test functions.
  */
 
+#include <xpc/arena.h>                 /* xpccut_arena_mark_t                 */
+#include <xpc/fixture.h>               /* unit_test_fixture_list_t            */
+#include <xpc/trace.h>                 /* xpccut_trace_enter(), etc.          */
 #include <xpc/portable_subset.h>       /* nullptr and other options           */
 #include <xpc/unit_test_options.h>     /* unit_test_options_t and functions   */
 #include <xpc/unit_test_status.h>      /* unit_test_status_t and functions    */
+#include <xpc/watchdog.h>              /* xpccut_watch_t                      */
 
 #if XPC_HAVE_STDDEF_H
 #include <stddef.h>                    /* intptr_t (for Win32)                */
@@ -86,6 +90,32 @@ typedef unit_test_status_t (* unit_test_func_t)
    const unit_test_options_t * options    /**< Global options for the tests.  */
 );
 
+/**
+ *    Provides a template for a function that runs one loaded unit-test, for
+ *    the worker pool of unit_test_run_jobs().
+ *
+ *    The \a context parameter is whatever the caller passed to
+ *    unit_test_run_jobs(), such as the unit_test_t structure or a C++
+ *    wrapper object.  The \a testnumber parameter is the index of the test,
+ *    in load order, starting at 0.  The \a options parameter is the private
+ *    copy of the options owned by the calling worker.
+ *
+ *    The function must time the test by calling
+ *    unit_test_status_time_delta(), and must not show the result or write
+ *    to the unit_test_t structure.  The pool takes care of that, in load
+ *    order, in the main thread.
+ *
+ * \return
+ *    The status of the test is returned by value.
+ */
+
+typedef unit_test_status_t (* unit_test_job_func_t)
+(
+   void * context,                        /**< Caller's data for the jobs.    */
+   int testnumber,                        /**< Index of the test, re 0.       */
+   const unit_test_options_t * options    /**< The worker's own options.      */
+);
+
 /**
  *    Provides a typedef for an array of unit-test function pointers.
  *    The number of elements in this array is given by
@@ -94,6 +124,68 @@ typedef unit_test_status_t (* unit_test_func_t)
 
 typedef unit_test_func_t * unit_test_list_t;
 
+/**
+ *    Holds the group and case numbers and names of a test that was loaded
+ *    by unit_test_register(), so that the runner can decide if the test is
+ *    to be run without calling it.  A test loaded by unit_test_load() has
+ *    a group number of 0 here, meaning "unknown".
+ *
+ *    Only the pointers to the names are kept, so the names must exist for
+ *    as long as the unit_test_t structure.  String literals, or the result
+ *    of _() on a literal, are the normal case.
+ */
+
+typedef struct
+{
+   /**
+    *    The group number of the test, or 0 if it is not known.
+    */
+
+   int m_Test_Group;
+
+   /**
+    *    The case number of the test, or 0 if it is not known.
+    */
+
+   int m_Test_Case;
+
+   /**
+    *    The group name of the test, or null if it is not known.
+    */
+
+   const char * m_Group_Name;
+
+   /**
+    *    The case name of the test, or null if it is not known.
+    */
+
+   const char * m_Case_Name;
+
+   /**
+    *    The timeout of the test, in milliseconds, which overrides the
+    *    --test-timeout value, or 0 to use that value.
+    */
+
+   int m_Timeout;
+
+   /**
+    *    Indicates that the sub-tests of the test, rather than the test
+    *    itself, are split among the shards.  See unit_test_load_spread().
+    */
+
+   cbool_t m_Is_Spread;
+
+   /**
+    *    Indicates that the test must run alone, with no other test running
+    *    in another worker or child, because it changes state that all of
+    *    the tests share (such as the silencing of printing) or because it
+    *    measures time.  See unit_test_load_serial().
+    */
+
+   cbool_t m_Is_Serial;
+
+} unit_test_info_t;
+
 /**
  *    The maximum length of the test name.
  *    Much more is allocated than is normally needed.
@@ -131,6 +223,75 @@ typedef unit_test_func_t * unit_test_list_t;
 
 #define XPCCUT_CASE_ALLOCATION       64
 
+/**
+ *    The number of tests that left memory allocated that are listed by
+ *    unit_test_report().  The rest are only counted.
+ */
+
+#define XPCCUT_LEAK_LIST_MAX         16
+
+/**
+ *    Holds a test that left memory allocated, for the leak report of
+ *    unit_test_report().  It is only kept when the libxpccut_alloc library
+ *    is linked in (see alloc_count.h).
+ */
+
+typedef struct
+{
+   int m_Test_Group;                      /**< The group number of the test.  */
+   int m_Test_Case;                       /**< The case number of the test.   */
+   long long m_Blocks;                    /**< The blocks not freed.          */
+   long long m_Bytes;                     /**< The bytes not freed.           */
+
+} unit_test_leak_t;
+
+/**
+ *    Holds the result of a test from the last run that ran it, as kept in
+ *    the --history file.
+ */
+
+typedef struct
+{
+   int m_Test_Group;                      /**< The group number of the test.  */
+   int m_Test_Case;                       /**< The case number of the test.   */
+   cbool_t m_Failed;                      /**< The test failed.               */
+   double m_Duration_ms;                  /**< Its duration, or -1.0.         */
+
+} unit_test_history_t;
+
+/**
+ *    Holds the --cache-file state of a test.  The key is a hash of the
+ *    group, case, and names of the test, of the --cache-key, and of the
+ *    options that change what a test does.
+ */
+
+typedef struct
+{
+   unsigned long long m_Key;              /**< The key of the test, or 0.     */
+   cbool_t m_Is_Cached;                   /**< Take the pass from the file.   */
+   cbool_t m_Passed;                      /**< Write a pass to the file.      */
+
+} unit_test_cache_t;
+
+/**
+ *    Holds the runs of one test in a --repeat or --until-fail run, from
+ *    which the fewest, mean, and most milliseconds of the test are shown.
+ */
+
+typedef struct
+{
+   int m_Runs;                            /**< The number of runs.            */
+   int m_Failures;                        /**< The number that failed.        */
+   double m_Min_ms;                       /**< The shortest run.              */
+   double m_Total_ms;                     /**< The sum of the runs.           */
+   double m_Max_ms;                       /**< The longest run.               */
+   int m_Test_Group;                      /**< The group number of the test.  */
+   int m_Test_Case;                       /**< The case number of the test.   */
+   const char * m_Group_Name;             /**< Interned group name.           */
+   const char * m_Case_Name;              /**< Interned case name.            */
+
+} unit_test_repeat_t;
+
 /**
  *    Provides a scratch pad for the unit-test application.
  */
@@ -260,6 +421,17 @@ typedef struct
 
    int m_First_Failed_Subtest;
 
+   /**
+    *    Holds a copy of the status of the first test that failed, so that
+    *    its failure log can be looked at after the run.  Its names are in
+    *    m_Names, so it lasts until the unit_test_t is destroyed.
+    *
+    * \getter
+    *    -  unit_test_first_failed_status()
+    */
+
+   unit_test_status_t m_First_Failed_Status;
+
    /**
     *    Provides the number of tests that failed.
     *
@@ -280,6 +452,204 @@ typedef struct
 
    int m_Allocation_Count;
 
+   /**
+    *    Provides the number of tests that ran, rather than being skipped.
+    *
+    * \setter
+    *    -  unit_test_dispose_of_test()
+    *
+    * \getter
+    *    -  unit_test_run_count()
+    */
+
+   int m_Run_Count;
+
+   /**
+    *    Provides the number of tests that were reported as cached passes,
+    *    from the --cache-file, rather than being run.
+    *
+    * \setter
+    *    -  unit_test_dispose_of_test()
+    *
+    * \getter
+    *    -  unit_test_cached_count()
+    */
+
+   int m_Cached_Count;
+
+   /**
+    *    Provides the shard of each loaded test, for the "--shard-by
+    *    duration" option.  The options point to this array while the tests
+    *    run.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int * m_Shard_Map;
+
+   /**
+    *    Provides the duration of each loaded test, in milliseconds, or -1.0
+    *    if the test did not run.  This array is written to the
+    *    --save-durations file.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   double * m_Durations_ms;
+
+   /**
+    *    Provides the history of each loaded test, in load order, as read
+    *    from the --history file and updated as the tests run, or null if
+    *    there is no --history file.  A test with no history has a duration
+    *    of -1.0.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   unit_test_history_t * m_History;
+
+   /**
+    *    Provides the order in which unit_test_next_test() hands out the
+    *    tests, as test numbers re 0, or null for the load order.  This is
+    *    set up from m_History for the --order option.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int * m_Test_Order;
+
+   /**
+    *    Provides the order in which the --jobs workers and the --isolate
+    *    children start the tests, or null to start them in the order of
+    *    m_Test_Order.  For the load order, this puts the longest tests in
+    *    m_History first, so that they do not hold up the end of the run.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int * m_Schedule;
+
+   /**
+    *    Provides the position of the current test in m_Test_Order.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_next_test()
+    */
+
+   int m_Order_Position;
+
+   /**
+    *    Provides the --cache-file state of each loaded test, in load order,
+    *    or null if there is no --cache-file, or it is not to be used.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   unit_test_cache_t * m_Cache;
+
+   /**
+    *    Provides the number of rounds of the tests to be run, from the
+    *    --repeat option, or 0 for a --until-fail run with no limit.  Each
+    *    round runs every loaded test once.  It is 1 outside of a run.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int m_Round_Count;
+
+   /**
+    *    Provides the position past the last test of the last round; the
+    *    positions handed out by unit_test_next_test() run from 0 to this
+    *    value, through all of the rounds.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int m_Position_Limit;
+
+   /**
+    *    Provides the number of rounds that the --jobs workers or the
+    *    --isolate children can be ahead of the test being disposed of; it
+    *    is 1 for a serial run.  The results waiting to be disposed of, and
+    *    the shuffled orders, are kept for that many rounds.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   int m_Window_Rounds;
+
+   /**
+    *    Provides the seed of the first round of a --shuffle run.  Round i
+    *    is shuffled with this seed plus i.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   unsigned int m_Shuffle_Seed;
+
+   /**
+    *    Provides the shuffled orders of the rounds in the window, as
+    *    m_Window_Rounds rows of test numbers, round i using row i modulo
+    *    m_Window_Rounds, or null if the --shuffle option is not set.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_next_test()
+    */
+
+   int * m_Shuffle_Orders;
+
+   /**
+    *    Provides the last round whose order is in m_Shuffle_Orders.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_next_test()
+    */
+
+   int m_Shuffle_Ready;
+
+   /**
+    *    Provides the runs of each loaded test, in load order, for a run of
+    *    more than one round, or null.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   unit_test_repeat_t * m_Repeats;
+
+   /**
+    *    Provides the entries read from the --baseline file.  The options
+    *    point to this array while the tests run.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    */
+
+   unit_test_baseline_t * m_Baseline;
+
+   /**
+    *    Provides the number of entries in m_Baseline.
+    */
+
+   int m_Baseline_Count;
+
    /**
     *    Provides the list of unit-test functions.
     *    This list starts out at a fixed size, and is reallocated, if
@@ -288,6 +658,20 @@ typedef struct
 
    unit_test_list_t m_Test_Cases;
 
+   /**
+    *    Provides the group and case of each test in m_Test_Cases, in the
+    *    same order.  It is allocated and reallocated along with
+    *    m_Test_Cases.
+    *
+    * \setter
+    *    -  unit_test_load()
+    *    -  unit_test_register()
+    *    -  unit_test_cpp_load_count()
+    *    -  unit_test_cpp_load_info()
+    */
+
+   unit_test_info_t * m_Test_Info;
+
    /**
     *    Provides the relative time (in microseconds) at which the test
     *    application started.
@@ -312,6 +696,207 @@ typedef struct
 
    struct timeval m_End_Time_us;
 
+   /**
+    *    Provides the monotonic time, from xpccut_get_ticks(), at which the
+    *    test application started.  The duration of the whole run is
+    *    computed from this value and m_End_Ticks.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    */
+
+   xpccut_ticks_t m_Start_Ticks;
+
+   /**
+    *    Provides the monotonic time at which the test application ended.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_post_loop()
+    */
+
+   xpccut_ticks_t m_End_Ticks;
+
+   /**
+    *    Provides the total of the resources used by the tests that ran
+    *    under the --profile option.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   xpccut_resources_t m_Profile_Total;
+
+   /**
+    *    Provides the number of tests totalled in m_Profile_Total.
+    */
+
+   int m_Profile_Count;
+
+   /**
+    *    Provides the group number of the test whose peak resident set grew
+    *    the most, for the summary of unit_test_report().  It is 0 if no
+    *    test grew it.
+    */
+
+   int m_Peak_RSS_Group;
+
+   /**
+    *    Provides the case number of the test whose peak resident set grew
+    *    the most.
+    */
+
+   int m_Peak_RSS_Case;
+
+   /**
+    *    Provides the total of the hardware counts of the tests that ran
+    *    under the --perf-counters option.  A counter is present in the
+    *    total only if every one of those tests could read it.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   xpccut_perf_values_t m_Counter_Total;
+
+   /**
+    *    Provides the number of tests totalled in m_Counter_Total.
+    */
+
+   int m_Counter_Count;
+
+   /**
+    *    Provides the number of tests that allocated more blocks than they
+    *    freed.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   int m_Leak_Count;
+
+   /**
+    *    Provides the first XPCCUT_LEAK_LIST_MAX of the tests counted in
+    *    m_Leak_Count.
+    */
+
+   unit_test_leak_t m_Leaks[XPCCUT_LEAK_LIST_MAX];
+
+   /**
+    *    Provides the file to which the --report-format records are written,
+    *    or null if no report is being written.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    *    -  unit_test_post_loop()
+    */
+
+   FILE * m_Report_File;
+
+   /**
+    *    Provides the report file that was in use when m_Report_File was
+    *    opened, which is put back when it is closed.  It is not null only
+    *    when this run is nested inside another run that writes a report.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_init()
+    *    -  unit_test_post_loop()
+    */
+
+   FILE * m_Report_Previous;
+
+   /**
+    *    Provides the number of records written to the report, for the TAP
+    *    plan.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_dispose_of_test()
+    */
+
+   int m_Report_Count;
+
+   /**
+    *    Provides the group-level fixtures, with their setup state for the
+    *    current run.
+    *
+    * \setter
+    *    -  unit_test_fixture()
+    *    -  unit_test_run_init()
+    *    -  unit_test_fixture_enter()
+    *    -  unit_test_fixture_leave()
+    */
+
+   unit_test_fixture_list_t m_Fixtures;
+
+   /**
+    *    Provides the last round whose cases are counted in m_Fixtures.
+    *
+    * \setter
+    *    -  unit_test_run_init()
+    *    -  unit_test_next_test()
+    */
+
+   int m_Fixture_Ready;
+
+   /**
+    *    Provides the position of the test arena of the thread when the
+    *    current test started, so that the scratch blocks the test takes
+    *    from the arena are freed when it ends.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_a_test_before()
+    *    -  unit_test_run_a_test_after()
+    */
+
+   xpccut_arena_mark_t m_Arena_Mark;
+
+   /**
+    *    Provides the name under which the current test is recorded in the
+    *    trace, or null if the trace is not enabled.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_run_a_test_before()
+    *    -  unit_test_run_a_test_after()
+    */
+
+   const char * m_Trace_Name;
+
+   /**
+    *    Indicates that the tests hold the shared table of interned names
+    *    (see xpccut_intern_acquire()), which is let go of by
+    *    unit_test_destroy().
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_destroy()
+    */
+
+   cbool_t m_Intern_Held;
+
+   /**
+    *    Provides the table of interned names of the statuses of this run,
+    *    which m_App_Options points to.  The names last until the run is
+    *    destroyed.
+    *
+    * \setter
+    *    -  unit_test_clear()
+    *    -  unit_test_destroy()
+    */
+
+   xpccut_intern_table_t m_Names;
+
 } unit_test_t;
 
 /*
@@ -332,7 +917,42 @@ extern cbool_t unit_test_initialize
 );
 extern void unit_test_destroy (unit_test_t * tests);
 extern cbool_t unit_test_load (unit_test_t * tests, const unit_test_func_t test);
+extern cbool_t unit_test_register
+(
+   unit_test_t * tests,
+   const unit_test_func_t test,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename
+);
+extern cbool_t unit_test_fixture
+(
+   unit_test_t * tests,
+   int testgroup,
+   unit_test_setup_func_t setup,
+   unit_test_teardown_func_t teardown
+);
+extern void * unit_test_fixture_data (void);
 extern cbool_t unit_test_cpp_load_count (unit_test_t * tests);
+extern cbool_t unit_test_cpp_load_info
+(
+   unit_test_t * tests,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename
+);
+extern cbool_t unit_test_load_timeout (unit_test_t * tests, int timeout);
+extern cbool_t unit_test_load_spread (unit_test_t * tests);
+extern int unit_test_test_timeout (const unit_test_t * tests, int testnumber);
+extern cbool_t unit_test_load_serial (unit_test_t * tests);
+extern cbool_t unit_test_test_is_serial
+(
+   const unit_test_t * tests,
+   int testnumber
+);
+extern cbool_t unit_test_reserve (unit_test_t * tests, int count);
 extern cbool_t unit_test_dispose (unit_test_status_t * status);
 extern int unit_test_count (const unit_test_t * tests);
 extern int unit_test_subtest_count (const unit_test_t * tests);
@@ -342,6 +962,12 @@ extern int unit_test_first_failed_test (const unit_test_t * tests);
 extern int unit_test_first_failed_group (const unit_test_t * tests);
 extern int unit_test_first_failed_case (const unit_test_t * tests);
 extern int unit_test_first_failed_subtest (const unit_test_t * tests);
+extern const unit_test_status_t * unit_test_first_failed_status
+(
+   const unit_test_t * tests
+);
+extern int unit_test_run_count (const unit_test_t * tests);
+extern int unit_test_cached_count (const unit_test_t * tests);
 extern cbool_t unit_test_run (unit_test_t * tests);
 extern unit_test_status_t unit_test_run_a_test
 (
@@ -365,6 +991,32 @@ extern cbool_t unit_test_dispose_of_test
 );
 extern void unit_test_post_loop (unit_test_t * tests, cbool_t testresult);
 extern cbool_t unit_test_run_a_test_before (unit_test_t * tests, intptr_t test);
+extern cbool_t unit_test_skip_a_test
+(
+   const unit_test_t * tests,
+   int testnumber,
+   const unit_test_options_t * options,
+   unit_test_status_t * status
+);
+extern cbool_t unit_test_fixture_enter
+(
+   unit_test_t * tests,
+   int testnumber,
+   const unit_test_options_t * options,
+   unit_test_status_t * status
+);
+extern void unit_test_fixture_leave (unit_test_t * tests, int testnumber);
+extern void unit_test_watchdog_arm
+(
+   const unit_test_t * tests,
+   int testnumber,
+   xpccut_watch_t * watch
+);
+extern void unit_test_watchdog_disarm
+(
+   xpccut_watch_t * watch,
+   unit_test_status_t * status
+);
 extern cbool_t unit_test_run_a_test_after
 (
    unit_test_t * tests,
@@ -375,6 +1027,13 @@ extern int unit_test_check_subtests
    unit_test_t * tests,
    const unit_test_status_t * status
 );
+extern cbool_t unit_test_use_jobs (const unit_test_t * tests);
+extern cbool_t unit_test_run_jobs
+(
+   unit_test_t * tests,
+   unit_test_job_func_t job,
+   void * context
+);
 
 EXTERN_C_END
 
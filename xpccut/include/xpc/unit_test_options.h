@@ -17,6 +17,8 @@
  */
 
 #include <xpc/portable_subset.h>    /* nullptr and other options              */
+#include <xpc/intern.h>             /* xpccut_intern_table_t                  */
+#include <xpc/report_format.h>      /* unit_test_report_format_t              */
 
 /**
  *    Maximum number of unit-test groups, the highest group that can be
@@ -51,6 +53,43 @@
 
 #define XPCCUT_SLEEPTIME_MAX           3600000
 
+/**
+ *    Maximum number of worker threads that a unit-test application can use
+ *    to run its tests.  The actual value is determined by the --jobs
+ *    command-line option.
+ */
+
+#define XPCCUT_JOBS_MAX                256
+
+/**
+ *    Maximum time, in milliseconds, that a unit-test can be given to run.
+ *    The actual value is determined by the --test-timeout command-line
+ *    option.  It cannot be longer than one hour.
+ */
+
+#define XPCCUT_TIMEOUT_MAX             3600000
+
+/**
+ *    Maximum number of shards that the loaded tests can be split into, by
+ *    the --shard-count option.
+ */
+
+#define XPCCUT_SHARDS_MAX              1024
+
+/**
+ *    Marks a test in the shard map as one that runs in every shard, with
+ *    its records split among the shards.  See unit_test_load_spread().
+ */
+
+#define XPCCUT_SHARD_ALL               (-1)
+
+/**
+ *    Maximum regression, in percent of the baseline value, that the
+ *    --perf-tolerance option can allow.
+ */
+
+#define XPCCUT_PERF_TOLERANCE_MAX      1000
+
 /**
  *    Default value setting for the m_Is_Verbose ("--verbose") field.  The
  *    default value is as if the "--no-verbose" option had been specified.
@@ -160,6 +199,138 @@
 
 #define XPCCUT_TEST_SLEEP_TIME         0
 
+/**
+ *    Default value setting for the m_Job_Count ("--jobs") field.  The
+ *    default is to run the tests one after the other, in the main thread.
+ */
+
+#define XPCCUT_JOB_COUNT               1
+
+/**
+ *    Default value setting for the m_Fuzz_Job_Count ("--fuzz-jobs") field.
+ *    The default is to fuzz in the calling thread only.
+ */
+
+#define XPCCUT_FUZZ_JOB_COUNT          1
+
+/**
+ *    Default value setting for the m_Is_Isolated ("--isolate") field.  The
+ *    default is to run the tests in the process of the test application.
+ */
+
+#define XPCCUT_IS_ISOLATED             false
+
+/**
+ *    Default value setting for the m_Test_Timeout ("--test-timeout") field.
+ *    The default, 0, means that a test can run as long as it likes.
+ */
+
+#define XPCCUT_TEST_TIMEOUT            0
+
+/**
+ *    Default value setting for the m_Shard_Count ("--shard-count") field.
+ *    The default is to run all of the loaded tests in one shard.
+ */
+
+#define XPCCUT_SHARD_COUNT             1
+
+/**
+ *    Default value setting for the m_Shard_Index ("--shard-index") field.
+ *    Shards are numbered from 0 to m_Shard_Count - 1.
+ */
+
+#define XPCCUT_SHARD_INDEX             0
+
+/**
+ *    Default value setting for the m_Shard_Mode ("--shard-by") field.
+ */
+
+#define XPCCUT_SHARD_MODE              XPCCUT_SHARD_BY_INDEX
+
+/**
+ *    Default value setting for the m_Order ("--order") field.
+ */
+
+#define XPCCUT_ORDER                   XPCCUT_ORDER_LOAD
+
+/**
+ *    Default value setting for the m_Report_Format ("--report-format")
+ *    field.
+ */
+
+#define XPCCUT_REPORT_FORMAT           XPCCUT_REPORT_NONE
+
+/**
+ *    Default value setting for the m_Perf_Tolerance ("--perf-tolerance")
+ *    field, in percent.  A measurement can be this much slower than its
+ *    baseline before unit_test_status_perf_check() fails it.
+ */
+
+#define XPCCUT_PERF_TOLERANCE          25
+
+/**
+ *    Default value setting for the m_Is_Profiled ("--profile") field.  The
+ *    default is to time the tests, but not to measure their use of other
+ *    resources.
+ */
+
+#define XPCCUT_IS_PROFILED             false
+
+/**
+ *    Default value setting for the m_Perf_Counters ("--perf-counters")
+ *    field.  The default is not to read the hardware counters.
+ */
+
+#define XPCCUT_PERF_COUNTERS           false
+
+/**
+ *    Default value setting for the m_Huge_Pages ("--huge-pages") field.
+ *    The default is to allocate the test arenas on ordinary pages.
+ */
+
+#define XPCCUT_HUGE_PAGES              false
+
+/**
+ *    Default value setting for the m_Use_Cache ("--cache") field.  The
+ *    cache is used whenever a --cache-file is given.
+ */
+
+#define XPCCUT_USE_CACHE               true
+
+/**
+ *    Default value setting for the m_Repeat_Count ("--repeat") field.  The
+ *    default is to run each selected test once.
+ */
+
+#define XPCCUT_REPEAT_COUNT            1
+
+/**
+ *    Provides the largest value allowed for the --repeat option.
+ */
+
+#define XPCCUT_REPEAT_MAX              1000000
+
+/**
+ *    Default value setting for the m_Until_Fail ("--until-fail") field.
+ */
+
+#define XPCCUT_UNTIL_FAIL              false
+
+/**
+ *    Default value setting for the m_Shuffle ("--shuffle") field.  The
+ *    default is to run the tests in the --order given.
+ */
+
+#define XPCCUT_SHUFFLE                 false
+
+/**
+ *    Default value setting for the m_Shuffle_Seed ("--shuffle-seed") field.
+ *    The default, 0, means that the seed is made from the time of day, and
+ *    shown, so that the order can be repeated.
+ */
+
+#define XPCCUT_SHUFFLE_SEED            0
+
 /**
  *    Default value setting.
  */
@@ -200,6 +371,113 @@
 
 #define XPCCUT_NO_CURRENT_CASE         XPCCUT_INVALID_PARAMETER
 
+/**
+ *    Provides the ways in which the --shard-count option can split the
+ *    loaded tests into shards.
+ */
+
+typedef enum
+{
+   /**
+    *    Test number n (re 0) goes to shard n % m_Shard_Count.  This is
+    *    cheap and even, but a shard changes whenever a test is loaded ahead
+    *    of it.
+    */
+
+   XPCCUT_SHARD_BY_INDEX,
+
+   /**
+    *    A test goes to the shard given by a hash of its group and case
+    *    names.  A test stays in its shard when other tests are added or
+    *    moved.
+    */
+
+   XPCCUT_SHARD_BY_HASH,
+
+   /**
+    *    The tests are spread so that each shard gets about the same total
+    *    duration, using the durations of an earlier run read from the
+    *    --durations file.  Tests missing from the file are given the mean
+    *    duration of the ones that are present.
+    */
+
+   XPCCUT_SHARD_BY_DURATION
+
+} unit_test_shard_mode_t;
+
+/**
+ *    Provides the orders in which the loaded tests can be run.  Whatever
+ *    the order, each test keeps its number, re its place in the load
+ *    order, in the output and the reports.
+ */
+
+typedef enum
+{
+   /**
+    *    The tests run in the order in which they were loaded.
+    */
+
+   XPCCUT_ORDER_LOAD,
+
+   /**
+    *    The tests that failed in the run saved in the --history file run
+    *    first, and then the others, each in load order.
+    */
+
+   XPCCUT_ORDER_FAILED_FIRST,
+
+   /**
+    *    The tests run from the shortest to the longest duration saved in
+    *    the --history file.  Tests missing from the file run last.
+    */
+
+   XPCCUT_ORDER_FASTEST_FIRST
+
+} unit_test_order_t;
+
+/**
+ *    Provides one entry of the --baseline file, the result of a
+ *    performance measurement made by an earlier run.  An entry is
+ *    identified by the group and case numbers of its test, plus the name
+ *    given to unit_test_status_perf_check().
+ */
+
+typedef struct
+{
+   /**
+    *    The group number of the test that made the measurement.
+    */
+
+   int m_Test_Group;
+
+   /**
+    *    The case number of the test that made the measurement.
+    */
+
+   int m_Test_Case;
+
+   /**
+    *    The measured value, usually a median time in nanoseconds.  Smaller
+    *    values are better.
+    */
+
+   double m_Value;
+
+   /**
+    *    The noise of the measurement, usually a standard deviation in the
+    *    same units as m_Value, or 0.0 if it is not known.
+    */
+
+   double m_Noise;
+
+   /**
+    *    The name of the measurement.
+    */
+
+   char m_Name[XPCCUT_STRLEN];
+
+} unit_test_baseline_t;
+
 /**
  *    Provides a number of options that allow the unit-test to serve many
  *    purposes.
@@ -581,107 +859,601 @@ typedef struct
    int m_Test_Sleep_Time;
 
    /**
-    *    Holds the ordinal number of the current test.
+    *    Provides the number of worker threads used to run the tests.  If
+    *    greater than 1, unit_test_run() hands the test functions to a pool
+    *    of this many threads.  Each worker has its own copy of the options
+    *    and its own unit_test_status_t, and the results are still disposed
+    *    of in the order in which the tests were loaded, so that the totals
+    *    and the report are the same as for a serial run.
+    *
+    *    This value is set by the --jobs option.  It is ignored (treated as
+    *    1) if the --interactive, --case-pause, or --summarize options are in
+    *    force.  The default value of this option is given by the
+    *    XPCCUT_JOB_COUNT macro.
+    *
+    * ccessor
+    *    -  unit_test_options_job_count_set()
+    *    -  unit_test_options_job_count()
+    */
+
+   int m_Job_Count;
+
+   /**
+    *    Provides the number of worker threads that a fuzz campaign, such as
+    *    xpccut_campaign_init(), should use.  Each worker fuzzes with its own
+    *    seed, derived from the base seed of the campaign, and the workers
+    *    share the inputs that reach new code.  The library does not use
+    *    this value itself; a fuzz test reads it with
+    *    unit_test_options_fuzz_job_count().
     *
-    *    This number starts at 1, representing the first test.  It is a copy
-    *    of the field of the same name in unit_test_t, and is meant only for
-    *    allowing unit_test_status_initialize() to be able to properly
-    *    annunciate the test number in a convenient way.
+    *    This value is set by the --fuzz-jobs option.  The default value of
+    *    this option is given by the XPCCUT_FUZZ_JOB_COUNT macro.
     *
-    * \getter
-    *    -  unit_test_options_current_test()
+    * \accessor
+    *    -  unit_test_options_fuzz_job_count_set()
+    *    -  unit_test_options_fuzz_job_count()
     */
 
-   int m_Current_Test_Number;
+   int m_Fuzz_Job_Count;
 
    /**
-    *    Provides a stock (automated) answer for the static function
-    *    unit_test_status_prompt_before().
+    *    Provides a flag for running each test in a child process of its
+    *    own.  A test that crashes, or that runs longer than the
+    *    --test-timeout value, then counts as a failed test, instead of
+    *    taking the whole test application down with it.  Up to m_Job_Count
+    *    children are run at the same time, and their results are disposed
+    *    of in load order, as for --jobs.
+    *
+    *    This value is set by the --isolate option, and unset by the
+    *    --no-isolate option.  It is ignored if the platform has no fork(),
+    *    or if the --interactive, --case-pause, or --summarize options are
+    *    in force.  The default value of this option is given by the
+    *    XPCCUT_IS_ISOLATED macro.
     *
-    *    This value, if non-zero, causes that function to not prompt the
-    *    user, but instead use the given character as the response.  Note
-    *    that the selected response is given for all the calls in the
-    *    unit-test application.
+    * \accessor
+    *    -  unit_test_options_is_isolated_set()
+    *    -  unit_test_options_is_isolated()
+    */
+
+   cbool_t m_Is_Isolated;
+
+   /**
+    *    Provides the longest time, in milliseconds, that a single test is
+    *    allowed to run.  In --isolate mode, a child process that runs longer
+    *    is killed, and the test is counted as a failure.  Otherwise, the
+    *    watchdog in the watchdog.c module shows the late test, counts it as
+    *    a failure if it returns, and ends the application if it does not.
+    *    A test given a timeout of its own by unit_test_load_timeout() uses
+    *    that value instead.
+    *
+    *    This value is set by the --test-timeout option.  It is unset by
+    *    providing a time-value of zero ("0").  The default value of this
+    *    option is given by the XPCCUT_TEST_TIMEOUT macro.
     *
-    *    The allowed values are:
+    * \accessor
+    *    -  unit_test_options_test_timeout_set()
+    *    -  unit_test_options_test_timeout()
+    */
+
+   int m_Test_Timeout;
+
+   /**
+    *    Provides the number of shards into which the loaded tests are split,
+    *    so that the shards can be run on separate machines.  Only the tests
+    *    of the shard given by m_Shard_Index are run; the rest are skipped,
+    *    exactly as for the --group and --case options.
     *
-    *       -  0.    This is the default, and turns off automatic responses.
-    *       -  'c'.  Make a response of 'continue'.
-    *       -  's'.  Make a response of 'skip'.
-    *       -  'a'.  Make a response of 'abort'.
-    *       -  'q'.  Make a response of 'quit'.
+    *    This value is set by the --shard-count option.  The default value of
+    *    this option is given by the XPCCUT_SHARD_COUNT macro.
     *
     * \accessor
-    *    -  unit_test_options_prompt_before_set()
-    *    -  unit_test_options_prompt_before()
+    *    -  unit_test_options_shard_count_set()
+    *    -  unit_test_options_shard_count()
     */
 
-   char m_Response_Before;
+   int m_Shard_Count;
 
    /**
-    *    Provides a stock (automated) answer for the static function
-    *    unit_test_status_prompt_after().
+    *    Provides the shard to be run, re 0.
     *
-    *    This value, if non-zero, causes that function to not prompt the
-    *    user, but instead use the given character as the response.  Note
-    *    that the selected response is given for all the calls in the
-    *    unit-test application.
+    *    This value is set by the --shard-index option.  It must be less
+    *    than the --shard-count value.  The default value of this option is
+    *    given by the XPCCUT_SHARD_INDEX macro.
     *
-    *    The allowed values are:
+    * \accessor
+    *    -  unit_test_options_shard_index_set()
+    *    -  unit_test_options_shard_index()
+    */
+
+   int m_Shard_Index;
+
+   /**
+    *    Provides the way in which tests are assigned to shards.
     *
-    *       -  0.    This is the default, and turns off automatic responses.
-    *       -  'p'.  Make a response of 'pass'.
-    *       -  'f'.  Make a response of 'fail'.
-    *       -  'a'.  Make a response of 'abort'.
-    *       -  'q'.  Make a response of 'quit'.
+    *    This value is set by the --shard-by option, which takes the values
+    *    "index", "hash", and "duration".  The default value of this option
+    *    is given by the XPCCUT_SHARD_MODE macro.
     *
     * \accessor
-    *    -  unit_test_options_prompt_after_set()
-    *    -  unit_test_options_prompt_after()
+    *    -  unit_test_options_shard_mode_set()
+    *    -  unit_test_options_shard_mode()
     */
 
-   char m_Response_After;
+   unit_test_shard_mode_t m_Shard_Mode;
 
    /**
-    *    Provides a special value to make simulated tests easier to
-    *    recognize.
+    *    Provides the name of a file of test durations, written by an earlier
+    *    run via the --save-durations option.  It is read by
+    *    unit_test_run_init() for the "--shard-by duration" option.
     *
-    *    When testing the unit-test code itself, some output is seen that
-    *    could be confusing.  This flag allows tests to flag their output
-    *    with the word "simulated" to make it obvious that the test is not
-    *    broken.
+    *    This value is set by the --durations option.  The default value is
+    *    the empty string, which means that no file is read.
     *
-    * \note
-    *    Only tests of the unit-test library will actually need to set this
-    *    value, though it may prove useful in other situations.
+    * \accessor
+    *    -  unit_test_options_durations_file_set()
+    *    -  unit_test_options_durations_file()
+    */
+
+   char m_Durations_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the name of a file to which unit_test_post_loop() writes
+    *    the duration of each test that ran.  The files saved by all of the
+    *    shards can simply be concatenated to make the --durations file for
+    *    the next run.
+    *
+    *    This value is set by the --save-durations option.  The default value
+    *    is the empty string, which means that no file is written.
     *
     * \accessor
-    *    -  unit_test_options_is_simulated_set()
-    *    -  unit_test_options_is_simulated()
+    *    -  unit_test_options_save_durations_file_set()
+    *    -  unit_test_options_save_durations_file()
     */
 
-   cbool_t m_Is_Simulated;
+   char m_Save_Durations_File[XPCCUT_STRLEN];
 
-} unit_test_options_t;
+   /**
+    *    Provides the format of the machine-readable report, which is written
+    *    as each test is disposed of, one record per sub-test.
+    *
+    *    This value is set by the --report-format option, which takes the
+    *    values "none", "junit", "jsonl", and "tap".  The default value of
+    *    this option is given by the XPCCUT_REPORT_FORMAT macro.
+    *
+    * \accessor
+    *    -  unit_test_options_report_format_set()
+    *    -  unit_test_options_report_format()
+    */
 
-/*
- *    These functions are documented in the C module.
- */
+   unit_test_report_format_t m_Report_Format;
 
-EXTERN_C_DEC
+   /**
+    *    Provides the name of the file to which the report is written.
+    *
+    *    This value is set by the --report-file option.  The default value
+    *    is the empty string, which means that the name given by
+    *    xpccut_report_default_file() is used.
+    *
+    * \accessor
+    *    -  unit_test_options_report_file_set()
+    *    -  unit_test_options_report_file()
+    */
 
-extern cbool_t unit_test_options_init (unit_test_options_t * options);
+   char m_Report_File[XPCCUT_STRLEN];
 
-/*
- * Now hidden to discourage callers (other than the unit-test application)
- * from using it.
- *
- *    extern cbool_t unit_test_options_initialize
- *    (
- *       unit_test_options_t * options,
- *       cbool_t verbose,
- *       cbool_t showvalues,
- *       cbool_t usetextsynch,
+   /**
+    *    Provides the shard of each loaded test, indexed by test number, for
+    *    the "--shard-by duration" option.  This is not a command-line
+    *    option.  The array is owned by the unit_test_t structure, which sets
+    *    it up in unit_test_run_init().  It is null otherwise.
+    *
+    * \accessor
+    *    -  unit_test_options_shard_map_set()
+    *    -  unit_test_options_in_shard()
+    *    -  unit_test_options_record_in_shard()
+    */
+
+   const int * m_Shard_Map;
+
+   /**
+    *    Provides the table of interned names of the run, for the statuses
+    *    made with these options.  This is not a command-line option.  The
+    *    table is owned by the unit_test_t structure, which sets this
+    *    pointer up.  If it is null, xpccut_intern() is used.
+    *
+    * \accessor
+    *    -  unit_test_options_names_set()
+    *    -  unit_test_options_names()
+    */
+
+   xpccut_intern_table_t * m_Names;
+
+   /**
+    *    Provides the name of a file of performance baselines, written by an
+    *    earlier run via the --write-baseline option.  It is read by
+    *    unit_test_run_init(), and unit_test_status_perf_check() compares
+    *    each measurement against it.
+    *
+    *    This value is set by the --baseline option.  The default value is
+    *    the empty string, which means that no measurement is checked.
+    *
+    * \accessor
+    *    -  unit_test_options_baseline_file_set()
+    *    -  unit_test_options_baseline_file()
+    */
+
+   char m_Baseline_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the name of a file to which unit_test_status_perf_check()
+    *    appends each measurement, in the format of the --baseline file.
+    *    unit_test_run_init() empties it first.  The name can be the same as
+    *    that of the --baseline file, since that file is read beforehand.
+    *
+    *    This value is set by the --write-baseline option.  The default
+    *    value is the empty string, which means that no file is written.
+    *
+    * \accessor
+    *    -  unit_test_options_write_baseline_file_set()
+    *    -  unit_test_options_write_baseline_file()
+    */
+
+   char m_Write_Baseline_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the regression allowed by unit_test_status_perf_check(),
+    *    in percent of the baseline value.
+    *
+    *    This value is set by the --perf-tolerance option.  The default
+    *    value of this option is given by the XPCCUT_PERF_TOLERANCE macro.
+    *
+    * \accessor
+    *    -  unit_test_options_perf_tolerance_set()
+    *    -  unit_test_options_perf_tolerance()
+    */
+
+   int m_Perf_Tolerance;
+
+   /**
+    *    Provides the entries read from the --baseline file.  This is not a
+    *    command-line option.  The array is owned by the unit_test_t
+    *    structure, which sets it up in unit_test_run_init().  It is null
+    *    otherwise.
+    *
+    * \accessor
+    *    -  unit_test_options_baseline_set()
+    *    -  unit_test_options_baseline_find()
+    */
+
+   const unit_test_baseline_t * m_Baseline;
+
+   /**
+    *    Provides the number of entries in m_Baseline.
+    */
+
+   int m_Baseline_Count;
+
+   /**
+    *    Provides a flag for measuring the resources used by each test: its
+    *    CPU time, the growth of the resident set, its page faults, and its
+    *    context switches.  The figures are shown with the result of each
+    *    test, and totalled by unit_test_report().
+    *
+    *    This value is set by the --profile option, and unset by the
+    *    --no-profile option.  The default value of this option is given
+    *    by the XPCCUT_IS_PROFILED macro.
+    *
+    * \accessor
+    *    -  unit_test_options_is_profiled_set()
+    *    -  unit_test_options_is_profiled()
+    */
+
+   cbool_t m_Is_Profiled;
+
+   /**
+    *    Provides a flag for reading the hardware counters of the processor
+    *    around each test: its cycles, instructions, cache misses, and
+    *    branch misses.  The counts are shown with the result of each test,
+    *    and totalled by unit_test_report().  Where the counters cannot be
+    *    read, the flag has no effect.
+    *
+    *    This value is set by the --perf-counters option, and unset by the
+    *    --no-perf-counters option.  The default value of this option is
+    *    given by the XPCCUT_PERF_COUNTERS macro.
+    *
+    * \accessor
+    *    -  unit_test_options_perf_counters_set()
+    *    -  unit_test_options_perf_counters()
+    */
+
+   cbool_t m_Perf_Counters;
+
+   /**
+    *    Provides a flag for mapping the chunks of the test arenas (see
+    *    arena.h) on huge pages, which helps the tests that sweep through
+    *    large scratch buffers.  Where huge pages cannot be had, ordinary
+    *    pages are used.  Once set for a run, it stays set for the runs that
+    *    follow in the same process.
+    *
+    *    This value is set by the --huge-pages option, and unset by the
+    *    --no-huge-pages option.  The default value of this option is given
+    *    by the XPCCUT_HUGE_PAGES macro.
+    *
+    * \accessor
+    *    -  unit_test_options_huge_pages_set()
+    *    -  unit_test_options_huge_pages()
+    */
+
+   cbool_t m_Huge_Pages;
+
+   /**
+    *    Provides the name of the file to which unit_test_post_loop() writes
+    *    the trace of the run (see trace.h).  While it is set, the trace is
+    *    enabled, and each test is recorded as a span in the thread that
+    *    ran it.
+    *
+    *    This value is set by the --trace-file option.  The default value is
+    *    the empty string, which means that no trace is recorded.
+    *
+    * \accessor
+    *    -  unit_test_options_trace_file_set()
+    *    -  unit_test_options_trace_file()
+    */
+
+   char m_Trace_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the name of the file that holds the result and the
+    *    duration of each test from the last run that ran it.  The file is
+    *    read by unit_test_run_init(), if it exists, and written back by
+    *    unit_test_post_loop().
+    *
+    *    This value is set by the --history option.  The default value is
+    *    the empty string, which means that no history is kept.
+    *
+    * \accessor
+    *    -  unit_test_options_history_file_set()
+    *    -  unit_test_options_history_file()
+    */
+
+   char m_History_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the order in which the tests are run.
+    *
+    *    This value is set by the --order option, which takes the values
+    *    "load", "failed-first", and "fastest-first".  The default value of
+    *    this option is given by the XPCCUT_ORDER macro.  The orders other
+    *    than "load" need the --history file.
+    *
+    * \accessor
+    *    -  unit_test_options_order_set()
+    *    -  unit_test_options_order()
+    */
+
+   unit_test_order_t m_Order;
+
+   /**
+    *    Provides the name of the file that holds the tests that passed, each
+    *    with a key made from the group, case, and names of the test, and
+    *    from m_Cache_Key.  A test whose key is found in the file is reported
+    *    as a cached pass without being run.  The file is read by
+    *    unit_test_run_init(), if it exists, and written back by
+    *    unit_test_post_loop().
+    *
+    *    This value is set by the --cache-file option.  The default value is
+    *    the empty string, which means that no results are cached.
+    *
+    * \accessor
+    *    -  unit_test_options_cache_file_set()
+    *    -  unit_test_options_cache_file()
+    */
+
+   char m_Cache_File[XPCCUT_STRLEN];
+
+   /**
+    *    Provides the content part of the keys of the --cache-file, such as
+    *    a source-control revision or a hash of the sources.  A test passed
+    *    under one key is run again under any other key.
+    *
+    *    This value is set by the --cache-key option.  The default value is
+    *    the empty string, which means that the key is a hash of the test
+    *    application itself, so that every rebuild runs the tests again.
+    *
+    * \accessor
+    *    -  unit_test_options_cache_key_set()
+    *    -  unit_test_options_cache_key()
+    */
+
+   char m_Cache_Key[XPCCUT_STRLEN];
+
+   /**
+    *    Provides a flag for taking the cached passes from the --cache-file.
+    *    If it is unset, every test is run, and the file is written afresh.
+    *
+    *    This value is set by the --cache option, and unset by the
+    *    --no-cache option.  The default value of this option is given by
+    *    the XPCCUT_USE_CACHE macro.  The --force-failure option also keeps
+    *    the cache from being used, or written.
+    *
+    * \accessor
+    *    -  unit_test_options_use_cache_set()
+    *    -  unit_test_options_use_cache()
+    */
+
+   cbool_t m_Use_Cache;
+
+   /**
+    *    Provides the number of times each of the selected tests is run.
+    *    When it is more than 1, all of the tests are run once, then all of
+    *    them again, and so on; the report then gives the fewest, the mean,
+    *    and the most milliseconds each test took, and a test fails if any
+    *    of its runs fails.  With --jobs, the runs of one test can overlap,
+    *    which helps to bring out races.
+    *
+    *    This value is set by the --repeat option.  The default value of
+    *    this option is given by the XPCCUT_REPEAT_COUNT macro.  Repeated
+    *    runs do not use the --cache-file.
+    *
+    * \accessor
+    *    -  unit_test_options_repeat_count_set()
+    *    -  unit_test_options_repeat_count()
+    */
+
+   int m_Repeat_Count;
+
+   /**
+    *    Provides a flag for running the selected tests again and again,
+    *    until one of them fails.  The --repeat count, if given, still limits
+    *    the number of rounds.  The round in which the failure happened is
+    *    finished before the run stops.
+    *
+    *    This value is set by the --until-fail option, and unset by the
+    *    --no-until-fail option.  The default value of this option is given
+    *    by the XPCCUT_UNTIL_FAIL macro.
+    *
+    * \accessor
+    *    -  unit_test_options_until_fail_set()
+    *    -  unit_test_options_until_fail()
+    */
+
+   cbool_t m_Until_Fail;
+
+   /**
+    *    Provides a flag for running the tests in a random order, which
+    *    differs in each round of a --repeat.  It overrides the --order
+    *    option.
+    *
+    *    This value is set by the --shuffle option, and unset by the
+    *    --no-shuffle option.  The default value of this option is given by
+    *    the XPCCUT_SHUFFLE macro.
+    *
+    * \accessor
+    *    -  unit_test_options_shuffle_set()
+    *    -  unit_test_options_shuffle()
+    */
+
+   cbool_t m_Shuffle;
+
+   /**
+    *    Provides the seed of the --shuffle order.  Round i of a run is
+    *    shuffled with the seed plus i, so that a round can be repeated by
+    *    itself, with the seed that the --show-progress output gives for it.
+    *
+    *    This value is set by the --shuffle-seed option, which also sets
+    *    m_Shuffle.  The default value of this option is given by the
+    *    XPCCUT_SHUFFLE_SEED macro.
+    *
+    * \accessor
+    *    -  unit_test_options_shuffle_seed_set()
+    *    -  unit_test_options_shuffle_seed()
+    */
+
+   unsigned int m_Shuffle_Seed;
+
+   /**
+    *    Holds the ordinal number of the current test.
+    *
+    *    This number is set only by unit_test_options_current_test_set(),
+    *    for tests that want to annunciate a particular test number.  The
+    *    test runners leave it alone, so that the options of a run can be
+    *    shared; they keep the number of the running test in a per-thread
+    *    context, which unit_test_options_test_number() falls back on.
+    *
+    * \getter
+    *    -  unit_test_options_current_test()
+    */
+
+   int m_Current_Test_Number;
+
+   /**
+    *    Provides a stock (automated) answer for the static function
+    *    unit_test_status_prompt_before().
+    *
+    *    This value, if non-zero, causes that function to not prompt the
+    *    user, but instead use the given character as the response.  Note
+    *    that the selected response is given for all the calls in the
+    *    unit-test application.
+    *
+    *    The allowed values are:
+    *
+    *       -  0.    This is the default, and turns off automatic responses.
+    *       -  'c'.  Make a response of 'continue'.
+    *       -  's'.  Make a response of 'skip'.
+    *       -  'a'.  Make a response of 'abort'.
+    *       -  'q'.  Make a response of 'quit'.
+    *
+    * \accessor
+    *    -  unit_test_options_prompt_before_set()
+    *    -  unit_test_options_prompt_before()
+    */
+
+   char m_Response_Before;
+
+   /**
+    *    Provides a stock (automated) answer for the static function
+    *    unit_test_status_prompt_after().
+    *
+    *    This value, if non-zero, causes that function to not prompt the
+    *    user, but instead use the given character as the response.  Note
+    *    that the selected response is given for all the calls in the
+    *    unit-test application.
+    *
+    *    The allowed values are:
+    *
+    *       -  0.    This is the default, and turns off automatic responses.
+    *       -  'p'.  Make a response of 'pass'.
+    *       -  'f'.  Make a response of 'fail'.
+    *       -  'a'.  Make a response of 'abort'.
+    *       -  'q'.  Make a response of 'quit'.
+    *
+    * \accessor
+    *    -  unit_test_options_prompt_after_set()
+    *    -  unit_test_options_prompt_after()
+    */
+
+   char m_Response_After;
+
+   /**
+    *    Provides a special value to make simulated tests easier to
+    *    recognize.
+    *
+    *    When testing the unit-test code itself, some output is seen that
+    *    could be confusing.  This flag allows tests to flag their output
+    *    with the word "simulated" to make it obvious that the test is not
+    *    broken.
+    *
+    * \note
+    *    Only tests of the unit-test library will actually need to set this
+    *    value, though it may prove useful in other situations.
+    *
+    * \accessor
+    *    -  unit_test_options_is_simulated_set()
+    *    -  unit_test_options_is_simulated()
+    */
+
+   cbool_t m_Is_Simulated;
+
+} unit_test_options_t;
+
+/*
+ *    These functions are documented in the C module.
+ */
+
+EXTERN_C_DEC
+
+extern cbool_t unit_test_options_init (unit_test_options_t * options);
+
+/*
+ * Now hidden to discourage callers (other than the unit-test application)
+ * from using it.
+ *
+ *    extern cbool_t unit_test_options_initialize
+ *    (
+ *       unit_test_options_t * options,
+ *       cbool_t verbose,
+ *       cbool_t showvalues,
+ *       cbool_t usetextsynch,
  *       cbool_t showstepnumbers,
  *       cbool_t showprogress,
  *       cbool_t stoponerror,
@@ -893,6 +1665,295 @@ extern int unit_test_options_test_sleep_time
 (
    const unit_test_options_t * options
 );
+extern cbool_t unit_test_options_job_count_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_job_count
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_fuzz_job_count_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_fuzz_job_count
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_is_isolated_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_is_isolated
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_test_timeout_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_test_timeout
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shard_count_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_shard_count
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shard_index_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_shard_index
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shard_mode_set
+(
+   unit_test_options_t * options,
+   unit_test_shard_mode_t v
+);
+extern unit_test_shard_mode_t unit_test_options_shard_mode
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_durations_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_durations_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_save_durations_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_save_durations_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_report_format_set
+(
+   unit_test_options_t * options,
+   unit_test_report_format_t v
+);
+extern unit_test_report_format_t unit_test_options_report_format
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_report_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_report_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shard_map_set
+(
+   unit_test_options_t * options,
+   const int * shardmap
+);
+extern cbool_t unit_test_options_names_set
+(
+   unit_test_options_t * options,
+   xpccut_intern_table_t * names
+);
+extern xpccut_intern_table_t * unit_test_options_names
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_in_shard
+(
+   const unit_test_options_t * options,
+   const char * groupname,
+   const char * casename
+);
+extern cbool_t unit_test_options_record_in_shard
+(
+   const unit_test_options_t * options,
+   int recordnumber
+);
+extern cbool_t unit_test_options_is_selected
+(
+   const unit_test_options_t * options,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename
+);
+extern cbool_t unit_test_options_baseline_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_baseline_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_write_baseline_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_write_baseline_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_perf_tolerance_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_perf_tolerance
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_baseline_set
+(
+   unit_test_options_t * options,
+   const unit_test_baseline_t * baseline,
+   int count
+);
+extern const unit_test_baseline_t * unit_test_options_baseline_find
+(
+   const unit_test_options_t * options,
+   int testgroup,
+   int testcase,
+   const char * name
+);
+extern cbool_t unit_test_options_is_profiled_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_is_profiled
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_perf_counters_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_perf_counters
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_huge_pages_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_huge_pages
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_trace_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_trace_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_history_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_history_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_order_set
+(
+   unit_test_options_t * options,
+   unit_test_order_t v
+);
+extern unit_test_order_t unit_test_options_order
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_cache_file_set
+(
+   unit_test_options_t * options,
+   const char * filename
+);
+extern const char * unit_test_options_cache_file
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_cache_key_set
+(
+   unit_test_options_t * options,
+   const char * key
+);
+extern const char * unit_test_options_cache_key
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_use_cache_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_use_cache
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_repeat_count_set
+(
+   unit_test_options_t * options,
+   int v
+);
+extern int unit_test_options_repeat_count
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_until_fail_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_until_fail
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shuffle_set
+(
+   unit_test_options_t * options,
+   cbool_t f
+);
+extern cbool_t unit_test_options_shuffle
+(
+   const unit_test_options_t * options
+);
+extern cbool_t unit_test_options_shuffle_seed_set
+(
+   unit_test_options_t * options,
+   unsigned int seed
+);
+extern unsigned int unit_test_options_shuffle_seed
+(
+   const unit_test_options_t * options
+);
 extern cbool_t unit_test_options_current_test_set
 (
    unit_test_options_t * options,
@@ -902,6 +1963,12 @@ extern int unit_test_options_current_test
 (
    const unit_test_options_t * options
 );
+extern void unit_test_options_context_set (int testnumber);
+extern int unit_test_options_context_test (void);
+extern int unit_test_options_test_number
+(
+   const unit_test_options_t * options
+);
 extern cbool_t unit_test_options_prompt_before_set
 (
    unit_test_options_t * options,
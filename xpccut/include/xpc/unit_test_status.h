@@ -17,6 +17,10 @@
  */
 
 #include <xpc/macros_subset.h>      /* nullptr and other options              */
+#include <xpc/intern.h>             /* xpccut_intern()                        */
+#include <xpc/alloc_count.h>        /* xpccut_alloc_counts_t                  */
+#include <xpc/perf_counters.h>      /* xpccut_perf_values_t                   */
+#include <xpc/table.h>              /* xpccut_table_t and xpccut_record_t     */
 #include <xpc/unit_test_options.h>  /* unit_test_options_t functions, etc.    */
 
 /**
@@ -47,6 +51,27 @@ typedef enum
 
 } unit_test_disposition_t;
 
+/**
+ *    Provides the number of failures of a test that are kept in its
+ *    failure log.  The failures after these are counted, but not kept.
+ */
+
+#define XPCCUT_FAILURE_LOG_SIZE        8
+
+/**
+ *    Holds one entry of the failure log of a unit_test_status_t.  See
+ *    unit_test_status_pass().
+ */
+
+typedef struct
+{
+   int m_Thread;                 /**< The thread that failed the check.       */
+   int m_Subtest;                /**< The sub-test that was running.          */
+   const char * m_Subtest_Name;  /**< The name of that sub-test.              */
+   cbool_t m_Is_Set;             /**< The entry has been filled in.           */
+
+} unit_test_failure_t;
+
 /**
  *    Provides a summary of the current status of the current test.
  *
@@ -74,6 +99,12 @@ typedef enum
  *    The unit-test application can also maintain an overall
  *    unit_test_status_t structure.  This is useful in maintaining the total
  *    duration of all of the tests, for example.
+ *
+ *    The names are held as pointers to interned strings (see the intern.h
+ *    module), rather than as arrays, so that a status is cheap to return
+ *    by value, and so that long names are not cut short.  The names always
+ *    point to a string, which may be empty.  The fields that are used by
+ *    every sub-test come first, so that they share one cache line.
  */
 
 typedef struct
@@ -99,6 +130,173 @@ typedef struct
 
    const unit_test_options_t * m_Test_Options;
 
+   /**
+    *    Provides the name of a sub-test.
+    *
+    *    Each unit-test may have more than one smaller test.  These smaller
+    *    tests are usually just minor parameter variations of a test.  Each
+    *    sub-test is normally implemented by one if-statement in a unit-test
+    *    function.
+    *
+    *    The name of the sub-test is specified in the
+    *    unit_test_status_next_subtest() function, which also returns a
+    *    boolean to indicate if the sub-test should be executed.
+    *
+    *    Also see the m_Test_Case member.
+    *
+    * \getter
+    *    -  unit_test_status_subtest_name()
+    */
+
+   const char * m_Subtest_Name;
+
+   /**
+    *    Provides the numerical identifier of a sub-test case.
+    *
+    *    The values start at 1.  Zero (0) is considered an uninitialized
+    *    value.
+    *
+    *    If the unit_test_status_next_subtest() function is used to
+    *    introduce each sub-test, then the m_Subtest field is incremented
+    *    and can be seen in the test output.  This can help locate a failed
+    *    sub-test more quickly.
+    *
+    *    Also see the m_Subtest_Name member.
+    *
+    * \getter
+    *    -  unit_test_status_subtest()
+    */
+
+   int m_Subtest;
+
+   /**
+    *    Provides the overall result of the test or sub-test.
+    *
+    *    If this value is 'true', the unit-test succeeded.  All sub-tests in
+    *    the unit-test case succeeded.
+    *
+    *    Otherwise, at least one sub-test failed.
+    *
+    * \setter
+    *    -  unit_test_status_pass()
+    *    -  unit_test_status_fail()
+    *    -  unit_test_status_fail_deliberately()
+    */
+
+   cbool_t m_Test_Result;
+
+   /**
+    *    Provides the total number of errors that occurred in the current
+    *    unit-test.
+    *
+    *    It counts the number of sub-tests that failed.
+    *
+    * \getter
+    *    -  unit_test_status_error_count()
+    *
+    * \setter
+    *    -  unit_test_status_passed() [returns true if this count is zero]
+    */
+
+   int m_Subtest_Error_Count;
+
+   /**
+    *    Provides the number of the first sub-test that failed.
+    *
+    *    The theory is that the developer will want to fix the first error
+    *    first, and this value makes it easier to find.
+    *
+    * \getter
+    *    -  unit_test_status_failed_subtest()
+    */
+
+   int m_Failed_Subtest;
+
+   /**
+    *    Provides the overall result of the test or sub-test.
+    *
+    *    The test may have failed, but testing should continue.  The test
+    *    may have been skipped.  It may have failed.  Or, the user may have
+    *    decided to quit the test with a success status, or aborted it with
+    *    a failure status.
+    *
+    *    See the unit_test_disposition_t structure for more information.
+    *
+    * \getter
+    *    -  unit_test_status_disposition()
+    *    -  unit_test_status_is_continue()   [indirect check]
+    *    -  unit_test_status_is_skipped()    [indirect check]
+    *    -  unit_test_status_is_failed()     [indirect check]
+    *    -  unit_test_status_is_quitted()    [indirect check]
+    *    -  unit_test_status_is_aborted()    [indirect check]
+    *    -  unit_test_status_is_okay()       [indirect check]
+    *
+    * \setter
+    *    -  unit_test_status_reset()         [set to 'continue' disposition]
+    *    -  unit_test_status_prompt()        [set as per user response]
+    */
+
+   unit_test_disposition_t m_Test_Disposition;
+
+   /**
+    *    Indicates that a sub-test is running, and that its record has yet
+    *    to be written to the report.  It is only set if a --report-format
+    *    is selected.
+    *
+    * \setter
+    *    -  unit_test_status_next_subtest()
+    *    -  unit_test_status_time_delta()
+    */
+
+   cbool_t m_Subtest_Running;
+
+   /**
+    *    Provides the monotonic time, from xpccut_get_ticks(), at which the
+    *    current test started.  It is set along with m_Start_Time_us, which
+    *    remains as the wall-clock time-stamp of the test, but it is this
+    *    value that is used to time the test.  A value of 0 means that the
+    *    timer has not been started.
+    *
+    * \setter
+    *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
+    */
+
+   xpccut_ticks_t m_Start_Ticks;
+
+   /**
+    *    Provides the monotonic time at which the current sub-test started,
+    *    for the --report-format record of the sub-test.
+    *
+    * \setter
+    *    -  unit_test_status_next_subtest()
+    */
+
+   xpccut_ticks_t m_Subtest_Start_Ticks;
+
+   /**
+    *    Provides the value of m_Subtest_Error_Count when the current
+    *    sub-test started, so that the errors of the sub-test alone can be
+    *    reported.
+    *
+    * \setter
+    *    -  unit_test_status_next_subtest()
+    */
+
+   int m_Subtest_Start_Errors;
+
+   /**
+    *    Provides the number of records written to the report for this
+    *    test.  If it is still 0 when the test is disposed of, then one
+    *    record is written for the test as a whole.
+    *
+    * \setter
+    *    -  unit_test_status_next_subtest()
+    *    -  unit_test_status_time_delta()
+    */
+
+   int m_Report_Count;
+
    /**
     *    Provides the name of a group of unit tests.
     *
@@ -135,7 +333,7 @@ typedef struct
     *    -  unit_test_status_group_name()
     */
 
-   char m_Group_Name[XPCCUT_STRLEN];
+   const char * m_Group_Name;
 
    /**
     *    Provides the brief description of a single test case.
@@ -154,27 +352,7 @@ typedef struct
     *    -  unit_test_status_case_name()
     */
 
-   char m_Case_Description[XPCCUT_STRLEN];
-
-   /**
-    *    Provides the name of a sub-test.
-    *
-    *    Each unit-test may have more than one smaller test.  These smaller
-    *    tests are usually just minor parameter variations of a test.  Each
-    *    sub-test is normally implemented by one if-statement in a unit-test
-    *    function.
-    *
-    *    The name of the sub-test is specified in the
-    *    unit_test_status_next_subtest() function, which also returns a
-    *    boolean to indicate if the sub-test should be executed.
-    *
-    *    Also see the m_Test_Case member.
-    *
-    * \getter
-    *    -  unit_test_status_subtest_name()
-    */
-
-   char m_Subtest_Name[XPCCUT_STRLEN];
+   const char * m_Case_Description;
 
    /**
     *    Provides the numerical identifier of a test group.
@@ -215,140 +393,212 @@ typedef struct
    int m_Test_Case;
 
    /**
-    *    Provides the numerical identifier of a sub-test case.
+    *    Provides the monotonic time at which the current test ended.  It is
+    *    set along with m_End_Time_us.
     *
-    *    The values start at 1.  Zero (0) is considered an uninitialized
-    *    value.
+    * \setter
+    *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
+    */
+
+   xpccut_ticks_t m_End_Ticks;
+
+   /**
+    *    Provides duration of the current test, in milliseconds, with
+    *    nanosecond resolution.
     *
-    *    If the unit_test_status_next_subtest() function is used to
-    *    introduce each sub-test, then the m_Subtest field is incremented
-    *    and can be seen in the test output.  This can help locate a failed
-    *    sub-test more quickly.
+    *    It is calculated from the current values of m_Start_Ticks and
+    *    m_End_Ticks.
     *
-    *    Also see the m_Subtest_Name member.
+    * \setter
+    *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
     *
     * \getter
-    *    -  unit_test_status_subtest()
+    *    -  unit_test_status_duration_ms()
     */
 
-   int m_Subtest;
+   double m_Test_Duration_ms;
 
    /**
-    *    Provides the overall result of the test or sub-test.
-    *
-    *    If this value is 'true', the unit-test succeeded.  All sub-tests in
-    *    the unit-test case succeeded.
+    *    Provides the relative time (in microseconds) at which the current
+    *    test started.
     *
-    *    Otherwise, at least one sub-test failed.
+    *    This time is set at the end of the unit_test_status_initialize()
+    *    function, using the XPCCUT_get_microseconds() function.  It is also
+    *    set, in the same manner, by the unit_test_status_start_timer()
+    *    function.
     *
     * \setter
-    *    -  unit_test_status_pass()
-    *    -  unit_test_status_fail()
-    *    -  unit_test_status_fail_deliberately()
+    *    -  unit_test_status_start_timer()
     */
 
-   cbool_t m_Test_Result;
+   struct timeval m_Start_Time_us;
 
    /**
-    *    Provides the total number of errors that occurred in the current
-    *    unit-test.
+    *    Provides the relative time (in microseconds) at which the current
+    *    test ended.
     *
-    *    It counts the number of sub-tests that failed.
+    *    This time is set to zero by the unit_test_status_start_timer()
+    *    function.
     *
-    * \getter
-    *    -  unit_test_status_error_count()
+    *    It is then retrieved at the end of the test using the
+    *    unit_test_status_time_delta() function.
     *
     * \setter
-    *    -  unit_test_status_passed() [returns true if this count is zero]
+    *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
     */
 
-   int m_Subtest_Error_Count;
+   struct timeval m_End_Time_us;
 
    /**
-    *    Provides the number of the first sub-test that failed.
-    *
-    *    The theory is that the developer will want to fix the first error
-    *    first, and this value makes it easier to find.
+    *    Indicates that the --profile option was in force when the test was
+    *    set up, so that the resources used by the test are being measured.
     *
-    * \getter
-    *    -  unit_test_status_failed_subtest()
+    * \setter
+    *    -  unit_test_status_initialize()
     */
 
-   int m_Failed_Subtest;
+   cbool_t m_Is_Profiled;
 
    /**
-    *    Provides the overall result of the test or sub-test.
+    *    Provides the resources used by the thread when the test started.
+    *    It is sampled along with m_Start_Ticks, if m_Is_Profiled is set.
     *
-    *    The test may have failed, but testing should continue.  The test
-    *    may have been skipped.  It may have failed.  Or, the user may have
-    *    decided to quit the test with a success status, or aborted it with
-    *    a failure status.
+    * \setter
+    *    -  unit_test_status_initialize()
+    *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
+    */
+
+   xpccut_resources_t m_Start_Resources;
+
+   /**
+    *    Provides the resources used by the test, from m_Start_Resources to
+    *    the last call to unit_test_status_time_delta().
     *
-    *    See the unit_test_disposition_t structure for more information.
+    * \setter
+    *    -  unit_test_status_time_delta()
     *
     * \getter
-    *    -  unit_test_status_disposition()
-    *    -  unit_test_status_is_continue()   [indirect check]
-    *    -  unit_test_status_is_skipped()    [indirect check]
-    *    -  unit_test_status_is_failed()     [indirect check]
-    *    -  unit_test_status_is_quitted()    [indirect check]
-    *    -  unit_test_status_is_aborted()    [indirect check]
-    *    -  unit_test_status_is_okay()       [indirect check]
+    *    -  unit_test_status_resources()
+    */
+
+   xpccut_resources_t m_Resources;
+
+   /**
+    *    Indicates that the --perf-counters option was in force when the
+    *    test was set up, so that the hardware counters are being read.
     *
     * \setter
-    *    -  unit_test_status_reset()         [set to 'continue' disposition]
-    *    -  unit_test_status_prompt()        [set as per user response]
+    *    -  unit_test_status_initialize()
     */
 
-   unit_test_disposition_t m_Test_Disposition;
+   cbool_t m_Is_Counted;
 
    /**
-    *    Provides the relative time (in microseconds) at which the current
-    *    test started.
-    *
-    *    This time is set at the end of the unit_test_status_initialize()
-    *    function, using the XPCCUT_get_microseconds() function.  It is also
-    *    set, in the same manner, by the unit_test_status_start_timer()
-    *    function.
+    *    Provides the hardware counters of the thread when the test started.
+    *    They are read along with m_Start_Ticks, if m_Is_Counted is set.
     *
     * \setter
+    *    -  unit_test_status_initialize()
     *    -  unit_test_status_start_timer()
+    *    -  unit_test_status_time_delta()
     */
 
-   struct timeval m_Start_Time_us;
+   xpccut_perf_values_t m_Start_Counters;
 
    /**
-    *    Provides the relative time (in microseconds) at which the current
-    *    test ended.
+    *    Provides the hardware counts of the test, from m_Start_Counters to
+    *    the last call to unit_test_status_time_delta().
     *
-    *    This time is set to zero by the unit_test_status_start_timer()
-    *    function.
+    * \setter
+    *    -  unit_test_status_time_delta()
     *
-    *    It is then retrieved at the end of the test using the
-    *    unit_test_status_time_delta() function.
+    * \getter
+    *    -  unit_test_status_counters()
+    */
+
+   xpccut_perf_values_t m_Counters;
+
+   /**
+    *    Provides the allocation counts of the thread when the test started.
+    *    They are read along with m_Start_Ticks, if the libxpccut_alloc
+    *    library is linked in; otherwise, they are marked as not valid.
     *
     * \setter
+    *    -  unit_test_status_initialize()
     *    -  unit_test_status_start_timer()
     *    -  unit_test_status_time_delta()
     */
 
-   struct timeval m_End_Time_us;
+   xpccut_alloc_counts_t m_Start_Allocations;
 
    /**
-    *    Provides duration of the current test, in milliseconds.
-    *
-    *    It is calculated from the current values of m_Start_Time_us and
-    *    m_End_Time_us;
+    *    Provides the allocation counts of the test, from m_Start_Allocations
+    *    to the last call to unit_test_status_time_delta().  The difference
+    *    of the bytes allocated and freed is what the test left allocated.
     *
     * \setter
-    *    -  unit_test_status_start_timer()
     *    -  unit_test_status_time_delta()
     *
     * \getter
-    *    -  unit_test_status_duration_ms()
+    *    -  unit_test_status_allocations()
     */
 
-   double m_Test_Duration_ms;
+   xpccut_alloc_counts_t m_Allocations;
+
+   /**
+    *    Provides the allocation counts of the thread when the current
+    *    sub-test started, or at the last unit_test_status_no_alloc_check().
+    *
+    * \setter
+    *    -  unit_test_status_initialize()
+    *    -  unit_test_status_next_subtest()
+    *    -  unit_test_status_no_alloc_check()
+    *
+    * \getter
+    *    -  unit_test_status_subtest_allocations()
+    */
+
+   xpccut_alloc_counts_t m_Subtest_Allocations;
+
+   /**
+    *    Provides the number of failed checks of the test, from any thread.
+    *    It is the slot of the next entry of m_Failures, which is reserved
+    *    by an atomic increment.
+    *
+    * \setter
+    *    -  unit_test_status_pass()
+    *
+    * \getter
+    *    -  unit_test_status_failure_count()
+    */
+
+   int m_Failure_Count;
+
+   /**
+    *    Points to the log of the first XPCCUT_FAILURE_LOG_SIZE failed
+    *    checks of the test, with the thread and the sub-test of each.  It
+    *    is null until the first check fails, so a passing status carries
+    *    only the pointer.  The log is taken from the table that holds the
+    *    names of the status (see xpccut_intern_table_alloc()), so it lasts
+    *    as long as the names it points to.  A copy of the status shares
+    *    the log.
+    *
+    *    An entry is filled in by the thread that reserved it, and is marked
+    *    as set last, so that a reader sees only entries that are complete.
+    *
+    * \setter
+    *    -  unit_test_status_pass()
+    *    -  unit_test_status_failure_add()
+    *
+    * \getter
+    *    -  unit_test_status_failure()
+    */
+
+   unit_test_failure_t * m_Failures;
 
    /*
     * \todo
@@ -382,8 +632,38 @@ extern cbool_t unit_test_status_pass
    cbool_t flag
 );
 extern cbool_t unit_test_status_fail (unit_test_status_t * status);
+extern int unit_test_status_failure_count (const unit_test_status_t * status);
+extern const unit_test_failure_t * unit_test_status_failure
+(
+   const unit_test_status_t * status,
+   int index
+);
+extern cbool_t unit_test_status_failure_add
+(
+   unit_test_status_t * status,
+   int thread,
+   int subtest,
+   const char * subtestname
+);
 extern cbool_t unit_test_status_fail_deliberately (unit_test_status_t * status);
 extern cbool_t unit_test_status_start_timer (unit_test_status_t * status);
+extern const xpccut_resources_t * unit_test_status_resources
+(
+   const unit_test_status_t * status
+);
+extern const xpccut_perf_values_t * unit_test_status_counters
+(
+   const unit_test_status_t * status
+);
+extern const xpccut_alloc_counts_t * unit_test_status_allocations
+(
+   const unit_test_status_t * status
+);
+extern cbool_t unit_test_status_subtest_allocations
+(
+   const unit_test_status_t * status,
+   xpccut_alloc_counts_t * counts
+);
 extern double unit_test_status_time_delta
 (
    unit_test_status_t * status,
@@ -397,6 +677,12 @@ extern cbool_t unit_test_status_next_subtest
    unit_test_status_t * status,
    const char * tagname
 );
+extern cbool_t unit_test_status_next_record
+(
+   unit_test_status_t * status,
+   const xpccut_table_t * table,
+   xpccut_record_t * record
+);
 extern cbool_t unit_test_status_prompt
 (
    unit_test_status_t * status,
@@ -455,6 +741,36 @@ extern cbool_t unit_test_status_bool_check
    cbool_t expected_value,
    cbool_t actual_value
 );
+extern cbool_t unit_test_status_perf_check
+(
+   unit_test_status_t * status,
+   const char * name,
+   double measured,
+   double noise
+);
+extern cbool_t unit_test_status_no_alloc_check (unit_test_status_t * status);
+extern cbool_t unit_test_status_buffer_check
+(
+   unit_test_status_t * status,
+   const void * expected_value,
+   const void * actual_value,
+   size_t length
+);
+extern cbool_t unit_test_status_int_array_check
+(
+   unit_test_status_t * status,
+   const int * expected_value,
+   const int * actual_value,
+   size_t count
+);
+extern cbool_t unit_test_status_double_array_check
+(
+   unit_test_status_t * status,
+   const double * expected_value,
+   const double * actual_value,
+   size_t count,
+   double tolerance
+);
 extern cbool_t unit_test_status_show (const unit_test_status_t * status);
 extern cbool_t unit_test_status_trace
 (
@@ -0,0 +1,175 @@
+#ifndef XPCCUT_WATCHDOG_H
+#define XPCCUT_WATCHDOG_H
+
+/**
+ * \file          watchdog.h
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the watchdog that enforces the --test-timeout value for the
+ *    tests that run in the process of the test application.  Also see the
+ *    watchdog.c module.
+ *
+ *    One thread watches every running test, serial or --jobs, by keeping
+ *    their deadlines in a heap, and sleeping until the nearest one.
+ *    Arming and disarming a watch costs a lock and a heap operation; the
+ *    thread is only woken when a new deadline is nearer than the one it
+ *    is sleeping on, so it stays asleep until a test actually runs late.
+ *
+ *    When a test runs past its deadline, the watchdog shows the test, the
+ *    sub-tests it has entered, and, where the platform allows, the stack
+ *    of the thread running it.  If the test then returns within
+ *    XPCCUT_WATCHDOG_GRACE_MS, it counts as a failure and the run goes on.
+ *    If it is still hung, the application is ended with a failure status,
+ *    so that an automated build gets a result instead of stalling.
+ *
+ *    In --isolate mode the parent process does the watching itself, and
+ *    kills a child that runs too long, so the children do not arm watches.
+ */
+
+#include <xpc/portable_subset.h>       /* xpccut_ticks_t                      */
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#include <pthread.h>                   /* pthread_t                           */
+#endif
+
+/**
+ *    Provides the number of sub-tests that a watch remembers, for the
+ *    sequence trace shown when the test times out.  Only the latest ones
+ *    are kept.
+ */
+
+#define XPCCUT_WATCH_TRACE             8
+
+/**
+ *    Provides the time, in milliseconds, that a test that has timed out is
+ *    given to return before the application is ended.
+ */
+
+#define XPCCUT_WATCHDOG_GRACE_MS       2000
+
+/**
+ *    Holds one entry of the sequence trace of a watch.
+ */
+
+typedef struct
+{
+   int m_Subtest;                         /**< The sub-test number.           */
+   const char * m_Subtest_Name;           /**< Its interned name.             */
+
+} xpccut_watch_step_t;
+
+/**
+ *    Holds the watch on one running test.  The runner owns it, normally
+ *    on its stack, and it must stay in place from xpccut_watchdog_arm()
+ *    until xpccut_watchdog_disarm().
+ */
+
+typedef struct xpccut_watch
+{
+   /**
+    *    The time, from xpccut_get_ticks(), at which the watchdog acts.
+    */
+
+   xpccut_ticks_t m_Deadline;
+
+   /**
+    *    The timeout of the test, in milliseconds.  It is 0 if the watch is
+    *    not armed.
+    */
+
+   int m_Timeout;
+
+   /**
+    *    The index of the test, re 0, for the messages.
+    */
+
+   int m_Test_Number;
+
+   /**
+    *    The group name of the test, or null if it is not known.
+    */
+
+   const char * m_Group_Name;
+
+   /**
+    *    The case name of the test, or null if it is not known.
+    */
+
+   const char * m_Case_Name;
+
+   /**
+    *    The position of the watch in the heap of the watchdog, or -1 if it
+    *    is not in the heap.
+    */
+
+   int m_Heap_Index;
+
+   /**
+    *    Set by the watchdog when the test runs past m_Deadline.
+    */
+
+   cbool_t m_Expired;
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+
+   /**
+    *    The thread that runs the test, whose stack is shown on expiry.
+    */
+
+   pthread_t m_Thread;
+
+#endif
+
+   /**
+    *    The number of sub-tests entered so far.  Entry i of the trace is in
+    *    m_Trace[i % XPCCUT_WATCH_TRACE].  It is published by the thread of
+    *    the test after the entry is filled in, with a release store, since
+    *    the watchdog thread reads the trace as the test runs.
+    */
+
+   int m_Steps;
+
+   /**
+    *    The latest sub-tests entered by the test.
+    */
+
+   xpccut_watch_step_t m_Trace[XPCCUT_WATCH_TRACE];
+
+   /**
+    *    The watch that the thread had armed before this one, if a test
+    *    runs a test application of its own.  It gets the trace back when
+    *    this watch is disarmed.
+    */
+
+   struct xpccut_watch * m_Outer;
+
+} xpccut_watch_t;
+
+EXTERN_C_DEC
+
+extern cbool_t xpccut_watchdog_is_available (void);
+extern void xpccut_watchdog_arm
+(
+   xpccut_watch_t * watch,
+   int timeout,
+   int testnumber,
+   const char * groupname,
+   const char * casename
+);
+extern cbool_t xpccut_watchdog_disarm (xpccut_watch_t * watch);
+extern void xpccut_watchdog_step (int subtest, const char * name);
+
+EXTERN_C_END
+
+#endif         /* XPCCUT_WATCHDOG_H */
+
+/*
+ * watchdog.h
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,188 @@
+/**
+ * \file          alloc_count.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the reading of the allocation counts.  Also see the
+ *    alloc_count.h module.
+ *
+ *    This module does not count anything itself.  The libxpccut_alloc
+ *    library (alloc_hooks.c) registers a source of counts, from a
+ *    constructor, before main() starts; until it does, there are no counts
+ *    to read.
+ */
+
+#include <xpc/alloc_count.h>           /* xpccut_alloc_counts_t               */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+/**
+ *    Provides the function that returns the counts of the calling thread,
+ *    or null if the allocator is not being counted.  It is set once,
+ *    before any thread is started.
+ */
+
+static xpccut_alloc_source_t gs_Alloc_Source = nullptr;
+
+/**
+ *    Registers the source of the allocation counts.  Only the
+ *    libxpccut_alloc library is meant to call this function.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37() [indirect test]
+ */
+
+void
+xpccut_alloc_set_source
+(
+   xpccut_alloc_source_t source     /**< The source of the counts, or null.   */
+)
+{
+   gs_Alloc_Source = source;
+}
+
+/**
+ *    Indicates if the allocations are being counted.
+ *
+ * \return
+ *    Returns 'true' if the libxpccut_alloc library is linked in.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+cbool_t
+xpccut_alloc_is_counting (void)
+{
+   return cut_not_nullptr(gs_Alloc_Source);
+}
+
+/**
+ *    Reads the allocation counts of the calling thread.
+ *
+ * \return
+ *    Returns 'true' if the counts could be read.  Otherwise, the counts
+ *    are set to zero, and are marked as not valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+cbool_t
+xpccut_alloc_read
+(
+   xpccut_alloc_counts_t * counts   /**< Receives the counts.                 */
+)
+{
+   cbool_t result = cut_not_nullptr(counts);
+   if (result)
+   {
+      const xpccut_alloc_counts_t * source = nullptr;
+      if (cut_not_nullptr(gs_Alloc_Source))
+         source = (*gs_Alloc_Source)();
+
+      result = cut_not_nullptr(source);
+      if (result)
+      {
+         *counts = *source;
+         counts->m_Is_Valid = true;
+      }
+      else
+      {
+         counts->m_Is_Valid = false;
+         counts->m_Allocations = counts->m_Frees = 0;
+         counts->m_Bytes_Allocated = counts->m_Bytes_Freed = 0;
+      }
+      counts->m_Paused = 0;
+   }
+   else
+      xpccut_errprint_func(_("null counts pointer"));
+
+   return result;
+}
+
+/**
+ *    Calculates the counts from one reading to a later one.
+ *
+ * \return
+ *    Returns 'true' if both readings are valid.  Otherwise, \a delta is
+ *    marked as not valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+cbool_t
+xpccut_alloc_difference
+(
+   const xpccut_alloc_counts_t * c1,   /**< The earlier reading.              */
+   const xpccut_alloc_counts_t * c2,   /**< The later reading.                */
+   xpccut_alloc_counts_t * delta       /**< Receives c2 - c1.                 */
+)
+{
+   cbool_t result = cut_not_nullptr(c1) && cut_not_nullptr(c2);
+   if (result && cut_not_nullptr(delta))
+   {
+      result = c1->m_Is_Valid && c2->m_Is_Valid;
+      delta->m_Is_Valid = result;
+      delta->m_Allocations = c2->m_Allocations - c1->m_Allocations;
+      delta->m_Frees = c2->m_Frees - c1->m_Frees;
+      delta->m_Bytes_Allocated =
+         c2->m_Bytes_Allocated - c1->m_Bytes_Allocated;
+
+      delta->m_Bytes_Freed = c2->m_Bytes_Freed - c1->m_Bytes_Freed;
+      delta->m_Paused = 0;
+   }
+   else
+   {
+      result = false;
+      xpccut_errprint_func(_("null counts pointer"));
+   }
+   return result;
+}
+
+/**
+ *    Stops the counting of the allocations of the calling thread, until
+ *    the matching call to xpccut_alloc_resume().  The calls can be nested.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+void
+xpccut_alloc_pause (void)
+{
+   if (cut_not_nullptr(gs_Alloc_Source))
+   {
+      xpccut_alloc_counts_t * source = (*gs_Alloc_Source)();
+      if (cut_not_nullptr(source))
+         ++source->m_Paused;
+   }
+}
+
+/**
+ *    Starts the counting again, after xpccut_alloc_pause().
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+void
+xpccut_alloc_resume (void)
+{
+   if (cut_not_nullptr(gs_Alloc_Source))
+   {
+      xpccut_alloc_counts_t * source = (*gs_Alloc_Source)();
+      if (cut_not_nullptr(source) && source->m_Paused > 0)
+         --source->m_Paused;
+   }
+}
+
+/*
+ * alloc_count.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
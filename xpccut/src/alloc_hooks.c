@@ -0,0 +1,317 @@
+/**
+ * \file          alloc_hooks.c
+ * \library       xpccut_alloc
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the opt-in replacement of the allocator that counts the
+ *    allocations of each thread, for the libxpccut_alloc library.  Also
+ *    see the alloc_count.h module.
+ *
+ *    The functions below replace the ones of the C library when the
+ *    library is linked into the application, and hand the real work to
+ *    the __libc_malloc() family that the GNU C library exports for just
+ *    this purpose.  The C++ operator new and operator delete of libstdc++
+ *    call malloc() and free(), so they are counted too.
+ *
+ *    Each thread has its own counts, in a thread-local structure of the
+ *    initial-exec model, so that counting an allocation costs a few adds
+ *    and no lock, and never allocates.  The counts are handed to the xpccut
+ *    library by a constructor, before main() starts.
+ *
+ *    On any other C library, this module is empty, and the library has
+ *    nothing to count.
+ */
+
+#include <xpc/alloc_count.h>           /* xpccut_alloc_counts_t               */
+
+#include <stdlib.h>                    /* declares the functions replaced     */
+
+#if defined __GLIBC__ && defined __GNUC__ && ! defined WIN32
+#define XPCCUT_USE_ALLOC_HOOKS 1
+#include <errno.h>                     /* EINVAL, ENOMEM                      */
+#include <malloc.h>                    /* malloc_usable_size(), memalign()    */
+#include <stdint.h>                    /* SIZE_MAX                            */
+#else
+#define XPCCUT_USE_ALLOC_HOOKS 0
+#endif
+
+#if XPCCUT_USE_ALLOC_HOOKS
+
+/*
+ * The allocator of the GNU C library, under the names that are not
+ * replaced.
+ */
+
+extern void * __libc_malloc (size_t size);
+extern void __libc_free (void * block);
+extern void * __libc_calloc (size_t count, size_t size);
+extern void * __libc_realloc (void * block, size_t size);
+extern void * __libc_memalign (size_t alignment, size_t size);
+extern void * __libc_valloc (size_t size);
+extern void * __libc_pvalloc (size_t size);
+
+/**
+ *    Provides the counts of the calling thread.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_alloc_counts_t gs_Alloc_Counts
+   __attribute__((tls_model("initial-exec"))) =
+{
+   true, 0, 0, 0, 0, 0
+};
+
+/**
+ *    Provides the counts of the calling thread to the xpccut library.
+ *
+ * \return
+ *    Returns a pointer to the counts of the calling thread.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37() [indirect test]
+ */
+
+static xpccut_alloc_counts_t *
+xpccut_alloc_hooks_source (void)
+{
+   return &gs_Alloc_Counts;
+}
+
+/**
+ *    Registers the counts with the xpccut library when the application is
+ *    loaded.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37() [indirect test]
+ */
+
+static void __attribute__((constructor))
+xpccut_alloc_hooks_install (void)
+{
+   xpccut_alloc_set_source(xpccut_alloc_hooks_source);
+}
+
+/**
+ *    Counts a block that was allocated, unless the counting is paused.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37() [indirect test]
+ */
+
+static void
+xpccut_alloc_hooks_add
+(
+   void * block                     /**< The new block, or null.              */
+)
+{
+   if (cut_not_nullptr(block) && gs_Alloc_Counts.m_Paused == 0)
+   {
+      ++gs_Alloc_Counts.m_Allocations;
+      gs_Alloc_Counts.m_Bytes_Allocated += (long long)
+         malloc_usable_size(block);
+   }
+}
+
+/**
+ *    Counts a block that is to be freed, unless the counting is paused.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37() [indirect test]
+ */
+
+static void
+xpccut_alloc_hooks_remove
+(
+   size_t size                      /**< The usable size of the block.        */
+)
+{
+   if (gs_Alloc_Counts.m_Paused == 0)
+   {
+      ++gs_Alloc_Counts.m_Frees;
+      gs_Alloc_Counts.m_Bytes_Freed += (long long) size;
+   }
+}
+
+/**
+ *    Replaces malloc().
+ */
+
+void *
+malloc (size_t size)
+{
+   void * result = __libc_malloc(size);
+   xpccut_alloc_hooks_add(result);
+   return result;
+}
+
+/**
+ *    Replaces free().
+ */
+
+void
+free (void * block)
+{
+   if (cut_not_nullptr(block))
+   {
+      xpccut_alloc_hooks_remove(malloc_usable_size(block));
+      __libc_free(block);
+   }
+}
+
+/**
+ *    Replaces calloc().
+ */
+
+void *
+calloc (size_t count, size_t size)
+{
+   void * result = __libc_calloc(count, size);
+   xpccut_alloc_hooks_add(result);
+   return result;
+}
+
+/**
+ *    Replaces realloc().  A block that is resized counts as freed and
+ *    allocated again, whether or not it moved.  If the resizing fails, the
+ *    old block is untouched, and nothing is counted.
+ */
+
+void *
+realloc (void * block, size_t size)
+{
+   size_t oldsize = cut_not_nullptr(block) ? malloc_usable_size(block) : 0 ;
+   void * result = __libc_realloc(block, size);
+   if (cut_not_nullptr(result))
+   {
+      if (cut_not_nullptr(block))
+         xpccut_alloc_hooks_remove(oldsize);
+
+      xpccut_alloc_hooks_add(result);
+   }
+   else if (cut_not_nullptr(block) && size == 0)
+      xpccut_alloc_hooks_remove(oldsize);
+
+   return result;
+}
+
+/**
+ *    Replaces reallocarray(), which the C library would otherwise serve
+ *    without calling realloc().
+ */
+
+void *
+reallocarray (void * block, size_t count, size_t size)
+{
+   void * result = nullptr;
+   if (size != 0 && count > SIZE_MAX / size)
+      errno = ENOMEM;
+   else
+      result = realloc(block, count * size);
+
+   return result;
+}
+
+/**
+ *    Replaces memalign().
+ */
+
+void *
+memalign (size_t alignment, size_t size)
+{
+   void * result = __libc_memalign(alignment, size);
+   xpccut_alloc_hooks_add(result);
+   return result;
+}
+
+/**
+ *    Replaces aligned_alloc().
+ */
+
+void *
+aligned_alloc (size_t alignment, size_t size)
+{
+   return memalign(alignment, size);
+}
+
+/**
+ *    Replaces posix_memalign().  The alignment must be a power of 2 and a
+ *    multiple of the size of a pointer.
+ */
+
+int
+posix_memalign (void ** block, size_t alignment, size_t size)
+{
+   int result = 0;
+   if
+   (
+      alignment % sizeof(void *) != 0 || alignment == 0 ||
+      (alignment & (alignment - 1)) != 0
+   )
+   {
+      result = EINVAL;
+   }
+   else
+   {
+      void * p = memalign(alignment, size);
+      if (cut_not_nullptr(p))
+         *block = p;
+      else
+         result = ENOMEM;
+   }
+   return result;
+}
+
+/**
+ *    Replaces valloc().
+ */
+
+void *
+valloc (size_t size)
+{
+   void * result = __libc_valloc(size);
+   xpccut_alloc_hooks_add(result);
+   return result;
+}
+
+/**
+ *    Replaces pvalloc().
+ */
+
+void *
+pvalloc (size_t size)
+{
+   void * result = __libc_pvalloc(size);
+   xpccut_alloc_hooks_add(result);
+   return result;
+}
+
+#else    /* ! XPCCUT_USE_ALLOC_HOOKS */
+
+/**
+ *    Keeps ISO C from complaining about an empty module.
+ */
+
+typedef int xpccut_alloc_hooks_unused_t;
+
+#endif   /* XPCCUT_USE_ALLOC_HOOKS */
+
+/*
+ * alloc_hooks.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,649 @@
+/**
+ * \file          arena.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the arena, a bump-pointer allocator for the scratch buffers
+ *    of a test, and the test arena of each thread.  Also see the arena.h
+ *    module.
+ *
+ *    The chunks of an arena are allocated with the counting of allocations
+ *    paused, since they outlive the test that caused them, and would
+ *    otherwise show up as leaks of that test.
+ */
+
+#include <xpc/alloc_count.h>           /* xpccut_alloc_pause(), etc.          */
+#include <xpc/arena.h>                 /* xpccut_arena_t, etc.                */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* malloc() and free()                 */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memset(), strlen(), memcpy()        */
+#endif
+
+/**
+ *    Indicates that huge pages can be requested.  This requires mmap().
+ */
+
+#if XPC_HAVE_SYS_MMAN_H && ! defined WIN32
+#define XPCCUT_USE_MMAP 1
+#include <sys/mman.h>                  /* mmap(), munmap(), and madvise()     */
+#else
+#define XPCCUT_USE_MMAP 0
+#endif
+
+/**
+ *    Rounds a size up to a multiple of a power of 2.
+ */
+
+#define XPCCUT_ARENA_ROUND(size, unit) \
+   (((size) + (unit) - 1) & ~((size_t) (unit) - 1))
+
+/**
+ *    Provides the size of the header of a chunk, rounded up so that the
+ *    first block is aligned.
+ */
+
+#define XPCCUT_ARENA_HEADER_SIZE \
+   XPCCUT_ARENA_ROUND(sizeof(xpccut_arena_chunk_t), XPCCUT_ARENA_ALIGNMENT)
+
+/**
+ *    Provides the options of the test arenas that are yet to be made.  It
+ *    is set by unit_test_run_init(), before any worker thread is started.
+ */
+
+static xpccut_arena_flags_t gs_Test_Arena_Flags = XPCCUT_ARENA_NORMAL;
+
+/**
+ *    Provides the test arena of the calling thread.  It allocates nothing
+ *    until a test asks it for a block.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_arena_t gs_Test_Arena;
+
+/**
+ *    Indicates that gs_Test_Arena has been set up.
+ */
+
+static XPCCUT_THREAD_LOCAL cbool_t gs_Test_Arena_Ready = false;
+
+/**
+ *    Provides the first byte of the blocks of a chunk.
+ */
+
+#define XPCCUT_ARENA_DATA(chunk) \
+   ((char *) (chunk) + XPCCUT_ARENA_HEADER_SIZE)
+
+#if XPCCUT_USE_MMAP
+
+/**
+ *    Maps the memory of a chunk on huge pages.  Explicit huge pages are
+ *    tried first; they exist only if the administrator reserved some.
+ *    Then ordinary pages are mapped, and the kernel is asked to back them
+ *    with transparent huge pages.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the mapped memory, or null if it could not be mapped.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07() [indirect test]
+ */
+
+static void *
+xpccut_arena_map
+(
+   size_t size                      /**< The size, a multiple of huge pages.  */
+)
+{
+   void * result = MAP_FAILED;
+   int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined MAP_HUGETLB
+   result = mmap
+   (
+      nullptr, size, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0
+   );
+#endif
+
+   if (result == MAP_FAILED)
+   {
+      result = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+#if defined MADV_HUGEPAGE
+      if (result != MAP_FAILED)
+         (void) madvise(result, size, MADV_HUGEPAGE);
+#endif
+
+   }
+   return result == MAP_FAILED ? nullptr : result ;
+}
+
+#endif   /* XPCCUT_USE_MMAP */
+
+/**
+ *    Allocates a chunk with room for at least \a size bytes of blocks.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the new chunk, or null if it could not be allocated.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07() [indirect test]
+ */
+
+static xpccut_arena_chunk_t *
+xpccut_arena_new_chunk
+(
+   xpccut_arena_t * arena,          /**< The arena, assumed valid.            */
+   size_t size                      /**< The bytes needed for blocks.         */
+)
+{
+   xpccut_arena_chunk_t * result = nullptr;
+   size_t total = XPCCUT_ARENA_HEADER_SIZE +
+      (size > arena->m_Chunk_Size ? size : arena->m_Chunk_Size);
+
+   xpccut_alloc_pause();
+
+#if XPCCUT_USE_MMAP
+   if (arena->m_Flags & XPCCUT_ARENA_HUGE_PAGES)
+   {
+      size_t mapped = XPCCUT_ARENA_ROUND(total, XPCCUT_ARENA_HUGE_PAGE_SIZE);
+      result = xpccut_arena_map(mapped);
+      if (cut_not_nullptr(result))
+      {
+         result->m_Mapped_Size = mapped;
+         total = mapped;
+      }
+   }
+#endif
+
+   if (cut_is_nullptr(result))
+   {
+      result = malloc(total);
+      if (cut_not_nullptr(result))
+         result->m_Mapped_Size = 0;
+   }
+   xpccut_alloc_resume();
+   if (cut_not_nullptr(result))
+   {
+      result->m_Next = nullptr;
+      result->m_Size = total - XPCCUT_ARENA_HEADER_SIZE;
+   }
+   else
+      xpccut_errprint_func(_("arena chunk allocation failed"));
+
+   return result;
+}
+
+/**
+ *    Frees a chunk, however it was allocated.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07() [indirect test]
+ */
+
+static void
+xpccut_arena_free_chunk
+(
+   xpccut_arena_chunk_t * chunk     /**< The chunk, assumed valid.            */
+)
+{
+   xpccut_alloc_pause();
+
+#if XPCCUT_USE_MMAP
+   if (chunk->m_Mapped_Size > 0)
+      (void) munmap(chunk, chunk->m_Mapped_Size);
+   else
+#endif
+
+   free(chunk);
+   xpccut_alloc_resume();
+}
+
+/**
+ *    Sets up an empty arena.  No memory is allocated until the first
+ *    block is.
+ *
+ * \return
+ *    Returns 'true' if the arena pointer was valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+cbool_t
+xpccut_arena_init
+(
+   xpccut_arena_t * arena,          /**< The arena to set up.                 */
+   size_t chunksize,                /**< The size of a chunk, or 0.           */
+   xpccut_arena_flags_t flags       /**< The options of the arena.            */
+)
+{
+   cbool_t result = cut_not_nullptr(arena);
+   if (result)
+   {
+      arena->m_First = arena->m_Current = nullptr;
+      arena->m_Used = arena->m_Allocated = 0;
+      arena->m_Chunk_Size = chunksize > 0 ?
+         XPCCUT_ARENA_ROUND(chunksize, XPCCUT_ARENA_ALIGNMENT) :
+         XPCCUT_ARENA_CHUNK_SIZE ;
+
+      arena->m_Flags = flags;
+   }
+   else
+      xpccut_errprint_func(_("null arena pointer"));
+
+   return result;
+}
+
+/**
+ *    Frees all of the chunks of an arena, which is left empty, and can be
+ *    used again.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_arena_destroy
+(
+   xpccut_arena_t * arena           /**< The arena to free.                   */
+)
+{
+   if (cut_not_nullptr(arena))
+   {
+      xpccut_arena_chunk_t * chunk = arena->m_First;
+      while (cut_not_nullptr(chunk))
+      {
+         xpccut_arena_chunk_t * next = chunk->m_Next;
+         xpccut_arena_free_chunk(chunk);
+         chunk = next;
+      }
+      arena->m_First = arena->m_Current = nullptr;
+      arena->m_Used = arena->m_Allocated = 0;
+   }
+}
+
+/**
+ *    Allocates a block from an arena.  The block is aligned to
+ *    XPCCUT_ARENA_ALIGNMENT bytes, and is not cleared.  It stays valid
+ *    until the arena is rewound to a mark taken before it, or is reset.
+ *
+ *    If the current chunk is full, the next spare chunk is used, if it is
+ *    large enough; otherwise a new chunk is put in front of the spares.
+ *
+ * \return
+ *    Returns the block, or null if the memory ran out.  A size of 0 is
+ *    treated as a size of 1.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void *
+xpccut_arena_alloc
+(
+   xpccut_arena_t * arena,          /**< The arena to allocate from.          */
+   size_t size                      /**< The number of bytes needed.          */
+)
+{
+   void * result = nullptr;
+   if (cut_not_nullptr(arena))
+   {
+      xpccut_arena_chunk_t * chunk = arena->m_Current;
+      size_t offset = XPCCUT_ARENA_ROUND(arena->m_Used, XPCCUT_ARENA_ALIGNMENT);
+      if (size == 0)
+         size = 1;
+
+      if (cut_is_nullptr(chunk) || offset + size > chunk->m_Size)
+      {
+         xpccut_arena_chunk_t * next = cut_not_nullptr(chunk) ?
+            chunk->m_Next : arena->m_First ;
+
+         if (cut_is_nullptr(next) || size > next->m_Size)
+         {
+            xpccut_arena_chunk_t * fresh = xpccut_arena_new_chunk(arena, size);
+            if (cut_not_nullptr(fresh))
+            {
+               fresh->m_Next = next;
+               if (cut_not_nullptr(chunk))
+                  chunk->m_Next = fresh;
+               else
+                  arena->m_First = fresh;
+            }
+            next = fresh;
+         }
+         if (cut_not_nullptr(next))
+         {
+            arena->m_Current = next;
+            arena->m_Used = 0;
+         }
+         chunk = next;
+         offset = 0;
+      }
+      if (cut_not_nullptr(chunk))
+      {
+         result = XPCCUT_ARENA_DATA(chunk) + offset;
+         arena->m_Allocated += offset - arena->m_Used + size;
+         arena->m_Used = offset + size;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null arena pointer"));
+
+   return result;
+}
+
+/**
+ *    Allocates an array from an arena, and clears it.
+ *
+ * \return
+ *    Returns the array, or null if the memory ran out, or if the size of
+ *    the array would overflow.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void *
+xpccut_arena_calloc
+(
+   xpccut_arena_t * arena,          /**< The arena to allocate from.          */
+   size_t count,                    /**< The number of elements.              */
+   size_t size                      /**< The size of an element.              */
+)
+{
+   void * result = nullptr;
+   if (size == 0 || count <= ((size_t) -1) / size)
+   {
+      result = xpccut_arena_alloc(arena, count * size);
+      if (cut_not_nullptr(result))
+         (void) memset(result, 0, count * size);
+   }
+   else
+      xpccut_errprint_func(_("arena array too large"));
+
+   return result;
+}
+
+/**
+ *    Copies a string into an arena.
+ *
+ * \return
+ *    Returns the copy, or null if the memory ran out or \a text is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+char *
+xpccut_arena_strdup
+(
+   xpccut_arena_t * arena,          /**< The arena to allocate from.          */
+   const char * text                /**< The string to copy.                  */
+)
+{
+   char * result = nullptr;
+   if (cut_not_nullptr(text))
+   {
+      size_t length = strlen(text) + 1;
+      result = xpccut_arena_alloc(arena, length);
+      if (cut_not_nullptr(result))
+         (void) memcpy(result, text, length);
+   }
+   else
+      xpccut_errprint_func(_("null string pointer"));
+
+   return result;
+}
+
+/**
+ *    Takes a mark of the current position of an arena.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_arena_mark
+(
+   xpccut_arena_t * arena,          /**< The arena to mark.                   */
+   xpccut_arena_mark_t * mark       /**< Receives the position.               */
+)
+{
+   if (cut_not_nullptr_2(arena, mark))
+   {
+      mark->m_Chunk = arena->m_Current;
+      mark->m_Used = arena->m_Used;
+      mark->m_Allocated = arena->m_Allocated;
+      mark->m_Is_Set = true;
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+}
+
+/**
+ *    Frees, in one step, all of the blocks allocated since a mark was
+ *    taken.  The chunks that they used become spares.  The mark is cleared,
+ *    and rewinding to a cleared mark does nothing, so a mark is used only
+ *    once.  The marks taken after \a mark must not be used after this.
+ *
+ *    A mark taken while the arena was empty does not use the chunk that it
+ *    saw, which xpccut_test_arena_release() may have freed since, as when
+ *    a test destroys a unit_test_t of its own.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_arena_rewind
+(
+   xpccut_arena_t * arena,          /**< The arena to rewind.                 */
+   xpccut_arena_mark_t * mark       /**< The position to go back to.          */
+)
+{
+   if (cut_not_nullptr_2(arena, mark))
+   {
+      if (mark->m_Is_Set)
+      {
+         if (cut_not_nullptr(mark->m_Chunk) && mark->m_Allocated > 0)
+         {
+            arena->m_Current = mark->m_Chunk;
+            arena->m_Used = mark->m_Used;
+         }
+         else
+         {
+            arena->m_Current = arena->m_First;
+            arena->m_Used = 0;
+         }
+         arena->m_Allocated = mark->m_Allocated;
+         mark->m_Is_Set = false;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+}
+
+/**
+ *    Frees all of the blocks of an arena in one step.  The chunks are kept
+ *    for the blocks to come.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_arena_reset
+(
+   xpccut_arena_t * arena           /**< The arena to empty.                  */
+)
+{
+   if (cut_not_nullptr(arena))
+   {
+      arena->m_Current = arena->m_First;
+      arena->m_Used = arena->m_Allocated = 0;
+   }
+}
+
+/**
+ *    Frees the spare chunks of an arena, the ones after the current chunk.
+ *    If the arena holds no blocks, all of the chunks are freed.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_arena_trim
+(
+   xpccut_arena_t * arena           /**< The arena to trim.                   */
+)
+{
+   if (cut_not_nullptr(arena))
+   {
+      if (arena->m_Allocated == 0)
+         xpccut_arena_destroy(arena);
+      else if (cut_not_nullptr(arena->m_Current))
+      {
+         xpccut_arena_chunk_t * chunk = arena->m_Current->m_Next;
+         while (cut_not_nullptr(chunk))
+         {
+            xpccut_arena_chunk_t * next = chunk->m_Next;
+            xpccut_arena_free_chunk(chunk);
+            chunk = next;
+         }
+         arena->m_Current->m_Next = nullptr;
+      }
+   }
+}
+
+/**
+ *    Gets the number of bytes handed out by an arena since it was reset,
+ *    counting the padding that aligns the blocks.
+ *
+ * \return
+ *    Returns the number of bytes, or 0 if \a arena is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+size_t
+xpccut_arena_allocated
+(
+   const xpccut_arena_t * arena     /**< The arena to query.                  */
+)
+{
+   return cut_not_nullptr(arena) ? arena->m_Allocated : 0 ;
+}
+
+/**
+ *    Gets the number of bytes that the chunks of an arena hold, whether
+ *    they are in use or not.
+ *
+ * \return
+ *    Returns the number of bytes, or 0 if \a arena is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+size_t
+xpccut_arena_capacity
+(
+   const xpccut_arena_t * arena     /**< The arena to query.                  */
+)
+{
+   size_t result = 0;
+   if (cut_not_nullptr(arena))
+   {
+      const xpccut_arena_chunk_t * chunk = arena->m_First;
+      while (cut_not_nullptr(chunk))
+      {
+         result += chunk->m_Size;
+         chunk = chunk->m_Next;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Gets the test arena of the calling thread, setting it up the first
+ *    time.  The runner marks it before each test, and rewinds it after, so
+ *    the blocks that a test allocates from it need not be freed.
+ *
+ * \return
+ *    Returns the test arena of the calling thread.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+xpccut_arena_t *
+xpccut_test_arena (void)
+{
+   if (! gs_Test_Arena_Ready)
+   {
+      (void) xpccut_arena_init(&gs_Test_Arena, 0, gs_Test_Arena_Flags);
+      gs_Test_Arena_Ready = true;
+   }
+   return &gs_Test_Arena;
+}
+
+/**
+ *    Sets the options of the test arenas.  They apply to the chunks that
+ *    are allocated from now on, in the test arena of the calling thread,
+ *    and in those of the threads that have not used theirs yet.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_test_arena_flags_set
+(
+   xpccut_arena_flags_t flags       /**< The options of the arenas.           */
+)
+{
+   gs_Test_Arena_Flags = flags;
+   if (gs_Test_Arena_Ready)
+      gs_Test_Arena.m_Flags = flags;
+}
+
+/**
+ *    Frees the chunks of the test arena of the calling thread, if it holds
+ *    no blocks.  A worker thread calls it before it exits, and
+ *    unit_test_destroy() calls it for the main thread.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+void
+xpccut_test_arena_release (void)
+{
+   if (gs_Test_Arena_Ready && gs_Test_Arena.m_Allocated == 0)
+      xpccut_arena_destroy(&gs_Test_Arena);
+}
+
+/*
+ * arena.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,483 @@
+/**
+ * \file          fixture.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the group-level fixtures.  Also see the fixture.h module.
+ *
+ *    The runner calls xpccut_fixture_expect() once for each loaded case of
+ *    each round of the tests (there is more than one round with --repeat
+ *    or --until-fail), before any case of the round can start, so that
+ *    each fixture knows how many cases of its group are still to come.  Then xpccut_fixture_enter() is
+ *    called just before a case is called, and xpccut_fixture_leave() after
+ *    each case is done, whether it was called or skipped.  The first enter
+ *    sets the fixture up, and the leave that brings the count to zero
+ *    tears it down.
+ *
+ *    One lock protects all of the fixtures, since the --jobs workers can
+ *    run cases of the same group at the same time.  The lock is held while
+ *    a setup function runs, so the other workers wait for the state to be
+ *    ready rather than making a second copy of it.
+ */
+
+#include <xpc/fixture.h>               /* unit_test_fixture_list_t            */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* realloc(), free()                   */
+#endif
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define XPCCUT_USE_FIXTURE_LOCK 1
+#include <pthread.h>                   /* the lock on the fixtures            */
+#else
+#define XPCCUT_USE_FIXTURE_LOCK 0
+#endif
+
+#if XPCCUT_USE_FIXTURE_LOCK
+
+/**
+ *    Protects the fixtures of every unit_test_fixture_list_t.
+ */
+
+static pthread_mutex_t gs_Fixture_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ *    Makes sure that xpccut_fixture_at_fork() is called just once.
+ */
+
+static pthread_once_t gs_Fixture_Once = PTHREAD_ONCE_INIT;
+
+/**
+ *    Takes the lock around a fork(), so that an --isolate child, which sets
+ *    up and releases fixtures of its own, does not get the lock held by
+ *    another thread, which would never be released.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_fork_prepare (void)
+{
+   pthread_mutex_lock(&gs_Fixture_Lock);
+}
+
+/**
+ *    Releases the lock taken by xpccut_fixture_fork_prepare(), in both the
+ *    parent and the child.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_fork_done (void)
+{
+   pthread_mutex_unlock(&gs_Fixture_Lock);
+}
+
+/**
+ *    Registers the fork handlers of the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_at_fork (void)
+{
+   (void) pthread_atfork
+   (
+      xpccut_fixture_fork_prepare,
+      xpccut_fixture_fork_done, xpccut_fixture_fork_done
+   );
+}
+
+#endif
+
+/**
+ *    Provides the shared state of the fixture of the case that the calling
+ *    thread is running, for xpccut_fixture_data().
+ */
+
+static XPCCUT_THREAD_LOCAL void * gs_Fixture_Data = nullptr;
+
+/**
+ *    Takes the lock on the fixtures, if there is one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_lock (void)
+{
+#if XPCCUT_USE_FIXTURE_LOCK
+   (void) pthread_once(&gs_Fixture_Once, xpccut_fixture_at_fork);
+   pthread_mutex_lock(&gs_Fixture_Lock);
+#endif
+}
+
+/**
+ *    Releases the lock on the fixtures, if there is one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_unlock (void)
+{
+#if XPCCUT_USE_FIXTURE_LOCK
+   pthread_mutex_unlock(&gs_Fixture_Lock);
+#endif
+}
+
+/**
+ *    Finds the fixture of a test group.  The caller holds the lock.
+ *
+ * \return
+ *    Returns the fixture, or null if the group has none.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static unit_test_fixture_t *
+xpccut_fixture_find
+(
+   unit_test_fixture_list_t * list, /**< The fixtures, assumed valid.         */
+   int testgroup                    /**< The group number to look for.        */
+)
+{
+   unit_test_fixture_t * result = nullptr;
+   int f;
+   for (f = 0; f < list->m_Count; ++f)
+   {
+      if (list->m_Fixtures[f].m_Test_Group == testgroup)
+      {
+         result = &list->m_Fixtures[f];
+         break;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Tears a fixture down, if it is up.  The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29() [indirect test]
+ */
+
+static void
+xpccut_fixture_teardown
+(
+   unit_test_fixture_t * fixture    /**< The fixture, assumed valid.          */
+)
+{
+   if (fixture->m_State == XPCCUT_FIXTURE_UP)
+   {
+      if (cut_not_nullptr(fixture->m_Teardown))
+         (*fixture->m_Teardown)(fixture->m_Data);
+   }
+   fixture->m_Data = nullptr;
+   fixture->m_State = XPCCUT_FIXTURE_DOWN;
+}
+
+/**
+ *    Sets up an empty list of fixtures.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+xpccut_fixture_init
+(
+   unit_test_fixture_list_t * list  /**< The fixtures to set up.              */
+)
+{
+   if (cut_not_nullptr(list))
+   {
+      list->m_Fixtures = nullptr;
+      list->m_Count = 0;
+   }
+}
+
+/**
+ *    Adds the fixture of a test group to a list.
+ *
+ * \return
+ *    Returns 'true' if the fixture was added.  A group number less than 1,
+ *    a null setup function, a group that already has a fixture, or a lack
+ *    of memory, is an error.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+cbool_t
+xpccut_fixture_add
+(
+   unit_test_fixture_list_t * list, /**< The fixtures to add to.              */
+   int testgroup,                   /**< The group that shares the fixture.   */
+   unit_test_setup_func_t setup,    /**< Makes the shared state.              */
+   unit_test_teardown_func_t teardown /**< Cleans it up; can be null.         */
+)
+{
+   cbool_t result = cut_not_nullptr(list);
+   if (result)
+   {
+      result = testgroup > 0 && cut_not_nullptr(setup);
+      if (! result)
+         xpccut_errprint_func(_("a fixture needs a group and a setup"));
+   }
+   if (result)
+   {
+      xpccut_fixture_lock();
+      if (cut_not_nullptr(xpccut_fixture_find(list, testgroup)))
+      {
+         result = false;
+         xpccut_errprint_func(_("the group already has a fixture"));
+      }
+      else
+      {
+         unit_test_fixture_t * fixtures = realloc
+         (
+            list->m_Fixtures, (list->m_Count + 1) * sizeof *fixtures
+         );
+         result = cut_not_nullptr(fixtures);
+         if (result)
+         {
+            unit_test_fixture_t * fixture = &fixtures[list->m_Count++];
+            fixture->m_Test_Group = testgroup;
+            fixture->m_Setup = setup;
+            fixture->m_Teardown = teardown;
+            fixture->m_Data = nullptr;
+            fixture->m_Remaining = 0;
+            fixture->m_State = XPCCUT_FIXTURE_DOWN;
+            list->m_Fixtures = fixtures;
+         }
+         else
+            xpccut_errprint_func(_("out of memory for fixtures"));
+      }
+      xpccut_fixture_unlock();
+   }
+   return result;
+}
+
+/**
+ *    Counts one more case for the fixture of a group, if the group has
+ *    one.  The runner calls this function for each loaded case of each
+ *    round, before any case of the round can start.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+xpccut_fixture_expect
+(
+   unit_test_fixture_list_t * list, /**< The fixtures of the run.             */
+   int testgroup                    /**< The group of the loaded case.        */
+)
+{
+   if (cut_not_nullptr(list) && list->m_Count > 0)
+   {
+      unit_test_fixture_t * fixture;
+      xpccut_fixture_lock();
+      fixture = xpccut_fixture_find(list, testgroup);
+      if (cut_not_nullptr(fixture))
+         ++fixture->m_Remaining;
+
+      xpccut_fixture_unlock();
+   }
+}
+
+/**
+ *    Gets the fixture of a group ready for a case that is about to be
+ *    called, setting it up if this is the first such case.  The shared
+ *    state is then available to the case from xpccut_fixture_data().
+ *
+ * \return
+ *    Returns 'true' if the group has no fixture, or its fixture is set up.
+ *    Returns 'false' if the setup failed, now or earlier in the run, in
+ *    which case the case should not be called.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+cbool_t
+xpccut_fixture_enter
+(
+   unit_test_fixture_list_t * list, /**< The fixtures of the run.             */
+   int testgroup                    /**< The group of the case to be run.     */
+)
+{
+   cbool_t result = true;
+   gs_Fixture_Data = nullptr;
+   if (cut_not_nullptr(list) && list->m_Count > 0)
+   {
+      unit_test_fixture_t * fixture;
+      xpccut_fixture_lock();
+      fixture = xpccut_fixture_find(list, testgroup);
+      if (cut_not_nullptr(fixture))
+      {
+         if (fixture->m_State == XPCCUT_FIXTURE_DOWN)
+         {
+            void * data = nullptr;
+            if ((*fixture->m_Setup)(&data))
+            {
+               fixture->m_Data = data;
+               fixture->m_State = XPCCUT_FIXTURE_UP;
+            }
+            else
+            {
+               fixture->m_State = XPCCUT_FIXTURE_FAILED;
+               xpccut_errprint_func(_("the fixture setup failed"));
+            }
+         }
+         result = fixture->m_State == XPCCUT_FIXTURE_UP;
+         if (result)
+            gs_Fixture_Data = fixture->m_Data;
+      }
+      xpccut_fixture_unlock();
+   }
+   return result;
+}
+
+/**
+ *    Counts a case of a group as done, whether it was called or skipped,
+ *    and tears the fixture of the group down if that was the last case.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+xpccut_fixture_leave
+(
+   unit_test_fixture_list_t * list, /**< The fixtures of the run.             */
+   int testgroup                    /**< The group of the case that is done.  */
+)
+{
+   gs_Fixture_Data = nullptr;
+   if (cut_not_nullptr(list) && list->m_Count > 0)
+   {
+      unit_test_fixture_t * fixture;
+      xpccut_fixture_lock();
+      fixture = xpccut_fixture_find(list, testgroup);
+      if (cut_not_nullptr(fixture))
+      {
+         if (--fixture->m_Remaining <= 0)
+         {
+            fixture->m_Remaining = 0;
+            if (fixture->m_State == XPCCUT_FIXTURE_UP)
+               xpccut_fixture_teardown(fixture);
+         }
+      }
+      xpccut_fixture_unlock();
+   }
+}
+
+/**
+ *    Tears down every fixture that is still up, and clears the counts and
+ *    failed setups, so that the list is ready for another run.  The runner
+ *    calls this function at the start and the end of each run, since a
+ *    run that stops early leaves some cases undone.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+xpccut_fixture_release
+(
+   unit_test_fixture_list_t * list  /**< The fixtures of the run.             */
+)
+{
+   if (cut_not_nullptr(list))
+   {
+      int f;
+      xpccut_fixture_lock();
+      for (f = 0; f < list->m_Count; ++f)
+      {
+         xpccut_fixture_teardown(&list->m_Fixtures[f]);
+         list->m_Fixtures[f].m_Remaining = 0;
+      }
+      xpccut_fixture_unlock();
+   }
+}
+
+/**
+ *    Tears down the fixtures that are still up, and frees the list.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+xpccut_fixture_destroy
+(
+   unit_test_fixture_list_t * list  /**< The fixtures to be freed.            */
+)
+{
+   if (cut_not_nullptr(list))
+   {
+      xpccut_fixture_release(list);
+      free(list->m_Fixtures);
+      xpccut_fixture_init(list);
+   }
+}
+
+/**
+ *    Provides the shared state of the fixture of the running case.
+ *
+ * \return
+ *    Returns the pointer stored by the setup function of the fixture of
+ *    the group of the case that the calling thread is running.  Returns
+ *    null if the group has no fixture, or no case is running.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void *
+xpccut_fixture_data (void)
+{
+   return gs_Fixture_Data;
+}
+
+/*
+ * fixture.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -3,7 +3,7 @@
  * \library       xpccut
  * \author        Chris Ahlstrom
  * \date          2010-03-06
- * \updates       2018-11-12
+ * \updates       2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
@@ -13,6 +13,7 @@
  */
 
 #include <xpc/fuzz.h>                  /* fuzz functions, macros, and enums   */
+#include <xpc/output.h>                /* xpccut_print()                      */
 #include <xpc/portable_subset.h>       /* xpc_errprint_func()                 */
 
 #if XPC_HAVE_CTYPE_H
@@ -86,61 +87,208 @@
 #define XPCCUT_RAND_FACTOR    16807LL
 
 /**
- *    Provides the factor part of the initial linear congruential equation.
+ *    Provides the constant part of the initial linear congruential equation.
  */
 
-#define XPCCUT_RAND_FACTOR    16807LL
+#define XPCCUT_RAND_ADDEND    XPCCUT_RAND_MAX      /* 2147483647, or INT_MAX  */
 
 /**
- *    Provides the constant part of the initial linear congruential equation.
+ *    Provides the number of initial values that are thrown away.  The size
+ *    of the ring buffer, XPCCUT_RAND_DEGREES, is defined in fuzz.h.
  */
 
-#define XPCCUT_RAND_ADDEND    XPCCUT_RAND_MAX      /* 2147483647, or INT_MAX  */
+#define XPCCUT_RAND_THROWAWAY_SIZE  344
 
 /**
- *    Provides the size of ring buffer or feedback window.
+ *    Provides the offset backwards to use in the feedback calculation.
  */
 
-#define XPCCUT_RAND_DEGREES          31
+#define XPCCUT_RAND_OFFSET            3
 
 /**
- *    Provides the size of the throw-away buffer for initial random numbers.
+ *    Combines XPCCUT_RAND_DEGREES and XPCCUT_RAND_OFFSET.
  */
 
-#define XPCCUT_RAND_THROWAWAY_SIZE  344
+#define XPCCUT_RAND_DEGREES_2    (XPCCUT_RAND_DEGREES+XPCCUT_RAND_OFFSET)
 
 /**
- *    Provides the offset backwards to use in the feedback calculation.
+ *    The generator used by the xpccut_srandom(), xpccut_random(), and
+ *    xpccut_rand() functions, and thus by xpccut_fuzz().  Each thread has
+ *    its own, so that tests run by the --jobs option each see the sequence
+ *    that their own seed produces.  Being zero-initialized, it uses the
+ *    XPCCUT_RNG_GLIBC engine until xpccut_rng_init() selects another one.
  */
 
-#define XPCCUT_RAND_OFFSET            3
+static XPCCUT_THREAD_LOCAL xpccut_rng_t gs_rng;
 
 /**
- *    Combines XPCCUT_RAND_DEGREES and XPCCUT_RAND_OFFSET.
+ *    Provides the size of the random-byte blocks that xpccut_fuzz_fill()
+ *    maps onto a character set.  It is a multiple of 24, so that neither
+ *    engine of xpccut_rng_fill_bytes() drops bytes between blocks.
  */
 
-#define XPCCUT_RAND_DEGREES_2    (XPCCUT_RAND_DEGREES+XPCCUT_RAND_OFFSET)
+#define XPCCUT_FUZZ_BLOCK_SIZE      960
 
 /**
- *    The ring buffer for the xpccut_srandom() and xpccut_random()
- *    functions.
+ *    Provides the size of the copies of the allowed and excluded characters
+ *    kept by the character-set cache of xpccut_fuzz().  Longer lists are
+ *    not cached.
  */
 
-static int gs_r[XPCCUT_RAND_DEGREES];
+#define XPCCUT_FUZZ_KEY_SIZE        256
 
 /**
- *    The index counter for the ring buffer for the xpccut_srandom() and
- *    xpccut_random() functions.
+ *    Provides the flags that change the character set, and so are part of
+ *    the key of the character-set cache.
  */
 
-static int gs_r_counter = 0;
+#define XPCCUT_FUZZ_CHARSET_FLAGS   \
+   (XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_NUMBERS_ONLY)
 
 /**
- *    Provides a duplicate implementation of the GNU srandom() seeding
- *    function.
+ *    Holds the character set last built by xpccut_fuzz(), along with the
+ *    arguments it was built from, so that a series of calls with the same
+ *    arguments builds the set only once.
+ */
+
+typedef struct
+{
+   cbool_t m_Is_Valid;                    /**< The set can be reused.     */
+   int m_Flags;                           /**< Character-set flags only.  */
+   char m_Allowed[XPCCUT_FUZZ_KEY_SIZE];  /**< Copy of allowed_chars.     */
+   char m_Excluded[XPCCUT_FUZZ_KEY_SIZE]; /**< Copy of excluded_chars.    */
+   xpccut_fuzz_charset_t m_Charset;       /**< The set that was built.    */
+
+} xpccut_fuzz_cache_t;
+
+/**
+ *    The character-set cache of xpccut_fuzz().  Each thread has its own, so
+ *    that no locking is needed.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_fuzz_cache_t gs_fuzz_cache;
+
+/**
+ *    Generates the next value of the glibc-compatible engine, r[i] =
+ *    r[i-31] + r[i-3], in the ring buffer of the generator.  The value
+ *    r[i-31] is at the cursor, and r[i-3] is 28 places past it, wrapping
+ *    around.  The sum, modulo 2^32, replaces r[i-31].
+ *
+ * \return
+ *    Returns the new value, shifted right by one bit, as glibc does, so it
+ *    ranges from 0 to XPCCUT_RAND_MAX.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See unit-tests 09.01, 09.02, and 09.04.
+ */
+
+static unsigned int
+xpccut_rng_step_glibc
+(
+   xpccut_rng_t * rng            /**< The generator, assumed valid.           */
+)
+{
+   int c = rng->m_R_Counter;
+   int back = c + (XPCCUT_RAND_DEGREES - XPCCUT_RAND_OFFSET);
+   unsigned int value;
+   if (back >= XPCCUT_RAND_DEGREES)
+      back -= XPCCUT_RAND_DEGREES;                             /* wrap around */
+
+   value = rng->m_R[c] + rng->m_R[back];
+   rng->m_R[c] = value;
+   if (++c == XPCCUT_RAND_DEGREES)
+      c = 0;                                                   /* wrap around */
+
+   rng->m_R_Counter = c;
+   return value >> 1;
+}
+
+/**
+ *    Rotates a 64-bit value left, for the xoshiro256** engine.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See unit-test 09.04.
+ */
+
+static unsigned long long
+xpccut_rotl
+(
+   unsigned long long x,         /**< The value to rotate.                    */
+   int k                         /**< The number of bits, from 1 to 63.       */
+)
+{
+   return (x << k) | (x >> (64 - k));
+}
+
+/**
+ *    Generates the next value of the xoshiro256** engine of Blackman and
+ *    Vigna.  See http://prng.di.unimi.it/ for the reference code.
+ *
+ * \return
+ *    Returns the full 64-bit value.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See unit-test 09.04.
+ */
+
+static unsigned long long
+xpccut_rng_step_xoshiro
+(
+   xpccut_rng_t * rng            /**< The generator, assumed valid.           */
+)
+{
+   unsigned long long * s = rng->m_S;
+   unsigned long long result = xpccut_rotl(s[1] * 5, 7) * 9;
+   unsigned long long t = s[1] << 17;
+   s[2] ^= s[0];
+   s[3] ^= s[1];
+   s[1] ^= s[2];
+   s[0] ^= s[3];
+   s[2] ^= t;
+   s[3] = xpccut_rotl(s[3], 45);
+   return result;
+}
+
+/**
+ *    Generates the next value of the splitmix64 generator, which is used to
+ *    expand a 32-bit seed into the 256-bit state of the xoshiro256**
+ *    engine, as its authors recommend.
+ *
+ * \return
+ *    Returns the next value, and advances \a x.
  *
- *    This version is provided so that the same set of random numbers can be
- *    generated on Windows as well.  Also see the xpccut_random() function.
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See unit-test 09.04.
+ */
+
+static unsigned long long
+xpccut_splitmix64
+(
+   unsigned long long * x        /**< The state of the splitmix generator.    */
+)
+{
+   unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+}
+
+/**
+ *    Seeds a generator, and selects its engine.
+ *
+ *    The generator state lives entirely in the xpccut_rng_t object, so any
+ *    number of generators can be used at once, in any number of threads,
+ *    as long as each object is used by one thread at a time.  Seeding costs
+ *    no allocation, so generators can be reseeded freely inside fuzzing
+ *    loops.
+ *
+ *    The XPCCUT_RNG_GLIBC engine duplicates the GNU random() generator, so
+ *    that the same sequences are generated on Windows as well, and so that
+ *    existing seeds still reproduce their fuzz strings.
  *
  * \gnu
  *    A description of the glibc random number generator random() is here:
@@ -165,135 +313,314 @@ static int gs_r_counter = 0;
  *                   <i> (for i >= 34 and i < 344) </i>
  *       -# o[i] = r[i+344] >> 1
  *
- *    Although this is said to be the formula for GNU's random(), it looks
- *    to me like rand() and random() on GNU generate the exact same
- *    sequence.
- *
- *    The code in the two functions, xpccut_srandom() and xpccut_random(),
- *    defined below, derives from the same link shown above.  It also
- *    generates the same sequence as rand() and random().
- *
- *    However, the author's implementation was rewritten to save space, by
- *    allocating a <i> temporary </i> large buffer, copying the last part of it
- *    into a ring-buffer of size 31 (XPCCUT_RAND_DEGREES), and then throwing
- *    away the original buffer.  Our implementation is tested against number
- *    the author provides in that article, as well as against GNU's random()
- *    function.  Here is how it works:
- *
- * \steps
- *    -# Allocate a buffer that is 344 + 31 integers in length.  (344 is
- *       XPCCUT_RAND_THROWAWAY_SIZE, and 31 is XPCCUT_RAND_DEGREES).
- *       -  The random integers generated into the first 344 integers will
- *          be thrown away after having been used to generate the last 31
- *          integers.
- *       -  The last 31 integers will be copied into the \a gs_r[] array,
- *          which is set up as a ring buffer.  Call this array \e r[] for
- *          short.
- *    -# Set r[0] to the value of the seed.
- *    -# Initialize the next 30 (XPCCUT_RAND_DEGREES minus 1) values to the
- *       following linear congruential formula.
-\verbatim
-               r[i] = (XPCCUT_RAND_FACTOR * r[i-1]) % XPCCUT_RAND_MAX;
-\endverbatim
- *    -# Set the next 3 (XPCCUT_RAND_OFFSET) r[] values to the first three r[]
- *       values.
- *    -# Fill the rest of the r[] array so that
-\verbatim
-               r[i] = r[i-XPCCUT_RAND_DEGREES] + r[i-XPCCUT_RAND_OFFSET];
-\endverbatim
- *       Unlike in the article, we calculate XPCCUT_RAND_DEGREES additional
- *       values to be stored in the ring buffer.
- *    -# Copy these last values to the ring buffer.
- *    -# Free the original buffer, throwing away 344 values.
+ *    Only the last 31 (XPCCUT_RAND_DEGREES) values are ever needed, so they
+ *    are kept in the ring buffer m_R[], where r[i] is at index i modulo 31.
+ *    Then r[31] to r[33] are already in place, as r[0] to r[2], and steps 4
+ *    and 5 are both done by xpccut_rng_step_glibc(), which adds r[i-3] to
+ *    r[i-31] in place.  The 310 values of step 4 are simply generated and
+ *    dropped here.
  *
- *    See the xpccut_random() function description for what happens next.
+ *    The XPCCUT_RNG_XOSHIRO engine is xoshiro256**, whose state is set from
+ *    the seed by splitmix64.  It is faster, and has far better statistical
+ *    properties, but its sequences are, of course, different.
  *
- * \note
- *    Also see
- *    -  http://en.wikipedia.org/wiki/Linear_congruential_generator
- *    -  http://en.wikipedia.org/wiki/Linear_feedback_shift_register
+ * \param rng
+ *    The generator to seed.
  *
- * \threadunsafe
- *    The ring buffer and counters are currently static.
+ * \param engine
+ *    The engine that the generator is to use.
  *
  * \param seed
  *    The value to use to start the sequence.  For our purposes, we avoid
  *    seeding with 0 and 1, but those are nonetheless valid values.
  *
  * \return
- *    Returns the value of the seed.
+ *    Returns 'true' if the parameters are valid.
  *
  * \unittests
- *    See unit-tests 09.01 and 09.02 to see how this routine matches the
- *    author's numbers and GNU's random()/rand() function.
+ *    -  unit_unit_test_09_04()
+ */
+
+cbool_t
+xpccut_rng_init
+(
+   xpccut_rng_t * rng,
+   xpccut_rng_engine_t engine,
+   unsigned int seed
+)
+{
+   cbool_t result = cut_not_nullptr(rng);
+   if (result)
+      result = engine == XPCCUT_RNG_GLIBC || engine == XPCCUT_RNG_XOSHIRO;
+
+   if (result)
+   {
+      int i;
+      rng->m_Engine = engine;
+      rng->m_Seed = seed;
+      if (engine == XPCCUT_RNG_XOSHIRO)
+      {
+         unsigned long long x = seed;
+         for (i = 0; i < 4; i++)
+            rng->m_S[i] = xpccut_splitmix64(&x);
+      }
+      else
+      {
+         long long r = (int) seed;        /* signed, as glibc has it       */
+         rng->m_R[0] = seed;                                   /* Step 1      */
+         for (i = 1; i < XPCCUT_RAND_DEGREES; i++)             /* Step 2      */
+         {
+            r = (XPCCUT_RAND_FACTOR * r) % XPCCUT_RAND_MAX;
+            if (r < 0)
+               r += XPCCUT_RAND_MAX;
+
+            rng->m_R[i] = (unsigned int) r;
+         }
+         rng->m_R_Counter = XPCCUT_RAND_OFFSET;                /* Step 3      */
+         for                                                   /* Step 4      */
+         (
+            i = XPCCUT_RAND_DEGREES_2; i < XPCCUT_RAND_THROWAWAY_SIZE; i++
+         )
+         {
+            (void) xpccut_rng_step_glibc(rng);
+         }
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad engine"));
+
+   return result;
+}
+
+/**
+ *    Provides the next number from a generator.
  *
- *    -  unit_unit_test_09_01()
- *    -  unit_unit_test_09_02()
+ * \return
+ *    Returns a random number, ranging from 0 to XPCCUT_RAND_MAX, for both
+ *    engines.  Returns 0 if the pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_09_04()
  */
 
 unsigned int
-xpccut_srandom (unsigned int seed)
+xpccut_rng_next
+(
+   xpccut_rng_t * rng            /**< The generator, seeded.                  */
+)
+{
+   unsigned int result = 0;
+   if (cut_not_nullptr(rng))
+   {
+      if (rng->m_Engine == XPCCUT_RNG_XOSHIRO)
+         result = (unsigned int) (xpccut_rng_step_xoshiro(rng) >> 33);
+      else
+         result = xpccut_rng_step_glibc(rng);
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Provides the next number from a generator, in the desired range.
+ *
+ *    This routine generates integers from 0 to rangemax-1, where rangemax <=
+ *    XPCCUT_RAND_MAX.  Thus, \a rangemax different integer values are
+ *    generated.  The number is the top part of the value of
+ *    xpccut_rng_next(), which is better than the bottom part for the glibc
+ *    engine.
+ *
+ * \return
+ *    Returns the random number, ranging from 0 to rangemax-1.  It returns
+ *    (unsigned) -1 if the range is not positive, or the pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_09_04()
+ */
+
+unsigned int
+xpccut_rng_range
+(
+   xpccut_rng_t * rng,           /**< The generator, seeded.                  */
+   int rangemax                  /**< The range of the numbers, exclusive.    */
+)
 {
-   size_t size = (XPCCUT_RAND_THROWAWAY_SIZE + XPCCUT_RAND_DEGREES) *
-       sizeof(int);
+   unsigned int result = (unsigned int) -1;
+   if (rangemax > 0)
+   {
+      unsigned divisor = ((unsigned) (XPCCUT_RAND_MAX)+1) / (unsigned) rangemax;
+      if (cut_not_nullptr(rng))
+      {
+         result = xpccut_rng_next(rng) / divisor;
+         if (result >= (unsigned) rangemax)
+            result = rangemax - 1;             /* fix the occasional odd case */
+      }
+      else
+         xpccut_errprint_func(_("null pointer"));
+   }
+   else
+      xpccut_errprint_func(_("divisor is zero"));
+
+   return result;
+}
+
+/**
+ *    Fills an array with numbers from a generator.  The values are the same
+ *    as \a count calls to xpccut_rng_next() would give, but the engine is
+ *    selected once, and no call is made per value.
+ *
+ * \return
+ *    Returns 'true' if the pointers are valid and the count is not
+ *    negative.
+ *
+ * \unittests
+ *    -  unit_unit_test_09_04()
+ */
 
-   void * b = malloc(size);                                    /* Step 1      */
-   if (cut_not_nullptr(b))
+cbool_t
+xpccut_rng_fill
+(
+   xpccut_rng_t * rng,           /**< The generator, seeded.                  */
+   unsigned int * destination,   /**< The array to fill.                      */
+   int count                     /**< The number of values to store.          */
+)
+{
+   cbool_t result = cut_not_nullptr_2(rng, destination) && count >= 0;
+   if (result)
    {
       int i;
-      int * r = (int *) b;
-      r[0] = seed;                                             /* Step 2      */
-      for (i = 1; i < XPCCUT_RAND_DEGREES; i++)                /* Step 3      */
+      if (rng->m_Engine == XPCCUT_RNG_XOSHIRO)
       {
-         r[i] = (XPCCUT_RAND_FACTOR * r[i-1]) % XPCCUT_RAND_MAX;
-         if (r[i] < 0)
-            r[i] += XPCCUT_RAND_MAX;
+         for (i = 0; i < count; i++)
+         {
+            destination[i] =
+               (unsigned int) (xpccut_rng_step_xoshiro(rng) >> 33);
+         }
       }
-      for (i = XPCCUT_RAND_DEGREES; i < XPCCUT_RAND_DEGREES_2; i++) /* Step 4 */
+      else
       {
-         r[i] = r[i-XPCCUT_RAND_DEGREES];
+         for (i = 0; i < count; i++)
+            destination[i] = xpccut_rng_step_glibc(rng);
       }
-      for                                                      /* Step 5      */
-      (
-         i = XPCCUT_RAND_DEGREES_2;
-         i < XPCCUT_RAND_THROWAWAY_SIZE+XPCCUT_RAND_DEGREES;
-         i++
-      )
-         r[i] = r[i-XPCCUT_RAND_DEGREES] + r[i-XPCCUT_RAND_OFFSET];
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad count"));
+
+   return result;
+}
 
-      for (i = 0; i < XPCCUT_RAND_DEGREES; i++)                /* Step 6      */
-         gs_r[i] = r[i + XPCCUT_RAND_THROWAWAY_SIZE];
+/**
+ *    Fills a buffer with random bytes from a generator.  The xoshiro256**
+ *    engine provides 8 bytes per step, least-significant first.  The glibc
+ *    engine provides 3 bytes per step, from the top 24 of its 31 bits.
+ *    Bytes left over from the last step are dropped.
+ *
+ * \return
+ *    Returns 'true' if the pointers are valid and the count is not
+ *    negative.
+ *
+ * \unittests
+ *    -  unit_unit_test_09_04()
+ */
 
-      gs_r_counter = 0;
-      free(b);                                                 /* Step 7      */
+cbool_t
+xpccut_rng_fill_bytes
+(
+   xpccut_rng_t * rng,           /**< The generator, seeded.                  */
+   unsigned char * destination,  /**< The buffer to fill.                     */
+   int count                     /**< The number of bytes to store.           */
+)
+{
+   cbool_t result = cut_not_nullptr_2(rng, destination) && count >= 0;
+   if (result)
+   {
+      int i = 0;
+      if (rng->m_Engine == XPCCUT_RNG_XOSHIRO)
+      {
+         while (i < count)
+         {
+            unsigned long long v = xpccut_rng_step_xoshiro(rng);
+            int b;
+            for (b = 0; b < 8 && i < count; b++, v >>= 8)
+               destination[i++] = (unsigned char) (v & 0xFF);
+         }
+      }
+      else
+      {
+         while (i < count)
+         {
+            unsigned int v = xpccut_rng_step_glibc(rng) >> 7;
+            int b;
+            for (b = 0; b < 3 && i < count; b++, v >>= 8)
+               destination[i++] = (unsigned char) (v & 0xFF);
+         }
+      }
    }
    else
-      xpccut_errprint_func(_("could not allocate buffer"));
+      xpccut_errprint_func(_("null pointer or bad count"));
 
-   return seed;
+   return result;
+}
+
+/**
+ *    Provides the generator of the calling thread, which is the one used by
+ *    xpccut_srandom(), xpccut_random(), xpccut_rand(), and xpccut_fuzz().
+ *    It can be passed to the other xpccut_rng functions; for example, to
+ *    make xpccut_fuzz() use the xoshiro256** engine:
+ *
+\verbatim
+      (void) xpccut_rng_init(xpccut_rng_default(), XPCCUT_RNG_XOSHIRO, seed);
+\endverbatim
+ *
+ *    Later calls to xpccut_srandom() keep the engine that was selected.
+ *
+ * \return
+ *    Returns a pointer to the thread-local generator.
+ *
+ * \unittests
+ *    -  unit_unit_test_09_04()
+ */
+
+xpccut_rng_t *
+xpccut_rng_default (void)
+{
+   return &gs_rng;
 }
 
 /**
- *    Provides a duplicate implementation of the GNU random() function.
+ *    Seeds the generator of the calling thread, keeping its engine, which
+ *    is the glibc-compatible one unless xpccut_rng_init() has changed it.
+ *    See xpccut_rng_init() for how the seeding is done.
  *
- *    This version is provided so that the same set of random numbers can be
- *    generated on Windows as well.  See the xpccut_srandom() function.
+ * \param seed
+ *    The value to use to start the sequence.  For our purposes, we avoid
+ *    seeding with 0 and 1, but those are nonetheless valid values.
  *
- *    xpccut_srandom() set up a circular buffer of 31 (XPCCUT_RAND_DEGREES)
- *    values of gs_r[].  The first value, gs_r[0], correspondes to r[344]
- *    (r[XPCCUT_RAND_THROWAWAY_SIZE]), the throw-away buffer.
+ * \return
+ *    Returns the value of the seed.
  *
- * \steps
- *    -# Get the current value, gs_r[gs_r_counter], and save it.
- *    -# Right-shift it, and store it as the result of the function.
- *    -# Find the next value for this location.  It is given by
- *       gs_r[gs_r_counter] + gs_r[gs_r_counter + (31-3)], where the
- *       second index can wrap around.
- *    -# Take this value and copy it to the new location.
- *    -# Increment the ring-buffer counter, wrapping around if necessary.
+ * \unittests
+ *    See unit-tests 09.01 and 09.02 to see how this routine matches the
+ *    author's numbers and GNU's random()/rand() function.
  *
- * \threadunsafe
- *    The ring buffer and counters are currently static.
+ *    -  unit_unit_test_09_01()
+ *    -  unit_unit_test_09_02()
+ */
+
+unsigned int
+xpccut_srandom (unsigned int seed)
+{
+   (void) xpccut_rng_init(&gs_rng, gs_rng.m_Engine, seed);
+   return seed;
+}
+
+/**
+ *    Provides the next number from the generator of the calling thread.
+ *    With the default engine, this is a duplicate implementation of the
+ *    GNU random() function, so that the same set of random numbers can be
+ *    generated on Windows as well.  See the xpccut_rng_init() function.
  *
  * \return
  *    Returns a random number, ranging from 0 to XPCCUT_RAND_MAX.
@@ -302,19 +629,7 @@ xpccut_srandom (unsigned int seed)
 unsigned int
 xpccut_random (void)
 {
-   int current_r = gs_r[gs_r_counter];                         /* Step 1      */
-   unsigned int result = ((unsigned int) current_r) >> 1;      /* Step 2      */
-   int rindex = gs_r_counter +                                 /* Step 3      */
-      (XPCCUT_RAND_DEGREES - XPCCUT_RAND_OFFSET);
-   if (rindex >= XPCCUT_RAND_DEGREES)
-      rindex -= XPCCUT_RAND_DEGREES;                           /* wrap around */
-
-   gs_r[gs_r_counter] += gs_r[rindex];                         /* Step 4      */
-   gs_r_counter++;                                             /* Step 5      */
-   if (gs_r_counter == XPCCUT_RAND_DEGREES)
-      gs_r_counter = 0;                                        /* wrap around */
-
-   return result;
+   return xpccut_rng_next(&gs_rng);
 }
 
 /**
@@ -354,47 +669,21 @@ xpccut_set_seed (unsigned int seed)
 
 /**
  *    A simple routine to generator random numbers in the desired range more
- *    easily.
- *
- *    This routine generates integers from 0 to rangemax-1, where rangemax <=
- *    XPCCUT_RAND_MAX.  Thus, \a rangemax different integer values are
- *    generated.
- *
- *    For efficiency (avoiding a lot of integer division), we only change the
- *    divisor when the range changes.  In most use cases, the same value of \a
- *    rangemax will be used many many times in a row.
+ *    easily, from the generator of the calling thread.  See
+ *    xpccut_rng_range().
  *
  * \param rangemax
  *    The range of the random numbers, exclusive.
  *
  * \return
  *    Returns the random number, ranging from 0 to rangemax-1.  It
- *    returns -1 if the divisor somehow came up 0.
+ *    returns -1 if the range is not positive.
  */
 
 unsigned int
 xpccut_rand (int rangemax)
 {
-   static int s_rangemax = -1;
-   static unsigned divisor = 1;
-   unsigned int rvalue;
-   if (rangemax != s_rangemax)
-   {
-      s_rangemax = rangemax;
-      divisor = ((unsigned) (XPCCUT_RAND_MAX)+1) / (unsigned) rangemax;
-   }
-   if (divisor > 0)
-   {
-      rvalue = ((unsigned) XPCCUT_RAND()) / divisor;
-      if (rvalue >= (unsigned) rangemax)
-         rvalue = rangemax - 1;                /* fix the occasional odd case */
-   }
-   else
-   {
-      xpccut_errprint_func(_("divisor is zero"));
-      rvalue = (unsigned int) -1;
-   }
-   return rvalue;
+   return xpccut_rng_range(&gs_rng, rangemax);
 }
 
 /**
@@ -457,15 +746,10 @@ xpccut_exclude_characters
 }
 
 /**
- *    Fills in the static array with the characters we need to generate.
- *
- * \threadunsafe
- *    Uses a static buffer, and so is unsuitable for use in more than one
- *    thread of execution.
+ *    Fills in an array with the characters we need to generate.
  *
- * \param final_size_ptr
- *    Holds a pointer to an integer that is filled with the actual size of
- *    the selected character set.  This value is 0 if an error occurred.
+ * \param character_set
+ *    The destination of the characters, which must hold 256 bytes.
  *
  * \param flags
  *    Provides a set of options, documented in the xpccut_fuzz_flags_t
@@ -491,21 +775,18 @@ xpccut_exclude_characters
  *    characters that the caller has explicitly allowed.
  *
  * \return
- *    Returns the address of the static character-set buffer, filled with
- *    the desired characters.
- *
- * \sideeffect
- *    The actual size of the character set is returned in \a final_size_ptr.
+ *    Returns the actual size of the character set.  This value is 0 if an
+ *    error occurred.
  */
 
 #define S_UPPERCASE     "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
 #define S_LOWERCASE     "abcdefghijklmnopqrstuvwxyz"
 #define S_NUMBERS       "0123456789+-."
 
-static const char *
+static int
 xpccut_build_character_set
 (
-   int * final_size_ptr,
+   char * character_set,
    xpccut_fuzz_flags_t flags,
    const char * allowed_chars,
    const char * excluded_chars
@@ -513,7 +794,6 @@ xpccut_build_character_set
 {
    static const char * const s_letters = S_UPPERCASE S_LOWERCASE;
    static const char * const s_numbers = S_NUMBERS;
-   static char s_character_set[256];
    cbool_t ok = true;
    int final_size = 0;
    cbool_t default_chars = cut_is_nullptr(allowed_chars) ||
@@ -528,18 +808,18 @@ xpccut_build_character_set
     * thing to nulls.
     */
 
-   (void) memset(s_character_set, 0, sizeof(s_character_set));
+   (void) memset(character_set, 0, 256);
    if (flags & XPCCUT_FF_LETTERS_ONLY)
    {
-      (void) strcat(s_character_set, s_letters);
+      (void) strcat(character_set, s_letters);
       default_chars = false;
-      final_size = (int) strlen(s_character_set);
+      final_size = (int) strlen(character_set);
    }
    if (flags & XPCCUT_FF_NUMBERS_ONLY)
    {
-      (void) strcat(s_character_set, s_numbers);
+      (void) strcat(character_set, s_numbers);
       default_chars = false;
-      final_size = (int) strlen(s_character_set);
+      final_size = (int) strlen(character_set);
    }
    if (default_chars)
    {
@@ -547,7 +827,7 @@ xpccut_build_character_set
       int charvalue;
       for (index = 0, charvalue = 1; index < 255; /* index++, */ charvalue++)
       {
-         s_character_set[index++] = (char) charvalue;
+         character_set[index++] = (char) charvalue;
       }
       final_size = index;
 
@@ -567,17 +847,17 @@ xpccut_build_character_set
           * They get added randomly via an option.
           */
 
-         size_t current_length = strlen(s_character_set);
+         size_t current_length = strlen(character_set);
          size_t added_length = strlen(allowed_chars);
          if (added_length > 0)
          {
             if ((current_length+added_length) < 256)
             {
-               // strcat(s_character_set, allowed_chars);
+               // strcat(character_set, allowed_chars);
 
                (void) memcpy
                (
-                  &s_character_set[current_length],
+                  &character_set[current_length],
                   allowed_chars, added_length
                );
                final_size = (int) (current_length + added_length);
@@ -599,36 +879,236 @@ xpccut_build_character_set
    {
       final_size = xpccut_exclude_characters
       (
-         s_character_set, final_size, excluded_chars
+         character_set, final_size, excluded_chars
       );
    }
    else
       final_size = 0;
 
-   if (cut_not_nullptr(final_size_ptr))
-      *final_size_ptr = final_size;
-
-   return &s_character_set[0];
+   return final_size;
 }
 
 /**
- *    Provides a string that is completely randomized, for use in testing
- *    the robustness of string handling.
+ *    Builds a character set for xpccut_fuzz_fill(), along with the table
+ *    that maps bytes onto it.  With a set of N characters, the first
+ *    256 - (256 % N) byte values each map to one character, so that every
+ *    character has the same number of byte values, and the rest of the byte
+ *    values are thrown away.  The fill is thus unbiased for any set size.
  *
- * \note
- *    This function uses the C library function rand().  This function is
- *    usually a very simple function of the form
+ * \param charset
+ *    The character set to build.
  *
-\verbatim
-         return ((next = next * 1103515245 + 12345) / 65536) % 32768
-\endverbatim
+ * \param flags
+ *    Provides a set of options, documented in the xpccut_fuzz_flags_t
+ *    enumeration.  Only XPCCUT_FF_LETTERS_ONLY and XPCCUT_FF_NUMBERS_ONLY
+ *    apply here, as in xpccut_fuzz().
  *
- *    While we have a better (and slower) function called ran2() in the XPC
- *    library, the one used here is almost assuredly good enough for fuzz
+ * \param allowed_chars
+ *    Provides an optional list of characters to be used in the strings, as
+ *    in xpccut_fuzz().
+ *
+ * \param excluded_chars
+ *    Provides an optional list of characters to exclude from the strings,
+ *    as in xpccut_fuzz().
+ *
+ * \return
+ *    Returns 'true' if the pointer was valid and the set is not empty.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_06()
+ */
+
+cbool_t
+xpccut_fuzz_charset_init
+(
+   xpccut_fuzz_charset_t * charset,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+)
+{
+   cbool_t result = cut_not_nullptr(charset);
+   if (result)
+   {
+      int size = xpccut_build_character_set
+      (
+         charset->m_Characters, flags, allowed_chars, excluded_chars
+      );
+      charset->m_Size = size;
+      (void) memset(charset->m_Map, 0, sizeof(charset->m_Map));
+      result = size > 0;
+      if (result)
+      {
+         int limit = 256 - (256 % size);
+         int b;
+         for (b = 0; b < limit; b++)
+            charset->m_Map[b] = (unsigned char) charset->m_Characters[b % size];
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Fills a buffer with random characters from a character set, at a much
+ *    higher rate than xpccut_fuzz() does one character at a time.
+ *
+ *    The random bytes are made in blocks by xpccut_rng_fill_bytes(), and
+ *    each block is mapped through the table of the set.  The mapping loop
+ *    has no branches; a byte that is thrown away is stored and then
+ *    overwritten by the next one.  No processor-specific code is used, so
+ *    a generator in a given state always yields the same characters, on
+ *    every platform.
+ *
+ *    No null terminator is appended.
+ *
+ * \param rng
+ *    The generator, which must be seeded.
+ *
+ * \param charset
+ *    The character set, built by xpccut_fuzz_charset_init().
+ *
+ * \param destination
+ *    The buffer to fill.
+ *
+ * \param count
+ *    The number of characters to store.
+ *
+ * \return
+ *    Returns 'true' if the pointers are valid, the set is not empty, and
+ *    the count is not negative.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_06()
+ */
+
+cbool_t
+xpccut_fuzz_fill
+(
+   xpccut_rng_t * rng,
+   const xpccut_fuzz_charset_t * charset,
+   char * destination,
+   int count
+)
+{
+   cbool_t result = cut_not_nullptr_3(rng, charset, destination) &&
+      count >= 0;
+
+   if (result)
+      result = charset->m_Size > 0;
+
+   if (result)
+   {
+      const unsigned char * map = charset->m_Map;
+      unsigned char block[XPCCUT_FUZZ_BLOCK_SIZE];
+      int i = 0;
+      while (i < count)
+      {
+         int wanted = count - i;
+         int b;
+         if (wanted > XPCCUT_FUZZ_BLOCK_SIZE)
+            wanted = XPCCUT_FUZZ_BLOCK_SIZE;
+
+         (void) xpccut_rng_fill_bytes(rng, block, wanted);
+         for (b = 0; b < wanted; b++)
+         {
+            unsigned char c = map[block[b]];
+            destination[i] = (char) c;
+            i += c != 0;
+         }
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer, empty set, or bad count"));
+
+   return result;
+}
+
+/**
+ *    Provides the character set that xpccut_fuzz() uses, building it only
+ *    if the arguments differ from those of the last call in this thread.
+ *    A null list and an empty list are the same here, as they are to
+ *    xpccut_build_character_set().  A set that could not be built is not
+ *    cached, so that its error is reported at every call.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the character set, whose size is 0 if it could not be built.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_06() [indirect test]
+ */
+
+static const xpccut_fuzz_charset_t *
+xpccut_fuzz_cached_charset
+(
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+)
+{
+   xpccut_fuzz_cache_t * cache = &gs_fuzz_cache;
+   int keyflags = (int) (flags & XPCCUT_FUZZ_CHARSET_FLAGS);
+   const char * allowed = cut_is_nullptr(allowed_chars) ?
+      "" : allowed_chars ;
+
+   const char * excluded = cut_is_nullptr(excluded_chars) ?
+      "" : excluded_chars ;
+
+   cbool_t hit = cache->m_Is_Valid && cache->m_Flags == keyflags &&
+      strcmp(cache->m_Allowed, allowed) == 0 &&
+      strcmp(cache->m_Excluded, excluded) == 0;
+
+   if (! hit)
+   {
+      cbool_t ok = xpccut_fuzz_charset_init
+      (
+         &cache->m_Charset, flags, allowed_chars, excluded_chars
+      );
+      if (ok)
+      {
+         ok = strlen(allowed) < XPCCUT_FUZZ_KEY_SIZE &&
+            strlen(excluded) < XPCCUT_FUZZ_KEY_SIZE;
+      }
+      cache->m_Is_Valid = ok;
+      if (ok)
+      {
+         cache->m_Flags = keyflags;
+         (void) strcpy(cache->m_Allowed, allowed);
+         (void) strcpy(cache->m_Excluded, excluded);
+      }
+   }
+   return &cache->m_Charset;
+}
+
+/**
+ *    Provides a string that is completely randomized, for use in testing
+ *    the robustness of string handling.
+ *
+ * \note
+ *    This function uses the C library function rand().  This function is
+ *    usually a very simple function of the form
+ *
+\verbatim
+         return ((next = next * 1103515245 + 12345) / 65536) % 32768
+\endverbatim
+ *
+ *    While we have a better (and slower) function called ran2() in the XPC
+ *    library, the one used here is almost assuredly good enough for fuzz
  *    testing.
  *
+ *    The character set is built only when the flags, \a allowed_chars, or
+ *    \a excluded_chars differ from those of the previous call in the same
+ *    thread, so a series of calls with the same arguments is cheap.
+ *
  * \threadunsafe
- *    Due to the usage of xpccut_rand().  Not critical at the moment.
+ *    Due to the usage of xpccut_rand().  However, the generator and the
+ *    character-set cache are local to the calling thread, so calls in
+ *    different threads do not interfere.
  *
  * \param destination
  *    Provides the destination for the constructed string.
@@ -727,11 +1207,12 @@ xpccut_fuzz
 
    if (ok)
    {
-      int character_set_size = 0;
-      const char * character_set = xpccut_build_character_set
+      const xpccut_fuzz_charset_t * charset = xpccut_fuzz_cached_charset
       (
-         &character_set_size, flags, allowed_chars, excluded_chars
+         flags, allowed_chars, excluded_chars
       );
+      const char * character_set = charset->m_Characters;
+      int character_set_size = charset->m_Size;
 
       /*
        * For testing or verification, the XPCCUT_FF_DUMP_CHARSET bit value
@@ -776,19 +1257,34 @@ xpccut_fuzz
                i = (int) strlen(prologue);
                memcpy(destination, prologue, i);
             }
-            for ( ; i < number_of_bytes; i++)
+            if (flags & XPCCUT_FF_BULK)
+            {
+               if (i < number_of_bytes)
+               {
+                  (void) xpccut_fuzz_fill
+                  (
+                     xpccut_rng_default(), charset,
+                     &destination[i], number_of_bytes - i
+                  );
+                  i = number_of_bytes;
+               }
+            }
+            else
             {
-               int random_index = xpccut_rand(rangemax);
+               for ( ; i < number_of_bytes; i++)
+               {
+                  int random_index = xpccut_rand(rangemax);
 
-               /*
-                * fprintf
-                * (
-                *    stdout, "character[%d] = '%c' (char-set[%d])\n",
-                *    i, character_set[random_index], random_index
-                * );
-                */
+                  /*
+                   * fprintf
+                   * (
+                   *    stdout, "character[%d] = '%c' (char-set[%d])\n",
+                   *    i, character_set[random_index], random_index
+                   * );
+                   */
 
-               destination[i] = character_set[random_index];
+                  destination[i] = character_set[random_index];
+               }
             }
             destination[i] = 0;
             if (cut_not_nullptr(epilogue))
@@ -812,6 +1308,364 @@ xpccut_fuzz
    return seed;
 }
 
+/**
+ *    Seeds a generator for one block of a fuzz stream.  The splitmix64
+ *    generator mixes the seed of the stream, and that is combined with the
+ *    number of the block to start the state of an xoshiro256** engine, so
+ *    that each block can be made on its own.  The xoshiro256** engine is
+ *    always used here, since it is quick to seed.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07() [indirect test]
+ */
+
+static void
+xpccut_fuzz_stream_seed_block
+(
+   xpccut_rng_t * rng,           /**< The generator to seed.                  */
+   unsigned int seed,            /**< The seed of the stream.                 */
+   long long block               /**< The number of the block.                */
+)
+{
+   unsigned long long x = (unsigned long long) seed;
+   int i;
+   x = xpccut_splitmix64(&x) ^ (unsigned long long) block;
+   rng->m_Engine = XPCCUT_RNG_XOSHIRO;
+   rng->m_Seed = seed;
+   for (i = 0; i < 4; i++)
+      rng->m_S[i] = xpccut_splitmix64(&x);
+}
+
+/**
+ *    Sets up a fuzz stream.  Nothing is generated until the stream is read.
+ *
+ * \param stream
+ *    The stream to set up.
+ *
+ * \param length
+ *    The length of the stream, including the prologue and the epilogue,
+ *    which must fit into it.  If the XPCCUT_FF_RANDOM_SIZE flag is set,
+ *    then this is the largest length, and the actual length, which is at
+ *    least that of the prologue and epilogue, is picked from the seed.
+ *
+ * \param seed
+ *    The seed of the stream.  XPCCUT_SEED_RANDOMIZE picks one from the
+ *    time, and XPCCUT_SEED_SKIP takes one from the generator of the calling
+ *    thread, so that it follows xpccut_set_seed().  Either way, the seed
+ *    that is used is kept, and is given by xpccut_fuzz_stream_seed().
+ *
+ * \param flags
+ *    Provides a set of options, documented in the xpccut_fuzz_flags_t
+ *    enumeration.  XPCCUT_FF_LETTERS_ONLY, XPCCUT_FF_NUMBERS_ONLY, and
+ *    XPCCUT_FF_RANDOM_SIZE apply here.
+ *
+ * \param allowed_chars
+ *    Provides an optional list of characters to be used, as in
+ *    xpccut_fuzz().
+ *
+ * \param excluded_chars
+ *    Provides an optional list of characters to exclude, as in
+ *    xpccut_fuzz().
+ *
+ * \param prologue
+ *    Provides an optional string that starts the stream.
+ *
+ * \param epilogue
+ *    Provides an optional string that ends the stream.
+ *
+ * \return
+ *    Returns 'true' if the stream was set up.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+cbool_t
+xpccut_fuzz_stream_init
+(
+   xpccut_fuzz_stream_t * stream,
+   long long length,
+   unsigned int seed,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars,
+   const char * prologue,
+   const char * epilogue
+)
+{
+   cbool_t result = cut_not_nullptr(stream);
+   if (result)
+   {
+      int pl = cut_is_nullptr(prologue) ? 0 : (int) strlen(prologue) ;
+      int el = cut_is_nullptr(epilogue) ? 0 : (int) strlen(epilogue) ;
+      stream->m_Length = 0;
+      stream->m_Offset = 0;
+      stream->m_Block_Index = -1;
+      result = length >= (long long) pl + el;
+      if (result)
+      {
+         result = xpccut_fuzz_charset_init
+         (
+            &stream->m_Charset, flags, allowed_chars, excluded_chars
+         );
+      }
+      else
+         xpccut_errprint_func(_("stream too short for prologue and epilogue"));
+
+      if (result)
+      {
+         if (seed == XPCCUT_SEED_RANDOMIZE)
+            seed = (unsigned int) time(NULL);
+         else if (seed == XPCCUT_SEED_SKIP)
+            seed = xpccut_random();
+
+         if (seed == XPCCUT_SEED_RANDOMIZE || seed == XPCCUT_SEED_SKIP)
+            seed += 2;                       /* keep it usable as a seed   */
+
+         stream->m_Seed = seed;
+         stream->m_Prologue = prologue;
+         stream->m_Prologue_Length = pl;
+         stream->m_Epilogue = epilogue;
+         stream->m_Epilogue_Length = el;
+         stream->m_Length = length;
+         if (flags & XPCCUT_FF_RANDOM_SIZE)
+         {
+            unsigned long long x = (unsigned long long) seed;
+            unsigned long long span = (unsigned long long) (length - pl - el);
+            unsigned long long r = xpccut_splitmix64(&x);
+            stream->m_Length = pl + el + (long long) (r % (span + 1));
+         }
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ * \getter stream->m_Length
+ *    Returns 0 if the stream is null or was not set up.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+long long
+xpccut_fuzz_stream_length (const xpccut_fuzz_stream_t * stream)
+{
+   return cut_not_nullptr(stream) ? stream->m_Length : 0 ;
+}
+
+/**
+ * \getter stream->m_Seed
+ *    Returns XPCCUT_SEED_ERROR if the stream is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+unsigned int
+xpccut_fuzz_stream_seed (const xpccut_fuzz_stream_t * stream)
+{
+   return cut_not_nullptr(stream) ? stream->m_Seed : XPCCUT_SEED_ERROR ;
+}
+
+/**
+ *    Copies part of a fuzz stream, from any offset.  Only the block of fuzz
+ *    characters that holds each byte is made, and the latest block is kept
+ *    in the stream, so the position of the read does not affect its cost.
+ *    The position used by xpccut_fuzz_stream_next() is not changed.
+ *
+ * \param stream
+ *    The stream, set up by xpccut_fuzz_stream_init().
+ *
+ * \param offset
+ *    The offset of the first byte to copy.
+ *
+ * \param destination
+ *    The buffer to fill.  No null terminator is appended.
+ *
+ * \param count
+ *    The number of bytes to copy.
+ *
+ * \return
+ *    Returns the number of bytes copied, which is less than \a count only
+ *    at the end of the stream, and 0 at or past the end.  It returns -1 if
+ *    a pointer is null or a number is negative.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+int
+xpccut_fuzz_stream_read
+(
+   xpccut_fuzz_stream_t * stream,
+   long long offset,
+   char * destination,
+   int count
+)
+{
+   int result = -1;
+   if (cut_not_nullptr_2(stream, destination) && offset >= 0 && count >= 0)
+   {
+      long long pl = stream->m_Prologue_Length;
+      long long el = stream->m_Epilogue_Length;
+      long long ebegin = stream->m_Length - el;  /* offset of epilogue     */
+      result = 0;
+      while (result < count && offset < stream->m_Length)
+      {
+         const char * source;
+         long long available;
+         long long wanted = count - result;
+         if (offset < pl)
+         {
+            source = stream->m_Prologue + offset;
+            available = pl - offset;
+         }
+         else if (offset >= ebegin)
+         {
+            source = stream->m_Epilogue + (offset - ebegin);
+            available = stream->m_Length - offset;
+         }
+         else
+         {
+            long long body = offset - pl;
+            long long block = body / XPCCUT_FUZZ_STREAM_BLOCK;
+            int within = (int) (body % XPCCUT_FUZZ_STREAM_BLOCK);
+            if (block != stream->m_Block_Index)
+            {
+               xpccut_rng_t rng;
+               xpccut_fuzz_stream_seed_block(&rng, stream->m_Seed, block);
+               (void) xpccut_fuzz_fill
+               (
+                  &rng, &stream->m_Charset,
+                  stream->m_Block, XPCCUT_FUZZ_STREAM_BLOCK
+               );
+               stream->m_Block_Index = block;
+            }
+            source = &stream->m_Block[within];
+            available = XPCCUT_FUZZ_STREAM_BLOCK - within;
+            if (available > ebegin - offset)
+               available = ebegin - offset;
+         }
+         if (available > wanted)
+            available = wanted;
+
+         (void) memcpy(&destination[result], source, (size_t) available);
+         result += (int) available;
+         offset += available;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad offset or count"));
+
+   return result;
+}
+
+/**
+ *    Copies the next part of a fuzz stream, and advances its position, so
+ *    that the stream can be read in order like a file.
+ *
+ * \param stream
+ *    The stream, set up by xpccut_fuzz_stream_init().
+ *
+ * \param destination
+ *    The buffer to fill.  No null terminator is appended.
+ *
+ * \param count
+ *    The largest number of bytes to copy.
+ *
+ * \return
+ *    Returns the number of bytes copied, which is 0 at the end of the
+ *    stream, or -1 if an argument is bad.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+int
+xpccut_fuzz_stream_next
+(
+   xpccut_fuzz_stream_t * stream,
+   char * destination,
+   int count
+)
+{
+   int result = -1;
+   if (cut_not_nullptr(stream))
+   {
+      result = xpccut_fuzz_stream_read
+      (
+         stream, stream->m_Offset, destination, count
+      );
+      if (result > 0)
+         stream->m_Offset += result;
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Passes the rest of a fuzz stream, from its current position, to a
+ *    callback function, in chunks of up to XPCCUT_FUZZ_STREAM_BLOCK bytes.
+ *    Only one chunk is held at a time, so a stream of any length can be
+ *    fed to a parser without allocating it.
+ *
+ * \param stream
+ *    The stream, set up by xpccut_fuzz_stream_init().
+ *
+ * \param sink
+ *    The callback.  If it returns 'false', the stream is stopped, and its
+ *    position is left after the chunk that was refused.
+ *
+ * \param context
+ *    A pointer passed unchanged to the callback.
+ *
+ * \return
+ *    Returns 'true' if the end of the stream was reached.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_07()
+ */
+
+cbool_t
+xpccut_fuzz_stream_generate
+(
+   xpccut_fuzz_stream_t * stream,
+   xpccut_fuzz_sink_t sink,
+   void * context
+)
+{
+   cbool_t result = cut_not_nullptr_2(stream, sink);
+   if (result)
+   {
+      char chunk[XPCCUT_FUZZ_STREAM_BLOCK];
+      for (;;)
+      {
+         int count = xpccut_fuzz_stream_next(stream, chunk, sizeof(chunk));
+         if (count <= 0)
+            break;
+
+         if (! sink(context, chunk, count))
+         {
+            result = false;
+            break;
+         }
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
 /**
  *    Provides a string that is lightly randomized, for use in testing string
  *    handling.
@@ -876,31 +1730,77 @@ xpccut_garbled_string
    char * source,
    int length
 )
+{
+   return xpccut_rng_garbled_string(&gs_rng, source, length);
+}
+
+/**
+ *    Does the work of xpccut_garbled_string(), using the given generator
+ *    rather than that of the calling thread.  With the generator from
+ *    xpccut_rng_default(), the two functions are the same.  The copy of the
+ *    string against which the changes are counted is taken from the test
+ *    arena of the thread, and given back before returning.
+ *
+ * \param rng
+ *    The generator, which must be seeded.
+ *
+ * \param source
+ *    Provides the string to corrupt in place.  The byte at \a length is
+ *    read, but not changed.
+ *
+ * \param length
+ *    Provides the number of bytes that can be changed.
+ *
+ * \return
+ *    Returns the number of characters that were actually changed.  If a
+ *    number less than zero is returned, an error occurred.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_05() [indirect test]
+ *    -  unit_unit_test_10_08() [indirect test]
+ */
+
+int
+xpccut_rng_garbled_string
+(
+   xpccut_rng_t * rng,
+   char * source,
+   int length
+)
 {
    int result = -1;
-   if (cut_not_nullptr(source))
+   if (cut_not_nullptr_2(rng, source))
    {
       if (length > 0)
       {
-         int altered_byte_count = xpccut_rand(length);
+         int altered_byte_count = xpccut_rng_range(rng, length);
          int i;
-         char * oldversion = malloc(length+1);
+         xpccut_arena_mark_t mark;
+         char * oldversion;
+         xpccut_arena_mark(xpccut_test_arena(), &mark);
+         oldversion = xpccut_arena_alloc(xpccut_test_arena(), length + 1);
          if (cut_not_nullptr(oldversion))
          {
             (void) memcpy(oldversion, source, length+1); // includes possible null
             for (i = 0; i < altered_byte_count; i++)
             {
-               int altered_byte_index = xpccut_rand(length);
-               int new_byte_value = xpccut_rand(256);
+               int altered_byte_index = xpccut_rng_range(rng, length);
+               int new_byte_value = xpccut_rng_range(rng, 256);
                source[altered_byte_index] = (char) new_byte_value;
                if ((altered_byte_index < 0) || (altered_byte_index >= length))
                {
-                  xpccut_errprint_3_func(_("function broken"), "xpccut_rand()");
+                  xpccut_errprint_3_func
+                  (
+                     _("function broken"), "xpccut_rng_range()"
+                  );
                   result = -2;
                }
                if ((new_byte_value < 0) || (new_byte_value >= 256))
                {
-                  xpccut_errprint_3_func(_("function broken"), "xpccut_rand()");
+                  xpccut_errprint_3_func
+                  (
+                     _("function broken"), "xpccut_rng_range()"
+                  );
                   result = -3;
                }
             }
@@ -913,6 +1813,7 @@ xpccut_garbled_string
                      result++;
                }
             }
+            xpccut_arena_rewind(xpccut_test_arena(), &mark);
          }
          else
          {
@@ -933,7 +1834,149 @@ xpccut_garbled_string
 }
 
 /**
- *    Dumps a string.
+ *    Makes a fuzz string with xpccut_fuzz(), in a buffer allocated from an
+ *    arena.  The buffer is sized for \a number_of_bytes and the final null,
+ *    or for the whole character set if XPCCUT_FF_DUMP_CHARSET is set, so
+ *    the caller need not provide, size, or free one.
+ *
+ * \param arena
+ *    The arena to allocate from, such as the one from xpccut_test_arena().
+ *
+ * \param number_of_bytes
+ *    Provides the number of bytes to be generated, as for xpccut_fuzz().
+ *
+ * \param seed
+ *    Provides the seed, as for xpccut_fuzz(), and receives the seed that
+ *    was used.  If null, XPCCUT_SEED_RANDOMIZE is used.
+ *
+ * \param flags
+ *    Provides a set of options, documented in the xpccut_fuzz_flags_t
+ *    enumeration.
+ *
+ * \param allowed_chars
+ *    Provides an optional list of characters to be used in the string.
+ *
+ * \param excluded_chars
+ *    Provides an optional list of characters to exclude from the string.
+ *
+ * \param prologue
+ *    Provides an optional string that begins the generated string.
+ *
+ * \param epilogue
+ *    Provides an optional string that ends the generated string.
+ *
+ * \return
+ *    Returns the fuzz string, or null if it could not be allocated or
+ *    generated.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+char *
+xpccut_arena_fuzz
+(
+   xpccut_arena_t * arena,
+   int number_of_bytes,
+   unsigned int * seed,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars,
+   const char * prologue,
+   const char * epilogue
+)
+{
+   char * result = nullptr;
+   if (number_of_bytes > 0)
+   {
+      int dlength = number_of_bytes + 1;
+      if ((flags & XPCCUT_FF_DUMP_CHARSET) && dlength <= 256)
+         dlength = 257;
+
+      result = xpccut_arena_alloc(arena, (size_t) dlength);
+      if (cut_not_nullptr(result))
+      {
+         unsigned int s = cut_not_nullptr(seed) ?
+            *seed : (unsigned int) XPCCUT_SEED_RANDOMIZE ;
+
+         s = xpccut_fuzz
+         (
+            result, dlength, number_of_bytes, s,
+            flags, allowed_chars, excluded_chars, prologue, epilogue
+         );
+         if (cut_not_nullptr(seed))
+            *seed = s;
+
+         if (s == XPCCUT_SEED_ERROR)
+            result = nullptr;
+      }
+   }
+   else
+      xpccut_errprint_func(_("bad sizes"));
+
+   return result;
+}
+
+/**
+ *    Makes a garbled copy of a string, in an arena, leaving the original
+ *    as it is.  The copy is corrupted by xpccut_garbled_string().
+ *
+ * \param arena
+ *    The arena to allocate from, such as the one from xpccut_test_arena().
+ *
+ * \param source
+ *    Provides the string to copy.  It is not assumed to be null-terminated;
+ *    \a length + 1 bytes are copied, as xpccut_garbled_string() reads the
+ *    byte after the end.
+ *
+ * \param length
+ *    Provides the number of bytes that can be changed.
+ *
+ * \param changes
+ *    Receives the number of bytes that were changed, or the negative error
+ *    code of xpccut_garbled_string().  It can be null.
+ *
+ * \return
+ *    Returns the garbled copy, or null if an error occurred.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_07()
+ */
+
+char *
+xpccut_arena_garbled_string
+(
+   xpccut_arena_t * arena,
+   const char * source,
+   int length,
+   int * changes
+)
+{
+   char * result = nullptr;
+   int count = -1;
+   if (cut_not_nullptr(source) && length > 0)
+   {
+      result = xpccut_arena_alloc(arena, (size_t) length + 1);
+      if (cut_not_nullptr(result))
+      {
+         (void) memcpy(result, source, (size_t) length + 1);
+         count = xpccut_garbled_string(result, length);
+         if (count < 0)
+            result = nullptr;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or empty string"));
+
+   if (cut_not_nullptr(changes))
+      *changes = count;
+
+   return result;
+}
+
+/**
+ *    Dumps a string.  The dump goes through xpccut_print(), so that it
+ *    stays in order with the rest of the output of the test.
  *
  * \param source
  *    Provides the string to be dumped.  The string can include \e any
@@ -968,7 +2011,7 @@ xpccut_dump_string (const char * source, int source_length)
       if (remainder > 0)
          rows++;
 
-      fprintf(stdout, "%s", s_header);
+      xpccut_print("%s", s_header);
       for (row = 0; row < rows; row++)
       {
          int base_index = row;
@@ -1008,9 +2051,9 @@ xpccut_dump_string (const char * source, int source_length)
                      snprintf(characters, sizeof characters, "0x00");
                }
             }
-            fprintf(stdout, s_format_element, index_string, characters);
+            xpccut_print(s_format_element, index_string, characters);
          }
-         fprintf(stdout, "\n");
+         xpccut_print("\n");
       }
    }
    else
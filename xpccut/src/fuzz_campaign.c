@@ -0,0 +1,945 @@
+/**
+ * \file          fuzz_campaign.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides fuzz campaigns, which run a number of guided fuzzers in
+ *    worker threads.  Also see the fuzz_campaign.h module.
+ *
+ *    The workers touch shared state only between rounds, to trade inputs
+ *    and to see if another worker has failed, so one mutex serves, and is
+ *    taken only a few times a second by each worker.  Where there are no
+ *    threads, the workers take turns, a round at a time, in the calling
+ *    thread, which gives the same results with less speed.
+ */
+
+#include <xpc/arena.h>                 /* xpccut_test_arena(), etc.           */
+#include <xpc/fuzz_campaign.h>         /* xpccut_campaign_t, etc.             */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func(), ticks       */
+#include <xpc/unit_test_options.h>     /* XPCCUT_JOBS_MAX                     */
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memcpy(), memset()                  */
+#endif
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define XPCCUT_USE_CAMPAIGN_THREADS 1
+#include <pthread.h>                   /* threads for the --fuzz-jobs option  */
+#else
+#define XPCCUT_USE_CAMPAIGN_THREADS 0
+#endif
+
+/**
+ *    Holds what one worker needs during xpccut_campaign_run().
+ */
+
+typedef struct
+{
+   /**
+    *    The campaign.
+    */
+
+   xpccut_campaign_t * m_Campaign;
+
+   /**
+    *    The index of the worker.
+    */
+
+   int m_Job;
+
+   /**
+    *    The function under test.
+    */
+
+   xpccut_fuzz_target_t m_Target;
+
+   /**
+    *    The pointer passed to the target.
+    */
+
+   void * m_Context;
+
+   /**
+    *    The largest number of runs of the worker, or 0 for no limit.
+    */
+
+   long long m_Max_Iterations;
+
+   /**
+    *    The limit on the duration, in ticks, or 0 for no limit.
+    */
+
+   xpccut_ticks_t m_Limit;
+
+   /**
+    *    The time at which the campaign started.
+    */
+
+   xpccut_ticks_t m_Start;
+
+} xpccut_campaign_job_t;
+
+/**
+ *    Derives the seed of one worker of a campaign from the base seed.
+ *    Worker 0 gets the base seed itself, and the others get seeds mixed
+ *    by splitmix64 from the base seed and the worker index, so that their
+ *    sequences are unrelated, but the same base seed always gives the
+ *    same seeds.
+ *
+ * \param seed
+ *    The base seed, as kept in xpc::RandomNumber.
+ *
+ * \param job
+ *    The index of the worker.
+ *
+ * \return
+ *    Returns the seed of the worker, which is never 0 or 1, the special
+ *    seeds of xpccut_srandom().
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+unsigned int
+xpccut_campaign_seed (unsigned int seed, int job)
+{
+   unsigned int result = seed;
+   if (job > 0)
+   {
+      unsigned long long z = ((unsigned long long) seed << 32) |
+         (unsigned long long) (unsigned int) job;
+
+      z += 0x9E3779B97F4A7C15ULL;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      z ^= z >> 31;
+      result = (unsigned int) (z ^ (z >> 32));
+      if (result < 2)
+         result += 2;
+   }
+   return result;
+}
+
+/**
+ *    Sets up a fuzz campaign.
+ *
+ * \param [out] campaign
+ *    The campaign to set up.
+ *
+ * \param jobs
+ *    The number of workers, from 1 to XPCCUT_JOBS_MAX, usually
+ *    unit_test_options_fuzz_job_count().
+ *
+ * \param seed
+ *    The base seed, from which the seeds of the workers are derived.
+ *
+ * \param max_size
+ *    The largest size of an input, which must be at least 1.
+ *
+ * \param flags
+ *    The character-set flags, as for xpccut_guided_init().
+ *
+ * \param allowed_chars
+ *    Provides an optional list of characters to be inserted.
+ *
+ * \param excluded_chars
+ *    Provides an optional list of characters not to be inserted.
+ *
+ * \return
+ *    Returns 'true' if the campaign was set up.  If not, it still can, and
+ *    should, be passed to xpccut_campaign_free().
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+cbool_t
+xpccut_campaign_init
+(
+   xpccut_campaign_t * campaign,
+   int jobs,
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+)
+{
+   cbool_t result = cut_not_nullptr(campaign);
+   if (result)
+   {
+      (void) memset(campaign, 0, sizeof *campaign);
+      campaign->m_Failed_Job = -1;
+      result = jobs >= 1 && jobs <= XPCCUT_JOBS_MAX;
+      if (result)
+      {
+         campaign->m_Workers = calloc
+         (
+            (size_t) jobs, sizeof(xpccut_campaign_worker_t)
+         );
+         result = cut_not_nullptr(campaign->m_Workers);
+         if (result)
+         {
+            int j;
+            campaign->m_Job_Count = jobs;
+            for (j = 0; j < jobs; j++)
+               campaign->m_Workers[j].m_Fuzzer.m_Crash_Size = -1;
+
+            for (j = 0; result && j < jobs; j++)
+            {
+               result = xpccut_guided_init
+               (
+                  &campaign->m_Workers[j].m_Fuzzer,
+                  xpccut_campaign_seed(seed, j), max_size, flags,
+                  allowed_chars, excluded_chars
+               );
+            }
+         }
+         else
+            xpccut_errprint_func(_("allocation failed"));
+      }
+      else
+         xpccut_errprint_func(_("bad fuzz job count"));
+
+#if XPCCUT_USE_CAMPAIGN_THREADS
+      if (result && jobs > 1)
+      {
+         pthread_mutex_t * lock = malloc(sizeof *lock);
+         result = cut_not_nullptr(lock);
+         if (result)
+         {
+            pthread_mutex_init(lock, nullptr);
+            campaign->m_Lock = lock;
+         }
+      }
+#endif
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Releases the workers and the shared inputs of a campaign.
+ *
+ * \param campaign
+ *    The campaign, which can be one whose xpccut_campaign_init() failed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+void
+xpccut_campaign_free (xpccut_campaign_t * campaign)
+{
+   if (cut_not_nullptr(campaign))
+   {
+      int i;
+      for (i = 0; i < campaign->m_Job_Count; i++)
+         xpccut_guided_free(&campaign->m_Workers[i].m_Fuzzer);
+
+      for (i = 0; i < campaign->m_Shared_Count; i++)
+         free(campaign->m_Shared[i]);
+
+#if XPCCUT_USE_CAMPAIGN_THREADS
+      if (cut_not_nullptr(campaign->m_Lock))
+         pthread_mutex_destroy((pthread_mutex_t *) campaign->m_Lock);
+#endif
+
+      free(campaign->m_Lock);
+      free(campaign->m_Workers);
+      free(campaign->m_Shared);
+      free(campaign->m_Shared_Sizes);
+      free(campaign->m_Shared_Owners);
+      (void) memset(campaign, 0, sizeof *campaign);
+      campaign->m_Failed_Job = -1;
+   }
+}
+
+/**
+ *    Adds a copy of an input to the corpus of every worker of a campaign.
+ *
+ * \param campaign
+ *    The campaign, set up by xpccut_campaign_init().
+ *
+ * \param data
+ *    The input.  It can be null if \a size is 0.
+ *
+ * \param size
+ *    The size of the input.
+ *
+ * \return
+ *    Returns 'true' if the input was added to every worker.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+cbool_t
+xpccut_campaign_add
+(
+   xpccut_campaign_t * campaign,
+   const char * data,
+   int size
+)
+{
+   cbool_t result = cut_not_nullptr(campaign) && campaign->m_Job_Count > 0;
+   if (result)
+   {
+      int j;
+      for (j = 0; result && j < campaign->m_Job_Count; j++)
+      {
+         result = xpccut_guided_add
+         (
+            &campaign->m_Workers[j].m_Fuzzer, data, size
+         );
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad campaign"));
+
+   return result;
+}
+
+/**
+ *    Gives every worker of a campaign the same corpus directory.  Each
+ *    worker loads the inputs saved there, and all of them append to the
+ *    same corpus files, which takes one write per input.  See
+ *    xpccut_guided_directory().
+ *
+ * \param campaign
+ *    The campaign, set up by xpccut_campaign_init().
+ *
+ * \param directory
+ *    The name of the directory.
+ *
+ * \return
+ *    Returns 'true' if every worker took the directory.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+cbool_t
+xpccut_campaign_directory
+(
+   xpccut_campaign_t * campaign,
+   const char * directory
+)
+{
+   cbool_t result = cut_not_nullptr(campaign) && campaign->m_Job_Count > 0;
+   if (result)
+   {
+      int j;
+      for (j = 0; result && j < campaign->m_Job_Count; j++)
+      {
+         result = xpccut_guided_directory
+         (
+            &campaign->m_Workers[j].m_Fuzzer, directory
+         );
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad campaign"));
+
+   return result;
+}
+
+/**
+ *    Takes the lock of a campaign, if it has one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static void
+xpccut_campaign_lock
+(
+   xpccut_campaign_t * campaign     /**< The campaign, assumed valid.         */
+)
+{
+#if XPCCUT_USE_CAMPAIGN_THREADS
+   if (cut_not_nullptr(campaign->m_Lock))
+      pthread_mutex_lock((pthread_mutex_t *) campaign->m_Lock);
+#else
+   (void) campaign;
+#endif
+}
+
+/**
+ *    Releases the lock of a campaign, if it has one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static void
+xpccut_campaign_unlock
+(
+   xpccut_campaign_t * campaign     /**< The campaign, assumed valid.         */
+)
+{
+#if XPCCUT_USE_CAMPAIGN_THREADS
+   if (cut_not_nullptr(campaign->m_Lock))
+      pthread_mutex_unlock((pthread_mutex_t *) campaign->m_Lock);
+#else
+   (void) campaign;
+#endif
+}
+
+/**
+ *    Adds a copy of an input to the shared inputs of a campaign.  It is
+ *    called with the lock held.  Once XPCCUT_GUIDED_CORPUS_MAX inputs are
+ *    shared, no more are, since no worker could take them in.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static void
+xpccut_campaign_share
+(
+   xpccut_campaign_t * campaign,    /**< The campaign, assumed valid.         */
+   int owner,                       /**< The worker sharing the input.        */
+   const char * data,               /**< The input.                           */
+   int size                         /**< The size of the input.               */
+)
+{
+   cbool_t ok = campaign->m_Shared_Count < XPCCUT_GUIDED_CORPUS_MAX;
+   if (ok && campaign->m_Shared_Count == campaign->m_Shared_Capacity)
+   {
+      int capacity = campaign->m_Shared_Capacity > 0 ?
+         campaign->m_Shared_Capacity * 2 : 64 ;
+
+      char ** shared = realloc
+      (
+         campaign->m_Shared, (size_t) capacity * sizeof(char *)
+      );
+      int * sizes;
+      int * owners;
+      if (cut_not_nullptr(shared))
+         campaign->m_Shared = shared;
+
+      sizes = realloc
+      (
+         campaign->m_Shared_Sizes, (size_t) capacity * sizeof(int)
+      );
+      if (cut_not_nullptr(sizes))
+         campaign->m_Shared_Sizes = sizes;
+
+      owners = realloc
+      (
+         campaign->m_Shared_Owners, (size_t) capacity * sizeof(int)
+      );
+      if (cut_not_nullptr(owners))
+         campaign->m_Shared_Owners = owners;
+
+      ok = cut_not_nullptr_3(shared, sizes, owners);
+      if (ok)
+         campaign->m_Shared_Capacity = capacity;
+   }
+   if (ok)
+   {
+      char * copy = malloc((size_t) size + 1);
+      if (cut_not_nullptr(copy))
+      {
+         int index = campaign->m_Shared_Count++;
+         if (size > 0)
+            (void) memcpy(copy, data, (size_t) size);
+
+         copy[size] = 0;
+         campaign->m_Shared[index] = copy;
+         campaign->m_Shared_Sizes[index] = size;
+         campaign->m_Shared_Owners[index] = owner;
+      }
+   }
+}
+
+/**
+ *    Trades inputs between one worker and the others.  The worker shares
+ *    the inputs it has kept since its last exchange, and adds the inputs
+ *    that the other workers have shared since then to its corpus, to be
+ *    run, without being shared again, at the start of its next round.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'true' if the worker should go on, which is when it has not
+ *    failed, and no other worker has failed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static cbool_t
+xpccut_campaign_exchange
+(
+   xpccut_campaign_t * campaign,    /**< The campaign, assumed valid.         */
+   int job,                         /**< The index of the worker.             */
+   cbool_t passed                   /**< The worker's round did not fail.     */
+)
+{
+   xpccut_campaign_worker_t * worker = &campaign->m_Workers[job];
+   xpccut_guided_fuzz_t * fuzzer = &worker->m_Fuzzer;
+   cbool_t result;
+   int i;
+   xpccut_campaign_lock(campaign);
+   for (i = worker->m_Published; i < fuzzer->m_Corpus_Count; i++)
+   {
+      xpccut_campaign_share
+      (
+         campaign, job, fuzzer->m_Corpus[i], fuzzer->m_Corpus_Sizes[i]
+      );
+   }
+   for (i = worker->m_Imported; i < campaign->m_Shared_Count; i++)
+   {
+      if (campaign->m_Shared_Owners[i] != job)
+      {
+         cbool_t added = xpccut_guided_add
+         (
+            fuzzer, campaign->m_Shared[i], campaign->m_Shared_Sizes[i]
+         );
+         if (! added)
+            break;                           /* try again after next round */
+      }
+   }
+   worker->m_Imported = i;
+   worker->m_Published = fuzzer->m_Corpus_Count;
+   if (! passed && campaign->m_Failed_Job < 0)
+      campaign->m_Failed_Job = job;
+
+   result = passed && campaign->m_Failed_Job < 0;
+   xpccut_campaign_unlock(campaign);
+   return result;
+}
+
+/**
+ *    Runs one round of one worker, and then its exchange.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'true' if the worker has more to do.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static cbool_t
+xpccut_campaign_step
+(
+   xpccut_campaign_job_t * job      /**< What the worker needs.               */
+)
+{
+   xpccut_campaign_t * campaign = job->m_Campaign;
+   xpccut_campaign_worker_t * worker = &campaign->m_Workers[job->m_Job];
+   long long round = XPCCUT_CAMPAIGN_ROUND;
+   double ms = 0.0;
+   cbool_t result = true;
+   if (job->m_Max_Iterations > 0)
+   {
+      long long remaining = job->m_Max_Iterations - worker->m_Runs;
+      result = remaining > 0;
+      if (remaining < round)
+         round = remaining;
+   }
+   if (result && job->m_Limit > 0)
+   {
+      xpccut_ticks_t elapsed = xpccut_get_ticks() - job->m_Start;
+      result = elapsed < job->m_Limit;
+      ms = (double) (job->m_Limit - elapsed) / (double) XPCCUT_TICKS_PER_MS;
+   }
+   if (result)
+   {
+      long long before = worker->m_Fuzzer.m_Iterations;
+      cbool_t passed = xpccut_guided_run
+      (
+         &worker->m_Fuzzer, job->m_Target, job->m_Context, round, ms
+      );
+      worker->m_Runs += worker->m_Fuzzer.m_Iterations - before;
+      result = xpccut_campaign_exchange(campaign, job->m_Job, passed);
+   }
+   if (! result)
+      worker->m_Is_Done = true;
+
+   return result;
+}
+
+#if XPCCUT_USE_CAMPAIGN_THREADS
+
+/**
+ *    The thread function of a worker, which runs rounds until the worker
+ *    is done.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Always returns a null pointer.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10() [indirect test]
+ */
+
+static void *
+xpccut_campaign_thread
+(
+   void * arg                       /**< The xpccut_campaign_job_t to run.    */
+)
+{
+   xpccut_campaign_job_t * job = (xpccut_campaign_job_t *) arg;
+   xpccut_arena_mark_t mark;
+   xpccut_arena_mark(xpccut_test_arena(), &mark);
+   while (xpccut_campaign_step(job))
+      ;
+
+   xpccut_arena_rewind(xpccut_test_arena(), &mark);
+   xpccut_test_arena_release();              /* free the scratch chunks   */
+   return nullptr;
+}
+
+#endif   /* XPCCUT_USE_CAMPAIGN_THREADS */
+
+/**
+ *    Fuzzes a target function with all of the workers of a campaign, until
+ *    one of them finds a failure, or until they have used up the budget.
+ *    Each worker gets the whole budget, so that a campaign of n workers
+ *    makes about n times the runs of one fuzzer in the same time.  Worker
+ *    0 runs in the calling thread.
+ *
+ * \param campaign
+ *    The campaign, set up by xpccut_campaign_init().
+ *
+ * \param target
+ *    The function under test, which must be thread-safe.
+ *
+ * \param context
+ *    A pointer passed unchanged to the target, by all of the workers.
+ *
+ * \param max_iterations
+ *    The largest number of calls of the target by each worker, or 0 for no
+ *    limit.
+ *
+ * \param max_ms
+ *    The longest duration of the campaign, in milliseconds, or 0 for no
+ *    limit.  At least one of the limits should be given.
+ *
+ * \return
+ *    Returns 'true' if the budget was used up without a failure.  It
+ *    returns 'false' if the target failed, in which case
+ *    xpccut_campaign_crash() gives the input, or if an argument is bad.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+cbool_t
+xpccut_campaign_run
+(
+   xpccut_campaign_t * campaign,
+   xpccut_fuzz_target_t target,
+   void * context,
+   long long max_iterations,
+   double max_ms
+)
+{
+   cbool_t result = cut_not_nullptr_2(campaign, target) &&
+      max_iterations >= 0 && max_ms >= 0.0;
+
+   if (result)
+      result = campaign->m_Job_Count > 0 && campaign->m_Failed_Job < 0;
+
+   if (result)
+   {
+      int count = campaign->m_Job_Count;
+      xpccut_campaign_job_t * jobs = malloc((size_t) count * sizeof *jobs);
+      result = cut_not_nullptr(jobs);
+      if (result)
+      {
+         xpccut_ticks_t start = xpccut_get_ticks();
+         int j;
+         for (j = 0; j < count; j++)
+         {
+            xpccut_campaign_worker_t * worker = &campaign->m_Workers[j];
+            worker->m_Published = worker->m_Fuzzer.m_Corpus_Count;
+            worker->m_Imported = campaign->m_Shared_Count;
+            worker->m_Runs = 0;
+            worker->m_Is_Done = false;
+            jobs[j].m_Campaign = campaign;
+            jobs[j].m_Job = j;
+            jobs[j].m_Target = target;
+            jobs[j].m_Context = context;
+            jobs[j].m_Max_Iterations = max_iterations;
+            jobs[j].m_Limit = (xpccut_ticks_t)
+               (max_ms * (double) XPCCUT_TICKS_PER_MS);
+
+            jobs[j].m_Start = start;
+         }
+
+#if XPCCUT_USE_CAMPAIGN_THREADS
+         if (count > 1)
+         {
+            pthread_t * threads = malloc((size_t) count * sizeof *threads);
+            cbool_t * started = calloc((size_t) count, sizeof(cbool_t));
+            if (cut_not_nullptr_2(threads, started))
+            {
+               for (j = 1; j < count; j++)
+               {
+                  started[j] = pthread_create
+                  (
+                     &threads[j], nullptr, xpccut_campaign_thread, &jobs[j]
+                  ) == 0;
+               }
+               while (xpccut_campaign_step(&jobs[0]))
+                  ;
+
+               for (j = 1; j < count; j++)
+               {
+                  if (started[j])
+                     (void) pthread_join(threads[j], nullptr);
+               }
+            }
+            free(threads);
+            free(started);
+         }
+#endif
+
+         for (;;)                            /* take turns, if not done    */
+         {
+            cbool_t more = false;
+            for (j = 0; j < count; j++)
+            {
+               if (! campaign->m_Workers[j].m_Is_Done)
+                  more = xpccut_campaign_step(&jobs[j]) || more;
+            }
+            if (! more)
+               break;
+         }
+         free(jobs);
+         result = campaign->m_Failed_Job < 0;
+      }
+      else
+         xpccut_errprint_func(_("allocation failed"));
+   }
+   else
+      xpccut_errprint_func(_("null pointer, bad budget, or bad campaign"));
+
+   return result;
+}
+
+/**
+ *    Provides the input that made the target fail.
+ *
+ * \param campaign
+ *    The campaign.
+ *
+ * \param [out] size
+ *    Receives the size of the input, if not null, or -1 if the target has
+ *    not failed.
+ *
+ * \return
+ *    Returns the input of the worker that failed first, or null if none
+ *    has.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+const char *
+xpccut_campaign_crash (const xpccut_campaign_t * campaign, int * size)
+{
+   const char * result = nullptr;
+   if (cut_not_nullptr(campaign) && campaign->m_Failed_Job >= 0)
+   {
+      result = xpccut_guided_crash
+      (
+         &campaign->m_Workers[campaign->m_Failed_Job].m_Fuzzer, size
+      );
+   }
+   else if (cut_not_nullptr(size))
+      *size = -1;
+
+   return result;
+}
+
+/**
+ *    Provides the name of the file to which the failing input was written.
+ *
+ * \param campaign
+ *    The campaign.
+ *
+ * \return
+ *    Returns the name, or null if there is no corpus directory, or no
+ *    worker has failed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+const char *
+xpccut_campaign_crash_file (const xpccut_campaign_t * campaign)
+{
+   const char * result = nullptr;
+   if (cut_not_nullptr(campaign) && campaign->m_Failed_Job >= 0)
+   {
+      result = xpccut_guided_crash_file
+      (
+         &campaign->m_Workers[campaign->m_Failed_Job].m_Fuzzer
+      );
+   }
+   return result;
+}
+
+/**
+ *    Provides the fuzzer of one worker, so that its corpus and counts can
+ *    be looked at.
+ *
+ * \param campaign
+ *    The campaign.
+ *
+ * \param job
+ *    The index of the worker.
+ *
+ * \return
+ *    Returns the fuzzer, or null if the index is not valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+const xpccut_guided_fuzz_t *
+xpccut_campaign_fuzzer (const xpccut_campaign_t * campaign, int job)
+{
+   const xpccut_guided_fuzz_t * result = nullptr;
+   if (cut_not_nullptr(campaign) && job >= 0 && job < campaign->m_Job_Count)
+      result = &campaign->m_Workers[job].m_Fuzzer;
+
+   return result;
+}
+
+/**
+ * \getter campaign->m_Job_Count
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+int
+xpccut_campaign_job_count (const xpccut_campaign_t * campaign)
+{
+   return cut_not_nullptr(campaign) ? campaign->m_Job_Count : 0 ;
+}
+
+/**
+ * \getter campaign->m_Failed_Job
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+int
+xpccut_campaign_failed_job (const xpccut_campaign_t * campaign)
+{
+   return cut_not_nullptr(campaign) ? campaign->m_Failed_Job : -1 ;
+}
+
+/**
+ * \getter campaign->m_Shared_Count
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+int
+xpccut_campaign_shared_count (const xpccut_campaign_t * campaign)
+{
+   return cut_not_nullptr(campaign) ? campaign->m_Shared_Count : 0 ;
+}
+
+/**
+ *    Counts the edges reached by any worker of a campaign.
+ *
+ * \param campaign
+ *    The campaign.
+ *
+ * \return
+ *    Returns the number of edges in the union of the coverage of the
+ *    workers.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+int
+xpccut_campaign_edge_count (const xpccut_campaign_t * campaign)
+{
+   int result = 0;
+   if (cut_not_nullptr(campaign) && campaign->m_Job_Count > 0)
+   {
+      int e;
+      for (e = 0; e < XPCCUT_COVERAGE_MAP_SIZE; e++)
+      {
+         int j;
+         for (j = 0; j < campaign->m_Job_Count; j++)
+         {
+            const xpccut_guided_fuzz_t * f = &campaign->m_Workers[j].m_Fuzzer;
+            const unsigned char * seen = f->m_Seen;
+            if (cut_not_nullptr(seen) && seen[e] != 0)
+            {
+               ++result;
+               break;
+            }
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Counts the runs of the target made by all of the workers of a
+ *    campaign.
+ *
+ * \param campaign
+ *    The campaign.
+ *
+ * \return
+ *    Returns the total number of runs.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_10()
+ */
+
+long long
+xpccut_campaign_iterations (const xpccut_campaign_t * campaign)
+{
+   long long result = 0;
+   if (cut_not_nullptr(campaign))
+   {
+      int j;
+      for (j = 0; j < campaign->m_Job_Count; j++)
+         result += campaign->m_Workers[j].m_Fuzzer.m_Iterations;
+   }
+   return result;
+}
+
+/*
+ * fuzz_campaign.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
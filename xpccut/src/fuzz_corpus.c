@@ -0,0 +1,608 @@
+/**
+ * \file          fuzz_corpus.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the corpus files of the fuzzers.  Also see the fuzz_corpus.h
+ *    module.
+ *
+ *    A corpus is loaded by mapping its file into memory, where mmap() is
+ *    available, and by reading the whole file with one fread() otherwise.
+ *    Then the inputs are found by walking the sizes, so loading and
+ *    replaying even a large corpus costs little more than the target
+ *    itself.  Appending opens the file once per input, which is fine, as
+ *    only new coverage and failures get saved.
+ */
+
+#include <xpc/fuzz_corpus.h>           /* xpccut_corpus_t, etc.               */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fopen(), fread(), fwrite(), etc.    */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memcmp(), strlen()                  */
+#endif
+
+/**
+ *    Indicates that corpus files are mapped into memory.  This requires
+ *    open(), fstat(), and mmap().
+ */
+
+#if XPC_HAVE_FCNTL_H && XPC_HAVE_SYS_MMAN_H && XPC_HAVE_SYS_STAT_H && \
+ XPC_HAVE_UNISTD_H && ! defined WIN32
+#define XPCCUT_USE_MMAP 1
+#include <errno.h>                     /* errno and ENOENT                    */
+#include <fcntl.h>                     /* open()                              */
+#include <sys/mman.h>                  /* mmap() and munmap()                 */
+#include <sys/stat.h>                  /* fstat()                             */
+#else
+#define XPCCUT_USE_MMAP 0
+#endif
+
+/**
+ *    Provides the number of bytes in the size of each input.
+ */
+
+#define XPCCUT_CORPUS_SIZE_BYTES           4
+
+/**
+ *    Reads the size of an input, which is stored least-significant byte
+ *    first, whatever the byte order of the machine.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the size.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static unsigned long
+xpccut_corpus_get_size
+(
+   const char * bytes         /**< The 4 bytes of the size.                   */
+)
+{
+   const unsigned char * b = (const unsigned char *) bytes;
+   return (unsigned long) b[0] | ((unsigned long) b[1] << 8) |
+      ((unsigned long) b[2] << 16) | ((unsigned long) b[3] << 24);
+}
+
+/**
+ *    Checks the magic string of a loaded corpus file, and counts its whole
+ *    inputs.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'true' if the file is a corpus file.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static cbool_t
+xpccut_corpus_scan
+(
+   xpccut_corpus_t * corpus   /**< The corpus, with m_Data and m_Size set.    */
+)
+{
+   cbool_t result = corpus->m_Size >= XPCCUT_CORPUS_MAGIC_SIZE;
+   if (result)
+   {
+      result = memcmp
+      (
+         corpus->m_Data, XPCCUT_CORPUS_MAGIC, XPCCUT_CORPUS_MAGIC_SIZE
+      ) == 0;
+   }
+   if (result)
+   {
+      long long offset = XPCCUT_CORPUS_MAGIC_SIZE;
+      while (offset + XPCCUT_CORPUS_SIZE_BYTES <= corpus->m_Size)
+      {
+         unsigned long size = xpccut_corpus_get_size(corpus->m_Data + offset);
+         long long end = offset + XPCCUT_CORPUS_SIZE_BYTES + (long long) size;
+         if (size > 0x7FFFFFFFUL || end > corpus->m_Size)
+            break;                           /* the input was cut short    */
+
+         offset = end;
+         ++corpus->m_Count;
+      }
+      corpus->m_End = offset;
+   }
+   return result;
+}
+
+/**
+ *    Loads a corpus file for reading.
+ *
+ * \param [out] corpus
+ *    The corpus to set up.  It must later be passed to
+ *    xpccut_corpus_close(), even if this function fails.
+ *
+ * \param filename
+ *    The name of the corpus file.
+ *
+ * \return
+ *    Returns 'true' if the file was loaded, or if it does not exist, in
+ *    which case the corpus is empty.  It returns 'false' if the file cannot
+ *    be read, or is not a corpus file.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_corpus_open
+(
+   xpccut_corpus_t * corpus,
+   const char * filename
+)
+{
+   cbool_t result = cut_not_nullptr_2(corpus, filename);
+   if (result)
+   {
+      (void) memset(corpus, 0, sizeof *corpus);
+
+#if XPCCUT_USE_MMAP
+
+      int fd = open(filename, O_RDONLY);
+      if (fd >= 0)
+      {
+         struct stat info;
+         result = fstat(fd, &info) == 0;
+         if (result)
+         {
+            corpus->m_Size = (long long) info.st_size;
+            if (corpus->m_Size > 0)
+            {
+               void * data = mmap
+               (
+                  nullptr, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0
+               );
+               result = data != MAP_FAILED;
+               if (result)
+               {
+                  corpus->m_Data = (const char *) data;
+                  corpus->m_Is_Mapped = true;
+               }
+            }
+         }
+         (void) close(fd);
+      }
+      else
+         result = errno == ENOENT;           /* a missing file is no error */
+
+#else
+
+      FILE * f = fopen(filename, "rb");
+      if (cut_not_nullptr(f))
+      {
+         long size = -1;
+         if (fseek(f, 0, SEEK_END) == 0)
+            size = ftell(f);
+
+         result = size >= 0 && fseek(f, 0, SEEK_SET) == 0;
+         if (result && size > 0)
+         {
+            char * data = malloc((size_t) size);
+            result = cut_not_nullptr(data);
+            if (result)
+            {
+               corpus->m_Data = data;
+               corpus->m_Size = (long long) size;
+               result = fread(data, 1, (size_t) size, f) == (size_t) size;
+            }
+         }
+         (void) fclose(f);
+      }
+
+#endif
+
+      if (result)
+      {
+         if (corpus->m_Size > 0)
+         {
+            result = xpccut_corpus_scan(corpus);
+            if (! result)
+               xpccut_errprint_ex(_("not a corpus file"), filename);
+         }
+      }
+      else
+         xpccut_errprint_ex(_("cannot read corpus file"), filename);
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Releases a corpus loaded by xpccut_corpus_open().  The inputs it gave
+ *    out can no longer be used.
+ *
+ * \param corpus
+ *    The corpus.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+void
+xpccut_corpus_close (xpccut_corpus_t * corpus)
+{
+   if (cut_not_nullptr(corpus))
+   {
+      if (cut_not_nullptr(corpus->m_Data))
+      {
+#if XPCCUT_USE_MMAP
+         if (corpus->m_Is_Mapped)
+            (void) munmap((void *) corpus->m_Data, (size_t) corpus->m_Size);
+         else
+#endif
+            free((void *) corpus->m_Data);
+      }
+      (void) memset(corpus, 0, sizeof *corpus);
+   }
+}
+
+/**
+ * \getter corpus->m_Count
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+int
+xpccut_corpus_count (const xpccut_corpus_t * corpus)
+{
+   return cut_not_nullptr(corpus) ? corpus->m_Count : 0 ;
+}
+
+/**
+ *    Provides the next input of a corpus.
+ *
+\verbatim
+      long long cursor = 0;
+      int size;
+      const char * input;
+      while ((input = xpccut_corpus_next(&corpus, &cursor, &size)) != NULL)
+         use(input, size);
+\endverbatim
+ *
+ * \param corpus
+ *    The corpus.
+ *
+ * \param [in,out] cursor
+ *    The position in the corpus, which must start as 0, and is advanced
+ *    past the input given out.
+ *
+ * \param [out] size
+ *    Receives the size of the input, or -1 if there are no more.
+ *
+ * \return
+ *    Returns the input, which lies in the corpus, and is not
+ *    null-terminated, or null if there are no more inputs.  An input of
+ *    size 0 is not null.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+const char *
+xpccut_corpus_next
+(
+   const xpccut_corpus_t * corpus,
+   long long * cursor,
+   int * size
+)
+{
+   const char * result = nullptr;
+   int inputsize = -1;
+   if (cut_not_nullptr_2(corpus, cursor))
+   {
+      long long offset = *cursor;
+      if (offset < XPCCUT_CORPUS_MAGIC_SIZE)
+         offset = XPCCUT_CORPUS_MAGIC_SIZE;
+
+      if (offset + XPCCUT_CORPUS_SIZE_BYTES <= corpus->m_End)
+      {
+         inputsize = (int) xpccut_corpus_get_size(corpus->m_Data + offset);
+         offset += XPCCUT_CORPUS_SIZE_BYTES;
+         result = corpus->m_Data + offset;
+         *cursor = offset + inputsize;
+      }
+   }
+   if (cut_not_nullptr(size))
+      *size = inputsize;
+
+   return result;
+}
+
+/**
+ *    Runs a target function on each input of a corpus, in the order the
+ *    inputs were saved, until one fails.  This is the regression test of
+ *    the inputs that a fuzzer has found.
+ *
+ * \param corpus
+ *    The corpus.
+ *
+ * \param target
+ *    The function under test.
+ *
+ * \param context
+ *    A pointer passed unchanged to the target.
+ *
+ * \param [out] failed_index
+ *    Receives the index of the input that failed, if not null, or -1 if
+ *    none did.
+ *
+ * \return
+ *    Returns 'true' if every input passed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_corpus_replay
+(
+   const xpccut_corpus_t * corpus,
+   xpccut_fuzz_target_t target,
+   void * context,
+   int * failed_index
+)
+{
+   cbool_t result = cut_not_nullptr_2(corpus, target);
+   int failed = -1;
+   if (result)
+   {
+      long long cursor = 0;
+      int size;
+      int index = 0;
+      const char * input;
+      while ((input = xpccut_corpus_next(corpus, &cursor, &size)) != nullptr)
+      {
+         if (! target(context, input, size))
+         {
+            failed = index;
+            result = false;
+            break;
+         }
+         ++index;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   if (cut_not_nullptr(failed_index))
+      *failed_index = failed;
+
+   return result;
+}
+
+/**
+ *    Writes the magic string to a corpus file, if the file is new or
+ *    empty, and then one input, if one is given.
+ *
+ *    The whole record is written with one unbuffered write to a file
+ *    opened for appending, so that fuzzers in other threads or processes
+ *    can append to the same file at the same time.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'true' if everything was written.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static cbool_t
+xpccut_corpus_write
+(
+   const char * filename,     /**< The name of the corpus file.               */
+   const char * data,         /**< The input, or null if there is none.       */
+   int size                   /**< The size of the input, or -1 if none.      */
+)
+{
+   size_t length = XPCCUT_CORPUS_MAGIC_SIZE;
+   char * record;
+   cbool_t result;
+   if (size >= 0)
+      length += XPCCUT_CORPUS_SIZE_BYTES + (size_t) size;
+
+   record = malloc(length);
+   result = cut_not_nullptr(record);
+   if (result)
+   {
+      FILE * f = fopen(filename, "ab");
+      result = cut_not_nullptr(f);
+      if (result)
+      {
+         size_t start = XPCCUT_CORPUS_MAGIC_SIZE;
+         long position = -1;
+         (void) setvbuf(f, nullptr, _IONBF, 0);
+         if (fseek(f, 0, SEEK_END) == 0)
+            position = ftell(f);
+
+         result = position >= 0;
+         if (position == 0)
+            start = 0;
+
+         (void) memcpy(record, XPCCUT_CORPUS_MAGIC, XPCCUT_CORPUS_MAGIC_SIZE);
+         if (size >= 0)
+         {
+            unsigned long usize = (unsigned long) size;
+            unsigned char * header = (unsigned char *) record +
+               XPCCUT_CORPUS_MAGIC_SIZE;
+
+            header[0] = (unsigned char) (usize & 0xFF);
+            header[1] = (unsigned char) ((usize >> 8) & 0xFF);
+            header[2] = (unsigned char) ((usize >> 16) & 0xFF);
+            header[3] = (unsigned char) ((usize >> 24) & 0xFF);
+            if (size > 0)
+            {
+               (void) memcpy
+               (
+                  header + XPCCUT_CORPUS_SIZE_BYTES, data, (size_t) size
+               );
+            }
+         }
+         if (result && start < length)
+         {
+            length -= start;
+            result = fwrite(record + start, 1, length, f) == length;
+         }
+         if (fclose(f) != 0)
+            result = false;
+      }
+      free(record);
+   }
+   if (! result)
+      xpccut_errprint_ex(_("cannot write corpus file"), filename);
+
+   return result;
+}
+
+/**
+ *    Creates an empty corpus file, holding just the magic string, if the
+ *    file does not exist or is empty.  Doing this before any input is
+ *    appended means that writers working at the same time never race to
+ *    write the magic string.
+ *
+ * \param filename
+ *    The name of the corpus file.
+ *
+ * \return
+ *    Returns 'true' if the file exists, or was created.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_corpus_create (const char * filename)
+{
+   cbool_t result = cut_not_nullptr(filename);
+   if (result)
+      result = xpccut_corpus_write(filename, nullptr, -1);
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Appends an input to a corpus file.  The file is created, with its
+ *    magic string, if it does not exist.  The input is written in one
+ *    piece, so several writers can share a file.
+ *
+ * \param filename
+ *    The name of the corpus file.
+ *
+ * \param data
+ *    The input.  It can be null if \a size is 0.
+ *
+ * \param size
+ *    The size of the input.
+ *
+ * \return
+ *    Returns 'true' if the input was written.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_corpus_append
+(
+   const char * filename,
+   const char * data,
+   int size
+)
+{
+   cbool_t result = cut_not_nullptr(filename) && size >= 0;
+   if (result && size > 0)
+      result = cut_not_nullptr(data);
+
+   if (result)
+      result = xpccut_corpus_write(filename, data, size);
+   else
+      xpccut_errprint_func(_("null pointer or bad size"));
+
+   return result;
+}
+
+/**
+ *    Builds the name of a file in a corpus directory.
+ *
+ * \param [out] destination
+ *    The buffer for the name.
+ *
+ * \param dlength
+ *    The size of the buffer.
+ *
+ * \param directory
+ *    The directory.  If null or empty, the name is just \a filename.
+ *
+ * \param filename
+ *    The name of the file in the directory.
+ *
+ * \return
+ *    Returns 'true' if the name fit in the buffer.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_corpus_path
+(
+   char * destination,
+   int dlength,
+   const char * directory,
+   const char * filename
+)
+{
+   cbool_t result = cut_not_nullptr_2(destination, filename) && dlength > 0;
+   if (result)
+   {
+      int count;
+      if (cut_not_nullptr(directory) && directory[0] != 0)
+      {
+         size_t last = strlen(directory) - 1;
+         const char * slash = directory[last] == '/' ? "" : "/" ;
+         count = snprintf
+         (
+            destination, (size_t) dlength, "%s%s%s", directory, slash, filename
+         );
+      }
+      else
+         count = snprintf(destination, (size_t) dlength, "%s", filename);
+
+      result = count >= 0 && count < dlength;
+      if (! result)
+         xpccut_errprint_func(_("corpus file name too long"));
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad length"));
+
+   return result;
+}
+
+/*
+ * fuzz_corpus.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -0,0 +1,1033 @@
+/**
+ * \file          guided_fuzz.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides a coverage-guided fuzzer, and the coverage hooks that feed
+ *    it.  Also see the guided_fuzz.h module.
+ *
+ *    Each run of the target starts with a cleared coverage map, which the
+ *    hooks fill in.  An input whose map has an edge that no earlier run has
+ *    reached is added to the corpus.  The next inputs are mutations of
+ *    inputs picked from the corpus, using xpccut_rng_garbled_string(), the
+ *    character set of xpccut_fuzz_fill(), and some splicing and cutting of
+ *    bytes.  The generator of the fuzzer drives every choice, so a seed and
+ *    a deterministic target always give the same sequence of inputs.
+ */
+
+#include <xpc/fuzz_corpus.h>           /* xpccut_corpus_append(), etc.        */
+#include <xpc/guided_fuzz.h>           /* xpccut_guided_fuzz_t, etc.          */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func(), ticks       */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fopen(), fwrite(), snprintf()       */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memcpy(), memmove(), memset()       */
+#endif
+
+#if XPC_HAVE_SYS_STAT_H && ! defined WIN32
+#include <sys/stat.h>                  /* mkdir()                             */
+#endif
+
+/**
+ *    Provides the largest number of bytes inserted, overwritten, deleted,
+ *    or duplicated by one mutation.
+ */
+
+#define XPCCUT_GUIDED_SPAN                 8
+
+/**
+ *    The coverage map that the hooks fill in, which is the map of the
+ *    fuzzer that is running in the calling thread, or null if there is
+ *    none.  The hooks thus cost only a test and branch outside of
+ *    xpccut_guided_run().
+ */
+
+static XPCCUT_THREAD_LOCAL unsigned char * gs_coverage_map;
+
+/**
+ *    The number of edges given out by __sanitizer_cov_trace_pc_guard_init().
+ */
+
+static unsigned int gs_coverage_edges;
+
+/**
+ *    Records that the code under test has reached a point of interest.  It
+ *    is the manual equivalent of the trace-pc-guard hook, for code that is
+ *    not compiled with -fsanitize-coverage.
+ *
+ * \param edge
+ *    A number for the point.  Each point to be told apart needs its own
+ *    number, modulo XPCCUT_COVERAGE_MAP_SIZE.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+void
+xpccut_coverage_hit (unsigned int edge)
+{
+   unsigned char * map = gs_coverage_map;
+   if (cut_not_nullptr(map))
+      map[edge % XPCCUT_COVERAGE_MAP_SIZE] = 1;
+}
+
+/**
+ *    Numbers the edges of a module compiled with
+ *    -fsanitize-coverage=trace-pc-guard.  The compiler arranges for this
+ *    function to be called once for each such module, as it is loaded.
+ *    Each guard gets a nonzero number, which the other hook reads.
+ *
+ * \param start
+ *    The first guard of the module.
+ *
+ * \param stop
+ *    One past the last guard of the module.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+void
+__sanitizer_cov_trace_pc_guard_init
+(
+   unsigned int * start,
+   unsigned int * stop
+)
+{
+   if (cut_not_nullptr(start) && start != stop && *start == 0)
+   {
+      unsigned int * guard;
+      for (guard = start; guard < stop; guard++)
+      {
+         if (++gs_coverage_edges == 0)          /* keep 0 for "no edge"    */
+            ++gs_coverage_edges;
+
+         *guard = gs_coverage_edges;
+      }
+   }
+}
+
+/**
+ *    Records an edge of a module compiled with
+ *    -fsanitize-coverage=trace-pc-guard.  The compiler inserts a call to
+ *    this function at each edge.
+ *
+ * \param guard
+ *    The guard of the edge, numbered by
+ *    __sanitizer_cov_trace_pc_guard_init().
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+void
+__sanitizer_cov_trace_pc_guard (unsigned int * guard)
+{
+   unsigned char * map = gs_coverage_map;
+   if (cut_not_nullptr(map) && *guard != 0)
+      map[*guard % XPCCUT_COVERAGE_MAP_SIZE] = 1;
+}
+
+/**
+ *    Sets up a guided fuzzer, with an empty corpus.
+ *
+ * \param fuzzer
+ *    The fuzzer to set up.
+ *
+ * \param seed
+ *    The seed of the generator of the fuzzer, which uses the xoshiro256**
+ *    engine.
+ *
+ * \param max_size
+ *    The largest size of an input, which must be at least 1.
+ *
+ * \param flags
+ *    The character-set flags for the bytes that the mutations insert, as
+ *    for xpccut_fuzz_charset_init().
+ *
+ * \param allowed_chars
+ *    Provides an optional list of characters to be inserted.
+ *
+ * \param excluded_chars
+ *    Provides an optional list of characters not to be inserted.
+ *
+ * \return
+ *    Returns 'true' if the fuzzer was set up.  If not, it still can, and
+ *    should, be passed to xpccut_guided_free().
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+cbool_t
+xpccut_guided_init
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   unsigned int seed,
+   int max_size,
+   xpccut_fuzz_flags_t flags,
+   const char * allowed_chars,
+   const char * excluded_chars
+)
+{
+   cbool_t result = cut_not_nullptr(fuzzer);
+   if (result)
+   {
+      (void) memset(fuzzer, 0, sizeof *fuzzer);
+      fuzzer->m_Crash_Size = -1;
+      result = max_size > 0;
+      if (result)
+      {
+         fuzzer->m_Max_Size = max_size;
+         (void) xpccut_rng_init(&fuzzer->m_Rng, XPCCUT_RNG_XOSHIRO, seed);
+         result = xpccut_fuzz_charset_init
+         (
+            &fuzzer->m_Charset, flags, allowed_chars, excluded_chars
+         );
+      }
+      else
+         xpccut_errprint_func(_("fuzz input size must be positive"));
+
+      if (result)
+      {
+         fuzzer->m_Map = malloc(XPCCUT_COVERAGE_MAP_SIZE);
+         fuzzer->m_Seen = malloc(XPCCUT_COVERAGE_MAP_SIZE);
+         fuzzer->m_Input = malloc((size_t) max_size + 1);
+         fuzzer->m_Crash = malloc((size_t) max_size + 1);
+         result = cut_not_nullptr_4
+         (
+            fuzzer->m_Map, fuzzer->m_Seen, fuzzer->m_Input, fuzzer->m_Crash
+         );
+         if (result)
+         {
+            (void) memset(fuzzer->m_Map, 0, XPCCUT_COVERAGE_MAP_SIZE);
+            (void) memset(fuzzer->m_Seen, 0, XPCCUT_COVERAGE_MAP_SIZE);
+         }
+         else
+            xpccut_errprint_func(_("allocation failed"));
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Releases the memory of a guided fuzzer, including its corpus.
+ *
+ * \param fuzzer
+ *    The fuzzer, which can be one whose xpccut_guided_init() failed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+void
+xpccut_guided_free (xpccut_guided_fuzz_t * fuzzer)
+{
+   if (cut_not_nullptr(fuzzer))
+   {
+      int i;
+      for (i = 0; i < fuzzer->m_Corpus_Count; i++)
+         free(fuzzer->m_Corpus[i]);
+
+      free(fuzzer->m_Corpus);
+      free(fuzzer->m_Corpus_Sizes);
+      free(fuzzer->m_Map);
+      free(fuzzer->m_Seen);
+      free(fuzzer->m_Input);
+      free(fuzzer->m_Crash);
+      free(fuzzer->m_Directory);
+      free(fuzzer->m_Crash_File);
+      (void) memset(fuzzer, 0, sizeof *fuzzer);
+      fuzzer->m_Crash_Size = -1;
+   }
+}
+
+/**
+ *    Adds a copy of an input to the corpus of a guided fuzzer.  This is
+ *    the way to give the fuzzer some valid inputs to start from, which
+ *    helps it a great deal.
+ *
+ * \param fuzzer
+ *    The fuzzer, set up by xpccut_guided_init().
+ *
+ * \param data
+ *    The input.  It can be null if \a size is 0.
+ *
+ * \param size
+ *    The size of the input.  An input longer than the largest size of the
+ *    fuzzer is cut to that size.
+ *
+ * \return
+ *    Returns 'true' if the input was added.  It returns 'false' if an
+ *    argument is bad, the corpus is full, or memory ran out.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+cbool_t
+xpccut_guided_add
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   const char * data,
+   int size
+)
+{
+   cbool_t result = cut_not_nullptr(fuzzer) && size >= 0;
+   if (result)
+      result = cut_not_nullptr(fuzzer->m_Input);
+
+   if (result && size > 0)
+      result = cut_not_nullptr(data);
+
+   if (result)
+   {
+      if (size > fuzzer->m_Max_Size)
+         size = fuzzer->m_Max_Size;
+
+      result = fuzzer->m_Corpus_Count < XPCCUT_GUIDED_CORPUS_MAX;
+      if (result && fuzzer->m_Corpus_Count == fuzzer->m_Corpus_Capacity)
+      {
+         int capacity = fuzzer->m_Corpus_Capacity > 0 ?
+            fuzzer->m_Corpus_Capacity * 2 : 64 ;
+
+         char ** corpus = realloc
+         (
+            fuzzer->m_Corpus, (size_t) capacity * sizeof(char *)
+         );
+         if (cut_not_nullptr(corpus))
+         {
+            int * sizes;
+            fuzzer->m_Corpus = corpus;
+            sizes = realloc
+            (
+               fuzzer->m_Corpus_Sizes, (size_t) capacity * sizeof(int)
+            );
+            if (cut_not_nullptr(sizes))
+            {
+               fuzzer->m_Corpus_Sizes = sizes;
+               fuzzer->m_Corpus_Capacity = capacity;
+            }
+            else
+               result = false;
+         }
+         else
+            result = false;
+      }
+      if (result)
+      {
+         char * copy = malloc((size_t) size + 1);
+         result = cut_not_nullptr(copy);
+         if (result)
+         {
+            if (size > 0)
+               (void) memcpy(copy, data, (size_t) size);
+
+            copy[size] = 0;
+            fuzzer->m_Corpus[fuzzer->m_Corpus_Count] = copy;
+            fuzzer->m_Corpus_Sizes[fuzzer->m_Corpus_Count] = size;
+            ++fuzzer->m_Corpus_Count;
+         }
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer or bad size"));
+
+   return result;
+}
+
+/**
+ *    Adds the inputs of one corpus file to the corpus of a guided fuzzer.
+ *    Inputs past the size of the corpus are left out.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'true' if the file was missing, or was read.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static cbool_t
+xpccut_guided_load
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, assumed valid.           */
+   const char * filename            /**< The name of the corpus file.         */
+)
+{
+   xpccut_corpus_t corpus;
+   cbool_t result = xpccut_corpus_open(&corpus, filename);
+   if (result)
+   {
+      long long cursor = 0;
+      int size;
+      const char * input;
+      while ((input = xpccut_corpus_next(&corpus, &cursor, &size)) != nullptr)
+      {
+         if (fuzzer->m_Corpus_Count >= XPCCUT_GUIDED_CORPUS_MAX)
+            break;
+
+         if (! xpccut_guided_add(fuzzer, input, size))
+         {
+            result = false;
+            break;
+         }
+      }
+   }
+   xpccut_corpus_close(&corpus);
+   return result;
+}
+
+/**
+ *    Gives a guided fuzzer a corpus directory.  The directory is created if
+ *    it does not exist.  The failing inputs saved there by earlier runs,
+ *    in XPCCUT_CRASHES_FILE, are added to the corpus first, and then the
+ *    inputs of XPCCUT_CORPUS_FILE, so the next run of the fuzzer starts by
+ *    trying the inputs that failed before.
+ *
+ *    Both files are created, empty, if they do not exist, so that several
+ *    fuzzers can share the directory.  From then on, each input that
+ *    reaches a new edge is appended to XPCCUT_CORPUS_FILE.  A failing input
+ *    is appended to XPCCUT_CRASHES_FILE, and is also written to a file of
+ *    its own, named "crash-" plus a hash of its bytes, which
+ *    xpccut_guided_crash_file() names.
+ *
+ * \param fuzzer
+ *    The fuzzer, set up by xpccut_guided_init().
+ *
+ * \param directory
+ *    The name of the directory.
+ *
+ * \return
+ *    Returns 'true' if the directory was set, and its corpus files were
+ *    read.  Missing files are no error.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+cbool_t
+xpccut_guided_directory
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   const char * directory
+)
+{
+   cbool_t result = cut_not_nullptr_2(fuzzer, directory);
+   if (result)
+      result = cut_not_nullptr(fuzzer->m_Input) && directory[0] != 0;
+
+   if (result)
+   {
+      size_t length = strlen(directory) + 1;
+      char * copy = malloc(length);
+      char * crashfile = malloc(XPCCUT_CORPUS_PATH_MAX);
+      result = cut_not_nullptr_2(copy, crashfile);
+      if (result)
+      {
+         char filename[XPCCUT_CORPUS_PATH_MAX];
+         (void) memcpy(copy, directory, length);
+         crashfile[0] = 0;
+         free(fuzzer->m_Directory);
+         free(fuzzer->m_Crash_File);
+         fuzzer->m_Directory = copy;
+         fuzzer->m_Crash_File = crashfile;
+
+#if XPC_HAVE_SYS_STAT_H && ! defined WIN32
+         (void) mkdir(directory, 0777);      /* it may well exist already  */
+#endif
+
+         result = xpccut_corpus_path
+         (
+            filename, sizeof filename, directory, XPCCUT_CRASHES_FILE
+         );
+         if (result)
+            result = xpccut_guided_load(fuzzer, filename);
+
+         if (result)
+            result = xpccut_corpus_create(filename);
+
+         if (result)
+         {
+            result = xpccut_corpus_path
+            (
+               filename, sizeof filename, directory, XPCCUT_CORPUS_FILE
+            );
+         }
+         if (result)
+            result = xpccut_guided_load(fuzzer, filename);
+
+         if (result)
+            result = xpccut_corpus_create(filename);
+      }
+      else
+      {
+         free(copy);
+         free(crashfile);
+         xpccut_errprint_func(_("allocation failed"));
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer, empty name, or bad fuzzer"));
+
+   return result;
+}
+
+/**
+ *    Picks a random number from 0 to \a count - 1, or 0 if \a count is
+ *    not positive.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08() [indirect test]
+ */
+
+static int
+xpccut_guided_pick
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, assumed valid.           */
+   int count                        /**< The number of choices.               */
+)
+{
+   return count > 0 ? (int) xpccut_rng_range(&fuzzer->m_Rng, count) : 0 ;
+}
+
+/**
+ *    Applies one random mutation to the input in m_Input.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the new size of the input.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08() [indirect test]
+ */
+
+static int
+xpccut_guided_mutate
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, assumed valid.           */
+   int size                         /**< The current size of the input.       */
+)
+{
+   char * input = fuzzer->m_Input;
+   int room = fuzzer->m_Max_Size - size;
+   int kind = xpccut_guided_pick(fuzzer, 6);
+   int pos = xpccut_guided_pick(fuzzer, size + 1);
+   int span = 1 + xpccut_guided_pick(fuzzer, XPCCUT_GUIDED_SPAN);
+   if (size == 0)
+      kind = 1;                              /* only insertion is possible */
+
+   if (kind == 1 || kind == 4)
+   {
+      if (span > room)
+         span = room;
+   }
+   else if (pos == size)
+      pos = size - 1;
+
+   if (kind != 1 && kind != 4 && span > size - pos)
+      span = size - pos;
+
+   switch (kind)
+   {
+   case 0:                                   /* garble a few bytes         */
+
+      (void) xpccut_rng_garbled_string(&fuzzer->m_Rng, &input[pos], span);
+      break;
+
+   case 1:                                   /* insert from the char-set   */
+
+      if (span > 0)
+      {
+         (void) memmove(&input[pos + span], &input[pos], size - pos);
+         (void) xpccut_fuzz_fill
+         (
+            &fuzzer->m_Rng, &fuzzer->m_Charset, &input[pos], span
+         );
+         size += span;
+      }
+      break;
+
+   case 2:                                   /* overwrite from the char-set */
+
+      (void) xpccut_fuzz_fill
+      (
+         &fuzzer->m_Rng, &fuzzer->m_Charset, &input[pos], span
+      );
+      break;
+
+   case 3:                                   /* delete some bytes          */
+
+      (void) memmove(&input[pos], &input[pos + span], size - pos - span);
+      size -= span;
+      break;
+
+   case 4:                                   /* duplicate some bytes       */
+
+      if (span > 0 && size > 0)
+      {
+         int from = xpccut_guided_pick(fuzzer, size);
+         if (span > size - from)
+            span = size - from;
+
+         (void) memmove(&input[pos + span], &input[pos], size - pos);
+         if (from >= pos)
+            from += span;                    /* it moved along             */
+
+         (void) memmove(&input[pos], &input[from], span);
+         size += span;
+      }
+      break;
+
+   default:                                  /* splice in another input    */
+      {
+         int other = xpccut_guided_pick(fuzzer, fuzzer->m_Corpus_Count);
+         const char * source = fuzzer->m_Corpus[other];
+         int osize = fuzzer->m_Corpus_Sizes[other];
+         int from = xpccut_guided_pick(fuzzer, osize + 1);
+         int count = osize - from;
+         if (count > fuzzer->m_Max_Size - pos)
+            count = fuzzer->m_Max_Size - pos;
+
+         (void) memcpy(&input[pos], &source[from], count);
+         size = pos + count;
+      }
+      break;
+   }
+   return size;
+}
+
+/**
+ *    Appends an input to one of the corpus files of the directory of a
+ *    guided fuzzer.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static void
+xpccut_guided_save
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, with a directory.        */
+   const char * filename,           /**< The name of the file in it.          */
+   const char * input,              /**< The input to save.                   */
+   int size                         /**< The size of the input.               */
+)
+{
+   char path[XPCCUT_CORPUS_PATH_MAX];
+   if (xpccut_corpus_path(path, sizeof path, fuzzer->m_Directory, filename))
+      (void) xpccut_corpus_append(path, input, size);
+}
+
+/**
+ *    Writes the failing input, as it is, to a file of its own in the
+ *    directory of a guided fuzzer, and to XPCCUT_CRASHES_FILE if it is a
+ *    new input.  The file is named "crash-" plus the 64-bit FNV-1a hash of
+ *    the input, so the same failure always gives the same file.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09() [indirect test]
+ */
+
+static void
+xpccut_guided_save_crash
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, with a directory.        */
+   const char * input,              /**< The failing input.                   */
+   int size,                        /**< The size of the input.               */
+   cbool_t fresh                    /**< The input is not from a corpus file. */
+)
+{
+   unsigned long long hash = 14695981039346656037ULL;
+   char name[32];
+   int i;
+   for (i = 0; i < size; i++)
+   {
+      hash ^= (unsigned char) input[i];
+      hash *= 1099511628211ULL;
+   }
+   (void) snprintf(name, sizeof name, "crash-%016llx", hash);
+   if (fresh)
+      xpccut_guided_save(fuzzer, XPCCUT_CRASHES_FILE, input, size);
+
+   if
+   (
+      xpccut_corpus_path
+      (
+         fuzzer->m_Crash_File, XPCCUT_CORPUS_PATH_MAX,
+         fuzzer->m_Directory, name
+      )
+   )
+   {
+      FILE * f = fopen(fuzzer->m_Crash_File, "wb");
+      cbool_t ok = cut_not_nullptr(f);
+      if (ok)
+      {
+         if (size > 0)
+            ok = fwrite(input, 1, (size_t) size, f) == (size_t) size;
+
+         if (fclose(f) != 0)
+            ok = false;
+      }
+      if (! ok)
+      {
+         xpccut_errprint_ex(_("cannot write crash file"), fuzzer->m_Crash_File);
+         fuzzer->m_Crash_File[0] = 0;
+      }
+   }
+   else
+      fuzzer->m_Crash_File[0] = 0;
+}
+
+/**
+ *    Runs the target on an input, and folds its coverage into that of the
+ *    fuzzer.  The input is added to the corpus if it reached a new edge,
+ *    unless it is already in the corpus.
+ *
+ *    The map is scanned, and cleared for the next run, a word at a time,
+ *    since most of its words are zero.  This keeps the cost of a run close
+ *    to that of the target, even for a small target.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns 'false' if the target failed, in which case the input is
+ *    copied to m_Crash, and saved in the corpus directory, if any.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08() [indirect test]
+ */
+
+static cbool_t
+xpccut_guided_execute
+(
+   xpccut_guided_fuzz_t * fuzzer,   /**< The fuzzer, assumed valid.           */
+   xpccut_fuzz_target_t target,     /**< The function under test.             */
+   void * context,                  /**< The pointer passed to the target.    */
+   const char * input,              /**< The input to run.                    */
+   int size,                        /**< The size of the input.               */
+   cbool_t keep                     /**< Add the input if it reaches new code.*/
+)
+{
+   static const unsigned long long s_zero = 0;
+   cbool_t result = target(context, input, size);
+   cbool_t fresh = false;
+   unsigned char * map = fuzzer->m_Map;
+   int w;
+   ++fuzzer->m_Iterations;
+   for (w = 0; w < XPCCUT_COVERAGE_MAP_SIZE; w += (int) sizeof s_zero)
+   {
+      if (memcmp(&map[w], &s_zero, sizeof s_zero) != 0)
+      {
+         int i;
+         for (i = w; i < w + (int) sizeof s_zero; i++)
+         {
+            if (map[i] != 0 && fuzzer->m_Seen[i] == 0)
+            {
+               fuzzer->m_Seen[i] = 1;
+               ++fuzzer->m_Edge_Count;
+               fresh = true;
+            }
+         }
+         (void) memcpy(&map[w], &s_zero, sizeof s_zero);
+      }
+   }
+   if (result)
+   {
+      if (fresh && keep)
+      {
+         if (xpccut_guided_add(fuzzer, input, size))
+         {
+            if (cut_not_nullptr(fuzzer->m_Directory))
+               xpccut_guided_save(fuzzer, XPCCUT_CORPUS_FILE, input, size);
+         }
+      }
+   }
+   else
+   {
+      (void) memcpy(fuzzer->m_Crash, input, (size_t) size);
+      fuzzer->m_Crash[size] = 0;
+      fuzzer->m_Crash_Size = size;
+      if (cut_not_nullptr(fuzzer->m_Directory))
+         xpccut_guided_save_crash(fuzzer, input, size, keep);
+   }
+   return result;
+}
+
+/**
+ *    Fuzzes a target function until it fails, or until the budget is used
+ *    up.  The inputs of the corpus that have not yet been run are run
+ *    first, as they are, to learn their coverage.  If the corpus is empty,
+ *    an empty input is added to it.  A fuzzer can be run again, to go on
+ *    from where the last run stopped.
+ *
+ * \param fuzzer
+ *    The fuzzer, set up by xpccut_guided_init().
+ *
+ * \param target
+ *    The function under test.  The coverage of all of the code it calls,
+ *    in the calling thread, is recorded.
+ *
+ * \param context
+ *    A pointer passed unchanged to the target.
+ *
+ * \param max_iterations
+ *    The largest number of calls of the target in this run, or 0 for no
+ *    limit.
+ *
+ * \param max_ms
+ *    The longest duration of this run, in milliseconds, or 0 for no limit.
+ *    At least one of the limits should be given.
+ *
+ * \return
+ *    Returns 'true' if the budget was used up without a failure.  It
+ *    returns 'false' if the target failed, in which case
+ *    xpccut_guided_crash() gives the input, or if an argument is bad.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+cbool_t
+xpccut_guided_run
+(
+   xpccut_guided_fuzz_t * fuzzer,
+   xpccut_fuzz_target_t target,
+   void * context,
+   long long max_iterations,
+   double max_ms
+)
+{
+   cbool_t result = cut_not_nullptr_2(fuzzer, target) &&
+      max_iterations >= 0 && max_ms >= 0.0;
+
+   if (result)
+      result = cut_not_nullptr(fuzzer->m_Input);
+
+   if (! result)
+      xpccut_errprint_func(_("null pointer, bad budget, or bad fuzzer"));
+   else if (fuzzer->m_Corpus_Count == 0)
+      result = xpccut_guided_add(fuzzer, "", 0);
+
+   if (result)
+   {
+      unsigned char * previous = gs_coverage_map;
+      xpccut_ticks_t start = xpccut_get_ticks();
+      xpccut_ticks_t limit = (xpccut_ticks_t)
+         (max_ms * (double) XPCCUT_TICKS_PER_MS);
+
+      long long count = 0;
+      gs_coverage_map = fuzzer->m_Map;
+      while (result && fuzzer->m_Corpus_Run < fuzzer->m_Corpus_Count)
+      {
+         int index = fuzzer->m_Corpus_Run++;
+         result = xpccut_guided_execute
+         (
+            fuzzer, target, context, fuzzer->m_Corpus[index],
+            fuzzer->m_Corpus_Sizes[index], false
+         );
+         ++count;
+      }
+      while (result)
+      {
+         int parent;
+         int size;
+         int mutations;
+         if (max_iterations > 0 && count >= max_iterations)
+            break;
+
+         if (limit > 0 && xpccut_get_ticks() - start >= limit)
+            break;
+
+         parent = xpccut_guided_pick(fuzzer, fuzzer->m_Corpus_Count);
+         size = fuzzer->m_Corpus_Sizes[parent];
+         (void) memcpy(fuzzer->m_Input, fuzzer->m_Corpus[parent], size);
+         fuzzer->m_Input[size] = 0;
+         mutations = 1 + xpccut_guided_pick(fuzzer, XPCCUT_GUIDED_MUTATIONS);
+         while (mutations-- > 0)
+            size = xpccut_guided_mutate(fuzzer, size);
+
+         result = xpccut_guided_execute
+         (
+            fuzzer, target, context, fuzzer->m_Input, size, true
+         );
+         fuzzer->m_Corpus_Run = fuzzer->m_Corpus_Count;
+         ++count;
+      }
+      gs_coverage_map = previous;
+   }
+   return result;
+}
+
+/**
+ *    Provides the input that made the target fail.
+ *
+ * \param fuzzer
+ *    The fuzzer.
+ *
+ * \param [out] size
+ *    Receives the size of the input, if not null.  It is -1 if the target
+ *    has not failed.
+ *
+ * \return
+ *    Returns the input, which is also null-terminated, or null if the
+ *    target has not failed.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+const char *
+xpccut_guided_crash (const xpccut_guided_fuzz_t * fuzzer, int * size)
+{
+   const char * result = nullptr;
+   int crashsize = -1;
+   if (cut_not_nullptr(fuzzer) && fuzzer->m_Crash_Size >= 0)
+   {
+      result = fuzzer->m_Crash;
+      crashsize = fuzzer->m_Crash_Size;
+   }
+   if (cut_not_nullptr(size))
+      *size = crashsize;
+
+   return result;
+}
+
+/**
+ *    Provides the name of the file to which the failing input was written,
+ *    in the corpus directory.
+ *
+ * \param fuzzer
+ *    The fuzzer.
+ *
+ * \return
+ *    Returns the name, or null if the fuzzer has no corpus directory, the
+ *    target has not failed, or the file could not be written.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_09()
+ */
+
+const char *
+xpccut_guided_crash_file (const xpccut_guided_fuzz_t * fuzzer)
+{
+   const char * result = nullptr;
+   if (cut_not_nullptr(fuzzer) && cut_not_nullptr(fuzzer->m_Crash_File))
+   {
+      if (fuzzer->m_Crash_Size >= 0 && fuzzer->m_Crash_File[0] != 0)
+         result = fuzzer->m_Crash_File;
+   }
+   return result;
+}
+
+/**
+ *    Provides one input of the corpus, so that it can be saved, or used as
+ *    the start of other tests.
+ *
+ * \param fuzzer
+ *    The fuzzer.
+ *
+ * \param index
+ *    The index of the input, from 0 to xpccut_guided_corpus_count() - 1.
+ *
+ * \param [out] size
+ *    Receives the size of the input, if not null, or -1 if the index is
+ *    not valid.
+ *
+ * \return
+ *    Returns the input, which is also null-terminated, or null if the
+ *    index is not valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+const char *
+xpccut_guided_corpus_entry
+(
+   const xpccut_guided_fuzz_t * fuzzer,
+   int index,
+   int * size
+)
+{
+   const char * result = nullptr;
+   int entrysize = -1;
+   if (cut_not_nullptr(fuzzer) && index >= 0 && index < fuzzer->m_Corpus_Count)
+   {
+      result = fuzzer->m_Corpus[index];
+      entrysize = fuzzer->m_Corpus_Sizes[index];
+   }
+   if (cut_not_nullptr(size))
+      *size = entrysize;
+
+   return result;
+}
+
+/**
+ * \getter fuzzer->m_Corpus_Count
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+int
+xpccut_guided_corpus_count (const xpccut_guided_fuzz_t * fuzzer)
+{
+   return cut_not_nullptr(fuzzer) ? fuzzer->m_Corpus_Count : 0 ;
+}
+
+/**
+ * \getter fuzzer->m_Edge_Count
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+int
+xpccut_guided_edge_count (const xpccut_guided_fuzz_t * fuzzer)
+{
+   return cut_not_nullptr(fuzzer) ? fuzzer->m_Edge_Count : 0 ;
+}
+
+/**
+ * \getter fuzzer->m_Iterations
+ *
+ * \unittests
+ *    -  unit_unit_test_10_08()
+ */
+
+long long
+xpccut_guided_iterations (const xpccut_guided_fuzz_t * fuzzer)
+{
+   return cut_not_nullptr(fuzzer) ? fuzzer->m_Iterations : 0 ;
+}
+
+/*
+ * guided_fuzz.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
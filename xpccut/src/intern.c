@@ -0,0 +1,891 @@
+/**
+ * \file          intern.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the tables of interned strings.  Also see the intern.h
+ *    module.
+ *
+ *    A table is split into XPCCUT_INTERN_STRIPES stripes, picked by the
+ *    hash of the string.  Each stripe is an open-addressed hash table of
+ *    pointers, which doubles in size when it gets half full, and has a
+ *    lock of its own, since the --jobs workers name their sub-tests at the
+ *    same time.  The strings themselves are packed into blocks, so that
+ *    interning a short name does not cost a malloc() of its own.  Nothing
+ *    is removed, so a pointer handed out stays good until its table is
+ *    destroyed.  The memory of a table is not counted against the test
+ *    that happens to grow it (see alloc_count.h).
+ *
+ *    The same names come up again and again, mostly from the same string
+ *    literals, so each thread keeps a small cache, keyed by the pointer it
+ *    was given, in front of the tables.  A name found there costs no lock.
+ */
+
+#include <xpc/intern.h>                /* xpccut_intern()                     */
+#include <xpc/alloc_count.h>           /* xpccut_alloc_pause()                */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* malloc(), calloc(), free()          */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memcpy(), memset(), strcmp()        */
+#endif
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define XPCCUT_USE_INTERN_LOCK 1
+#include <pthread.h>                   /* the locks on the stripes            */
+#else
+#define XPCCUT_USE_INTERN_LOCK 0
+#endif
+
+/**
+ *    Provides the number of slots a stripe starts with.  It must be a
+ *    power of 2.
+ */
+
+#define XPCCUT_INTERN_SLOTS            32
+
+/**
+ *    Provides the size of the blocks into which the strings are packed.
+ *    A longer string gets a block of its own.
+ */
+
+#define XPCCUT_INTERN_BLOCK_SIZE       4096
+
+/**
+ *    Provides the number of entries in the cache of each thread.  It is a
+ *    prime, so that the pointers, which are often close together, spread
+ *    out over the entries.
+ */
+
+#define XPCCUT_INTERN_CACHE_SIZE       61
+
+/**
+ *    Holds a block of interned strings.  The blocks of a stripe are
+ *    chained together, so that they can be freed along with the table.
+ */
+
+typedef struct xpccut_intern_block
+{
+   struct xpccut_intern_block * m_Next;   /**< The block before this one.     */
+   int m_Used;                            /**< The bytes used in m_Text.      */
+   char m_Text[1];                        /**< The strings, end to end.       */
+
+} xpccut_intern_block_t;
+
+/**
+ *    Provides the alignment of the memory handed out by
+ *    xpccut_intern_table_alloc().
+ */
+
+typedef union
+{
+   void * m_Pointer;                      /**< For pointer fields.            */
+   double m_Double;                       /**< For floating-point fields.     */
+   long long m_Long;                      /**< For long integer fields.       */
+
+} xpccut_intern_align_t;
+
+/**
+ *    Provides the number of the newest table.  The table of
+ *    xpccut_intern() starts as table 1.
+ */
+
+static unsigned gs_Last_Id = 1;
+
+/**
+ *    Provides the table of xpccut_intern(), for the names that have no
+ *    unit_test_t behind them.  A new number is given to it each time it
+ *    is freed, so that the caches of the threads can tell that their
+ *    entries are stale.
+ */
+
+static xpccut_intern_table_t gs_Table = { { { nullptr } }, 1 };
+
+/**
+ *    Provides the number of holders of gs_Table; see
+ *    xpccut_intern_acquire().
+ */
+
+static int gs_Users = 0;
+
+/**
+ *    Reads and sets the number of a table, which the caches read without
+ *    a lock, and hands out new numbers.
+ */
+
+#if defined __GNUC__ && defined __ATOMIC_ACQUIRE
+#define XPCCUT_INTERN_LOAD(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define XPCCUT_INTERN_STORE(x, v)   __atomic_store_n(&(x), v, __ATOMIC_RELEASE)
+#define XPCCUT_INTERN_NEXT(x)       __atomic_add_fetch(&(x), 1, \
+                                       __ATOMIC_SEQ_CST)
+#elif defined __GNUC__
+#define XPCCUT_INTERN_LOAD(x)       (__sync_synchronize(), (x))
+#define XPCCUT_INTERN_STORE(x, v)   do { __sync_synchronize(); (x) = (v); } \
+                                       while (0)
+#define XPCCUT_INTERN_NEXT(x)       __sync_add_and_fetch(&(x), 1)
+#else
+#define XPCCUT_INTERN_LOAD(x)       (x)
+#define XPCCUT_INTERN_STORE(x, v)   ((x) = (v))
+#define XPCCUT_INTERN_NEXT(x)       (++(x))
+#endif
+
+/**
+ *    Holds one entry of the cache of a thread.
+ */
+
+typedef struct
+{
+   const char * m_Text;             /**< The pointer the caller gave.         */
+   const char * m_Interned;         /**< The interned copy of the string.     */
+   unsigned m_Table;                /**< The table that holds m_Interned.     */
+
+} xpccut_intern_cached_t;
+
+/**
+ *    Provides the cache of each thread.  An entry is used only for the
+ *    table whose number it holds, and table numbers are never used again,
+ *    so an entry from a table that has been destroyed is never used.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_intern_cached_t
+gs_Intern_Cache[XPCCUT_INTERN_CACHE_SIZE];
+
+#if XPCCUT_USE_INTERN_LOCK
+
+/**
+ *    Protects the stripes of all of the tables, and gs_Users.  Stripe n of
+ *    every table uses lock n, so one thread never holds two of them,
+ *    except around a fork().
+ */
+
+static pthread_mutex_t gs_Intern_Locks[XPCCUT_INTERN_STRIPES];
+
+/**
+ *    Makes sure that xpccut_intern_setup() is called just once.
+ */
+
+static pthread_once_t gs_Intern_Once = PTHREAD_ONCE_INIT;
+
+/**
+ *    Takes the locks around a fork(), so that an --isolate child, which
+ *    has only the thread that forked it, does not get a lock held by
+ *    another thread, which would never be released.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_intern_fork_prepare (void)
+{
+   int s;
+   for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+      pthread_mutex_lock(&gs_Intern_Locks[s]);
+}
+
+/**
+ *    Releases the locks taken by xpccut_intern_fork_prepare(), in both the
+ *    parent and the child.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_intern_fork_done (void)
+{
+   int s;
+   for (s = XPCCUT_INTERN_STRIPES - 1; s >= 0; --s)
+      pthread_mutex_unlock(&gs_Intern_Locks[s]);
+}
+
+/**
+ *    Makes the locks, and registers their fork handlers.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_intern_setup (void)
+{
+   int s;
+   for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+      (void) pthread_mutex_init(&gs_Intern_Locks[s], nullptr);
+
+   (void) pthread_atfork
+   (
+      xpccut_intern_fork_prepare,
+      xpccut_intern_fork_done, xpccut_intern_fork_done
+   );
+}
+
+#endif
+
+/**
+ *    Takes the lock on a stripe, if there is one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static void
+xpccut_intern_lock
+(
+   int stripe                       /**< The stripe, from 0.                  */
+)
+{
+#if XPCCUT_USE_INTERN_LOCK
+   (void) pthread_once(&gs_Intern_Once, xpccut_intern_setup);
+   pthread_mutex_lock(&gs_Intern_Locks[stripe]);
+#else
+   (void) stripe;
+#endif
+}
+
+/**
+ *    Releases the lock on a stripe, if there is one.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static void
+xpccut_intern_unlock
+(
+   int stripe                       /**< The stripe, from 0.                  */
+)
+{
+#if XPCCUT_USE_INTERN_LOCK
+   pthread_mutex_unlock(&gs_Intern_Locks[stripe]);
+#else
+   (void) stripe;
+#endif
+}
+
+/**
+ *    Hashes a string, using the FNV-1a algorithm.
+ *
+ * \return
+ *    Returns the hash of \a text, and its length in \a length.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static unsigned
+xpccut_intern_hash
+(
+   const char * text,               /**< The string to be hashed.             */
+   size_t * length                  /**< Gets the length of \a text.          */
+)
+{
+   unsigned result = 2166136261u;
+   const unsigned char * p = (const unsigned char *) text;
+   while (*p != 0)
+   {
+      result ^= *p++;
+      result *= 16777619u;
+   }
+   *length = (size_t) (p - (const unsigned char *) text);
+   return result;
+}
+
+/**
+ *    Doubles the number of slots in a stripe, or makes the first ones, and
+ *    puts the strings back in their new slots.  The stripe of a string is
+ *    picked by the low bits of its hash, and its slot by the rest.
+ *
+ * \return
+ *    Returns 'true' if the memory could be had.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static cbool_t
+xpccut_intern_grow
+(
+   xpccut_intern_stripe_t * stripe  /**< The stripe, locked.                  */
+)
+{
+   int count = stripe->m_Slot_Count > 0 ?
+      stripe->m_Slot_Count * 2 : XPCCUT_INTERN_SLOTS ;
+
+   const char ** slots = calloc((size_t) count, sizeof *slots);
+   cbool_t result = cut_not_nullptr(slots);
+   if (result)
+   {
+      int s;
+      for (s = 0; s < stripe->m_Slot_Count; ++s)
+      {
+         const char * text = stripe->m_Slots[s];
+         if (cut_not_nullptr(text))
+         {
+            size_t length;
+            unsigned i = xpccut_intern_hash(text, &length);
+            i = (i / XPCCUT_INTERN_STRIPES) & (unsigned) (count - 1);
+            while (cut_not_nullptr(slots[i]))
+               i = (i + 1) & (unsigned) (count - 1);
+
+            slots[i] = text;
+         }
+      }
+      free((void *) stripe->m_Slots);
+      stripe->m_Slots = slots;
+      stripe->m_Slot_Count = count;
+   }
+   return result;
+}
+
+/**
+ *    Provides the number of bytes to skip at the end of a block, so that
+ *    the next room in it starts at an address that is a multiple of \a
+ *    align.
+ *
+ * \return
+ *    Returns the offset of the room in the m_Text field of the block.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static int
+xpccut_intern_aligned
+(
+   const xpccut_intern_block_t * block,   /**< The block, assumed valid.    */
+   int align                              /**< The alignment, at least 1.   */
+)
+{
+   size_t address = (size_t) (block->m_Text + block->m_Used);
+   return block->m_Used + (int) ((align - address % align) % align);
+}
+
+/**
+ *    Takes room from the current block of a stripe, starting a new block
+ *    if the room does not fit.  The room starts at an address that is a
+ *    multiple of \a align.
+ *
+ * \return
+ *    Returns the room, or null if the memory could not be had.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static char *
+xpccut_intern_room
+(
+   xpccut_intern_stripe_t * stripe, /**< The stripe, locked.                  */
+   size_t size,                     /**< The number of bytes wanted.          */
+   int align                        /**< The alignment wanted, at least 1.    */
+)
+{
+   char * result = nullptr;
+   xpccut_intern_block_t * block = stripe->m_Block;
+   int used = 0;
+   if (cut_not_nullptr(block))
+      used = xpccut_intern_aligned(block, align);
+
+   if (cut_is_nullptr(block) || used + (int) size > stripe->m_Block_Room)
+   {
+      int room = (int) size + align - 1;
+      if (room < XPCCUT_INTERN_BLOCK_SIZE)
+         room = XPCCUT_INTERN_BLOCK_SIZE;
+
+      block = malloc(sizeof *block + (size_t) room);
+      if (cut_not_nullptr(block))
+      {
+         block->m_Next = stripe->m_Block;
+         block->m_Used = 0;
+         stripe->m_Block = block;
+         stripe->m_Block_Room = room;
+         ++stripe->m_Block_Count;
+         used = xpccut_intern_aligned(block, align);
+      }
+   }
+   if (cut_not_nullptr(block))
+   {
+      result = block->m_Text + used;
+      block->m_Used = used + (int) size;
+   }
+   return result;
+}
+
+/**
+ *    Makes a copy of a string in the current block of a stripe.
+ *
+ * \return
+ *    Returns the copy, or null if the memory could not be had.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static const char *
+xpccut_intern_copy
+(
+   xpccut_intern_stripe_t * stripe, /**< The stripe, locked.                  */
+   const char * text,               /**< The string to be copied.             */
+   size_t length                    /**< The length of \a text.               */
+)
+{
+   char * result = xpccut_intern_room(stripe, length + 1, 1);
+   if (cut_not_nullptr(result))
+      memcpy(result, text, length + 1);
+
+   return result;
+}
+
+/**
+ *    Finds the interned copy of a string in its stripe of a table, adding
+ *    it to the stripe if it is not there yet, and notes it in an entry of
+ *    the cache of the calling thread.  Only the lock of that stripe is
+ *    taken, so the threads that add names to other stripes go on.
+ *
+ * \return
+ *    Returns the interned copy of \a text, or the empty string if the
+ *    memory for a new string cannot be had.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static const char *
+xpccut_intern_shared
+(
+   xpccut_intern_table_t * table,   /**< The table, assumed valid.            */
+   const char * text,               /**< The string, neither null nor empty.  */
+   xpccut_intern_cached_t * entry   /**< The entry of the cache for \a text.  */
+)
+{
+   const char * result = "";
+   size_t length;
+   unsigned hash = xpccut_intern_hash(text, &length);
+   int s = (int) (hash & (XPCCUT_INTERN_STRIPES - 1));
+   xpccut_intern_stripe_t * stripe = &table->m_Stripes[s];
+   cbool_t ok = true;
+   xpccut_alloc_pause();
+   xpccut_intern_lock(s);
+   if (stripe->m_String_Count * 2 >= stripe->m_Slot_Count)
+      ok = xpccut_intern_grow(stripe);
+
+   if (ok)
+   {
+      unsigned mask = (unsigned) (stripe->m_Slot_Count - 1);
+      unsigned i = (hash / XPCCUT_INTERN_STRIPES) & mask;
+      const char ** slots = stripe->m_Slots;
+      while (cut_not_nullptr(slots[i]) && strcmp(slots[i], text) != 0)
+         i = (i + 1) & mask;
+
+      if (cut_is_nullptr(slots[i]))
+      {
+         slots[i] = xpccut_intern_copy(stripe, text, length);
+         if (cut_not_nullptr(slots[i]))
+            ++stripe->m_String_Count;
+         else
+            ok = false;
+      }
+      if (ok)
+      {
+         result = slots[i];
+         entry->m_Text = text;
+         entry->m_Interned = result;
+         entry->m_Table = XPCCUT_INTERN_LOAD(table->m_Id);
+      }
+   }
+   xpccut_intern_unlock(s);
+   xpccut_alloc_resume();
+   if (! ok)
+      xpccut_errprint_func(_("out of memory for interned names"));
+
+   return result;
+}
+
+/**
+ *    Frees the stripes of a table, and empties them.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
+ */
+
+static void
+xpccut_intern_free
+(
+   xpccut_intern_table_t * table    /**< The table, assumed valid.            */
+)
+{
+   int s;
+   xpccut_alloc_pause();
+   for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+   {
+      xpccut_intern_stripe_t * stripe = &table->m_Stripes[s];
+      xpccut_intern_lock(s);
+      while (cut_not_nullptr(stripe->m_Block))
+      {
+         xpccut_intern_block_t * block = stripe->m_Block;
+         stripe->m_Block = block->m_Next;
+         free(block);
+      }
+      free((void *) stripe->m_Slots);
+      stripe->m_Slots = nullptr;
+      stripe->m_Slot_Count = 0;
+      stripe->m_String_Count = 0;
+      stripe->m_Block_Room = 0;
+      stripe->m_Block_Count = 0;
+      xpccut_intern_unlock(s);
+   }
+   xpccut_alloc_resume();
+}
+
+/**
+ *    Sets up an empty table of interned strings, with a number of its own.
+ *    unit_test_clear() calls this function for the table of the run.
+ *
+ * \return
+ *    Returns 'true' if the \a table pointer is valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+cbool_t
+xpccut_intern_table_init
+(
+   xpccut_intern_table_t * table    /**< The "this" pointer for the function. */
+)
+{
+   cbool_t result = xpccut_thisptr(table);
+   if (result)
+   {
+      int s;
+      for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+      {
+         xpccut_intern_stripe_t * stripe = &table->m_Stripes[s];
+         stripe->m_Slots = nullptr;
+         stripe->m_Slot_Count = 0;
+         stripe->m_String_Count = 0;
+         stripe->m_Block = nullptr;
+         stripe->m_Block_Room = 0;
+         stripe->m_Block_Count = 0;
+      }
+      XPCCUT_INTERN_STORE(table->m_Id, XPCCUT_INTERN_NEXT(gs_Last_Id));
+   }
+   return result;
+}
+
+/**
+ *    Frees a table of interned strings.  The pointers it handed out are
+ *    then no longer good.  The table is left empty, and can be used again,
+ *    under a new number.  unit_test_destroy() calls this function for the
+ *    table of the run.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+void
+xpccut_intern_table_destroy
+(
+   xpccut_intern_table_t * table    /**< The "this" pointer for the function. */
+)
+{
+   if (xpccut_thisptr(table))
+   {
+      xpccut_intern_free(table);
+      XPCCUT_INTERN_STORE(table->m_Id, XPCCUT_INTERN_NEXT(gs_Last_Id));
+   }
+}
+
+/**
+ *    Finds the interned copy of a string in a table, adding it to the
+ *    table if it is not there yet.
+ *
+ *    The cache of the calling thread is looked at first.  Its entry is
+ *    used only if it is for the same pointer, from the same table, and
+ *    still has the same text, since the caller may have reused a buffer.
+ *    Otherwise, only the stripe of the table that holds the string is
+ *    locked.
+ *
+ *    The copy lasts until the table is destroyed.  Nothing is taken out of
+ *    a table before then, so it holds every different string it was
+ *    given; a string given again, as the names of a test are in each round
+ *    of --repeat, takes no more room.  The table of a run is destroyed
+ *    along with the run, so the names of one run do not pile up in the
+ *    table of another.
+ *
+ * \return
+ *    Returns a pointer to the interned copy of \a text, which must not be
+ *    changed or freed.  A null or empty string gives a static empty
+ *    string.  If the memory for a new string cannot be had, an error is
+ *    shown, and the empty string is returned.  A null \a table means the
+ *    table of xpccut_intern().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+const char *
+xpccut_intern_in
+(
+   xpccut_intern_table_t * table,   /**< The table, or null for the shared.   */
+   const char * text                /**< The string to be interned.           */
+)
+{
+   const char * result = "";
+   if (cut_not_nullptr(text) && *text != 0)
+   {
+      xpccut_intern_cached_t * entry =
+         &gs_Intern_Cache[(size_t) text % XPCCUT_INTERN_CACHE_SIZE];
+
+      unsigned id;
+      if (cut_is_nullptr(table))
+         table = &gs_Table;
+
+      id = XPCCUT_INTERN_LOAD(table->m_Id);
+      if
+      (
+         entry->m_Text == text && entry->m_Table == id &&
+         strcmp(entry->m_Interned, text) == 0
+      )
+      {
+         result = entry->m_Interned;
+      }
+      else
+         result = xpccut_intern_shared(table, text, entry);
+   }
+   return result;
+}
+
+/**
+ *    Takes a piece of zeroed memory from a table, for data that points to
+ *    the strings of the table and so should last just as long, such as the
+ *    failure log of a unit_test_status_t.  Like the strings, it is freed
+ *    only when the table is destroyed, and is not counted against the test
+ *    that asks for it.
+ *
+ * \return
+ *    Returns the memory, which is aligned for any of the fields of a
+ *    structure, or null if it could not be had.  A null \a table means the
+ *    table of xpccut_intern().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+void *
+xpccut_intern_table_alloc
+(
+   xpccut_intern_table_t * table,   /**< The table, or null for the shared.   */
+   size_t size                      /**< The number of bytes wanted.          */
+)
+{
+   char * result;
+   if (cut_is_nullptr(table))
+      table = &gs_Table;
+
+   xpccut_alloc_pause();
+   xpccut_intern_lock(0);
+   result = xpccut_intern_room
+   (
+      &table->m_Stripes[0], size, (int) sizeof(xpccut_intern_align_t)
+   );
+   xpccut_intern_unlock(0);
+   xpccut_alloc_resume();
+   if (cut_not_nullptr(result))
+      memset(result, 0, size);
+   else
+      xpccut_errprint_func(_("out of memory for interned names"));
+
+   return result;
+}
+
+/**
+ *    Provides the number of strings in a table.
+ *
+ * \return
+ *    Returns the number of different non-empty strings given to
+ *    xpccut_intern_in() for the table since it was set up, or 0 if the \a
+ *    table pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+int
+xpccut_intern_table_count
+(
+   xpccut_intern_table_t * table    /**< The "this" pointer for the function. */
+)
+{
+   int result = 0;
+   if (xpccut_thisptr(table))
+   {
+      int s;
+      for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+      {
+         xpccut_intern_lock(s);
+         result += table->m_Stripes[s].m_String_Count;
+         xpccut_intern_unlock(s);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the number of blocks of text that a table holds, which is a
+ *    measure of the memory it takes.
+ *
+ * \return
+ *    Returns the number of blocks, or 0 if the \a table pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+int
+xpccut_intern_table_blocks
+(
+   xpccut_intern_table_t * table    /**< The "this" pointer for the function. */
+)
+{
+   int result = 0;
+   if (xpccut_thisptr(table))
+   {
+      int s;
+      for (s = 0; s < XPCCUT_INTERN_STRIPES; ++s)
+      {
+         xpccut_intern_lock(s);
+         result += table->m_Stripes[s].m_Block_Count;
+         xpccut_intern_unlock(s);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Finds the interned copy of a string in the shared table, for a name
+ *    that has no unit_test_t behind it, such as that of a status that has
+ *    no options.  See xpccut_intern_in(); the copy lasts until the last
+ *    unit_test_t is destroyed.
+ *
+ * \return
+ *    Returns a pointer to the interned copy of \a text, which must not be
+ *    changed or freed.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+const char *
+xpccut_intern
+(
+   const char * text                /**< The string to be interned.           */
+)
+{
+   return xpccut_intern_in(nullptr, text);
+}
+
+/**
+ *    Holds the shared table of xpccut_intern() for a unit_test_t.  The
+ *    table is freed when the last holder lets go of it in
+ *    xpccut_intern_release().  unit_test_clear() calls this function.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+void
+xpccut_intern_acquire (void)
+{
+   xpccut_intern_lock(0);
+   ++gs_Users;
+   xpccut_intern_unlock(0);
+}
+
+/**
+ *    Lets go of the shared table held by xpccut_intern_acquire(), freeing
+ *    it and its strings if there is no other holder.  The pointers handed
+ *    out by xpccut_intern() are then no longer good.  unit_test_destroy()
+ *    calls this function.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+void
+xpccut_intern_release (void)
+{
+   cbool_t last;
+   xpccut_intern_lock(0);
+   last = gs_Users > 0 && --gs_Users == 0;
+   xpccut_intern_unlock(0);
+   if (last)
+      xpccut_intern_table_destroy(&gs_Table);
+}
+
+/**
+ *    Provides the number of strings in the shared table.
+ *
+ * \return
+ *    Returns the number of different non-empty strings given to
+ *    xpccut_intern().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+int
+xpccut_intern_count (void)
+{
+   return xpccut_intern_table_count(&gs_Table);
+}
+
+/*
+ * intern.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
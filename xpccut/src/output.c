@@ -0,0 +1,738 @@
+/**
+ * \file          output.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the buffered output layer of the XPCCUT library.  Also see
+ *    the output.h module.
+ *
+ *    Text is formatted straight into the buffer of the calling thread, so
+ *    a message costs one vsnprintf() and no locking.  The buffer goes to
+ *    the sink when it is full, when the channel changes, and when it is
+ *    flushed, and error messages go out at once, so that they are not lost
+ *    if the test crashes.
+ *
+ *    While a thread captures its output, the batches are kept, tagged with
+ *    their channel, in a block of memory instead of being sent to the sink.
+ *    The --jobs workers capture the output of each test, and the main
+ *    thread replays it just before it shows the result of the test, so the
+ *    output comes out in the order the tests were loaded.
+ */
+
+#include <xpc/output.h>                /* xpccut_output_sink_t, etc.          */
+#include <xpc/alloc_count.h>           /* xpccut_alloc_pause()                */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fwrite(), vsnprintf(), fflush()     */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memcpy(), strlen()                  */
+#endif
+
+/**
+ *    Provides the number of buffers of each thread.  Console output, for
+ *    stdout and stderr, which must stay in order, shares one buffer.  The
+ *    report has a buffer of its own, so that its records do not break up
+ *    the batches of console output.
+ */
+
+#define XPCCUT_OUTPUT_LANES            2
+
+/**
+ *    Holds one output buffer of a thread.
+ */
+
+typedef struct
+{
+   /**
+    *    The text that has not yet gone to the sink.
+    */
+
+   char m_Text[XPCCUT_OUTPUT_BUFFER_SIZE];
+
+   /**
+    *    The number of bytes in m_Text.
+    */
+
+   int m_Length;
+
+   /**
+    *    The channel of the text in m_Text.
+    */
+
+   xpccut_output_channel_t m_Channel;
+
+} xpccut_output_lane_t;
+
+/**
+ *    Holds the output state of one thread.
+ */
+
+typedef struct
+{
+   /**
+    *    The buffers of the thread, one for the console and one for the
+    *    report.
+    */
+
+   xpccut_output_lane_t m_Lanes[XPCCUT_OUTPUT_LANES];
+
+   /**
+    *    Indicates that the output of the thread is being captured.
+    */
+
+   cbool_t m_Is_Capturing;
+
+   /**
+    *    The captured output, a series of records, each of which is the
+    *    channel as one byte, the length as an int, and the text.
+    */
+
+   char * m_Capture;
+
+   /**
+    *    The number of bytes in m_Capture.
+    */
+
+   int m_Capture_Length;
+
+   /**
+    *    The number of bytes that m_Capture can hold.
+    */
+
+   int m_Capture_Capacity;
+
+   /**
+    *    The sink set by xpccut_output_set_sink(), or null for the default
+    *    sink, which writes to stdout and stderr.
+    */
+
+   xpccut_output_sink_t m_Sink;
+
+   /**
+    *    The context that is passed to m_Sink.
+    */
+
+   void * m_Sink_Context;
+
+} xpccut_output_t;
+
+/**
+ *    Provides the output state of each thread.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_output_t gs_Output;
+
+/**
+ *    Indicates that xpccut_output_flush() has been registered with
+ *    atexit(), so that output still in the buffer of the main thread is not
+ *    lost at the end of the program.
+ */
+
+static cbool_t gs_Exit_Flush = false;
+
+/**
+ *    Provides the file to which the default sink writes the text of the
+ *    XPCCUT_OUTPUT_REPORT channel, or null to throw that text away.  It is
+ *    read and written through XPCCUT_REPORT_LOAD() and
+ *    XPCCUT_REPORT_STORE(), since any thread can flush its output, the
+ *    thread of the test watchdog among them, while the main thread sets it.
+ */
+
+static FILE * gs_Report_File = nullptr;
+
+/**
+ *    Reads and sets gs_Report_File atomically.  Where the compiler provides
+ *    no atomic operations, they are plain operations, which are good enough
+ *    for a single thread.
+ */
+
+#if defined __GNUC__ && defined __ATOMIC_ACQUIRE
+#define XPCCUT_REPORT_LOAD()  __atomic_load_n(&gs_Report_File, __ATOMIC_ACQUIRE)
+#define XPCCUT_REPORT_STORE(f) \
+   __atomic_store_n(&gs_Report_File, f, __ATOMIC_RELEASE)
+#elif defined __GNUC__
+#define XPCCUT_REPORT_LOAD()        (__sync_synchronize(), gs_Report_File)
+#define XPCCUT_REPORT_STORE(f) \
+   do { __sync_synchronize(); gs_Report_File = (f); } while (0)
+#else
+#define XPCCUT_REPORT_LOAD()        (gs_Report_File)
+#define XPCCUT_REPORT_STORE(f)      (gs_Report_File = (f))
+#endif
+
+/**
+ *    Sets the function that takes the batches of output of the calling
+ *    thread.  The output of the --jobs workers is captured and replayed by
+ *    the main thread, so the sink of the main thread gets all of the
+ *    output of unit_test_run().  Any output still in the buffer goes to the
+ *    old sink first.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_set_sink
+(
+   xpccut_output_sink_t sink,    /**< The new sink, or null for the default.  */
+   void * context                /**< The first parameter of \a sink.         */
+)
+{
+   xpccut_output_flush();
+   gs_Output.m_Sink = sink;
+   gs_Output.m_Sink_Context = context;
+}
+
+/**
+ *    Gets the function that takes the batches of output of the calling
+ *    thread, so that it can be put back after another sink has been used
+ *    for a while.
+ *
+ * \return
+ *    Returns the current sink, or null if the default sink is in use.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+xpccut_output_sink_t
+xpccut_output_get_sink
+(
+   void ** context               /**< Gets the context of the sink, if any.   */
+)
+{
+   if (cut_not_nullptr(context))
+      *context = gs_Output.m_Sink_Context;
+
+   return gs_Output.m_Sink;
+}
+
+/**
+ *    Adds a record to the captured output of the calling thread.
+ *
+ * \return
+ *    Returns 'true' if there was memory for the record.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04() [indirect test]
+ */
+
+static cbool_t
+xpccut_output_keep
+(
+   xpccut_output_channel_t channel, /**< The channel of the text.             */
+   const char * text,               /**< The text to keep.                    */
+   int length                       /**< The number of bytes in \a text.      */
+)
+{
+   cbool_t result = true;
+   int needed = gs_Output.m_Capture_Length + 1 + (int) sizeof(int) + length;
+   if (needed > gs_Output.m_Capture_Capacity)
+   {
+      int capacity = gs_Output.m_Capture_Capacity * 2;
+      char * capture;
+      if (capacity < XPCCUT_OUTPUT_BUFFER_SIZE)
+         capacity = XPCCUT_OUTPUT_BUFFER_SIZE;
+
+      while (capacity < needed)
+         capacity *= 2;
+
+      capture = realloc(gs_Output.m_Capture, (size_t) capacity);
+      if (cut_not_nullptr(capture))
+      {
+         gs_Output.m_Capture = capture;
+         gs_Output.m_Capture_Capacity = capacity;
+      }
+      else
+         result = false;
+   }
+   if (result)
+   {
+      char * record = gs_Output.m_Capture + gs_Output.m_Capture_Length;
+      record[0] = (char) channel;
+      memcpy(record + 1, &length, sizeof(int));
+      memcpy(record + 1 + sizeof(int), text, (size_t) length);
+      gs_Output.m_Capture_Length = needed;
+   }
+   return result;
+}
+
+/**
+ *    Sends text to the sink, or to the captured output of the calling
+ *    thread.  The default sink writes it with one fwrite(), after flushing
+ *    stdout if the text is for stderr.  Report text goes to the file set
+ *    by xpccut_output_set_report_file().  The allocations made on the way,
+ *    such as the growth of the captured output, are not counted against
+ *    the test (see alloc_count.h).
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04() [indirect test]
+ */
+
+static void
+xpccut_output_emit
+(
+   xpccut_output_channel_t channel, /**< The channel of the text.             */
+   const char * text,               /**< The text to send.                    */
+   int length                       /**< The number of bytes in \a text.      */
+)
+{
+   if (length > 0)
+   {
+      xpccut_alloc_pause();
+      if (gs_Output.m_Is_Capturing)
+      {
+         if (! xpccut_output_keep(channel, text, length))
+            (void) fwrite(text, 1, (size_t) length, stderr);
+      }
+      else if (cut_not_nullptr(gs_Output.m_Sink))
+      {
+         (*gs_Output.m_Sink)
+         (
+            gs_Output.m_Sink_Context, channel, text, length
+         );
+      }
+      else if (channel == XPCCUT_OUTPUT_REPORT)
+      {
+         FILE * report = XPCCUT_REPORT_LOAD();
+         if (cut_not_nullptr(report))
+            (void) fwrite(text, 1, (size_t) length, report);
+      }
+      else if (channel == XPCCUT_OUTPUT_STDERR)
+      {
+         (void) fflush(stdout);           /* keep stdout and stderr in order */
+         (void) fwrite(text, 1, (size_t) length, stderr);
+      }
+      else
+         (void) fwrite(text, 1, (size_t) length, stdout);
+
+      xpccut_alloc_resume();
+   }
+}
+
+/**
+ *    Sends a buffer of the calling thread on its way, and empties it.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04() [indirect test]
+ */
+
+static void
+xpccut_output_drain
+(
+   xpccut_output_lane_t * lane      /**< The buffer to be emptied.            */
+)
+{
+   if (lane->m_Length > 0)
+   {
+      int length = lane->m_Length;
+      lane->m_Length = 0;
+      xpccut_output_emit(lane->m_Channel, lane->m_Text, length);
+   }
+}
+
+/**
+ *    Sends all of the buffers of the calling thread on their way.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04() [indirect test]
+ */
+
+static void
+xpccut_output_drain_all (void)
+{
+   int lane;
+   for (lane = 0; lane < XPCCUT_OUTPUT_LANES; ++lane)
+      xpccut_output_drain(&gs_Output.m_Lanes[lane]);
+}
+
+/**
+ *    Gets the buffer of the calling thread for the given channel ready for
+ *    text.  Text already in the buffer for the other channel is sent on
+ *    first, so that stdout and stderr stay in order.  The first time this
+ *    is done, xpccut_output_flush() is registered with atexit().
+ *
+ * \return
+ *    Returns the buffer to use.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04() [indirect test]
+ */
+
+static xpccut_output_lane_t *
+xpccut_output_select
+(
+   xpccut_output_channel_t channel  /**< The channel of the coming text.      */
+)
+{
+   xpccut_output_lane_t * result =
+      &gs_Output.m_Lanes[channel == XPCCUT_OUTPUT_REPORT ? 1 : 0];
+
+   if (! gs_Exit_Flush)
+   {
+      gs_Exit_Flush = true;
+      (void) atexit(xpccut_output_flush);
+   }
+   if (result->m_Channel != channel)
+   {
+      xpccut_output_drain(result);
+      result->m_Channel = channel;
+   }
+   return result;
+}
+
+/**
+ *    Adds text to the buffer of the calling thread.  Text too big for the
+ *    buffer goes straight to the sink.  Error text is sent on at once.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_write
+(
+   xpccut_output_channel_t channel, /**< The channel of the text.             */
+   const char * text,               /**< The text to write.                   */
+   int length                       /**< Its length, or -1 to use strlen().   */
+)
+{
+   if (cut_not_nullptr(text))
+   {
+      xpccut_output_lane_t * lane = xpccut_output_select(channel);
+      if (length < 0)
+         length = (int) strlen(text);
+
+      if (length > XPCCUT_OUTPUT_BUFFER_SIZE - lane->m_Length)
+         xpccut_output_drain(lane);
+
+      if (length >= XPCCUT_OUTPUT_BUFFER_SIZE)
+         xpccut_output_emit(channel, text, length);
+      else
+      {
+         memcpy(lane->m_Text + lane->m_Length, text, (size_t) length);
+         lane->m_Length += length;
+      }
+      if (channel == XPCCUT_OUTPUT_STDERR)
+         xpccut_output_drain(lane);
+   }
+}
+
+/**
+ *    Formats text into the buffer of the calling thread.  If the text does
+ *    not fit in what is left of the buffer, the buffer is sent on and the
+ *    text is formatted again; text too big for the whole buffer is
+ *    formatted into memory of its own.  Error text is sent on at once.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_vprintf
+(
+   xpccut_output_channel_t channel, /**< The channel of the text.             */
+   const char * format,             /**< The printf() format of the text.     */
+   va_list args                     /**< The values for \a format.            */
+)
+{
+   if (cut_not_nullptr(format))
+   {
+      xpccut_output_lane_t * lane = xpccut_output_select(channel);
+      int room = XPCCUT_OUTPUT_BUFFER_SIZE - lane->m_Length;
+      int length;
+      va_list again;
+      va_copy(again, args);
+      length = vsnprintf
+      (
+         lane->m_Text + lane->m_Length, (size_t) room, format, args
+      );
+      if (length >= 0 && length < room)
+         lane->m_Length += length;
+      else if (length >= 0)
+      {
+         xpccut_output_drain(lane);
+         if (length < XPCCUT_OUTPUT_BUFFER_SIZE)
+         {
+            lane->m_Length = vsnprintf
+            (
+               lane->m_Text, XPCCUT_OUTPUT_BUFFER_SIZE, format, again
+            );
+         }
+         else
+         {
+            char * text;
+            xpccut_alloc_pause();
+            text = malloc((size_t) length + 1);
+            if (cut_not_nullptr(text))
+            {
+               (void) vsnprintf(text, (size_t) length + 1, format, again);
+               xpccut_output_emit(channel, text, length);
+               free(text);
+            }
+            xpccut_alloc_resume();
+         }
+      }
+      va_end(again);
+      if (channel == XPCCUT_OUTPUT_STDERR)
+         xpccut_output_drain(lane);
+   }
+}
+
+/**
+ *    Formats text into the buffer of the calling thread, for the given
+ *    channel.  See xpccut_output_vprintf().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_printf
+(
+   xpccut_output_channel_t channel, /**< The channel of the text.             */
+   const char * format,             /**< The printf() format of the text.     */
+   ...                              /**< The values for \a format.            */
+)
+{
+   va_list args;
+   va_start(args, format);
+   xpccut_output_vprintf(channel, format, args);
+   va_end(args);
+}
+
+/**
+ *    Formats text into the buffer of the calling thread, for stdout.  This
+ *    is the replacement for fprintf(stdout, ...) in test functions.  See
+ *    xpccut_output_vprintf().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_print
+(
+   const char * format,             /**< The printf() format of the text.     */
+   ...                              /**< The values for \a format.            */
+)
+{
+   va_list args;
+   va_start(args, format);
+   xpccut_output_vprintf(XPCCUT_OUTPUT_STDOUT, format, args);
+   va_end(args);
+}
+
+/**
+ *    Formats text into the buffer of the calling thread, for stderr, and
+ *    sends it on at once.  This is the replacement for fprintf(stderr, ...).
+ *    See xpccut_output_vprintf().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_print_error
+(
+   const char * format,             /**< The printf() format of the text.     */
+   ...                              /**< The values for \a format.            */
+)
+{
+   va_list args;
+   va_start(args, format);
+   xpccut_output_vprintf(XPCCUT_OUTPUT_STDERR, format, args);
+   va_end(args);
+}
+
+/**
+ *    Sends the buffers of the calling thread on their way.  Unless the
+ *    output is being captured, and if the default sink is in use, stdout,
+ *    stderr, and the report file are flushed, too, so that the output can
+ *    be seen at once.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_flush (void)
+{
+   xpccut_output_drain_all();
+   if (! gs_Output.m_Is_Capturing && cut_is_nullptr(gs_Output.m_Sink))
+   {
+      FILE * report = XPCCUT_REPORT_LOAD();
+      (void) fflush(stdout);
+      (void) fflush(stderr);
+      if (cut_not_nullptr(report))
+         (void) fflush(report);
+   }
+}
+
+/**
+ *    Sets the file to which the default sink writes the text of the
+ *    XPCCUT_OUTPUT_REPORT channel.  The report file is shared by all
+ *    threads, and should only be changed while no tests are running.  The
+ *    caller still owns the file, and must flush the output before closing
+ *    it.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05()
+ */
+
+void
+xpccut_output_set_report_file
+(
+   FILE * report                    /**< The report file, or null for none.   */
+)
+{
+   xpccut_output_flush();
+   XPCCUT_REPORT_STORE(report);
+}
+
+/**
+ *    Provides the file set by xpccut_output_set_report_file(), so that a
+ *    caller that changes the report file for a while, such as a nested
+ *    unit_test_run(), can put it back afterward.
+ *
+ * \return
+ *    Returns the report file, or null if there is none.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_33()
+ */
+
+FILE *
+xpccut_output_get_report_file (void)
+{
+   return XPCCUT_REPORT_LOAD();
+}
+
+/**
+ *    Starts capturing the output of the calling thread.  Output already in
+ *    the buffer goes to the sink first.  Captures do not nest; a caller
+ *    that may already be capturing can end the outer capture, and replay
+ *    it into a new capture afterward.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_capture_begin (void)
+{
+   xpccut_output_drain_all();
+   gs_Output.m_Is_Capturing = true;
+   gs_Output.m_Capture = nullptr;
+   gs_Output.m_Capture_Length = 0;
+   gs_Output.m_Capture_Capacity = 0;
+}
+
+/**
+ *    Tells if the output of the calling thread is being captured.
+ *
+ * \return
+ *    Returns 'true' between calls of xpccut_output_capture_begin() and
+ *    xpccut_output_capture_end().
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+cbool_t
+xpccut_output_is_capturing (void)
+{
+   return gs_Output.m_Is_Capturing;
+}
+
+/**
+ *    Stops capturing the output of the calling thread.
+ *
+ * \return
+ *    Returns the captured output, which the caller must pass to
+ *    xpccut_output_replay() and free().  Returns null if there was no
+ *    output.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+char *
+xpccut_output_capture_end
+(
+   int * length                     /**< Gets the size of the captured block. */
+)
+{
+   char * result;
+   xpccut_output_drain_all();
+   result = gs_Output.m_Capture;
+   if (cut_not_nullptr(length))
+      *length = gs_Output.m_Capture_Length;
+
+   gs_Output.m_Is_Capturing = false;
+   gs_Output.m_Capture = nullptr;
+   gs_Output.m_Capture_Length = 0;
+   gs_Output.m_Capture_Capacity = 0;
+   return result;
+}
+
+/**
+ *    Writes output captured by xpccut_output_capture_begin() and
+ *    xpccut_output_capture_end() as if the calling thread had written it.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_04()
+ */
+
+void
+xpccut_output_replay
+(
+   const char * captured,           /**< The captured block, or null.         */
+   int length                       /**< The size of the captured block.      */
+)
+{
+   if (cut_not_nullptr(captured))
+   {
+      int offset = 0;
+      while (offset + 1 + (int) sizeof(int) <= length)
+      {
+         xpccut_output_channel_t channel =
+            (xpccut_output_channel_t) captured[offset];
+
+         int size;
+         memcpy(&size, captured + offset + 1, sizeof(int));
+         offset += 1 + (int) sizeof(int);
+         if (size < 0 || offset + size > length)
+            break;
+
+         xpccut_output_write(channel, captured + offset, size);
+         offset += size;
+      }
+   }
+}
+
+/*
+ * output.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
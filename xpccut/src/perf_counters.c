@@ -0,0 +1,405 @@
+/**
+ * \file          perf_counters.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides functions for reading the hardware performance counters of
+ *    the processor, for the --perf-counters option and for benchmarks.
+ *    Also see the perf_counters.h module.
+ *
+ *    On Linux, one perf_event_open() counter is opened for each of the
+ *    counters in xpccut_perf_counter_t.  The counters count only the
+ *    calling thread, in user space, on whatever CPU it runs, so that tests
+ *    run side by side by the --jobs option are measured separately.  They
+ *    are opened lazily, the first time a thread reads them, and stay open
+ *    until the thread calls xpccut_perf_release(), or the process exits.
+ *
+ *    The counters are opened one by one, rather than as a group, so that a
+ *    processor or virtual machine that lacks one of them still provides
+ *    the rest.  The kernel can then multiplex them, so each value is
+ *    scaled by its enabled time over its running time.
+ */
+
+#include <xpc/perf_counters.h>         /* xpccut_perf_values_t, etc.          */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fprintf() and stdout                */
+#endif
+
+#if XPC_HAVE_LINUX_PERF_EVENT_H && XPC_HAVE_SYS_SYSCALL_H && XPC_HAVE_UNISTD_H
+
+/**
+ *    Indicates that the counters can be used in this build.
+ */
+
+#define XPCCUT_USE_PERF_EVENTS
+
+#include <linux/perf_event.h>          /* struct perf_event_attr, etc.        */
+#include <string.h>                    /* memset()                            */
+#include <sys/syscall.h>               /* SYS_perf_event_open                 */
+#include <unistd.h>                    /* syscall(), read(), close()          */
+
+#endif
+
+/**
+ *    Holds the counters opened by one thread.
+ */
+
+typedef struct
+{
+   /**
+    *    Indicates that the thread has tried to open the counters.  It is
+    *    set even if none of them could be opened, so that the attempt is
+    *    not repeated at every reading.
+    */
+
+   cbool_t m_Is_Open;
+
+   /**
+    *    The file descriptor of each counter, or -1 if it could not be
+    *    opened.  Only meaningful once m_Is_Open is set.
+    */
+
+   int m_Fds[XPCCUT_PERF_COUNT];
+
+} xpccut_perf_fds_t;
+
+/**
+ *    The counters of the calling thread.  Being zero-initialized, they
+ *    start out not open.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_perf_fds_t gs_perf_fds;
+
+/**
+ *    Provides the names of the counters, in the order of
+ *    xpccut_perf_counter_t.
+ */
+
+static const char * const gs_perf_names[XPCCUT_PERF_COUNT] =
+{
+   "cycles",
+   "instructions",
+   "cache misses",
+   "branch misses"
+};
+
+#if defined XPCCUT_USE_PERF_EVENTS
+
+/**
+ *    Provides the perf_event_open() configuration of each counter, in the
+ *    order of xpccut_perf_counter_t.
+ */
+
+static const unsigned long long gs_perf_configs[XPCCUT_PERF_COUNT] =
+{
+   PERF_COUNT_HW_CPU_CYCLES,
+   PERF_COUNT_HW_INSTRUCTIONS,
+   PERF_COUNT_HW_CACHE_MISSES,
+   PERF_COUNT_HW_BRANCH_MISSES
+};
+
+#endif
+
+/**
+ *    Opens the counters of the calling thread, if it has not yet tried to.
+ *    A counter that cannot be opened is left at -1; this is not an error,
+ *    since the kernel setting of perf_event_paranoid, a virtual machine, or
+ *    the processor itself can keep any of the counters from being used.
+ *
+ * \return
+ *    Returns 'true' if at least one of the counters is open.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for xpccut_perf_read().
+ */
+
+static cbool_t
+xpccut_perf_open (void)
+{
+   cbool_t result = false;
+   int c;
+   if (! gs_perf_fds.m_Is_Open)
+   {
+#if defined XPCCUT_USE_PERF_EVENTS
+      struct perf_event_attr attr;
+#endif
+      for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+      {
+         gs_perf_fds.m_Fds[c] = -1;
+#if defined XPCCUT_USE_PERF_EVENTS
+         memset(&attr, 0, sizeof attr);
+         attr.size = sizeof attr;
+         attr.type = PERF_TYPE_HARDWARE;
+         attr.config = gs_perf_configs[c];
+         attr.exclude_kernel = 1;
+         attr.exclude_hv = 1;
+         attr.read_format =
+            PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+         gs_perf_fds.m_Fds[c] = (int) syscall
+         (
+            SYS_perf_event_open, &attr, 0, -1, -1, 0UL
+         );
+         if (gs_perf_fds.m_Fds[c] < 0)
+            gs_perf_fds.m_Fds[c] = -1;
+#endif
+      }
+      gs_perf_fds.m_Is_Open = true;
+   }
+   for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+   {
+      if (gs_perf_fds.m_Fds[c] >= 0)
+      {
+         result = true;
+         break;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Indicates if any of the hardware counters can be read by the calling
+ *    thread.  The counters are opened, if not already open.
+ *
+ * \return
+ *    Returns 'true' if at least one counter is available.  Returns 'false'
+ *    on platforms other than Linux.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+cbool_t
+xpccut_perf_available (void)
+{
+   return xpccut_perf_open();
+}
+
+/**
+ *    Reads the hardware counters of the calling thread.  The values count
+ *    from the time the thread first read them, so only the difference
+ *    between two readings, from xpccut_perf_difference(), is meaningful.
+ *
+ * \return
+ *    Returns 'true' if the pointer was valid and at least one counter was
+ *    read.  Otherwise, \a values is zeroed, if valid, and 'false' is
+ *    returned; this is not treated as an error, since counters are often
+ *    unavailable.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+cbool_t
+xpccut_perf_read
+(
+   xpccut_perf_values_t * values    /**< The structure to receive the counts. */
+)
+{
+   cbool_t result = cut_not_nullptr(values);
+   if (result)
+   {
+      int c;
+      values->m_Is_Valid = false;
+      for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+      {
+         values->m_Have[c] = false;
+         values->m_Values[c] = 0;
+      }
+      result = xpccut_perf_open();
+#if defined XPCCUT_USE_PERF_EVENTS
+      if (result)
+      {
+         for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+         {
+            unsigned long long data[3];      /* value, enabled, running    */
+            int fd = gs_perf_fds.m_Fds[c];
+            if (fd >= 0 && read(fd, data, sizeof data) == sizeof data)
+            {
+               double value = (double) data[0];
+               if (data[2] > 0 && data[2] < data[1])
+                  value *= (double) data[1] / (double) data[2];
+
+               values->m_Values[c] = (long long) value;
+               values->m_Have[c] = true;
+               values->m_Is_Valid = true;
+            }
+         }
+         result = values->m_Is_Valid;
+      }
+#endif
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Provides the counts between two readings taken by xpccut_perf_read().
+ *    Each value of \a delta is "v2 - v1", and a counter is present in \a
+ *    delta only if it is present in both readings.
+ *
+ * \return
+ *    Returns 'true' if the pointers were valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+cbool_t
+xpccut_perf_difference
+(
+   const xpccut_perf_values_t * v1, /**< The earlier reading.                 */
+   const xpccut_perf_values_t * v2, /**< The later reading.                   */
+   xpccut_perf_values_t * delta     /**< The structure to receive v2 - v1.    */
+)
+{
+   cbool_t result = cut_not_nullptr_3(v1, v2, delta);
+   if (result)
+   {
+      int c;
+      delta->m_Is_Valid = false;
+      for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+      {
+         delta->m_Have[c] = v1->m_Have[c] && v2->m_Have[c];
+         if (delta->m_Have[c])
+         {
+            delta->m_Values[c] = v2->m_Values[c] - v1->m_Values[c];
+            delta->m_Is_Valid = true;
+         }
+         else
+            delta->m_Values[c] = 0;
+      }
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Closes the counters of the calling thread.  A thread that has read the
+ *    counters should call this function before it exits, so that their
+ *    file descriptors are not leaked.  The counters are opened again if
+ *    the thread reads them afterward.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+void
+xpccut_perf_release (void)
+{
+   if (gs_perf_fds.m_Is_Open)
+   {
+      int c;
+      for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+      {
+#if defined XPCCUT_USE_PERF_EVENTS
+         if (gs_perf_fds.m_Fds[c] >= 0)
+            (void) close(gs_perf_fds.m_Fds[c]);
+#endif
+         gs_perf_fds.m_Fds[c] = -1;
+      }
+      gs_perf_fds.m_Is_Open = false;
+   }
+}
+
+/**
+ *    Provides the name of a counter, for reports.
+ *
+ * \return
+ *    Returns the name, or "?" if the counter is out of range.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+const char *
+xpccut_perf_counter_name
+(
+   xpccut_perf_counter_t counter    /**< The index of the counter.            */
+)
+{
+   const char * result = "?";
+   if ((int) counter >= 0 && counter < XPCCUT_PERF_COUNT)
+      result = gs_perf_names[counter];
+
+   return result;
+}
+
+/**
+ *    Shows a reading, or a difference of readings, on one line of standard
+ *    output, unless the output is silenced.  Only the counters that are
+ *    present are shown.  If both cycles and instructions are present, the
+ *    instructions per cycle are shown, too.
+ *
+\verbatim
+      Counters: cycles 104213, instructions 250117 (IPC 2.40), ...
+\endverbatim
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+void
+xpccut_perf_show
+(
+   const char * label,                 /**< The lead-in text of the line.     */
+   const xpccut_perf_values_t * values,   /**< The counts to be shown.        */
+   double divisor       /**< The counts are divided by this, if more than 1.  */
+)
+{
+   if (cut_not_nullptr_2(label, values) && values->m_Is_Valid)
+   {
+      if (! xpccut_is_silent())
+      {
+         const char * separator = "";
+         int c;
+         if (divisor < 1.0)
+            divisor = 1.0;
+
+         xpccut_print("  %s:", label);
+         for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+         {
+            if (values->m_Have[c])
+            {
+               double v = (double) values->m_Values[c] / divisor;
+               xpccut_print
+               (
+                  divisor > 1.0 ? "%s %s %.2f" : "%s %s %.0f",
+                  separator, _(gs_perf_names[c]), v
+               );
+               if (c == XPCCUT_PERF_INSTRUCTIONS)
+               {
+                  long long cycles = values->m_Values[XPCCUT_PERF_CYCLES];
+                  if (values->m_Have[XPCCUT_PERF_CYCLES] && cycles > 0)
+                  {
+                     xpccut_print
+                     (
+                        " (IPC %.2f)",
+                        (double) values->m_Values[c] / (double) cycles
+                     );
+                  }
+               }
+               separator = ",";
+            }
+         }
+         xpccut_print("\n");
+      }
+   }
+}
+
+/*
+ * perf_counters.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
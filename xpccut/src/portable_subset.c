@@ -3,7 +3,7 @@
  * \library       xpccut
  * \author        Chris Ahlstrom
  * \date          2010-03-07
- * \update        2015-10-10
+ * \update        2026-10-14
  * \version       $Revision$
  * \license       $XPC_SUITE_GPL_LICENSE$
  *
@@ -24,6 +24,16 @@
  *    formatting and function names.
  */
 
+/**
+ *    RUSAGE_THREAD, which lets xpccut_get_resources() measure only the
+ *    calling thread, is a GNU extension.  It must be asked for before any
+ *    system header is included.
+ */
+
+#if defined __linux__ && ! defined _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <xpc/portable_subset.h>       /* functions, macros, and headers      */
 
 #if XPC_HAVE_STDIO_H
@@ -42,6 +52,14 @@
 #include <locale.h>                    /* declares setlocale()                */
 #endif
 
+#if XPC_HAVE_TIME_H
+#include <time.h>                      /* clock_gettime() and CLOCK_MONOTONIC */
+#endif
+
+#if XPC_HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>              /* getrusage() and struct rusage       */
+#endif
+
 /**
  * \doxygen
  *    This module has a function we would like to be documented, even if not
@@ -125,9 +143,9 @@ xpccut_errprint
    if (gs_Allow_Output)
    {
       if (cut_is_nullptr(message))
-         fprintf(stderr, "? xpccut_errprint(): %s\n", _("null pointer"));
+         xpccut_print_error("? xpccut_errprint(): %s\n", _("null pointer"));
       else
-         fprintf(stderr, "? %s\n", message);    /* one uniform format   */
+         xpccut_print_error("? %s\n", message);  /* one uniform format   */
    }
 }
 
@@ -154,9 +172,12 @@ xpccut_errprint_ex
    if (gs_Allow_Output)
    {
       if (cut_not_nullptr_2(message, extra))
-         fprintf(stderr, "? %s: %s\n", extra, message);
+         xpccut_print_error("? %s: %s\n", extra, message);
       else
-         fprintf(stderr, "? xpccut_errprint_ex(): %s\n", _("null pointer(s)"));
+         xpccut_print_error
+         (
+            "? xpccut_errprint_ex(): %s\n", _("null pointer(s)")
+         );
    }
 }
 
@@ -185,9 +206,12 @@ xpccut_errprint_3
    if (gs_Allow_Output)
    {
       if (cut_not_nullptr_3(message, funcname, extra))
-         fprintf(stderr, "? %s: %s, %s\n", extra, message, funcname);
+         xpccut_print_error("? %s: %s, %s\n", extra, message, funcname);
       else
-         fprintf(stderr, "? xpccut_errprint_ex(): %s\n", _("null pointer(s)"));
+         xpccut_print_error
+         (
+            "? xpccut_errprint_ex(): %s\n", _("null pointer(s)")
+         );
    }
 }
 
@@ -214,9 +238,9 @@ xpccut_infoprint
    if (gs_Allow_Output)
    {
       if (cut_not_nullptr(message))
-         fprintf(stdout, "  %s\n", message);
+         xpccut_print("  %s\n", message);
       else
-         fprintf(stderr, "? xpccut_infoprint(): %s\n", _("null pointer(s)"));
+         xpccut_print_error("? xpccut_infoprint(): %s\n", _("null pointer(s)"));
    }
 }
 
@@ -243,9 +267,12 @@ xpccut_infoprint_ex
    if (gs_Allow_Output)
    {
       if (cut_not_nullptr_2(message, extra))
-         fprintf(stdout, "  %s: %s\n", extra, message);
+         xpccut_print("  %s: %s\n", extra, message);
       else
-         fprintf(stderr, "? xpccut_infoprint_ex(): %s\n", _("null pointer(s)"));
+         xpccut_print_error
+         (
+            "? xpccut_infoprint_ex(): %s\n", _("null pointer(s)")
+         );
    }
 }
 
@@ -357,6 +384,7 @@ xpccut_stringcopy
  *    keystroke/Enter combination.  The character (if any) is returned.
  *    An empty or null response is not accepted.  However, if a
  *    carriage-return or line feed is all that is found, a null is returned.
+ *    The output buffer is flushed first, so that the prompt can be seen.
  *
  * \warning
  *    This function is easy to break by tinkering with the code.
@@ -377,6 +405,7 @@ xpccut_get_response (void)
 {
    char result = '\x00';
    int r;
+   xpccut_output_flush();                 /* show the prompt first         */
    do
    {
       r = getchar();
@@ -715,121 +744,516 @@ xpccut_time_difference_ms
 }
 
 /**
- *    Used by xpccut_stopwatch_start() and other stopwatch functions.
+ *    Obtains the current monotonic time, in nanoseconds.
+ *
+ *    On POSIX systems that have it, clock_gettime(CLOCK_MONOTONIC) is used.
+ *    On Linux it is serviced by the vDSO from the processor's time-stamp
+ *    counter, so it costs only a few tens of nanoseconds, and it is already
+ *    calibrated by the kernel.  On Win32, QueryPerformanceCounter() is
+ *    used, and its count is converted to nanoseconds without overflow by
+ *    scaling the whole seconds and the remainder separately.  Otherwise,
+ *    gettimeofday() is the fall-back, with only microsecond resolution and
+ *    no protection against changes to the clock.
+ *
+ * \return
+ *    Returns the current tick value.  If the clock could not be read, an
+ *    error is shown and 0 is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_33()
  */
 
-static cbool_t g_xpccut_stopwatch_started = false;
+xpccut_ticks_t
+xpccut_get_ticks (void)
+{
+   xpccut_ticks_t result = 0;
+
+#if defined WIN32                                        /* Win32             */
+
+   static LARGE_INTEGER gm_frequency =                   /* tick frequency    */
+   {
+      .u = { 0, 0 }
+   };
+   LARGE_INTEGER t;
+   if (gm_frequency.QuadPart == 0)                       /* first call?       */
+   {
+      if (! QueryPerformanceFrequency(&gm_frequency))
+      {
+         gm_frequency.QuadPart = 0;
+         xpccut_errprint_3_func
+         (
+            _("calibration failed"), "QueryPerformanceFrequency()"
+         );
+      }
+   }
+   if (gm_frequency.QuadPart != 0)
+   {
+      if (QueryPerformanceCounter(&t))
+      {
+         xpccut_ticks_t f = (xpccut_ticks_t) gm_frequency.QuadPart;
+         xpccut_ticks_t q = (xpccut_ticks_t) t.QuadPart;
+         result = (q / f) * 1000000000ULL + (q % f) * 1000000000ULL / f;
+      }
+      else
+         xpccut_errprint_3_func(_("failed"), "QueryPerformanceCounter()");
+   }
+
+#elif XPC_HAVE_CLOCK_GETTIME && defined CLOCK_MONOTONIC  /* POSIX             */
+
+   struct timespec ts;
+   int errcode = clock_gettime(CLOCK_MONOTONIC, &ts);
+   if (is_posix_error(errcode))
+      xpccut_errprint_3_func(_("failed"), "clock_gettime()");
+   else
+   {
+      result = (xpccut_ticks_t) ts.tv_sec * 1000000000ULL;
+      result += (xpccut_ticks_t) ts.tv_nsec;
+   }
+
+#else                                                    /* fall-back         */
+
+   struct timeval tv;
+   if (xpccut_get_microseconds(&tv))
+   {
+      result = (xpccut_ticks_t) tv.tv_sec * 1000000000ULL;
+      result += (xpccut_ticks_t) tv.tv_usec * 1000ULL;
+   }
+
+#endif                                                   /* Win32/POSIX       */
+
+   return result;
+}
 
 /**
- *    Used by xpccut_stopwatch_start() and other stopwatch functions.
+ *    Provides the time difference between two tick values in milliseconds,
+ *    keeping the fraction of a millisecond.
+ *
+ * \return
+ *    Returns the difference between the two times ("t2 - t1") in
+ *    milliseconds.  If \a t2 is earlier than \a t1, which can happen only
+ *    with the gettimeofday() fall-back, 0.0 is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_33()
  */
 
-static struct timeval g_xpccut_stopwatch_start_time;
+double
+xpccut_ticks_difference_ms
+(
+   xpccut_ticks_t t1,      /**< The earlier tick value.                       */
+   xpccut_ticks_t t2       /**< The later tick value.                         */
+)
+{
+   double result = 0.0;
+   if (t2 > t1)
+      result = (double) (t2 - t1) / (double) XPCCUT_TICKS_PER_MS;
+
+   return result;
+}
 
 /**
- *    Used by xpccut_stopwatch_start() and other stopwatch functions.
+ *    Sets up a stopwatch structure, which is not yet started.
+ *
+ * \return
+ *    Returns 'true' if the stopwatch pointer is valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_34()
  */
 
-static struct timeval g_xpccut_stopwatch_lap_time;
+cbool_t
+xpccut_stopwatch_init
+(
+   xpccut_stopwatch_t * sw       /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t result = xpccut_thisptr(sw);
+   if (result)
+   {
+      int lap;
+      sw->m_Started     = false;
+      sw->m_Start_Ticks = 0;
+      sw->m_Lap_Ticks   = 0;
+      sw->m_Lap_Count   = 0;
+      for (lap = 0; lap < XPCCUT_STOPWATCH_LAPS; ++lap)
+         sw->m_Laps_ms[lap] = 0.0;
+   }
+   return result;
+}
 
 /**
- *    Starts a single-threaded stopwatch with microsecond resolution.
- *    This function first gets that start time using xpccut_get_microseconds().
- *    Then it sets the lap time to this time.  Finally, a "stopwatch
- *    started" flag is set to true.
+ *    Starts, or restarts, a stopwatch.  The start time and lap time are
+ *    set to the current time, and the history of laps is cleared.
  *
- *    The xpccut_stopwatch_start(), xpccut_stopwatch_duration(), and
- *    xpccut_stopwatch_lap() functions provide a global timer so that the call
- *    doesn't even have to know about struct timeval.  The "duration"
- *    function gets the current time and returns the difference between it
- *    and the start time, in seconds.  The "lap" function returns the time
- *    between the previous lap time and now.
+ * \return
+ *    Returns 'true' if the stopwatch pointer is valid.
  *
- *    Please note that these functions are not thread-safe, since the start
- *    and lap times are stored in a static variable.  Access them only with
- *    a single thread.  They are meant mostly for testing and for the
- *    evaluation of algorithms.
+ * \unittests
+ *    -  unit_unit_test_02_34()
+ */
+
+cbool_t
+xpccut_stopwatch_begin
+(
+   xpccut_stopwatch_t * sw       /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t result = xpccut_stopwatch_init(sw);
+   if (result)
+   {
+      sw->m_Start_Ticks = xpccut_get_ticks();
+      sw->m_Lap_Ticks = sw->m_Start_Ticks;
+      sw->m_Started = true;
+   }
+   return result;
+}
+
+/**
+ *    Provides the total time elapsed since a stopwatch was started.  The
+ *    stopwatch is not changed, so this function can be called as often as
+ *    needed.
  *
- *    We could provide an optional structure parameter to make this function
- *    thread-safe, if the need becomes evident.
+ * \return
+ *    Returns the time since xpccut_stopwatch_begin(), in milliseconds.  If
+ *    the stopwatch is not valid, or has not been started, 0.0 is returned.
  *
  * \unittests
- *    -  None.
+ *    -  unit_unit_test_02_34()
  */
 
-void
-xpccut_stopwatch_start (void)
+double
+xpccut_stopwatch_elapsed
+(
+   const xpccut_stopwatch_t * sw /**< The "this" pointer for this function.   */
+)
 {
-   xpccut_get_microseconds(&g_xpccut_stopwatch_start_time);
-   g_xpccut_stopwatch_lap_time = g_xpccut_stopwatch_start_time;
-   g_xpccut_stopwatch_started = true;
+   double result = 0.0;
+   if (xpccut_thisptr(sw))
+   {
+      if (sw->m_Started)
+      {
+         result = xpccut_ticks_difference_ms
+         (
+            sw->m_Start_Ticks, xpccut_get_ticks()
+         );
+      }
+   }
+   return result;
 }
 
 /**
- *    Provides the total time elapsed since the start time.
- *
- *    This function gets the current time with xpccut_get_microseconds(),
- *    and then it returns the difference between the end time (current time)
- *    and the start time using the xpccut_time_difference_ms() function.
+ *    Takes the next lap time of a stopwatch, which is the time since the
+ *    previous lap, or since the start for the first lap.  The lap time is
+ *    added to the history of the stopwatch.
  *
  * \return
- *    The duration since the start time of the stopwatch is returned, in
- *    units of milliseconds.
+ *    Returns the lap time, in milliseconds.  If the stopwatch is not
+ *    valid, or has not been started, 0.0 is returned and no lap is taken.
  *
  * \unittests
- *    -  None.
+ *    -  unit_unit_test_02_34()
  */
 
 double
-xpccut_stopwatch_duration (void)
+xpccut_stopwatch_next_lap
+(
+   xpccut_stopwatch_t * sw       /**< The "this" pointer for this function.   */
+)
 {
    double result = 0.0;
-   if (g_xpccut_stopwatch_started)
+   if (xpccut_thisptr(sw))
    {
-      struct timeval end_time;
-      xpccut_get_microseconds(&end_time);
-      result = xpccut_time_difference_ms
-      (
-         g_xpccut_stopwatch_start_time, end_time
-      );
+      if (sw->m_Started)
+      {
+         xpccut_ticks_t now = xpccut_get_ticks();
+         result = xpccut_ticks_difference_ms(sw->m_Lap_Ticks, now);
+         sw->m_Lap_Ticks = now;
+         sw->m_Laps_ms[sw->m_Lap_Count % XPCCUT_STOPWATCH_LAPS] = result;
+         ++sw->m_Lap_Count;
+      }
    }
    return result;
 }
 
 /**
- *    Returns the time difference between the current call to
- *    xpccut_stopwatch_lap() and the previous call to it.
+ * \getter sw->m_Lap_Count
  *
- *    This function gets the current time with xpccut_get_microseconds(),
- *    and then it returns the difference between the end time (current time)
- *    and the last lap time using the xpccut_time_difference() function.
+ * \return
+ *    Returns the number of laps taken since the stopwatch was started.
+ *    If the stopwatch is not valid, 0 is returned.
  *
- *    Then the old lap time is updated with the current time in anticipation
- *    of the next call to xpccut_stopwatch_lap().  To increase the accuracy
- *    a little bit, the new lap time is obtained by another call to
- *    xpccut_get_microseconds().
+ * \unittests
+ *    -  unit_unit_test_02_34()
+ */
+
+int
+xpccut_stopwatch_lap_count
+(
+   const xpccut_stopwatch_t * sw /**< The "this" pointer for this function.   */
+)
+{
+   int result = 0;
+   if (xpccut_thisptr(sw))
+      result = sw->m_Lap_Count;
+
+   return result;
+}
+
+/**
+ *    Looks up one of the laps of a stopwatch.  Only the last
+ *    XPCCUT_STOPWATCH_LAPS laps are kept.
  *
  * \return
- *    Returns the difference in microseconds between the current call to
+ *    Returns the time of the given lap, in milliseconds.  If the stopwatch
+ *    is not valid, or the lap has not been taken or has been dropped, -1.0
+ *    is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_34()
+ */
+
+double
+xpccut_stopwatch_lap_ms
+(
+   const xpccut_stopwatch_t * sw,   /**< The "this" pointer for this function.*/
+   int lap                          /**< The lap to get, counting from 0.     */
+)
+{
+   double result = -1.0;
+   if (xpccut_thisptr(sw))
+   {
+      if (lap >= 0 && lap < sw->m_Lap_Count)
+      {
+         if (lap >= sw->m_Lap_Count - XPCCUT_STOPWATCH_LAPS)
+            result = sw->m_Laps_ms[lap % XPCCUT_STOPWATCH_LAPS];
+      }
+   }
+   return result;
+}
+
+/**
+ *    The stopwatch used by xpccut_stopwatch_start() and the other global
+ *    stopwatch functions.  Each thread has its own, so that threads timing
+ *    at the same time do not disturb each other.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_stopwatch_t gs_xpccut_stopwatch;
+
+/**
+ *    Starts the global stopwatch with nanosecond resolution.  It is an
+ *    xpccut_stopwatch_t, started with xpccut_stopwatch_begin().
+ *
+ *    The xpccut_stopwatch_start(), xpccut_stopwatch_duration(), and
+ *    xpccut_stopwatch_lap() functions provide a global timer so that the
+ *    caller doesn't even have to know about the stopwatch structure.  The
+ *    "duration" function gets the current time and returns the difference
+ *    between it and the start time, in milliseconds.  The "lap" function
+ *    returns the time between the previous lap time and now.
+ *
+ *    There is only one such stopwatch per thread, so nested timers must
+ *    use their own xpccut_stopwatch_t instead.  If the compiler does not
+ *    support thread-local storage (see XPCCUT_THREAD_LOCAL), there is only
+ *    one for the whole process, and it must be used by a single thread.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_33()
+ */
+
+void
+xpccut_stopwatch_start (void)
+{
+   (void) xpccut_stopwatch_begin(&gs_xpccut_stopwatch);
+}
+
+/**
+ *    Provides the total time elapsed since the start time of the global
+ *    stopwatch.  See xpccut_stopwatch_elapsed().
+ *
+ * \return
+ *    The duration since the start time of the stopwatch is returned, in
+ *    units of milliseconds, including the fraction of a millisecond.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_33()
+ */
+
+double
+xpccut_stopwatch_duration (void)
+{
+   return xpccut_stopwatch_elapsed(&gs_xpccut_stopwatch);
+}
+
+/**
+ *    Returns the time difference between the current call to
+ *    xpccut_stopwatch_lap() and the previous call to it.  See
+ *    xpccut_stopwatch_next_lap().
+ *
+ * \return
+ *    Returns the difference in milliseconds between the current call to
  *    xpccut_stopwatch_lap(), and the last call [or to
  *    xpccut_stopwatch_start() if there was no previous call to
  *    xpccut_stopwatch_lap().
  *
  * \unittests
- *    -  None.
+ *    -  unit_unit_test_02_33()
  */
 
 double
 xpccut_stopwatch_lap (void)
 {
-   double result = 0.0;
-   if (g_xpccut_stopwatch_started)
+   return xpccut_stopwatch_next_lap(&gs_xpccut_stopwatch);
+}
+
+/**
+ *    Converts a Win32 FILETIME, in units of 100 ns, to milliseconds.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for xpccut_get_resources().
+ */
+
+#if defined WIN32
+
+static double
+xpccut_filetime_ms
+(
+   const FILETIME * ft     /**< The time to convert, assumed valid.           */
+)
+{
+   ULARGE_INTEGER t;
+   t.u.LowPart = ft->dwLowDateTime;
+   t.u.HighPart = ft->dwHighDateTime;
+   return (double) t.QuadPart / 10000.0;
+}
+
+#endif
+
+/**
+ *    Takes a sample of the resources used so far by the calling thread.
+ *
+ *    On POSIX systems, getrusage() is used, with RUSAGE_THREAD where it is
+ *    available (Linux), so that tests run side by side by the --jobs option
+ *    are measured separately.  Elsewhere RUSAGE_SELF is used, which
+ *    measures the whole process.  On Win32, only the CPU times are
+ *    available, from GetThreadTimes(); the other counts are left at zero.
+ *
+ * \return
+ *    Returns 'true' if the pointer was valid and the sample was taken.
+ *    Otherwise, \a r is zeroed, if valid, and 'false' is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_35()
+ */
+
+cbool_t
+xpccut_get_resources
+(
+   xpccut_resources_t * r     /**< The structure to receive the sample.       */
+)
+{
+   cbool_t result = cut_not_nullptr(r);
+   if (result)
    {
-      struct timeval end_time;
-      xpccut_get_microseconds(&end_time);
-      result = xpccut_time_difference_ms(g_xpccut_stopwatch_lap_time, end_time);
-      xpccut_get_microseconds(&g_xpccut_stopwatch_lap_time);
+#if defined WIN32
+      FILETIME created, ended, kernel, user;
+#elif XPC_HAVE_GETRUSAGE
+      struct rusage ru;
+      int errcode;
+#endif
+
+      r->m_User_ms = r->m_System_ms = 0.0;
+      r->m_Max_RSS_kb = r->m_Minor_Faults = r->m_Major_Faults = 0;
+      r->m_Voluntary_Switches = r->m_Involuntary_Switches = 0;
+
+#if defined WIN32
+
+      result = GetThreadTimes
+      (
+         GetCurrentThread(), &created, &ended, &kernel, &user
+      ) != 0;
+      if (result)
+      {
+         r->m_User_ms = xpccut_filetime_ms(&user);
+         r->m_System_ms = xpccut_filetime_ms(&kernel);
+      }
+      else
+         xpccut_errprint_3_func(_("failed"), "GetThreadTimes()");
+
+#elif XPC_HAVE_GETRUSAGE
+
+#if defined RUSAGE_THREAD
+      errcode = getrusage(RUSAGE_THREAD, &ru);
+#else
+      errcode = getrusage(RUSAGE_SELF, &ru);
+#endif
+      result = ! is_posix_error(errcode);
+      if (result)
+      {
+         r->m_User_ms = ru.ru_utime.tv_sec * 1000.0 +
+            ru.ru_utime.tv_usec / 1000.0;
+
+         r->m_System_ms = ru.ru_stime.tv_sec * 1000.0 +
+            ru.ru_stime.tv_usec / 1000.0;
+
+         r->m_Max_RSS_kb = ru.ru_maxrss;
+         r->m_Minor_Faults = ru.ru_minflt;
+         r->m_Major_Faults = ru.ru_majflt;
+         r->m_Voluntary_Switches = ru.ru_nvcsw;
+         r->m_Involuntary_Switches = ru.ru_nivcsw;
+      }
+      else
+         xpccut_errprint_3_func(_("failed"), "getrusage()");
+
+#else
+
+      result = false;                           /* no way to measure them  */
+
+#endif
    }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Provides the resources used between two samples taken by
+ *    xpccut_get_resources().  Each value of \a delta is "r2 - r1",
+ *    including m_Max_RSS_kb, which is then the growth of the peak resident
+ *    set between the samples.
+ *
+ * \return
+ *    Returns 'true' if the pointers were valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_35()
+ */
+
+cbool_t
+xpccut_resources_difference
+(
+   const xpccut_resources_t * r1,   /**< The earlier sample.                  */
+   const xpccut_resources_t * r2,   /**< The later sample.                    */
+   xpccut_resources_t * delta       /**< The structure to receive r2 - r1.    */
+)
+{
+   cbool_t result = cut_not_nullptr_3(r1, r2, delta);
+   if (result)
+   {
+      delta->m_User_ms = r2->m_User_ms - r1->m_User_ms;
+      delta->m_System_ms = r2->m_System_ms - r1->m_System_ms;
+      delta->m_Max_RSS_kb = r2->m_Max_RSS_kb - r1->m_Max_RSS_kb;
+      delta->m_Minor_Faults = r2->m_Minor_Faults - r1->m_Minor_Faults;
+      delta->m_Major_Faults = r2->m_Major_Faults - r1->m_Major_Faults;
+      delta->m_Voluntary_Switches =
+         r2->m_Voluntary_Switches - r1->m_Voluntary_Switches;
+
+      delta->m_Involuntary_Switches =
+         r2->m_Involuntary_Switches - r1->m_Involuntary_Switches;
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
    return result;
 }
 
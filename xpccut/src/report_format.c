@@ -0,0 +1,499 @@
+/**
+ * \file          report_format.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the writers of the machine-readable reports.  Also see the
+ *    report_format.h module.
+ *
+ *    Each writer formats one record into the report channel of the output
+ *    layer.  The --jobs workers capture that channel along with the rest of
+ *    their output, so the records come out in the order the tests were
+ *    loaded, just like the console output.
+ */
+
+#include <xpc/report_format.h>         /* unit_test_report_format_t, etc.     */
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* strcmp(), strcspn()                 */
+#endif
+
+/**
+ *    Selects the escaping done by xpccut_report_escape().
+ */
+
+typedef enum
+{
+   XPCCUT_ESCAPE_XML,      /**< XML attribute values.                         */
+   XPCCUT_ESCAPE_JSON,     /**< JSON strings.                                 */
+   XPCCUT_ESCAPE_TAP       /**< TAP test descriptions.                        */
+
+} xpccut_report_escape_t;
+
+/**
+ *    Writes a string to the report, escaped for the given format.  Runs of
+ *    characters that need no escaping are written in one piece.  A null
+ *    string is written as an empty one.
+ *
+ *    Control characters cannot appear in XML 1.0 at all, and would break
+ *    a TAP line, so they are written as spaces in those formats.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+xpccut_report_escape
+(
+   xpccut_report_escape_t style,    /**< The kind of escaping to be done.     */
+   const char * text                /**< The string to be written.            */
+)
+{
+   static const char * const s_Special [] =
+   {
+      "<>&\"'"                         /* XPCCUT_ESCAPE_XML                   */
+      "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+      "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f",
+      "\"\\"                           /* XPCCUT_ESCAPE_JSON                  */
+      "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+      "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f",
+      "#\\"                            /* XPCCUT_ESCAPE_TAP                   */
+      "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+      "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+   };
+   if (cut_not_nullptr(text))
+   {
+      const char * special = s_Special[style];
+      while (*text != 0)
+      {
+         int run = (int) strcspn(text, special);
+         if (run > 0)
+         {
+            xpccut_output_write(XPCCUT_OUTPUT_REPORT, text, run);
+            text += run;
+         }
+         if (*text != 0)
+         {
+            unsigned char c = (unsigned char) *text++;
+            if (style == XPCCUT_ESCAPE_XML)
+            {
+               const char * entity = " ";
+               if (c == '<')
+                  entity = "&lt;";
+               else if (c == '>')
+                  entity = "&gt;";
+               else if (c == '&')
+                  entity = "&amp;";
+               else if (c == '"')
+                  entity = "&quot;";
+               else if (c == '\'')
+                  entity = "&apos;";
+
+               xpccut_output_write(XPCCUT_OUTPUT_REPORT, entity, -1);
+            }
+            else if (style == XPCCUT_ESCAPE_JSON)
+            {
+               if (c == '"' || c == '\\')
+                  xpccut_output_printf(XPCCUT_OUTPUT_REPORT, "\\%c", c);
+               else
+                  xpccut_output_printf(XPCCUT_OUTPUT_REPORT, "\\u%04x", c);
+            }
+            else if (c == '#' || c == '\\')
+               xpccut_output_printf(XPCCUT_OUTPUT_REPORT, "\\%c", c);
+            else
+               xpccut_output_write(XPCCUT_OUTPUT_REPORT, " ", 1);
+         }
+      }
+   }
+}
+
+/**
+ *    Writes the "GG.CC.SS case: sub-test" name of a record, which is used
+ *    as the test name by the JUnit and TAP reports.  The sub-test part is
+ *    left off for a record that is not for a sub-test.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+xpccut_report_name
+(
+   xpccut_report_escape_t style,    /**< The kind of escaping to be done.     */
+   const xpccut_report_record_t * record  /**< The record to be named.        */
+)
+{
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT, "%02d.%02d.%02d ",
+      record->m_Group, record->m_Case, record->m_Subtest
+   );
+   xpccut_report_escape(style, record->m_Case_Name);
+   if (cut_not_nullptr(record->m_Subtest_Name) && *record->m_Subtest_Name)
+   {
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, ": ", 2);
+      xpccut_report_escape(style, record->m_Subtest_Name);
+   }
+}
+
+/**
+ *    Writes the start of a report.  For JUnit, this is the XML declaration
+ *    and the opening tags; for TAP, it is the version line.  JSON Lines has
+ *    no header.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05()
+ */
+
+void
+xpccut_report_begin
+(
+   unit_test_report_format_t format,   /**< The format of the report.         */
+   const char * name                   /**< The name of the test application. */
+)
+{
+   if (format == XPCCUT_REPORT_JUNIT)
+   {
+      xpccut_output_write
+      (
+         XPCCUT_OUTPUT_REPORT,
+         "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites name=\"", -1
+      );
+      xpccut_report_escape(XPCCUT_ESCAPE_XML, name);
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, "\">\n<testsuite name=\"", -1);
+      xpccut_report_escape(XPCCUT_ESCAPE_XML, name);
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, "\">\n", -1);
+   }
+   else if (format == XPCCUT_REPORT_TAP)
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, "TAP version 13\n", -1);
+}
+
+/**
+ *    Writes the record of one sub-test as a JUnit \<testcase\> element.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+xpccut_report_junit
+(
+   const xpccut_report_record_t * record  /**< The result to be written.      */
+)
+{
+   xpccut_output_write(XPCCUT_OUTPUT_REPORT, "<testcase classname=\"", -1);
+   xpccut_report_escape(XPCCUT_ESCAPE_XML, record->m_Group_Name);
+   xpccut_output_write(XPCCUT_OUTPUT_REPORT, "\" name=\"", -1);
+   xpccut_report_name(XPCCUT_ESCAPE_XML, record);
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT, "\" time=\"%.6f\"", record->m_Duration_ms / 1000.0
+   );
+   if (strcmp(record->m_Disposition, "passed") == 0)
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, "/>\n", -1);
+   else if (strcmp(record->m_Disposition, "cached") == 0)
+   {
+      xpccut_output_write
+      (
+         XPCCUT_OUTPUT_REPORT,
+         "><system-out>cached</system-out></testcase>\n", -1
+      );
+   }
+   else if (strcmp(record->m_Disposition, "skipped") == 0)
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, "><skipped/></testcase>\n", -1);
+   else
+   {
+      xpccut_output_printf
+      (
+         XPCCUT_OUTPUT_REPORT,
+         "><failure message=\"%s, %d errors\"/></testcase>\n",
+         record->m_Disposition, record->m_Error_Count
+      );
+   }
+}
+
+/**
+ *    Writes the record of one sub-test as a line of JSON.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+xpccut_report_jsonl
+(
+   const xpccut_report_record_t * record  /**< The result to be written.      */
+)
+{
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT, "{\"group\":%d,\"group_name\":\"", record->m_Group
+   );
+   xpccut_report_escape(XPCCUT_ESCAPE_JSON, record->m_Group_Name);
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT, "\",\"case\":%d,\"case_name\":\"", record->m_Case
+   );
+   xpccut_report_escape(XPCCUT_ESCAPE_JSON, record->m_Case_Name);
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT, "\",\"subtest\":%d,\"subtest_name\":\"",
+      record->m_Subtest
+   );
+   xpccut_report_escape(XPCCUT_ESCAPE_JSON, record->m_Subtest_Name);
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT,
+      "\",\"disposition\":\"%s\",\"duration_ms\":%.3f,\"errors\":%d}\n",
+      record->m_Disposition, record->m_Duration_ms, record->m_Error_Count
+   );
+}
+
+/**
+ *    Writes the record of one sub-test as a TAP test line, followed by a
+ *    YAML block that holds the details.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+xpccut_report_tap
+(
+   const xpccut_report_record_t * record  /**< The result to be written.      */
+)
+{
+   cbool_t passed = strcmp(record->m_Disposition, "passed") == 0 ||
+      strcmp(record->m_Disposition, "cached") == 0;
+
+   cbool_t skipped = strcmp(record->m_Disposition, "skipped") == 0;
+   xpccut_output_write
+   (
+      XPCCUT_OUTPUT_REPORT, (passed || skipped) ? "ok - " : "not ok - ", -1
+   );
+   xpccut_report_escape(XPCCUT_ESCAPE_TAP, record->m_Group_Name);
+   xpccut_output_write(XPCCUT_OUTPUT_REPORT, " ", 1);
+   xpccut_report_name(XPCCUT_ESCAPE_TAP, record);
+   if (skipped)
+      xpccut_output_write(XPCCUT_OUTPUT_REPORT, " # SKIP", -1);
+
+   xpccut_output_printf
+   (
+      XPCCUT_OUTPUT_REPORT,
+      "\n  ---\n  disposition: %s\n  duration_ms: %.3f\n  errors: %d\n"
+      "  ...\n",
+      record->m_Disposition, record->m_Duration_ms, record->m_Error_Count
+   );
+}
+
+/**
+ *    Writes the record of one sub-test to the report.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05()
+ */
+
+void
+xpccut_report_record
+(
+   unit_test_report_format_t format,      /**< The format of the report.      */
+   const xpccut_report_record_t * record  /**< The result to be written.      */
+)
+{
+   if (cut_not_nullptr(record) && cut_not_nullptr(record->m_Disposition))
+   {
+      if (format == XPCCUT_REPORT_JUNIT)
+         xpccut_report_junit(record);
+      else if (format == XPCCUT_REPORT_JSONL)
+         xpccut_report_jsonl(record);
+      else if (format == XPCCUT_REPORT_TAP)
+         xpccut_report_tap(record);
+   }
+}
+
+/**
+ *    Writes the summary of the runs of one test, after a --repeat run, as
+ *    one more record.  The record gives the test, and a disposition of
+ *    "passed" or "failed"; the sub-test fields are not used.  JUnit gets
+ *    the counts and the durations as the properties of a \<testcase\>,
+ *    JSON Lines as more members of the object, and TAP in the YAML block.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_33()
+ */
+
+void
+xpccut_report_repeats
+(
+   unit_test_report_format_t format,      /**< The format of the report.      */
+   const xpccut_report_record_t * record, /**< The test that was repeated.    */
+   const xpccut_report_repeats_t * repeats   /**< The runs of the test.       */
+)
+{
+   if
+   (
+      cut_not_nullptr_2(record, repeats) &&
+      cut_not_nullptr(record->m_Disposition)
+   )
+   {
+      xpccut_report_record_t test = *record;
+      test.m_Subtest = 0;
+      test.m_Subtest_Name = "";
+      if (format == XPCCUT_REPORT_JUNIT)
+      {
+         xpccut_output_write
+         (
+            XPCCUT_OUTPUT_REPORT, "<testcase classname=\"", -1
+         );
+         xpccut_report_escape(XPCCUT_ESCAPE_XML, test.m_Group_Name);
+         xpccut_output_write(XPCCUT_OUTPUT_REPORT, "\" name=\"", -1);
+         xpccut_report_name(XPCCUT_ESCAPE_XML, &test);
+         xpccut_output_printf
+         (
+            XPCCUT_OUTPUT_REPORT,
+            "\" time=\"%.6f\"><properties>"
+            "<property name=\"runs\" value=\"%d\"/>"
+            "<property name=\"failures\" value=\"%d\"/>"
+            "<property name=\"min_ms\" value=\"%.3f\"/>"
+            "<property name=\"mean_ms\" value=\"%.3f\"/>"
+            "<property name=\"max_ms\" value=\"%.3f\"/></properties>",
+            repeats->m_Mean_ms / 1000.0, repeats->m_Runs,
+            repeats->m_Failures, repeats->m_Min_ms, repeats->m_Mean_ms,
+            repeats->m_Max_ms
+         );
+         if (repeats->m_Failures > 0)
+         {
+            xpccut_output_printf
+            (
+               XPCCUT_OUTPUT_REPORT,
+               "<failure message=\"%d of %d runs failed\"/>",
+               repeats->m_Failures, repeats->m_Runs
+            );
+         }
+         xpccut_output_write(XPCCUT_OUTPUT_REPORT, "</testcase>\n", -1);
+      }
+      else if (format == XPCCUT_REPORT_JSONL)
+      {
+         xpccut_output_printf
+         (
+            XPCCUT_OUTPUT_REPORT, "{\"group\":%d,\"group_name\":\"",
+            test.m_Group
+         );
+         xpccut_report_escape(XPCCUT_ESCAPE_JSON, test.m_Group_Name);
+         xpccut_output_printf
+         (
+            XPCCUT_OUTPUT_REPORT, "\",\"case\":%d,\"case_name\":\"",
+            test.m_Case
+         );
+         xpccut_report_escape(XPCCUT_ESCAPE_JSON, test.m_Case_Name);
+         xpccut_output_printf
+         (
+            XPCCUT_OUTPUT_REPORT,
+            "\",\"disposition\":\"%s\",\"runs\":%d,\"failures\":%d,"
+            "\"min_ms\":%.3f,\"mean_ms\":%.3f,\"max_ms\":%.3f}\n",
+            test.m_Disposition, repeats->m_Runs, repeats->m_Failures,
+            repeats->m_Min_ms, repeats->m_Mean_ms, repeats->m_Max_ms
+         );
+      }
+      else if (format == XPCCUT_REPORT_TAP)
+      {
+         xpccut_output_write
+         (
+            XPCCUT_OUTPUT_REPORT,
+            repeats->m_Failures == 0 ? "ok - " : "not ok - ", -1
+         );
+         xpccut_report_escape(XPCCUT_ESCAPE_TAP, test.m_Group_Name);
+         xpccut_output_write(XPCCUT_OUTPUT_REPORT, " ", 1);
+         xpccut_report_name(XPCCUT_ESCAPE_TAP, &test);
+         xpccut_output_printf
+         (
+            XPCCUT_OUTPUT_REPORT,
+            "\n  ---\n  disposition: %s\n  runs: %d\n  failures: %d\n"
+            "  min_ms: %.3f\n  mean_ms: %.3f\n  max_ms: %.3f\n  ...\n",
+            test.m_Disposition, repeats->m_Runs, repeats->m_Failures,
+            repeats->m_Min_ms, repeats->m_Mean_ms, repeats->m_Max_ms
+         );
+      }
+   }
+}
+
+/**
+ *    Writes the end of a report.  For JUnit, this is the closing tags; for
+ *    TAP, it is the plan, which may come at the end because the number of
+ *    sub-tests is not known until they have run.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05()
+ */
+
+void
+xpccut_report_end
+(
+   unit_test_report_format_t format,   /**< The format of the report.         */
+   int count                           /**< The number of records written.    */
+)
+{
+   if (format == XPCCUT_REPORT_JUNIT)
+   {
+      xpccut_output_write
+      (
+         XPCCUT_OUTPUT_REPORT, "</testsuite>\n</testsuites>\n", -1
+      );
+   }
+   else if (format == XPCCUT_REPORT_TAP)
+      xpccut_output_printf(XPCCUT_OUTPUT_REPORT, "1..%d\n", count);
+}
+
+/**
+ *    Provides the name of the report file used when the --report-file
+ *    option is not given.
+ *
+ * \return
+ *    Returns "unit_test_report" plus the usual extension for the format,
+ *    or null for XPCCUT_REPORT_NONE.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_38()
+ */
+
+const char *
+xpccut_report_default_file
+(
+   unit_test_report_format_t format    /**< The format of the report.         */
+)
+{
+   const char * result = nullptr;
+   if (format == XPCCUT_REPORT_JUNIT)
+      result = "unit_test_report.xml";
+   else if (format == XPCCUT_REPORT_JSONL)
+      result = "unit_test_report.jsonl";
+   else if (format == XPCCUT_REPORT_TAP)
+      result = "unit_test_report.tap";
+
+   return result;
+}
+
+/*
+ * report_format.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
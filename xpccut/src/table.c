@@ -0,0 +1,493 @@
+/**
+ * \file          table.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the tables of data-driven tests.  Also see the table.h
+ *    module.
+ *
+ *    As with the corpus files of the fuzzers, a table file is mapped into
+ *    memory where mmap() is available, and read with one fread()
+ *    otherwise.  The lines are found as the table is walked, so opening a
+ *    table costs the same whatever its size, and the pages of a large file
+ *    are only read in when their records are reached.
+ */
+
+#include <xpc/table.h>                 /* xpccut_table_t, etc.                */
+#include <xpc/portable_subset.h>       /* xpccut_errprint_func()              */
+
+#if XPC_HAVE_LIMITS_H
+#include <limits.h>                    /* LONG_MAX                            */
+#endif
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fopen(), fread(), etc.              */
+#endif
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* malloc() and free()                 */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* memchr(), memcmp(), memset()        */
+#endif
+
+/**
+ *    Indicates that table files are mapped into memory.  This requires
+ *    open(), fstat(), and mmap().
+ */
+
+#if XPC_HAVE_FCNTL_H && XPC_HAVE_SYS_MMAN_H && XPC_HAVE_SYS_STAT_H && \
+ XPC_HAVE_UNISTD_H && ! defined WIN32
+#define XPCCUT_USE_MMAP 1
+#include <fcntl.h>                     /* open()                              */
+#include <sys/mman.h>                  /* mmap(), madvise(), and munmap()     */
+#include <sys/stat.h>                  /* fstat()                             */
+#else
+#define XPCCUT_USE_MMAP 0
+#endif
+
+/**
+ *    Loads a table file for reading.  The file is mapped for reading from
+ *    front to back, which is how the records are walked.
+ *
+ * \param [out] table
+ *    The table to set up.  It must later be passed to xpccut_table_close(),
+ *    even if this function fails.
+ *
+ * \param filename
+ *    The name of the file, which also names the table.  Only the pointer is
+ *    kept, so the name must last as long as the table.
+ *
+ * \return
+ *    Returns 'true' if the file was loaded.  Unlike a corpus file, a
+ *    missing table file is an error.  An empty file is a table with no
+ *    records.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_table_open
+(
+   xpccut_table_t * table,
+   const char * filename
+)
+{
+   cbool_t result = cut_not_nullptr_2(table, filename);
+   if (result)
+   {
+      (void) memset(table, 0, sizeof *table);
+      table->m_Name = filename;
+      result = false;
+
+#if XPCCUT_USE_MMAP
+
+      int fd = open(filename, O_RDONLY);
+      if (fd >= 0)
+      {
+         struct stat info;
+         result = fstat(fd, &info) == 0;
+         if (result)
+         {
+            table->m_Size = (long long) info.st_size;
+            if (table->m_Size > 0)
+            {
+               void * data = mmap
+               (
+                  nullptr, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0
+               );
+               result = data != MAP_FAILED;
+               if (result)
+               {
+#if defined MADV_SEQUENTIAL
+                  (void) madvise(data, (size_t) info.st_size, MADV_SEQUENTIAL);
+#endif
+                  table->m_Data = (const char *) data;
+                  table->m_Is_Mapped = true;
+               }
+            }
+         }
+         (void) close(fd);
+      }
+
+#else
+
+      FILE * f = fopen(filename, "rb");
+      if (cut_not_nullptr(f))
+      {
+         long size = -1;
+         if (fseek(f, 0, SEEK_END) == 0)
+            size = ftell(f);
+
+         result = size >= 0 && fseek(f, 0, SEEK_SET) == 0;
+         if (result && size > 0)
+         {
+            char * data = malloc((size_t) size);
+            result = cut_not_nullptr(data);
+            if (result)
+            {
+               table->m_Data = data;
+               table->m_Size = (long long) size;
+               result = fread(data, 1, (size_t) size, f) == (size_t) size;
+            }
+         }
+         (void) fclose(f);
+      }
+
+#endif
+
+      if (! result)
+         xpccut_errprint_ex(_("cannot read table file"), filename);
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Sets up a table whose records are the strings of an array in the test
+ *    source, one record per string.  No string is skipped, not even an
+ *    empty one, and a string can hold any text, even a newline.
+ *
+\verbatim
+      static const char * const s_rows[] = { "1 2 3", "2 3 5", "-1 1 0" };
+      xpccut_table_t table;
+      (void) xpccut_table_init_rows(&table, "sums", s_rows, 3);
+\endverbatim
+ *
+ * \param [out] table
+ *    The table to set up.
+ *
+ * \param name
+ *    The name of the table, which names its sub-tests.  Only the pointer is
+ *    kept.
+ *
+ * \param rows
+ *    The strings, which are not copied, and must last as long as the table.
+ *
+ * \param count
+ *    The number of strings.
+ *
+ * \return
+ *    Returns 'true' if the parameters were valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_table_init_rows
+(
+   xpccut_table_t * table,
+   const char * name,
+   const char * const * rows,
+   int count
+)
+{
+   cbool_t result = cut_not_nullptr_2(table, name);
+   if (result)
+   {
+      (void) memset(table, 0, sizeof *table);
+      result = count == 0 || (count > 0 && cut_not_nullptr(rows));
+      if (result)
+      {
+         table->m_Name = name;
+         table->m_Rows = rows;
+         table->m_Row_Count = count;
+      }
+      else
+         xpccut_errprint_func(_("bad rows or count"));
+   }
+   else
+      xpccut_errprint_func(_("null pointer"));
+
+   return result;
+}
+
+/**
+ *    Releases a table.  The records it gave out can no longer be used.
+ *
+ * \param table
+ *    The table.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+void
+xpccut_table_close (xpccut_table_t * table)
+{
+   if (cut_not_nullptr(table))
+   {
+      if (cut_not_nullptr(table->m_Data))
+      {
+#if XPCCUT_USE_MMAP
+         if (table->m_Is_Mapped)
+            (void) munmap((void *) table->m_Data, (size_t) table->m_Size);
+         else
+#endif
+            free((void *) table->m_Data);
+      }
+      (void) memset(table, 0, sizeof *table);
+   }
+}
+
+/**
+ * \getter table->m_Name
+ *
+ * \return
+ *    Returns the name of the table, or null if the table is null or was
+ *    never set up.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+const char *
+xpccut_table_name (const xpccut_table_t * table)
+{
+   return cut_not_nullptr(table) ? table->m_Name : nullptr ;
+}
+
+/**
+ *    Moves a record to the next record of a table.
+ *
+\verbatim
+      xpccut_record_t record = XPCCUT_RECORD_INIT;
+      while (xpccut_table_next(&table, &record))
+         use(record.m_Text, record.m_Length);
+\endverbatim
+ *
+ * \param table
+ *    The table.
+ *
+ * \param [in,out] record
+ *    The record before the one wanted, or XPCCUT_RECORD_INIT for the first
+ *    record.  It receives the next record.
+ *
+ * \return
+ *    Returns 'true' if there was another record.  At the end of the table,
+ *    'false' is returned, and the record is left as it was.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_table_next
+(
+   const xpccut_table_t * table,
+   xpccut_record_t * record
+)
+{
+   cbool_t result = cut_not_nullptr_2(table, record);
+   if (result)
+   {
+      if (cut_not_nullptr(table->m_Rows))
+      {
+         int index = record->m_Number;
+         result = index < table->m_Row_Count;
+         if (result)
+         {
+            const char * row = table->m_Rows[index];
+            record->m_Text = cut_not_nullptr(row) ? row : "" ;
+            record->m_Length = (int) strlen(record->m_Text);
+            record->m_Number = index + 1;
+            record->m_Line = index + 1;
+         }
+      }
+      else
+      {
+         const char * end = table->m_Data + table->m_Size;
+         const char * p = table->m_Data;
+         int line = record->m_Line;
+         result = false;
+         if (cut_not_nullptr(record->m_Text))
+         {
+            p = record->m_Text + record->m_Length;
+            if (p < end && *p == '\r')
+               ++p;
+
+            if (p < end && *p == '\n')
+               ++p;
+         }
+         while (! result && cut_not_nullptr(p) && p < end)
+         {
+            const char * newline = memchr(p, '\n', (size_t) (end - p));
+            const char * stop = cut_not_nullptr(newline) ? newline : end ;
+            const char * next = cut_not_nullptr(newline) ? newline + 1 : end ;
+            ++line;
+            if (stop > p && stop[-1] == '\r')
+               --stop;
+
+            if (stop > p && *p != '#')
+            {
+               record->m_Text = p;
+               record->m_Length = (int) (stop - p);
+               record->m_Number++;
+               record->m_Line = line;
+               result = true;
+            }
+            else
+               p = next;
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Finds a field of a record.  The fields are separated by spaces or
+ *    tabs, and the field points into the record, so nothing is copied.
+ *
+ * \param record
+ *    The record.
+ *
+ * \param index
+ *    The index of the field, re 0.
+ *
+ * \param [out] field
+ *    Receives the field, with the numbers of the record.
+ *
+ * \return
+ *    Returns 'true' if the record has that many fields.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_record_field
+(
+   const xpccut_record_t * record,
+   int index,
+   xpccut_record_t * field
+)
+{
+   cbool_t result = cut_not_nullptr_2(record, field) && index >= 0;
+   if (result)
+   {
+      const char * p = record->m_Text;
+      const char * end = p + record->m_Length;
+      int count = -1;
+      const char * start = nullptr;
+      result = false;
+      while (! result && cut_not_nullptr(p) && p < end)
+      {
+         while (p < end && (*p == ' ' || *p == '\t'))
+            ++p;
+
+         start = p;
+         while (p < end && *p != ' ' && *p != '\t')
+            ++p;
+
+         if (p > start)
+            result = ++count == index;
+      }
+      if (result)
+      {
+         *field = *record;
+         field->m_Text = start;
+         field->m_Length = (int) (p - start);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Converts a field to a long integer, without copying it.  The field is
+ *    an optional sign followed by decimal digits, and nothing else.
+ *
+ * \param field
+ *    The field, as given by xpccut_record_field(), or a whole record.
+ *
+ * \param [out] value
+ *    Receives the value.
+ *
+ * \return
+ *    Returns 'true' if the field is a number that fits in a long.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_record_long
+(
+   const xpccut_record_t * field,
+   long * value
+)
+{
+   cbool_t result = cut_not_nullptr_2(field, value) && field->m_Length > 0;
+   if (result)
+   {
+      const char * p = field->m_Text;
+      const char * end = p + field->m_Length;
+      cbool_t negative = *p == '-';
+      unsigned long limit = negative ?
+         (unsigned long) LONG_MAX + 1UL : (unsigned long) LONG_MAX ;
+
+      unsigned long magnitude = 0;
+      if (*p == '-' || *p == '+')
+         ++p;
+
+      result = p < end;
+      while (result && p < end)
+      {
+         unsigned long digit = (unsigned long) (*p - '0');
+         result = *p >= '0' && *p <= '9' &&
+            magnitude <= (limit - digit) / 10UL;
+
+         if (result)
+            magnitude = magnitude * 10UL + digit;
+
+         ++p;
+      }
+      if (result)
+      {
+         *value = negative ?
+            (long) (0UL - magnitude) : (long) magnitude ;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Compares a field, or a record, with a string.
+ *
+ * \return
+ *    Returns 'true' if the field holds exactly the text of the string.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ */
+
+cbool_t
+xpccut_record_equals
+(
+   const xpccut_record_t * field,
+   const char * text
+)
+{
+   cbool_t result = cut_not_nullptr_2(field, text);
+   if (result)
+   {
+      size_t length = strlen(text);
+      result = (size_t) field->m_Length == length &&
+         (length == 0 || memcmp(field->m_Text, text, length) == 0);
+   }
+   return result;
+}
+
+/*
+ * table.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
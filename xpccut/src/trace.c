@@ -0,0 +1,503 @@
+/**
+ * \file          trace.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the trace buffer and its export to the trace event format of
+ *    Chrome.  Also see the trace.h module.
+ *
+ *    Only the thread that owns a ring writes to it.  It fills in the next
+ *    event, and then publishes it by storing the new count of events with
+ *    release ordering; the writer of the trace loads the count with acquire
+ *    ordering, and so sees only events that are complete.  A ring that
+ *    wraps while it is being written out can still yield a torn event, so
+ *    the trace is best written when the threads are done, as the runner
+ *    does.  The list of rings only grows, by a compare-and-swap at its
+ *    head.
+ *
+ *    Where the compiler provides no atomic operations, the stores are
+ *    plain ones, which is good enough for a single thread.
+ */
+
+#include <xpc/alloc_count.h>           /* xpccut_alloc_pause(), etc.          */
+#include <xpc/trace.h>                 /* xpccut_trace_enter(), etc.          */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* calloc()                            */
+#endif
+
+/**
+ *    Publishes and reads the counts of events of a ring, the head of the
+ *    list of rings, and the flag that turns the trace on, and swaps that
+ *    head.
+ */
+
+#if defined __GNUC__ && defined __ATOMIC_ACQUIRE
+#define XPCCUT_TRACE_PUBLISH(x, v)  __atomic_store_n(&(x), v, __ATOMIC_RELEASE)
+#define XPCCUT_TRACE_LOAD(x)        __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define XPCCUT_TRACE_CAS(p, o, n)   __sync_bool_compare_and_swap(p, o, n)
+#elif defined __GNUC__
+#define XPCCUT_TRACE_PUBLISH(x, v)  do { __sync_synchronize(); (x) = (v); } \
+                                       while (0)
+#define XPCCUT_TRACE_LOAD(x)        (__sync_synchronize(), (x))
+#define XPCCUT_TRACE_CAS(p, o, n)   __sync_bool_compare_and_swap(p, o, n)
+#else
+#define XPCCUT_TRACE_PUBLISH(x, v)  ((x) = (v))
+#define XPCCUT_TRACE_LOAD(x)        (x)
+#define XPCCUT_TRACE_CAS(p, o, n)   (*(p) = (n), true)
+#endif
+
+/**
+ *    Holds the events of one thread.
+ */
+
+typedef struct xpccut_trace_ring
+{
+   /**
+    *    The ring of the thread that started to record before this one, or
+    *    null.
+    */
+
+   struct xpccut_trace_ring * m_Next;
+
+   /**
+    *    The number of the thread, counting from 1 in the order in which the
+    *    threads started to record.  It is the "tid" of the events.
+    */
+
+   int m_Number;
+
+   /**
+    *    The number of events ever recorded in the ring.  The next event
+    *    goes at this count, modulo XPCCUT_TRACE_EVENTS.
+    */
+
+   unsigned long long m_Written;
+
+   /**
+    *    The value of m_Written when the trace was last cleared.  The events
+    *    before it are not written out.  It is set by any thread, so it is
+    *    read and set through XPCCUT_TRACE_LOAD() and XPCCUT_TRACE_PUBLISH().
+    */
+
+   unsigned long long m_Cleared;
+
+   /**
+    *    The events.
+    */
+
+   xpccut_trace_event_t m_Events[XPCCUT_TRACE_EVENTS];
+
+} xpccut_trace_ring_t;
+
+/**
+ *    Provides the list of rings, the newest first.
+ */
+
+static xpccut_trace_ring_t * volatile gs_Trace_Rings = nullptr;
+
+/**
+ *    Indicates that the events are to be recorded.  Any thread can read it
+ *    while another one turns the trace on or off, so it is read and set
+ *    through XPCCUT_TRACE_LOAD() and XPCCUT_TRACE_PUBLISH().
+ */
+
+static volatile cbool_t gs_Trace_Enabled = false;
+
+/**
+ *    Provides the ring of the calling thread, or null if it has not
+ *    recorded anything yet.
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_trace_ring_t * gs_Trace_Ring = nullptr;
+
+/**
+ *    Allocates the ring of the calling thread, and links it into the list.
+ *    The ring is not counted against the test that happens to make it.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the new ring, or null if the memory ran out.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08() [indirect test]
+ */
+
+static xpccut_trace_ring_t *
+xpccut_trace_new_ring (void)
+{
+   xpccut_trace_ring_t * result;
+   xpccut_alloc_pause();
+   result = calloc(1, sizeof(xpccut_trace_ring_t));
+   xpccut_alloc_resume();
+   if (cut_not_nullptr(result))
+   {
+      xpccut_trace_ring_t * head;
+      do
+      {
+         head = XPCCUT_TRACE_LOAD(gs_Trace_Rings);
+         result->m_Next = head;
+         result->m_Number = cut_not_nullptr(head) ? head->m_Number + 1 : 1 ;
+
+      } while (! XPCCUT_TRACE_CAS(&gs_Trace_Rings, head, result));
+
+      gs_Trace_Ring = result;
+   }
+   else
+      xpccut_errprint_func(_("trace buffer allocation failed"));
+
+   return result;
+}
+
+/**
+ *    Records an event in the ring of the calling thread.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08() [indirect test]
+ */
+
+static void
+xpccut_trace_record
+(
+   const char * name,               /**< The name of the scope.               */
+   int phase                        /**< An xpccut_trace_phase_t.             */
+)
+{
+   xpccut_trace_ring_t * ring = gs_Trace_Ring;
+   if (cut_is_nullptr(ring))
+      ring = xpccut_trace_new_ring();
+
+   if (cut_not_nullptr(ring))
+   {
+      unsigned long long n = ring->m_Written;   /* only this thread writes  */
+      xpccut_trace_event_t * e =
+         &ring->m_Events[n & (XPCCUT_TRACE_EVENTS - 1)];
+
+      e->m_Ticks = xpccut_get_ticks();
+      e->m_Name = cut_not_nullptr(name) ? name : "???" ;
+      e->m_Phase = phase;
+      XPCCUT_TRACE_PUBLISH(ring->m_Written, n + 1);
+   }
+}
+
+/**
+ *    Finds the events of a ring that are to be written out.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the count of the first event to write.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08() [indirect test]
+ */
+
+static unsigned long long
+xpccut_trace_range
+(
+   xpccut_trace_ring_t * ring,      /**< The ring, assumed valid.             */
+   unsigned long long * last        /**< Receives the count after the last.   */
+)
+{
+   unsigned long long result = XPCCUT_TRACE_LOAD(ring->m_Cleared);
+   *last = XPCCUT_TRACE_LOAD(ring->m_Written);
+   if (*last - result > XPCCUT_TRACE_EVENTS)
+      result = *last - XPCCUT_TRACE_EVENTS;
+
+   return result;
+}
+
+/**
+ *    Writes the name of an event as the contents of a JSON string.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08() [indirect test]
+ */
+
+static void
+xpccut_trace_write_name
+(
+   FILE * output,                   /**< The file, assumed valid.             */
+   const char * name                /**< The name, assumed valid.             */
+)
+{
+   for ( ; *name != 0; ++name)
+   {
+      unsigned char c = (unsigned char) *name;
+      if (c == '"' || c == '\\')
+         fprintf(output, "\\%c", c);
+      else if (c < 0x20)
+         fprintf(output, "\\u%04x", c);
+      else
+         fputc(c, output);
+   }
+}
+
+/**
+ *    Starts or stops the recording of events.  The events already recorded
+ *    are kept.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+void
+xpccut_trace_enable
+(
+   cbool_t flag                     /**< 'true' to record the events.         */
+)
+{
+   XPCCUT_TRACE_PUBLISH(gs_Trace_Enabled, flag);
+}
+
+/**
+ *    Indicates if the events are being recorded.
+ *
+ * \return
+ *    Returns 'true' if xpccut_trace_enable() turned the recording on.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+cbool_t
+xpccut_trace_is_enabled (void)
+{
+   return XPCCUT_TRACE_LOAD(gs_Trace_Enabled);
+}
+
+/**
+ *    Records the start of a scope in the calling thread, if the trace is
+ *    enabled.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+void
+xpccut_trace_enter
+(
+   const char * name                /**< The name, kept as a pointer.         */
+)
+{
+   if (XPCCUT_TRACE_LOAD(gs_Trace_Enabled))
+      xpccut_trace_record(name, XPCCUT_TRACE_ENTER);
+}
+
+/**
+ *    Records the end of a scope in the calling thread, if the trace is
+ *    enabled.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+void
+xpccut_trace_exit
+(
+   const char * name                /**< The name, kept as a pointer.         */
+)
+{
+   if (XPCCUT_TRACE_LOAD(gs_Trace_Enabled))
+      xpccut_trace_record(name, XPCCUT_TRACE_EXIT);
+}
+
+/**
+ *    Forgets the events recorded so far, in all of the threads.  The rings
+ *    are kept.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+void
+xpccut_trace_clear (void)
+{
+   xpccut_trace_ring_t * ring = XPCCUT_TRACE_LOAD(gs_Trace_Rings);
+   for ( ; cut_not_nullptr(ring); ring = ring->m_Next)
+   {
+      unsigned long long written = XPCCUT_TRACE_LOAD(ring->m_Written);
+      XPCCUT_TRACE_PUBLISH(ring->m_Cleared, written);
+   }
+}
+
+/**
+ *    Counts the events of the calling thread that would be written out.
+ *
+ * \return
+ *    Returns the number of events recorded since the trace was cleared,
+ *    up to XPCCUT_TRACE_EVENTS.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+int
+xpccut_trace_thread_count (void)
+{
+   int result = 0;
+   if (cut_not_nullptr(gs_Trace_Ring))
+   {
+      unsigned long long last;
+      unsigned long long first = xpccut_trace_range(gs_Trace_Ring, &last);
+      result = (int) (last - first);
+   }
+   return result;
+}
+
+/**
+ *    Counts the events, in all of the threads, that were overwritten
+ *    before they could be written out.
+ *
+ * \return
+ *    Returns the number of events lost since the trace was cleared.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+long long
+xpccut_trace_dropped (void)
+{
+   long long result = 0;
+   xpccut_trace_ring_t * ring = XPCCUT_TRACE_LOAD(gs_Trace_Rings);
+   for ( ; cut_not_nullptr(ring); ring = ring->m_Next)
+   {
+      unsigned long long cleared = XPCCUT_TRACE_LOAD(ring->m_Cleared);
+      unsigned long long last = XPCCUT_TRACE_LOAD(ring->m_Written);
+      if (last - cleared > XPCCUT_TRACE_EVENTS)
+         result += (long long) (last - XPCCUT_TRACE_EVENTS - cleared);
+   }
+   return result;
+}
+
+/**
+ *    Writes the events of all of the threads in the trace event format,
+ *    the JSON object format, which chrome://tracing and the Perfetto UI
+ *    load.  The time-stamps are in microseconds, with nanoseconds as the
+ *    fraction, counted from the earliest event.  The events of each thread
+ *    are written in the order they were recorded, under the number of the
+ *    thread as its "tid".
+ *
+ * \return
+ *    Returns the number of events written, or -1 if \a output is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+int
+xpccut_trace_write
+(
+   FILE * output                    /**< The open file to write to.           */
+)
+{
+   int result = -1;
+   if (cut_not_nullptr(output))
+   {
+      xpccut_ticks_t origin = 0;
+      cbool_t have_origin = false;
+      xpccut_trace_ring_t * ring = XPCCUT_TRACE_LOAD(gs_Trace_Rings);
+      for ( ; cut_not_nullptr(ring); ring = ring->m_Next)
+      {
+         unsigned long long last;
+         unsigned long long first = xpccut_trace_range(ring, &last);
+         if (first < last)
+         {
+            xpccut_ticks_t t =
+               ring->m_Events[first & (XPCCUT_TRACE_EVENTS - 1)].m_Ticks;
+
+            if (! have_origin || t < origin)
+               origin = t;
+
+            have_origin = true;
+         }
+      }
+      result = 0;
+      fprintf(output, "{\"traceEvents\":[\n");
+      ring = XPCCUT_TRACE_LOAD(gs_Trace_Rings);
+      for ( ; cut_not_nullptr(ring); ring = ring->m_Next)
+      {
+         unsigned long long last;
+         unsigned long long n = xpccut_trace_range(ring, &last);
+         for ( ; n < last; ++n)
+         {
+            const xpccut_trace_event_t * e =
+               &ring->m_Events[n & (XPCCUT_TRACE_EVENTS - 1)];
+
+            xpccut_ticks_t delta = e->m_Ticks > origin ?
+               e->m_Ticks - origin : 0 ;
+
+            fprintf(output, "%s{\"name\":\"", result > 0 ? ",\n" : "");
+            xpccut_trace_write_name(output, e->m_Name);
+            fprintf
+            (
+               output, "\",\"ph\":\"%c\",\"ts\":%llu.%03llu,"
+               "\"pid\":1,\"tid\":%d}",
+               e->m_Phase, delta / 1000ULL, delta % 1000ULL, ring->m_Number
+            );
+            ++result;
+         }
+      }
+      fprintf(output, "\n],\"displayTimeUnit\":\"ns\"}\n");
+   }
+   else
+      xpccut_errprint_func(_("null file pointer"));
+
+   return result;
+}
+
+/**
+ *    Writes the trace to a file, with xpccut_trace_write().
+ *
+ * \return
+ *    Returns 'true' if the file was written.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08()
+ */
+
+cbool_t
+xpccut_trace_export
+(
+   const char * filename            /**< The name of the file to write.       */
+)
+{
+   cbool_t result = cut_not_nullptr(filename);
+   if (result)
+   {
+      FILE * output = fopen(filename, "w");
+      result = cut_not_nullptr(output);
+      if (result)
+      {
+         result = xpccut_trace_write(output) >= 0;
+         if (fclose(output) != 0)
+            result = false;
+      }
+      else
+         xpccut_errprint_ex(_("could not open the trace file"), filename);
+   }
+   else
+      xpccut_errprint_func(_("null file name"));
+
+   return result;
+}
+
+/*
+ * trace.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
@@ -44,9 +44,14 @@
  *       Tests", by Alberto Savoia.
  */
 
+#include <xpc/fuzz.h>                  /* xpccut_rng_t for the --shuffle      */
 #include <xpc/unit_test.h>             /* unit_test_t structure & functions   */
 #include <xpc/unit_test_status.h>      /* unit_test_status_t functions        */
 
+#if XPC_HAVE_LIMITS_H
+#include <limits.h>                    /* INT_MAX                             */
+#endif
+
 #if XPC_HAVE_STRING_H
 #include <string.h>                    /* char * functions                    */
 #endif
@@ -55,6 +60,26 @@
 #include <stdio.h>                     /* fprintf() and stdout, stderr        */
 #endif
 
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#include <pthread.h>                   /* threads for the --jobs option       */
+#endif
+
+/**
+ *    Indicates that the --isolate option can run each test in a child
+ *    process.  This requires fork(), waitpid(), and poll().
+ */
+
+#if XPC_HAVE_UNISTD_H && XPC_HAVE_SYS_WAIT_H && XPC_HAVE_POLL_H && \
+ ! defined WIN32
+#define XPCCUT_USE_FORK 1
+#include <errno.h>                     /* errno and EINTR                     */
+#include <poll.h>                      /* poll() for the --isolate option     */
+#include <signal.h>                    /* kill() and SIGKILL                  */
+#include <sys/wait.h>                  /* waitpid() and the W macros          */
+#else
+#define XPCCUT_USE_FORK 0
+#endif
+
 /**
  *    Allocates the help string, and fills it with the provided text.
  *
@@ -134,7 +159,8 @@ unit_test_allocate_help
  *    The first time it is called, XPCCUT_CASE_ALLOCATION slots for
  *    unit_test_func_t pointers are allocated.
  *    Every time it is called thereafter, the array is reallocated for
- *    another XPCCUT_CASE_ALLOCATION worth of pointers.
+ *    another XPCCUT_CASE_ALLOCATION worth of pointers.  The m_Test_Info
+ *    array is allocated and reallocated along with it.
  *
  *    This function takes pains to avoid orphaned memory.
  *
@@ -170,7 +196,15 @@ unit_test_allocate_cases
             tests->m_Allocation_Count = XPCCUT_CASE_ALLOCATION;
             casesize = tests->m_Allocation_Count * sizeof(unit_test_func_t);
             tests->m_Test_Cases = malloc(casesize);
-            if (cut_is_nullptr(tests->m_Test_Cases))
+            tests->m_Test_Info = malloc
+            (
+               tests->m_Allocation_Count * sizeof(unit_test_info_t)
+            );
+            if
+            (
+               cut_is_nullptr(tests->m_Test_Cases) ||
+               cut_is_nullptr(tests->m_Test_Info)
+            )
             {
                xpccut_errprint_func(_("failed"));
                result = false;
@@ -188,7 +222,16 @@ unit_test_allocate_cases
             tests->m_Allocation_Count += XPCCUT_CASE_ALLOCATION;
             casesize = tests->m_Allocation_Count * sizeof(unit_test_func_t);
             tests->m_Test_Cases = realloc(tests->m_Test_Cases, casesize);
-            if (cut_is_nullptr(tests->m_Test_Cases))
+            tests->m_Test_Info = realloc
+            (
+               tests->m_Test_Info,
+               tests->m_Allocation_Count * sizeof(unit_test_info_t)
+            );
+            if
+            (
+               cut_is_nullptr(tests->m_Test_Cases) ||
+               cut_is_nullptr(tests->m_Test_Info)
+            )
             {
                xpccut_errprint_func(_("failed to reallocate case list"));
                result = false;
@@ -234,9 +277,15 @@ unit_test_init_cases
       if (cut_not_nullptr(tests->m_Test_Cases))
          free(tests->m_Test_Cases);
 
+      if (cut_not_nullptr(tests->m_Test_Info))
+         free(tests->m_Test_Info);
+
       tests->m_Test_Cases           = nullptr;
+      tests->m_Test_Info            = nullptr;
       tests->m_Total_Errors         =  0;
       tests->m_Current_Test_Number  = XPCCUT_NO_CURRENT_TEST;
+      tests->m_Order_Position       = XPCCUT_NO_CURRENT_TEST;
+      tests->m_Position_Limit       =  0;
       tests->m_Test_Count           =  0;
       tests->m_Subtest_Count        =  0;
       tests->m_Allocation_Count     =  0;
@@ -270,14 +319,119 @@ unit_test_pause
    if (unit_test_options_do_beep(&tests->m_App_Options))
       unit_test_status_beep();
 
-   fprintf
+   xpccut_print
    (
-      stdout, "\n  %s",
+      "\n  %s",
       _("press Enter to continue testing or Ctrl-C to end testing")
    );
    (void) xpccut_get_response();
 }
 
+/**
+ *    Clears the resource totals kept for the --profile option, the counter
+ *    totals kept for the --perf-counters option, and the leak list.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the unit-tests for the unit_test_init() and
+ *       unit_test_dispose_of_test() functions.
+ */
+
+static void
+unit_test_clear_profile
+(
+   unit_test_t * tests           /**< The "this" pointer, assumed valid.      */
+)
+{
+   xpccut_resources_t * total = &tests->m_Profile_Total;
+   int c;
+   total->m_User_ms = total->m_System_ms = 0.0;
+   total->m_Max_RSS_kb = total->m_Minor_Faults = total->m_Major_Faults = 0;
+   total->m_Voluntary_Switches = total->m_Involuntary_Switches = 0;
+   tests->m_Profile_Count = 0;
+   tests->m_Peak_RSS_Group = 0;
+   tests->m_Peak_RSS_Case = 0;
+   tests->m_Counter_Total.m_Is_Valid = false;
+   for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+   {
+      tests->m_Counter_Total.m_Have[c] = false;
+      tests->m_Counter_Total.m_Values[c] = 0;
+   }
+   tests->m_Counter_Count = 0;
+   tests->m_Leak_Count = 0;
+}
+
+/**
+ *    Adds the resources used by a test to the totals kept for the
+ *    --profile option.  The m_Max_RSS_kb value of the total is not a sum;
+ *    it is the largest growth of the peak resident set seen in one test,
+ *    and the group and case of that test are noted.  The hardware counts
+ *    of the test, if any, are added to the totals of the counters.  If
+ *    the test allocated more blocks than it freed, it is added to the leak
+ *    list.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the unit-tests for unit_test_dispose_of_test().
+ */
+
+static void
+unit_test_add_profile
+(
+   unit_test_t * tests,             /**< The "this" pointer, assumed valid.   */
+   const unit_test_status_t * status   /**< The status of a test that ran.   */
+)
+{
+   const xpccut_resources_t * r = unit_test_status_resources(status);
+   const xpccut_perf_values_t * v = unit_test_status_counters(status);
+   const xpccut_alloc_counts_t * a = unit_test_status_allocations(status);
+   if (cut_not_nullptr(a) && a->m_Allocations > a->m_Frees)
+   {
+      if (tests->m_Leak_Count < XPCCUT_LEAK_LIST_MAX)
+      {
+         unit_test_leak_t * leak = &tests->m_Leaks[tests->m_Leak_Count];
+         leak->m_Test_Group = unit_test_status_group(status);
+         leak->m_Test_Case = unit_test_status_case(status);
+         leak->m_Blocks = a->m_Allocations - a->m_Frees;
+         leak->m_Bytes = a->m_Bytes_Allocated - a->m_Bytes_Freed;
+      }
+      tests->m_Leak_Count++;
+   }
+   if (cut_not_nullptr(v))
+   {
+      xpccut_perf_values_t * total = &tests->m_Counter_Total;
+      int c;
+      for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+      {
+         if (tests->m_Counter_Count == 0)
+            total->m_Have[c] = v->m_Have[c];
+         else if (! v->m_Have[c])
+            total->m_Have[c] = false;
+
+         total->m_Values[c] += v->m_Values[c];
+      }
+      total->m_Is_Valid = true;
+      tests->m_Counter_Count++;
+   }
+   if (cut_not_nullptr(r))
+   {
+      xpccut_resources_t * total = &tests->m_Profile_Total;
+      total->m_User_ms += r->m_User_ms;
+      total->m_System_ms += r->m_System_ms;
+      total->m_Minor_Faults += r->m_Minor_Faults;
+      total->m_Major_Faults += r->m_Major_Faults;
+      total->m_Voluntary_Switches += r->m_Voluntary_Switches;
+      total->m_Involuntary_Switches += r->m_Involuntary_Switches;
+      if (r->m_Max_RSS_kb > total->m_Max_RSS_kb)
+      {
+         total->m_Max_RSS_kb = r->m_Max_RSS_kb;
+         tests->m_Peak_RSS_Group = unit_test_status_group(status);
+         tests->m_Peak_RSS_Case = unit_test_status_case(status);
+      }
+      tests->m_Profile_Count++;
+   }
+}
+
 /**
  *    Used by unit_test_init() and unit_test_initialize().
  *
@@ -309,12 +463,45 @@ unit_test_clear
       tests->m_First_Failed_Group            = 0;
       tests->m_First_Failed_Case             = 0;
       tests->m_First_Failed_Subtest          = 0;
+      (void) unit_test_status_init(&tests->m_First_Failed_Status);
       tests->m_Total_Errors                  = 0;
       tests->m_Test_Cases                    = nullptr;
+      tests->m_Test_Info                     = nullptr;
+      tests->m_Run_Count                     = 0;
+      tests->m_Cached_Count                  = 0;
+      tests->m_Shard_Map                     = nullptr;
+      tests->m_Durations_ms                  = nullptr;
+      tests->m_History                       = nullptr;
+      tests->m_Test_Order                    = nullptr;
+      tests->m_Schedule                      = nullptr;
+      tests->m_Order_Position                = XPCCUT_NO_CURRENT_TEST;
+      tests->m_Cache                         = nullptr;
+      tests->m_Round_Count                   = 1;
+      tests->m_Position_Limit                = 0;
+      tests->m_Window_Rounds                 = 1;
+      tests->m_Shuffle_Seed                  = 0;
+      tests->m_Shuffle_Orders                = nullptr;
+      tests->m_Shuffle_Ready                 = XPCCUT_NO_CURRENT_TEST;
+      tests->m_Repeats                       = nullptr;
+      tests->m_Baseline                      = nullptr;
+      tests->m_Baseline_Count                = 0;
       tests->m_Start_Time_us.tv_sec          = 0;
       tests->m_Start_Time_us.tv_usec         = 0;
       tests->m_End_Time_us.tv_sec            = 0;
       tests->m_End_Time_us.tv_usec           = 0;
+      tests->m_Start_Ticks                   = 0;
+      tests->m_End_Ticks                     = 0;
+      tests->m_Report_File                   = nullptr;
+      tests->m_Report_Previous               = nullptr;
+      tests->m_Report_Count                  = 0;
+      tests->m_Arena_Mark.m_Is_Set           = false;
+      tests->m_Trace_Name                    = nullptr;
+      xpccut_fixture_init(&tests->m_Fixtures);
+      tests->m_Fixture_Ready                 = XPCCUT_NO_CURRENT_TEST;
+      tests->m_Intern_Held                   = true;
+      xpccut_intern_acquire();               /* the names of the statuses   */
+      (void) xpccut_intern_table_init(&tests->m_Names);
+      unit_test_clear_profile(tests);
    }
    return result;
 }
@@ -358,6 +545,10 @@ unit_test_init
       result = unit_test_options_init(&tests->m_App_Options);
       if (result)
       {
+         (void) unit_test_options_names_set
+         (
+            &tests->m_App_Options, &tests->m_Names
+         );
          strncpy(tests->m_Test_Application_Name, _("No Name"), XPCCUT_NAMELEN);
       }
       if (result)
@@ -433,6 +624,10 @@ unit_test_initialize
       result = unit_test_options_init(&tests->m_App_Options);  /* do defaults */
       if (result)
       {
+         (void) unit_test_options_names_set
+         (
+            &tests->m_App_Options, &tests->m_Names
+         );
          result = unit_test_options_parse                      /* cmd line    */
          (
             &tests->m_App_Options, argc, argv, appname, appversion, addedhelp
@@ -516,6 +711,169 @@ unit_test_initialize
    return result;
 }
 
+/**
+ *    Frees the per-test arrays used for sharding and for the durations
+ *    file, and unhooks the shard map from the options.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_free_shards
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_Shard_Map))
+   {
+      free(tests->m_Shard_Map);
+      tests->m_Shard_Map = nullptr;
+   }
+   if (cut_not_nullptr(tests->m_Durations_ms))
+   {
+      free(tests->m_Durations_ms);
+      tests->m_Durations_ms = nullptr;
+   }
+   (void) unit_test_options_shard_map_set(&tests->m_App_Options, nullptr);
+}
+
+/**
+ *    Frees the per-test arrays used for the --history file and for the
+ *    order of the tests.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_free_history
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_History))
+   {
+      free(tests->m_History);
+      tests->m_History = nullptr;
+   }
+   if (cut_not_nullptr(tests->m_Test_Order))
+   {
+      free(tests->m_Test_Order);
+      tests->m_Test_Order = nullptr;
+   }
+   if (cut_not_nullptr(tests->m_Schedule))
+   {
+      free(tests->m_Schedule);
+      tests->m_Schedule = nullptr;
+   }
+}
+
+/**
+ *    Frees the per-test array used for the --cache-file.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_free_cache
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_Cache))
+   {
+      free(tests->m_Cache);
+      tests->m_Cache = nullptr;
+   }
+}
+
+/**
+ *    Frees the per-test arrays used for the --repeat and --shuffle options.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_free_rounds
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_Shuffle_Orders))
+   {
+      free(tests->m_Shuffle_Orders);
+      tests->m_Shuffle_Orders = nullptr;
+   }
+   if (cut_not_nullptr(tests->m_Repeats))
+   {
+      free(tests->m_Repeats);
+      tests->m_Repeats = nullptr;
+   }
+}
+
+/**
+ *    Frees the entries read from the --baseline file, and unhooks them
+ *    from the options.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_free_baseline
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_Baseline))
+   {
+      free(tests->m_Baseline);
+      tests->m_Baseline = nullptr;
+   }
+   tests->m_Baseline_Count = 0;
+   (void) unit_test_options_baseline_set(&tests->m_App_Options, nullptr, 0);
+}
+
+/**
+ *    Finishes the --report-format report, if one is being written, and
+ *    closes its file.  The report file of an outer run, if any, is put
+ *    back.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_post_loop().
+ */
+
+static void
+unit_test_close_report
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   if (cut_not_nullptr(tests->m_Report_File))
+   {
+      xpccut_report_end
+      (
+         unit_test_options_report_format(&tests->m_App_Options),
+         tests->m_Report_Count
+      );
+      if (xpccut_output_get_report_file() == tests->m_Report_File)
+         xpccut_output_set_report_file(tests->m_Report_Previous);
+
+      (void) fclose(tests->m_Report_File);
+      tests->m_Report_File = nullptr;
+      tests->m_Report_Previous = nullptr;
+   }
+}
+
 /**
  *    Removes any resources allocated by the "constructors" or other
  *    functions.
@@ -552,7 +910,109 @@ unit_test_destroy
          free(tests->m_Test_Cases);
          tests->m_Test_Cases = nullptr;
       }
+      if (cut_not_nullptr(tests->m_Test_Info))
+      {
+         free(tests->m_Test_Info);
+         tests->m_Test_Info = nullptr;
+      }
+      unit_test_free_shards(tests);
+      unit_test_free_history(tests);
+      unit_test_free_cache(tests);
+      unit_test_free_rounds(tests);
+      unit_test_free_baseline(tests);
+      unit_test_close_report(tests);
+      xpccut_fixture_destroy(&tests->m_Fixtures);
+      xpccut_test_arena_release();
+      xpccut_intern_table_destroy(&tests->m_Names);
+      if (tests->m_Intern_Held)
+      {
+         tests->m_Intern_Held = false;
+         xpccut_intern_release();
+      }
+   }
+}
+
+/**
+ *    Adds one test to the case-list, along with its group and case
+ *    information, reallocating the lists as needed.  This is the common
+ *    part of unit_test_load(), unit_test_register(), and the C++ loading
+ *    functions.
+ *
+ * \return
+ *    Returns 'true' if the lists could be grown, and the test was added.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_load() and
+ *       unit_test_register().
+ */
+
+static cbool_t
+unit_test_add_case
+(
+   unit_test_t * tests,          /**< The "this" pointer, assumed valid.      */
+   const unit_test_func_t test,  /**< The function to load, null for C++.     */
+   int testgroup,                /**< The group number, or 0 if unknown.      */
+   int testcase,                 /**< The case number, or 0 if unknown.       */
+   const char * groupname,       /**< The group name, or null if unknown.     */
+   const char * casename         /**< The case name, or null if unknown.      */
+)
+{
+   cbool_t result = true;
+   int count = tests->m_Test_Count;
+   if ((count + 1) > tests->m_Allocation_Count)
+      result = unit_test_allocate_cases(tests);
+
+   if (result)
+   {
+      unit_test_info_t * info = &tests->m_Test_Info[count];
+      info->m_Test_Group = testgroup;
+      info->m_Test_Case = testcase;
+      info->m_Group_Name = groupname;
+      info->m_Case_Name = casename;
+      info->m_Timeout = 0;
+      info->m_Is_Spread = false;
+      info->m_Is_Serial = false;
+      tests->m_Test_Cases[count++] = test;
+      tests->m_Test_Count = count;
+   }
+   return result;
+}
+
+/**
+ *    Checks the group and case information given to unit_test_register()
+ *    or unit_test_cpp_load_info().  The numbers must be the ones that the
+ *    test passes to unit_test_status_initialize().
+ *
+ * \return
+ *    Returns 'true' if the numbers are greater than 0, and the names are
+ *    not null.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_register().
+ */
+
+static cbool_t
+unit_test_check_info
+(
+   int testgroup,                /**< The group number of the test.           */
+   int testcase,                 /**< The case number of the test.            */
+   const char * groupname,       /**< The group name of the test.             */
+   const char * casename         /**< The case name of the test.              */
+)
+{
+   cbool_t result = (testgroup > 0) && (testcase > 0);
+   if (result)
+   {
+      result = cut_not_nullptr_2(groupname, casename);
+      if (! result)
+         xpccut_errprint_func(_("null group or case name"));
    }
+   else
+      xpccut_errprint_func(_("invalid test group or case number"));
+
+   return result;
 }
 
 /**
@@ -562,6 +1022,11 @@ unit_test_destroy
  *    succeeds, the internal test counter is incremented as an internal
  *    side-effect, and the value "true" is returned.
  *
+ *    The group and case of a test loaded this way are not known until the
+ *    test is called, so it is always called, even when the --group or
+ *    --case options will cause it to be skipped.  Use unit_test_register()
+ *    to avoid that.
+ *
  * \return
  *    Returns 'true' if the parameter was valid and all steps succeeded.
  *
@@ -586,17 +1051,7 @@ unit_test_load
    {
       result = cut_not_nullptr(test);
       if (result)
-      {
-         int count = tests->m_Test_Count;
-         if ((count + 1) > tests->m_Allocation_Count)
-            result = unit_test_allocate_cases(tests);
-
-         if (result)
-         {
-            tests->m_Test_Cases[count++] = test;
-            tests->m_Test_Count = count;
-         }
-      }
+         result = unit_test_add_case(tests, test, 0, 0, nullptr, nullptr);
       else
          xpccut_errprint_func(_("null test pointer"));
    }
@@ -604,60 +1059,438 @@ unit_test_load
 }
 
 /**
- *    Exposes incrementing the test count for use in wrapper libraries.
+ *    Loads a unit-test function pointer in the list of test cases, along
+ *    with the group number, case number, and names that the test passes to
+ *    unit_test_status_initialize().
+ *
+ *    With this information, unit_test_run() can decide if the --group,
+ *    --case, and --shard-index options allow the test to run before it
+ *    calls the test.  A test that is filtered out is never called, and
+ *    with the --summarize option, no test is called at all; the group and
+ *    case are listed from the information given here.  See
+ *    unit_test_skip_a_test().
+ *
+ *    Only the pointers to the names are stored, so the names must last as
+ *    long as the \a tests structure does.
  *
  * \return
- *    Returns 'true' if the parameter was valid and all steps succeeded.
+ *    Returns 'true' if the parameters were valid and all steps succeeded.
  *
  * \unittests
- *    -  unit_unit_test_04_06()
+ *    -  unit_unit_test_04_27()
  */
 
 cbool_t
-unit_test_cpp_load_count
+unit_test_register
 (
-   unit_test_t * tests           /**< The "this" pointer for this function.   */
+   unit_test_t * tests,          /**< The "this" pointer for this function.   */
+   const unit_test_func_t test,  /**< The unit-test function to load.         */
+   int testgroup,                /**< The group number used by the test.      */
+   int testcase,                 /**< The case number used by the test.       */
+   const char * groupname,       /**< The group name used by the test.        */
+   const char * casename         /**< The case name used by the test.         */
 )
 {
    cbool_t result = xpccut_thisptr(tests);
    if (result)
-      tests->m_Test_Count++;
+   {
+      result = cut_not_nullptr(test);
+      if (result)
+      {
+         result = unit_test_check_info
+         (
+            testgroup, testcase, groupname, casename
+         );
+      }
+      else
+         xpccut_errprint_func(_("null test pointer"));
 
+      if (result)
+      {
+         result = unit_test_add_case
+         (
+            tests, test, testgroup, testcase, groupname, casename
+         );
+      }
+   }
    return result;
 }
 
 /**
- *    This function handles the disposition of a test.
+ *    Loads a fixture for a test group.  The \a setup function is called
+ *    just before the first case of the group that is not skipped, and the
+ *    \a teardown function after the last case of the group is done.  The
+ *    cases get the state made by the setup from unit_test_fixture_data().
  *
- * \return
- *    Returns true if the user asked to quit.
+ *    Only the cases loaded by unit_test_register(), which gives the runner
+ *    their group numbers, share the fixture.  With the --isolate option,
+ *    each child process sets up a fixture of its own, since the children
+ *    share no memory, and tears it down before it exits.
  *
- * \sideeffect
- *    -  The pass/fail status of the test may be modified as a side-effect.
- *    -  This side-effect also has the side effect of incrementing
- *       unit_test_status_t.m_Subtest_Error_Count, if the fail status is set.
- *       This count could thus end up being a misleading value, so be
- *       careful!
+ * \return
+ *    Returns 'true' if the parameters were valid, and the group did not
+ *    already have a fixture.
  *
  * \unittests
- *    -  unit_unit_test_04_07()
+ *    -  unit_unit_test_04_29()
  */
 
 cbool_t
-unit_test_dispose
+unit_test_fixture
 (
-   unit_test_status_t * status         /**< The "this pointer" for status.    */
+   unit_test_t * tests,          /**< The "this" pointer for this function.   */
+   int testgroup,                /**< The group that shares the fixture.      */
+   unit_test_setup_func_t setup, /**< Makes the state the cases share.        */
+   unit_test_teardown_func_t teardown /**< Cleans up the state, or null.      */
 )
 {
-   cbool_t result = false;                      /* false means "do not quit"  */
-   cbool_t ok = xpccut_thisptr(status);
-   if (ok)
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
    {
-      switch (unit_test_status_disposition(status))
-      {
-      case XPCCUT_DISPOSITION_CONTINUE:
-
-         /*
+      result = xpccut_fixture_add
+      (
+         &tests->m_Fixtures, testgroup, setup, teardown
+      );
+   }
+   return result;
+}
+
+/**
+ *    Provides the state made by the setup function of the fixture of the
+ *    group of the running case.
+ *
+ * \return
+ *    Returns the pointer stored by the setup function, or null if the
+ *    group of the case has no fixture.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void *
+unit_test_fixture_data (void)
+{
+   return xpccut_fixture_data();
+}
+
+/**
+ *    Exposes incrementing the test count for use in wrapper libraries.
+ *    The wrapper keeps its own list of test functions, so no function is
+ *    stored here, but a slot in the case-list is still used, so that the
+ *    m_Test_Info list stays in step with the test count.
+ *
+ * \return
+ *    Returns 'true' if the parameter was valid and all steps succeeded.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_06()
+ */
+
+cbool_t
+unit_test_cpp_load_count
+(
+   unit_test_t * tests           /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+      result = unit_test_add_case(tests, nullptr, 0, 0, nullptr, nullptr);
+
+   return result;
+}
+
+/**
+ *    Exposes incrementing the test count, along with the group and case
+ *    information of the test, for use in wrapper libraries.  This function
+ *    is the counterpart of unit_test_register() for xpc::cut::load().
+ *
+ * \return
+ *    Returns 'true' if the parameters were valid and all steps succeeded.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_27()
+ */
+
+cbool_t
+unit_test_cpp_load_info
+(
+   unit_test_t * tests,          /**< The "this" pointer for this function.   */
+   int testgroup,                /**< The group number used by the test.      */
+   int testcase,                 /**< The case number used by the test.       */
+   const char * groupname,       /**< The group name used by the test.        */
+   const char * casename         /**< The case name used by the test.         */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+      result = unit_test_check_info(testgroup, testcase, groupname, casename);
+
+   if (result)
+   {
+      result = unit_test_add_case
+      (
+         tests, nullptr, testgroup, testcase, groupname, casename
+      );
+   }
+   return result;
+}
+
+/**
+ *    Gives the test loaded last a timeout of its own, which overrides the
+ *    --test-timeout value.  It is meant to be called right after
+ *    unit_test_register() or unit_test_load(), for a test that is known to
+ *    take longer (or much less time) than the rest.
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded, and \a timeout is from 0 to
+ *    XPCCUT_TIMEOUT_MAX.  A value of 0 puts the test back on the
+ *    --test-timeout value.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+cbool_t
+unit_test_load_timeout
+(
+   unit_test_t * tests,          /**< The "this" pointer for this function.   */
+   int timeout                   /**< The timeout of the test, in ms.         */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+   {
+      result = tests->m_Test_Count > 0;
+      if (! result)
+         xpccut_errprint_func(_("no test has been loaded"));
+   }
+   if (result)
+   {
+      result = timeout >= 0 && timeout <= XPCCUT_TIMEOUT_MAX;
+      if (result)
+         tests->m_Test_Info[tests->m_Test_Count - 1].m_Timeout = timeout;
+      else
+         xpccut_errprint_func(_("bad test timeout (ms)"));
+   }
+   return result;
+}
+
+/**
+ *    Marks the test loaded last as one whose sub-tests are spread among the
+ *    shards.  Such a test runs in every shard, with each shard taking every
+ *    --shard-count'th record of its tables, as given by
+ *    unit_test_status_next_record().  It is meant for a data-driven test
+ *    whose table is too large for one shard.
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_34()
+ */
+
+cbool_t
+unit_test_load_spread
+(
+   unit_test_t * tests           /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+   {
+      result = tests->m_Test_Count > 0;
+      if (result)
+         tests->m_Test_Info[tests->m_Test_Count - 1].m_Is_Spread = true;
+      else
+         xpccut_errprint_func(_("no test has been loaded"));
+   }
+   return result;
+}
+
+/**
+ *    Marks the test loaded last as one that must run alone.  When --jobs
+ *    runs the tests in a pool of workers, or --isolate runs them in more
+ *    than one child at a time, a serial test does not start until the
+ *    tests before it are done, and no other test starts until it is done.
+ *    It is meant for a test that silences printing, or that times itself.
+ *
+ * \return
+ *    Returns 'true' if a test has been loaded.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_35()
+ */
+
+cbool_t
+unit_test_load_serial
+(
+   unit_test_t * tests           /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+   {
+      result = tests->m_Test_Count > 0;
+      if (result)
+         tests->m_Test_Info[tests->m_Test_Count - 1].m_Is_Serial = true;
+      else
+         xpccut_errprint_func(_("no test has been loaded"));
+   }
+   return result;
+}
+
+/**
+ *    Indicates if a test was marked by unit_test_load_serial().
+ *
+ * \return
+ *    Returns 'true' if the test must run alone.  Returns 'false' if it
+ *    need not, or if the parameters are invalid.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_35()
+ */
+
+cbool_t
+unit_test_test_is_serial
+(
+   const unit_test_t * tests,    /**< The "this" pointer for this function.   */
+   int testnumber                /**< Index of the test, re 0.                */
+)
+{
+   cbool_t result = false;
+   if (xpccut_thisptr(tests))
+   {
+      if (testnumber >= 0 && testnumber < tests->m_Test_Count)
+         result = tests->m_Test_Info[testnumber].m_Is_Serial;
+   }
+   return result;
+}
+
+/**
+ *    Provides the timeout that applies to a test, which is the one given
+ *    by unit_test_load_timeout(), if any, or else the --test-timeout
+ *    value.
+ *
+ * \return
+ *    Returns the timeout in milliseconds, or 0 if the test can run as long
+ *    as it likes, or if the parameters are invalid.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+int
+unit_test_test_timeout
+(
+   const unit_test_t * tests,    /**< The "this" pointer for this function.   */
+   int testnumber                /**< Index of the test, re 0.                */
+)
+{
+   int result = 0;
+   if (xpccut_thisptr(tests))
+   {
+      if (testnumber >= 0 && testnumber < tests->m_Test_Count)
+      {
+         result = tests->m_Test_Info[testnumber].m_Timeout;
+         if (result == 0)
+            result = unit_test_options_test_timeout(&tests->m_App_Options);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Makes room in the case-list for at least \a count tests, in one
+ *    reallocation, so that loading a large, known number of tests does not
+ *    reallocate the lists over and over.  The size is rounded up to a
+ *    multiple of XPCCUT_CASE_ALLOCATION.
+ *
+ * \return
+ *    Returns 'true' if the parameters were valid, and the lists are now at
+ *    least \a count entries long.  If the reallocation fails, the lists are
+ *    left as they were.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_28()
+ */
+
+cbool_t
+unit_test_reserve
+(
+   unit_test_t * tests,          /**< The "this" pointer for this function.   */
+   int count                     /**< The number of tests to make room for.   */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+   {
+      result = (count >= 0) && cut_not_nullptr(tests->m_Test_Cases);
+      if (! result)
+         xpccut_errprint_func(_("bad count, or null case list"));
+   }
+   if (result && count > tests->m_Allocation_Count)
+   {
+      int slots = XPCCUT_CASE_ALLOCATION *
+         ((count + XPCCUT_CASE_ALLOCATION - 1) / XPCCUT_CASE_ALLOCATION);
+
+      unit_test_list_t cases = realloc
+      (
+         tests->m_Test_Cases, slots * sizeof(unit_test_func_t)
+      );
+      if (cut_not_nullptr(cases))
+      {
+         unit_test_info_t * info;
+         tests->m_Test_Cases = cases;
+         info = realloc(tests->m_Test_Info, slots * sizeof(unit_test_info_t));
+         if (cut_not_nullptr(info))
+         {
+            tests->m_Test_Info = info;
+            tests->m_Allocation_Count = slots;
+         }
+         else
+            result = false;
+      }
+      else
+         result = false;
+
+      if (! result)
+         xpccut_errprint_func(_("failed to reallocate case list"));
+   }
+   return result;
+}
+
+/**
+ *    This function handles the disposition of a test.
+ *
+ * \return
+ *    Returns true if the user asked to quit.
+ *
+ * \sideeffect
+ *    -  The pass/fail status of the test may be modified as a side-effect.
+ *    -  This side-effect also has the side effect of incrementing
+ *       unit_test_status_t.m_Subtest_Error_Count, if the fail status is set.
+ *       This count could thus end up being a misleading value, so be
+ *       careful!
+ *
+ * \unittests
+ *    -  unit_unit_test_04_07()
+ */
+
+cbool_t
+unit_test_dispose
+(
+   unit_test_status_t * status         /**< The "this pointer" for status.    */
+)
+{
+   cbool_t result = false;                      /* false means "do not quit"  */
+   cbool_t ok = xpccut_thisptr(status);
+   if (ok)
+   {
+      switch (unit_test_status_disposition(status))
+      {
+      case XPCCUT_DISPOSITION_CONTINUE:
+
+         /*
           * No changes to make, the tests should continue according to plan.
           */
 
@@ -915,388 +1748,3926 @@ unit_test_first_failed_subtest
 }
 
 /**
- *    Provides the initialization component of unit_test_run().
- *    This function is a helper function that is exposed so that a C++
- *    wrapper library won't have to reimplement the same functionality.
+ *    Provides the status of the first test that failed, as it was when the
+ *    test was disposed of.  Its failure log tells which checks failed, in
+ *    which threads, even for a test that ran in an --isolate child.
  *
  * \return
- *    Returns the number of tests that have been loaded.  The caller should
- *    not have to count the number of tests.
+ *    Returns a pointer to the status, or null if no test failed, or if the
+ *    parameter is invalid.
  *
  * \unittests
- *    -  unit_unit_test_04_17()
+ *    -  unit_unit_test_04_25()
  */
 
-int
-unit_test_run_init
+const unit_test_status_t *
+unit_test_first_failed_status
 (
-   unit_test_t * tests  /**< "this pointer" for this function, assumed valid. */
+   const unit_test_t * tests        /**< The "this pointer" for this test.    */
 )
 {
-   int length = 0;
+   const unit_test_status_t * result = nullptr;
    if (xpccut_thisptr(tests))
    {
-      length = tests->m_Test_Count;
-      if (length == 0)
-         xpccut_errprint_func(_("no unit tests loaded"));
-      else
-      {
-         tests->m_Current_Test_Number  = XPCCUT_NO_CURRENT_TEST;
-         tests->m_First_Failed_Test    =  0;
-         tests->m_First_Failed_Group   =  0;
-         tests->m_First_Failed_Case    =  0;
-         tests->m_First_Failed_Subtest =  0;
-         tests->m_Total_Errors         =  0;
-         if (unit_test_options_show_progress(&tests->m_App_Options))
-         {
-            fprintf
-            (
-               stdout,
-            "===============================================================\n"
-            "%s %s\n"
+      if (tests->m_Total_Errors > 0)
+         result = &tests->m_First_Failed_Status;
+   }
+   return result;
+}
+
+/**
+ *    Provides the number of tests that ran, rather than being skipped, in
+ *    the last call to unit_test_run() or xpc::cut::run().  With the
+ *    --shard-count option, this is the number of tests in the shard (less
+ *    any skipped by the --group or --case options).
+ *
+ * \return
+ *    Returns the value of m_Run_Count.  If the "this" pointer is null, then
+ *    XPCCUT_INVALID_PARAMETER is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_26()
+ */
+
+int
+unit_test_run_count
+(
+   const unit_test_t * tests        /**< The "this pointer" for this test.    */
+)
+{
+   int result = XPCCUT_INVALID_PARAMETER;
+   if (xpccut_thisptr(tests))
+      result = tests->m_Run_Count;
+
+   return result;
+}
+
+/**
+ *    Provides the number of tests that were reported as cached passes from
+ *    the --cache-file, rather than being run, in the last call to
+ *    unit_test_run() or xpc::cut::run().  They are not counted by
+ *    unit_test_run_count().
+ *
+ * \return
+ *    Returns the value of m_Cached_Count.  If the "this" pointer is null,
+ *    then XPCCUT_INVALID_PARAMETER is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_32()
+ */
+
+int
+unit_test_cached_count
+(
+   const unit_test_t * tests        /**< The "this pointer" for this test.    */
+)
+{
+   int result = XPCCUT_INVALID_PARAMETER;
+   if (xpccut_thisptr(tests))
+      result = tests->m_Cached_Count;
+
+   return result;
+}
+
+/**
+ *    Reads the --durations file written by unit_test_save_durations().
+ *    Each line holds a test number (re 1) and the duration of the test in
+ *    milliseconds.  Lines starting with '#' are comments.
+ *    If a test number appears more than once, as happens when the files
+ *    of several shards are concatenated, the last duration is used.
+ *
+ * \return
+ *    Returns the number of lines that were used.  Durations that were not
+ *    found are left at -1.0.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static int
+unit_test_read_durations
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   const char * filename,           /**< The file to be read, not null.       */
+   double * durations               /**< One entry per test, set to -1.0.     */
+)
+{
+   int result = 0;
+   FILE * f = fopen(filename, "r");
+   if (cut_not_nullptr(f))
+   {
+      char line[XPCCUT_STRLEN];
+      while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+      {
+         int testnumber;
+         double ms;
+         if (line[0] == '#')
+            continue;
+
+         if (sscanf(line, "%d %lf", &testnumber, &ms) == 2)
+         {
+            if
+            (
+               testnumber >= 1 && testnumber <= tests->m_Test_Count &&
+               ms >= 0.0
+            )
+            {
+               durations[testnumber - 1] = ms;
+               ++result;
+            }
+         }
+      }
+      fclose(f);
+   }
+   else
+      xpccut_errprint_ex(_("could not open durations file"), filename);
+
+   return result;
+}
+
+/**
+ *    Pairs a test number with its expected duration, for sorting in
+ *    unit_test_balance_shards(), or with another key, for sorting in
+ *    unit_test_sort_tests().
+ */
+
+typedef struct
+{
+   /**
+    *    The expected duration of the test, in milliseconds, or the key by
+    *    which the tests are sorted, the largest first.
+    */
+
+   double m_Duration_ms;
+
+   /**
+    *    The index of the test, re 0.
+    */
+
+   int m_Test_Number;
+
+} unit_test_shard_item_t;
+
+/**
+ *    Orders the tests longest first, and then by test number, so that
+ *    every node that reads the same durations file builds the same map.
+ *
+ * \return
+ *    Returns the usual qsort() comparison value.
+ */
+
+static int
+unit_test_shard_compare
+(
+   const void * a,                  /**< The first unit_test_shard_item_t.   */
+   const void * b                   /**< The second unit_test_shard_item_t.  */
+)
+{
+   const unit_test_shard_item_t * ia = (const unit_test_shard_item_t *) a;
+   const unit_test_shard_item_t * ib = (const unit_test_shard_item_t *) b;
+   int result;
+   if (ia->m_Duration_ms > ib->m_Duration_ms)
+      result = -1;
+   else if (ia->m_Duration_ms < ib->m_Duration_ms)
+      result = 1;
+   else
+      result = ia->m_Test_Number - ib->m_Test_Number;
+
+   return result;
+}
+
+/**
+ *    Builds m_Shard_Map for the "--shard-by duration" option.  The tests
+ *    are taken longest first, and each one goes to the shard with the
+ *    least total duration so far (the lowest-numbered such shard, on a
+ *    tie).  Tests with no recorded duration are given the mean of the
+ *    recorded ones, or 1 ms if there are none.
+ *
+ * \return
+ *    Returns 'true' if the map could be built.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static cbool_t
+unit_test_balance_shards
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   const double * durations         /**< One entry per test, -1.0 if unknown. */
+)
+{
+   int count = tests->m_Test_Count;
+   int shards = unit_test_options_shard_count(&tests->m_App_Options);
+   unit_test_shard_item_t * items =
+      malloc(count * sizeof(unit_test_shard_item_t));
+   double * loads = calloc(shards, sizeof(double));
+   cbool_t result = cut_not_nullptr_2(items, loads);
+   if (result)
+   {
+      tests->m_Shard_Map = malloc(count * sizeof(int));
+      result = cut_not_nullptr(tests->m_Shard_Map);
+   }
+   if (result)
+   {
+      double total = 0.0;
+      double fallback = 1.0;
+      int known = 0;
+      int i;
+      for (i = 0; i < count; ++i)
+      {
+         if (durations[i] >= 0.0)
+         {
+            total += durations[i];
+            ++known;
+         }
+      }
+      if (known > 0)
+         fallback = total / known;
+
+      for (i = 0; i < count; ++i)
+      {
+         items[i].m_Duration_ms =
+            durations[i] >= 0.0 ? durations[i] : fallback ;
+         items[i].m_Test_Number = i;
+      }
+      qsort
+      (
+         items, count, sizeof(unit_test_shard_item_t), unit_test_shard_compare
+      );
+      for (i = 0; i < count; ++i)
+      {
+         int lightest = 0;
+         int s;
+         for (s = 1; s < shards; ++s)
+         {
+            if (loads[s] < loads[lightest])
+               lightest = s;
+         }
+         loads[lightest] += items[i].m_Duration_ms;
+         tests->m_Shard_Map[items[i].m_Test_Number] = lightest;
+      }
+      (void) unit_test_options_shard_map_set
+      (
+         &tests->m_App_Options, tests->m_Shard_Map
+      );
+   }
+   else
+      xpccut_errprint_func(_("could not allocate the shard map"));
+
+   free(loads);
+   free(items);
+   return result;
+}
+
+/**
+ *    Marks the tests given to unit_test_load_spread() as XPCCUT_SHARD_ALL
+ *    in the shard map, so that they run in every shard.  If no map was
+ *    built for "--shard-by duration", one is built that gives the other
+ *    tests the same shards as "--shard-by index".
+ *
+ * \return
+ *    Returns 'false' if the map could not be allocated.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_load_spread().
+ */
+
+static cbool_t
+unit_test_spread_shards
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   cbool_t result = true;
+   int count = tests->m_Test_Count;
+   int shards = unit_test_options_shard_count(&tests->m_App_Options);
+   int spread = 0;
+   int i;
+   for (i = 0; i < count; ++i)
+   {
+      if (tests->m_Test_Info[i].m_Is_Spread)
+         ++spread;
+   }
+   if (spread > 0 && tests->m_Shard_Map == nullptr)
+   {
+      tests->m_Shard_Map = malloc(count * sizeof(int));
+      result = cut_not_nullptr(tests->m_Shard_Map);
+      if (result)
+      {
+         for (i = 0; i < count; ++i)
+            tests->m_Shard_Map[i] = i % shards;
+
+         (void) unit_test_options_shard_map_set
+         (
+            &tests->m_App_Options, tests->m_Shard_Map
+         );
+      }
+      else
+         xpccut_errprint_func(_("could not allocate the shard map"));
+   }
+   if (result && spread > 0)
+   {
+      for (i = 0; i < count; ++i)
+      {
+         if (tests->m_Test_Info[i].m_Is_Spread)
+            tests->m_Shard_Map[i] = XPCCUT_SHARD_ALL;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Sets up the per-test durations, and the shard map if needed, for the
+ *    tests about to be run by unit_test_run_init().
+ *
+ * \return
+ *    Returns 'false' if the --shard-index value is not less than the
+ *    --shard-count value, so that no test could run.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static cbool_t
+unit_test_setup_shards
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   int shards = unit_test_options_shard_count(options);
+   cbool_t result = unit_test_options_shard_index(options) < shards;
+   unit_test_free_shards(tests);
+   if (result)
+   {
+      int count = tests->m_Test_Count;
+      tests->m_Durations_ms = malloc(count * sizeof(double));
+      if (cut_not_nullptr(tests->m_Durations_ms))
+      {
+         int i;
+         for (i = 0; i < count; ++i)
+            tests->m_Durations_ms[i] = -1.0;
+      }
+      if
+      (
+         shards > 1 &&
+         unit_test_options_shard_mode(options) == XPCCUT_SHARD_BY_DURATION
+      )
+      {
+         double * durations = malloc(count * sizeof(double));
+         if (cut_not_nullptr(durations))
+         {
+            const char * filename = unit_test_options_durations_file(options);
+            int i;
+            for (i = 0; i < count; ++i)
+               durations[i] = -1.0;
+
+            if (cut_not_nullptr(filename))
+               (void) unit_test_read_durations(tests, filename, durations);
+            else
+               xpccut_errprint_func(_("--shard-by duration needs --durations"));
+
+            (void) unit_test_balance_shards(tests, durations);
+            free(durations);
+         }
+      }
+      if (shards > 1)
+         (void) unit_test_spread_shards(tests);
+   }
+   else
+      xpccut_errprint_func(_("--shard-index must be less than --shard-count"));
+
+   return result;
+}
+
+/**
+ *    Reads the --history file written by unit_test_save_history().  Each
+ *    line holds the number (re 1), group number, and case number of a
+ *    test, 1 if it failed or 0 if it passed, and its duration in
+ *    milliseconds.  Lines starting with '#' are comments.  A test loaded
+ *    by unit_test_register() takes the history of the lines with its group
+ *    and case numbers, so it keeps its history when tests are added ahead
+ *    of it.  A test loaded by unit_test_load(), whose numbers are not known
+ *    until it runs, takes the history of the lines with its test number.
+ *    The last line for a test wins.  A file that does not exist yet, as
+ *    before the first run, is not an error.
+ *
+ * \return
+ *    Returns the number of lines that were used.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static int
+unit_test_read_history
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   const char * filename            /**< The file to be read, not null.       */
+)
+{
+   int result = 0;
+   FILE * f = fopen(filename, "r");
+   if (cut_not_nullptr(f))
+   {
+      char line[XPCCUT_STRLEN];
+      while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+      {
+         int testnumber, group, testcase, failed;
+         double ms;
+         if (line[0] == '#')
+            continue;
+
+         if
+         (
+            sscanf
+            (
+               line, "%d %d %d %d %lf",
+               &testnumber, &group, &testcase, &failed, &ms
+            ) == 5 && ms >= 0.0
+         )
+         {
+            cbool_t used = false;
+            int t;
+            for (t = 0; t < tests->m_Test_Count; ++t)
+            {
+               const unit_test_info_t * info = &tests->m_Test_Info[t];
+               cbool_t match = info->m_Test_Group > 0 ?
+                  info->m_Test_Group == group && info->m_Test_Case == testcase :
+                  t == testnumber - 1 ;
+
+               if (match)
+               {
+                  unit_test_history_t * h = &tests->m_History[t];
+                  h->m_Test_Group = group;
+                  h->m_Test_Case = testcase;
+                  h->m_Failed = failed != 0;
+                  h->m_Duration_ms = ms;
+                  used = true;
+               }
+            }
+            if (used)
+               ++result;
+         }
+      }
+      fclose(f);
+   }
+   return result;
+}
+
+/**
+ *    Sorts the test numbers by m_History, for unit_test_setup_order().  On
+ *    a tie, the tests stay in load order.
+ *
+ *    -  XPCCUT_ORDER_FAILED_FIRST.  The tests that failed come first.
+ *    -  XPCCUT_ORDER_FASTEST_FIRST.  The shortest tests come first, and
+ *       the tests with no duration come last.
+ *    -  XPCCUT_ORDER_LOAD.  The longest tests come first, for the --jobs
+ *       schedule; the tests with no duration are given the mean of the
+ *       known ones, as in unit_test_balance_shards().
+ *
+ * \return
+ *    Returns the test numbers, re 0, in a new array of m_Test_Count
+ *    entries, or null if it could not be allocated.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static int *
+unit_test_sort_tests
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   unit_test_order_t order          /**< The order wanted.                    */
+)
+{
+   int count = tests->m_Test_Count;
+   int * result = malloc(count * sizeof(int));
+   unit_test_shard_item_t * items =
+      malloc(count * sizeof(unit_test_shard_item_t));
+
+   if (cut_not_nullptr_2(result, items))
+   {
+      double total = 0.0;
+      double longest = 0.0;
+      double fallback = 1.0;
+      int known = 0;
+      int i;
+      for (i = 0; i < count; ++i)
+      {
+         double ms = tests->m_History[i].m_Duration_ms;
+         if (ms >= 0.0)
+         {
+            total += ms;
+            if (ms > longest)
+               longest = ms;
+
+            ++known;
+         }
+      }
+      if (known > 0)
+         fallback = total / known;
+
+      for (i = 0; i < count; ++i)
+      {
+         const unit_test_history_t * h = &tests->m_History[i];
+         double key;
+         if (order == XPCCUT_ORDER_FAILED_FIRST)
+            key = h->m_Failed ? 1.0 : 0.0 ;
+         else if (order == XPCCUT_ORDER_FASTEST_FIRST)
+            key = h->m_Duration_ms >= 0.0 ? -h->m_Duration_ms : -longest - 1.0;
+         else
+            key = h->m_Duration_ms >= 0.0 ? h->m_Duration_ms : fallback ;
+
+         items[i].m_Duration_ms = key;
+         items[i].m_Test_Number = i;
+      }
+      qsort
+      (
+         items, count, sizeof(unit_test_shard_item_t), unit_test_shard_compare
+      );
+      for (i = 0; i < count; ++i)
+         result[i] = items[i].m_Test_Number;
+   }
+   else
+   {
+      xpccut_errprint_func(_("could not allocate the test order"));
+      free(result);
+      result = nullptr;
+   }
+   free(items);
+   return result;
+}
+
+/**
+ *    Sets up the history of the tests about to be run by
+ *    unit_test_run_init(), and the orders in which they are handed out and
+ *    started.  The --order option needs the --history option; without it,
+ *    the tests run in load order.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_setup_order
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   const char * filename = unit_test_options_history_file(options);
+   unit_test_order_t order = unit_test_options_order(options);
+   unit_test_free_history(tests);
+   tests->m_Order_Position = XPCCUT_NO_CURRENT_TEST;
+   if (cut_not_nullptr(filename))
+   {
+      int count = tests->m_Test_Count;
+      tests->m_History = malloc(count * sizeof(unit_test_history_t));
+      if (cut_not_nullptr(tests->m_History))
+      {
+         int t;
+         for (t = 0; t < count; ++t)
+         {
+            unit_test_history_t * h = &tests->m_History[t];
+            h->m_Test_Group = tests->m_Test_Info[t].m_Test_Group;
+            h->m_Test_Case = tests->m_Test_Info[t].m_Test_Case;
+            h->m_Failed = false;
+            h->m_Duration_ms = -1.0;
+         }
+         (void) unit_test_read_history(tests, filename);
+      }
+      else
+         xpccut_errprint_func(_("could not allocate the test history"));
+   }
+   else if (order != XPCCUT_ORDER_LOAD)
+      xpccut_errprint_func(_("--order needs --history"));
+
+   if
+   (
+      cut_not_nullptr(tests->m_History) &&
+      ! unit_test_options_shuffle(options)
+   )
+   {
+      if (order != XPCCUT_ORDER_LOAD)
+         tests->m_Test_Order = unit_test_sort_tests(tests, order);
+      else if (unit_test_use_jobs(tests))
+         tests->m_Schedule = unit_test_sort_tests(tests, XPCCUT_ORDER_LOAD);
+   }
+}
+
+/**
+ *    Shuffles the orders of the rounds up to a given round into
+ *    m_Shuffle_Orders, for the --shuffle option.  Round i is shuffled by
+ *    a generator of its own, seeded with the seed of the run plus i, so
+ *    that the random numbers that the tests draw from xpccut_rand() are
+ *    not disturbed, and so that any round can be had again by itself.
+ *
+ *    A round is shuffled only after the round that last used its row of
+ *    m_Shuffle_Orders has been disposed of.  Under --jobs, the main thread
+ *    calls this function with the lock of the pool held.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_next_test().
+ */
+
+static void
+unit_test_prepare_rounds
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   int round                        /**< The last round to be shuffled.       */
+)
+{
+   if (cut_not_nullptr(tests->m_Shuffle_Orders))
+   {
+      int count = tests->m_Test_Count;
+      while (tests->m_Shuffle_Ready < round)
+      {
+         int r = ++tests->m_Shuffle_Ready;
+         int * order = &tests->m_Shuffle_Orders
+         [
+            (r % tests->m_Window_Rounds) * count
+         ];
+         xpccut_rng_t rng;
+         int t;
+         (void) xpccut_rng_init
+         (
+            &rng, XPCCUT_RNG_GLIBC, tests->m_Shuffle_Seed + (unsigned) r
+         );
+         for (t = 0; t < count; ++t)
+            order[t] = t;
+
+         for (t = count - 1; t > 0; --t)              /* Fisher-Yates      */
+         {
+            int other = (int) xpccut_rng_range(&rng, t + 1);
+            int temp = order[t];
+            order[t] = order[other];
+            order[other] = temp;
+         }
+      }
+   }
+}
+
+/**
+ *    Counts the cases of each round, up to the given one, for the fixture
+ *    of the group of each case, so that a fixture stays up until every
+ *    case of every round that can have started is done.  Like
+ *    unit_test_prepare_rounds(), this is done for each round before the
+ *    --jobs workers can reach it, so that the rounds can overlap.  Under
+ *    --jobs, the main thread calls this function with the lock of the pool
+ *    held.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_fixture().
+ */
+
+static void
+unit_test_expect_rounds
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   int round                        /**< The last round to be counted.        */
+)
+{
+   if (tests->m_Round_Count > 0 && round >= tests->m_Round_Count)
+      round = tests->m_Round_Count - 1;
+
+   if (tests->m_Fixtures.m_Count > 0)
+   {
+      while (tests->m_Fixture_Ready < round)
+      {
+         int t;
+         ++tests->m_Fixture_Ready;
+         for (t = 0; t < tests->m_Test_Count; ++t)
+         {
+            xpccut_fixture_expect
+            (
+               &tests->m_Fixtures, tests->m_Test_Info[t].m_Test_Group
+            );
+         }
+      }
+   }
+}
+
+/**
+ *    Sets up the rounds of the tests about to be run by
+ *    unit_test_run_init(), for the --repeat, --until-fail, and --shuffle
+ *    options.  The positions handed out by unit_test_next_test() run
+ *    through all of the rounds, so that the round of a position is the
+ *    position divided by the number of tests.
+ *
+ *    The --jobs workers and the --isolate children can run one more round
+ *    ahead per job, so a test can run in more than one of them at once.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_setup_rounds
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   int count = tests->m_Test_Count;
+   int rounds = unit_test_options_repeat_count(options);
+   int most = INT_MAX / count;                  /* keep positions in an int */
+   unit_test_free_rounds(tests);
+   if (unit_test_options_until_fail(options) && rounds == 1)
+      rounds = 0;                               /* no limit on the rounds   */
+
+   if (unit_test_options_is_summary(options))
+      rounds = 1;
+
+   if (rounds > most)
+      rounds = most;
+
+   tests->m_Round_Count = rounds;
+   tests->m_Position_Limit = (rounds > 0 ? rounds : most) * count;
+   tests->m_Window_Rounds = 1;
+   tests->m_Shuffle_Ready = XPCCUT_NO_CURRENT_TEST;
+   if (unit_test_use_jobs(tests))
+   {
+      int jobs = unit_test_options_job_count(options);
+      tests->m_Window_Rounds = (rounds > 0 && rounds < jobs) ? rounds : jobs ;
+      if (tests->m_Window_Rounds > most)
+         tests->m_Window_Rounds = most;
+   }
+   if (rounds != 1)
+   {
+      tests->m_Repeats = calloc(count, sizeof(unit_test_repeat_t));
+      if (cut_is_nullptr(tests->m_Repeats))
+         xpccut_errprint_func(_("could not allocate the test repeats"));
+   }
+   if (unit_test_options_shuffle(options))
+   {
+      unsigned seed = unit_test_options_shuffle_seed(options);
+      if (seed == 0)
+      {
+         struct timeval now;
+         (void) xpccut_get_microseconds(&now);
+         seed = (unsigned) now.tv_sec ^ (unsigned) now.tv_usec;
+         if (seed == 0)
+            seed = 1;
+      }
+      tests->m_Shuffle_Seed = seed;
+      tests->m_Shuffle_Orders = malloc
+      (
+         (size_t) tests->m_Window_Rounds * count * sizeof(int)
+      );
+      if (cut_not_nullptr(tests->m_Shuffle_Orders))
+         unit_test_prepare_rounds(tests, tests->m_Window_Rounds - 1);
+      else
+         xpccut_errprint_func(_("could not allocate the shuffled orders"));
+   }
+}
+
+/**
+ *    Provides the test that unit_test_next_test() hands out at a given
+ *    position, from the shuffled order of its round, or else from
+ *    m_Test_Order.
+ *
+ * \return
+ *    Returns the test number, re 0.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_next_test().
+ */
+
+static int
+unit_test_ordered_test
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   int position                     /**< The position, in any round.          */
+)
+{
+   int count = tests->m_Test_Count;
+   int result = position % count;
+   if (cut_not_nullptr(tests->m_Shuffle_Orders))
+   {
+      int row = (position / count) % tests->m_Window_Rounds;
+      result = tests->m_Shuffle_Orders[row * count + result];
+   }
+   else if (cut_not_nullptr(tests->m_Test_Order))
+      result = tests->m_Test_Order[result];
+
+   return result;
+}
+
+/**
+ *    Provides the test that the --jobs workers or the --isolate children
+ *    start at a given position, from m_Schedule, or else in the order of
+ *    unit_test_ordered_test().  Either way, each round starts every test
+ *    once.
+ *
+ * \return
+ *    Returns the test number, re 0.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static int
+unit_test_scheduled_test
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   int position                     /**< The position, in any round.          */
+)
+{
+   int result;
+   if (cut_not_nullptr(tests->m_Schedule))
+      result = tests->m_Schedule[position % tests->m_Test_Count];
+   else
+      result = unit_test_ordered_test(tests, position);
+
+   return result;
+}
+
+/**
+ *    Provides the slot that holds the result of a test started at a given
+ *    position, while it waits to be disposed of.  There is one slot per
+ *    test for each of the m_Window_Rounds rounds.
+ *
+ * \return
+ *    Returns the index of the slot.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static int
+unit_test_round_slot
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   int position,                    /**< The position, in any round.          */
+   int testnumber                   /**< The test run at the position.        */
+)
+{
+   int round = position / tests->m_Test_Count;
+   return (round % tests->m_Window_Rounds) * tests->m_Test_Count + testnumber;
+}
+
+/**
+ *    Reads the --baseline file written by unit_test_status_perf_check().
+ *    Each line holds the group and case numbers of a test, the measured
+ *    value, its noise, and the name of the measurement, which runs to the
+ *    end of the line.  Lines starting with '#' are comments.  The entries
+ *    are kept in file order, so that unit_test_options_baseline_find() can
+ *    use the last of any duplicates.
+ *
+ * \return
+ *    Returns the number of entries that were read.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static int
+unit_test_read_baseline
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   const char * filename            /**< The file to be read, not null.       */
+)
+{
+   FILE * f = fopen(filename, "r");
+   if (cut_not_nullptr(f))
+   {
+      char line[2 * XPCCUT_STRLEN];
+      int allocated = 0;
+      while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+      {
+         unit_test_baseline_t entry;
+         int namestart = 0;
+         if (line[0] == '#')
+            continue;
+
+         if
+         (
+            sscanf
+            (
+               line, "%d %d %lf %lf %n", &entry.m_Test_Group,
+               &entry.m_Test_Case, &entry.m_Value, &entry.m_Noise, &namestart
+            ) == 4 && namestart > 0
+         )
+         {
+            char * name = &line[namestart];
+            name[strcspn(name, "\r\n")] = 0;
+            xpccut_stringcopy(entry.m_Name, name);
+            if (tests->m_Baseline_Count == allocated)
+            {
+               int count = allocated + XPCCUT_CASE_ALLOCATION;
+               unit_test_baseline_t * baseline = realloc
+               (
+                  tests->m_Baseline, count * sizeof(unit_test_baseline_t)
+               );
+               if (cut_is_nullptr(baseline))
+               {
+                  xpccut_errprint_func(_("could not allocate the baseline"));
+                  break;
+               }
+               tests->m_Baseline = baseline;
+               allocated = count;
+            }
+            tests->m_Baseline[tests->m_Baseline_Count++] = entry;
+         }
+      }
+      fclose(f);
+   }
+   else
+      xpccut_errprint_ex(_("could not open baseline file"), filename);
+
+   return tests->m_Baseline_Count;
+}
+
+/**
+ *    Sets up the performance baseline for the tests about to be run by
+ *    unit_test_run_init().  The --baseline file is read first, and then
+ *    the --write-baseline file is emptied, so that the two options can
+ *    name the same file.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_setup_baseline
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   const char * filename = unit_test_options_baseline_file(options);
+   unit_test_free_baseline(tests);
+   if (cut_not_nullptr(filename))
+   {
+      if (unit_test_read_baseline(tests, filename) > 0)
+      {
+         (void) unit_test_options_baseline_set
+         (
+            &tests->m_App_Options, tests->m_Baseline, tests->m_Baseline_Count
+         );
+      }
+   }
+   filename = unit_test_options_write_baseline_file(options);
+   if (cut_not_nullptr(filename))
+   {
+      FILE * f = fopen(filename, "w");
+      if (cut_not_nullptr(f))
+      {
+         fprintf
+         (
+            f, "# %s %s: %s\n",
+            tests->m_Test_Application_Name, tests->m_Test_Application_Version,
+            "group case value noise name"
+         );
+         fclose(f);
+      }
+      else
+         xpccut_errprint_ex(_("could not write baseline file"), filename);
+   }
+}
+
+/**
+ *    Writes the duration of each test that ran to the --save-durations
+ *    file, in the format read by unit_test_read_durations().
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_post_loop().
+ */
+
+static void
+unit_test_save_durations
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   const char * filename            /**< The file to be written, not null.    */
+)
+{
+   FILE * f = fopen(filename, "w");
+   if (cut_not_nullptr(f))
+   {
+      int i;
+      fprintf
+      (
+         f, "# %s %s: %s\n",
+         tests->m_Test_Application_Name, tests->m_Test_Application_Version,
+         "test duration_ms"
+      );
+      for (i = 0; i < tests->m_Test_Count; ++i)
+      {
+         if (tests->m_Durations_ms[i] >= 0.0)
+         {
+            fprintf(f, "%d %.3f\n", i + 1, tests->m_Durations_ms[i]);
+         }
+      }
+      fclose(f);
+   }
+   else
+      xpccut_errprint_ex(_("could not write durations file"), filename);
+}
+
+/**
+ *    Writes the history of the loaded tests to the --history file, in the
+ *    format read by unit_test_read_history().  The tests that did not run
+ *    keep the history that was read for them.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_post_loop().
+ */
+
+static void
+unit_test_save_history
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   const char * filename            /**< The file to be written, not null.    */
+)
+{
+   FILE * f = fopen(filename, "w");
+   if (cut_not_nullptr(f))
+   {
+      int i;
+      fprintf
+      (
+         f, "# %s %s: %s\n",
+         tests->m_Test_Application_Name, tests->m_Test_Application_Version,
+         "test group case failed duration_ms"
+      );
+      for (i = 0; i < tests->m_Test_Count; ++i)
+      {
+         const unit_test_history_t * h = &tests->m_History[i];
+         if (h->m_Duration_ms >= 0.0)
+         {
+            fprintf
+            (
+               f, "%d %d %d %d %.3f\n", i + 1, h->m_Test_Group,
+               h->m_Test_Case, h->m_Failed ? 1 : 0, h->m_Duration_ms
+            );
+         }
+      }
+      fclose(f);
+   }
+   else
+      xpccut_errprint_ex(_("could not write history file"), filename);
+}
+
+/**
+ *    Provides the offset basis of the 64-bit FNV-1a hash used for the keys
+ *    of the --cache-file.
+ */
+
+#define XPCCUT_CACHE_HASH_BASIS        14695981039346656037ULL
+
+/**
+ *    Adds some bytes to a 64-bit FNV-1a hash, for the keys of the
+ *    --cache-file.
+ *
+ * \return
+ *    Returns the new value of the hash.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static unsigned long long
+unit_test_cache_hash
+(
+   unsigned long long hash,         /**< The hash so far.                     */
+   const void * data,               /**< The bytes to be added.               */
+   size_t size                      /**< The number of bytes.                 */
+)
+{
+   const unsigned char * c = (const unsigned char *) data;
+   while (size-- > 0)
+   {
+      hash ^= *c++;
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+/**
+ *    Provides the part of the --cache-file keys that is the same for all of
+ *    the tests.  It is a hash of the --cache-key, or, if there is none, of
+ *    the executable file of the test application, so that a rebuild runs
+ *    the tests again.  The executable is found through /proc/self/exe, so
+ *    elsewhere, and for code in a shared library that can change without
+ *    the application being rebuilt, the --cache-key option is needed.
+ *
+ *    The options that change what a test does are also hashed, so that,
+ *    for example, a pass of one --sub-test does not stand for a pass of
+ *    the whole test.
+ *
+ * \return
+ *    Returns the hash, or 0 if there is no key to be had.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static unsigned long long
+unit_test_cache_content
+(
+   const unit_test_t * tests        /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   const char * key = unit_test_options_cache_key(options);
+   unsigned long long result = 0;
+   if (cut_not_nullptr(key))
+      result = unit_test_cache_hash(XPCCUT_CACHE_HASH_BASIS, key, strlen(key));
+   else
+   {
+      FILE * f = fopen("/proc/self/exe", "rb");
+      if (cut_not_nullptr(f))
+      {
+         unsigned char block[4096];
+         size_t count;
+         result = XPCCUT_CACHE_HASH_BASIS;
+         while ((count = fread(block, 1, sizeof block, f)) > 0)
+            result = unit_test_cache_hash(result, block, count);
+
+         fclose(f);
+      }
+   }
+   if (result != 0)
+   {
+      const char * named = unit_test_options_named_subtest(options);
+      int settings[6];
+      settings[0] = unit_test_options_is_simulated(options);
+      settings[1] = unit_test_options_single_subtest(options);
+      settings[2] = unit_test_options_prompt_before(options);
+      settings[3] = unit_test_options_prompt_after(options);
+      settings[4] = unit_test_options_is_interactive(options);
+      settings[5] = unit_test_options_batch_mode(options);
+      result = unit_test_cache_hash(result, settings, sizeof settings);
+      if (cut_not_nullptr(named))
+         result = unit_test_cache_hash(result, named, strlen(named));
+   }
+   return result;
+}
+
+/**
+ *    Reads the --cache-file written by unit_test_save_cache().  Each line
+ *    holds the group number, case number, and key, in hexadecimal, of a
+ *    test that passed.  Lines starting with '#' are comments.  A line
+ *    whose key matches the key of a loaded test marks the test as passed;
+ *    if the cache is to be used, the test is also marked to be reported as
+ *    a cached pass.  A file that does not exist yet, as before the first
+ *    run, is not an error.
+ *
+ * \return
+ *    Returns the number of tests that matched a line.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static int
+unit_test_read_cache
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   const char * filename,           /**< The file to be read, not null.       */
+   cbool_t use                      /**< Report the matches as cached passes. */
+)
+{
+   int result = 0;
+   FILE * f = fopen(filename, "r");
+   if (cut_not_nullptr(f))
+   {
+      char line[XPCCUT_STRLEN];
+      while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+      {
+         int group, testcase;
+         unsigned long long key;
+         if (line[0] == '#')
+            continue;
+
+         if (sscanf(line, "%d %d %llx", &group, &testcase, &key) == 3)
+         {
+            int t;
+            for (t = 0; t < tests->m_Test_Count; ++t)
+            {
+               const unit_test_info_t * info = &tests->m_Test_Info[t];
+               unit_test_cache_t * c = &tests->m_Cache[t];
+               if
+               (
+                  info->m_Test_Group == group &&
+                  info->m_Test_Case == testcase &&
+                  c->m_Key == key && ! c->m_Passed
+               )
+               {
+                  c->m_Passed = true;
+                  c->m_Is_Cached = use;
+                  ++result;
+               }
+            }
+         }
+      }
+      fclose(f);
+   }
+   return result;
+}
+
+/**
+ *    Sets up the --cache-file state of the tests about to be run by
+ *    unit_test_run_init().  Only the tests loaded by unit_test_register()
+ *    can be cached, since the group and case of the others are not known
+ *    until they run.  Nothing is cached in --summarize mode, or with the
+ *    --force-failure option, which would make every pass stale, or when
+ *    the tests are run more than once.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static void
+unit_test_setup_cache
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   const unit_test_options_t * options = &tests->m_App_Options;
+   const char * filename = unit_test_options_cache_file(options);
+   unit_test_free_cache(tests);
+   if
+   (
+      cut_not_nullptr(filename) && tests->m_Round_Count == 1 &&
+      ! unit_test_options_is_summary(options) &&
+      ! unit_test_options_force_failure(options)
+   )
+   {
+      unsigned long long content = unit_test_cache_content(tests);
+      if (content == 0)
+         xpccut_errprint_func(_("--cache-file needs --cache-key here"));
+      else
+      {
+         int count = tests->m_Test_Count;
+         tests->m_Cache = malloc(count * sizeof(unit_test_cache_t));
+         if (cut_not_nullptr(tests->m_Cache))
+         {
+            int t;
+            for (t = 0; t < count; ++t)
+            {
+               const unit_test_info_t * info = &tests->m_Test_Info[t];
+               unit_test_cache_t * c = &tests->m_Cache[t];
+               c->m_Key = 0;
+               c->m_Is_Cached = c->m_Passed = false;
+               if (info->m_Test_Group > 0)
+               {
+                  const char * name = cut_not_nullptr(info->m_Group_Name) ?
+                     info->m_Group_Name : "" ;
+
+                  int numbers[2];
+                  unsigned long long key = content;
+                  numbers[0] = info->m_Test_Group;
+                  numbers[1] = info->m_Test_Case;
+                  key = unit_test_cache_hash(key, numbers, sizeof numbers);
+                  key = unit_test_cache_hash(key, name, strlen(name) + 1);
+                  name = cut_not_nullptr(info->m_Case_Name) ?
+                     info->m_Case_Name : "" ;
+
+                  key = unit_test_cache_hash(key, name, strlen(name) + 1);
+                  c->m_Key = key != 0 ? key : 1 ;  /* 0 means no key      */
+               }
+            }
+            (void) unit_test_read_cache
+            (
+               tests, filename, unit_test_options_use_cache(options)
+            );
+         }
+         else
+            xpccut_errprint_func(_("could not allocate the test cache"));
+      }
+   }
+}
+
+/**
+ *    Indicates if a test is to be reported as a cached pass from the
+ *    --cache-file, rather than being run.
+ *
+ * \return
+ *    Returns 'true' if the test has a cached pass.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_skip_a_test().
+ */
+
+static cbool_t
+unit_test_is_cached
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   int testnumber                   /**< Index of the test, re 0.             */
+)
+{
+   cbool_t result = cut_not_nullptr(tests->m_Cache);
+   if (result)
+      result = testnumber >= 0 && testnumber < tests->m_Test_Count;
+
+   if (result)
+      result = tests->m_Cache[testnumber].m_Is_Cached;
+
+   return result;
+}
+
+/**
+ *    Writes the tests that passed to the --cache-file, in the format read
+ *    by unit_test_read_cache().  A test that did not run, and was not
+ *    cached, keeps the pass that was read for it.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_post_loop().
+ */
+
+static void
+unit_test_save_cache
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   const char * filename            /**< The file to be written, not null.    */
+)
+{
+   FILE * f = fopen(filename, "w");
+   if (cut_not_nullptr(f))
+   {
+      int i;
+      fprintf
+      (
+         f, "# %s %s: %s\n",
+         tests->m_Test_Application_Name, tests->m_Test_Application_Version,
+         "group case key"
+      );
+      for (i = 0; i < tests->m_Test_Count; ++i)
+      {
+         const unit_test_cache_t * c = &tests->m_Cache[i];
+         if (c->m_Passed && c->m_Key != 0)
+         {
+            fprintf
+            (
+               f, "%d %d %016llx\n", tests->m_Test_Info[i].m_Test_Group,
+               tests->m_Test_Info[i].m_Test_Case, c->m_Key
+            );
+         }
+      }
+      fclose(f);
+   }
+   else
+      xpccut_errprint_ex(_("could not write cache file"), filename);
+}
+
+/**
+ *    Opens the file of the --report-format report, if one is selected, and
+ *    writes the start of the report.  No report is written in --summarize
+ *    mode, since no tests are run.
+ *
+ * \return
+ *    Returns 'true' if no report is selected, or if the file could be
+ *    opened.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_init().
+ */
+
+static cbool_t
+unit_test_open_report
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   cbool_t result = true;
+   const char * filename = unit_test_options_report_file(&tests->m_App_Options);
+   unit_test_close_report(tests);                  /* in case of a re-run   */
+   tests->m_Report_Count = 0;
+   if (cut_not_nullptr(filename))
+   {
+      if (! unit_test_options_is_summary(&tests->m_App_Options))
+      {
+         tests->m_Report_File = fopen(filename, "w");
+         if (cut_not_nullptr(tests->m_Report_File))
+         {
+            /*
+             * An outer run, if any, gets its report file back at the end.
+             * On a --jobs worker the report is captured, and the report
+             * file belongs to the main thread, so it is left alone.
+             */
+
+            if (! xpccut_output_is_capturing())
+            {
+               tests->m_Report_Previous = xpccut_output_get_report_file();
+               xpccut_output_set_report_file(tests->m_Report_File);
+            }
+            xpccut_report_begin
+            (
+               unit_test_options_report_format(&tests->m_App_Options),
+               tests->m_Test_Application_Name
+            );
+         }
+         else
+         {
+            xpccut_errprint_ex(_("could not create report file"), filename);
+            result = false;
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Writes one record to the report for a test whose sub-tests wrote no
+ *    records of their own, such as a skipped test, a cached pass, a test
+ *    without sub-tests, or an isolated test that crashed.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_dispose_of_test().
+ */
+
+static void
+unit_test_report_test
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   const unit_test_status_t * status,  /**< The disposed test, assumed valid. */
+   cbool_t cached                   /**< The test is a cached pass.           */
+)
+{
+   if (status->m_Report_Count == 0)
+   {
+      xpccut_report_record_t record;
+      record.m_Group = status->m_Test_Group;
+      record.m_Group_Name = status->m_Group_Name;
+      record.m_Case = status->m_Test_Case;
+      record.m_Case_Name = status->m_Case_Description;
+      record.m_Subtest = 0;
+      record.m_Subtest_Name = "";
+      if (unit_test_status_is_skipped(status))
+         record.m_Disposition = "skipped";
+      else if (cached)
+         record.m_Disposition = "cached";
+      else if (unit_test_status_is_aborted(status))
+         record.m_Disposition = "aborted";
+      else if (unit_test_status_passed(status))
+         record.m_Disposition = "passed";
+      else
+         record.m_Disposition = "failed";
+
+      record.m_Duration_ms = unit_test_status_duration_ms(status);
+      record.m_Error_Count = status->m_Subtest_Error_Count;
+      xpccut_report_record
+      (
+         unit_test_options_report_format(&tests->m_App_Options), &record
+      );
+      tests->m_Report_Count++;
+   }
+   else
+      tests->m_Report_Count += status->m_Report_Count;
+}
+
+/**
+ *    Provides the initialization component of unit_test_run().
+ *    This function is a helper function that is exposed so that a C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *
+ *    It also sets up the shard map for the "--shard-by duration" option,
+ *    the array in which unit_test_dispose_of_test() records the duration of
+ *    each test, the --baseline entries used by
+ *    unit_test_status_perf_check(), and the --cache-file passes that
+ *    unit_test_skip_a_test() reports without running the tests.
+ *
+ *    If a --report-format is selected, the report file is created, and the
+ *    start of the report is written.
+ *
+ * \return
+ *    Returns the number of tests that have been loaded.  The caller should
+ *    not have to count the number of tests.  If the --shard-index option
+ *    is out of range, 0 is returned, so that no tests are run.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_17()
+ */
+
+int
+unit_test_run_init
+(
+   unit_test_t * tests  /**< "this pointer" for this function, assumed valid. */
+)
+{
+   int length = 0;
+   if (xpccut_thisptr(tests))
+   {
+      length = tests->m_Test_Count;
+      if (length == 0)
+         xpccut_errprint_func(_("no unit tests loaded"));
+      else
+      {
+         tests->m_Current_Test_Number  = XPCCUT_NO_CURRENT_TEST;
+         tests->m_First_Failed_Test    =  0;
+         tests->m_First_Failed_Group   =  0;
+         tests->m_First_Failed_Case    =  0;
+         tests->m_First_Failed_Subtest =  0;
+         (void) unit_test_status_init(&tests->m_First_Failed_Status);
+         tests->m_Total_Errors         =  0;
+         tests->m_Run_Count            =  0;
+         tests->m_Cached_Count         =  0;
+         unit_test_clear_profile(tests);
+         if (unit_test_options_huge_pages(&tests->m_App_Options))
+            xpccut_test_arena_flags_set(XPCCUT_ARENA_HUGE_PAGES);
+
+         if
+         (
+            cut_not_nullptr(unit_test_options_trace_file(&tests->m_App_Options))
+         )
+         {
+            xpccut_trace_clear();
+            xpccut_trace_enable(true);
+         }
+
+         if (! unit_test_setup_shards(tests))
+            length = 0;
+         else
+         {
+            unit_test_setup_baseline(tests);
+            unit_test_setup_order(tests);
+            unit_test_setup_rounds(tests);
+            unit_test_setup_cache(tests);
+         }
+
+         if (length > 0 && ! unit_test_open_report(tests))
+            length = 0;
+
+         if (length > 0)
+         {
+            xpccut_fixture_release(&tests->m_Fixtures);   /* fresh counts   */
+            tests->m_Fixture_Ready = XPCCUT_NO_CURRENT_TEST;
+            unit_test_expect_rounds(tests, tests->m_Window_Rounds - 1);
+         }
+      }
+      if (length > 0)
+      {
+         if (unit_test_options_show_progress(&tests->m_App_Options))
+         {
+            xpccut_print
+            (
+            "===============================================================\n"
+            "%s %s\n"
             "---------------------------------------------------------------\n"
                ,
-               tests->m_Test_Application_Name,
-               tests->m_Test_Application_Version
+               tests->m_Test_Application_Name,
+               tests->m_Test_Application_Version
+            );
+         }
+         xpccut_get_microseconds(&tests->m_Start_Time_us);
+         tests->m_Start_Ticks = xpccut_get_ticks();
+      }
+   }
+   return length;
+}
+
+/**
+ *    Starts a round of the tests for unit_test_next_test().  The orders of
+ *    the rounds that the --jobs workers can now reach are shuffled, and
+ *    their cases counted for the fixtures, and, with --show-progress, the
+ *    round and its shuffle seed are shown.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_next_test().
+ */
+
+static void
+unit_test_start_round
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   int round                        /**< The round, re 0.                     */
+)
+{
+   cbool_t shuffled = cut_not_nullptr(tests->m_Shuffle_Orders);
+   unit_test_prepare_rounds(tests, round + tests->m_Window_Rounds - 1);
+   unit_test_expect_rounds(tests, round + tests->m_Window_Rounds - 1);
+   if (unit_test_options_show_progress(&tests->m_App_Options))
+   {
+      if (tests->m_Round_Count != 1)
+      {
+         if (tests->m_Round_Count > 0)
+         {
+            xpccut_print
+            (
+               "\n%s %d %s %d", _("Round"), round + 1, _("of"),
+               tests->m_Round_Count
+            );
+         }
+         else
+            xpccut_print("\n%s %d", _("Round"), round + 1);
+
+         if (shuffled)
+         {
+            xpccut_print
+            (
+               ", %s %u", _("shuffle seed"),
+               tests->m_Shuffle_Seed + (unsigned) round
+            );
+         }
+         xpccut_print("\n");
+      }
+      else if (shuffled)
+         xpccut_print("\n%s %u\n", _("Shuffle seed"), tests->m_Shuffle_Seed);
+   }
+}
+
+/**
+ *    Adds a run of a test to the m_Repeats entry of the test.
+ *
+ * \return
+ *    Returns the entry, with the run counted.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_dispose_of_test().
+ */
+
+static const unit_test_repeat_t *
+unit_test_add_repeat
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   int testnumber,                  /**< The test, re 0, assumed valid.       */
+   const unit_test_status_t * status   /**< The run, assumed valid.           */
+)
+{
+   unit_test_repeat_t * result = &tests->m_Repeats[testnumber];
+   double duration_ms = unit_test_status_duration_ms(status);
+   if (result->m_Runs == 0)
+   {
+      result->m_Min_ms = result->m_Max_ms = duration_ms;
+      result->m_Test_Group = unit_test_status_group(status);
+      result->m_Test_Case = unit_test_status_case(status);
+      result->m_Group_Name = status->m_Group_Name;
+      result->m_Case_Name = status->m_Case_Description;
+   }
+   else if (duration_ms < result->m_Min_ms)
+      result->m_Min_ms = duration_ms;
+   else if (duration_ms > result->m_Max_ms)
+      result->m_Max_ms = duration_ms;
+
+   result->m_Runs++;
+   result->m_Total_ms += duration_ms;
+   if (! unit_test_status_passed(status))
+      result->m_Failures++;
+
+   return result;
+}
+
+/**
+ *    Shows the runs of each test after a run of more than one round, with
+ *    --show-progress, and writes them to the --report-format report, as
+ *    one more record per test.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_post_loop().
+ */
+
+static void
+unit_test_show_repeats
+(
+   unit_test_t * tests              /**< The "this pointer", assumed valid.   */
+)
+{
+   cbool_t show = unit_test_options_show_progress(&tests->m_App_Options);
+   int t;
+   for (t = 0; t < tests->m_Test_Count; ++t)
+   {
+      const unit_test_repeat_t * r = &tests->m_Repeats[t];
+      if (r->m_Runs > 0)
+      {
+         xpccut_report_repeats_t repeats;
+         repeats.m_Runs = r->m_Runs;
+         repeats.m_Failures = r->m_Failures;
+         repeats.m_Min_ms = r->m_Min_ms;
+         repeats.m_Mean_ms = r->m_Total_ms / r->m_Runs;
+         repeats.m_Max_ms = r->m_Max_ms;
+         if (show)
+         {
+            xpccut_print
+            (
+               "%3d %02d.%02d: %d %s, %d %s, %.3f/%.3f/%.3f ms %s\n",
+               t + 1, r->m_Test_Group, r->m_Test_Case,
+               repeats.m_Runs, _("runs"), repeats.m_Failures, _("failed"),
+               repeats.m_Min_ms, repeats.m_Mean_ms, repeats.m_Max_ms,
+               _("min/mean/max")
+            );
+         }
+         if (cut_not_nullptr(tests->m_Report_File))
+         {
+            xpccut_report_record_t record;
+            record.m_Group = r->m_Test_Group;
+            record.m_Group_Name = r->m_Group_Name;
+            record.m_Case = r->m_Test_Case;
+            record.m_Case_Name = r->m_Case_Name;
+            record.m_Subtest = 0;
+            record.m_Subtest_Name = "";
+            record.m_Disposition = r->m_Failures > 0 ? "failed" : "passed" ;
+            record.m_Duration_ms = repeats.m_Mean_ms;
+            record.m_Error_Count = r->m_Failures;
+            xpccut_report_repeats
+            (
+               unit_test_options_report_format(&tests->m_App_Options),
+               &record, &repeats
+            );
+            tests->m_Report_Count++;
+         }
+      }
+   }
+}
+
+/**
+ *    Provides the show-progress component of unit_test_run().
+ *    In addition to showing the provided test number, this function also
+ *    sets/increments the unit_test_t.m_Current_Test_Number field.
+ *
+ *    This function is a helper function that is exposed so that the C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *
+ *    The \a testnum field normally is the integer index of the for-loop
+ *    used to iterate over all of the tests that have been loaded.  However,
+ *    the caller can also call this function in a loop until it returns a
+ *    -1 (XPCCUT_NO_CURRENT_TEST).
+ *
+ *    The tests are handed out in load order, unless the --order or
+ *    --shuffle option sets up another order (see unit_test_run_init()).
+ *    Either way, the number returned is the place of the test in the load
+ *    order, so the output and the reports number the tests the same way.
+ *
+ *    With the --repeat or --until-fail option, all of the tests are handed
+ *    out again for each round; m_Order_Position keeps counting through the
+ *    rounds.  A --until-fail run stops at the end of the first round in
+ *    which a test failed.
+ *
+ * \return
+ *    Returns the current test number, re 0.  If there is a problem, or if
+ *    the next test number exceeds the actual number of loaded tests, then
+ *    -1 (XPCCUT_NO_CURRENT_TEST) is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_10()
+ */
+
+int
+unit_test_next_test
+(
+   unit_test_t * tests  /**< "this pointer" for this function, assumed valid. */
+)
+{
+   int result = XPCCUT_NO_CURRENT_TEST;
+   if (xpccut_thisptr(tests))
+   {
+      /*
+       * Since the caller normally provides a for-loop that counts the tests,
+       * we could simply load the index number and show it.
+       *
+       *    tests->m_Current_Test_Number = testnum;
+       *
+       *    . . .
+       *
+       *    xpccut_print("\n%s %3d:  \n", _("TEST"), testnum+1);
+       *
+       * But this puts a burden on the caller and makes the API a tiny bit more
+       * complex.
+       */
+
+      int count = tests->m_Test_Count;
+      int limit = tests->m_Position_Limit > 0 ?
+         tests->m_Position_Limit : count ;
+
+      int position = ++tests->m_Order_Position;          /* position re 0     */
+      cbool_t stop = position >= limit;                  /* no more tests?    */
+      if (! stop && position > 0 && position % count == 0)
+      {
+         stop = tests->m_Total_Errors > 0 &&             /* for --until-fail  */
+            unit_test_options_until_fail(&tests->m_App_Options);
+      }
+      if (stop)
+      {
+         tests->m_Current_Test_Number = position;
+         result = XPCCUT_NO_CURRENT_TEST;                /* no more tests!    */
+      }
+      else
+      {
+         if (position % count == 0)
+            unit_test_start_round(tests, position / count);
+
+         result = unit_test_ordered_test(tests, position);
+         tests->m_Current_Test_Number = result;          /* test number re 0  */
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the post-hoc analysis of the test.
+ *
+ * \return
+ *    Returns 'true' if the tests are supposed to stop immediately.  If
+ *    either the \a tests or \a status parameters are null, this is
+ *    considered an error, but it will not stop the tests
+ *
+ * \sideeffect
+ *    The result of the test is returned in the \a runresult parameter.
+ *    Other unit_test_t fields are modified.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_18()
+ */
+
+cbool_t
+unit_test_dispose_of_test
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_status_t * status,     /**< The status object to update.         */
+   cbool_t * runresult              /**< Output flag for some failure.        */
+)
+{
+   cbool_t result = false;                      /* if true, caller stops loop */
+   cbool_t ok = cut_not_nullptr(status);
+   if (! ok)
+      xpccut_errprint_func(_("null status pointer"));
+
+   if (xpccut_thisptr(tests) && ok)
+   {
+      cbool_t quit = unit_test_dispose(status); /* check test result/options  */
+      int testnumber = tests->m_Current_Test_Number;
+      cbool_t cached = ! unit_test_status_is_skipped(status) &&
+         unit_test_is_cached(tests, testnumber);
+
+      if (cut_not_nullptr(tests->m_Report_File))
+         unit_test_report_test(tests, status, cached);
+
+      if (cached)
+         tests->m_Cached_Count++;
+      else if (! unit_test_status_is_skipped(status))
+      {
+         double duration_ms = unit_test_status_duration_ms(status);
+         cbool_t failed = ! unit_test_status_passed(status);
+         tests->m_Run_Count++;
+         unit_test_add_profile(tests, status);
+         if (cut_not_nullptr(tests->m_Repeats) && testnumber >= 0)
+         {
+            if (testnumber < tests->m_Test_Count)     /* all runs count   */
+            {
+               const unit_test_repeat_t * r =
+                  unit_test_add_repeat(tests, testnumber, status);
+
+               duration_ms = r->m_Total_ms / r->m_Runs;
+               failed = r->m_Failures > 0;
+            }
+         }
+         if (cut_not_nullptr(tests->m_Durations_ms) && testnumber >= 0)
+         {
+            if (testnumber < tests->m_Test_Count)
+               tests->m_Durations_ms[testnumber] = duration_ms;
+         }
+         if (cut_not_nullptr(tests->m_History) && testnumber >= 0)
+         {
+            if (testnumber < tests->m_Test_Count)
+            {
+               unit_test_history_t * h = &tests->m_History[testnumber];
+               h->m_Test_Group = unit_test_status_group(status);
+               h->m_Test_Case = unit_test_status_case(status);
+               h->m_Failed = failed;
+               h->m_Duration_ms = duration_ms;
+            }
+         }
+         if (cut_not_nullptr(tests->m_Cache) && testnumber >= 0)
+         {
+            if (testnumber < tests->m_Test_Count)
+            {
+               tests->m_Cache[testnumber].m_Passed =
+                  unit_test_status_passed(status);
+            }
+         }
+      }
+      if (cut_not_nullptr(runresult))
+         *runresult = unit_test_status_passed(status);
+      else
+         xpccut_errprint_func(_("PROGRAMMER -- null run-result pointer"));
+
+      if (unit_test_status_passed(status))
+      {
+         int zzz = unit_test_options_test_sleep_time(&tests->m_App_Options);
+         if (zzz > 0)
+         {
+            if (unit_test_options_show_progress(&tests->m_App_Options))
+            {
+               xpccut_print
+               (
+                  "  %s %d %s\n",
+                  _("Sleeping"), zzz, _("milliseconds")
+               );
+            }
+            xpccut_ms_sleep(zzz);
+         }
+      }
+      else
+      {
+         tests->m_Total_Errors++;
+         if (tests->m_Total_Errors == 1)
+            tests->m_First_Failed_Status = *status;
+
+         if (tests->m_First_Failed_Test == 0)
+            tests->m_First_Failed_Test = tests->m_Current_Test_Number;
+
+         if (tests->m_First_Failed_Group == 0)
+            tests->m_First_Failed_Group = unit_test_status_group(status);
+
+         if (tests->m_First_Failed_Case == 0)
+            tests->m_First_Failed_Case = unit_test_status_case(status);
+
+         if (tests->m_First_Failed_Subtest == 0)
+         {
+            tests->m_First_Failed_Subtest =
+               unit_test_status_failed_subtest(status);
+         }
+         if (unit_test_options_stop_on_error(&tests->m_App_Options))
+         {
+            if (! xpccut_is_silent())
+            {
+               xpccut_print
+               (
+                  "  %s %d\n",
+                  _("Stop-on-error enabled; failure in TEST"),
+                  unit_test_number(tests)+1
+               );
+            }
+            result = true;
+         }
+      }
+
+      /*
+       * The skip is already noted in the main title, but it makes the
+       * output look better, when no "--verbose" option is being used, if
+       * we show it here.
+       */
+
+      if
+      (
+         unit_test_options_show_progress(&tests->m_App_Options) &&
+            unit_test_options_is_verbose(&tests->m_App_Options)
+      )
+      {
+         if (unit_test_status_is_skipped(status))
+            xpccut_print("  %s\n", _("Skipped"));        /* flush cout */
+      }
+      if (cached && unit_test_options_show_progress(&tests->m_App_Options))
+         xpccut_print("  %s\n", _("Cached pass; not run"));
+      if (quit)
+      {
+         if (unit_test_options_show_progress(&tests->m_App_Options))
+            xpccut_print("  %s\n", _("User requested an end to testing"));
+
+         result = true;
+      }
+      if (result && unit_test_options_is_verbose(&tests->m_App_Options))
+         xpccut_print("%s\n", _("Quitting the tests early"));
+   }
+   return result;
+}
+
+/**
+ *    Provides the post-loop component of unit_test_run().
+ *    This function is a helper function that is exposed so that a C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *    It also finishes the --report-format report, and closes its file,
+ *    and tears down the fixtures that a run that stopped early left up.
+ *    After a run of more than one round, the fewest, mean, and most
+ *    milliseconds of each test are shown, and added to the report.
+ *
+ * \unittests
+ *    No unit-test at this time.  This function has no output or
+ *    side-effects.  One could redirect stdout for the duration of this
+ *    function, but it doesn't strike one as a fruitful option.
+ */
+
+void
+unit_test_post_loop
+(
+   unit_test_t * tests,             /**< "this pointer" for this function.    */
+   cbool_t testresult               /**< Test result the caller had found.    */
+)
+{
+   if (xpccut_thisptr(tests))
+   {
+      xpccut_fixture_release(&tests->m_Fixtures);
+      if (unit_test_options_is_summary(&tests->m_App_Options))
+      {
+         if (! xpccut_is_silent())
+         {
+            xpccut_print
+            (
+               "\n"
+               "%d %s.\n"
+               "%s.\n"
+               ,
+               unit_test_subtest_count(tests), _("sub-tests encountered"),
+               _("Tests summarized, not performed")
+            );
+         }
+      }
+      else
+      {
+         const char * filename = unit_test_options_save_durations_file
+         (
+            &tests->m_App_Options
+         );
+         double duration_ms;
+         xpccut_get_microseconds(&tests->m_End_Time_us);
+         tests->m_End_Ticks = xpccut_get_ticks();
+         if (cut_not_nullptr_2(filename, tests->m_Durations_ms))
+            unit_test_save_durations(tests, filename);
+
+         filename = unit_test_options_history_file(&tests->m_App_Options);
+         if (cut_not_nullptr_2(filename, tests->m_History))
+            unit_test_save_history(tests, filename);
+
+         filename = unit_test_options_cache_file(&tests->m_App_Options);
+         if (cut_not_nullptr_2(filename, tests->m_Cache))
+            unit_test_save_cache(tests, filename);
+
+         filename = unit_test_options_trace_file(&tests->m_App_Options);
+         if (cut_not_nullptr(filename))
+         {
+            xpccut_trace_enable(false);
+            (void) xpccut_trace_export(filename);
+         }
+
+         duration_ms = xpccut_ticks_difference_ms
+         (
+            tests->m_Start_Ticks, tests->m_End_Ticks
+         );
+         if (unit_test_options_show_progress(&tests->m_App_Options))
+         {
+            xpccut_print
+            (
+               "\n------------------------------------------------------------\n"
+            );
+         }
+         if (cut_not_nullptr(tests->m_Repeats))
+            unit_test_show_repeats(tests);
+
+         if (testresult)
+         {
+            if (unit_test_options_show_progress(&tests->m_App_Options))
+            {
+               xpccut_print
+               (
+                  "%d %s.\n%d %s.\n",
+                  unit_test_count(tests),
+                  _("unit-tests completed; all succeeded or were skipped"),
+                  unit_test_subtest_count(tests),
+                  _("sub-tests encountered")
+               );
+            }
+         }
+         else
+         {
+            /*
+             * Here's a quandary -- we want to see errors noted in the
+             * report even if --silent is set, generally.  However, some of
+             * the XPCCUT unit-tests of itself simulate errors, which we
+             * really don't care to see, because we know they're always
+             * failures.
+             */
+
+            if (! xpccut_is_silent())
+            {
+               xpccut_print
+               (
+                  "%d %s (%d %s). %d %s.\n"
+                  "  %s: %d (%s %d, %s %d, %s %d)\n"
+                  ,
+                  unit_test_count(tests), _("tests completed"),
+                  unit_test_subtest_count(tests), _("sub-tests encountered"),
+                  tests->m_Total_Errors, _("failed"),
+                  _("First failed unit-test number"),
+                  tests->m_First_Failed_Test+1,
+                  _("Group"), tests->m_First_Failed_Group,
+                  _("Case"), tests->m_First_Failed_Case,
+                  _("Sub-test"), tests->m_First_Failed_Subtest
+               );
+            }
+         }
+         if (unit_test_options_show_progress(&tests->m_App_Options))
+         {
+            if (tests->m_Cached_Count > 0)
+            {
+               xpccut_print
+               (
+                  "%d %s.\n", tests->m_Cached_Count,
+                  _("tests were cached passes, and were not run")
+               );
+            }
+            xpccut_print
+            (
+               "%s: %4.3f ms\n", _("Full test duration"), duration_ms
+            );
+            xpccut_print
+            (
+               "============================================================\n"
+            );
+         }
+      }
+      unit_test_close_report(tests);
+   }
+}
+
+/**
+ *    Checks the sub-test count for the caller.
+ *    This function is a helper function that is exposed so that a C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *
+ * \return
+ *    If at least one subtest was counted, this function returns the number
+ *    of sub-tests counted (in the current test-case function).  If no
+ *    sub-tests were counted, but the --require-sub-test option is not
+ *    activated, then 0 is returned.  Otherwise, -1 (XPCCUT_NO_CURRENT_TEST)
+ *    is returned, and the caller should exit its test-loop.
+ *
+ * \sideeffect
+ *    The valid sub-test count is added to the current value of
+ *    m_Subtest_Count.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_23()
+ */
+
+int
+unit_test_check_subtests
+(
+   unit_test_t * tests,                /**< "this pointer" for this function. */
+   const unit_test_status_t * status   /**< The ownder of the sub-test count. */
+)
+{
+   int result = XPCCUT_NO_CURRENT_TEST;
+   if (xpccut_thisptr(tests))
+   {
+      /*
+       * Keep track of all the sub-test counts encountered.
+       */
+
+      int subtest_count = unit_test_status_subtest(status);
+      if (subtest_count > 0)
+      {
+         tests->m_Subtest_Count += subtest_count;
+         result = subtest_count;
+      }
+      else
+      {
+         if (subtest_count == XPCCUT_INVALID_PARAMETER)
+         {
+            /* Generally due to a stock null pointer error. */
+         }
+         else
+         {
+            /*
+             * Not sure we like this option, so it is false by default.
+             */
+
+            if (unit_test_options_need_subtests(&tests->m_App_Options))
+               xpccut_errprint_func(_("PROGRAMMER--no subtests encountered"));
+            else
+               result = 0;
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides a compile-time option.
+ *    It selects how to display the test result.
+ *    There are no plans as yet to change this value.  In fact, I don't
+ *    remember why I changed the format of the output!  Doh!
+ */
+
+static cbool_t g_use_one_line = false;
+
+/**
+ *    Shows the result of a unit-test that has already run and been timed.
+ *    This function is the output part of unit_test_run_a_test_after().  It
+ *    is split out so that the --jobs worker pool can show the results in
+ *    the main thread, in load order, without timing the tests a second
+ *    time.
+ *
+ *    Under the --profile option, a second line shows the resources used by
+ *    the test:  its user and system CPU time, the growth of the peak
+ *    resident set, its minor/major page faults, and its
+ *    voluntary/involuntary context switches.
+ *
+ *    The output of the test, which has been building up in the output
+ *    buffer, is flushed here, so the output of a test is written in one
+ *    batch.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_a_test_after() and
+ *       unit_test_run_jobs().
+ */
+
+static void
+unit_test_show_result
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_status_t * status      /**< The status, assumed valid.           */
+)
+{
+   cbool_t show_result =
+   (
+      ! unit_test_status_is_skipped(status) &&
+      ! unit_test_options_is_summary(&tests->m_App_Options)
+   );
+   if (show_result)
+   {
+      if (unit_test_options_show_progress(&tests->m_App_Options))
+      {
+         if (g_use_one_line)
+         {
+            xpccut_print
+            (
+               "  %s %2d '%s'  %s %2d '%s' %s %2d:\n  %s",     /* (no \n)  */
+               _("Group"),
+               unit_test_status_group(status),
+               unit_test_status_group_name(status),
+               _("Case"),
+               unit_test_status_case(status),
+               unit_test_status_case_name(status),
+               _("through Subtest"),
+               unit_test_status_subtest(status),
+               unit_test_status_passed(status) ? _("PASSED") : _("FAILED")
+            );
+         }
+         else
+         {
+            xpccut_print
+            (
+               "  %12s %2d '%s'\n  %12s %2d '%s'\n  %12s %2d %s:\n  %s",
+               _("Group"),
+               unit_test_status_group(status),
+               unit_test_status_group_name(status),
+               _("Case"),
+               unit_test_status_case(status),
+               unit_test_status_case_name(status),
+               _("Subtests"),
+               unit_test_status_subtest(status),
+               _("and below"),
+               unit_test_status_passed(status) ? _("PASSED") : _("FAILED")
+            );
+         }
+         if (unit_test_status_duration_ms(status) >= 0.001)
+         {
+            xpccut_print
+            (
+               " (%4.3f ms)", unit_test_status_duration_ms(status)
+            );
+         }
+         else
+         {
+            xpccut_print(" (less than 0.001 ms)");
+         }
+         if (unit_test_status_error_count(status) > 1)
+         {
+            /*
+             * More than one sub-test failed, so show the number of them
+             * that failed, as well as the first one that failed.
+             */
+
+            xpccut_print
+            (
+               "\n  %d %s. %s: %d\n",
+               unit_test_status_error_count(status),
+               _("subtests failed"), _("First failed sub-test"),
+               unit_test_status_failed_subtest(status)
+            );
+         }
+         else if (unit_test_status_failed(status))
+         {
+            /*
+             * Only one sub-test failed, so just show that one.
+             */
+
+            xpccut_print
+            (
+               " %s %d\n", _("at sub-test"),
+               unit_test_status_failed_subtest(status)
+            );
+         }
+         else
+            xpccut_print("\n");
+
+         if (cut_not_nullptr(unit_test_status_resources(status)))
+         {
+            const xpccut_resources_t * r = unit_test_status_resources(status);
+            xpccut_print
+            (
+               "  %s: %s %.3f ms, %s %.3f ms, RSS +%ld kB, "
+               "%s %ld/%ld, %s %ld/%ld\n",
+               _("Profile"), _("user"), r->m_User_ms, _("sys"), r->m_System_ms,
+               r->m_Max_RSS_kb, _("faults"), r->m_Minor_Faults,
+               r->m_Major_Faults, _("switches"),
+               r->m_Voluntary_Switches, r->m_Involuntary_Switches
+            );
+         }
+         if (cut_not_nullptr(unit_test_status_counters(status)))
+         {
+            xpccut_perf_show
+            (
+               _("Counters"), unit_test_status_counters(status), 1.0
+            );
+         }
+      }
+      if (unit_test_options_is_pause(&tests->m_App_Options))
+         unit_test_pause(tests);
+   }
+   else
+   {
+      /*
+       * This is normally true, but in long tests it shows nothing but
+       * the text below, causing any test that did run to scroll off the
+       * screen.  Therefore, we make the caller specify it on the command
+       * line, using the --verbose option.
+       *
+       *    unit_test_options_show_progress(&tests->m_App_Options)
+       */
+
+      if
+      (
+         unit_test_status_is_skipped(status) &&
+         unit_test_options_is_verbose(&tests->m_App_Options)
+      )
+      {
+         xpccut_print("  %s.\n", _("This test was skipped"));
+      }
+   }
+   xpccut_output_flush();
+}
+
+/**
+ *    Runs one loaded C unit-test function on behalf of unit_test_run_jobs().
+ *    This function is the unit_test_job_func_t that unit_test_run() hands
+ *    to the worker pool.  It does what unit_test_run_a_test() does, except
+ *    that it reads only the test list, never writes to the unit_test_t
+ *    structure, and does not show the result.  That makes it safe to call
+ *    from more than one thread at once.
+ *
+ * \return
+ *    Returns the timed status of the unit-test.  If the test-function
+ *    pointer is null, a failed status is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_24()
+ */
+
+static unit_test_status_t
+unit_test_run_a_job
+(
+   void * context,                  /**< The unit_test_t that owns the tests. */
+   int testnumber,                  /**< Index of the test to run, re 0.      */
+   const unit_test_options_t * options /**< Private options of the worker.   */
+)
+{
+   unit_test_status_t result;
+   const unit_test_t * tests = (const unit_test_t *) context;
+   unit_test_func_t test = tests->m_Test_Cases[testnumber];
+   unit_test_status_init(&result);
+   if (cut_not_nullptr(test))
+   {
+      result = (*test)(options);                            /* run the test   */
+      (void) unit_test_status_time_delta(&result, false);   /* time it        */
+   }
+   else
+   {
+      (void) unit_test_status_fail(&result);
+      xpccut_errprint_func(_("test-function pointer null"));
+   }
+   return result;
+}
+
+/**
+ *    Hands off the status of a test that ran against a private copy of the
+ *    options.  The status will outlive that copy, so it is pointed back to
+ *    the options of the unit_test_t structure before it is disposed of.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_adopt_status
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_status_t * status      /**< The status to adopt, assumed valid.  */
+)
+{
+   if (cut_not_nullptr(status->m_Test_Options))
+      status->m_Test_Options = &tests->m_App_Options;
+}
+
+/**
+ *    Makes the name under which a test is recorded in the trace, such as
+ *    "Test 04.22 unit_test_run_a_test()".  The name is interned, so it
+ *    lasts until the trace is written out.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the name, or null if the trace is not enabled.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_08() [indirect test]
+ */
+
+static const char *
+unit_test_trace_name
+(
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   int testnumber                   /**< Index of the test, re 0.             */
+)
+{
+   const char * result = nullptr;
+   if
+   (
+      xpccut_trace_is_enabled() &&
+      testnumber >= 0 && testnumber < tests->m_Test_Count
+   )
+   {
+      const unit_test_info_t * info = &tests->m_Test_Info[testnumber];
+      char temp[XPCCUT_STRLEN];
+      snprintf
+      (
+         temp, sizeof temp, "%s %02d.%02d %s", _("Test"),
+         info->m_Test_Group, info->m_Test_Case,
+         cut_not_nullptr(info->m_Case_Name) ? info->m_Case_Name : ""
+      );
+      result = xpccut_intern(temp);
+   }
+   return result;
+}
+
+/**
+ *    Runs one job for the worker pool or the child processes, unless
+ *    unit_test_skip_a_test() decides that the test is not to be called.
+ *    The test number is put in the test context of the calling thread for
+ *    the duration of the job, so that \a options can be shared.  The blocks
+ *    that the test takes from the test arena are freed when it returns.
+ *
+ *    If \a watched is set, the watchdog enforces the timeout of the test.
+ *    A child process does not set it, since its parent does the watching.
+ *
+ * \return
+ *    Returns the timed status of the unit-test.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs() and
+ *       unit_test_skip_a_test().
+ */
+
+static unit_test_status_t
+unit_test_run_job
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context,                  /**< The first parameter of \a job.       */
+   int testnumber,                  /**< Index of the test to run, re 0.      */
+   const unit_test_options_t * options, /**< The options for the test.       */
+   cbool_t watched                  /**< Apply the timeout in this process.   */
+)
+{
+   unit_test_status_t result;
+   unit_test_options_context_set(testnumber);
+   if
+   (
+      unit_test_skip_a_test(tests, testnumber, options, &result) ||
+      ! unit_test_fixture_enter(tests, testnumber, options, &result)
+   )
+   {
+      (void) unit_test_status_time_delta(&result, false);
+   }
+   else
+   {
+      xpccut_watch_t watch;
+      xpccut_arena_mark_t mark;
+      const char * tracename = unit_test_trace_name(tests, testnumber);
+      xpccut_arena_mark(xpccut_test_arena(), &mark);
+      if (cut_not_nullptr(tracename))
+         xpccut_trace_enter(tracename);
+
+      if (watched)
+         unit_test_watchdog_arm(tests, testnumber, &watch);
+
+      result = (*job)(context, testnumber, options);
+      if (watched)
+         unit_test_watchdog_disarm(&watch, &result);
+
+      if (cut_not_nullptr(tracename))
+         xpccut_trace_exit(tracename);
+
+      xpccut_arena_rewind(xpccut_test_arena(), &mark);
+   }
+   unit_test_fixture_leave(tests, testnumber);
+   unit_test_options_context_set(XPCCUT_NO_CURRENT_TEST);
+   return result;
+}
+
+/**
+ *    Runs the jobs one after the other, in the calling thread.  This is the
+ *    fall-back for unit_test_run_jobs() when no worker threads are
+ *    available.  The loop is the same as the one in unit_test_run().
+ *
+ * \return
+ *    Returns 'true' if no test failed.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static cbool_t
+unit_test_run_jobs_serially
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context                   /**< The first parameter of \a job.       */
+)
+{
+   cbool_t result = true;
+   int testnumber;
+   while ((testnumber = unit_test_next_test(tests)) >= 0)
+   {
+      unit_test_status_t testresult = unit_test_run_job
+      (
+         tests, job, context, testnumber, &tests->m_App_Options, true
+      );
+      unit_test_adopt_status(tests, &testresult);
+      unit_test_show_result(tests, &testresult);
+      if (unit_test_check_subtests(tests, &testresult) < 0)
+         break;
+
+      if (unit_test_dispose_of_test(tests, &testresult, &result))
+         break;
+   }
+   return tests->m_Total_Errors == 0;
+}
+
+/**
+ *    Decides if unit_test_run() should hand the tests to the worker pool.
+ *    This function is a helper function that is exposed so that the C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *
+ *    The --jobs option must be greater than 1, or the --isolate option
+ *    must be set.  The options that stop to
+ *    talk to the user (--interactive and --case-pause), and the
+ *    --summarize option, whose output comes from the test functions
+ *    themselves, force the tests to run one at a time.
+ *
+ * \return
+ *    Returns 'true' if unit_test_run_jobs() should be used.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_24()
+ */
+
+cbool_t
+unit_test_use_jobs
+(
+   const unit_test_t * tests        /**< The "this pointer" for this test.    */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+   {
+      const unit_test_options_t * options = &tests->m_App_Options;
+      result =
+      (
+         (
+            unit_test_options_job_count(options) > 1 ||
+            unit_test_options_is_isolated(options)
+         ) &&
+         ! unit_test_options_is_interactive(options) &&
+         ! unit_test_options_is_pause(options) &&
+         ! unit_test_options_is_summary(options)
+      );
+   }
+   return result;
+}
+
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+
+/**
+ *    Holds the state shared by the main thread and the worker threads of
+ *    unit_test_run_jobs().  Everything below m_Context is protected by
+ *    m_Lock.
+ */
+
+typedef struct
+{
+   /**
+    *    The test battery being run.  The workers read only the test count
+    *    from it; the \a job function may read the test list.
+    */
+
+   unit_test_t * m_Tests;
+
+   /**
+    *    The function that runs one test.
+    */
+
+   unit_test_job_func_t m_Job;
+
+   /**
+    *    The first parameter passed to m_Job.
+    */
+
+   void * m_Context;
+
+   /**
+    *    The options that all of the workers run their tests against.  This
+    *    is the one copy of the options of the run, made before the workers
+    *    start, with the progress output turned off.  It is not changed
+    *    while they run, so it needs no lock.
+    */
+
+   unit_test_options_t m_Options;
+
+   /**
+    *    One status per loaded test for each round of the window, indexed
+    *    by unit_test_round_slot().
+    */
+
+   unit_test_status_t * m_Results;
+
+   /**
+    *    One flag per slot, set when its m_Results slot is filled, and
+    *    cleared when the main thread takes the result.
+    */
+
+   cbool_t * m_Done;
+
+   /**
+    *    One block of captured output per slot, or null if the test made no
+    *    output.  The main thread replays each block when it shows the
+    *    result of the test.
+    */
+
+   char ** m_Output;
+
+   /**
+    *    The size of each block in m_Output.
+    */
+
+   int * m_Output_Sizes;
+
+   /**
+    *    The position of the next test that a worker should pick up.
+    */
+
+   int m_Next_Test;
+
+   /**
+    *    The number of positions that the main thread has disposed of.  A
+    *    worker can start a test only in the m_Window_Rounds rounds from
+    *    the one being disposed of, so that its slot is free.
+    */
+
+   int m_Disposed;
+
+   /**
+    *    Set while a worker runs a test marked by unit_test_load_serial().
+    *    No other worker picks up a test until it is cleared.
+    */
+
+   cbool_t m_Exclusive;
+
+   /**
+    *    Set by the main thread when the tests are to stop early.  The
+    *    workers then finish the test in hand, and pick up no more.
+    */
+
+   cbool_t m_Stop;
+
+   /**
+    *    Protects the fields above.
+    */
+
+   pthread_mutex_t m_Lock;
+
+   /**
+    *    Signalled by a worker each time it finishes a test, and by the main
+    *    thread each time it disposes of one or stops the workers.
+    */
+
+   pthread_cond_t m_Finished;
+
+} unit_test_pool_t;
+
+/**
+ *    Holds the private state of one worker thread.
+ */
+
+typedef struct
+{
+   /**
+    *    The pool that the worker takes tests from.
+    */
+
+   unit_test_pool_t * m_Pool;
+
+   /**
+    *    The handle of the thread.
+    */
+
+   pthread_t m_Thread;
+
+} unit_test_worker_t;
+
+/**
+ *    The thread function of a worker.  It takes the next test position
+ *    from the pool, runs its test against its own options and status, and
+ *    then posts the status, and the output captured while the test ran,
+ *    into the slot for that position.  It repeats until the tests run out
+ *    or the main thread asks it to stop.  A worker that gets too far ahead
+ *    of the main thread waits for it to catch up.
+ *
+ *    A test marked by unit_test_load_serial() waits until the main thread
+ *    has disposed of every test before it, so that no other test runs and
+ *    the main thread shows nothing while it runs; the other workers then
+ *    wait until it is done.
+ *
+ * \return
+ *    Always returns a null pointer.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void *
+unit_test_pool_worker
+(
+   void * arg                       /**< The unit_test_worker_t of the thread. */
+)
+{
+   unit_test_worker_t * worker = (unit_test_worker_t *) arg;
+   unit_test_pool_t * pool = worker->m_Pool;
+   const unit_test_t * tests = pool->m_Tests;
+   int count = tests->m_Test_Count;
+   for (;;)
+   {
+      unit_test_status_t testresult;
+      char * output;
+      int outputsize;
+      int slot = 0;
+      int testnumber = XPCCUT_NO_CURRENT_TEST;
+      pthread_mutex_lock(&pool->m_Lock);
+      while
+      (
+         ! pool->m_Stop && pool->m_Next_Test < tests->m_Position_Limit &&
+         (
+            pool->m_Next_Test / count >=
+               pool->m_Disposed / count + tests->m_Window_Rounds ||
+            pool->m_Exclusive ||
+            (
+               pool->m_Disposed < pool->m_Next_Test &&
+               unit_test_test_is_serial
+               (
+                  tests, unit_test_scheduled_test(tests, pool->m_Next_Test)
+               )
+            )
+         )
+      )
+      {
+         pthread_cond_wait(&pool->m_Finished, &pool->m_Lock);
+      }
+      if (! pool->m_Stop && pool->m_Next_Test < tests->m_Position_Limit)
+      {
+         int position = pool->m_Next_Test++;
+         testnumber = unit_test_scheduled_test(tests, position);
+         slot = unit_test_round_slot(tests, position, testnumber);
+         pool->m_Exclusive = unit_test_test_is_serial(tests, testnumber);
+      }
+      pthread_mutex_unlock(&pool->m_Lock);
+      if (testnumber == XPCCUT_NO_CURRENT_TEST)
+         break;
+
+      xpccut_output_capture_begin();
+      testresult = unit_test_run_job
+      (
+         pool->m_Tests, pool->m_Job, pool->m_Context, testnumber,
+         &pool->m_Options, true
+      );
+      output = xpccut_output_capture_end(&outputsize);
+      unit_test_adopt_status(pool->m_Tests, &testresult);
+      pthread_mutex_lock(&pool->m_Lock);
+      pool->m_Results[slot] = testresult;
+      pool->m_Output[slot] = output;
+      pool->m_Output_Sizes[slot] = outputsize;
+      pool->m_Done[slot] = true;
+      pool->m_Exclusive = false;
+      pthread_cond_broadcast(&pool->m_Finished);
+      pthread_mutex_unlock(&pool->m_Lock);
+   }
+   xpccut_perf_release();                    /* close counters of thread  */
+   xpccut_test_arena_release();              /* free the scratch chunks   */
+   return nullptr;
+}
+
+#endif   /* XPC_HAVE_PTHREAD_H && ! defined WIN32 */
+
+/**
+ *    Shows the "TEST nnn" banner and title for a test that ran in a worker
+ *    or in a child process.  These run with progress output turned off, so
+ *    the main thread shows what unit_test_status_initialize() would have
+ *    shown, just before it shows the result.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_pool_show_title
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_status_t * status      /**< The status, assumed valid.           */
+)
+{
+   if (! unit_test_status_is_skipped(status))
+   {
+      if (unit_test_options_show_progress(&tests->m_App_Options))
+      {
+         const char * tag = _("TEST");
+         if (unit_test_options_is_simulated(&tests->m_App_Options))
+            tag = _("Simulated TEST");
+
+         xpccut_print
+         (
+            "\n%s %3d:  \n", tag, tests->m_Current_Test_Number + 1
+         );
+      }
+      if (cut_not_nullptr(status->m_Test_Options))
+         (void) unit_test_status_show_title(status);
+   }
+}
+
+#if XPCCUT_USE_FORK
+
+/**
+ *    Holds the state of one child process of unit_test_run_isolated().
+ */
+
+typedef struct
+{
+   /**
+    *    The process ID of the child, or 0 if the slot is free.
+    */
+
+   pid_t m_Pid;
+
+   /**
+    *    The read end of the pipe on which the child sends back its status.
+    */
+
+   int m_Fd;
+
+   /**
+    *    The index of the test that the child is running, re 0.
+    */
+
+   int m_Test_Number;
+
+   /**
+    *    The slot, from unit_test_round_slot(), into which the status of the
+    *    test goes.
+    */
+
+   int m_Slot;
+
+   /**
+    *    The message received from the child so far.  It is the status of
+    *    the test, followed by its group, case, and sub-test names, each
+    *    ending with a null, and by the entries of its failure log, each a
+    *    thread and a sub-test number followed by the name of the sub-test.
+    *    The names and the log are sent apart from the status, because the
+    *    status only points to them, and the pointers of the child mean
+    *    nothing in the parent.
+    */
+
+   char * m_Message;
+
+   /**
+    *    The number of bytes of m_Message received so far.
+    */
+
+   size_t m_Bytes;
+
+   /**
+    *    The number of bytes allocated for m_Message.
+    */
+
+   size_t m_Capacity;
+
+   /**
+    *    Set if the child was killed for running past the --test-timeout
+    *    value.
+    */
+
+   cbool_t m_Timed_Out;
+
+   /**
+    *    The time at which the child was started.
+    */
+
+   struct timeval m_Start_Time_us;
+
+   /**
+    *    The monotonic time at which the child was started, from which its
+    *    elapsed time is measured.
+    */
+
+   xpccut_ticks_t m_Start_Ticks;
+
+   /**
+    *    The status sent back by the child, with its names interned in the
+    *    parent.
+    */
+
+   unit_test_status_t m_Status;
+
+} unit_test_child_t;
+
+/**
+ *    Provides the number of milliseconds left before a child runs past
+ *    the timeout of its test.
+ *
+ * \return
+ *    Returns the time left, which is 0 if the child has run out of time.
+ *    If there is no timeout, -1 is returned, as for the poll() function.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static int
+unit_test_child_time_left
+(
+   const unit_test_child_t * child, /**< The child, assumed valid and busy.   */
+   int timeout                      /**< The timeout of the test, in ms.      */
+)
+{
+   int result = -1;
+   if (timeout > 0)
+   {
+      double elapsed = xpccut_ticks_difference_ms
+      (
+         child->m_Start_Ticks, xpccut_get_ticks()
+      );
+      result = elapsed >= (double) timeout ?
+         0 : timeout - (int) elapsed ;
+   }
+   return result;
+}
+
+/**
+ *    Builds the status of a test whose child process did not send back a
+ *    status of its own, because it crashed, exited early, or was killed for
+ *    taking too long.  The test counts as a failure in its single sub-test,
+ *    and the rest of the tests still run.  The group and case numbers were
+ *    never sent back, so they are set to XPCCUT_NO_CURRENT_TEST.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_child_failed
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_child_t * child,       /**< The child, assumed valid.            */
+   int waitstatus                   /**< The status given by waitpid().       */
+)
+{
+   unit_test_status_t * status = &child->m_Status;
+   char reason[XPCCUT_STRLEN];
+   char groupname[XPCCUT_STRLEN];
+   if (child->m_Timed_Out)
+   {
+      snprintf
+      (
+         reason, sizeof reason, "%s %d ms", _("timed out after"),
+         unit_test_test_timeout(tests, child->m_Test_Number)
+      );
+   }
+   else if (WIFSIGNALED(waitstatus))
+   {
+      snprintf
+      (
+         reason, sizeof reason, "%s %d",
+         _("killed by signal"), WTERMSIG(waitstatus)
+      );
+   }
+   else if (WIFEXITED(waitstatus) && WEXITSTATUS(waitstatus) != 0)
+   {
+      snprintf
+      (
+         reason, sizeof reason, "%s %d",
+         _("exited with status"), WEXITSTATUS(waitstatus)
+      );
+   }
+   else
+      snprintf(reason, sizeof reason, "%s", _("sent back no status"));
+
+   (void) unit_test_status_init(status);
+   status->m_Test_Options = &tests->m_App_Options;
+   snprintf
+   (
+      groupname, sizeof groupname, "%s %d",
+      _("Isolated test"), child->m_Test_Number + 1
+   );
+   status->m_Group_Name = xpccut_intern_in(&tests->m_Names, groupname);
+   status->m_Case_Description = xpccut_intern_in(&tests->m_Names, reason);
+   status->m_Subtest_Name = status->m_Case_Description;
+   status->m_Test_Group = XPCCUT_NO_CURRENT_TEST;   /* never reported    */
+   status->m_Test_Case = XPCCUT_NO_CURRENT_TEST;
+   status->m_Subtest = 1;
+   status->m_Failed_Subtest = 1;
+   status->m_Subtest_Error_Count = 1;
+   status->m_Test_Result = false;
+   status->m_Test_Disposition = XPCCUT_DISPOSITION_FAILED;
+   status->m_Start_Time_us = child->m_Start_Time_us;
+   status->m_Start_Ticks = child->m_Start_Ticks;
+   (void) unit_test_status_time_delta(status, false);
+   if (! xpccut_is_silent())
+   {
+      xpccut_print_error
+      (
+         "? %s %d: %s\n", _("TEST"), child->m_Test_Number + 1, reason
+      );
+   }
+}
+
+/**
+ *    Unpacks the message sent back by a child into its m_Status field,
+ *    pointing the names of the status at copies of the names in the
+ *    message, interned in the table of the run.  The failure log of the
+ *    child is entered again in a log of the parent, with its names
+ *    interned the same way.
+ *
+ * \return
+ *    Returns 'true' if the whole message arrived.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static cbool_t
+unit_test_child_unpack
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_child_t * child        /**< The child, assumed valid.            */
+)
+{
+   cbool_t result = child->m_Bytes > sizeof(unit_test_status_t);
+   if (result)
+   {
+      const char * names[3];
+      unit_test_failure_t log[XPCCUT_FAILURE_LOG_SIZE];
+      int logged = 0;
+      size_t offset = sizeof(unit_test_status_t);
+      int n;
+      for (n = 0; n < 3 && result; ++n)
+      {
+         const char * end = memchr
+         (
+            child->m_Message + offset, 0, child->m_Bytes - offset
+         );
+         names[n] = child->m_Message + offset;
+         result = cut_not_nullptr(end);
+         if (result)
+            offset = (size_t) (end - child->m_Message) + 1;
+      }
+      while (result && offset < child->m_Bytes)
+      {
+         int numbers[2];                        /* thread and sub-test     */
+         const char * end = nullptr;
+         result = logged < XPCCUT_FAILURE_LOG_SIZE &&
+            child->m_Bytes - offset > sizeof numbers;
+
+         if (result)
+         {
+            memcpy(numbers, child->m_Message + offset, sizeof numbers);
+            offset += sizeof numbers;
+            end = memchr
+            (
+               child->m_Message + offset, 0, child->m_Bytes - offset
             );
+            result = cut_not_nullptr(end);
          }
-         xpccut_get_microseconds(&tests->m_Start_Time_us);
+         if (result)
+         {
+            log[logged].m_Thread = numbers[0];
+            log[logged].m_Subtest = numbers[1];
+            log[logged].m_Subtest_Name = child->m_Message + offset;
+            ++logged;
+            offset = (size_t) (end - child->m_Message) + 1;
+         }
+      }
+      if (result)
+         result = offset == child->m_Bytes;
+
+      if (result)
+      {
+         unit_test_status_t * status = &child->m_Status;
+         int failures;
+         int f;
+         memcpy(status, child->m_Message, sizeof *status);
+         unit_test_adopt_status(tests, status);
+         status->m_Group_Name = xpccut_intern_in(&tests->m_Names, names[0]);
+         status->m_Case_Description =
+            xpccut_intern_in(&tests->m_Names, names[1]);
+
+         status->m_Subtest_Name = xpccut_intern_in(&tests->m_Names, names[2]);
+         failures = status->m_Failure_Count;
+         status->m_Failure_Count = 0;
+         status->m_Failures = nullptr;          /* the log of the child    */
+         for (f = 0; f < logged; ++f)
+         {
+            (void) unit_test_status_failure_add
+            (
+               status, log[f].m_Thread, log[f].m_Subtest,
+               log[f].m_Subtest_Name
+            );
+         }
+         status->m_Failure_Count = failures;    /* some were not logged    */
+      }
+   }
+   return result;
+}
+
+/**
+ *    Appends the bytes read from a child to its message, growing the
+ *    message as needed.  A message that cannot grow is cut short, which
+ *    unit_test_child_unpack() will treat as a failure of the child.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_child_receive
+(
+   unit_test_child_t * child,       /**< The child, assumed valid.            */
+   const char * data,               /**< The bytes that were read.            */
+   size_t count                     /**< The number of bytes read.            */
+)
+{
+   if (child->m_Bytes + count > child->m_Capacity)
+   {
+      size_t capacity = child->m_Capacity > 0 ?
+         child->m_Capacity : sizeof(unit_test_status_t) + XPCCUT_STRLEN ;
+
+      char * message;
+      while (capacity < child->m_Bytes + count)
+         capacity *= 2;
+
+      message = realloc(child->m_Message, capacity);
+      if (cut_not_nullptr(message))
+      {
+         child->m_Message = message;
+         child->m_Capacity = capacity;
+      }
+      else
+         count = child->m_Capacity - child->m_Bytes;
+   }
+   if (count > 0)
+   {
+      memcpy(child->m_Message + child->m_Bytes, data, count);
+      child->m_Bytes += count;
+   }
+}
+
+/**
+ *    Writes all of a block of bytes to the pipe back to the parent.
+ *
+ * \return
+ *    Returns 'true' if all of the bytes were written.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static cbool_t
+unit_test_child_send
+(
+   int fd,                          /**< The write end of the pipe.           */
+   const char * data,               /**< The bytes to be written.             */
+   size_t left                      /**< The number of bytes to be written.   */
+)
+{
+   while (left > 0)
+   {
+      ssize_t count = write(fd, data, left);
+      if (count > 0)
+      {
+         data += count;
+         left -= (size_t) count;
+      }
+      else if (count < 0 && errno == EINTR)
+         continue;
+      else
+         break;
+   }
+   return left == 0;
+}
+
+/**
+ *    Collects a child process that has closed its end of the pipe, or that
+ *    has been killed, and posts its status into the slot for its test.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_child_reap
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_child_t * child,       /**< The child, assumed valid and busy.   */
+   unit_test_status_t * results,    /**< One status per slot.                 */
+   cbool_t * done                   /**< One flag per slot.                   */
+)
+{
+   int waitstatus = 0;
+   (void) close(child->m_Fd);
+   while (waitpid(child->m_Pid, &waitstatus, 0) < 0 && errno == EINTR)
+      ;
+
+   if
+   (
+      ! child->m_Timed_Out && unit_test_child_unpack(tests, child) &&
+      WIFEXITED(waitstatus) && WEXITSTATUS(waitstatus) == 0
+   )
+   {
+      unit_test_adopt_status(tests, &child->m_Status);
+   }
+   else
+      unit_test_child_failed(tests, child, waitstatus);
+
+   results[child->m_Slot] = child->m_Status;
+   done[child->m_Slot] = true;
+   child->m_Pid = 0;
+   free(child->m_Message);
+   child->m_Message = nullptr;
+   child->m_Bytes = child->m_Capacity = 0;
+}
+
+/**
+ *    Starts a child process to run one test.  The child runs \a job against
+ *    its own copy of the options, writes the resulting status, its names,
+ *    and its failure log to a pipe, and exits without running any exit
+ *    handlers of the parent.  A fixture that the test needs is set up in
+ *    the child, and torn down in the child before it exits.
+ *
+ * \return
+ *    Returns 'true' if the child was started.  Otherwise, the caller can
+ *    run the test in its own process.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static cbool_t
+unit_test_child_start
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_child_t * child,       /**< A free slot for the child.           */
+   int testnumber,                  /**< Index of the test to run, re 0.      */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context,                  /**< The first parameter of \a job.       */
+   const unit_test_options_t * options /**< Options with progress turned off. */
+)
+{
+   cbool_t result = false;
+   int fds[2];
+   if (pipe(fds) == 0)
+   {
+      pid_t pid;
+      xpccut_output_flush();                 /* don't copy unwritten output   */
+      pid = fork();
+      if (pid == 0)
+      {
+         unit_test_status_t status;
+         cbool_t sent;
+         int f;
+         (void) close(fds[0]);
+         status = unit_test_run_job
+         (
+            tests, job, context, testnumber, options, false
+         );
+         xpccut_fixture_release(&tests->m_Fixtures);
+         sent = unit_test_child_send
+         (
+            fds[1], (const char *) &status, sizeof status
+         );
+         if (sent)
+         {
+            sent = unit_test_child_send
+            (
+               fds[1], status.m_Group_Name, strlen(status.m_Group_Name) + 1
+            );
+         }
+         if (sent)
+         {
+            sent = unit_test_child_send
+            (
+               fds[1], status.m_Case_Description,
+               strlen(status.m_Case_Description) + 1
+            );
+         }
+         if (sent)
+         {
+            sent = unit_test_child_send
+            (
+               fds[1], status.m_Subtest_Name, strlen(status.m_Subtest_Name) + 1
+            );
+         }
+         for (f = 0; f < XPCCUT_FAILURE_LOG_SIZE && sent; ++f)
+         {
+            const unit_test_failure_t * entry =
+               unit_test_status_failure(&status, f);
+
+            if (cut_not_nullptr(entry))
+            {
+               int numbers[2];
+               numbers[0] = entry->m_Thread;
+               numbers[1] = entry->m_Subtest;
+               sent = unit_test_child_send
+               (
+                  fds[1], (const char *) numbers, sizeof numbers
+               );
+               if (sent)
+               {
+                  sent = unit_test_child_send
+                  (
+                     fds[1], entry->m_Subtest_Name,
+                     strlen(entry->m_Subtest_Name) + 1
+                  );
+               }
+            }
+         }
+         xpccut_output_flush();
+         _exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+      }
+      (void) close(fds[1]);
+      if (pid > 0)
+      {
+         child->m_Pid = pid;
+         child->m_Fd = fds[0];
+         child->m_Test_Number = testnumber;
+         child->m_Message = nullptr;
+         child->m_Bytes = 0;
+         child->m_Capacity = 0;
+         child->m_Timed_Out = false;
+         (void) xpccut_get_microseconds(&child->m_Start_Time_us);
+         child->m_Start_Ticks = xpccut_get_ticks();
+         result = true;
+      }
+      else
+      {
+         (void) close(fds[0]);
+         xpccut_errprint_func(_("could not start a child process"));
+      }
+   }
+   else
+      xpccut_errprint_func(_("could not create a pipe"));
+
+   return result;
+}
+
+/**
+ *    Waits until at least one busy child sends data, exits, or runs out of
+ *    time, and handles each of those events.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
+ */
+
+static void
+unit_test_child_poll
+(
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_child_t * children,    /**< The slots, at least one busy.        */
+   struct pollfd * fds,             /**< Scratch space, one per slot.         */
+   int slots,                       /**< The number of slots.                 */
+   unit_test_status_t * results,    /**< One status per test slot.            */
+   cbool_t * done                   /**< One flag per test slot.              */
+)
+{
+   int wait_ms = -1;
+   int s;
+   for (s = 0; s < slots; ++s)
+   {
+      fds[s].fd = children[s].m_Pid != 0 ? children[s].m_Fd : -1 ;
+      fds[s].events = POLLIN;
+      fds[s].revents = 0;
+      if (children[s].m_Pid != 0)
+      {
+         int left = unit_test_child_time_left
+         (
+            &children[s],
+            unit_test_test_timeout(tests, children[s].m_Test_Number)
+         );
+         if (left >= 0 && (wait_ms < 0 || left < wait_ms))
+            wait_ms = left;
+      }
+   }
+   if (poll(fds, (nfds_t) slots, wait_ms) < 0 && errno != EINTR)
+      xpccut_errprint_func(_("poll() failed"));
+
+   for (s = 0; s < slots; ++s)
+   {
+      unit_test_child_t * child = &children[s];
+      if (child->m_Pid != 0 && fds[s].revents != 0)
+      {
+         char buffer[sizeof(unit_test_status_t) + XPCCUT_STRLEN];
+         ssize_t count = read(child->m_Fd, buffer, sizeof buffer);
+         if (count > 0)
+            unit_test_child_receive(child, buffer, (size_t) count);
+         else if (count == 0 || errno != EINTR)
+            unit_test_child_reap(tests, child, results, done);
+      }
+      if
+      (
+         child->m_Pid != 0 && unit_test_child_time_left
+         (
+            child, unit_test_test_timeout(tests, child->m_Test_Number)
+         ) == 0
+      )
+      {
+         (void) kill(child->m_Pid, SIGKILL);
+         child->m_Timed_Out = true;
+         unit_test_child_reap(tests, child, results, done);
       }
    }
-   return length;
 }
 
 /**
- *    Provides the show-progress component of unit_test_run().
- *    In addition to showing the provided test number, this function also
- *    sets/increments the unit_test_t.m_Current_Test_Number field.
- *
- *    This function is a helper function that is exposed so that the C++
- *    wrapper library won't have to reimplement the same functionality.
- *
- *    The \a testnum field normally is the integer index of the for-loop
- *    used to iterate over all of the tests that have been loaded.  However,
- *    the caller can also call this function in a loop until it returns a
- *    -1 (XPCCUT_NO_CURRENT_TEST).
+ *    Indicates if a test must wait before it starts in a child, because
+ *    of a test marked by unit_test_load_serial().  A serial test waits
+ *    until no child is busy, and no test starts while a serial test is
+ *    busy in a child.
  *
  * \return
- *    Returns the current test number, re 0.  If there is a problem, or if
- *    the next test number exceeds the actual number of loaded tests, then
- *    -1 (XPCCUT_NO_CURRENT_TEST) is returned.
+ *    Returns 'true' if the test must not start yet.
  *
  * \unittests
- *    -  unit_unit_test_04_10()
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_load_serial().
  */
 
-int
-unit_test_next_test
+static cbool_t
+unit_test_child_must_wait
 (
-   unit_test_t * tests  /**< "this pointer" for this function, assumed valid. */
+   const unit_test_t * tests,       /**< The "this pointer", assumed valid.   */
+   const unit_test_child_t * children, /**< The child slots.                  */
+   int slots,                       /**< The number of child slots.           */
+   int testnumber                   /**< The test that is to start.           */
 )
 {
-   int result = XPCCUT_NO_CURRENT_TEST;
-   if (xpccut_thisptr(tests))
+   cbool_t result = false;
+   cbool_t serial = unit_test_test_is_serial(tests, testnumber);
+   int s;
+   for (s = 0; s < slots && ! result; ++s)
    {
-      /*
-       * Since the caller normally provides a for-loop that counts the tests,
-       * we could simply load the index number and show it.
-       *
-       *    tests->m_Current_Test_Number = testnum;
-       *
-       *    . . .
-       *
-       *    fprintf(stdout, "\n%s %3d:  \n", _("TEST"), testnum+1);
-       *
-       * But this puts a burden on the caller and makes the API a tiny bit more
-       * complex.
-       */
-
-      result = ++tests->m_Current_Test_Number;           /* test number re 0  */
-      if (result >= tests->m_Test_Count)                 /* no more tests?    */
-         result = XPCCUT_NO_CURRENT_TEST;                /* no more tests!    */
+      if (children[s].m_Pid != 0)
+      {
+         result = serial ||
+            unit_test_test_is_serial(tests, children[s].m_Test_Number);
+      }
    }
    return result;
 }
 
 /**
- *    Provides the post-hoc analysis of the test.
+ *    Runs all of the loaded tests, each in a child process of its own, for
+ *    the --isolate option.  Up to --jobs children run at the same time.
+ *    The main thread disposes of the results in load order, as
+ *    unit_test_run_jobs() does for worker threads.  A test marked by
+ *    unit_test_load_serial() runs in a child while no other child runs.
  *
  * \return
- *    Returns 'true' if the tests are supposed to stop immediately.  If
- *    either the \a tests or \a status parameters are null, this is
- *    considered an error, but it will not stop the tests
- *
- * \sideeffect
- *    The result of the test is returned in the \a runresult parameter.
- *    Other unit_test_t fields are modified.
+ *    Returns 'true' if no test failed.
  *
  * \unittests
- *    -  unit_unit_test_04_18()
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
  */
 
-cbool_t
-unit_test_dispose_of_test
+static cbool_t
+unit_test_run_isolated
 (
    unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
-   unit_test_status_t * status,     /**< The status object to update.         */
-   cbool_t * runresult              /**< Output flag for some failure.        */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context                   /**< The first parameter of \a job.       */
 )
 {
-   cbool_t result = false;                      /* if true, caller stops loop */
-   cbool_t ok = cut_not_nullptr(status);
-   if (! ok)
-      xpccut_errprint_func(_("null status pointer"));
+   cbool_t result = false;
+   int count = tests->m_Test_Count;
+   int window = count * tests->m_Window_Rounds;
+   int slots = unit_test_options_job_count(&tests->m_App_Options);
+   unit_test_status_t * results = malloc(window * sizeof(unit_test_status_t));
+   cbool_t * done = calloc(window, sizeof(cbool_t));
+   unit_test_child_t * children;
+   struct pollfd * fds;
+   if (slots > window)
+      slots = window;
 
-   if (xpccut_thisptr(tests) && ok)
+   children = calloc(slots, sizeof(unit_test_child_t));
+   fds = malloc(slots * sizeof(struct pollfd));
+   if
+   (
+      cut_not_nullptr(results) && cut_not_nullptr(done) &&
+      cut_not_nullptr(children) && cut_not_nullptr(fds)
+   )
    {
-      cbool_t quit = unit_test_dispose(status); /* check test result/options  */
-      if (cut_not_nullptr(runresult))
-         *runresult = unit_test_status_passed(status);
-      else
-         xpccut_errprint_func(_("PROGRAMMER -- null run-result pointer"));
-
-      if (unit_test_status_passed(status))
+      unit_test_options_t options = tests->m_App_Options;
+      int next_start = 0;
+      int testnumber;
+      int s;
+      (void) unit_test_options_show_progress_set(&options, false);
+      while ((testnumber = unit_test_next_test(tests)) >= 0)
       {
-         int zzz = unit_test_options_test_sleep_time(&tests->m_App_Options);
-         if (zzz > 0)
+         unit_test_status_t testresult;
+         cbool_t passed;
+         int position = tests->m_Order_Position;
+         int slot = unit_test_round_slot(tests, position, testnumber);
+         int ahead = (position / count + tests->m_Window_Rounds) * count;
+         if (ahead > tests->m_Position_Limit)
+            ahead = tests->m_Position_Limit;
+
+         while (! done[slot])
          {
-            if (unit_test_options_show_progress(&tests->m_App_Options))
+            cbool_t busy = false;
+            for (s = 0; s < slots && next_start < ahead; ++s)
             {
-               fprintf
-               (
-                  stdout, "  %s %d %s\n",
-                  _("Sleeping"), zzz, _("milliseconds")
-               );
-            }
-            xpccut_ms_sleep(zzz);
-         }
-      }
-      else
-      {
-         tests->m_Total_Errors++;
-         if (tests->m_First_Failed_Test == 0)
-            tests->m_First_Failed_Test = tests->m_Current_Test_Number;
-
-         if (tests->m_First_Failed_Group == 0)
-            tests->m_First_Failed_Group = unit_test_status_group(status);
-
-         if (tests->m_First_Failed_Case == 0)
-            tests->m_First_Failed_Case = unit_test_status_case(status);
+               if (children[s].m_Pid == 0)
+               {
+                  int t = unit_test_scheduled_test(tests, next_start);
+                  int tslot = unit_test_round_slot(tests, next_start, t);
+                  unit_test_status_t * r = &results[tslot];
+                  if (unit_test_child_must_wait(tests, children, slots, t))
+                     break;
 
-         if (tests->m_First_Failed_Subtest == 0)
-         {
-            tests->m_First_Failed_Subtest =
-               unit_test_status_failed_subtest(status);
-         }
-         if (unit_test_options_stop_on_error(&tests->m_App_Options))
-         {
-            if (! xpccut_is_silent())
+                  unit_test_options_context_set(t);
+                  if (unit_test_skip_a_test(tests, t, &options, r))
+                  {
+                     (void) unit_test_status_time_delta(r, false);
+                     unit_test_adopt_status(tests, r);
+                     done[tslot] = true;        /* no child for a skip     */
+                  }
+                  else if
+                  (
+                     unit_test_child_start
+                     (
+                        tests, &children[s], t, job, context, &options
+                     )
+                  )
+                  {
+                     children[s].m_Slot = tslot;
+                  }
+                  else
+                  {
+                     *r = unit_test_run_job
+                     (
+                        tests, job, context, t, &options, true
+                     );
+                     unit_test_adopt_status(tests, r);
+                     done[tslot] = true;
+                  }
+                  unit_test_options_context_set(XPCCUT_NO_CURRENT_TEST);
+                  ++next_start;
+               }
+            }
+            for (s = 0; s < slots; ++s)
             {
-               fprintf
-               (
-                  stdout, "  %s %d\n",
-                  _("Stop-on-error enabled; failure in TEST"),
-                  unit_test_number(tests)+1
-               );
+               if (children[s].m_Pid != 0)
+                  busy = true;
             }
-            result = true;
+            if (busy && ! done[slot])
+               unit_test_child_poll(tests, children, fds, slots, results, done);
          }
-      }
-
-      /*
-       * The skip is already noted in the main title, but it makes the
-       * output look better, when no "--verbose" option is being used, if
-       * we show it here.
-       */
+         testresult = results[slot];
+         done[slot] = false;                    /* free for a later round  */
+         unit_test_pool_show_title(tests, &testresult);
+         unit_test_show_result(tests, &testresult);
+         if (unit_test_check_subtests(tests, &testresult) < 0)
+            break;
 
-      if
-      (
-         unit_test_options_show_progress(&tests->m_App_Options) &&
-            unit_test_options_is_verbose(&tests->m_App_Options)
-      )
-      {
-         if (unit_test_status_is_skipped(status))
-            fprintf(stdout, "  %s\n", _("Skipped"));     /* flush cout */
+         if (unit_test_dispose_of_test(tests, &testresult, &passed))
+            break;
       }
-      if (quit)
+      for (s = 0; s < slots; ++s)      /* drop the tests still in progress */
       {
-         if (unit_test_options_show_progress(&tests->m_App_Options))
-            fprintf(stdout, "  %s\n", _("User requested an end to testing"));
+         if (children[s].m_Pid != 0)
+         {
+            (void) kill(children[s].m_Pid, SIGKILL);
+            (void) close(children[s].m_Fd);
+            while (waitpid(children[s].m_Pid, nullptr, 0) < 0 && errno == EINTR)
+               ;
 
-         result = true;
+            free(children[s].m_Message);
+         }
       }
-      if (result && unit_test_options_is_verbose(&tests->m_App_Options))
-         fprintf(stdout, "%s\n", _("Quitting the tests early"));
+      result = tests->m_Total_Errors == 0;
    }
+   else
+   {
+      xpccut_errprint_func(_("could not allocate the child slots"));
+      result = unit_test_run_jobs_serially(tests, job, context);
+   }
+   free(fds);
+   free(children);
+   free(done);
+   free(results);
    return result;
 }
 
+#endif   /* XPCCUT_USE_FORK */
+
 /**
- *    Provides the post-loop component of unit_test_run().
- *    This function is a helper function that is exposed so that a C++
- *    wrapper library won't have to reimplement the same functionality.
+ *    Runs all of the loaded tests on a pool of worker threads.  This is
+ *    the part of unit_test_run_jobs() used when the --isolate option is
+ *    not in force.
+ *
+ * \return
+ *    Returns 'true' if no test failed.
  *
  * \unittests
- *    No unit-test at this time.  This function has no output or
- *    side-effects.  One could redirect stdout for the duration of this
- *    function, but it doesn't strike one as a fruitful option.
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_run_jobs().
  */
 
-void
-unit_test_post_loop
+static cbool_t
+unit_test_run_pool
 (
-   unit_test_t * tests,             /**< "this pointer" for this function.    */
-   cbool_t testresult               /**< Test result the caller had found.    */
+   unit_test_t * tests,             /**< The "this pointer", assumed valid.   */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context                   /**< The first parameter of \a job.       */
 )
 {
-   if (xpccut_thisptr(tests))
+   cbool_t result = false;
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+
+   int count = tests->m_Test_Count;
+   int window = count * tests->m_Window_Rounds;
+   int jobs = unit_test_options_job_count(&tests->m_App_Options);
+   unit_test_pool_t pool;
+   unit_test_worker_t * workers;
+   int started = 0;
+   if (jobs > window)
+      jobs = window;
+
+   pool.m_Tests = tests;
+   pool.m_Job = job;
+   pool.m_Context = context;
+   pool.m_Options = tests->m_App_Options;
+   (void) unit_test_options_show_progress_set(&pool.m_Options, false);
+   pool.m_Results = malloc(window * sizeof(unit_test_status_t));
+   pool.m_Done = calloc(window, sizeof(cbool_t));
+   pool.m_Output = calloc(window, sizeof(char *));
+   pool.m_Output_Sizes = calloc(window, sizeof(int));
+   pool.m_Next_Test = 0;
+   pool.m_Disposed = 0;
+   pool.m_Exclusive = false;
+   pool.m_Stop = false;
+   workers = malloc(jobs * sizeof(unit_test_worker_t));
+   if
+   (
+      cut_not_nullptr(pool.m_Results) && cut_not_nullptr(pool.m_Done) &&
+      cut_not_nullptr(pool.m_Output) && cut_not_nullptr(pool.m_Output_Sizes) &&
+      cut_not_nullptr(workers)
+   )
    {
-      if (unit_test_options_is_summary(&tests->m_App_Options))
-      {
-         fprintf
-         (
-            stdout,
-            "\n"
-            "%d %s.\n"
-            "%s.\n"
-            ,
-            unit_test_subtest_count(tests), _("sub-tests encountered"),
-            _("Tests summarized, not performed")
-         );
-      }
-      else
+      int w;
+      pthread_mutex_init(&pool.m_Lock, nullptr);
+      pthread_cond_init(&pool.m_Finished, nullptr);
+      for (w = 0; w < jobs; ++w)
       {
-         double duration_ms;
-         xpccut_get_microseconds(&tests->m_End_Time_us);
-         duration_ms = 0.001 * xpccut_time_difference_us
+         unit_test_worker_t * worker = &workers[started];
+         worker->m_Pool = &pool;
+         if
          (
-            tests->m_Start_Time_us, tests->m_End_Time_us
-         );
-         if (unit_test_options_show_progress(&tests->m_App_Options))
-         {
-            fprintf
+            pthread_create
             (
-               stdout,
-               "\n------------------------------------------------------------\n"
-            );
-         }
-         if (testresult)
+               &worker->m_Thread, nullptr, unit_test_pool_worker, worker
+            ) == 0
+         )
          {
-            if (unit_test_options_show_progress(&tests->m_App_Options))
-            {
-               fprintf
-               (
-                  stdout, "%d %s.\n%d %s.\n",
-                  unit_test_count(tests),
-                  _("unit-tests completed; all succeeded or were skipped"),
-                  unit_test_subtest_count(tests),
-                  _("sub-tests encountered")
-               );
-            }
+            ++started;
          }
          else
+            xpccut_errprint_func(_("could not start a worker thread"));
+      }
+      if (started > 0)
+      {
+         int testnumber;
+         while ((testnumber = unit_test_next_test(tests)) >= 0)
          {
-            /*
-             * Here's a quandary -- we want to see errors noted in the
-             * report even if --silent is set, generally.  However, some of
-             * the XPCCUT unit-tests of itself simulate errors, which we
-             * really don't care to see, because we know they're always
-             * failures.
-             */
+            unit_test_status_t testresult;
+            cbool_t passed;
+            int position = tests->m_Order_Position;
+            int slot = unit_test_round_slot(tests, position, testnumber);
+            char * output;
+            int outputsize;
+            pthread_mutex_lock(&pool.m_Lock);
+            while (! pool.m_Done[slot])
+               pthread_cond_wait(&pool.m_Finished, &pool.m_Lock);
 
-            if (! xpccut_is_silent())
+            testresult = pool.m_Results[slot];
+            output = pool.m_Output[slot];
+            outputsize = pool.m_Output_Sizes[slot];
+            pool.m_Output[slot] = nullptr;
+            pool.m_Done[slot] = false;          /* free for a later round  */
+            pthread_mutex_unlock(&pool.m_Lock);
+            unit_test_pool_show_title(tests, &testresult);
+            xpccut_output_replay(output, outputsize);
+            free(output);
+            unit_test_show_result(tests, &testresult);
+            if (unit_test_check_subtests(tests, &testresult) < 0)
+               break;
+
+            if (unit_test_dispose_of_test(tests, &testresult, &passed))
+               break;
+
+            pthread_mutex_lock(&pool.m_Lock);
+            pool.m_Disposed = position + 1;
+            if (pool.m_Disposed % count == 0)   /* let workers into a round */
             {
-               fprintf
-               (
-                  stdout,
-                  "%d %s (%d %s). %d %s.\n"
-                  "  %s: %d (%s %d, %s %d, %s %d)\n"
-                  ,
-                  unit_test_count(tests), _("tests completed"),
-                  unit_test_subtest_count(tests), _("sub-tests encountered"),
-                  tests->m_Total_Errors, _("failed"),
-                  _("First failed unit-test number"),
-                  tests->m_First_Failed_Test+1,
-                  _("Group"), tests->m_First_Failed_Group,
-                  _("Case"), tests->m_First_Failed_Case,
-                  _("Sub-test"), tests->m_First_Failed_Subtest
-               );
+               int round = pool.m_Disposed / count + tests->m_Window_Rounds - 1;
+               unit_test_prepare_rounds(tests, round);
+               unit_test_expect_rounds(tests, round);
             }
+            pthread_cond_broadcast(&pool.m_Finished);
+            pthread_mutex_unlock(&pool.m_Lock);
          }
-         if (unit_test_options_show_progress(&tests->m_App_Options))
-         {
-            fprintf
-            (
-               stdout, "%s: %4.3f ms\n", _("Full test duration"), duration_ms
-            );
-            fprintf
-            (
-               stdout,
-               "============================================================\n"
-            );
-         }
+         pthread_mutex_lock(&pool.m_Lock);
+         pool.m_Stop = true;
+         pthread_cond_broadcast(&pool.m_Finished);
+         pthread_mutex_unlock(&pool.m_Lock);
+         for (w = 0; w < started; ++w)
+            (void) pthread_join(workers[w].m_Thread, nullptr);
+
+         result = tests->m_Total_Errors == 0;
       }
+      pthread_cond_destroy(&pool.m_Finished);
+      pthread_mutex_destroy(&pool.m_Lock);
+   }
+   else
+      xpccut_errprint_func(_("could not allocate the worker pool"));
+
+   if (cut_not_nullptr(pool.m_Output))
+   {
+      int t;
+      for (t = 0; t < window; ++t)
+         free(pool.m_Output[t]);
    }
+   free(workers);
+   free(pool.m_Output_Sizes);
+   free(pool.m_Output);
+   free(pool.m_Done);
+   free(pool.m_Results);
+   if (started == 0)
+      result = unit_test_run_jobs_serially(tests, job, context);
+
+#else
+
+   result = unit_test_run_jobs_serially(tests, job, context);
+
+#endif   /* XPC_HAVE_PTHREAD_H && ! defined WIN32 */
+   return result;
 }
 
 /**
- *    Checks the sub-test count for the caller.
- *    This function is a helper function that is exposed so that a C++
- *    wrapper library won't have to reimplement the same functionality.
+ *    Runs all of the loaded tests on a pool of worker threads.  This
+ *    function provides the loop part of unit_test_run() (and of
+ *    xpc::cut::run()) for the --jobs option.  The caller must have called
+ *    unit_test_run_init() first, and calls unit_test_post_loop() after.
+ *
+ *    The number of workers is the value of the --jobs option, but no more
+ *    than the number of tests that can be started at once.  Each worker
+ *    takes the next test in the order of the --order or --shuffle option,
+ *    or, in load order with a --history file, the longest test left.  With
+ *    the --repeat or --until-fail option, the workers can run up to one
+ *    round ahead per job, so that the runs of a test can overlap.  It
+ *    calls \a job for each test with a private copy of the options, so
+ *    that each test gets its own unit_test_status_t and its own options.
+ *    The copies have progress output turned off, because output from
+ *    tests running side by side would be jumbled together.
+ *
+ *    The main thread waits for the results in the order of
+ *    unit_test_next_test(), and for each one
+ *    shows the result, calls unit_test_check_subtests(), and then calls
+ *    unit_test_dispose_of_test(), exactly as the serial loop does.  So
+ *    m_Total_Errors, the m_First_Failed_xxx fields, and the output of
+ *    unit_test_report() are the same as for a serial run.
+ *
+ *    If the --isolate option is set, each test instead runs in a child
+ *    process of its own, with up to --jobs children at a time.  The child
+ *    sends its status, with its names and its failure log, back through a
+ *    pipe.  A child that crashes, exits
+ *    without sending a status, or runs longer than the --test-timeout
+ *    value (it is then killed) counts as a failed test, and the rest of
+ *    the tests still run.
  *
- * \return
- *    If at least one subtest was counted, this function returns the number
- *    of sub-tests counted (in the current test-case function).  If no
- *    sub-tests were counted, but the --require-sub-test option is not
- *    activated, then 0 is returned.  Otherwise, -1 (XPCCUT_NO_CURRENT_TEST)
- *    is returned, and the caller should exit its test-loop.
+ * \warning
+ *    -  Test functions that run under a pool must not share unprotected
+ *       state with each other, such as the global generator used by
+ *       xpccut_rand() or the stopwatch functions.  With --repeat, this
+ *       includes the state shared by the runs of one test.
+ *    -  When the tests stop early (e.g. the --stop-on-error option), the
+ *       tests that were already running in other workers are allowed to
+ *       finish, but their results are dropped, as they would never have
+ *       run in a serial run.
  *
- * \sideeffect
- *    The valid sub-test count is added to the current value of
- *    m_Subtest_Count.
+ * \posix
+ *    Uses POSIX threads, or fork(), pipe(), and poll() for --isolate.  If
+ *    no thread can be started, the tests are run one after the other in
+ *    the calling thread.  If no child can be started, that test is run in
+ *    the calling process.
+ *
+ * \win32
+ *    The tests are always run one after the other in the calling thread,
+ *    and the --isolate option is ignored.
+ *
+ * \return
+ *    Returns 'true' if the parameters were valid and no test failed.
  *
  * \unittests
- *    -  unit_unit_test_04_23()
+ *    -  unit_unit_test_04_24()
  */
 
-int
-unit_test_check_subtests
+cbool_t
+unit_test_run_jobs
 (
-   unit_test_t * tests,                /**< "this pointer" for this function. */
-   const unit_test_status_t * status   /**< The ownder of the sub-test count. */
+   unit_test_t * tests,             /**< The "this pointer" for this test.    */
+   unit_test_job_func_t job,        /**< The function that runs one test.     */
+   void * context                   /**< The first parameter of \a job.       */
 )
 {
-   int result = XPCCUT_NO_CURRENT_TEST;
-   if (xpccut_thisptr(tests))
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
    {
-      /*
-       * Keep track of all the sub-test counts encountered.
-       */
-
-      int subtest_count = unit_test_status_subtest(status);
-      if (subtest_count > 0)
-      {
-         tests->m_Subtest_Count += subtest_count;
-         result = subtest_count;
-      }
+      result = cut_not_nullptr(job);
+      if (! result)
+         xpccut_errprint_func(_("null job function"));
+   }
+   if (result)
+   {
+#if XPCCUT_USE_FORK
+      if (unit_test_options_is_isolated(&tests->m_App_Options))
+         result = unit_test_run_isolated(tests, job, context);
       else
-      {
-         if (subtest_count == XPCCUT_INVALID_PARAMETER)
-         {
-            /* Generally due to a stock null pointer error. */
-         }
-         else
-         {
-            /*
-             * Not sure we like this option, so it is false by default.
-             */
-
-            if (unit_test_options_need_subtests(&tests->m_App_Options))
-               xpccut_errprint_func(_("PROGRAMMER--no subtests encountered"));
-            else
-               result = 0;
-         }
-      }
+         result = unit_test_run_pool(tests, job, context);
+#else
+      result = unit_test_run_pool(tests, job, context);
+#endif
    }
    return result;
 }
@@ -1326,6 +5697,16 @@ unit_test_check_subtests
  *          result.
  *       -# Increments m_Total_Errors if the unit-test failed.
  *
+ *    Before a test loaded by unit_test_register() is run, the loop calls
+ *    unit_test_skip_a_test(), so that a test ruled out by the --group,
+ *    --case, or --shard-index options, or by --summarize, is not called.
+ *
+ *    If the --jobs option is greater than 1, or the --isolate option is
+ *    set, the loop above is replaced by a call to unit_test_run_jobs(),
+ *    which runs the tests on a pool of worker threads or child processes,
+ *    but still checks and disposes of the results in the order in which
+ *    the tests were loaded.
+ *
  * \warning
  *    <b>If you make any changes to this function</b>, you almost certainly
  *    have to make corresponding changes to the xpc::cut::run() function in
@@ -1337,6 +5718,8 @@ unit_test_check_subtests
  *
  * \unittests
  *    -  unit_unit_test_04_19()
+ *    -  unit_unit_test_04_24()
+ *    -  unit_unit_test_04_27()
  */
 
 cbool_t
@@ -1351,6 +5734,8 @@ unit_test_run
       int length = unit_test_run_init(tests);
       if (length == 0)
          result = false;                  /* no tests found to be loaded      */
+      else if (unit_test_use_jobs(tests))
+         result = unit_test_run_jobs(tests, unit_test_run_a_job, tests);
       else
       {
          int testnumber;
@@ -1360,10 +5745,35 @@ unit_test_run
             unit_test_status_t testresult;
             if (unit_test_status_init(&testresult))   /* ca 06/25/2008 new */
             {
-               testresult = unit_test_run_a_test
+               unit_test_options_context_set(testnumber);
+               if
                (
-                  tests, tests->m_Test_Cases[testnumber]
-               );
+                  unit_test_skip_a_test
+                  (
+                     tests, testnumber, &tests->m_App_Options, &testresult
+                  )
+               )
+               {
+                  (void) unit_test_run_a_test_after(tests, &testresult);
+               }
+               else if
+               (
+                  ! unit_test_fixture_enter
+                  (
+                     tests, testnumber, &tests->m_App_Options, &testresult
+                  )
+               )
+               {
+                  (void) unit_test_run_a_test_after(tests, &testresult);
+               }
+               else
+               {
+                  testresult = unit_test_run_a_test
+                  (
+                     tests, tests->m_Test_Cases[testnumber]
+                  );
+               }
+               unit_test_fixture_leave(tests, testnumber);
                if (unit_test_check_subtests(tests, &testresult) < 0)
                   break;
 
@@ -1384,6 +5794,7 @@ unit_test_run
          result = tests->m_Total_Errors == 0;
       }
       unit_test_post_loop(tests, result);
+      xpccut_output_flush();
    }
    return result;
 }
@@ -1392,6 +5803,9 @@ unit_test_run
  *    Provides the prelude of unit_test_run_a_test().
  *    This function is a helper function that is exposed so that the C++
  *    wrapper library won't have to reimplement the same functionality.
+ *    It puts the number of the test into the test context of the thread,
+ *    rather than into the options, which the tests share, and marks the
+ *    test arena of the thread.
  *
  * \note
  *    We use intptr_t instead of "void *" because gcc 4.2 warns about
@@ -1422,8 +5836,14 @@ unit_test_run_a_test_before
       result = cut_not_nullptr((void *) int_test);
       if (result)
       {
-         tests->m_App_Options.m_Current_Test_Number =
-            tests->m_Current_Test_Number;
+         unit_test_options_context_set(tests->m_Current_Test_Number);
+         xpccut_arena_mark(xpccut_test_arena(), &tests->m_Arena_Mark);
+         tests->m_Trace_Name = unit_test_trace_name
+         (
+            tests, tests->m_Current_Test_Number
+         );
+         if (cut_not_nullptr(tests->m_Trace_Name))
+            xpccut_trace_enter(tests->m_Trace_Name);
       }
       else
       {
@@ -1446,18 +5866,220 @@ unit_test_run_a_test_before
 }
 
 /**
- *    Provides a compile-time option.
- *    It selects how to display the test result.
- *    There are no plans as yet to change this value.  In fact, I don't
- *    remember why I changed the format of the output!  Doh!
+ *    Decides, without calling a test, that the test is not to be run.
+ *    This function is a helper function that is exposed so that the C++
+ *    wrapper library won't have to reimplement the same functionality.
+ *
+ *    Only a test loaded by unit_test_register() (or xpc::cut::load() with
+ *    the group and case information) can be skipped this way.  It is
+ *    skipped if the --group, --case, or --shard-index options rule it out,
+ *    in which case \a status is set up exactly as the test itself would
+ *    have set it up (XPCCUT_DISPOSITION_DNT).  It is also skipped if the
+ *    --summarize option is in force, in which case the group and case of
+ *    the test are listed.  The names of the sub-tests are not listed,
+ *    since only the test function knows them.  Finally, it is not called
+ *    if it passed in an earlier run with the same --cache-file key; then
+ *    \a status is set up as a pass (XPCCUT_DISPOSITION_CONTINUE), and
+ *    unit_test_dispose_of_test() reports it as a cached pass.
+ *
+ *    The caller must call unit_test_options_context_set() with
+ *    \a testnumber, as it would before calling the test, and must still
+ *    time the \a status and dispose of it.
+ *
+ * \return
+ *    Returns 'true' if the test is not to be called.  In that case, the
+ *    \a status parameter holds the result of the test.  Otherwise,
+ *    'false' is returned, and the test must be called as usual.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_27()
+ *    -  unit_unit_test_04_32()
  */
 
-static cbool_t g_use_one_line = false;
+cbool_t
+unit_test_skip_a_test
+(
+   const unit_test_t * tests,       /**< The "this pointer" for this test.    */
+   int testnumber,                  /**< Index of the test, re 0.             */
+   const unit_test_options_t * options, /**< Options the test would get.     */
+   unit_test_status_t * status      /**< The status of a skipped test.        */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+      result = cut_not_nullptr_2(options, status);
+
+   if (result)
+      result = testnumber >= 0 && testnumber < tests->m_Test_Count;
+
+   if (result)
+   {
+      const unit_test_info_t * info = &tests->m_Test_Info[testnumber];
+      result = info->m_Test_Group > 0;          /* unit_test_register()?   */
+      if (result)
+      {
+         result = unit_test_options_is_summary(options) ||
+            ! unit_test_options_is_selected
+            (
+               options, info->m_Test_Group, info->m_Test_Case,
+               info->m_Group_Name, info->m_Case_Name
+            ) ||
+            unit_test_is_cached(tests, testnumber);
+      }
+      if (result)
+      {
+         (void) unit_test_status_initialize
+         (
+            status, options, info->m_Test_Group, info->m_Test_Case,
+            info->m_Group_Name, info->m_Case_Name
+         );
+      }
+   }
+   return result;
+}
+
+/**
+ *    Gets the fixture of the group of a test ready, just before the test
+ *    is called.  This function is a helper function that is exposed so
+ *    that the C++ wrapper library won't have to reimplement the same
+ *    functionality.  It is called only for a test that
+ *    unit_test_skip_a_test() did not skip, and must be followed by
+ *    unit_test_fixture_leave(), whatever it returns.
+ *
+ * \return
+ *    Returns 'true' if the test is to be called.  If the setup of the
+ *    fixture failed, 'false' is returned, and \a status is set up as a
+ *    failure of the test, which must be timed and disposed of as usual.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+cbool_t
+unit_test_fixture_enter
+(
+   unit_test_t * tests,             /**< The "this pointer" for this test.    */
+   int testnumber,                  /**< Index of the test, re 0.             */
+   const unit_test_options_t * options, /**< Options the test would get.     */
+   unit_test_status_t * status      /**< The status of a test not called.     */
+)
+{
+   cbool_t result = xpccut_thisptr(tests);
+   if (result)
+      result = cut_not_nullptr_2(options, status);
+
+   if (result)
+      result = testnumber >= 0 && testnumber < tests->m_Test_Count;
+
+   if (result)
+   {
+      const unit_test_info_t * info = &tests->m_Test_Info[testnumber];
+      result = xpccut_fixture_enter(&tests->m_Fixtures, info->m_Test_Group);
+      if (! result)
+      {
+         (void) unit_test_status_initialize
+         (
+            status, options, info->m_Test_Group, info->m_Test_Case,
+            info->m_Group_Name, info->m_Case_Name
+         );
+         (void) unit_test_status_fail(status);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Counts a test as done for the fixture of its group, tearing the
+ *    fixture down after the last test of the group.  This function is a
+ *    helper function that is exposed so that the C++ wrapper library won't
+ *    have to reimplement the same functionality.  It is called for every
+ *    test, including the ones that unit_test_skip_a_test() skipped.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_29()
+ */
+
+void
+unit_test_fixture_leave
+(
+   unit_test_t * tests,             /**< The "this pointer" for this test.    */
+   int testnumber                   /**< Index of the test, re 0.             */
+)
+{
+   if (xpccut_thisptr(tests))
+   {
+      if (testnumber >= 0 && testnumber < tests->m_Test_Count)
+      {
+         xpccut_fixture_leave
+         (
+            &tests->m_Fixtures, tests->m_Test_Info[testnumber].m_Test_Group
+         );
+      }
+   }
+}
+
+/**
+ *    Starts the watchdog on a test that is about to be called in this
+ *    process, if the test has a timeout.  This function is a helper
+ *    function that is exposed so that the C++ wrapper library won't have
+ *    to reimplement the same functionality.  It must be followed by
+ *    unit_test_watchdog_disarm() once the test returns.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+void
+unit_test_watchdog_arm
+(
+   const unit_test_t * tests,       /**< The "this pointer" for this test.    */
+   int testnumber,                  /**< Index of the test, re 0.             */
+   xpccut_watch_t * watch           /**< The watch, owned by the caller.      */
+)
+{
+   if (xpccut_thisptr(tests) && cut_not_nullptr(watch))
+   {
+      const char * groupname = nullptr;
+      const char * casename = nullptr;
+      if (testnumber >= 0 && testnumber < tests->m_Test_Count)
+      {
+         groupname = tests->m_Test_Info[testnumber].m_Group_Name;
+         casename = tests->m_Test_Info[testnumber].m_Case_Name;
+      }
+      xpccut_watchdog_arm
+      (
+         watch, unit_test_test_timeout(tests, testnumber),
+         testnumber, groupname, casename
+      );
+   }
+}
+
+/**
+ *    Stops the watchdog on a test that has returned.  If the test ran past
+ *    its timeout, the watchdog has already shown it, and the test is
+ *    counted as a failure here, whatever its own result was.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+void
+unit_test_watchdog_disarm
+(
+   xpccut_watch_t * watch,          /**< The watch that was armed.            */
+   unit_test_status_t * status      /**< The status returned by the test.     */
+)
+{
+   if (xpccut_watchdog_disarm(watch) && cut_not_nullptr(status))
+      (void) unit_test_status_fail(status);
+}
 
 /**
  *    Provides the postlude of unit_test_run_a_test().
  *    This function is a helper function that is exposed so that the C++
  *    wrapper library won't have to reimplement the same functionality.
+ *    It clears the test number from the test context of the thread, and
+ *    frees the blocks that the test took from the test arena.
  *
  * \return
  *    This function returns 'true' if both of the pointer parameters were
@@ -1482,116 +6104,15 @@ unit_test_run_a_test_after
 
    if (result)
    {
-      cbool_t show_result;
       (void) unit_test_status_time_delta(status, false);          /* time it  */
-      show_result =
-      (
-         ! unit_test_status_is_skipped(status) &&
-         ! unit_test_options_is_summary(&tests->m_App_Options)
-      );
-      if (show_result)
-      {
-         if (unit_test_options_show_progress(&tests->m_App_Options))
-         {
-            if (g_use_one_line)
-            {
-               fprintf
-               (
-                  stdout,
-                  "  %s %2d '%s'  %s %2d '%s' %s %2d:\n  %s",     /* (no \n)  */
-                  _("Group"),
-                  unit_test_status_group(status),
-                  unit_test_status_group_name(status),
-                  _("Case"),
-                  unit_test_status_case(status),
-                  unit_test_status_case_name(status),
-                  _("through Subtest"),
-                  unit_test_status_subtest(status),
-                  unit_test_status_passed(status) ? _("PASSED") : _("FAILED")
-               );
-            }
-            else
-            {
-               fprintf
-               (
-                  stdout,
-                  "  %12s %2d '%s'\n  %12s %2d '%s'\n  %12s %2d %s:\n  %s",
-                  _("Group"),
-                  unit_test_status_group(status),
-                  unit_test_status_group_name(status),
-                  _("Case"),
-                  unit_test_status_case(status),
-                  unit_test_status_case_name(status),
-                  _("Subtests"),
-                  unit_test_status_subtest(status),
-                  _("and below"),
-                  unit_test_status_passed(status) ? _("PASSED") : _("FAILED")
-               );
-            }
-            if (unit_test_status_duration_ms(status) >= 0.001)
-            {
-               fprintf
-               (
-                  stdout, " (%4.3f ms)", unit_test_status_duration_ms(status)
-               );
-            }
-            else
-            {
-               fprintf(stdout, " (less than 0.001 ms)");
-            }
-            if (unit_test_status_error_count(status) > 1)
-            {
-               /*
-                * More than one sub-test failed, so show the number of them
-                * that failed, as well as the first one that failed.
-                */
-
-               fprintf
-               (
-                  stdout, "\n  %d %s. %s: %d\n",
-                  unit_test_status_error_count(status),
-                  _("subtests failed"), _("First failed sub-test"),
-                  unit_test_status_failed_subtest(status)
-               );
-            }
-            else if (unit_test_status_failed(status))
-            {
-               /*
-                * Only one sub-test failed, so just show that one.
-                */
-
-               fprintf
-               (
-                  stdout, " %s %d\n", _("at sub-test"),
-                  unit_test_status_failed_subtest(status)
-               );
-            }
-            else
-               fprintf(stdout, "\n");
-         }
-         if (unit_test_options_is_pause(&tests->m_App_Options))
-            unit_test_pause(tests);
-      }
-      else
+      if (cut_not_nullptr(tests->m_Trace_Name))
       {
-         /*
-          * This is normally true, but in long tests it shows nothing but
-          * the text below, causing any test that did run to scroll off the
-          * screen.  Therefore, we make the caller specify it on the command
-          * line, using the --verbose option.
-          *
-          *    unit_test_options_show_progress(&tests->m_App_Options)
-          */
-
-         if
-         (
-            unit_test_status_is_skipped(status) &&
-            unit_test_options_is_verbose(&tests->m_App_Options)
-         )
-         {
-            fprintf(stdout, "  %s.\n", _("This test was skipped"));
-         }
+         xpccut_trace_exit(tests->m_Trace_Name);
+         tests->m_Trace_Name = nullptr;
       }
+      xpccut_arena_rewind(xpccut_test_arena(), &tests->m_Arena_Mark);
+      unit_test_show_result(tests, status);
+      unit_test_options_context_set(XPCCUT_NO_CURRENT_TEST);
    }
    return result;
 }
@@ -1600,6 +6121,7 @@ unit_test_run_a_test_after
  *    This function runs a single unit test.
  *    The result of unit_test_run_a_test_after() is currently just a
  *    redundant pointer check.
+ *    If the test has a timeout, the watchdog watches it while it runs.
  *
  * \return
  *    Returns a status structure reflecting the result of the current unit
@@ -1623,7 +6145,10 @@ unit_test_run_a_test
    ok = unit_test_run_a_test_before(tests, int_test);
    if (ok)
    {
+      xpccut_watch_t watch;
+      unit_test_watchdog_arm(tests, tests->m_Current_Test_Number, &watch);
       result = (*test)(&tests->m_App_Options);              /* run the test   */
+      unit_test_watchdog_disarm(&watch, &result);
       ok = unit_test_run_a_test_after(tests, &result);
       if (! ok)
          xpccut_errprint_func(_("internal churn"));
@@ -1646,6 +6171,22 @@ unit_test_run_a_test
  *    --no-show-progress option, as well as setting the xpccut_is_silent()
  *    option.  At some point, the show-progress function may incorporate
  *    the "is silent" test.
+ *
+ *    With the --profile option, the totals of the resources used by the
+ *    tests are also shown, along with the test whose peak resident set
+ *    grew the most.
+ *
+ *    If the libxpccut_alloc library is linked in, the tests that allocated
+ *    more blocks than they freed are listed, unless --silent is in force.
+ *
+ *    With the --shard-count option, a one-line summary of the shard is also
+ *    written to stdout, even under --silent, in a fixed "key=value" form
+ *    that a CI aggregator can parse and add up across the shards:
+ *
+\verbatim
+      SHARD index=2 count=8 mode=hash tests=75 failed=1 subtests=900
+         duration_ms=1234.567        (all on one line)
+\endverbatim
  *
  * \unittests
  *    -  There is no unit-test for unit_test_report() at this time.  It
@@ -1664,23 +6205,102 @@ unit_test_report
    {
       if (unit_test_options_show_progress(&tests->m_App_Options))
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "%s.\n",
+            "%s.\n",
             _("All unit-tests succeeded; the test suite passed")
          );
       }
    }
    else if (xpccut_thisptr(tests))
    {
-      fprintf
+      xpccut_print_error
       (
-         stderr,
          "? %s -- %d/%d %s.\n",
          _("The unit-test suite did not pass"), unit_test_failures(tests),
          unit_test_count(tests), _("tests failed")
       );
    }
+   if (xpccut_thisptr(tests))
+   {
+      const unit_test_options_t * options = &tests->m_App_Options;
+      int shards = unit_test_options_shard_count(options);
+      if (shards > 1)
+      {
+         static const char * const modes [] = { "index", "hash", "duration" };
+         double duration_ms = xpccut_ticks_difference_ms
+         (
+            tests->m_Start_Ticks, tests->m_End_Ticks
+         );
+         xpccut_print
+         (
+            "SHARD index=%d count=%d mode=%s tests=%d failed=%d subtests=%d "
+            "duration_ms=%.3f\n",
+            unit_test_options_shard_index(options), shards,
+            modes[unit_test_options_shard_mode(options)],
+            tests->m_Run_Count, tests->m_Total_Errors, tests->m_Subtest_Count,
+            duration_ms
+         );
+      }
+      cbool_t show = unit_test_options_show_progress(options);
+      if (show && tests->m_Profile_Count > 0)
+      {
+         const xpccut_resources_t * total = &tests->m_Profile_Total;
+         xpccut_print
+         (
+            "%s, %d %s: %s %.3f ms, %s %.3f ms, %s %ld/%ld, %s %ld/%ld\n",
+            _("Profile totals"), tests->m_Profile_Count, _("tests"),
+            _("user"), total->m_User_ms, _("sys"), total->m_System_ms,
+            _("faults"), total->m_Minor_Faults, total->m_Major_Faults,
+            _("switches"), total->m_Voluntary_Switches,
+            total->m_Involuntary_Switches
+         );
+         if (tests->m_Peak_RSS_Group > 0)
+         {
+            xpccut_print
+            (
+               "%s: +%ld kB, %s %d, %s %d\n",
+               _("Largest RSS growth"), total->m_Max_RSS_kb,
+               _("group"), tests->m_Peak_RSS_Group,
+               _("case"), tests->m_Peak_RSS_Case
+            );
+         }
+      }
+      if (show && tests->m_Counter_Count > 0)
+      {
+         char label[80];
+         snprintf
+         (
+            label, sizeof label, "%s, %d %s",
+            _("Counter totals"), tests->m_Counter_Count, _("tests")
+         );
+         xpccut_perf_show(label, &tests->m_Counter_Total, 1.0);
+      }
+      if (tests->m_Leak_Count > 0 && ! xpccut_is_silent())
+      {
+         int listed = tests->m_Leak_Count < XPCCUT_LEAK_LIST_MAX ?
+            tests->m_Leak_Count : XPCCUT_LEAK_LIST_MAX ;
+
+         int k;
+         xpccut_print
+         (
+            "%s: %d %s\n",
+            _("Tests that left memory allocated"), tests->m_Leak_Count,
+            _("tests")
+         );
+         for (k = 0; k < listed; k++)
+         {
+            const unit_test_leak_t * leak = &tests->m_Leaks[k];
+            xpccut_print
+            (
+               "  %s %d, %s %d: %lld %s, %lld %s\n",
+               _("group"), leak->m_Test_Group, _("case"), leak->m_Test_Case,
+               leak->m_Blocks, _("blocks"), leak->m_Bytes, _("bytes")
+            );
+         }
+      }
+   }
+   xpccut_output_flush();
 }
 
 /**
@@ -1701,9 +6321,9 @@ unit_test_version
 {
    if (xpccut_thisptr(tests))
    {
-      fprintf
+      xpccut_print
       (
-         stdout, "%s %s\n",
+         "%s %s\n",
          _("Version"), tests->m_Test_Application_Version
       );
    }
@@ -54,12 +54,32 @@
      OPTION NAME           DEFAULT  MIN   MAX FIELD(S) SET
 
    --sleep-time            0        0  3600000  m_Test_Sleep_Time
+   --jobs                  1        1      256  m_Job_Count
+   --fuzz-jobs             1        1      256  m_Fuzz_Job_Count
+   --test-timeout          0        0  3600000  m_Test_Timeout
    --group                 0        0      100  m_Single_Test_Group
    --group                 empty                m_Single_Test_Group_Name
    --case                  0        0      100  m_Single_Test_Case
    --case                  empty                m_Single_Test_Case_Name
    --sub-test              0        0     1000  m_Single_Sub_Test
    --sub-test              empty                m_Single_Sub_Test_Name
+   --shard-count           1        1     1024  m_Shard_Count
+   --shard-index           0        0     1023  m_Shard_Index
+   --shard-by              index                m_Shard_Mode
+   --durations             empty                m_Durations_File
+   --save-durations        empty                m_Save_Durations_File
+   --report-format         none                 m_Report_Format
+   --report-file           empty                m_Report_File
+   --baseline              empty                m_Baseline_File
+   --write-baseline        empty                m_Write_Baseline_File
+   --perf-tolerance       25        0     1000  m_Perf_Tolerance
+   --trace-file            empty                m_Trace_File
+   --history               empty                m_History_File
+   --order                 load                 m_Order
+   --cache-file            empty                m_Cache_File
+   --cache-key             empty                m_Cache_Key
+   --repeat                1        1  1000000  m_Repeat_Count
+   --shuffle-seed          0        0     4G-1  m_Shuffle_Seed
 \endverbatim
  *
  * <b> Boolean options: </b>
@@ -102,6 +122,20 @@
    --response-before        0       m_Response_Before = 0
    --response-after         0       m_Response_After = 0
    --simulated             false    m_Is_Simulated = false
+   --isolate               false    m_Is_Isolated = true
+   --no-isolate             ~       m_Is_Isolated = false
+   --profile               false    m_Is_Profiled = true
+   --no-profile             ~       m_Is_Profiled = false
+   --perf-counters         false    m_Perf_Counters = true
+   --no-perf-counters       ~       m_Perf_Counters = false
+   --huge-pages            false    m_Huge_Pages = true
+   --no-huge-pages          ~       m_Huge_Pages = false
+   --cache                 true     m_Use_Cache = true
+   --no-cache               ~       m_Use_Cache = false
+   --until-fail            false    m_Until_Fail = true
+   --no-until-fail          ~       m_Until_Fail = false
+   --shuffle               false    m_Shuffle = true
+   --no-shuffle             ~       m_Shuffle = false
 \endverbatim
  *
  *    In unit testing, --no-verbose and --verbose are opposites.  If the
@@ -116,6 +150,14 @@
  *    However, there are other options that control output that the unit-test
  *    library does use:  --show-value, --show-progress, and more.
  *
+ *    Once unit_test_run_init() has finished with them, the options of a
+ *    run are not changed again.  The tests, the --jobs workers, and the
+ *    xpc::cut_options views of the C++ library all share the one
+ *    structure, read-only, instead of each taking a copy.  The only
+ *    setting that changes from test to test, the number of the test being
+ *    run, is kept in a small per-thread test context instead; see
+ *    unit_test_options_context_set().
+ *
  * \example
  *    You can show a lot of stuff if you compile for debug and use a lot of
  *    options, as in:
@@ -132,6 +174,7 @@
  */
 
 #include <xpc/unit_test_options.h>     /* unit_test_options_t functions       */
+#include <xpc/perf_counters.h>         /* xpccut_perf_available()             */
 #include <xpc/portable_subset.h>       /* xpccut "error print" functions      */
 #include <ctype.h>                     /* defines the isdigit() C macro       */
 
@@ -143,6 +186,32 @@
 #include <stdio.h>                     /* fprintf() and stdout                */
 #endif
 
+/**
+ *    Holds the part of the options that changes from test to test.  Each
+ *    thread has one of its own, so that the unit_test_options_t of a run
+ *    can be shared by all of the --jobs workers without being written.
+ */
+
+typedef struct
+{
+   /**
+    *    The number of the test being run by this thread, or
+    *    XPCCUT_NO_CURRENT_TEST.
+    */
+
+   int m_Current_Test_Number;
+
+} unit_test_context_t;
+
+/**
+ *    Provides the test context of the calling thread.
+ */
+
+static XPCCUT_THREAD_LOCAL unit_test_context_t gs_Test_Context =
+{
+   XPCCUT_NO_CURRENT_TEST
+};
+
 /**
  *    Provides a default initializer for a unit_test_options_t structure.
  *    The settings are given by the following variables:
@@ -162,6 +231,12 @@
  *       -  XPCCUT_NO_SINGLE_CASE
  *       -  XPCCUT_NO_SINGLE_SUB_TEST
  *       -  XPCCUT_TEST_SLEEP_TIME
+ *       -  XPCCUT_JOB_COUNT
+ *       -  XPCCUT_IS_ISOLATED
+ *       -  XPCCUT_TEST_TIMEOUT
+ *       -  XPCCUT_SHARD_COUNT
+ *       -  XPCCUT_SHARD_INDEX
+ *       -  XPCCUT_SHARD_MODE
  *
  * \note
  *    It is recommended that calling this function always be the first
@@ -207,6 +282,37 @@ unit_test_options_init
       options->m_Single_Sub_Test             = XPCCUT_NO_SINGLE_SUB_TEST;
       options->m_Single_Sub_Test_Name[0]     = 0;
       options->m_Test_Sleep_Time             = XPCCUT_TEST_SLEEP_TIME;
+      options->m_Job_Count                   = XPCCUT_JOB_COUNT;
+      options->m_Fuzz_Job_Count              = XPCCUT_FUZZ_JOB_COUNT;
+      options->m_Is_Isolated                 = XPCCUT_IS_ISOLATED;
+      options->m_Test_Timeout                = XPCCUT_TEST_TIMEOUT;
+      options->m_Shard_Count                 = XPCCUT_SHARD_COUNT;
+      options->m_Shard_Index                 = XPCCUT_SHARD_INDEX;
+      options->m_Shard_Mode                  = XPCCUT_SHARD_MODE;
+      options->m_Durations_File[0]           = 0;
+      options->m_Save_Durations_File[0]      = 0;
+      options->m_Report_Format               = XPCCUT_REPORT_FORMAT;
+      options->m_Report_File[0]              = 0;
+      options->m_Shard_Map                   = nullptr;
+      options->m_Names                       = nullptr;
+      options->m_Baseline_File[0]            = 0;
+      options->m_Write_Baseline_File[0]      = 0;
+      options->m_Perf_Tolerance              = XPCCUT_PERF_TOLERANCE;
+      options->m_Baseline                    = nullptr;
+      options->m_Baseline_Count              = 0;
+      options->m_Is_Profiled                 = XPCCUT_IS_PROFILED;
+      options->m_Perf_Counters               = XPCCUT_PERF_COUNTERS;
+      options->m_Huge_Pages                  = XPCCUT_HUGE_PAGES;
+      options->m_Trace_File[0]               = 0;
+      options->m_History_File[0]             = 0;
+      options->m_Order                       = XPCCUT_ORDER;
+      options->m_Cache_File[0]               = 0;
+      options->m_Cache_Key[0]                = 0;
+      options->m_Use_Cache                   = XPCCUT_USE_CACHE;
+      options->m_Repeat_Count                = XPCCUT_REPEAT_COUNT;
+      options->m_Until_Fail                  = XPCCUT_UNTIL_FAIL;
+      options->m_Shuffle                     = XPCCUT_SHUFFLE;
+      options->m_Shuffle_Seed                = XPCCUT_SHUFFLE_SEED;
       options->m_Current_Test_Number         = XPCCUT_NO_CURRENT_TEST;
       options->m_Response_Before             = 0;
       options->m_Response_After              = 0;
@@ -303,6 +409,37 @@ unit_test_options_initialize
       options->m_Single_Sub_Test_Name[0]     = 0;
       options->m_Need_Subtests               = XPCCUT_NEED_SUBTESTS;
       options->m_Force_Failure               = XPCCUT_FORCE_FAILURE;
+      options->m_Job_Count                   = XPCCUT_JOB_COUNT;
+      options->m_Fuzz_Job_Count              = XPCCUT_FUZZ_JOB_COUNT;
+      options->m_Is_Isolated                 = XPCCUT_IS_ISOLATED;
+      options->m_Test_Timeout                = XPCCUT_TEST_TIMEOUT;
+      options->m_Shard_Count                 = XPCCUT_SHARD_COUNT;
+      options->m_Shard_Index                 = XPCCUT_SHARD_INDEX;
+      options->m_Shard_Mode                  = XPCCUT_SHARD_MODE;
+      options->m_Durations_File[0]           = 0;
+      options->m_Save_Durations_File[0]      = 0;
+      options->m_Report_Format               = XPCCUT_REPORT_FORMAT;
+      options->m_Report_File[0]              = 0;
+      options->m_Shard_Map                   = nullptr;
+      options->m_Names                       = nullptr;
+      options->m_Baseline_File[0]            = 0;
+      options->m_Write_Baseline_File[0]      = 0;
+      options->m_Perf_Tolerance              = XPCCUT_PERF_TOLERANCE;
+      options->m_Baseline                    = nullptr;
+      options->m_Baseline_Count              = 0;
+      options->m_Is_Profiled                 = XPCCUT_IS_PROFILED;
+      options->m_Perf_Counters               = XPCCUT_PERF_COUNTERS;
+      options->m_Huge_Pages                  = XPCCUT_HUGE_PAGES;
+      options->m_Trace_File[0]               = 0;
+      options->m_History_File[0]             = 0;
+      options->m_Order                       = XPCCUT_ORDER;
+      options->m_Cache_File[0]               = 0;
+      options->m_Cache_Key[0]                = 0;
+      options->m_Use_Cache                   = XPCCUT_USE_CACHE;
+      options->m_Repeat_Count                = XPCCUT_REPEAT_COUNT;
+      options->m_Until_Fail                  = XPCCUT_UNTIL_FAIL;
+      options->m_Shuffle                     = XPCCUT_SHUFFLE;
+      options->m_Shuffle_Seed                = XPCCUT_SHUFFLE_SEED;
       options->m_Current_Test_Number         = XPCCUT_NO_CURRENT_TEST;
       options->m_Response_Before             = 0;
       options->m_Response_After              = 0;
@@ -335,9 +472,8 @@ unit_test_options_show_error
 
       if (! xpccut_is_silent())                               /* --silent?   */
       {
-         fprintf
+         xpccut_print_error
          (
-            stderr,
             "%s %d, %s %d\n",
             _("group"), unit_test_options_test_group(options),
             _("case"), unit_test_options_test_case(options)
@@ -388,7 +524,7 @@ unit_test_options_show_info_value
    if (xpccut_thisptr(options) && unit_test_options_show_progress(options))
    {
       if (! xpccut_is_silent() && cut_not_nullptr(message))
-         fprintf(stdout, "  %s %d\n", message, value);
+         xpccut_print("  %s %d\n", message, value);
    }
 }
 
@@ -474,7 +610,7 @@ unit_test_options_parse
              * A no-op to help calling applications that do more than testing.
              */
 
-            printf("--test option from the caller\n");
+            xpccut_print("--test option from the caller\n");
          }
          else if (strcmp(arg, "--verbose") == 0)
          {
@@ -602,6 +738,41 @@ unit_test_options_parse
 
             result = unit_test_options_test_sleep_time_set(options, count);
          }
+         else if ((strcmp(arg, "--jobs") == 0) || (strcmp(arg, "-j") == 0))
+         {
+            int count = 0;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+               count = atoi(argv[currentarg]);
+
+            result = unit_test_options_job_count_set(options, count);
+         }
+         else if (strcmp(arg, "--fuzz-jobs") == 0)
+         {
+            int count = 0;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+               count = atoi(argv[currentarg]);
+
+            result = unit_test_options_fuzz_job_count_set(options, count);
+         }
+         else if (strcmp(arg, "--isolate") == 0)
+         {
+            unit_test_options_is_isolated_set(options, true);
+         }
+         else if (strcmp(arg, "--no-isolate") == 0)
+         {
+            unit_test_options_is_isolated_set(options, false);
+         }
+         else if ((strcmp(arg, "--test-timeout") == 0))
+         {
+            int count = 0;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+               count = atoi(argv[currentarg]);
+
+            result = unit_test_options_test_timeout_set(options, count);
+         }
          else if (strcmp(arg, "--group") == 0)
          {
             int count = 0;
@@ -677,98 +848,459 @@ unit_test_options_parse
             else
                result = false;
          }
-         else if
-         (
-            (strcmp(arg, "--response-before") == 0) ||
-            (strcmp(arg, "--rb") == 0)
-         )
+         else if (strcmp(arg, "--shard-count") == 0)
+         {
+            int count = 0;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+               count = atoi(argv[currentarg]);
+
+            result = unit_test_options_shard_count_set(options, count);
+         }
+         else if (strcmp(arg, "--shard-index") == 0)
          {
+            int count = XPCCUT_INVALID_PARAMETER;
             ++currentarg;
             if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
             {
-               result = unit_test_options_prompt_before_set
+               if (isdigit(argv[currentarg][0]))
+                  count = atoi(argv[currentarg]);
+            }
+            result = unit_test_options_shard_index_set(options, count);
+         }
+         else if (strcmp(arg, "--shard-by") == 0)
+         {
+            ++currentarg;
+            result = (currentarg < argc) && cut_not_nullptr(argv[currentarg]);
+            if (result)
+            {
+               const char * mode = argv[currentarg];
+               if (strcmp(mode, "index") == 0)
+               {
+                  result = unit_test_options_shard_mode_set
+                  (
+                     options, XPCCUT_SHARD_BY_INDEX
+                  );
+               }
+               else if (strcmp(mode, "hash") == 0)
+               {
+                  result = unit_test_options_shard_mode_set
+                  (
+                     options, XPCCUT_SHARD_BY_HASH
+                  );
+               }
+               else if (strcmp(mode, "duration") == 0)
+               {
+                  result = unit_test_options_shard_mode_set
+                  (
+                     options, XPCCUT_SHARD_BY_DURATION
+                  );
+               }
+               else
+               {
+                  result = false;
+                  xpccut_errprint_ex(_("unknown shard mode"), mode);
+               }
+            }
+            else
+               xpccut_errprint_ex(_("argument required"), "--shard-by");
+         }
+         else if (strcmp(arg, "--durations") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_durations_file_set
                (
-                  options, argv[currentarg][0]
+                  options, argv[currentarg]
                );
             }
             else
             {
                result = false;
-               xpccut_errprint_ex(_("argument required"), "--response-before");
+               xpccut_errprint_ex(_("argument required"), "--durations");
             }
          }
-         else if
-         (
-            (strcmp(arg, "--response-after") == 0) ||
-            (strcmp(arg, "--ra") == 0)
-         )
+         else if (strcmp(arg, "--save-durations") == 0)
          {
             ++currentarg;
             if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
             {
-               result = unit_test_options_prompt_after_set
+               result = unit_test_options_save_durations_file_set
                (
-                  options, argv[currentarg][0]
+                  options, argv[currentarg]
                );
             }
             else
             {
                result = false;
-               xpccut_errprint_ex(_("argument required"), "--response-after");
+               xpccut_errprint_ex(_("argument required"), "--save-durations");
             }
          }
-         else if ((strcmp(arg, "--simulated") == 0))
+         else if (strcmp(arg, "--report-format") == 0)
          {
-            unit_test_options_is_simulated_set(options, true);
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               const char * format = argv[currentarg];
+               unit_test_report_format_t v = XPCCUT_REPORT_NONE;
+               if (strcmp(format, "junit") == 0)
+                  v = XPCCUT_REPORT_JUNIT;
+               else if (strcmp(format, "jsonl") == 0)
+                  v = XPCCUT_REPORT_JSONL;
+               else if (strcmp(format, "tap") == 0)
+                  v = XPCCUT_REPORT_TAP;
+               else if (strcmp(format, "none") != 0)
+               {
+                  result = false;
+                  xpccut_errprint_ex(_("unknown report format"), format);
+               }
+               if (result)
+                  result = unit_test_options_report_format_set(options, v);
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--report-format");
+            }
+         }
+         else if (strcmp(arg, "--report-file") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_report_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--report-file");
+            }
+         }
+         else if (strcmp(arg, "--baseline") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_baseline_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--baseline");
+            }
+         }
+         else if (strcmp(arg, "--write-baseline") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_write_baseline_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--write-baseline");
+            }
+         }
+         else if (strcmp(arg, "--perf-tolerance") == 0)
+         {
+            int percent = XPCCUT_INVALID_PARAMETER;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               if (isdigit(argv[currentarg][0]))
+                  percent = atoi(argv[currentarg]);
+            }
+            result = unit_test_options_perf_tolerance_set(options, percent);
+         }
+         else if (strcmp(arg, "--profile") == 0)
+         {
+            unit_test_options_is_profiled_set(options, true);
+         }
+         else if (strcmp(arg, "--no-profile") == 0)
+         {
+            unit_test_options_is_profiled_set(options, false);
+         }
+         else if (strcmp(arg, "--perf-counters") == 0)
+         {
+            unit_test_options_perf_counters_set(options, true);
+         }
+         else if (strcmp(arg, "--no-perf-counters") == 0)
+         {
+            unit_test_options_perf_counters_set(options, false);
+         }
+         else if (strcmp(arg, "--huge-pages") == 0)
+         {
+            unit_test_options_huge_pages_set(options, true);
+         }
+         else if (strcmp(arg, "--no-huge-pages") == 0)
+         {
+            unit_test_options_huge_pages_set(options, false);
+         }
+         else if (strcmp(arg, "--trace-file") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_trace_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--trace-file");
+            }
+         }
+         else if (strcmp(arg, "--history") == 0)
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_history_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--history");
+            }
          }
          else if
          (
-            (strcmp(arg, "--no-simulated") == 0) ||
-            (strcmp(arg, "--not-simulated") == 0)
+            strcmp(arg, "--order") == 0 || strncmp(arg, "--order=", 8) == 0
          )
          {
-            unit_test_options_is_simulated_set(options, false);
+            const char * order = nullptr;
+            if (arg[7] == '=')
+               order = &arg[8];
+            else if (++currentarg < argc)
+               order = argv[currentarg];
+
+            result = cut_not_nullptr(order);
+            if (result)
+            {
+               if (strcmp(order, "load") == 0)
+               {
+                  result = unit_test_options_order_set
+                  (
+                     options, XPCCUT_ORDER_LOAD
+                  );
+               }
+               else if (strcmp(order, "failed-first") == 0)
+               {
+                  result = unit_test_options_order_set
+                  (
+                     options, XPCCUT_ORDER_FAILED_FIRST
+                  );
+               }
+               else if (strcmp(order, "fastest-first") == 0)
+               {
+                  result = unit_test_options_order_set
+                  (
+                     options, XPCCUT_ORDER_FASTEST_FIRST
+                  );
+               }
+               else
+               {
+                  result = false;
+                  xpccut_errprint_ex(_("unknown test order"), order);
+               }
+            }
+            else
+               xpccut_errprint_ex(_("argument required"), "--order");
          }
-         else if ((strcmp(arg, "--text-synch") == 0))
+         else if (strcmp(arg, "--cache-file") == 0)
          {
-            unit_test_options_use_text_synch_set(options, true);
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_cache_file_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--cache-file");
+            }
          }
-         else if ((strcmp(arg, "--no-text-synch") == 0))
+         else if (strcmp(arg, "--cache-key") == 0)
          {
-            unit_test_options_use_text_synch_set(options, false);
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_cache_key_set
+               (
+                  options, argv[currentarg]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--cache-key");
+            }
          }
-         else if (strcmp(arg, "--version") == 0)
+         else if (strcmp(arg, "--cache") == 0)
          {
-            do_version = true;
+            unit_test_options_use_cache_set(options, true);
          }
-         else if (strcmp(arg, "-v") == 0)
+         else if (strcmp(arg, "--no-cache") == 0)
          {
-            do_version = true;
-            do_version_short = true;
+            unit_test_options_use_cache_set(options, false);
          }
-         else if (strcmp(arg, "--help") == 0)
+         else if (strcmp(arg, "--repeat") == 0)
          {
-            do_help = true;
-         }
-
-         /**
-          *    Not handled:
-\verbatim
-               else xpccut_errprint_ex(_("illegal option"), arg);
-\endverbatim
-          *    Non-unit-test options have to be allowed in this loop, since we
-          *    may be passing the same command line to a number of different
-          *    parsing functions.  Hence, there is no checking for illegal
-          *    options at this time.
-          */
-
-         ++currentarg;
-      }
+            int count = 0;
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+               count = atoi(argv[currentarg]);
 
-      /*
-       * Although these options are supposed to result in no output when
-       * --silent is in force, we do want to run the routines for testing
-       *  purposes, and so we let them, in the end, honor the --silent
+            result = unit_test_options_repeat_count_set(options, count);
+         }
+         else if (strcmp(arg, "--until-fail") == 0)
+         {
+            unit_test_options_until_fail_set(options, true);
+         }
+         else if (strcmp(arg, "--no-until-fail") == 0)
+         {
+            unit_test_options_until_fail_set(options, false);
+         }
+         else if (strcmp(arg, "--shuffle") == 0)
+         {
+            unit_test_options_shuffle_set(options, true);
+         }
+         else if (strcmp(arg, "--no-shuffle") == 0)
+         {
+            unit_test_options_shuffle_set(options, false);
+         }
+         else if (strcmp(arg, "--shuffle-seed") == 0)
+         {
+            ++currentarg;
+            if
+            (
+               (currentarg < argc) && cut_not_nullptr(argv[currentarg]) &&
+               isdigit(argv[currentarg][0])
+            )
+            {
+               unsigned int seed = (unsigned int) strtoul
+               (
+                  argv[currentarg], nullptr, 10
+               );
+               result = unit_test_options_shuffle_seed_set(options, seed);
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--shuffle-seed");
+            }
+         }
+         else if
+         (
+            (strcmp(arg, "--response-before") == 0) ||
+            (strcmp(arg, "--rb") == 0)
+         )
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_prompt_before_set
+               (
+                  options, argv[currentarg][0]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--response-before");
+            }
+         }
+         else if
+         (
+            (strcmp(arg, "--response-after") == 0) ||
+            (strcmp(arg, "--ra") == 0)
+         )
+         {
+            ++currentarg;
+            if ((currentarg < argc) && cut_not_nullptr(argv[currentarg]))
+            {
+               result = unit_test_options_prompt_after_set
+               (
+                  options, argv[currentarg][0]
+               );
+            }
+            else
+            {
+               result = false;
+               xpccut_errprint_ex(_("argument required"), "--response-after");
+            }
+         }
+         else if ((strcmp(arg, "--simulated") == 0))
+         {
+            unit_test_options_is_simulated_set(options, true);
+         }
+         else if
+         (
+            (strcmp(arg, "--no-simulated") == 0) ||
+            (strcmp(arg, "--not-simulated") == 0)
+         )
+         {
+            unit_test_options_is_simulated_set(options, false);
+         }
+         else if ((strcmp(arg, "--text-synch") == 0))
+         {
+            unit_test_options_use_text_synch_set(options, true);
+         }
+         else if ((strcmp(arg, "--no-text-synch") == 0))
+         {
+            unit_test_options_use_text_synch_set(options, false);
+         }
+         else if (strcmp(arg, "--version") == 0)
+         {
+            do_version = true;
+         }
+         else if (strcmp(arg, "-v") == 0)
+         {
+            do_version = true;
+            do_version_short = true;
+         }
+         else if (strcmp(arg, "--help") == 0)
+         {
+            do_help = true;
+         }
+
+         /**
+          *    Not handled:
+\verbatim
+               else xpccut_errprint_ex(_("illegal option"), arg);
+\endverbatim
+          *    Non-unit-test options have to be allowed in this loop, since we
+          *    may be passing the same command line to a number of different
+          *    parsing functions.  Hence, there is no checking for illegal
+          *    options at this time.
+          */
+
+         ++currentarg;
+      }
+
+      /*
+       * Although these options are supposed to result in no output when
+       * --silent is in force, we do want to run the routines for testing
+       *  purposes, and so we let them, in the end, honor the --silent
        *  option.
        */
 
@@ -863,16 +1395,19 @@ static const char * const unit_test_options_gHelpText =
    "                       Turn it on to see if it can help you further pin\n"
    "                       down errors.\n"
    "%s\n"
-   "%s\n"
+   "%s%s\n"
    "%s\n"
    ;
 
 /*
- * ABOVE:  The last three string arguments are:
+ * ABOVE:  The last four string arguments are:
  *
  *         unit_test_options_gHelpText_2
- *         unit_test_options_gHelpText_3
+ *         unit_test_options_gHelpText_3, unit_test_options_gHelpText_4
  *         naddhelp
+ *
+ *         The third text is split in two to keep each string under the
+ *         4095 characters that C99 compilers must support.
  */
 
 static const char * const unit_test_options_gHelpText_2 =
@@ -906,6 +1441,25 @@ static const char * const unit_test_options_gHelpText_2 =
    " --sleep-time s        Sleep s milliseconds after each test case [the\n"
    "                       default value of this option is 0, which means no\n"
    "                       sleep].  The maximum value is 3600000 (one hour).\n"
+   " --jobs n, -j n        Run the tests in a pool of n worker threads [the\n"
+   "                       default is 1].  The results are still reported in\n"
+   "                       the order the tests were loaded.  The maximum\n"
+   "                       value is 256.  Ignored if --interactive,\n"
+"                       --case-pause, or --summarize are in force.\n"
+   " --fuzz-jobs n         Run the fuzz campaigns of the tests in n worker\n"
+   "                       threads [the default is 1].  Each worker has its\n"
+   "                       own seed, derived from the base seed, and the\n"
+   "                       workers share the inputs that reach new code.\n"
+   "                       The maximum value is 256.\n"
+   " --isolate             Run each test case in a child process of its own,\n"
+   "                       up to --jobs of them at a time.  A test that\n"
+   "                       crashes or times out is counted as a failure, and\n"
+   "                       the remaining tests still run.\n"
+   " --no-isolate          Run the tests in this process.  The default.\n"
+   " --test-timeout ms     Fail a test that runs longer than ms milliseconds\n"
+   "                       [the default value of this option is 0, which means\n"
+   "                       no limit].  A test that is still hung some time\n"
+   "                       later ends the run, unless --isolate is on.\n"
    " --group g             Select one test group to run [from 1 on up].\n"
    " --case c              Select one test case to run [requires the --group \n"
    "                       option to also be specified.]\n"
@@ -920,6 +1474,79 @@ static const char * const unit_test_options_gHelpText_3 =
    "                       always run, even if s != 1.  Note the two forms of\n"
    "                       the options, because it is so easy to forget the\n"
    "                       hyphen, and thus be confused.\n"
+   " --shard-count n       Split the loaded tests into n shards, and run only\n"
+   "                       the shard given by --shard-index.  The other tests\n"
+   "                       are skipped.  The default is 1, and the maximum is\n"
+   "                       1024.\n"
+   " --shard-index i       Select the shard to run [from 0 to n - 1].\n"
+   " --shard-by m          Assign tests to shards by 'index' (the default),\n"
+   "                       'hash' (of the group and case names), or\n"
+   "                       'duration' (balanced by the --durations file).\n"
+   " --durations f         Read the test durations for '--shard-by duration'\n"
+   "                       from file f.\n"
+   " --save-durations f    Write the durations of the tests that ran to file\n"
+   "                       f.  The files saved by all shards can be combined\n"
+   "                       with 'cat' to make the next --durations file.\n"
+   " --report-format f     Write a machine-readable report as the tests run,\n"
+   "                       one record per sub-test, in format 'junit',\n"
+   "                       'jsonl', 'tap', or 'none' (the default).\n"
+   " --report-file f       Write the report to file f.  The default is\n"
+   "                       unit_test_report.xml, .jsonl, or .tap.\n"
+   " --baseline f          Compare performance checks against the baseline\n"
+   "                       file f.\n"
+   " --write-baseline f    Write the performance measurements to file f, to\n"
+   "                       be the --baseline file of later runs.\n"
+   " --perf-tolerance p    Fail a performance check that is more than p\n"
+   "                       percent slower than its baseline, and beyond the\n"
+   "                       noise of the two measurements.  The default is 25.\n"
+   " --profile             Show the CPU time, resident-set growth, page\n"
+   "                       faults, and context switches of each test, and\n"
+   "                       their totals.\n"
+   " --no-profile          Show only the duration of each test.  The default.\n"
+   " --perf-counters       Show the CPU cycles, instructions, cache misses,\n"
+   "                       and branch misses of each test, and their totals,\n"
+   "                       where the hardware counters can be read (Linux).\n"
+   " --no-perf-counters    Do not read the hardware counters.  The default.\n"
+   " --huge-pages          Map the scratch arenas of the tests on huge pages,\n"
+   "                       where the system allows it.\n"
+   " --no-huge-pages       Use ordinary pages for the arenas.  The default.\n"
+   " --trace-file f        Record the time spent in each test, and in each\n"
+   "                       XPC_SEQUENCE scope, in every thread, and write\n"
+   "                       it to file f as a Chrome (Perfetto) JSON trace.\n"
+   " --history f           Read the result and duration of each test from\n"
+   "                       file f, if it exists, and write them back after\n"
+   "                       the run.  The --jobs workers use the durations to\n"
+   "                       start the longest tests first.\n"
+   " --order m             Run the tests in 'load' order (the default), or\n"
+   "                       'failed-first' or 'fastest-first', according to\n"
+   "                       the --history file.  The tests keep their numbers.\n"
+   ;
+
+static const char * const unit_test_options_gHelpText_4 =
+
+   " --repeat n            Run the selected tests n times, in rounds, and\n"
+   "                       report the fewest, mean, and most milliseconds\n"
+   "                       of each test.  With --jobs, the runs of a test\n"
+   "                       can overlap, to bring out races.\n"
+   " --until-fail          Repeat the rounds until a test fails, or until\n"
+   "                       the --repeat count, if given, is used up.\n"
+   " --no-until-fail       Stop after the --repeat count.  The default.\n"
+   " --shuffle             Run the tests in a random order, which differs\n"
+   "                       in each round.  The seed is shown with\n"
+   "                       --show-progress, so the order can be repeated.\n"
+   " --no-shuffle          Run the tests in the --order.  The default.\n"
+   " --shuffle-seed s      Shuffle, with round i using seed s + i.\n"
+   " --cache-file f        Report the tests that passed in an earlier run,\n"
+   "                       with the same --cache-key, as cached passes,\n"
+   "                       without running them, and write the passes of\n"
+   "                       this run back to file f.\n"
+   " --cache-key k         Use k, such as a source revision, as the content\n"
+   "                       part of the cache keys.  By default, the key is a\n"
+   "                       hash of the test application, where it can be\n"
+   "                       read, so that a rebuild runs every test again.\n"
+   " --cache               Use the --cache-file.  The default.\n"
+   " --no-cache            Run every test, and write the --cache-file\n"
+   "                       afresh.  --force-failure also ignores the cache.\n"
    " --summarize           Simply list the tests.  Do not execute them. Also\n"
    " --summary             sets --silent to avoid gratuitous errors from\n"
    "                       tests that test failure scenarios.  (Note:  add the\n"
@@ -1007,6 +1634,7 @@ unit_test_options_help
       addonlength   = strlen(naddhelp);
       total += strlen(unit_test_options_gHelpText_2);
       total += strlen(unit_test_options_gHelpText_3);
+      total += strlen(unit_test_options_gHelpText_4);
       total += appnamlength + versionlength + addonlength;
       buffer = malloc(total + PADDING);
       if (cut_not_nullptr(buffer))
@@ -1017,9 +1645,10 @@ unit_test_options_help
             nappname, nversion, nappname,
             unit_test_options_gHelpText_2,
             unit_test_options_gHelpText_3,
+            unit_test_options_gHelpText_4,
             naddhelp
          );
-         fprintf(stdout, "%s", buffer);
+         xpccut_print("%s", buffer);
          free(buffer);
       }
       else
@@ -1055,14 +1684,14 @@ unit_test_options_version
    {
       if (cut_is_nullptr(version))
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "XPCCUT %s (%s)\n", XPC_VERSION, XPC_VERSION_DATE_SHORT
+            "XPCCUT %s (%s)\n", XPC_VERSION, XPC_VERSION_DATE_SHORT
          );
       }
       else
       {
-         fprintf(stdout, "XPCCUT %s %s\n", _("version"), version);
+         xpccut_print("XPCCUT %s %s\n", _("version"), version);
       }
    }
 }
@@ -2106,7 +2735,7 @@ unit_test_options_single_subtest_set
          else
          {
             if (unit_test_options_show_progress(options))
-               fprintf(stdout, "  %s\n", _("No restrictions in sub-tests"));
+               xpccut_print("  %s\n", _("No restrictions in sub-tests"));
          }
       }
    }
@@ -2305,178 +2934,2183 @@ unit_test_options_test_sleep_time
 }
 
 /**
- *    Sets the value of the m_Need_Subtests field.
+ *    Sets the value of m_Job_Count.
  *
  * \return
  *    Returns 'true' if the parameters are valid and the setting succeeds.
  *
  * \unittests
- *    -  unit_unit_test_03_24()
+ *    -  unit_unit_test_03_30()
  */
 
 cbool_t
-unit_test_options_need_subtests_set
+unit_test_options_job_count_set
 (
    unit_test_options_t * options,   /**< A "this" pointer for this function.  */
-   cbool_t f                        /**< The value of the flag to be set.     */
+   int v                            /**< The value to use for the setting.    */
 )
 {
    cbool_t result = xpccut_thisptr(options);
    if (result)
    {
-      options->m_Need_Subtests = f;
-      if (f)
-         unit_test_options_show_info(options, _("requiring sub-tests enabled"));
+      if ((v < 1) || (v > XPCCUT_JOBS_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing job count"));
+         result = false;
+         options->m_Job_Count = XPCCUT_JOB_COUNT;
+      }
+      else
+      {
+         options->m_Job_Count = v;
+         unit_test_options_show_info_value
+         (
+            options, _("number of test worker threads"), v
+         );
+      }
    }
    return result;
 }
 
 /**
- *    Provides the value of m_Need_Subtests.
+ *    Provides the value of the m_Job_Count field.
  *
  * \return
- *    Returns the value of the m_Need_Subtests flag.
+ *    Returns the value of the m_Job_Count field if the "this" parameter is
+ *    valid and the value is sane.  Otherwise, the default value,
+ *    XPCCUT_JOB_COUNT, is returned.
  *
  * \unittests
- *    -  unit_unit_test_03_24()
+ *    -  unit_unit_test_03_30()
  */
 
-cbool_t
-unit_test_options_need_subtests
+int
+unit_test_options_job_count
 (
    const unit_test_options_t * options /**< A this-pointer for the function.  */
 )
 {
-   cbool_t result = xpccut_thisptr(options);
-   result = result ? options->m_Need_Subtests : XPCCUT_NEED_SUBTESTS ;
+   int result = XPCCUT_JOB_COUNT;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Job_Count >= 1;
+      if (ok)
+         ok = options->m_Job_Count <= XPCCUT_JOBS_MAX;
+
+      if (ok)
+         result = options->m_Job_Count;
+   }
    return result;
 }
 
 /**
- *    Sets the value of the m_Force_Failure field.
+ *    Sets the value of m_Fuzz_Job_Count.
  *
  * \return
  *    Returns 'true' if the parameters are valid and the setting succeeds.
  *
  * \unittests
- *    -  unit_unit_test_03_25()
+ *    -  unit_unit_test_03_37()
  */
 
 cbool_t
-unit_test_options_force_failure_set
+unit_test_options_fuzz_job_count_set
 (
    unit_test_options_t * options,   /**< A "this" pointer for this function.  */
-   cbool_t f                        /**< The value of the flag to be set.     */
+   int v                            /**< The value to use for the setting.    */
 )
 {
    cbool_t result = xpccut_thisptr(options);
    if (result)
    {
-      options->m_Force_Failure = f;
-      if (f)
-         unit_test_options_show_info(options, _("forcing test-failure enabled"));
+      if ((v < 1) || (v > XPCCUT_JOBS_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing fuzz job count"));
+         result = false;
+         options->m_Fuzz_Job_Count = XPCCUT_FUZZ_JOB_COUNT;
+      }
+      else
+      {
+         options->m_Fuzz_Job_Count = v;
+         unit_test_options_show_info_value
+         (
+            options, _("number of fuzz worker threads"), v
+         );
+      }
    }
    return result;
 }
 
 /**
- *    Provides the value of m_Force_Failure.
+ *    Provides the value of the m_Fuzz_Job_Count field.
  *
  * \return
- *    Returns the value of the m_Force_Failure flag.
+ *    Returns the value of the m_Fuzz_Job_Count field if the "this"
+ *    parameter is valid and the value is sane.  Otherwise, the default
+ *    value, XPCCUT_FUZZ_JOB_COUNT, is returned.
  *
  * \unittests
- *    -  unit_unit_test_03_25()
+ *    -  unit_unit_test_03_37()
  */
 
-cbool_t
-unit_test_options_force_failure
+int
+unit_test_options_fuzz_job_count
 (
    const unit_test_options_t * options /**< A this-pointer for the function.  */
 )
 {
-   cbool_t result = xpccut_thisptr(options);
-   result = result ? options->m_Force_Failure : XPCCUT_FORCE_FAILURE ;
+   int result = XPCCUT_FUZZ_JOB_COUNT;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Fuzz_Job_Count >= 1;
+      if (ok)
+         ok = options->m_Fuzz_Job_Count <= XPCCUT_JOBS_MAX;
+
+      if (ok)
+         result = options->m_Fuzz_Job_Count;
+   }
    return result;
 }
 
 /**
- *    Sets the value of m_Current_Test_Number.
- *
- *    This function is provided mainly to allow for clarity in testing the
- *    unit_test_status_initialize() function.
- *
- * \note
- *    Only in rare cases will a developer want to use this function in a
- *    unit-test that is not testing the xpccut library.
+ *    Sets the value of the m_Is_Isolated field.
  *
  * \return
- *    Returns 'true' if the setting was able to be made.  Only zero or
- *    positive values are allowed.
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
  *
  * \unittests
- *    Some of the unit-tests use this function to provide more accurate
- *    progress output.  There is no direct test of this function.
- *    -  unit_unit_test_02_02() [indirect test]
- *    -  unit_unit_test_02_09() [indirect test]
- *    -  unit_unit_test_02_29() [indirect test]
- *    -  unit_unit_test_02_30() [indirect test]
- *    -  unit_unit_test_02_31() [indirect test]
+ *    -  unit_unit_test_03_31()
  */
 
 cbool_t
-unit_test_options_current_test_set
+unit_test_options_is_isolated_set
 (
-   unit_test_options_t * options,   /**< The this-pointer for the function.   */
-   int v                            /**< The value to set the test number.    */
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
 )
 {
-   cbool_t result = false;
-   if (xpccut_thisptr(options))
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
    {
-      if (unit_test_options_show_progress(options))
-         fprintf(stdout, "  %s\n", _("Developer is overriding test number"));
-
-      if (v >= 0)
-      {
-         options->m_Current_Test_Number = v;
-         result = true;
-      }
-      else
-         xpccut_errprint_func(_("negative tests numbers are illegal"));
+      options->m_Is_Isolated = f;
+      if (f)
+         unit_test_options_show_info(options, _("test isolation enabled"));
    }
    return result;
 }
 
 /**
- *    Provides the value of m_Current_Test_Number.
- *    This value is a copy of unit_test_t.m_Current_Test_Number.  It
- *    is made available to unit_test_status_initialize() via the
- *    unit_test_options_t structure that is passed to it.
- *
- *    The main purpose of this accessor is to allow the code called by
- *    unit_test_status_initialize() to avoid printing the test number for
- *    tests that are skipped.
+ *    Provides the value of the m_Is_Isolated field.
  *
  * \return
- *    Returns the value of the m_Current_Test_Number value.  If there is a
- *    parameter problem, -1 (XPCCUT_INVALID_PARAMETER) is returned.
- *    The same value (but named XPCCUT_NO_CURRENT_TEST) can be returned if
- *    the test number has not been activated/incremented yet.
+ *    Returns the value of the m_Is_Isolated flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_IS_ISOLATED, is returned.
  *
  * \unittests
- *    -  unit_unit_test_03_26()
+ *    -  unit_unit_test_03_31()
  */
 
-int
-unit_test_options_current_test
+cbool_t
+unit_test_options_is_isolated
 (
    const unit_test_options_t * options /**< A this-pointer for the function.  */
 )
 {
-   int result = XPCCUT_INVALID_PARAMETER;
-   if (xpccut_thisptr(options))
-      result = options->m_Current_Test_Number;
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Is_Isolated : XPCCUT_IS_ISOLATED ;
+   return result;
+}
+
+/**
+ *    Sets the value of m_Test_Timeout.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_31()
+ */
+
+cbool_t
+unit_test_options_test_timeout_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   int v                            /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((v < 0) || (v > XPCCUT_TIMEOUT_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing test timeout (ms)"));
+         result = false;
+         options->m_Test_Timeout = XPCCUT_TEST_TIMEOUT;
+      }
+      else
+      {
+         options->m_Test_Timeout = v;
+         unit_test_options_show_info_value
+         (
+            options, _("test timeout (ms)"), v
+         );
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Test_Timeout field.
+ *
+ * \return
+ *    Returns the value of the m_Test_Timeout field if the "this" parameter
+ *    is valid and the value is sane.  Otherwise, the default value,
+ *    XPCCUT_TEST_TIMEOUT, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_31()
+ */
+
+int
+unit_test_options_test_timeout
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_TEST_TIMEOUT;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Test_Timeout >= 0;
+      if (ok)
+         ok = options->m_Test_Timeout <= XPCCUT_TIMEOUT_MAX;
+
+      if (ok)
+         result = options->m_Test_Timeout;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Shard_Count.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+cbool_t
+unit_test_options_shard_count_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   int v                            /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((v < 1) || (v > XPCCUT_SHARDS_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing shard count"));
+         result = false;
+         options->m_Shard_Count = XPCCUT_SHARD_COUNT;
+      }
+      else
+      {
+         options->m_Shard_Count = v;
+         unit_test_options_show_info_value(options, _("shard count"), v);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Shard_Count field.
+ *
+ * \return
+ *    Returns the value of the m_Shard_Count field if the "this" parameter
+ *    is valid and the value is sane.  Otherwise, the default value,
+ *    XPCCUT_SHARD_COUNT, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+int
+unit_test_options_shard_count
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_SHARD_COUNT;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Shard_Count >= 1;
+      if (ok)
+         ok = options->m_Shard_Count <= XPCCUT_SHARDS_MAX;
+
+      if (ok)
+         result = options->m_Shard_Count;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Shard_Index.  The index is not checked against
+ *    the shard count here, since the --shard-count option may come later
+ *    on the command line.  unit_test_run_init() checks it.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+cbool_t
+unit_test_options_shard_index_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   int v                            /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((v < 0) || (v >= XPCCUT_SHARDS_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing shard index"));
+         result = false;
+         options->m_Shard_Index = XPCCUT_SHARD_INDEX;
+      }
+      else
+      {
+         options->m_Shard_Index = v;
+         unit_test_options_show_info_value(options, _("shard index"), v);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Shard_Index field.
+ *
+ * \return
+ *    Returns the value of the m_Shard_Index field if the "this" parameter
+ *    is valid and the value is sane.  Otherwise, the default value,
+ *    XPCCUT_SHARD_INDEX, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+int
+unit_test_options_shard_index
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_SHARD_INDEX;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Shard_Index >= 0;
+      if (ok)
+         ok = options->m_Shard_Index < XPCCUT_SHARDS_MAX;
+
+      if (ok)
+         result = options->m_Shard_Index;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Shard_Mode.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+cbool_t
+unit_test_options_shard_mode_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   unit_test_shard_mode_t v         /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((int) v < XPCCUT_SHARD_BY_INDEX || v > XPCCUT_SHARD_BY_DURATION)
+      {
+         unit_test_options_show_error(options, _("Bad shard mode"));
+         result = false;
+         options->m_Shard_Mode = XPCCUT_SHARD_MODE;
+      }
+      else
+         options->m_Shard_Mode = v;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Shard_Mode field.
+ *
+ * \return
+ *    Returns the value of the m_Shard_Mode field if the "this" parameter is
+ *    valid.  Otherwise, the default value, XPCCUT_SHARD_MODE, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+unit_test_shard_mode_t
+unit_test_options_shard_mode
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t ok = xpccut_thisptr(options);
+   return ok ? options->m_Shard_Mode : XPCCUT_SHARD_MODE ;
+}
+
+/**
+ *    Sets the value of m_Durations_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+cbool_t
+unit_test_options_durations_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be read.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Durations_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Durations_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no file is to be read.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+const char *
+unit_test_options_durations_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Durations_File) > 0)
+         result = options->m_Durations_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Save_Durations_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+cbool_t
+unit_test_options_save_durations_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be written.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Save_Durations_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Save_Durations_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no file is to be written.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ */
+
+const char *
+unit_test_options_save_durations_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Save_Durations_File) > 0)
+         result = options->m_Save_Durations_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Report_Format.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_38()
+ */
+
+cbool_t
+unit_test_options_report_format_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   unit_test_report_format_t v      /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((int) v < XPCCUT_REPORT_NONE || v > XPCCUT_REPORT_TAP)
+      {
+         unit_test_options_show_error(options, _("Bad report format"));
+         result = false;
+         options->m_Report_Format = XPCCUT_REPORT_FORMAT;
+      }
+      else
+         options->m_Report_Format = v;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Report_Format field.
+ *
+ * \return
+ *    Returns the value of the m_Report_Format field if the "this" parameter
+ *    is valid.  Otherwise, the default value, XPCCUT_REPORT_FORMAT, is
+ *    returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_38()
+ */
+
+unit_test_report_format_t
+unit_test_options_report_format
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t ok = xpccut_thisptr(options);
+   return ok ? options->m_Report_Format : XPCCUT_REPORT_FORMAT ;
+}
+
+/**
+ *    Sets the value of m_Report_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string restores the default file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_38()
+ */
+
+cbool_t
+unit_test_options_report_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be written.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Report_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the name of the report file.
+ *
+ * \return
+ *    Returns the value of m_Report_File, or, if it is empty, the default
+ *    name for the report format.  If a problem occurs, or no report format
+ *    is set, then nullptr is returned, meaning that no report is written.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_38()
+ */
+
+const char *
+unit_test_options_report_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (options->m_Report_Format != XPCCUT_REPORT_NONE)
+      {
+         if (strlen(options->m_Report_File) > 0)
+            result = options->m_Report_File;
+         else
+            result = xpccut_report_default_file(options->m_Report_Format);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Shard_Map.  This function is meant for
+ *    unit_test_run_init(), which owns the array.
+ *
+ * \return
+ *    Returns 'true' if the "this" parameter is valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_26() [indirect test]
+ */
+
+cbool_t
+unit_test_options_shard_map_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const int * shardmap             /**< The shard of each test, or null.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Shard_Map = shardmap;
+
+   return result;
+}
+
+/**
+ *    Sets the value of m_Names.  This function is meant for
+ *    unit_test_init() and unit_test_initialize(), since the unit_test_t
+ *    owns the table.
+ *
+ * \return
+ *    Returns 'true' if the "this" parameter is valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+cbool_t
+unit_test_options_names_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   xpccut_intern_table_t * names    /**< The table of the run, or null.       */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Names = names;
+
+   return result;
+}
+
+/**
+ *    Provides the value of m_Names.
+ *
+ * \return
+ *    Returns the table of interned names of the run.  If the "this"
+ *    parameter is invalid, or the options belong to no run, null is
+ *    returned, which xpccut_intern_in() takes as the shared table.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06()
+ */
+
+xpccut_intern_table_t *
+unit_test_options_names
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   xpccut_intern_table_t * result = nullptr;
+   if (xpccut_thisptr(options))
+      result = options->m_Names;
+
+   return result;
+}
+
+/**
+ *    Provides a 32-bit FNV-1a hash of the group and case names of a test,
+ *    for the "--shard-by hash" option.  The hash depends only on the
+ *    names, so a test keeps its shard from one build to the next.
+ *
+ * \return
+ *    Returns the hash value.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_options_in_shard().
+ */
+
+static unsigned long
+unit_test_options_name_hash
+(
+   const char * groupname,          /**< The group name, assumed valid.       */
+   const char * casename            /**< The case name, assumed valid.        */
+)
+{
+   unsigned long result = 2166136261UL;
+   const char * name = groupname;
+   int pass;
+   for (pass = 0; pass < 2; ++pass)
+   {
+      const unsigned char * c = (const unsigned char *) name;
+      while (*c != 0)
+      {
+         result ^= *c++;
+         result = (result * 16777619UL) & 0xFFFFFFFFUL;
+      }
+      result ^= '/';                      /* so "ab"+"c" != "a"+"bc"       */
+      result = (result * 16777619UL) & 0xFFFFFFFFUL;
+      name = casename;
+   }
+   return result;
+}
+
+/**
+ *    Tells if the current test is marked XPCCUT_SHARD_ALL in the shard map,
+ *    by unit_test_load_spread().
+ *
+ * \return
+ *    Returns 'true' if the test runs in every shard, with its records split
+ *    among the shards.
+ *
+ * \unittests
+ *    -  Since this is a static (private) function, only indirect tests are
+ *       available.  See the tests for unit_test_options_in_shard().
+ */
+
+static cbool_t
+unit_test_options_is_spread
+(
+   const unit_test_options_t * options  /**< The options, assumed valid.      */
+)
+{
+   int testnumber = unit_test_options_test_number(options);
+   return cut_not_nullptr(options->m_Shard_Map) && testnumber >= 0 &&
+      options->m_Shard_Map[testnumber] == XPCCUT_SHARD_ALL ;
+}
+
+/**
+ *    Decides if a test belongs to the shard selected by the --shard-index
+ *    option.  unit_test_status_initialize() calls this function alongside
+ *    the --group and --case checks, so a test that is not in the shard is
+ *    skipped (XPCCUT_DISPOSITION_DNT).
+ *
+ *    For "--shard-by index" and "--shard-by duration", the test number
+ *    given by unit_test_options_test_number() is used.  If that number is
+ *    not set, because the test is not being run by unit_test_run() or
+ *    xpc::cut::run(), the test is treated as part of the shard.  If
+ *    "--shard-by duration" has no shard map, because no --durations file
+ *    was read, the index mode is used.  A test marked XPCCUT_SHARD_ALL in
+ *    the shard map, by unit_test_load_spread(), is in every shard.
+ *
+ * \return
+ *    Returns 'true' if there is only one shard, or the test is in the
+ *    selected shard.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_32()
+ *    -  unit_unit_test_04_26()
+ */
+
+cbool_t
+unit_test_options_in_shard
+(
+   const unit_test_options_t * options, /**< A this-pointer for the function. */
+   const char * groupname,          /**< The group name of the test.          */
+   const char * casename            /**< The case name of the test.           */
+)
+{
+   cbool_t result = true;
+   int count = unit_test_options_shard_count(options);
+   if (count > 1 && ! unit_test_options_is_spread(options))
+   {
+      int index = unit_test_options_shard_index(options);
+      int testnumber = unit_test_options_test_number(options);
+      unit_test_shard_mode_t mode = unit_test_options_shard_mode(options);
+      if (mode == XPCCUT_SHARD_BY_DURATION && options->m_Shard_Map == nullptr)
+         mode = XPCCUT_SHARD_BY_INDEX;
+
+      switch (mode)
+      {
+      case XPCCUT_SHARD_BY_INDEX:
+
+         if (testnumber >= 0)
+            result = (testnumber % count) == index;
+         break;
+
+      case XPCCUT_SHARD_BY_HASH:
+
+         if (cut_not_nullptr_2(groupname, casename))
+         {
+            unsigned long hash = unit_test_options_name_hash
+            (
+               groupname, casename
+            );
+            result = (int) (hash % (unsigned long) count) == index;
+         }
+         break;
+
+      case XPCCUT_SHARD_BY_DURATION:
+
+         if (testnumber >= 0)
+            result = options->m_Shard_Map[testnumber] == index;
+         break;
+      }
+   }
+   return result;
+}
+
+/**
+ *    Decides if a record of a table belongs to the shard selected by the
+ *    --shard-index option.  Only the records of a test given to
+ *    unit_test_load_spread() are split; record n (re 1) goes to shard
+ * (n - 1) % m_Shard_Count, so that the records are spread evenly.
+ *
+ * \return
+ *    Returns 'true' if there is only one shard, the current test is not
+ *    spread among the shards, or the record is in the selected shard.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_34()
+ */
+
+cbool_t
+unit_test_options_record_in_shard
+(
+   const unit_test_options_t * options, /**< A this-pointer for the function. */
+   int recordnumber                 /**< The number of the record, re 1.      */
+)
+{
+   cbool_t result = true;
+   int count = unit_test_options_shard_count(options);
+   if (count > 1 && recordnumber > 0 && unit_test_options_is_spread(options))
+   {
+      int index = unit_test_options_shard_index(options);
+      result = ((recordnumber - 1) % count) == index;
+   }
+   return result;
+}
+
+/**
+ *    Decides if the --group, --case, and --shard-index options allow a
+ *    test to run.  unit_test_status_initialize() calls this function for
+ *    every test.  unit_test_skip_a_test() calls it for the tests that were
+ *    loaded by unit_test_register(), so that a filtered test is not even
+ *    called.
+ *
+ *    The --group and --case options are each either a number or a name.
+ *    If the number is non-zero, it must match the number of the test.
+ *    Otherwise, if a name was given, it must match the name of the test.
+ *
+ *    The --sub-test option is not checked here, since only the test
+ *    function knows its sub-tests.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the test is allowed
+ *    to run.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_33()
+ */
+
+cbool_t
+unit_test_options_is_selected
+(
+   const unit_test_options_t * options, /**< A this-pointer for the function. */
+   int testgroup,                   /**< The group number of the test.        */
+   int testcase,                    /**< The case number of the test.         */
+   const char * groupname,          /**< The group name of the test.          */
+   const char * casename            /**< The case name of the test.           */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      result = cut_not_nullptr_2(groupname, casename);
+
+   if (result)
+   {
+      int optiongroup = unit_test_options_test_group(options);
+      if (optiongroup != 0)
+      {
+         /*
+          * A non-zero integer --group option was specified.  Only this
+          * unit-test group will be allowed to run.
+          */
+
+         result = testgroup == optiongroup;
+      }
+      else
+      {
+         /*
+          * If a valid group-name was specified by the --group option, then
+          * only a matching unit-test group will be allowed to run.
+          */
+
+         const char * named_group = unit_test_options_named_group(options);
+         if (cut_not_nullptr(named_group))
+            result = strcmp(named_group, groupname) == 0;
+      }
+   }
+   if (result)                      /* this unit-test group is allowed to run */
+   {
+      /*
+       * Now it is time to see if the current case in the group is allowed
+       * to run.  As with the --group option, the --case option is checked
+       * for valid integer or string values.
+       */
+
+      int optioncase = unit_test_options_test_case(options);
+      if (optioncase != 0)
+         result = testcase == optioncase;
+      else
+      {
+         const char * named_case = unit_test_options_named_case(options);
+         if (cut_not_nullptr(named_case))
+            result = strcmp(named_case, casename) == 0;
+      }
+   }
+   if (result)                      /* this case is allowed to run            */
+   {
+      /*
+       * Finally, with the --shard-count option, only the tests of the
+       * selected shard are allowed to run.
+       */
+
+      result = unit_test_options_in_shard(options, groupname, casename);
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Need_Subtests field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_24()
+ */
+
+cbool_t
+unit_test_options_need_subtests_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      options->m_Need_Subtests = f;
+      if (f)
+         unit_test_options_show_info(options, _("requiring sub-tests enabled"));
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Need_Subtests.
+ *
+ * \return
+ *    Returns the value of the m_Need_Subtests flag.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_24()
+ */
+
+cbool_t
+unit_test_options_need_subtests
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Need_Subtests : XPCCUT_NEED_SUBTESTS ;
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Force_Failure field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_25()
+ */
+
+cbool_t
+unit_test_options_force_failure_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      options->m_Force_Failure = f;
+      if (f)
+         unit_test_options_show_info(options, _("forcing test-failure enabled"));
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Force_Failure.
+ *
+ * \return
+ *    Returns the value of the m_Force_Failure flag.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_25()
+ */
+
+cbool_t
+unit_test_options_force_failure
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Force_Failure : XPCCUT_FORCE_FAILURE ;
+   return result;
+}
+
+/**
+ *    Sets the value of m_Baseline_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+cbool_t
+unit_test_options_baseline_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be read.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Baseline_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Baseline_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no file is to be read.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+const char *
+unit_test_options_baseline_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Baseline_File) > 0)
+         result = options->m_Baseline_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Write_Baseline_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+cbool_t
+unit_test_options_write_baseline_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be written.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Write_Baseline_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Write_Baseline_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no file is to be written.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+const char *
+unit_test_options_write_baseline_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Write_Baseline_File) > 0)
+         result = options->m_Write_Baseline_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Perf_Tolerance.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+cbool_t
+unit_test_options_perf_tolerance_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   int v                            /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((v < 0) || (v > XPCCUT_PERF_TOLERANCE_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing perf tolerance"));
+         result = false;
+         options->m_Perf_Tolerance = XPCCUT_PERF_TOLERANCE;
+      }
+      else
+      {
+         options->m_Perf_Tolerance = v;
+         unit_test_options_show_info_value(options, _("perf tolerance"), v);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Perf_Tolerance field.
+ *
+ * \return
+ *    Returns the value of the m_Perf_Tolerance field if the "this"
+ *    parameter is valid and the value is sane.  Otherwise, the default
+ *    value, XPCCUT_PERF_TOLERANCE, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+int
+unit_test_options_perf_tolerance
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_PERF_TOLERANCE;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Perf_Tolerance >= 0;
+      if (ok)
+         ok = options->m_Perf_Tolerance <= XPCCUT_PERF_TOLERANCE_MAX;
+
+      if (ok)
+         result = options->m_Perf_Tolerance;
+   }
+   return result;
+}
+
+/**
+ *    Sets the values of m_Baseline and m_Baseline_Count.  This function is
+ *    meant for unit_test_run_init(), which owns the array.
+ *
+ * \return
+ *    Returns 'true' if the "this" parameter is valid, and the count is
+ *    not negative.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+cbool_t
+unit_test_options_baseline_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const unit_test_baseline_t * baseline, /**< The baseline entries, or null. */
+   int count                        /**< The number of entries.               */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      result = count >= 0;
+
+   if (result)
+   {
+      options->m_Baseline = baseline;
+      options->m_Baseline_Count = cut_is_nullptr(baseline) ? 0 : count ;
+   }
+   return result;
+}
+
+/**
+ *    Looks up an entry of the --baseline file.  If the file holds more
+ *    than one entry for the same measurement, as happens when the files
+ *    written by several shards are concatenated, the last one is used.
+ *
+ * \return
+ *    Returns a pointer to the entry, or nullptr if there is no baseline
+ *    for the measurement.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_34()
+ */
+
+const unit_test_baseline_t *
+unit_test_options_baseline_find
+(
+   const unit_test_options_t * options, /**< A this-pointer for the function. */
+   int testgroup,                   /**< The group number of the test.        */
+   int testcase,                    /**< The case number of the test.         */
+   const char * name                /**< The name of the measurement.         */
+)
+{
+   const unit_test_baseline_t * result = nullptr;
+   if (xpccut_thisptr(options) && cut_not_nullptr(name))
+   {
+      const unit_test_baseline_t * entry = options->m_Baseline;
+      int i;
+      for (i = 0; i < options->m_Baseline_Count; ++i, ++entry)
+      {
+         if (entry->m_Test_Group == testgroup && entry->m_Test_Case == testcase)
+         {
+            if (strcmp(entry->m_Name, name) == 0)
+               result = entry;
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Is_Profiled field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_35()
+ */
+
+cbool_t
+unit_test_options_is_profiled_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      options->m_Is_Profiled = f;
+      if (f)
+         unit_test_options_show_info(options, _("resource profiling enabled"));
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Is_Profiled field.
+ *
+ * \return
+ *    Returns the value of the m_Is_Profiled flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_IS_PROFILED, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_35()
+ */
+
+cbool_t
+unit_test_options_is_profiled
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Is_Profiled : XPCCUT_IS_PROFILED ;
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Perf_Counters field.
+ *
+ *    If the hardware counters cannot be read, the flag is still set, and
+ *    the tests run as usual, without the counts; a note is shown, unless
+ *    --silent is in force.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_36()
+ */
+
+cbool_t
+unit_test_options_perf_counters_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      options->m_Perf_Counters = f;
+      if (f)
+      {
+         if (xpccut_perf_available())
+            unit_test_options_show_info(options, _("hardware counters on"));
+         else
+            xpccut_infoprint(_("hardware counters are not available"));
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Perf_Counters field.
+ *
+ * \return
+ *    Returns the value of the m_Perf_Counters flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_PERF_COUNTERS, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_36()
+ */
+
+cbool_t
+unit_test_options_perf_counters
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Perf_Counters : XPCCUT_PERF_COUNTERS ;
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Huge_Pages field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_40()
+ */
+
+cbool_t
+unit_test_options_huge_pages_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Huge_Pages = f;
+
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Huge_Pages field.
+ *
+ * \return
+ *    Returns the value of the m_Huge_Pages flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_HUGE_PAGES, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_40()
+ */
+
+cbool_t
+unit_test_options_huge_pages
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Huge_Pages : XPCCUT_HUGE_PAGES ;
+   return result;
+}
+
+/**
+ *    Sets the value of m_Trace_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_41()
+ */
+
+cbool_t
+unit_test_options_trace_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the file to be written.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Trace_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Trace_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no trace is recorded.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_41()
+ */
+
+const char *
+unit_test_options_trace_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Trace_File) > 0)
+         result = options->m_Trace_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_History_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_42()
+ */
+
+cbool_t
+unit_test_options_history_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the history file.        */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_History_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_History_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no history is kept.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_42()
+ */
+
+const char *
+unit_test_options_history_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_History_File) > 0)
+         result = options->m_History_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Order.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_42()
+ */
+
+cbool_t
+unit_test_options_order_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   unit_test_order_t v              /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((int) v < XPCCUT_ORDER_LOAD || v > XPCCUT_ORDER_FASTEST_FIRST)
+      {
+         unit_test_options_show_error(options, _("Bad test order"));
+         result = false;
+         options->m_Order = XPCCUT_ORDER;
+      }
+      else
+         options->m_Order = v;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Order field.
+ *
+ * \return
+ *    Returns the value of the m_Order field if the "this" parameter is
+ *    valid.  Otherwise, the default value, XPCCUT_ORDER, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_42()
+ */
+
+unit_test_order_t
+unit_test_options_order
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t ok = xpccut_thisptr(options);
+   return ok ? options->m_Order : XPCCUT_ORDER ;
+}
+
+/**
+ *    Sets the value of m_Cache_File.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the file name.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+cbool_t
+unit_test_options_cache_file_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * filename            /**< The name of the cache file.          */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(filename))
+         xpccut_stringcopy(options->m_Cache_File, filename);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Cache_File.
+ *
+ * \return
+ *    Returns the name of the file.  If a problem occurs, or the name is
+ *    empty, then nullptr is returned, meaning that no results are cached.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+const char *
+unit_test_options_cache_file
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Cache_File) > 0)
+         result = options->m_Cache_File;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of m_Cache_Key.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *    An empty string unsets the key.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+cbool_t
+unit_test_options_cache_key_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   const char * key                 /**< The content part of the cache keys.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if (cut_not_nullptr(key))
+         xpccut_stringcopy(options->m_Cache_Key, key);
+      else
+         result = false;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Cache_Key.
+ *
+ * \return
+ *    Returns the key.  If a problem occurs, or the key is empty, then
+ *    nullptr is returned, meaning that the key is derived from the test
+ *    application.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+const char *
+unit_test_options_cache_key
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   const char * result = nullptr;
+   if (xpccut_thisptr(options))
+   {
+      if (strlen(options->m_Cache_Key) > 0)
+         result = options->m_Cache_Key;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Use_Cache field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+cbool_t
+unit_test_options_use_cache_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Use_Cache = f;
+
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Use_Cache field.
+ *
+ * \return
+ *    Returns the value of the m_Use_Cache flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_USE_CACHE, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_43()
+ */
+
+cbool_t
+unit_test_options_use_cache
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Use_Cache : XPCCUT_USE_CACHE ;
+   return result;
+}
+
+/**
+ *    Sets the value of m_Repeat_Count.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_repeat_count_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   int v                            /**< The value to use for the setting.    */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      if ((v < 1) || (v > XPCCUT_REPEAT_MAX))
+      {
+         unit_test_options_show_error(options, _("Bad/missing repeat count"));
+         result = false;
+         options->m_Repeat_Count = XPCCUT_REPEAT_COUNT;
+      }
+      else
+      {
+         options->m_Repeat_Count = v;
+         unit_test_options_show_info_value
+         (
+            options, _("number of rounds of the tests"), v
+         );
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Repeat_Count field.
+ *
+ * \return
+ *    Returns the value of the m_Repeat_Count field if the "this" parameter
+ *    is valid and the value is sane.  Otherwise, the default value,
+ *    XPCCUT_REPEAT_COUNT, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+int
+unit_test_options_repeat_count
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_REPEAT_COUNT;
+   cbool_t ok = xpccut_thisptr(options);
+   if (ok)
+   {
+      ok = options->m_Repeat_Count >= 1;
+      if (ok)
+         ok = options->m_Repeat_Count <= XPCCUT_REPEAT_MAX;
+
+      if (ok)
+         result = options->m_Repeat_Count;
+   }
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Until_Fail field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_until_fail_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Until_Fail = f;
+
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Until_Fail field.
+ *
+ * \return
+ *    Returns the value of the m_Until_Fail flag.  If the "this" parameter
+ *    is invalid, then the default value, XPCCUT_UNTIL_FAIL, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_until_fail
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Until_Fail : XPCCUT_UNTIL_FAIL ;
+   return result;
+}
+
+/**
+ *    Sets the value of the m_Shuffle field.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_shuffle_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   cbool_t f                        /**< The value of the flag to be set.     */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+      options->m_Shuffle = f;
+
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Shuffle field.
+ *
+ * \return
+ *    Returns the value of the m_Shuffle flag.  If the "this" parameter is
+ *    invalid, then the default value, XPCCUT_SHUFFLE, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_shuffle
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   result = result ? options->m_Shuffle : XPCCUT_SHUFFLE ;
+   return result;
+}
+
+/**
+ *    Sets the value of m_Shuffle_Seed, and turns on the m_Shuffle flag.
+ *    A seed of 0 lets the runner pick one.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the setting succeeds.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+cbool_t
+unit_test_options_shuffle_seed_set
+(
+   unit_test_options_t * options,   /**< A "this" pointer for this function.  */
+   unsigned int seed                /**< The seed of the first round.         */
+)
+{
+   cbool_t result = xpccut_thisptr(options);
+   if (result)
+   {
+      options->m_Shuffle_Seed = seed;
+      options->m_Shuffle = true;
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of the m_Shuffle_Seed field.
+ *
+ * \return
+ *    Returns the seed, or 0 if it is to be picked by the runner.  If the
+ *    "this" parameter is invalid, then the default value,
+ *    XPCCUT_SHUFFLE_SEED, is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_44()
+ */
+
+unsigned int
+unit_test_options_shuffle_seed
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   unsigned int result = XPCCUT_SHUFFLE_SEED;
+   if (xpccut_thisptr(options))
+      result = options->m_Shuffle_Seed;
+
+   return result;
+}
+
+/**
+ *    Sets the value of m_Current_Test_Number.
+ *
+ *    This function is provided mainly to allow for clarity in testing the
+ *    unit_test_status_initialize() function.
+ *
+ * \note
+ *    Only in rare cases will a developer want to use this function in a
+ *    unit-test that is not testing the xpccut library.
+ *
+ * \return
+ *    Returns 'true' if the setting was able to be made.  Only zero or
+ *    positive values are allowed.
+ *
+ * \unittests
+ *    Some of the unit-tests use this function to provide more accurate
+ *    progress output.  There is no direct test of this function.
+ *    -  unit_unit_test_02_02() [indirect test]
+ *    -  unit_unit_test_02_09() [indirect test]
+ *    -  unit_unit_test_02_29() [indirect test]
+ *    -  unit_unit_test_02_30() [indirect test]
+ *    -  unit_unit_test_02_31() [indirect test]
+ */
+
+cbool_t
+unit_test_options_current_test_set
+(
+   unit_test_options_t * options,   /**< The this-pointer for the function.   */
+   int v                            /**< The value to set the test number.    */
+)
+{
+   cbool_t result = false;
+   if (xpccut_thisptr(options))
+   {
+      if (unit_test_options_show_progress(options))
+         xpccut_print("  %s\n", _("Developer is overriding test number"));
+
+      if (v >= 0)
+      {
+         options->m_Current_Test_Number = v;
+         result = true;
+      }
+      else
+         xpccut_errprint_func(_("negative tests numbers are illegal"));
+   }
+   return result;
+}
+
+/**
+ *    Provides the value of m_Current_Test_Number.
+ *    This value is a copy of unit_test_t.m_Current_Test_Number.  It
+ *    is made available to unit_test_status_initialize() via the
+ *    unit_test_options_t structure that is passed to it.
+ *
+ *    The main purpose of this accessor is to allow the code called by
+ *    unit_test_status_initialize() to avoid printing the test number for
+ *    tests that are skipped.
+ *
+ * \return
+ *    Returns the value of the m_Current_Test_Number value.  If there is a
+ *    parameter problem, -1 (XPCCUT_INVALID_PARAMETER) is returned.
+ *    The same value (but named XPCCUT_NO_CURRENT_TEST) can be returned if
+ *    the test number has not been activated/incremented yet.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_26()
+ */
+
+int
+unit_test_options_current_test
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = XPCCUT_INVALID_PARAMETER;
+   if (xpccut_thisptr(options))
+      result = options->m_Current_Test_Number;
+
+   return result;
+}
+
+/**
+ *    Sets the number of the test that the calling thread is about to run.
+ *    The test runners call this function before each test, instead of
+ *    writing the number into the shared options, which would race with
+ *    the other workers of the --jobs option.  Pass XPCCUT_NO_CURRENT_TEST
+ *    when the test is done.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_39()
+ */
+
+void
+unit_test_options_context_set
+(
+   int testnumber                   /**< The number of the test, re 0.        */
+)
+{
+   gs_Test_Context.m_Current_Test_Number = testnumber;
+}
+
+/**
+ *    Provides the number of the test that the calling thread is running,
+ *    as set by unit_test_options_context_set().
+ *
+ * \return
+ *    Returns the test number, or XPCCUT_NO_CURRENT_TEST if the thread is
+ *    not running a test for one of the test runners.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_39()
+ */
+
+int
+unit_test_options_context_test (void)
+{
+   return gs_Test_Context.m_Current_Test_Number;
+}
+
+/**
+ *    Provides the number of the test that a set of options is being used
+ *    for.  A number set in the options by
+ *    unit_test_options_current_test_set() wins; otherwise the number comes
+ *    from the test context of the calling thread.  This is the number that
+ *    unit_test_status_initialize() shows, and that the --shard-index
+ *    option uses.
+ *
+ * \return
+ *    Returns the test number, or XPCCUT_NO_CURRENT_TEST if there is none.
+ *    If \a options is null, XPCCUT_INVALID_PARAMETER is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_03_39()
+ */
+
+int
+unit_test_options_test_number
+(
+   const unit_test_options_t * options /**< A this-pointer for the function.  */
+)
+{
+   int result = unit_test_options_current_test(options);
+   if (result == XPCCUT_NO_CURRENT_TEST && cut_not_nullptr(options))
+      result = gs_Test_Context.m_Current_Test_Number;
 
    return result;
 }
@@ -2514,9 +5148,9 @@ unit_test_options_prompt_before_set
    {
       if (unit_test_options_show_progress(options))
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "  %s\n",
+            "  %s\n",
             _("Developer is automating the response-before")
          );
       }
@@ -2601,9 +5235,9 @@ unit_test_options_prompt_after_set
    {
       if (unit_test_options_show_progress(options))
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "  %s\n",
+            "  %s\n",
             _("Developer is automating the response-after")
          );
       }
@@ -20,30 +20,142 @@
  */
 
 #include <xpc/unit_test_status.h>      /* unit_test_status_t functions        */
+#include <xpc/fuzz.h>                  /* xpccut_dump_string()                */
 #include <xpc/portable_subset.h>       /* small set of portable functions     */
+#include <xpc/watchdog.h>              /* xpccut_watchdog_step()              */
 
 #if XPC_HAVE_STDIO_H
 #include <stdio.h>                     /* fprintf() and stdout                */
 #endif
 
+#if XPC_HAVE_SYS_SYSCALL_H && XPC_HAVE_UNISTD_H
+#include <sys/syscall.h>               /* SYS_gettid                          */
+#include <unistd.h>                    /* syscall()                           */
+#endif
+
+/**
+ *    Counts a failure, reserves a slot of the failure log, records the
+ *    first failed sub-test, and publishes an entry of the log, so that
+ *    checks can be made from any thread.  These are used only when a
+ *    check fails, so a check that passes costs what it always has.
+ *
+ *    Where the compiler provides no atomic operations, they are plain
+ *    operations, which are good enough for a single thread.
+ */
+
+#if defined __GNUC__ && defined __ATOMIC_ACQUIRE
+#define XPCCUT_STATUS_ADD(x) __atomic_fetch_add(&(x), 1, __ATOMIC_RELAXED)
+#define XPCCUT_STATUS_CAS(p, o, n)  __sync_bool_compare_and_swap(p, o, n)
+#define XPCCUT_STATUS_PUBLISH(x, v) __atomic_store_n(&(x), v, __ATOMIC_RELEASE)
+#define XPCCUT_STATUS_LOAD(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define XPCCUT_STATUS_SET(x, v)     __atomic_store_n(&(x), v, __ATOMIC_RELAXED)
+#elif defined __GNUC__
+#define XPCCUT_STATUS_ADD(x)        __sync_fetch_and_add(&(x), 1)
+#define XPCCUT_STATUS_CAS(p, o, n)  __sync_bool_compare_and_swap(p, o, n)
+#define XPCCUT_STATUS_PUBLISH(x, v) do { __sync_synchronize(); (x) = (v); } \
+                                       while (0)
+#define XPCCUT_STATUS_LOAD(x)       (__sync_synchronize(), (x))
+#define XPCCUT_STATUS_SET(x, v)     ((x) = (v))
+#else
+#define XPCCUT_STATUS_ADD(x)        ((x)++)
+#define XPCCUT_STATUS_CAS(p, o, n)  (*(p) == (o) ? (*(p) = (n), true) : false)
+#define XPCCUT_STATUS_PUBLISH(x, v) ((x) = (v))
+#define XPCCUT_STATUS_LOAD(x)       (x)
+#define XPCCUT_STATUS_SET(x, v)     ((x) = (v))
+#endif
+
+/**
+ *    Provides the thread number recorded in the failure log, once the
+ *    calling thread has failed a check.  It is 0 until then.
+ */
+
+static XPCCUT_THREAD_LOCAL int gs_status_thread = 0;
+
+/**
+ *    Provides the last thread number handed out where the system does not
+ *    provide thread IDs.
+ */
+
+static int gs_status_thread_count = 0;
+
+/**
+ *    Provides an all-zero resource sample, for clearing the resource fields
+ *    of a status object.
+ */
+
+static const xpccut_resources_t gs_no_resources =
+{
+   0.0, 0.0, 0, 0, 0, 0, 0
+};
+
+/**
+ *    Provides an empty reading of the hardware counters, for clearing the
+ *    counter fields of a status object.
+ */
+
+static const xpccut_perf_values_t gs_no_counters =
+{
+   false, { false, false, false, false }, { 0, 0, 0, 0 }
+};
+
+/**
+ *    Provides an empty reading of the allocation counts, for clearing the
+ *    allocation fields of a status object.
+ */
+
+static const xpccut_alloc_counts_t gs_no_allocations =
+{
+   false, 0, 0, 0, 0, 0
+};
+
 /**
- *    Provides a way to bypass the call to xpccut_get_response() in
- *    unit_test_status_prompt_before().
+ *    Provides the table of the run that the options of a status belong to,
+ *    which holds the names and the failure log of the status.
  *
- *    When debugging the --interactive option under GNU gdb, it can be
- *    difficult to get the prompt from the user.  Furthermore, it would be
- *    nice to be able to have an interactive test run automatically.
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the table, or null, meaning the shared table, if there are no
+ *    options.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
  */
 
-static char gs_status_prompt_before  = 0;
+static xpccut_intern_table_t *
+unit_test_status_table
+(
+   const unit_test_options_t * options    /**< The options, or null.          */
+)
+{
+   return cut_not_nullptr(options) ?
+      unit_test_options_names(options) : nullptr ;
+}
 
 /**
- *    Provides a way to bypass the call to xpccut_get_response() in
- *    unit_test_status_prompt_after().
- *    See gs_status_prompt_before for more details.
+ *    Interns a name of a status in the table of the run that the options
+ *    belong to, or in the shared table if there are no options.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \return
+ *    Returns the interned copy of \a text.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_06() [indirect test]
  */
 
-static char gs_status_prompt_after   = 0;
+static const char *
+unit_test_status_intern
+(
+   const unit_test_options_t * options,   /**< The options, or null.          */
+   const char * text                      /**< The name to be interned.       */
+)
+{
+   return xpccut_intern_in(unit_test_status_table(options), text);
+}
 
 /**
  *    Sets the default values of the given unit_test_status_t object.
@@ -78,9 +190,9 @@ unit_test_status_init
    if (result)
    {
       status->m_Test_Options          = nullptr;
-      status->m_Group_Name[0]         = 0;
-      status->m_Case_Description[0]   = 0;
-      status->m_Subtest_Name[0]       = 0;
+      status->m_Group_Name            = "";
+      status->m_Case_Description      = "";
+      status->m_Subtest_Name          = "";
       status->m_Test_Group            = 0;
       status->m_Test_Case             = 0;
       status->m_Subtest               = 0;
@@ -92,7 +204,24 @@ unit_test_status_init
       status->m_Start_Time_us.tv_usec = 0;
       status->m_End_Time_us.tv_sec    = 0;
       status->m_End_Time_us.tv_usec   = 0;
+      status->m_Start_Ticks           = 0;
+      status->m_End_Ticks             = 0;
+      status->m_Is_Profiled           = false;
+      status->m_Start_Resources       = gs_no_resources;
+      status->m_Resources             = gs_no_resources;
+      status->m_Is_Counted            = false;
+      status->m_Start_Counters        = gs_no_counters;
+      status->m_Counters              = gs_no_counters;
+      status->m_Start_Allocations     = gs_no_allocations;
+      status->m_Allocations           = gs_no_allocations;
+      status->m_Subtest_Allocations   = gs_no_allocations;
       status->m_Test_Duration_ms      = 0.0;
+      status->m_Subtest_Start_Ticks   = 0;
+      status->m_Subtest_Start_Errors  = 0;
+      status->m_Subtest_Running       = false;
+      status->m_Report_Count          = 0;
+      status->m_Failure_Count         = 0;
+      status->m_Failures              = nullptr;
    }
    return result;
 }
@@ -135,7 +264,8 @@ unit_test_status_init
  *    Returns 'true' if the function succeeded.  It will fail if the status
  *    pointer (also known as the "this" pointer) is null, among other
  *    things.  However, a 'false' result can also be returned if the test
- *    group and case numbers do not match the --group and --case options.
+ *    group and case numbers do not match the --group and --case options,
+ *    or the test is not in the shard selected by the --shard-index option.
  *    The caller should check the return value to see if the current test
  *    group and test case should be run.  The caller should not emit any
  *    messages based on the result.
@@ -162,12 +292,7 @@ unit_test_status_initialize
    if (result)
    {
       result = cut_not_nullptr_3(opt, groupname, casename);
-      if (result)
-      {
-         gs_status_prompt_before = unit_test_options_prompt_before(opt);
-         gs_status_prompt_after = unit_test_options_prompt_after(opt);
-      }
-      else
+      if (! result)
          xpccut_errprint_func(_("null options, or group/case names"));
    }
    else
@@ -179,89 +304,54 @@ unit_test_status_initialize
        * This section sets any unit_test_status_t fields that need to be
        * overridden from the values set in the unit_test_status_init() call.
        *
-       * Note the xpccut_stringcopy() calls, which take care to prevent any
-       * potential buffer overflows, and also allow empty strings to be
-       * copied.
+       * Note the unit_test_status_intern() calls, which keep one copy of
+       * each name, in the table of the run, for the status to point to,
+       * whatever its length, and also allow empty strings.
        *
        * Setting the disposition to XPCCUT_DISPOSITION_CONTINUE overrides
        * the initial setting of XPCCUT_DISPOSITION_ABORTED.  This value is
        * one that is checked by the unit_test_status_can_proceed() function.
        */
 
-      int optiongroup = unit_test_options_test_group(opt);
-      xpccut_stringcopy(status->m_Group_Name, groupname);
-      xpccut_stringcopy(status->m_Case_Description, casename);
+      status->m_Group_Name          = unit_test_status_intern(opt, groupname);
+      status->m_Case_Description    = unit_test_status_intern(opt, casename);
       status->m_Test_Group          = testgroup;
       status->m_Test_Case           = testcase;
       status->m_Test_Disposition    = XPCCUT_DISPOSITION_CONTINUE;
       status->m_Test_Options        = opt;
-      if (optiongroup != 0)
-      {
-         /*
-          * A non-zero integer --group option was specified.  Only this
-          * unit-test group will be allowed to run.
-          */
-
-         result = testgroup == optiongroup;
-      }
-      else
-      {
-         /*
-          * If a valid group-name was specified by the --group option, then
-          * only a matching unit-test group will be allowed to run.
-          */
-
-         const char * named_group = unit_test_options_named_group
-         (
-            status->m_Test_Options
-         );
-         if (cut_not_nullptr(named_group))
-            result = strcmp(named_group, groupname) == 0;
-      }
-      if (result)                   /* this unit-test group is allowed to run */
-      {
-         /*
-          * Now it is time to see if the current case in the group is
-          * allowed to run.  As with the --group option, the --case option
-          * is checked for valid integer or string values.
-          */
-
-         int optioncase = unit_test_options_test_case(status->m_Test_Options);
-         if (optioncase != 0)
-            result = testcase == optioncase;
-         else
-         {
-            const char * named_case = unit_test_options_named_case
-            (
-               status->m_Test_Options
-            );
-            if (cut_not_nullptr(named_case))
-               result = strcmp(named_case, casename) == 0;
-         }
-      }
+      result = unit_test_options_is_selected
+      (
+         opt, testgroup, testcase, groupname, casename
+      );
       if (result)                                           /* test can run   */
       {
          if (unit_test_options_show_progress(status->m_Test_Options))
          {
             const char * tag = _("TEST");
             int testnum =
-               unit_test_options_current_test(status->m_Test_Options) + 1;
+               unit_test_options_test_number(status->m_Test_Options) + 1;
 
             if (unit_test_options_is_simulated(status->m_Test_Options))
                tag = _("Simulated TEST");
 
-            fprintf(stdout, "\n%s %3d:  \n", tag, testnum);
+            xpccut_print("\n%s %3d:  \n", tag, testnum);
          }
          if (unit_test_options_is_summary(status->m_Test_Options))
          {
-            fprintf
-            (
-               stdout, "  %s %d '%s', %s %d '%s'\n",
-               _("Group"), testgroup, groupname, _("Case"), testcase, casename
-            );
+            if (! xpccut_is_silent())
+            {
+               xpccut_print
+               (
+                  "  %s %d '%s', %s %d '%s'\n", _("Group"),
+                  testgroup, groupname, _("Case"), testcase, casename
+               );
+            }
          }
          else
             (void) unit_test_status_show_title(status);     /* show test info */
+
+         status->m_Is_Profiled = unit_test_options_is_profiled(opt);
+         status->m_Is_Counted = unit_test_options_perf_counters(opt);
       }
       else
       {
@@ -269,15 +359,24 @@ unit_test_status_initialize
          status->m_Test_Result = true;
          if (unit_test_options_is_verbose(status->m_Test_Options))
          {
-            fprintf
+            xpccut_print
             (
-               stdout, "  %s %d '%s', %s %d '%s' %s\n",
+               "  %s %d '%s', %s %d '%s' %s\n",
                _("Group"), testgroup, groupname,
                _("Case"), testcase, casename, _("skipped")
             );
          }
       }
       xpccut_get_microseconds(&status->m_Start_Time_us);   /* always log time */
+      if (status->m_Is_Profiled)
+         (void) xpccut_get_resources(&status->m_Start_Resources);
+
+      if (status->m_Is_Counted)
+         (void) xpccut_perf_read(&status->m_Start_Counters);
+
+      (void) xpccut_alloc_read(&status->m_Start_Allocations);
+      status->m_Subtest_Allocations = status->m_Start_Allocations;
+      status->m_Start_Ticks = xpccut_get_ticks();
    }
    return result;
 }
@@ -310,6 +409,105 @@ unit_test_status_reset
    return result;
 }
 
+/**
+ *    Provides the number of the calling thread for the failure log.  It is
+ *    the thread ID of the system, where there is one, so that it matches
+ *    what a debugger shows; otherwise the threads are numbered from 1, in
+ *    the order of their first failures.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_pass().
+ *
+ * \return
+ *    Returns the number of the thread.
+ */
+
+static int
+unit_test_status_thread (void)
+{
+   if (gs_status_thread == 0)
+   {
+#if XPC_HAVE_SYS_SYSCALL_H && XPC_HAVE_UNISTD_H && defined SYS_gettid
+      gs_status_thread = (int) syscall(SYS_gettid);
+#endif
+      if (gs_status_thread <= 0)
+         gs_status_thread = XPCCUT_STATUS_ADD(gs_status_thread_count) + 1;
+   }
+   return gs_status_thread;
+}
+
+/**
+ *    Provides the failure log of a status, making it on the first failure.
+ *    If two threads fail their first checks at once, both make a log, but
+ *    only the one installed first is used; the other is left in the table,
+ *    which costs a few bytes, once per test at most.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_pass().
+ *
+ * \return
+ *    Returns the log, or null if the memory for it could not be had.
+ */
+
+static unit_test_failure_t *
+unit_test_status_failure_log
+(
+   unit_test_status_t * status   /**< The "this" pointer for this function.   */
+)
+{
+   unit_test_failure_t * result = XPCCUT_STATUS_LOAD(status->m_Failures);
+   if (cut_is_nullptr(result))
+   {
+      unit_test_failure_t * fresh = xpccut_intern_table_alloc
+      (
+         unit_test_status_table(status->m_Test_Options),
+         XPCCUT_FAILURE_LOG_SIZE * sizeof *fresh
+      );
+      if (cut_not_nullptr(fresh))
+      {
+         if (XPCCUT_STATUS_CAS(&status->m_Failures, nullptr, fresh))
+            result = fresh;
+         else
+            result = XPCCUT_STATUS_LOAD(status->m_Failures);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Enters a failure in the failure log of a status.  The slot is
+ *    reserved by an atomic increment of m_Failure_Count, so each thread
+ *    fills in an entry of its own, and marks it as set last.  Once the log
+ *    is full, the failures are only counted.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_pass().
+ */
+
+static void
+unit_test_status_log_failure
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   int thread,                   /**< The thread that failed the check.       */
+   int subtest,                  /**< The sub-test that failed.               */
+   const char * subtestname      /**< Its name, already interned.             */
+)
+{
+   int slot = XPCCUT_STATUS_ADD(status->m_Failure_Count);
+   if (slot >= 0 && slot < XPCCUT_FAILURE_LOG_SIZE)
+   {
+      unit_test_failure_t * log = unit_test_status_failure_log(status);
+      if (cut_not_nullptr(log))
+      {
+         unit_test_failure_t * entry = &log[slot];
+         entry->m_Thread = thread;
+         entry->m_Subtest = subtest;
+         entry->m_Subtest_Name = subtestname;
+         XPCCUT_STATUS_PUBLISH(entry->m_Is_Set, true);
+      }
+   }
+}
+
 /**
  *    This function sets the pass/fail flag for this status object.  It also
  *    increments the error count.
@@ -321,7 +519,14 @@ unit_test_status_reset
  *    false.
  *
  *    If the sub-test was the first to fail, it's index is logged so that
- *    the user can find the first error more easily.
+ *    the user can find the first error more easily.  The failure is also
+ *    entered in the failure log of the status; see
+ *    unit_test_status_failure().
+ *
+ *    A failure is recorded with atomic operations, so this function, and
+ *    the check functions that call it, can be called from any thread of a
+ *    test, such as the threads of xpc::cut_concurrent.  A check that passes
+ *    takes no lock and makes no atomic read-modify-write.
  *
  * \return
  *    Returns 'true' if the function succeeded.  It will fail if the status
@@ -329,6 +534,7 @@ unit_test_status_reset
  *
  * \unittests
  *    -  unit_unit_test_02_04()
+ *    -  unit_unit_test_02_38()
  */
 
 cbool_t
@@ -341,12 +547,18 @@ unit_test_status_pass
    cbool_t result = xpccut_thisptr(status);
    if (result)
    {
-      status->m_Test_Result = flag;
+      XPCCUT_STATUS_SET(status->m_Test_Result, flag);
       if (! flag)
       {
-         status->m_Subtest_Error_Count++;          /* count the error         */
+         int subtest = status->m_Subtest;
+         (void) XPCCUT_STATUS_ADD(status->m_Subtest_Error_Count);
          if (status->m_Failed_Subtest == 0)        /* only log the first one  */
-            status->m_Failed_Subtest = status->m_Subtest;
+            (void) XPCCUT_STATUS_CAS(&status->m_Failed_Subtest, 0, subtest);
+
+         unit_test_status_log_failure
+         (
+            status, unit_test_status_thread(), subtest, status->m_Subtest_Name
+         );
 
          if (unit_test_options_show_progress(status->m_Test_Options))
          {
@@ -364,9 +576,9 @@ unit_test_status_pass
                if (unit_test_options_is_simulated(status->m_Test_Options))
                   tag = _("FAILURE in simulated sub-test");
 
-               fprintf
+               xpccut_print
                (
-                  stdout, "  %s %d ['%s']\n",
+                  "  %s %d ['%s']\n",
                   tag, status->m_Subtest, status->m_Subtest_Name
                );
             }
@@ -396,6 +608,102 @@ unit_test_status_fail
    return unit_test_status_pass(status, false);
 }
 
+/**
+ *    Provides the number of failed checks of the test, from all threads.
+ *    Unlike the error count, it is not changed by the self-test functions.
+ *
+ * \return
+ *    Returns the m_Failure_Count field, or 0 if the \a status pointer is
+ *    null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_38()
+ */
+
+int
+unit_test_status_failure_count
+(
+   const unit_test_status_t * status   /**< The "this" pointer.               */
+)
+{
+   int result = 0;
+   if (xpccut_thisptr(status))
+      result = XPCCUT_STATUS_LOAD(status->m_Failure_Count);
+
+   return result;
+}
+
+/**
+ *    Provides an entry of the failure log of the test.  The log holds the
+ *    first XPCCUT_FAILURE_LOG_SIZE failures, in the order in which their
+ *    slots were reserved.
+ *
+ * \return
+ *    Returns a pointer to the entry, or a null pointer if \a index is out
+ *    of range, or the entry is still being filled in by its thread.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_38()
+ */
+
+const unit_test_failure_t *
+unit_test_status_failure
+(
+   const unit_test_status_t * status,  /**< The "this" pointer.               */
+   int index                           /**< The entry, from 0.                */
+)
+{
+   const unit_test_failure_t * result = nullptr;
+   if (xpccut_thisptr(status))
+   {
+      const unit_test_failure_t * log = XPCCUT_STATUS_LOAD(status->m_Failures);
+      if (cut_not_nullptr(log) && index >= 0 && index < XPCCUT_FAILURE_LOG_SIZE)
+      {
+         if (XPCCUT_STATUS_LOAD(log[index].m_Is_Set))
+            result = &log[index];
+      }
+   }
+   return result;
+}
+
+/**
+ *    Enters a failure that was logged somewhere else in the failure log of
+ *    a status.  unit_test_run_jobs() uses it to bring back the log that
+ *    an --isolate child sends, whose names are interned again in the table
+ *    of the status.  The failure is counted, but the error count and the
+ *    result of the status are left alone, since they come along with the
+ *    rest of the status.
+ *
+ * \return
+ *    Returns 'true' if the function succeeded.  It will fail if the status
+ *    pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_38()
+ *    -  unit_unit_test_04_25()
+ */
+
+cbool_t
+unit_test_status_failure_add
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   int thread,                   /**< The thread that failed the check.       */
+   int subtest,                  /**< The sub-test that failed.               */
+   const char * subtestname      /**< The name of that sub-test.              */
+)
+{
+   cbool_t result = xpccut_thisptr(status);
+   if (result)
+   {
+      unit_test_status_log_failure
+      (
+         status, thread, subtest,
+         unit_test_status_intern(status->m_Test_Options, subtestname)
+      );
+   }
+   return result;
+}
+
 /**
  *    This function unsets the pass/fail flag for this status object.
  *    It is a shortcut for "unit_test_status_pass(false)", except that it
@@ -430,7 +738,7 @@ unit_test_status_fail_deliberately
           */
 
          if (! xpccut_is_silent())
-            fprintf(stdout, "! %s.\n", _("This FAILURE is deliberate"));
+            xpccut_print("! %s.\n", _("This FAILURE is deliberate"));
       }
    }
    return result;
@@ -438,9 +746,9 @@ unit_test_status_fail_deliberately
 
 /**
  *    Loads the current system time.
- *    The current system time is loaded into status->m_Start_Time_us.  The
- *    status->m_End_Time_us value is set to 0.0 so that forgetting to set the
- *    end time is easier to detect.
+ *    The current system time is loaded into status->m_Start_Time_us, and
+ *    the monotonic time into status->m_Start_Ticks.  The end times are set
+ *    to 0 so that forgetting to set the end time is easier to detect.
  *
  * \note
  *    This is more of value to the caller who wants supplemental time
@@ -465,19 +773,101 @@ unit_test_status_start_timer
    {
       status->m_End_Time_us.tv_sec = 0;                    /* nullify end time  */
       status->m_End_Time_us.tv_usec = 0;
+      status->m_End_Ticks = 0;
       xpccut_get_microseconds(&status->m_Start_Time_us);   /* set start time    */
+      if (status->m_Is_Profiled)
+         (void) xpccut_get_resources(&status->m_Start_Resources);
+
+      if (status->m_Is_Counted)
+         (void) xpccut_perf_read(&status->m_Start_Counters);
+
+      (void) xpccut_alloc_read(&status->m_Start_Allocations);
+      status->m_Subtest_Allocations = status->m_Start_Allocations;
+      status->m_Start_Ticks = xpccut_get_ticks();
    }
    return result;
 }
 
+/**
+ *    Provides the report format selected by the options of a status.
+ *    Unlike unit_test_options_report_format(), it quietly allows a status
+ *    that has no options.
+ *
+ * \return
+ *    Returns the report format, or XPCCUT_REPORT_NONE if there are no
+ *    options.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static unit_test_report_format_t
+unit_test_status_report_format
+(
+   const unit_test_status_t * status   /**< The status, assumed valid.        */
+)
+{
+   unit_test_report_format_t result = XPCCUT_REPORT_NONE;
+   if (cut_not_nullptr(status->m_Test_Options))
+      result = unit_test_options_report_format(status->m_Test_Options);
+
+   return result;
+}
+
+/**
+ *    Writes the record of the running sub-test to the report, if there is
+ *    one.  The sub-test failed if the error count went up while it ran.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_07_05() [indirect test]
+ */
+
+static void
+unit_test_status_close_subtest
+(
+   unit_test_status_t * status   /**< The status, assumed valid.              */
+)
+{
+   if (status->m_Subtest_Running)
+   {
+      xpccut_report_record_t record;
+      int errors =
+         status->m_Subtest_Error_Count - status->m_Subtest_Start_Errors;
+
+      record.m_Group = status->m_Test_Group;
+      record.m_Group_Name = status->m_Group_Name;
+      record.m_Case = status->m_Test_Case;
+      record.m_Case_Name = status->m_Case_Description;
+      record.m_Subtest = status->m_Subtest;
+      record.m_Subtest_Name = status->m_Subtest_Name;
+      record.m_Disposition = errors > 0 ? "failed" : "passed" ;
+      record.m_Duration_ms = xpccut_ticks_difference_ms
+      (
+         status->m_Subtest_Start_Ticks, xpccut_get_ticks()
+      );
+      record.m_Error_Count = errors;
+      xpccut_report_record(unit_test_status_report_format(status), &record);
+      status->m_Report_Count++;
+      status->m_Subtest_Running = false;
+   }
+}
+
 /**
  *    This function assumes that the start-time member has been set.  It
  *    first loads the end-time member, and then calculates the time
- *    difference in milliseconds.
+ *    difference in milliseconds from the monotonic tick values, so the
+ *    result keeps the fraction of a millisecond, and is never negative.
  *
  *    If the reset parameter is true, then the start-time is modified to the
  *    current time, so that the next call to unit_test_status_time_delta()
- *    can yield a reasonable value.
+ *    can yield a reasonable value.  Otherwise, the test is taken to be
+ *    over, and the record of its last sub-test is written to the report.
  *
  * \sideeffect
  *    status->m_Test_Duration_ms is set to the result.
@@ -500,34 +890,67 @@ unit_test_status_time_delta
    double result = -1.0;
    if (xpccut_thisptr(status))
    {
-      if
-      (
-         status->m_Start_Time_us.tv_sec == 0 &&
-         status->m_Start_Time_us.tv_usec == 0
-      )
+      if (status->m_Start_Ticks == 0)
       {
          xpccut_errprint("logged unit-test start time was 0");
       }
       else
       {
+         xpccut_resources_t now;
+         xpccut_perf_values_t counters;
+         xpccut_alloc_counts_t allocations;
+         if (xpccut_alloc_read(&allocations))
+         {
+            (void) xpccut_alloc_difference
+            (
+               &status->m_Start_Allocations, &allocations,
+               &status->m_Allocations
+            );
+         }
+         if (status->m_Is_Counted)
+         {
+            if (xpccut_perf_read(&counters))
+            {
+               (void) xpccut_perf_difference
+               (
+                  &status->m_Start_Counters, &counters, &status->m_Counters
+               );
+            }
+         }
+         status->m_End_Ticks = xpccut_get_ticks();
          xpccut_get_microseconds(&status->m_End_Time_us);
-         result = xpccut_time_difference_us
+         result = xpccut_ticks_difference_ms
          (
-            status->m_Start_Time_us, status->m_End_Time_us
+            status->m_Start_Ticks, status->m_End_Ticks
          );
-         if (result >= 0.0)
+         status->m_Test_Duration_ms = result;
+         if (status->m_Is_Profiled)
          {
-            result *= 0.001;                                /* convert to ms  */
-            status->m_Test_Duration_ms = result;
+            if (xpccut_get_resources(&now))
+            {
+               (void) xpccut_resources_difference
+               (
+                  &status->m_Start_Resources, &now, &status->m_Resources
+               );
+            }
          }
-         else
-            xpccut_errprint_func(_("time-difference < 0.0, left unassigned"));
-
          if (startreset)                                    /* set new time   */
          {
-            xpccut_get_microseconds(&status->m_Start_Time_us);
+            status->m_Start_Ticks = status->m_End_Ticks;
+            status->m_Start_Time_us = status->m_End_Time_us;
+            if (status->m_Is_Profiled)
+               status->m_Start_Resources = now;
+
+            if (status->m_Is_Counted)
+               status->m_Start_Counters = counters;
+
+            if (allocations.m_Is_Valid)
+               status->m_Start_Allocations = allocations;
+
             xpccut_infoprint("unit-test start time reset!");
          }
+         else
+            unit_test_status_close_subtest(status);
       }
    }
    return result;
@@ -561,9 +984,9 @@ unit_test_status_show_title
          const char * casename = cut_not_nullptr(status->m_Case_Description) ?
                status->m_Case_Description : _("none given") ;
 
-         fprintf
+         xpccut_print
          (
-            stdout, "\n  %s(%d, %d) [%s (%s)]\n",
+            "\n  %s(%d, %d) [%s (%s)]\n",
             _("Unit test"),
             status->m_Test_Group, status->m_Test_Case, groupname, casename
          );
@@ -661,6 +1084,12 @@ unit_test_status_ignore
  *    match, or if the single-sub-test number is zero, then the test can be
  *    run, and 'true' is returned.
  *
+ *    If a --report-format is selected, the record of the previous sub-test
+ *    is written to the report, and the timing of this one is started.
+ *    If the test is being watched for the --test-timeout option, the
+ *    sub-test is added to the sequence trace of its watch.  The allocation
+ *    counts of the sub-test start from the end of this call.
+ *
  *    If the --summarize option is on, this function lists the subtest
  *    features to standard output, and returns 'false'.  The caller has to
  *    cooperate by calling this function (and only this function), and
@@ -691,9 +1120,9 @@ unit_test_status_next_subtest
          tag = _("unnamed");
          if (unit_test_options_show_progress(status->m_Test_Options))
          {
-            fprintf
+            xpccut_print
             (
-               stdout, "! %s: unit_test_status_next_subtest()\n\n",
+               "! %s: unit_test_status_next_subtest()\n\n",
                _("empty tag")
             );
          }
@@ -701,12 +1130,13 @@ unit_test_status_next_subtest
       if (unit_test_options_is_summary(status->m_Test_Options))
       {
          status->m_Subtest++;
-         xpccut_stringcopy(status->m_Subtest_Name, tag);
+         status->m_Subtest_Name =
+            unit_test_status_intern(status->m_Test_Options, tag);
          if (! xpccut_is_silent())
          {
-            fprintf
+            xpccut_print
             (
-               stdout, "  %s %d: '%s'\n", _("Sub-test"), status->m_Subtest, tag
+               "  %s %d: '%s'\n", _("Sub-test"), status->m_Subtest, tag
             );
          }
          result = false;
@@ -748,30 +1178,122 @@ unit_test_status_next_subtest
             if (cut_not_nullptr(named_subtest))
                result = strcmp(named_subtest, tag) == 0;
          }
+         unit_test_status_close_subtest(status);
          status->m_Subtest++;
-         xpccut_stringcopy(status->m_Subtest_Name, tag);
+         status->m_Subtest_Name =
+            unit_test_status_intern(status->m_Test_Options, tag);
          if (result)
          {
+            xpccut_watchdog_step(status->m_Subtest, status->m_Subtest_Name);
+            if (unit_test_status_report_format(status) != XPCCUT_REPORT_NONE)
+            {
+               status->m_Subtest_Start_Ticks = xpccut_get_ticks();
+               status->m_Subtest_Start_Errors = status->m_Subtest_Error_Count;
+               status->m_Subtest_Running = true;
+            }
             if (unit_test_options_show_step_numbers(status->m_Test_Options))
             {
                if (status->m_Subtest == 1)
-                  fprintf(stdout, "\n");
+                  xpccut_print("\n");
 
-               fprintf
+               xpccut_print
                (
-                  stdout, "  %s %d: %s\n",
+                  "  %s %d: %s\n",
                   _("Sub-test"), status->m_Subtest, status->m_Subtest_Name
                );
             }
          }
          else if (unit_test_options_is_verbose(status->m_Test_Options))
          {
-            fprintf
+            xpccut_print
             (
-               stdout, "  %s %d (%s) %s\n",
+               "  %s %d (%s) %s\n",
                _("Sub-test"), status->m_Subtest, tag, _("skipped")
             );
          }
+         (void) xpccut_alloc_read(&status->m_Subtest_Allocations);
+      }
+   }
+   return result;
+}
+
+/**
+ *    Moves to the next record of a table, as the next sub-test.  This is
+ *    how a data-driven test walks its table, each record being a sub-test
+ *    of its own, named for the table:
+ *
+\verbatim
+      xpccut_record_t record = XPCCUT_RECORD_INIT;
+      while (unit_test_status_next_record(&status, &table, &record))
+      {
+         xpccut_record_t field;
+         long value;
+         ok = xpccut_record_field(&record, 0, &field);
+         if (ok)
+            ok = xpccut_record_long(&field, &value);
+
+         unit_test_status_pass(&status, ok && is_valid(value));
+      }
+\endverbatim
+ *
+ *    Each record goes through unit_test_status_next_subtest(), so the
+ *    --sub-test option selects one record, and the --named-subtest option,
+ *    given the name of the table, selects all of them.  The records that
+ *    are not selected are passed over here, so the test sees only the
+ *    records it has to check.  For a test given to unit_test_load_spread(),
+ *    the records that belong to the other shards are passed over as well,
+ *    still counting as sub-tests, so that a sub-test number means the same
+ *    record in every shard.  Under the --summarize option, each record is
+ *    listed, and none is returned.
+ *
+ * \return
+ *    Returns 'true' if a record to be checked was found, and 'false' at the
+ *    end of the table, or if the parameters are invalid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_40()
+ *    -  unit_unit_test_04_34()
+ */
+
+cbool_t
+unit_test_status_next_record
+(
+   unit_test_status_t * status,     /**< The "this" pointer for the function. */
+   const xpccut_table_t * table,    /**< The table being walked.              */
+   xpccut_record_t * record         /**< The previous record; gets the next.  */
+)
+{
+   cbool_t result = xpccut_thisptr(status);
+   if (result)
+      result = cut_not_nullptr_2(table, record);
+
+   if (result)
+   {
+      const char * tag = xpccut_table_name(table);
+      cbool_t found = false;
+      while (result && ! found)
+      {
+         result = xpccut_table_next(table, record);
+         if (result)
+         {
+            if
+            (
+               unit_test_options_record_in_shard
+               (
+                  status->m_Test_Options, record->m_Number
+               )
+            )
+            {
+               found = unit_test_status_next_subtest(status, tag);
+            }
+            else
+            {
+               unit_test_status_close_subtest(status);
+               status->m_Subtest++;
+               status->m_Subtest_Name =
+                  unit_test_status_intern(status->m_Test_Options, tag);
+            }
+         }
       }
    }
    return result;
@@ -796,7 +1318,8 @@ unit_test_status_beep (void)
 #ifdef WIN32
       MessageBeep((UINT) -1);                /* play the current beep sound   */
 #else
-      fprintf(stdout, "\a");                 /* play the console alert (BEL)  */
+      xpccut_print("\a");                    /* play the console alert (BEL)  */
+      xpccut_output_flush();                 /* ... right now                 */
 #endif
 }
 
@@ -852,6 +1375,13 @@ unit_test_status_is_verbose
  *       this status object can be analyzed later by the dispose() function.
  *       This side-effect is very important.  See the unit_test_t::run()
  *       function for the usage of this side-effect.
+ *    -# The --response-before option bypasses the call to
+ *       xpccut_get_response(), since, when debugging the --interactive
+ *       option under GNU gdb, it can be difficult to get the prompt from
+ *       the user, and it is nice to be able to have an interactive test run
+ *       automatically.  The value is read from the options of the status,
+ *       not kept in a static, since the --jobs workers each initialize
+ *       statuses of their own.
  *
  * \return
  *    If the parameters are valid, the disposition selected by the user is
@@ -888,22 +1418,22 @@ unit_test_status_prompt_before
          if (! unit_test_options_batch_mode(status->m_Test_Options))
          {
             if (cut_is_nullptr(message) || strlen(message) == 0)
-               fprintf(stdout, "\n%s ", prompt_string);
+               xpccut_print("\n%s ", prompt_string);
             else
-               fprintf(stdout, "\n%s:\n%s ", message, prompt_string);
+               xpccut_print("\n%s:\n%s ", message, prompt_string);
          }
-         if (gs_status_prompt_before == 0)
+         r = unit_test_options_prompt_before(status->m_Test_Options);
+         if (r == 0)                      /* no --response-before value      */
          {
             r = xpccut_get_response();
          }
          else
          {
-            r = gs_status_prompt_before;  /* use --response-before value      */
             if (! unit_test_options_batch_mode(status->m_Test_Options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "\n(%s %c)\n", _("Responding automatically with"), r
+                  "\n(%s %c)\n", _("Responding automatically with"), r
                );
             }
          }
@@ -913,36 +1443,35 @@ unit_test_status_prompt_before
 
                result = XPCCUT_DISPOSITION_CONTINUE;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Continuing"));
+                  xpccut_print("%s...\n", _("Continuing"));
                break;
 
             case 's': case 'S':
 
                result = XPCCUT_DISPOSITION_DNT;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Skipping"));
+                  xpccut_print("%s...\n", _("Skipping"));
                break;
 
             case 'q': case 'Q':
 
                result = XPCCUT_DISPOSITION_QUITTED;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Quitting"));
+                  xpccut_print("%s...\n", _("Quitting"));
                break;
 
             case 'a': case 'A':
 
                result = XPCCUT_DISPOSITION_ABORTED;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Aborting"));
+                  xpccut_print("%s...\n", _("Aborting"));
                break;
 
             case 'h': case 'H': case '?':
 
 
-               fprintf
+               xpccut_print
                (
-                  stdout,
                   "\n%s\n%s\n%s\n%s\n",
                /* TRANSLATORS: line up the 2nd column of the next 4 strings. */
    _("Continue:  Go ahead and perform the upcoming test."),
@@ -958,7 +1487,7 @@ unit_test_status_prompt_before
                /*
                 * This case should just be ignored.
                 *
-                * fprintf(stdout, "=== CHAR 0x%x ===\n", (int) r);
+                * xpccut_print("=== CHAR 0x%x ===\n", (int) r);
                 */
 
                no_response = true;
@@ -983,6 +1512,9 @@ unit_test_status_prompt_before
  *    -  (a)bort        Stop the unit-test application, indicating failure.
  *    -  (q)uit         Stop the unit-test application, indicating success.
  *
+ *    The --response-after option bypasses the prompt, as --response-before
+ *    does for unit_test_status_prompt_before().
+ *
  * \return
  *    If the parameters are valid, the disposition selected by the user is
  *    returned.  Otherwise, the value XPCCUT_DISPOSITION_ABORTED is
@@ -1019,22 +1551,22 @@ unit_test_status_prompt_after
          if (! unit_test_options_batch_mode(status->m_Test_Options))
          {
             if (cut_is_nullptr(message) || strlen(message) == 0)
-               fprintf(stdout, "\n%s ", prompt_string);
+               xpccut_print("\n%s ", prompt_string);
             else
-               fprintf(stdout, "\n%s:\n%s ", message, prompt_string);
+               xpccut_print("\n%s:\n%s ", message, prompt_string);
          }
-         if (gs_status_prompt_after == 0)
+         r = unit_test_options_prompt_after(status->m_Test_Options);
+         if (r == 0)                      /* no --response-after value       */
          {
             r = xpccut_get_response();
          }
          else
          {
-            r = gs_status_prompt_after;   /* use --response-after value       */
             if (! unit_test_options_batch_mode(status->m_Test_Options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "\n(%s %c)\n", _("Responding automatically with"), r
+                  "\n(%s %c)\n", _("Responding automatically with"), r
                );
             }
          }
@@ -1044,35 +1576,34 @@ unit_test_status_prompt_after
 
                result = XPCCUT_DISPOSITION_CONTINUE;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s.\n", _("Passed"));
+                  xpccut_print("%s.\n", _("Passed"));
                break;
 
             case 'f': case 'F':
 
                result = XPCCUT_DISPOSITION_FAILED;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s.\n", _("Failed"));
+                  xpccut_print("%s.\n", _("Failed"));
                break;
 
             case 'q': case 'Q':
 
                result = XPCCUT_DISPOSITION_QUITTED;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Quitting"));
+                  xpccut_print("%s...\n", _("Quitting"));
                break;
 
             case 'a': case 'A':
 
                result = XPCCUT_DISPOSITION_ABORTED;
                if (unit_test_status_is_verbose(status))
-                  fprintf(stdout, "%s...\n", _("Aborting"));
+                  xpccut_print("%s...\n", _("Aborting"));
                break;
 
             case 'h': case 'H': case '?':
 
-               fprintf
+               xpccut_print
                (
-                  stdout,
                   "\n%s\n%s\n%s\n%s\n",
                /* TRANSLATORS: line up the 2nd column of the next 4 strings. */
    _("Pass:      Indicate that the test has passed."),
@@ -1088,7 +1619,7 @@ unit_test_status_prompt_after
                /*
                 * This case should never happen.
                 *
-                * fprintf(stdout, "=== CHAR 0x%x ===\n", (int) r);
+                * xpccut_print("=== CHAR 0x%x ===\n", (int) r);
                 */
 
                no_response = true;
@@ -1251,7 +1782,8 @@ unit_test_status_response
  *
  * \return
  *    Returns the status->m_Group_Name field if the \a status pointer
- *    is valid.  Otherwise, a null pointer value (nullptr) is returned.
+ *    is valid, or an empty string if the field was never set.  Otherwise,
+ *    a null pointer value (nullptr) is returned.
  *
  * \unittests
  *    -  unit_unit_test_02_11()
@@ -1265,7 +1797,11 @@ unit_test_status_group_name
 {
    const char * result = nullptr;
    if (xpccut_thisptr(status))
+   {
       result = status->m_Group_Name;
+      if (cut_is_nullptr(result))            /* a zeroed status has no name */
+         result = "";
+   }
 
    return result;
 }
@@ -1280,7 +1816,8 @@ unit_test_status_group_name
  *
  * \return
  *    Returns the status->m_Case_Description field if the \a status pointer
- *    is valid.  Otherwise, a null pointer value (nullptr) is returned.
+ *    is valid, or an empty string if the field was never set.  Otherwise,
+ *    a null pointer value (nullptr) is returned.
  *
  * \unittests
  *    -  unit_unit_test_02_12()
@@ -1294,7 +1831,11 @@ unit_test_status_case_name
 {
    const char * result = nullptr;
    if (xpccut_thisptr(status))
+   {
       result = status->m_Case_Description;
+      if (cut_is_nullptr(result))            /* a zeroed status has no name */
+         result = "";
+   }
 
    return result;
 }
@@ -1309,7 +1850,8 @@ unit_test_status_case_name
  *
  * \return
  *    Returns the status->m_Subtest_Name field if the \a status pointer
- *    is valid.  Otherwise, a null pointer value (nullptr) is returned.
+ *    is valid, or an empty string if the field was never set.  Otherwise,
+ *    a null pointer value (nullptr) is returned.
  *
  * \unittests
  *    -  unit_unit_test_02_13()
@@ -1323,7 +1865,11 @@ unit_test_status_subtest_name
 {
    const char * result = nullptr;
    if (xpccut_thisptr(status))
+   {
       result = status->m_Subtest_Name;
+      if (cut_is_nullptr(result))            /* a zeroed status has no name */
+         result = "";
+   }
 
    return result;
 }
@@ -1776,6 +2322,129 @@ unit_test_status_is_okay
    return result;
 }
 
+/**
+ *    Returns the resources used by the test, as measured by the last call
+ *    to unit_test_status_time_delta().
+ *
+ * \return
+ *    Returns a pointer to the m_Resources field if the "this" parameter is
+ *    valid and the --profile option was in force when the test was set
+ *    up.  Otherwise, null is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_35()
+ */
+
+const xpccut_resources_t *
+unit_test_status_resources
+(
+   const unit_test_status_t * status   /**< "this" pointer for this function. */
+)
+{
+   const xpccut_resources_t * result = nullptr;
+   if (xpccut_thisptr(status))
+   {
+      if (status->m_Is_Profiled)
+         result = &status->m_Resources;
+   }
+   return result;
+}
+
+/**
+ *    Returns the hardware counts of the test, as read by the last call to
+ *    unit_test_status_time_delta().
+ *
+ * \return
+ *    Returns a pointer to the m_Counters field if the "this" parameter is
+ *    valid, the --perf-counters option was in force when the test was set
+ *    up, and the counters could be read.  Otherwise, null is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_36()
+ */
+
+const xpccut_perf_values_t *
+unit_test_status_counters
+(
+   const unit_test_status_t * status   /**< "this" pointer for this function. */
+)
+{
+   const xpccut_perf_values_t * result = nullptr;
+   if (xpccut_thisptr(status))
+   {
+      if (status->m_Is_Counted && status->m_Counters.m_Is_Valid)
+         result = &status->m_Counters;
+   }
+   return result;
+}
+
+/**
+ *    Returns the allocation counts of the test, as read by the last call to
+ *    unit_test_status_time_delta().
+ *
+ * \return
+ *    Returns a pointer to the m_Allocations field if the "this" parameter
+ *    is valid and the libxpccut_alloc library is linked in.  Otherwise,
+ *    null is returned.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+const xpccut_alloc_counts_t *
+unit_test_status_allocations
+(
+   const unit_test_status_t * status   /**< "this" pointer for this function. */
+)
+{
+   const xpccut_alloc_counts_t * result = nullptr;
+   if (xpccut_thisptr(status))
+   {
+      if (status->m_Allocations.m_Is_Valid)
+         result = &status->m_Allocations;
+   }
+   return result;
+}
+
+/**
+ *    Provides the allocation counts of the current sub-test so far, that
+ *    is, from its unit_test_status_next_subtest() call, or from the last
+ *    unit_test_status_no_alloc_check(), to now.  The counts are those of
+ *    the calling thread, which must be the thread running the test.
+ *
+ * \return
+ *    Returns 'true' if the parameters are valid and the allocations are
+ *    being counted.  Otherwise, \a counts is marked as not valid.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+cbool_t
+unit_test_status_subtest_allocations
+(
+   const unit_test_status_t * status,  /**< "this" pointer for this function. */
+   xpccut_alloc_counts_t * counts      /**< Receives the counts.              */
+)
+{
+   cbool_t result = xpccut_thisptr(status) && cut_not_nullptr(counts);
+   if (result)
+   {
+      xpccut_alloc_counts_t now;
+      result = xpccut_alloc_read(&now);
+      if (result)
+      {
+         result = xpccut_alloc_difference
+         (
+            &status->m_Subtest_Allocations, &now, counts
+         );
+      }
+      else
+         *counts = now;
+   }
+   return result;
+}
+
 /**
  *    Returns the value of the m_Test_Duration_ms field.
  *
@@ -1839,9 +2508,9 @@ unit_test_status_int_check
    {
       if (! xpccut_is_silent())
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "? %d %s, %d %s\n",
+            "? %d %s, %d %s\n",
             expected_value, _("expected"), actual_value, _("actual")
          );
       }
@@ -1907,9 +2576,9 @@ unit_test_status_string_check
          if (cut_is_nullptr(actual_value))
             actual_value = _("null pointer");
 
-         fprintf
+         xpccut_print
          (
-            stdout, "? '%s' %s, '%s' %s\n",
+            "? '%s' %s, '%s' %s\n",
             expected_value, _("expected"), actual_value, _("actual")
          );
       }
@@ -1949,9 +2618,9 @@ unit_test_status_bool_check
    {
       if (! xpccut_is_silent())
       {
-         fprintf
+         xpccut_print
          (
-            stdout, "? %s %s, %s %s\n",
+            "? %s %s, %s %s\n",
             expected_value ? _("true") : _("false"), _("expected"),
             actual_value ? _("true") : _("false"), _("actual")
          );
@@ -1961,6 +2630,560 @@ unit_test_status_bool_check
    return result;
 }
 
+/**
+ *    This function sets the pass/fail flag for this status object based on
+ *    the comparison of a performance measurement against its entry in the
+ *    --baseline file.  The measurement is also appended to the
+ *    --write-baseline file, if that option is in force.
+ *
+ *    Smaller values are better, as for times.  The measurement fails only
+ *    if it exceeds the baseline by more than the --perf-tolerance
+ *    percentage <i> and </i> by more than three times the combined noise
+ *    of the two measurements, so that a noisy benchmark does not fail just
+ *    because of jitter:
+ *
+\verbatim
+      excess = measured - baseline
+      fail if excess > baseline * tolerance / 100, and
+              excess > 3 * sqrt(baseline_noise^2 + noise^2)
+\endverbatim
+ *
+ *    A measurement with no baseline entry always passes.
+ *
+ * \note
+ *    The --write-baseline file is opened and closed for each measurement,
+ *    and each entry is written as one line, so that measurements made by
+ *    parallel jobs or by isolated child processes are all kept.
+ *
+ * \return
+ *    Returns 'true' if the measurement passes.  It will fail if the status
+ *    pointer or the name is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_32()
+ */
+
+cbool_t
+unit_test_status_perf_check
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   const char * name,            /**< The name of the measurement.            */
+   double measured,              /**< The measured value, such as a time.     */
+   double noise                  /**< Its standard deviation, or 0.0.         */
+)
+{
+   cbool_t flag = cut_not_nullptr(name);
+   cbool_t result;
+   if (flag && cut_not_nullptr(status))   /* the pass() call reports null */
+   {
+      const unit_test_options_t * options = status->m_Test_Options;
+      const unit_test_baseline_t * entry = unit_test_options_baseline_find
+      (
+         options, status->m_Test_Group, status->m_Test_Case, name
+      );
+      const char * filename = unit_test_options_write_baseline_file(options);
+      if (cut_not_nullptr(entry))
+      {
+         double excess = measured - entry->m_Value;
+         double tolerance = entry->m_Value *
+            unit_test_options_perf_tolerance(options) / 100.0;
+
+         double spread = entry->m_Noise * entry->m_Noise + noise * noise;
+         flag = excess <= tolerance || excess * excess <= 9.0 * spread;
+         if (! xpccut_is_silent())
+         {
+            if (! flag || unit_test_options_show_values(options))
+            {
+               xpccut_print
+               (
+                  "%c '%s': %.3f %s, %.3f %s\n",
+                  flag ? ' ' : '?', name, measured, _("measured"),
+                  entry->m_Value, _("baseline")
+               );
+            }
+         }
+      }
+      if (cut_not_nullptr(filename))
+      {
+         FILE * f = fopen(filename, "a");
+         if (cut_not_nullptr(f))
+         {
+            fprintf
+            (
+               f, "%d %d %.3f %.3f %s\n",
+               status->m_Test_Group, status->m_Test_Case, measured, noise, name
+            );
+            fclose(f);
+         }
+         else
+            xpccut_errprint_ex(_("could not write baseline file"), filename);
+      }
+   }
+   result = unit_test_status_pass(status, flag);
+   if (! flag)
+      result = false;            /* whether 'status' valid or not, must fail  */
+
+   return result;
+}
+
+/**
+ *    This function sets the pass/fail flag for this status object based on
+ *    the number of heap allocations made by the calling thread since the
+ *    current sub-test started, or since the last call to this function.
+ *    It fails if there were any, so that a test can assert that a hot
+ *    path, such as a lookup in a warmed-up cache, does not allocate:
+ *
+\verbatim
+      (void) cache_find(&cache, key);                 // warm up
+      if (unit_test_status_next_subtest(&status, "No allocation"))
+      {
+         (void) cache_find(&cache, key);
+         (void) unit_test_status_no_alloc_check(&status);
+      }
+\endverbatim
+ *
+ *    The check then starts counting again from zero.  If the
+ *    libxpccut_alloc library is not linked in, nothing is counted, and the
+ *    check always passes.
+ *
+ * \return
+ *    Returns 'true' if there were no allocations.  It will fail if the
+ *    status pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_37()
+ */
+
+cbool_t
+unit_test_status_no_alloc_check
+(
+   unit_test_status_t * status   /**< The "this" pointer for this function.   */
+)
+{
+   cbool_t flag = true;
+   cbool_t result;
+   if (cut_not_nullptr(status))  /* unit_test_status_pass() reports null      */
+   {
+      xpccut_alloc_counts_t now;
+      if (xpccut_alloc_read(&now))
+      {
+         long long count =
+            now.m_Allocations - status->m_Subtest_Allocations.m_Allocations;
+
+         flag = count == 0;
+         if (! flag && ! xpccut_is_silent())
+         {
+            xpccut_print
+            (
+               "? %lld %s, %s\n", count, _("allocations"), _("expected none")
+            );
+         }
+         (void) xpccut_alloc_read(&status->m_Subtest_Allocations);
+      }
+   }
+   result = unit_test_status_pass(status, flag);
+   if (! flag)
+      result = false;            /* whether 'status' valid or not, must fail  */
+
+   return result;
+}
+
+/**
+ *    Provides the number of bytes that the bulk checks compare at a time
+ *    while looking for the first mismatch, once memcmp() has found that
+ *    there is one.
+ */
+
+#define XPCCUT_BULK_BLOCK              4096
+
+/**
+ *    Provides the number of bytes shown before the first mismatch of a
+ *    buffer, in the hex dumps of unit_test_status_buffer_check().  Twice as
+ *    many bytes are shown in all.
+ */
+
+#define XPCCUT_BULK_CONTEXT            16
+
+/**
+ *    Finds the first byte at which two buffers differ.  The whole buffers
+ *    are compared by one memcmp(), which the C library vectorizes, so that
+ *    equal buffers, the usual case, cost one pass.  Only when they differ
+ *    are they compared again, a block at a time, and then a byte at a time
+ *    in the block that differs.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_buffer_check().
+ *
+ * \return
+ *    Returns the offset of the first byte that differs, or \a length if the
+ *    buffers are equal.
+ */
+
+static size_t
+unit_test_status_first_mismatch
+(
+   const unsigned char * expected_value,  /**< The target bytes.              */
+   const unsigned char * actual_value,    /**< The bytes obtained.            */
+   size_t length                          /**< The number of bytes of each.   */
+)
+{
+   size_t result = length;
+   if (memcmp(expected_value, actual_value, length) != 0)
+   {
+      result = 0;
+      while
+      (
+         result + XPCCUT_BULK_BLOCK <= length &&
+         memcmp
+         (
+            expected_value + result, actual_value + result, XPCCUT_BULK_BLOCK
+         ) == 0
+      )
+      {
+         result += XPCCUT_BULK_BLOCK;
+      }
+      while (result < length && expected_value[result] == actual_value[result])
+         ++result;
+   }
+   return result;
+}
+
+/**
+ *    Tells whether a value is too far from the expected value.  Equal
+ *    values, including equal infinities, are never too far, and a NaN
+ *    always is.  The comparisons are combined without branches, so that
+ *    the loop of unit_test_status_first_far() can be vectorized.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_double_array_check().
+ *
+ * \return
+ *    Returns 1 if \a actual_value is too far from \a expected_value.
+ */
+
+static int
+unit_test_status_is_far
+(
+   double expected_value,        /**< The target value.                       */
+   double actual_value,          /**< The value obtained.                     */
+   double tolerance              /**< The largest difference allowed.         */
+)
+{
+   double difference = actual_value - expected_value;
+   return (expected_value != actual_value) &
+   (
+      (difference > tolerance) | (-difference > tolerance) |
+      (difference != difference)
+   );
+}
+
+/**
+ *    Finds the first element at which two arrays of doubles differ by more
+ *    than the tolerance.  The arrays are checked eight elements at a time,
+ *    without a branch inside each group, so that the compiler can use SIMD
+ *    compares; the group that holds a mismatch is then checked element by
+ *    element.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_double_array_check().
+ *
+ * \return
+ *    Returns the index of the first element that differs, or \a count if
+ *    all are near enough.
+ */
+
+static size_t
+unit_test_status_first_far
+(
+   const double * expected_value,   /**< The target values.                   */
+   const double * actual_value,     /**< The values obtained.                 */
+   size_t count,                    /**< The number of elements of each.      */
+   double tolerance                 /**< The largest difference allowed.      */
+)
+{
+   size_t result = 0;
+   for ( ; result + 8 <= count; result += 8)
+   {
+      int far = 0;
+      int i;
+      for (i = 0; i < 8; ++i)
+      {
+         far |= unit_test_status_is_far
+         (
+            expected_value[result + i], actual_value[result + i], tolerance
+         );
+      }
+      if (far != 0)
+         break;
+   }
+   while
+   (
+      result < count &&
+      ! unit_test_status_is_far
+      (
+         expected_value[result], actual_value[result], tolerance
+      )
+   )
+   {
+      ++result;
+   }
+   return result;
+}
+
+/**
+ *    Checks the pointers given to a bulk check.  Two null pointers are
+ *    equal, as in unit_test_status_string_check(), and so are two buffers
+ *    of no length.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.  See the tests for unit_test_status_buffer_check().
+ *
+ * \return
+ *    Returns 'true' if the contents must still be compared.  Otherwise,
+ *    \a flag is set to the result of the check.
+ */
+
+static cbool_t
+unit_test_status_bulk_pointers
+(
+   const void * expected_value,  /**< The target buffer.                      */
+   const void * actual_value,    /**< The buffer obtained.                    */
+   size_t length,                /**< The size of each buffer.                */
+   cbool_t * flag                /**< Receives the result, if it is known.    */
+)
+{
+   cbool_t result = false;
+   if (cut_is_nullptr(expected_value) || cut_is_nullptr(actual_value))
+   {
+      *flag = expected_value == actual_value;
+      if (! *flag && ! xpccut_is_silent())
+      {
+         xpccut_print
+         (
+            "? %s %s, %s %s\n",
+            cut_is_nullptr(expected_value) ? _("null pointer") : _("buffer"),
+            _("expected"),
+            cut_is_nullptr(actual_value) ? _("null pointer") : _("buffer"),
+            _("actual")
+         );
+      }
+   }
+   else if (length == 0)
+      *flag = true;
+   else
+      result = true;
+
+   return result;
+}
+
+/**
+ *    This function sets the pass/fail flag for this status object based on
+ *    the comparison of two buffers of bytes.  It is meant for large
+ *    outputs, such as images or files, that would otherwise be checked a
+ *    byte at a time, at the cost of a status update for each byte:
+ *
+\verbatim
+      (void) unit_test_status_buffer_check(&status, golden, output, size);
+\endverbatim
+ *
+ *    The buffers are compared with memcmp().  If they differ, only the
+ *    offset of the first byte that differs is shown, followed by hex dumps
+ *    of a few bytes of each buffer around it, made by xpccut_dump_string().
+ *    The "Char" indexes in the dumps count from the offset given before
+ *    each dump.
+ *
+ * \return
+ *    Returns 'true' if the buffers are equal.  It will fail if the status
+ *    pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_39()
+ */
+
+cbool_t
+unit_test_status_buffer_check
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   const void * expected_value,  /**< The target bytes for the comparison.    */
+   const void * actual_value,    /**< The bytes obtained during testing.      */
+   size_t length                 /**< The number of bytes in each buffer.     */
+)
+{
+   cbool_t flag = true;
+   cbool_t result;
+   if
+   (
+      unit_test_status_bulk_pointers
+      (
+         expected_value, actual_value, length, &flag
+      )
+   )
+   {
+      const unsigned char * expected = expected_value;
+      const unsigned char * actual = actual_value;
+      size_t offset = unit_test_status_first_mismatch(expected, actual, length);
+      flag = offset == length;
+      result = unit_test_status_pass(status, flag);
+      if (! flag && ! xpccut_is_silent())
+      {
+         size_t start = offset > XPCCUT_BULK_CONTEXT ?
+            offset - XPCCUT_BULK_CONTEXT : 0 ;
+
+         size_t size = length - start;
+         if (size > 2 * XPCCUT_BULK_CONTEXT)
+            size = 2 * XPCCUT_BULK_CONTEXT;
+
+         xpccut_print
+         (
+            "? %s %lu %s %lu\n", _("first mismatch at byte"),
+            (unsigned long) offset, _("of"), (unsigned long) length
+         );
+         xpccut_print
+         (
+            "  %s %lu:", _("expected, from byte"), (unsigned long) start
+         );
+         xpccut_dump_string((const char *) expected + start, (int) size);
+         xpccut_print
+         (
+            "  %s %lu:", _("actual, from byte"), (unsigned long) start
+         );
+         xpccut_dump_string((const char *) actual + start, (int) size);
+      }
+   }
+   else
+      result = unit_test_status_pass(status, flag);
+
+   if (! flag)
+      result = false;            /* whether 'status' valid or not, must fail  */
+
+   return result;
+}
+
+/**
+ *    This function sets the pass/fail flag for this status object based on
+ *    the comparison of two arrays of integers, as one call, rather than an
+ *    unit_test_status_int_check() for each element.  The arrays are
+ *    compared as bytes, as in unit_test_status_buffer_check(), and only
+ *    the first element that differs is shown.
+ *
+ * \return
+ *    Returns 'true' if the arrays are equal.  It will fail if the status
+ *    pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_39()
+ */
+
+cbool_t
+unit_test_status_int_array_check
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   const int * expected_value,   /**< The target values for the comparison.   */
+   const int * actual_value,     /**< The values obtained during testing.     */
+   size_t count                  /**< The number of elements in each array.   */
+)
+{
+   cbool_t flag = true;
+   cbool_t result;
+   size_t length = count * sizeof(int);
+   if
+   (
+      unit_test_status_bulk_pointers
+      (
+         expected_value, actual_value, length, &flag
+      )
+   )
+   {
+      size_t index = unit_test_status_first_mismatch
+      (
+         (const unsigned char *) expected_value,
+         (const unsigned char *) actual_value, length
+      ) / sizeof(int);
+
+      flag = index == count;
+      result = unit_test_status_pass(status, flag);
+      if (! flag && ! xpccut_is_silent())
+      {
+         xpccut_print
+         (
+            "? %s %lu %s %lu: %d %s, %d %s\n", _("first mismatch at element"),
+            (unsigned long) index, _("of"), (unsigned long) count,
+            expected_value[index], _("expected"),
+            actual_value[index], _("actual")
+         );
+      }
+   }
+   else
+      result = unit_test_status_pass(status, flag);
+
+   if (! flag)
+      result = false;            /* whether 'status' valid or not, must fail  */
+
+   return result;
+}
+
+/**
+ *    This function sets the pass/fail flag for this status object based on
+ *    the comparison of two arrays of doubles, each element of which must be
+ *    within \a tolerance of the expected element.  Equal values, including
+ *    infinities, always match, and a NaN never does.  Only the first
+ *    element that differs is shown.
+ *
+ * \return
+ *    Returns 'true' if all elements are near enough.  It will fail if the
+ *    status pointer is null.
+ *
+ * \unittests
+ *    -  unit_unit_test_02_39()
+ */
+
+cbool_t
+unit_test_status_double_array_check
+(
+   unit_test_status_t * status,  /**< The "this" pointer for this function.   */
+   const double * expected_value,   /**< Target values for the comparison.   */
+   const double * actual_value,     /**< The values obtained during testing. */
+   size_t count,                    /**< Number of elements in each array.   */
+   double tolerance                 /**< The largest difference allowed.     */
+)
+{
+   cbool_t flag = true;
+   cbool_t result;
+   if
+   (
+      unit_test_status_bulk_pointers
+      (
+         expected_value, actual_value, count * sizeof(double), &flag
+      )
+   )
+   {
+      size_t index = unit_test_status_first_far
+      (
+         expected_value, actual_value, count, tolerance
+      );
+      flag = index == count;
+      result = unit_test_status_pass(status, flag);
+      if (! flag && ! xpccut_is_silent())
+      {
+         xpccut_print
+         (
+            "? %s %lu %s %lu: %.17g %s, %.17g %s, %s %g\n",
+            _("first mismatch at element"),
+            (unsigned long) index, _("of"), (unsigned long) count,
+            expected_value[index], _("expected"),
+            actual_value[index], _("actual"), _("tolerance"), tolerance
+         );
+      }
+   }
+   else
+      result = unit_test_status_pass(status, flag);
+
+   if (! flag)
+      result = false;            /* whether 'status' valid or not, must fail  */
+
+   return result;
+}
+
 /**
  *    This function allows for internal testing of the error-count value.
  *
@@ -2057,9 +3280,8 @@ unit_test_status_show
    cbool_t result = xpccut_thisptr(status);
    if (result && ! xpccut_is_silent())
    {
-      fprintf
+      xpccut_print
       (
-         stdout,
          "- unit_test_status_t:\n"
          "-    m_Test_Options:           %p\n"
          "-    m_Group_Name:             %s\n"
@@ -2095,6 +3317,43 @@ unit_test_status_show
          (int) status->m_End_Time_us.tv_usec,
          status->m_Test_Duration_ms
       );
+      if (status->m_Is_Counted)
+         xpccut_perf_show("-    m_Counters", &status->m_Counters, 1.0);
+
+      if (status->m_Allocations.m_Is_Valid)
+      {
+         xpccut_print
+         (
+            "-    m_Allocations:          %lld/%lld, %lld/%lld bytes\n",
+            status->m_Allocations.m_Allocations,
+            status->m_Allocations.m_Frees,
+            status->m_Allocations.m_Bytes_Allocated,
+            status->m_Allocations.m_Bytes_Freed
+         );
+      }
+      if (status->m_Failure_Count > 0)
+      {
+         int f;
+         xpccut_print
+         (
+            "-    m_Failure_Count:          %d\n", status->m_Failure_Count
+         );
+         for (f = 0; f < XPCCUT_FAILURE_LOG_SIZE; ++f)
+         {
+            const unit_test_failure_t * entry =
+               unit_test_status_failure(status, f);
+
+            if (cut_not_nullptr(entry))
+            {
+               xpccut_print
+               (
+                  "-    m_Failures[%d]:            thread %d, sub-test %d "
+                  "['%s']\n",
+                  f, entry->m_Thread, entry->m_Subtest, entry->m_Subtest_Name
+               );
+            }
+         }
+      }
    }
    return result;
 }
@@ -2132,11 +3391,10 @@ unit_test_status_trace
    if (result && ! xpccut_is_silent())
    {
       if (cut_not_nullptr(context))
-         fprintf(stdout, "- %s: %s\n", _("Context"), context);
+         xpccut_print("- %s: %s\n", _("Context"), context);
 
-      fprintf
+      xpccut_print
       (
-         stdout,
          "- unit_test_status_t partial settings:\n"
          "-    'this' pointer:           %p\n"
          "-    'options' pointer:        %p\n"
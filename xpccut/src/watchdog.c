@@ -0,0 +1,729 @@
+/**
+ * \file          watchdog.c
+ * \library       xpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    Provides the watchdog for the --test-timeout option.  Also see the
+ *    watchdog.h module.
+ *
+ *    The watches are kept in a binary heap ordered by deadline, and one
+ *    lock protects the heap.  The thread is started by the first watch
+ *    that is armed, and it is never stopped; it sleeps on a condition
+ *    variable, timed against the monotonic clock, until the nearest
+ *    deadline.  gs_Wait_Deadline records what it is sleeping on, so that
+ *    arming a watch only signals the thread when the new deadline is
+ *    nearer.  A watch that is disarmed is simply taken out of the heap,
+ *    which at worst makes the thread wake up once for nothing.
+ *
+ *    The trace of sub-tests is written by the test thread without the
+ *    lock, through the thread-local pointer to its watch.  The watchdog
+ *    only reads it once the test has run late, so at worst the latest
+ *    entry is missing from the trace.
+ */
+
+#include <xpc/watchdog.h>              /* xpccut_watch_t                      */
+#include <xpc/output.h>                /* xpccut_print_error()                */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* realloc(), EXIT_FAILURE             */
+#endif
+
+#if XPC_HAVE_TIME_H
+#include <time.h>                      /* struct timespec, CLOCK_MONOTONIC    */
+#endif
+
+#if XPC_HAVE_PTHREAD_H && XPC_HAVE_CLOCK_GETTIME && XPC_HAVE_UNISTD_H && \
+ defined CLOCK_MONOTONIC && ! defined WIN32
+#define XPCCUT_USE_WATCHDOG 1
+#include <unistd.h>                    /* _exit()                             */
+#else
+#define XPCCUT_USE_WATCHDOG 0
+#endif
+
+#if XPCCUT_USE_WATCHDOG && XPC_HAVE_EXECINFO_H && XPC_HAVE_SIGNAL_H
+#define XPCCUT_USE_BACKTRACE 1
+#include <execinfo.h>                  /* backtrace(), backtrace_symbols_fd() */
+#include <signal.h>                    /* sigaction(), pthread_kill()         */
+#else
+#define XPCCUT_USE_BACKTRACE 0
+#endif
+
+/**
+ *    Publishes and reads the sequence trace of a watch, which the thread of
+ *    the test writes in xpccut_watchdog_step() while the watchdog thread
+ *    may be reading it in xpccut_watchdog_expire().  A slot is filled in
+ *    first, and the new number of steps is published last, with a release
+ *    store, which the watchdog reads with an acquire load.  The fence lets
+ *    the watchdog tell if a slot was written again while it read it.
+ *
+ *    Where the compiler provides no atomic operations, they are plain
+ *    operations, and the trace is only as good as the timing allows.
+ */
+
+#if defined __GNUC__ && defined __ATOMIC_ACQUIRE
+#define XPCCUT_WATCH_PUBLISH(x, v)  __atomic_store_n(&(x), v, __ATOMIC_RELEASE)
+#define XPCCUT_WATCH_LOAD(x)        __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define XPCCUT_WATCH_SET(x, v)      __atomic_store_n(&(x), v, __ATOMIC_RELAXED)
+#define XPCCUT_WATCH_GET(x)         __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define XPCCUT_WATCH_FENCE()        __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#elif defined __GNUC__
+#define XPCCUT_WATCH_PUBLISH(x, v)  do { __sync_synchronize(); (x) = (v); } \
+                                       while (0)
+#define XPCCUT_WATCH_LOAD(x)        (__sync_synchronize(), (x))
+#define XPCCUT_WATCH_SET(x, v)      ((x) = (v))
+#define XPCCUT_WATCH_GET(x)         (x)
+#define XPCCUT_WATCH_FENCE()        __sync_synchronize()
+#else
+#define XPCCUT_WATCH_PUBLISH(x, v)  ((x) = (v))
+#define XPCCUT_WATCH_LOAD(x)        (x)
+#define XPCCUT_WATCH_SET(x, v)      ((x) = (v))
+#define XPCCUT_WATCH_GET(x)         (x)
+#define XPCCUT_WATCH_FENCE()        ((void) 0)
+#endif
+
+/**
+ *    Provides the watch of the test that the calling thread is running, for
+ *    xpccut_watchdog_step().
+ */
+
+static XPCCUT_THREAD_LOCAL xpccut_watch_t * gs_Current_Watch = nullptr;
+
+#if XPCCUT_USE_WATCHDOG
+
+/**
+ *    Provides the signal that asks the thread of a late test to show its
+ *    stack.
+ */
+
+#define XPCCUT_WATCHDOG_SIGNAL         SIGUSR2
+
+/**
+ *    Provides the number of stack frames that are shown for a late test.
+ */
+
+#define XPCCUT_WATCHDOG_FRAMES         64
+
+/**
+ *    Protects all of the static data of this module, and the watches in
+ *    the heap.
+ */
+
+static pthread_mutex_t gs_Watchdog_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ *    Wakes the watchdog thread when a nearer deadline is armed.  It is set
+ *    up to use the monotonic clock when the thread is started.
+ */
+
+static pthread_cond_t gs_Watchdog_Wake;
+
+/**
+ *    Indicates that the watchdog thread is running.
+ */
+
+static cbool_t gs_Watchdog_Started = false;
+
+/**
+ *    Indicates that the stack of a late test can be shown.
+ */
+
+static cbool_t gs_Watchdog_Backtrace = false;
+
+/**
+ *    Provides the deadline that the watchdog thread is sleeping on, or 0 if
+ *    it is sleeping until it is signalled.
+ */
+
+static xpccut_ticks_t gs_Wait_Deadline = 0;
+
+/**
+ *    Provides the heap of armed watches, nearest deadline first.
+ */
+
+static xpccut_watch_t ** gs_Heap = nullptr;
+
+/**
+ *    Provides the number of watches in gs_Heap.
+ */
+
+static int gs_Heap_Count = 0;
+
+/**
+ *    Provides the number of slots allocated for gs_Heap.
+ */
+
+static int gs_Heap_Size = 0;
+
+/**
+ *    Puts a watch into a slot of the heap.  The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_heap_place
+(
+   xpccut_watch_t * watch,          /**< The watch, assumed valid.            */
+   int index                        /**< The slot for it.                     */
+)
+{
+   gs_Heap[index] = watch;
+   watch->m_Heap_Index = index;
+}
+
+/**
+ *    Moves a watch up the heap until its parent has an earlier deadline.
+ *    The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_heap_sift_up
+(
+   int index                        /**< The slot of the watch to move.       */
+)
+{
+   xpccut_watch_t * watch = gs_Heap[index];
+   while (index > 0)
+   {
+      int parent = (index - 1) / 2;
+      if (gs_Heap[parent]->m_Deadline <= watch->m_Deadline)
+         break;
+
+      xpccut_heap_place(gs_Heap[parent], index);
+      index = parent;
+   }
+   xpccut_heap_place(watch, index);
+}
+
+/**
+ *    Moves a watch down the heap until its children have later deadlines.
+ *    The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_heap_sift_down
+(
+   int index                        /**< The slot of the watch to move.       */
+)
+{
+   xpccut_watch_t * watch = gs_Heap[index];
+   for (;;)
+   {
+      int child = 2 * index + 1;
+      if (child >= gs_Heap_Count)
+         break;
+
+      if
+      (
+         child + 1 < gs_Heap_Count &&
+         gs_Heap[child + 1]->m_Deadline < gs_Heap[child]->m_Deadline
+      )
+      {
+         ++child;
+      }
+      if (watch->m_Deadline <= gs_Heap[child]->m_Deadline)
+         break;
+
+      xpccut_heap_place(gs_Heap[child], index);
+      index = child;
+   }
+   xpccut_heap_place(watch, index);
+}
+
+/**
+ *    Adds a watch to the heap.  The caller holds the lock.
+ *
+ * \return
+ *    Returns 'true' if there was memory for the watch.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static cbool_t
+xpccut_heap_push
+(
+   xpccut_watch_t * watch           /**< The watch, assumed valid.            */
+)
+{
+   cbool_t result = true;
+   if (gs_Heap_Count == gs_Heap_Size)
+   {
+      int size = gs_Heap_Size > 0 ? gs_Heap_Size * 2 : 16 ;
+      xpccut_watch_t ** heap = realloc(gs_Heap, (size_t) size * sizeof *heap);
+      result = cut_not_nullptr(heap);
+      if (result)
+      {
+         gs_Heap = heap;
+         gs_Heap_Size = size;
+      }
+   }
+   if (result)
+   {
+      xpccut_heap_place(watch, gs_Heap_Count++);
+      xpccut_heap_sift_up(watch->m_Heap_Index);
+   }
+   return result;
+}
+
+/**
+ *    Takes a watch out of the heap.  The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_heap_remove
+(
+   xpccut_watch_t * watch           /**< The watch, which is in the heap.     */
+)
+{
+   int index = watch->m_Heap_Index;
+   xpccut_watch_t * last = gs_Heap[--gs_Heap_Count];
+   watch->m_Heap_Index = -1;
+   if (last != watch)
+   {
+      xpccut_heap_place(last, index);
+      xpccut_heap_sift_up(index);
+      xpccut_heap_sift_down(last->m_Heap_Index);
+   }
+}
+
+#if XPCCUT_USE_BACKTRACE
+
+/**
+ *    Shows the stack of the thread that receives XPCCUT_WATCHDOG_SIGNAL,
+ *    which is the thread of a late test.  The output goes straight to the
+ *    standard error stream, not through the output layer.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_watchdog_backtrace
+(
+   int signum                       /**< The signal number, unused.           */
+)
+{
+   void * frames[XPCCUT_WATCHDOG_FRAMES];
+   int count = backtrace(frames, XPCCUT_WATCHDOG_FRAMES);
+   (void) signum;
+   backtrace_symbols_fd(frames, count, 2);
+}
+
+#endif   /* XPCCUT_USE_BACKTRACE */
+
+/**
+ *    Shows a late test, the sub-tests it has entered, and its stack, or,
+ *    the second time, ends the application.  The caller holds the lock.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void
+xpccut_watchdog_expire
+(
+   xpccut_watch_t * watch,          /**< The watch, taken out of the heap.    */
+   xpccut_ticks_t now               /**< The current time.                    */
+)
+{
+   cbool_t verbose = ! xpccut_is_silent();
+   if (! watch->m_Expired)
+   {
+      watch->m_Expired = true;
+      if (verbose)
+      {
+         int steps = XPCCUT_WATCH_LOAD(watch->m_Steps);
+         int first = steps > XPCCUT_WATCH_TRACE ?
+            steps - XPCCUT_WATCH_TRACE : 0 ;
+
+         int s;
+         xpccut_print_error
+         (
+            "? %s %d: %s %d ms\n", _("TEST"), watch->m_Test_Number + 1,
+            _("timed out after"), watch->m_Timeout
+         );
+         if (cut_not_nullptr(watch->m_Group_Name))
+         {
+            xpccut_print_error
+            (
+               "  %s '%s', %s '%s'\n",
+               _("Group"), watch->m_Group_Name,
+               _("Case"), cut_not_nullptr(watch->m_Case_Name) ?
+                  watch->m_Case_Name : ""
+            );
+         }
+         for (s = first; s < steps; ++s)
+         {
+            /*
+             * The test is still running, so the slot of step s is written
+             * again once its thread enters step s + XPCCUT_WATCH_TRACE.
+             * A step whose slot may have been written while it was read
+             * is left out.
+             */
+
+            const xpccut_watch_step_t * step =
+               &watch->m_Trace[s % XPCCUT_WATCH_TRACE];
+
+            int subtest = XPCCUT_WATCH_GET(step->m_Subtest);
+            const char * name = XPCCUT_WATCH_GET(step->m_Subtest_Name);
+            XPCCUT_WATCH_FENCE();
+            if (XPCCUT_WATCH_GET(watch->m_Steps) < s + XPCCUT_WATCH_TRACE)
+            {
+               xpccut_print_error
+               (
+                  "  %s %d: %s\n", _("Sub-test"), subtest,
+                  cut_not_nullptr(name) ? name : ""
+               );
+            }
+         }
+      }
+#if XPCCUT_USE_BACKTRACE
+      if (verbose && gs_Watchdog_Backtrace)
+      {
+         xpccut_print_error("  %s:\n", _("Stack of the test"));
+         xpccut_output_flush();
+         (void) pthread_kill(watch->m_Thread, XPCCUT_WATCHDOG_SIGNAL);
+      }
+#endif
+      xpccut_output_flush();
+      watch->m_Deadline = now +
+         (xpccut_ticks_t) XPCCUT_WATCHDOG_GRACE_MS * XPCCUT_TICKS_PER_MS;
+
+      if (! xpccut_heap_push(watch))
+         watch->m_Heap_Index = -1;        /* cannot give it a grace period    */
+   }
+   else
+   {
+      if (verbose)
+      {
+         xpccut_print_error
+         (
+            "? %s %d: %s\n", _("TEST"), watch->m_Test_Number + 1,
+            _("still running; ending the test application")
+         );
+      }
+      xpccut_output_flush();
+      _exit(EXIT_FAILURE);
+   }
+}
+
+/**
+ *    Runs the watchdog.  It acts on every watch whose deadline has passed,
+ *    and then sleeps until the nearest deadline, or until it is woken by a
+ *    nearer one.  It never returns.
+ *
+ * \return
+ *    Would return null.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static void *
+xpccut_watchdog_thread
+(
+   void * unused                    /**< The thread parameter, unused.        */
+)
+{
+   (void) unused;
+   pthread_mutex_lock(&gs_Watchdog_Lock);
+   for (;;)
+   {
+      xpccut_ticks_t now = xpccut_get_ticks();
+      while (gs_Heap_Count > 0 && gs_Heap[0]->m_Deadline <= now)
+      {
+         xpccut_watch_t * watch = gs_Heap[0];
+         xpccut_heap_remove(watch);
+         xpccut_watchdog_expire(watch, now);
+      }
+      if (gs_Heap_Count > 0)
+      {
+         struct timespec when;
+         gs_Wait_Deadline = gs_Heap[0]->m_Deadline;
+         when.tv_sec = (time_t) (gs_Wait_Deadline / 1000000000ULL);
+         when.tv_nsec = (long) (gs_Wait_Deadline % 1000000000ULL);
+         (void) pthread_cond_timedwait
+         (
+            &gs_Watchdog_Wake, &gs_Watchdog_Lock, &when
+         );
+      }
+      else
+      {
+         gs_Wait_Deadline = 0;
+         (void) pthread_cond_wait(&gs_Watchdog_Wake, &gs_Watchdog_Lock);
+      }
+   }
+   return nullptr;
+}
+
+/**
+ *    Starts the watchdog thread, if it is not running yet.  The caller
+ *    holds the lock.  The handler that shows the stack of a late test is
+ *    only installed if the application has not claimed the signal itself.
+ *
+ * \return
+ *    Returns 'true' if the thread is running.
+ *
+ *    Since this is a static (private) function, only indirect tests are
+ *    available.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30() [indirect test]
+ */
+
+static cbool_t
+xpccut_watchdog_start (void)
+{
+   if (! gs_Watchdog_Started)
+   {
+      pthread_condattr_t attributes;
+      pthread_attr_t threadattributes;
+      pthread_t thread;
+      cbool_t ok = pthread_condattr_init(&attributes) == 0;
+      if (ok)
+      {
+         ok = pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC) == 0;
+         if (ok)
+            ok = pthread_cond_init(&gs_Watchdog_Wake, &attributes) == 0;
+
+         (void) pthread_condattr_destroy(&attributes);
+      }
+      if (ok)
+      {
+         ok = pthread_attr_init(&threadattributes) == 0;
+         if (ok)
+         {
+            (void) pthread_attr_setdetachstate
+            (
+               &threadattributes, PTHREAD_CREATE_DETACHED
+            );
+            ok = pthread_create
+            (
+               &thread, &threadattributes, xpccut_watchdog_thread, nullptr
+            ) == 0;
+            (void) pthread_attr_destroy(&threadattributes);
+         }
+         if (! ok)
+            (void) pthread_cond_destroy(&gs_Watchdog_Wake);
+      }
+      if (ok)
+      {
+#if XPCCUT_USE_BACKTRACE
+         struct sigaction action;
+         if (sigaction(XPCCUT_WATCHDOG_SIGNAL, nullptr, &action) == 0)
+         {
+            if (action.sa_handler == SIG_DFL)
+            {
+               sigemptyset(&action.sa_mask);
+               action.sa_flags = SA_RESTART;
+               action.sa_handler = xpccut_watchdog_backtrace;
+               gs_Watchdog_Backtrace =
+                  sigaction(XPCCUT_WATCHDOG_SIGNAL, &action, nullptr) == 0;
+            }
+         }
+#endif
+         gs_Watchdog_Started = true;
+      }
+      else
+         xpccut_errprint_func(_("could not start the test watchdog"));
+   }
+   return gs_Watchdog_Started;
+}
+
+#endif   /* XPCCUT_USE_WATCHDOG */
+
+/**
+ *    Indicates if the platform can watch the tests that run in-process.
+ *
+ * \return
+ *    Returns 'true' if the watchdog thread can be used.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+cbool_t
+xpccut_watchdog_is_available (void)
+{
+   return XPCCUT_USE_WATCHDOG ? true : false ;
+}
+
+/**
+ *    Starts watching the test that the calling thread is about to run.  A
+ *    \a timeout of 0 or less means the test is not watched, but the watch
+ *    is still set up, so xpccut_watchdog_disarm() can always be called.
+ *    If the watchdog cannot be used, an error is shown the first time, and
+ *    the test is not watched.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+void
+xpccut_watchdog_arm
+(
+   xpccut_watch_t * watch,          /**< The watch to arm.                    */
+   int timeout,                     /**< The timeout of the test, in ms.      */
+   int testnumber,                  /**< The index of the test, re 0.         */
+   const char * groupname,          /**< The group name, or null.             */
+   const char * casename            /**< The case name, or null.              */
+)
+{
+   if (cut_not_nullptr(watch))
+   {
+      watch->m_Timeout = 0;
+      watch->m_Test_Number = testnumber;
+      watch->m_Group_Name = groupname;
+      watch->m_Case_Name = casename;
+      watch->m_Heap_Index = -1;
+      watch->m_Expired = false;
+      watch->m_Steps = 0;
+      watch->m_Outer = nullptr;
+#if XPCCUT_USE_WATCHDOG
+      if (timeout > 0)
+      {
+         pthread_mutex_lock(&gs_Watchdog_Lock);
+         if (xpccut_watchdog_start())
+         {
+            watch->m_Thread = pthread_self();
+            watch->m_Deadline = xpccut_get_ticks() +
+               (xpccut_ticks_t) timeout * XPCCUT_TICKS_PER_MS;
+
+            if (xpccut_heap_push(watch))
+            {
+               watch->m_Timeout = timeout;
+               watch->m_Outer = gs_Current_Watch;
+               gs_Current_Watch = watch;
+               if
+               (
+                  gs_Wait_Deadline == 0 ||
+                  watch->m_Deadline < gs_Wait_Deadline
+               )
+               {
+                  (void) pthread_cond_signal(&gs_Watchdog_Wake);
+               }
+            }
+            else
+               xpccut_errprint_func(_("out of memory for the test watchdog"));
+         }
+         pthread_mutex_unlock(&gs_Watchdog_Lock);
+      }
+#else
+      (void) timeout;
+#endif
+   }
+}
+
+/**
+ *    Stops watching a test, once it has returned.
+ *
+ * \return
+ *    Returns 'true' if the test ran past its deadline, in which case the
+ *    caller should count it as a failure.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+cbool_t
+xpccut_watchdog_disarm
+(
+   xpccut_watch_t * watch           /**< The watch to disarm.                 */
+)
+{
+   cbool_t result = false;
+   if (cut_not_nullptr(watch))
+   {
+#if XPCCUT_USE_WATCHDOG
+      if (watch->m_Timeout > 0)
+      {
+         pthread_mutex_lock(&gs_Watchdog_Lock);
+         if (watch->m_Heap_Index >= 0)
+            xpccut_heap_remove(watch);
+
+         result = watch->m_Expired;
+         pthread_mutex_unlock(&gs_Watchdog_Lock);
+      }
+#endif
+      if (gs_Current_Watch == watch)
+         gs_Current_Watch = watch->m_Outer;
+
+      watch->m_Timeout = 0;
+   }
+   return result;
+}
+
+/**
+ *    Adds a sub-test to the sequence trace of the test that the calling
+ *    thread is running.  It is called by unit_test_status_next_subtest(),
+ *    and does nothing if the test is not watched.  The slot is filled in
+ *    before the new number of steps is published, since the watchdog
+ *    thread reads the trace without the lock of the test's thread.
+ *
+ * \unittests
+ *    -  unit_unit_test_04_30()
+ */
+
+void
+xpccut_watchdog_step
+(
+   int subtest,                     /**< The number of the sub-test.          */
+   const char * name                /**< Its interned name.                   */
+)
+{
+   xpccut_watch_t * watch = gs_Current_Watch;
+   if (cut_not_nullptr(watch))
+   {
+      int steps = XPCCUT_WATCH_GET(watch->m_Steps);
+      xpccut_watch_step_t * step = &watch->m_Trace[steps % XPCCUT_WATCH_TRACE];
+      XPCCUT_WATCH_FENCE();                  /* before the slot changes */
+      XPCCUT_WATCH_SET(step->m_Subtest, subtest);
+      XPCCUT_WATCH_SET(step->m_Subtest_Name, name);
+      XPCCUT_WATCH_PUBLISH(watch->m_Steps, steps + 1);
+   }
+}
+
+/*
+ * watchdog.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
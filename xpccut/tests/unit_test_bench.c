@@ -0,0 +1,599 @@
+/**
+ * \file          unit_test_bench.c
+ * \library       libxpccut
+ * \author        Chris Ahlstrom
+ * \date          2026-10-14
+ * \updates       2026-10-14
+ * \version       $Revision$
+ * \license       $XPC_SUITE_GPL_LICENSE$
+ *
+ *    This application measures the overhead of the xpccut library itself:
+ *    what running a test, a sub-test, and a check costs, apart from the
+ *    code being tested, along with the throughput of the fuzz and random
+ *    functions, and the resolution of the clocks.  It is built along with
+ *    unit_test_test, and run by "make bench".
+ *
+ *    Each measurement is taken BENCH_ROUNDS times, and written as one line
+ *    of JSON, so that the results of two builds can be compared by a
+ *    script:
+ *
+\verbatim
+   {"library":"xpccut","bench":"per_test","unit":"ns","count":2000,
+      "median":1234.500,"min":1200.250,"max":1301.000}
+\endverbatim
+ *
+ *    (The line is broken here only to fit.)  The median is the number to
+ *    watch; the minimum and maximum show how noisy the machine is.  The
+ *    output of the tests being timed goes to an output sink that throws it
+ *    away, so the cost of formatting the progress messages is measured,
+ *    but not the speed of the terminal.
+ *
+ *    Options:
+ *
+ *       -  --quick:  Runs a tenth of the iterations, as a smoke test.
+ *       -  --output file:  Writes the results to a file, not stdout.
+ */
+
+#include <xpc/fuzz.h>                  /* xpccut_fuzz(), xpccut_random()      */
+#include <xpc/output.h>                /* xpccut_output_set_sink()            */
+#include <xpc/portable_subset.h>       /* xpccut_get_ticks(), etc.            */
+#include <xpc/unit_test.h>             /* unit_test_t structure               */
+
+#if XPC_HAVE_STDIO_H
+#include <stdio.h>                     /* fprintf(), fopen()                  */
+#endif
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* qsort(), malloc(), free()           */
+#endif
+
+#if XPC_HAVE_STRING_H
+#include <string.h>                    /* strcmp(), memset()                  */
+#endif
+
+/**
+ *    The number of times each measurement is taken.
+ */
+
+#define BENCH_ROUNDS             7
+
+/**
+ *    The number of tests run by each round of the per-test measurements.
+ */
+
+#define BENCH_TESTS              2000
+
+/**
+ *    The number of calls timed by each round of the per-sub-test and
+ *    per-check measurements, and of the calls to the clock.
+ */
+
+#define BENCH_CALLS              1000000
+
+/**
+ *    The size of each string made by the fuzz measurements, and the number
+ *    of strings made in a round.
+ */
+
+#define BENCH_FUZZ_SIZE          65536
+#define BENCH_FUZZ_COUNT         64
+
+/**
+ *    The size of the buffers compared by the buffer-check measurement.
+ */
+
+#define BENCH_BUFFER_SIZE        4096
+
+/**
+ *    Divides the iteration counts, for the --quick option.
+ */
+
+static int gs_divisor = 1;
+
+/**
+ *    The file that receives the results, stdout by default.
+ */
+
+static FILE * gs_results = nullptr;
+
+/**
+ *    Keeps the results of the timed loops alive, so that the compiler
+ *    cannot drop the loops.
+ */
+
+static volatile unsigned long gs_sink = 0;
+
+/**
+ *    Provides an output sink that throws away the output of the tests
+ *    being timed, while counting it, so that it is still formatted.
+ */
+
+static void
+bench_discard
+(
+   void * context,
+   xpccut_output_channel_t channel,
+   const char * text,
+   int length
+)
+{
+   (void) context;
+   (void) channel;
+   (void) text;
+   gs_sink += (unsigned long) length;
+}
+
+/**
+ *    Provides the number of iterations to run, scaled by --quick.
+ */
+
+static int
+bench_count (int count)
+{
+   int result = count / gs_divisor;
+   return result > 0 ? result : 1 ;
+}
+
+/**
+ *    Provides the time since \a start, in nanoseconds.
+ */
+
+static double
+bench_elapsed_ns (xpccut_ticks_t start)
+{
+   return (double) (xpccut_get_ticks() - start);
+}
+
+/**
+ *    Orders two doubles for qsort().
+ */
+
+static int
+bench_compare (const void * a, const void * b)
+{
+   double da = *(const double *) a;
+   double db = *(const double *) b;
+   return da < db ? -1 : (da > db ? 1 : 0) ;
+}
+
+/**
+ *    Writes the result of one measurement as a line of JSON.
+ *
+ * \param bench
+ *    The name of the measurement.
+ *
+ * \param unit
+ *    The unit of the values, such as "ns" for the time of one call.
+ *
+ * \param count
+ *    The number of calls (or bytes, etc.) in each round.
+ *
+ * \param values
+ *    The value found by each round.  They are sorted by this function.
+ */
+
+static void
+bench_report
+(
+   const char * bench,
+   const char * unit,
+   long count,
+   double * values
+)
+{
+   qsort(values, BENCH_ROUNDS, sizeof(double), bench_compare);
+   fprintf
+   (
+      gs_results,
+      "{\"library\":\"xpccut\",\"bench\":\"%s\",\"unit\":\"%s\","
+      "\"count\":%ld,\"median\":%.3f,\"min\":%.3f,\"max\":%.3f}\n",
+      bench, unit, count,
+      values[BENCH_ROUNDS / 2], values[0], values[BENCH_ROUNDS - 1]
+   );
+   fflush(gs_results);
+}
+
+/**
+ *    Provides the test run by the per-test measurements, which does the
+ *    least that a test can do: it starts one sub-test, and passes.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+bench_empty_test (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 1, 1, "bench", "empty test"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "only"))
+         unit_test_status_pass(&status, true);
+   }
+   return status;
+}
+
+/**
+ *    Times one run of BENCH_TESTS empty tests, which is what the runner
+ *    adds to every test: unit_test_run_a_test_before() and
+ *    unit_test_run_a_test_after(), the copy of the options, the setting up
+ *    of the status, and the progress messages.
+ *
+ * \param progress
+ *    If true, the tests show their progress messages, as they do by
+ *    default; otherwise --no-show-progress is given.
+ *
+ * \return
+ *    Returns the time of one test, in nanoseconds, or -1.0 if the run
+ *    failed.
+ */
+
+static double
+bench_run_tests (cbool_t progress)
+{
+   double result = -1.0;
+   unit_test_t tests;
+   char * argv[2];
+   int argc = progress ? 1 : 2 ;
+   int count = bench_count(BENCH_TESTS);
+   argv[0] = "unit_test_bench";
+   argv[1] = "--no-show-progress";
+   if (unit_test_initialize(&tests, argc, argv, "bench", "1.0", "none"))
+   {
+      cbool_t ok = unit_test_reserve(&tests, count);
+      int i;
+      for (i = 0; ok && i < count; ++i)
+         ok = unit_test_load(&tests, bench_empty_test);
+
+      if (ok)
+      {
+         void * context = nullptr;
+         xpccut_output_sink_t sink = xpccut_output_get_sink(&context);
+         xpccut_ticks_t start;
+         xpccut_output_set_sink(bench_discard, nullptr);
+         start = xpccut_get_ticks();
+         ok = unit_test_run(&tests);
+         result = bench_elapsed_ns(start) / count;
+         xpccut_output_flush();
+         xpccut_output_set_sink(sink, context);
+         if (! ok)
+            result = -1.0;
+      }
+   }
+   unit_test_destroy(&tests);
+   return result;
+}
+
+/**
+ *    Measures the overhead of running a test, with and without the
+ *    progress messages.
+ *
+ * \return
+ *    Returns 'true' if the runs succeeded.
+ */
+
+static cbool_t
+bench_per_test (void)
+{
+   cbool_t result = true;
+   double values[BENCH_ROUNDS];
+   int pass;
+   for (pass = 0; result && pass < 2; ++pass)
+   {
+      int r;
+      for (r = 0; result && r < BENCH_ROUNDS; ++r)
+      {
+         values[r] = bench_run_tests(pass == 1);
+         result = values[r] >= 0.0;
+      }
+      if (result)
+      {
+         bench_report
+         (
+            pass == 0 ? "per_test" : "per_test_progress", "ns",
+            (long) bench_count(BENCH_TESTS), values
+         );
+      }
+      else
+         fprintf(stderr, "? %s\n", "the run of the tests failed");
+   }
+   return result;
+}
+
+/**
+ *    Sets up the options and the status used by the per-sub-test and
+ *    per-check measurements.
+ *
+ * \return
+ *    Returns 'true' if the status was set up.
+ */
+
+static cbool_t
+bench_status
+(
+   unit_test_options_t * options,
+   unit_test_status_t * status
+)
+{
+   cbool_t result = unit_test_options_init(options);
+   if (result)
+      result = unit_test_options_show_progress_set(options, false);
+
+   if (result)
+   {
+      result = unit_test_status_initialize
+      (
+         status, options, 1, 1, "bench", "status"
+      );
+   }
+   return result;
+}
+
+/**
+ *    Measures the costs of unit_test_status_initialize(), of
+ *    unit_test_status_next_subtest(), and of the checks.
+ *
+ * \return
+ *    Returns 'true' if the status could be set up.
+ */
+
+static cbool_t
+bench_per_check (void)
+{
+   unit_test_options_t options;
+   unit_test_status_t status;
+   cbool_t result = bench_status(&options, &status);
+   if (result)
+   {
+      static unsigned char s_expected[BENCH_BUFFER_SIZE];
+      static unsigned char s_actual[BENCH_BUFFER_SIZE];
+      double init[BENCH_ROUNDS];
+      double subtest[BENCH_ROUNDS];
+      double pass[BENCH_ROUNDS];
+      double intcheck[BENCH_ROUNDS];
+      double buffer[BENCH_ROUNDS];
+      int count = bench_count(BENCH_CALLS);
+      int buffers = bench_count(BENCH_CALLS / 16);
+      int r;
+      for (r = 0; r < BENCH_ROUNDS; ++r)
+      {
+         xpccut_ticks_t start = xpccut_get_ticks();
+         int i;
+         for (i = 0; i < count; ++i)
+         {
+            (void) unit_test_status_initialize
+            (
+               &status, &options, 1, 1, "bench", "status"
+            );
+         }
+         init[r] = bench_elapsed_ns(start) / count;
+
+         start = xpccut_get_ticks();
+         for (i = 0; i < count; ++i)
+            (void) unit_test_status_next_subtest(&status, "sub-test");
+
+         subtest[r] = bench_elapsed_ns(start) / count;
+
+         start = xpccut_get_ticks();
+         for (i = 0; i < count; ++i)
+            (void) unit_test_status_pass(&status, true);
+
+         pass[r] = bench_elapsed_ns(start) / count;
+
+         start = xpccut_get_ticks();
+         for (i = 0; i < count; ++i)
+            (void) unit_test_status_int_check(&status, i, i);
+
+         intcheck[r] = bench_elapsed_ns(start) / count;
+
+         start = xpccut_get_ticks();
+         for (i = 0; i < buffers; ++i)
+         {
+            (void) unit_test_status_buffer_check
+            (
+               &status, s_expected, s_actual, BENCH_BUFFER_SIZE
+            );
+         }
+         buffer[r] = bench_elapsed_ns(start) / buffers;
+      }
+      bench_report("status_initialize", "ns", (long) count, init);
+      bench_report("per_subtest", "ns", (long) count, subtest);
+      bench_report("check_pass", "ns", (long) count, pass);
+      bench_report("check_int", "ns", (long) count, intcheck);
+      bench_report("check_buffer_4k", "ns", (long) buffers, buffer);
+      result = unit_test_status_passed(&status);
+   }
+   else
+      fprintf(stderr, "? %s\n", "the status could not be set up");
+
+   return result;
+}
+
+/**
+ *    Measures the throughput of xpccut_fuzz(), with and without the
+ *    XPCCUT_FF_BULK flag, and of xpccut_random().
+ *
+ * \return
+ *    Returns 'true' if the buffer could be allocated.
+ */
+
+static cbool_t
+bench_fuzz (void)
+{
+   char * buffer = malloc(BENCH_FUZZ_SIZE + 1);
+   cbool_t result = cut_not_nullptr(buffer);
+   if (result)
+   {
+      double plain[BENCH_ROUNDS];
+      double bulk[BENCH_ROUNDS];
+      double randoms[BENCH_ROUNDS];
+      int strings = bench_count(BENCH_FUZZ_COUNT);
+      int count = bench_count(BENCH_CALLS);
+      double megabytes = (double) strings * BENCH_FUZZ_SIZE / 1000000.0;
+      int r;
+      for (r = 0; r < BENCH_ROUNDS; ++r)
+      {
+         int pass;
+         for (pass = 0; pass < 2; ++pass)
+         {
+            xpccut_fuzz_flags_t flags = pass == 0 ?
+               XPCCUT_FF_DEFAULT : XPCCUT_FF_BULK ;
+
+            xpccut_ticks_t start = xpccut_get_ticks();
+            double seconds;
+            int i;
+            for (i = 0; i < strings; ++i)
+            {
+               gs_sink += xpccut_fuzz
+               (
+                  buffer, BENCH_FUZZ_SIZE + 1, BENCH_FUZZ_SIZE,
+                  (unsigned int) (i + 1), flags,
+                  nullptr, nullptr, nullptr, nullptr
+               );
+            }
+            seconds = bench_elapsed_ns(start) / 1.0e9;
+            if (pass == 0)
+               plain[r] = megabytes / seconds;
+            else
+               bulk[r] = megabytes / seconds;
+         }
+         {
+            xpccut_ticks_t start = xpccut_get_ticks();
+            unsigned long sum = 0;
+            int i;
+            for (i = 0; i < count; ++i)
+               sum += xpccut_random();
+
+            randoms[r] = bench_elapsed_ns(start) / count;
+            gs_sink += sum;
+         }
+      }
+      bench_report("fuzz", "MB/s", (long) strings * BENCH_FUZZ_SIZE, plain);
+      bench_report
+      (
+         "fuzz_bulk", "MB/s", (long) strings * BENCH_FUZZ_SIZE, bulk
+      );
+      bench_report("random", "ns", (long) count, randoms);
+      free(buffer);
+   }
+   return result;
+}
+
+/**
+ *    Measures the cost of reading the clock, and the resolution of the
+ *    clock and of the stopwatch: the smallest step that either can show.
+ *
+ * \return
+ *    Returns 'true' if the stopwatch could be used.
+ */
+
+static cbool_t
+bench_clock (void)
+{
+   cbool_t result = true;
+   double cost[BENCH_ROUNDS];
+   double ticks[BENCH_ROUNDS];
+   double stopwatch[BENCH_ROUNDS];
+   int count = bench_count(BENCH_CALLS);
+   int r;
+   for (r = 0; result && r < BENCH_ROUNDS; ++r)
+   {
+      xpccut_ticks_t start = xpccut_get_ticks();
+      xpccut_ticks_t last = start;
+      xpccut_ticks_t step = 0;
+      xpccut_stopwatch_t sw;
+      int i;
+      for (i = 0; i < count; ++i)
+      {
+         xpccut_ticks_t now = xpccut_get_ticks();
+         if (now > last && (step == 0 || now - last < step))
+            step = now - last;
+
+         last = now;
+      }
+      cost[r] = (double) (last - start) / count;
+      ticks[r] = (double) step;
+
+      result = xpccut_stopwatch_init(&sw) && xpccut_stopwatch_begin(&sw);
+      if (result)
+      {
+         double ms = 0.0;
+         for (i = 0; ms <= 0.0 && i < count; ++i)
+            ms = xpccut_stopwatch_elapsed(&sw);
+
+         stopwatch[r] = ms * 1.0e6;
+      }
+   }
+   if (result)
+   {
+      bench_report("clock_read", "ns", (long) count, cost);
+      bench_report("clock_resolution", "ns", (long) count, ticks);
+      bench_report("stopwatch_resolution", "ns", (long) count, stopwatch);
+   }
+   else
+      fprintf(stderr, "? %s\n", "the stopwatch could not be started");
+
+   return result;
+}
+
+/**
+ *    This is the main routine for the unit_test_bench application.
+ *
+ * \return
+ *    Returns EXIT_SUCCESS if every measurement could be taken.
+ */
+
+int
+main
+(
+   int argc,               /**< Number of command-line arguments.             */
+   char * argv []          /**< The actual array of command-line arguments.   */
+)
+{
+   cbool_t ok = true;
+   int i;
+   gs_results = stdout;
+   for (i = 1; ok && i < argc; ++i)
+   {
+      if (strcmp(argv[i], "--quick") == 0)
+         gs_divisor = 10;
+      else if (strcmp(argv[i], "--output") == 0 && (i + 1) < argc)
+      {
+         gs_results = fopen(argv[++i], "w");
+         ok = cut_not_nullptr(gs_results);
+         if (! ok)
+            fprintf(stderr, "? %s '%s'\n", "cannot open", argv[i]);
+      }
+      else
+      {
+         fprintf(stderr, "Usage: %s [--quick] [--output file]\n", argv[0]);
+         ok = false;
+      }
+   }
+   if (ok)
+      ok = bench_per_test();
+
+   if (ok)
+      ok = bench_per_check();
+
+   if (ok)
+      ok = bench_fuzz();
+
+   if (ok)
+      ok = bench_clock();
+
+   if (cut_not_nullptr(gs_results) && gs_results != stdout)
+      fclose(gs_results);
+
+   return ok ? EXIT_SUCCESS : EXIT_FAILURE ;
+}
+
+/*
+ * unit_test_bench.c
+ *
+ * vim: ts=3 sw=3 et ft=c
+ */
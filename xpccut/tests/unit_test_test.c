@@ -58,6 +58,9 @@
  */
 
 #include <xpc/fuzz.h>                  /* functions for creating fuzz strings */
+#include <xpc/fuzz_campaign.h>         /* xpccut_campaign_t, etc.             */
+#include <xpc/fuzz_corpus.h>           /* xpccut_corpus_t, etc.               */
+#include <xpc/guided_fuzz.h>           /* coverage-guided fuzzing functions   */
 #include <xpc/unit_test.h>             /* unit_test_t structure               */
 
 #ifdef USE_XPCCUT_NULLPTR_TEST
@@ -68,6 +71,16 @@
 #include <limits.h>                    /* UINT_MAX                            */
 #endif
 
+#include <stddef.h>                    /* offsetof()                          */
+
+#if XPC_HAVE_STDLIB_H
+#include <stdlib.h>                    /* malloc(), free()                    */
+#endif
+
+#if XPC_HAVE_UNISTD_H
+#include <unistd.h>                    /* getpid()                            */
+#endif
+
 /*
  *    This function is deprecated, but we'll keep it around for awhile
  *    and give it its due testing.
@@ -129,6 +142,56 @@ static cbool_t g_do_dump_text = false;
 
 static int g_BOGUS_TEST_NUMBER = 999;
 
+/**
+ *    Provides the size of the names made by test_file_name().
+ */
+
+#define TEST_FILE_NAME_SIZE      64
+
+/**
+ *    Counts the names made by test_file_name().
+ */
+
+static unsigned gs_test_file_count = 0;
+
+/**
+ *    Makes the name of a scratch file or directory for one run of a test,
+ *    from \a base, the process ID, and a count.  The tests run in a --jobs
+ *    pool, and the rounds of --repeat can overlap, so two runs of the same
+ *    test (in threads or in --isolate children) must not share a file.
+ *
+ * \param [out] name
+ *    Receives the name.  It must hold TEST_FILE_NAME_SIZE characters.
+ *
+ * \param base
+ *    The first part of the name, such as "unit_test_04_31".
+ *
+ * \param extension
+ *    The end of the name, such as ".hist".
+ *
+ * \return
+ *    Returns \a name, for convenience.
+ */
+
+static char *
+test_file_name (char * name, const char * base, const char * extension)
+{
+   long pid = 0;
+#if defined __GNUC__
+   unsigned count = __sync_fetch_and_add(&gs_test_file_count, 1);
+#else
+   unsigned count = gs_test_file_count++;
+#endif
+#if XPC_HAVE_UNISTD_H
+   pid = (long) getpid();
+#endif
+   (void) snprintf
+   (
+      name, TEST_FILE_NAME_SIZE, "%s-%ld-%u%s", base, pid, count, extension
+   );
+   return name;
+}
+
 /**
  *    Provides an internal helper function to show a message indicating that
  *    the failure was deliberate.
@@ -144,7 +207,7 @@ show_deliberate_failure
 )
 {
    if (unit_test_options_show_progress(options) && ! xpccut_is_silent())
-      fprintf(stdout, "! %s\n", _("This FAILURE is deliberate."));
+      xpccut_print("! %s\n", _("This FAILURE is deliberate."));
 }
 
 /**
@@ -194,7 +257,7 @@ unit_unit_test_01_01 (const unit_test_options_t * options)
       else
       {
          if (unit_test_options_show_values(options))
-            fprintf(stdout, "  %s\n", _("No values to show in this test"));
+            xpccut_print("  %s\n", _("No values to show in this test"));
 
          /*  1 */
 
@@ -211,9 +274,9 @@ unit_unit_test_01_01 (const unit_test_options_t * options)
                (void) unit_test_status_fail(&status);    /* create a failure  */
                if (unit_test_options_is_verbose(options))
                {
-                  fprintf
+                  xpccut_print_error
                   (
-                     stderr, "%s %s\n",
+                     "%s %s\n",
                      "unit_test_status_pass()", _("internal failure")
                   );
                }
@@ -248,7 +311,7 @@ unit_unit_test_01_01 (const unit_test_options_t * options)
              * Now part of unit_test_status_failure()
              *
              *   if (unit_test_options_is_verbose(options))
-             *      fprintf(stdout, "! %s\n", _("This FAILURE is deliberate."));
+             *      xpccut_print("! %s\n", _("This FAILURE is deliberate."));
              */
 
             if (ok)
@@ -680,7 +743,7 @@ unit_unit_test_02_02 (const unit_test_options_t * options)
             nullptr, options, 0, 0, "xxx", "yyy"
          );
          if (unit_test_options_is_verbose(options))
-            fprintf(stdout, _("This test number is simulated"));
+            xpccut_print(_("This test number is simulated"));
 
          ok = unit_test_status_initialize
          (
@@ -944,9 +1007,9 @@ unit_unit_test_02_02 (const unit_test_options_t * options)
          ok = x_status_x.m_Test_Duration_ms == 0.0;
          if (! ok)
          {
-            fprintf
+            xpccut_print
             (
-               stdout, "  m_Test_Duration = %f\n", x_status_x.m_Test_Duration_ms
+               "  m_Test_Duration = %f\n", x_status_x.m_Test_Duration_ms
             );
          }
          unit_test_status_pass(&status, ok);
@@ -1289,9 +1352,8 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
 
          if (! ok && unit_test_options_is_verbose(options))
          {
-            fprintf
+            xpccut_print
             (
-               stdout,
                "\n"
                "? Bad times:\n"
                "\n"
@@ -1385,9 +1447,9 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
             }
             if (unit_test_options_is_verbose(options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  Duration: nominal = 50 ms, actual = %f ms\n", d
+                  "  Duration: nominal = 50 ms, actual = %f ms\n", d
                );
             }
          }
@@ -1428,9 +1490,9 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
 
             if (unit_test_options_is_verbose(options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  Duration: nominal = 25 ms, actual = %f ms\n", d
+                  "  Duration: nominal = 25 ms, actual = %f ms\n", d
                );
             }
          }
@@ -1465,9 +1527,9 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
 
             if (unit_test_options_is_verbose(options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  Duration: nominal = 10 ms, actual = %f ms\n", d
+                  "  Duration: nominal = 10 ms, actual = %f ms\n", d
                );
             }
          }
@@ -1502,9 +1564,9 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
 
             if (unit_test_options_is_verbose(options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  Duration: nominal = 5 ms, actual = %f ms\n", d
+                  "  Duration: nominal = 5 ms, actual = %f ms\n", d
                );
             }
          }
@@ -1539,9 +1601,9 @@ unit_unit_test_02_05 (const unit_test_options_t * options)
 
             if (unit_test_options_is_verbose(options))
             {
-               fprintf
+               xpccut_print
                (
-                  stdout, "  Duration: nominal = 1 ms, actual = %f ms\n", d
+                  "  Duration: nominal = 1 ms, actual = %f ms\n", d
                );
             }
          }
@@ -2125,7 +2187,7 @@ unit_unit_test_02_10 (const unit_test_options_t * options)
    if (ok)
    {
       if (unit_test_options_show_progress(options))
-         fprintf(stdout, "  %s\n", _("This test plays a beep if interactive."));
+         xpccut_print("  %s\n", _("This test plays a beep if interactive."));
 
       /*  1 */
 
@@ -2219,14 +2281,8 @@ unit_unit_test_02_11 (const unit_test_options_t * options)
          ok = unit_test_status_init(&x_status_x);
          if (ok)
          {
-            /*
-             * \todo
-             *    Instead of using strcpy(), we could use
-             *    xpccut_stringcopy() and also test that function.
-             */
-
             const char * group;
-            (void) strcpy(x_status_x.m_Group_Name, "locacion privato");
+            x_status_x.m_Group_Name = xpccut_intern("locacion privato");
             group = unit_test_status_group_name(&x_status_x);
             ok = cut_not_nullptr(group);
             if (ok)
@@ -2298,7 +2354,7 @@ unit_unit_test_02_12 (const unit_test_options_t * options)
          if (ok)
          {
             const char * kase;
-            (void) strcpy(x_status_x.m_Case_Description, "locacion privato");
+            x_status_x.m_Case_Description = xpccut_intern("locacion privato");
             kase = unit_test_status_case_name(&x_status_x);
             ok = cut_not_nullptr(kase);
             if (ok)
@@ -2370,7 +2426,7 @@ unit_unit_test_02_13 (const unit_test_options_t * options)
          if (ok)
          {
             const char * subtest;
-            (void) strcpy(x_status_x.m_Subtest_Name, "locacion privato");
+            x_status_x.m_Subtest_Name = xpccut_intern("locacion privato");
             subtest = unit_test_status_subtest_name(&x_status_x);
             ok = cut_not_nullptr(subtest);
             if (ok)
@@ -4287,18 +4343,24 @@ unit_unit_test_02_31 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the basic
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
+ *    Provides the name of the baseline file written by
+ *    unit_unit_test_02_32().
+ */
+
+#define PERF_BASELINE_FILE       "unit_test_02_32.base"
+
+/**
+ *    Provides a unit/regression test to verify the checking of performance
+ *    measurements against a baseline.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    1. unit_test_options_init()
+ *   32. unit_test_status_perf_check()
  *
  * \test
- *    -  unit_test_options_init()
+ *    -  unit_test_status_perf_check()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -4308,311 +4370,384 @@ unit_unit_test_02_31 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_01 (const unit_test_options_t * options)
+unit_unit_test_02_32 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 1,
-      "unit_test_options_t", "unit_test_options_init()"
+      &status, options, 2, 32,
+      "unit_test_status_t", "unit_test_status_perf_check()"
    );
    if (ok)
    {
+      static const unit_test_baseline_t s_baseline[4] =
+      {
+         { 99, 99, 100.0,  0.0, "steady" },
+         { 99, 99, 100.0, 20.0, "noisy"  },
+         { 99, 99, 100.0,  0.0, "twice"  },
+         { 99, 99, 1000.0, 0.0, "twice"  }
+      };
+      unit_test_status_t x_status_x;
       unit_test_options_t x_options_x;
       ok = unit_test_options_init(&x_options_x);
-
-      /*
-       * This setting ensures that the user will see "Simulated TEST",
-       * rather than be confused by seeing bogus-looking "TEST" numbers.
-       */
-
       if (ok)
          ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
+      if (ok)
+      {
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 99, 99, "x_status_x", _("internal test")
+         );
+      }
+
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         cbool_t null_ok = ! unit_test_options_init(nullptr);
+         cbool_t null_ok;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! unit_test_status_perf_check(nullptr, "x", 1.0, 0.0);
+         if (null_ok && ok)
+         {
+            null_ok = ! unit_test_status_perf_check
+            (
+               &x_status_x, nullptr, 1.0, 0.0
+            );
+         }
+         if (! silent)
+            xpccut_allow_printing();
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "No baseline"))
       {
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "steady", 1e9, 0.0);
+
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
+      if (unit_test_status_next_subtest(&status, "Within the tolerance"))
       {
-         /*
-          * Let's use the recent addition to our unit-test armaments:
-          *
-          * ok = x_options_x.m_Is_Verbose == XPCCUT_IS_VERBOSE;
-          * unit_test_status_pass(&status, ok);
-          */
+         if (ok)
+            ok = unit_test_options_baseline_set(&x_options_x, s_baseline, 4);
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Is_Verbose, XPCCUT_IS_VERBOSE
-         );
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "steady", 50.0, 0.0);
+
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "steady", 125.0, 0.0);
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
+      if (unit_test_status_next_subtest(&status, "Beyond the tolerance"))
       {
-         /*
-          * ok = x_options_x.m_Show_Values == XPCCUT_SHOW_VALUES;
-          * unit_test_status_pass(&status, ok);
-          */
-
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Show_Values, XPCCUT_SHOW_VALUES
-         );
+         if (ok)
+         {
+            ok = ! unit_test_status_perf_check
+            (
+               &x_status_x, "steady", 126.0, 0.0
+            );
+            show_deliberate_failure(options);
+         }
+         unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      if (unit_test_status_next_subtest(&status, "Within the noise"))
       {
          /*
-          * ok = x_options_x.m_Text_Synch == XPCCUT_TEXT_SYNCH;
-          * unit_test_status_pass(&status, ok);
+          * The noise limit is 3 * sqrt(20^2 + 20^2), about 84.85.
           */
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Text_Synch, XPCCUT_TEXT_SYNCH
-         );
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "noisy", 184.0, 20.0);
+
+         if (ok)
+         {
+            ok = ! unit_test_status_perf_check
+            (
+               &x_status_x, "noisy", 186.0, 20.0
+            );
+            show_deliberate_failure(options);
+         }
+         unit_test_status_pass(&status, ok);
       }
 
       /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
+      if (unit_test_status_next_subtest(&status, "Last duplicate is used"))
       {
-         /*
-          * ok = x_options_x.m_Show_Step_Numbers == XPCCUT_SHOW_STEP_NUMBERS;
-          * unit_test_status_pass(&status, ok);
-          */
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "twice", 500.0, 0.0);
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Show_Step_Numbers, XPCCUT_SHOW_STEP_NUMBERS
-         );
+         unit_test_status_pass(&status, ok);
       }
 
       /*  7 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
+      if (unit_test_status_next_subtest(&status, "Writing the baseline"))
       {
-         /*
-          * ok = x_options_x.m_Show_Progress == XPCCUT_SHOW_PROGRESS;
-          * unit_test_status_pass(&status, ok);
-          */
+         (void) remove(PERF_BASELINE_FILE);
+         if (ok)
+         {
+            ok = unit_test_options_write_baseline_file_set
+            (
+               &x_options_x, PERF_BASELINE_FILE
+            );
+         }
+         if (ok)
+            ok = unit_test_status_perf_check(&x_status_x, "new one", 7.5, 0.25);
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Show_Progress, XPCCUT_SHOW_PROGRESS
-         );
+         if (ok)
+         {
+            FILE * f = fopen(PERF_BASELINE_FILE, "r");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               char line[XPCCUT_STRLEN];
+               ok = cut_not_nullptr(fgets(line, (int) sizeof line, f));
+               if (ok)
+                  ok = strcmp(line, "99 99 7.500 0.250 new one\n") == 0;
+
+               fclose(f);
+            }
+         }
+         (void) remove(PERF_BASELINE_FILE);
+         unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /*  8 */
+/**
+ *    Provides a unit/regression test to verify the monotonic tick clock,
+ *    and that the timing of a test keeps the fraction of a millisecond.
+ *
+ * \group
+ *    2. unit_test_status_t functions.
+ *
+ * \case
+ *   33. Sub-millisecond timing.
+ *
+ * \test
+ *    -  xpccut_get_ticks()
+ *    -  xpccut_ticks_difference_ms()
+ *    -  xpccut_stopwatch_start()
+ *    -  xpccut_stopwatch_lap()
+ *    -  xpccut_stopwatch_duration()
+ *    -  unit_test_status_start_timer()
+ *    -  unit_test_status_time_delta()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
-      {
-         /*
-          * ok = x_options_x.m_Stop_On_Error == XPCCUT_STOP_ON_ERROR;
-          * unit_test_status_pass(&status, ok);
-          */
+static unit_test_status_t
+unit_unit_test_02_33 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 2, 33,
+      "unit_test_status_t", "Sub-millisecond timing"
+   );
+   if (ok)
+   {
+      unit_test_status_t x_status_x;
+      (void) unit_test_status_init(&x_status_x);   /* set up for sane usage   */
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Stop_On_Error, XPCCUT_STOP_ON_ERROR
-         );
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Ticks are monotonic"))
+      {
+         xpccut_ticks_t t1 = xpccut_get_ticks();
+         xpccut_ticks_t t2 = xpccut_get_ticks();
+         ok = t1 > 0 && t2 >= t1;
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  9 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
+      if (unit_test_status_next_subtest(&status, "Tick differences"))
       {
-         /*
-          * ok = x_options_x.m_Batch_Mode == XPCCUT_BATCH_MODE;
-          * unit_test_status_pass(&status, ok);
-          */
+         ok = xpccut_ticks_difference_ms(1000000, 3500000) == 2.5;
+         if (ok)
+            ok = xpccut_ticks_difference_ms(3500000, 1000000) == 0.0;
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Batch_Mode, XPCCUT_BATCH_MODE
-         );
+         if (ok)
+            ok = xpccut_ticks_difference_ms(1000000, 1000000) == 0.0;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 10 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Interactive"))
+      if (unit_test_status_next_subtest(&status, "Sub-millisecond delta"))
       {
-         /*
-          * ok = x_options_x.m_Interactive == XPCCUT_INTERACTIVE;
-          * unit_test_status_pass(&status, ok);
-          */
+         ok = unit_test_status_start_timer(&x_status_x);
+         if (ok)
+            ok = x_status_x.m_Start_Ticks > 0 && x_status_x.m_End_Ticks == 0;
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Interactive, XPCCUT_INTERACTIVE
-         );
+         if (ok)
+         {
+            double d;
+            xpccut_ticks_t wait = x_status_x.m_Start_Ticks + 200000;
+            while (xpccut_get_ticks() < wait)             /* spin for 0.2 ms */
+               ;
+
+            d = unit_test_status_time_delta(&x_status_x, false);  /* no reset */
+            ok = d >= 0.2 && x_status_x.m_Test_Duration_ms == d;
+            if (ok)
+               ok = x_status_x.m_End_Ticks >= wait;
+
+            if (unit_test_options_is_verbose(options))
+            {
+               xpccut_print
+               (
+                  "  Duration: nominal = 0.2 ms, actual = %f ms\n", d
+               );
+            }
+         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 11 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
+      if (unit_test_status_next_subtest(&status, "Delta with reset"))
       {
-         /*
-          * ok = x_options_x.m_Beep_Prompt == XPCCUT_BEEP;
-          * unit_test_status_pass(&status, ok);
-          */
+         ok = unit_test_status_time_delta(&x_status_x, true) > 0.0;
+         if (ok)
+            ok = x_status_x.m_Start_Ticks == x_status_x.m_End_Ticks;
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Beep_Prompt, XPCCUT_BEEP
-         );
-      }
-
-      /* 12 */
-
-      if (unit_test_status_next_subtest(&status, "m_Summarize"))
-      {
-         /*
-          * ok = x_options_x.m_Summarize == XPCCUT_SUMMARIZE;
-          * unit_test_status_pass(&status, ok);
-          */
-
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Summarize, XPCCUT_SUMMARIZE
-         );
-      }
-
-      /* 13 */
-
-      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
-      {
-         /*
-          * ok = x_options_x.m_Case_Pause == XPCCUT_CASE_PAUSE;
-          * unit_test_status_pass(&status, ok);
-          */
-
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Case_Pause, XPCCUT_CASE_PAUSE
-         );
-      }
-
-      /* 14 */
-
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
-      {
-         /*
-          * ok = x_options_x.m_Single_Test_Group == XPCCUT_NO_SINGLE_GROUP;
-          * unit_test_status_pass(&status, ok);
-          */
-
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Single_Test_Group, XPCCUT_NO_SINGLE_GROUP
-         );
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 15 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      if (unit_test_status_next_subtest(&status, "Delta without a start"))
       {
-         /*
-          * ok = x_options_x.m_Single_Test_Case == XPCCUT_NO_SINGLE_CASE;
-          * unit_test_status_pass(&status, ok);
-          */
+         cbool_t silent = xpccut_is_silent();
+         unit_test_status_t y_status_y;
+         (void) unit_test_status_init(&y_status_y);
+         xpccut_silence_printing();
+         ok = unit_test_status_time_delta(&y_status_y, false) == -1.0;
+         if (! silent)
+            xpccut_allow_printing();
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Single_Test_Case, XPCCUT_NO_SINGLE_CASE
-         );
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 16 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      if (unit_test_status_next_subtest(&status, "Stopwatch"))
       {
-         /*
-          * ok = x_options_x.m_Single_Sub_Test == XPCCUT_NO_SINGLE_SUB_TEST;
-          * unit_test_status_pass(&status, ok);
-          */
+         double lap, duration;
+         xpccut_ticks_t wait;
+         xpccut_stopwatch_start();
+         wait = xpccut_get_ticks() + 100000;
+         while (xpccut_get_ticks() < wait)                /* spin for 0.1 ms */
+            ;
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Single_Sub_Test, XPCCUT_NO_SINGLE_SUB_TEST
-         );
+         lap = xpccut_stopwatch_lap();
+         duration = xpccut_stopwatch_duration();
+         ok = lap >= 0.1 && duration >= lap;
+         unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /* 17 */
-
-      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
-      {
-         /*
-          * ok = x_options_x.m_Test_Sleep_Time == XPCCUT_TEST_SLEEP_TIME;
-          * unit_test_status_pass(&status, ok);
-          */
+/**
+ *    Indicates that unit_unit_test_02_34() can time stopwatches in two
+ *    threads at once.
+ */
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Test_Sleep_Time, XPCCUT_TEST_SLEEP_TIME
-         );
-         }
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define USE_STOPWATCH_THREADS 1
+#include <pthread.h>                   /* pthread_create(), pthread_join()    */
+#else
+#define USE_STOPWATCH_THREADS 0
+#endif
 
-      /* 18 */
+/**
+ *    Spins until the given number of ticks have passed since a stopwatch
+ *    was started, so that the expected time is known.
+ *
+ * \param sw
+ *    The stopwatch, already started.
+ *
+ * \param ticks
+ *    The number of ticks (nanoseconds) to spin for.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
-      {
-         /*
-          * ok = x_options_x.m_Need_Subtests == XPCCUT_NEED_SUBTESTS;
-          * unit_test_status_pass(&status, ok);
-          */
+static void
+stopwatch_spin (const xpccut_stopwatch_t * sw, xpccut_ticks_t ticks)
+{
+   xpccut_ticks_t wait = sw->m_Start_Ticks + ticks;
+   while (xpccut_get_ticks() < wait)
+      ;
+}
 
-         ok = unit_test_status_bool_check
-         (
-            &status, x_options_x.m_Need_Subtests, XPCCUT_NEED_SUBTESTS
-         );
-      }
+#if USE_STOPWATCH_THREADS
 
-      /* 19 */
+/**
+ *    Provides the thread function for unit_unit_test_02_34().  It times
+ *    the spinning of the thread with its own stopwatch, while the other
+ *    thread does the same.
+ *
+ * \param arg
+ *    Points to a double, which holds the spin time in milliseconds on
+ *    entry, and the measured time on exit.
+ *
+ * \return
+ *    Returns null.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
-      {
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Current_Test_Number,
-            XPCCUT_NO_CURRENT_TEST
-         );
-      }
-   }
-   return status;
+static void *
+stopwatch_thread (void * arg)
+{
+   double * ms = (double *) arg;
+   xpccut_stopwatch_t sw;
+   (void) xpccut_stopwatch_begin(&sw);
+   stopwatch_spin(&sw, (xpccut_ticks_t) (*ms * XPCCUT_TICKS_PER_MS));
+   *ms = xpccut_stopwatch_elapsed(&sw);
+   return nullptr;
 }
 
+#endif   /* USE_STOPWATCH_THREADS */
+
 /**
- *    Provides a unit/regression test to verify that the basic
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
+ *    Provides a unit/regression test to verify the re-entrant stopwatch
+ *    structure.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    2. unit_test_options_initialize()
+ *   34. xpccut_stopwatch_t
  *
  * \test
- *    -  unit_test_options_initialize()
+ *    -  xpccut_stopwatch_init()
+ *    -  xpccut_stopwatch_begin()
+ *    -  xpccut_stopwatch_elapsed()
+ *    -  xpccut_stopwatch_next_lap()
+ *    -  xpccut_stopwatch_lap_count()
+ *    -  xpccut_stopwatch_lap_ms()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -4622,294 +4757,357 @@ unit_unit_test_03_01 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_02 (const unit_test_options_t * options)
+unit_unit_test_02_34 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 2,
-      "unit_test_options_t", "unit_test_options_initialize()"
+      &status, options, 2, 34,
+      "unit_test_status_t", "xpccut_stopwatch_t"
    );
    if (ok)
    {
-      unit_test_options_t x_options_x;
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.
-       */
+      xpccut_stopwatch_t outer;
+      (void) xpccut_stopwatch_init(&outer);
 
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      /*  1 */
 
-      if (ok)
+      if (unit_test_status_next_subtest(&status, "Null 'this', stopwatch"))
       {
-         /**
-          * This test also modifies the options structure with the opposite
-          * values (or at least different values) for every accessible
-          * field, so that the resulting test is a bizarro-clone of test
-          * 03_01.
-          *
-          * \note
-          *    -  The unit_test_options_initialize() function does not
-          *       provide parameters for the single test group, case, and
-          *       sub-test names, the need-subtests option, the
-          *       force-failure option, the current-test number, the
-          *       response-before and response-after values, and the
-          *       is-simulated value.  It does set them all in a hard-wired
-          *       fashion, though.
-          *    -  It is important to realize that the settings made by
-          *       unit_test_options_initialize() can be a bit different
-          *       from the settings made by calling each of the setter
-          *       functions individually with the same values.  The reason
-          *       is that the following setters have side-effects on other
-          *       fields in the unit_test_options_t structure:
-          *       -  unit_test_options_batch_mode_set()
-          *       -  unit_test_options_show_progress_set()
-          *       -  unit_test_options_summary_set()
-          */
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();
+         ok = ! xpccut_stopwatch_init(nullptr);
+         if (ok)
+            ok = ! xpccut_stopwatch_begin(nullptr);
 
-         ok = unit_test_options_initialize
-         (
-            &x_options_x,
-            ! XPCCUT_IS_VERBOSE,          /* verbose           */
-            ! XPCCUT_SHOW_VALUES,         /* showvalues        */
-            ! XPCCUT_TEXT_SYNCH,          /* usetextsynch      */
-            ! XPCCUT_SHOW_STEP_NUMBERS,   /* showstepnumbers   */
-            ! XPCCUT_SHOW_PROGRESS,       /* showprogress      */
-            ! XPCCUT_STOP_ON_ERROR,       /* stoponerror       */
-            ! XPCCUT_BATCH_MODE,          /* batchmode         */
-            ! XPCCUT_INTERACTIVE,         /* interactive       */
-            ! XPCCUT_BEEP,                /* beeps             */
-            ! XPCCUT_SUMMARIZE,           /* summarize         */
-            ! XPCCUT_CASE_PAUSE,          /* casepause         */
-            XPCCUT_NO_SINGLE_GROUP+1,     /* singlegroup       */
-            XPCCUT_NO_SINGLE_CASE+2,      /* singlecase        */
-            XPCCUT_NO_SINGLE_SUB_TEST+3,  /* singlesubtest     */
-            XPCCUT_TEST_SLEEP_TIME+4      /* testsleeptime     */
-         );
-      }
+         if (ok)
+            ok = xpccut_stopwatch_elapsed(nullptr) == 0.0;
 
-      /*  1 */
+         if (ok)
+            ok = xpccut_stopwatch_next_lap(nullptr) == 0.0;
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
-      {
-         cbool_t null_ok = ! unit_test_options_initialize
-         (
-            nullptr,
-            false, false, false, false, false, false,
-            false, false, false, false, false,
-            0, 0, 0, 0
-         );
-         unit_test_status_pass(&status, null_ok);
+         if (ok)
+            ok = xpccut_stopwatch_lap_count(nullptr) == 0;
+
+         if (ok)
+            ok = xpccut_stopwatch_lap_ms(nullptr, 0) == -1.0;
+
+         if (! silent)
+            xpccut_allow_printing();
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "Not started"))
       {
+         ok = xpccut_stopwatch_elapsed(&outer) == 0.0;
+         if (ok)
+            ok = xpccut_stopwatch_next_lap(&outer) == 0.0;
+
+         if (ok)
+            ok = xpccut_stopwatch_lap_count(&outer) == 0;
+
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
+      if (unit_test_status_next_subtest(&status, "Nested stopwatches"))
       {
-         /*
-          * Rather than use the recent unit_test_status_bool_check()
-          * function, like we did in 03_01 above, we'll leave these tests as
-          * they are.  This shows another way to do the checks, for more
-          * general comparisons or tests.
-          */
-
-         ok = x_options_x.m_Is_Verbose != XPCCUT_IS_VERBOSE;
+         xpccut_stopwatch_t inner;
+         double inner_ms, outer_ms;
+         ok = xpccut_stopwatch_begin(&outer);
+         if (ok)
+         {
+            stopwatch_spin(&outer, 100000);
+            ok = xpccut_stopwatch_begin(&inner);
+         }
+         if (ok)
+         {
+            stopwatch_spin(&inner, 200000);
+            inner_ms = xpccut_stopwatch_elapsed(&inner);
+            outer_ms = xpccut_stopwatch_elapsed(&outer);
+            ok = inner_ms >= 0.2 && outer_ms >= inner_ms + 0.1;
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
+      if (unit_test_status_next_subtest(&status, "Lap history"))
       {
-         ok = x_options_x.m_Show_Values != XPCCUT_SHOW_VALUES;
-         unit_test_status_pass(&status, ok);
-      }
+         int lap;
+         double total = 0.0;
+         ok = xpccut_stopwatch_begin(&outer);
+         for (lap = 0; ok && lap < XPCCUT_STOPWATCH_LAPS + 4; ++lap)
+            total += xpccut_stopwatch_next_lap(&outer);
 
-      /*  5 */
+         if (ok)
+            ok = xpccut_stopwatch_lap_count(&outer) == lap;
 
-      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
-      {
-         ok = x_options_x.m_Text_Synch != XPCCUT_TEXT_SYNCH;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = xpccut_stopwatch_elapsed(&outer) >= total;
 
-      /*  6 */
+         if (ok)
+            ok = xpccut_stopwatch_lap_ms(&outer, 3) == -1.0;   /* dropped   */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
-      {
-         ok = x_options_x.m_Show_Step_Numbers != XPCCUT_SHOW_STEP_NUMBERS;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = xpccut_stopwatch_lap_ms(&outer, 4) >= 0.0;    /* the oldest */
 
-      /*  7 */
+         if (ok)
+            ok = xpccut_stopwatch_lap_ms(&outer, lap - 1) >= 0.0;
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
-      {
-         ok = x_options_x.m_Show_Progress != XPCCUT_SHOW_PROGRESS;
+         if (ok)
+            ok = xpccut_stopwatch_lap_ms(&outer, lap) == -1.0; /* not taken */
+
+         if (ok)
+         {
+            (void) xpccut_stopwatch_begin(&outer);             /* restart   */
+            ok = xpccut_stopwatch_lap_count(&outer) == 0;
+         }
          unit_test_status_pass(&status, ok);
       }
 
-      /*  8 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
+      if (unit_test_status_next_subtest(&status, "Concurrent stopwatches"))
       {
-         ok = x_options_x.m_Stop_On_Error != XPCCUT_STOP_ON_ERROR;
+#if USE_STOPWATCH_THREADS
+         pthread_t t1, t2;
+         double ms_1 = 0.5;
+         double ms_2 = 0.3;
+         ok = pthread_create(&t1, nullptr, stopwatch_thread, &ms_1) == 0;
+         if (ok)
+         {
+            ok = pthread_create(&t2, nullptr, stopwatch_thread, &ms_2) == 0;
+            if (ok)
+               (void) pthread_join(t2, nullptr);
+
+            (void) pthread_join(t1, nullptr);
+         }
+         if (ok)
+            ok = ms_1 >= 0.5 && ms_2 >= 0.3;
+#endif
          unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /*  9 */
+/**
+ *    Provides a unit/regression test to verify the measurement of the
+ *    resources used by a test, for the --profile option.
+ *
+ * \group
+ *    2. unit_test_status_t functions.
+ *
+ * \case
+ *   35. Resource profiling.
+ *
+ * \test
+ *    -  xpccut_get_resources()
+ *    -  xpccut_resources_difference()
+ *    -  unit_test_status_resources()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
-      {
-         ok = x_options_x.m_Batch_Mode != XPCCUT_BATCH_MODE;
-         unit_test_status_pass(&status, ok);
-      }
+static unit_test_status_t
+unit_unit_test_02_35 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 2, 35,
+      "unit_test_status_t", "Resource profiling"
+   );
+   if (ok)
+   {
+      unit_test_status_t x_status_x;
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
 
-      /* 10 */
+      /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "m_Interactive"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         ok = x_options_x.m_Interactive != XPCCUT_INTERACTIVE;
-         unit_test_status_pass(&status, ok);
-      }
+         cbool_t null_ok;
+         xpccut_resources_t r;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! xpccut_get_resources(nullptr);
+         if (null_ok)
+            null_ok = ! xpccut_resources_difference(nullptr, &r, &r);
 
-      /* 11 */
+         if (null_ok)
+            null_ok = ! xpccut_resources_difference(&r, &r, nullptr);
 
-      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
-      {
-         ok = x_options_x.m_Beep_Prompt != XPCCUT_BEEP;
-         unit_test_status_pass(&status, ok);
-      }
+         if (null_ok)
+            null_ok = unit_test_status_resources(nullptr) == nullptr;
 
-      /* 12 */
+         if (! silent)
+            xpccut_allow_printing();
 
-      if (unit_test_status_next_subtest(&status, "m_Summarize"))
-      {
-         ok = x_options_x.m_Summarize != XPCCUT_SUMMARIZE;
-         unit_test_status_pass(&status, ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
-      /* 13 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
+      if (unit_test_status_next_subtest(&status, "Resource difference"))
       {
-         ok = x_options_x.m_Case_Pause != XPCCUT_CASE_PAUSE;
-         unit_test_status_pass(&status, ok);
-      }
+         xpccut_resources_t r1, r2, delta;
+         r1.m_User_ms = 1.0;
+         r1.m_System_ms = 2.0;
+         r1.m_Max_RSS_kb = 100;
+         r1.m_Minor_Faults = 10;
+         r1.m_Major_Faults = 1;
+         r1.m_Voluntary_Switches = 3;
+         r1.m_Involuntary_Switches = 4;
+         r2 = r1;
+         r2.m_User_ms = 1.5;
+         r2.m_Max_RSS_kb = 164;
+         r2.m_Minor_Faults = 17;
+         r2.m_Involuntary_Switches = 9;
+         ok = xpccut_resources_difference(&r1, &r2, &delta);
+         if (ok)
+            ok = delta.m_User_ms == 0.5 && delta.m_System_ms == 0.0;
 
-      /* 14 */
+         if (ok)
+            ok = delta.m_Max_RSS_kb == 64 && delta.m_Minor_Faults == 7;
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
-      {
-         /*
-          * Let's use the recent addition to our unit-test armaments for
-          * these integer checks.
-          *
-          * ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
-          * unit_test_status_pass(&status, ok);
-          */
+         if (ok)
+            ok = delta.m_Major_Faults == 0 && delta.m_Voluntary_Switches == 0;
 
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Single_Test_Group, XPCCUT_NO_SINGLE_GROUP+1
-         );
+         if (ok)
+            ok = delta.m_Involuntary_Switches == 5;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 15 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      if (unit_test_status_next_subtest(&status, "Sampling is monotonic"))
       {
-         /*
-          * ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
-          * unit_test_status_pass(&status, ok);
-          */
+         xpccut_resources_t r1, r2;
+         ok = xpccut_get_resources(&r1);
+         if (ok)
+         {
+            xpccut_ticks_t wait = xpccut_get_ticks() + 2000000;
+            while (xpccut_get_ticks() < wait)            /* burn 2 ms of CPU */
+               ;
 
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Single_Test_Case, XPCCUT_NO_SINGLE_CASE+2
-         );
+            ok = xpccut_get_resources(&r2);
+         }
+         if (ok)
+         {
+            ok = r2.m_User_ms + r2.m_System_ms >= r1.m_User_ms + r1.m_System_ms;
+            if (ok)
+               ok = r2.m_Minor_Faults >= r1.m_Minor_Faults;
+
+            if (ok)
+               ok = r2.m_Max_RSS_kb >= r1.m_Max_RSS_kb;
+         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 16 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      if (unit_test_status_next_subtest(&status, "Not profiled"))
       {
-         /*
-          * ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
-          * unit_test_status_pass(&status, ok);
-          */
+         if (ok)
+         {
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 99, 99, "x_status_x", "internal"
+            );
+         }
+         if (ok)
+            ok = unit_test_status_time_delta(&x_status_x, false) >= 0.0;
 
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Single_Sub_Test, XPCCUT_NO_SINGLE_SUB_TEST+3
-         );
+         if (ok)
+            ok = unit_test_status_resources(&x_status_x) == nullptr;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /* 17 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
+      if (unit_test_status_next_subtest(&status, "Profiled"))
       {
-         /*
-          * ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
-          * unit_test_status_pass(&status, ok);
-          */
+         if (ok)
+            ok = unit_test_options_is_profiled_set(&x_options_x, true);
 
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Test_Sleep_Time, XPCCUT_TEST_SLEEP_TIME+4
-         );
-      }
+         if (ok)
+         {
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 99, 99, "x_status_x", "internal"
+            );
+         }
+         if (ok)
+         {
+            xpccut_ticks_t wait = xpccut_get_ticks() + 1000000;
+            while (xpccut_get_ticks() < wait)            /* burn 1 ms of CPU */
+               ;
 
-      /* 18 */
+            ok = unit_test_status_time_delta(&x_status_x, false) >= 1.0;
+         }
+         if (ok)
+         {
+            const xpccut_resources_t * r =
+               unit_test_status_resources(&x_status_x);
 
-      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
-      {
-         ok = x_options_x.m_Need_Subtests == XPCCUT_NEED_SUBTESTS;
-         unit_test_status_pass(&status, ok);
-      }
+            ok = cut_not_nullptr(r);
+            if (ok)
+               ok = r->m_User_ms >= 0.0 && r->m_System_ms >= 0.0;
 
-      /* 19 */
+            if (ok)
+               ok = r->m_Minor_Faults >= 0 && r->m_Max_RSS_kb >= 0;
 
-      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
-      {
-         ok = unit_test_status_int_check
-         (
-            &status, x_options_x.m_Current_Test_Number,
-            XPCCUT_NO_CURRENT_TEST
-         );
+            if (ok && unit_test_options_is_verbose(options))
+            {
+               xpccut_print
+               (
+                  "  CPU: %.3f ms user, %.3f ms system\n",
+                  r->m_User_ms, r->m_System_ms
+               );
+            }
+         }
+         unit_test_status_pass(&status, ok);
       }
    }
    return status;
 }
 
 /**
- *    Provides a constant for allocation simulated command-line arguments.
- */
-
-#define FULL_ARG_COUNT           24
-
-/**
- *    Provides a unit/regression test to verify that the parse functionality
- *    handles turning off the options.
+ *    Provides a unit/regression test to verify the reading of the hardware
+ *    counters, for the --perf-counters option.  Where the counters are not
+ *    available (for example, on a virtual machine, or when the kernel's
+ *    perf_event_paranoid setting forbids them), the readings must fail
+ *    quietly, and the tests must run as usual, without counts.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    3. unit_test_options_parse(), part 1.
+ *   36. Hardware counters.
  *
  * \test
- *    -  unit_test_options_parse()
+ *    -  xpccut_perf_available()
+ *    -  xpccut_perf_read()
+ *    -  xpccut_perf_difference()
+ *    -  xpccut_perf_release()
+ *    -  xpccut_perf_counter_name()
+ *    -  xpccut_perf_show()
+ *    -  unit_test_status_counters()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -4919,266 +5117,284 @@ unit_unit_test_03_02 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_03 (const unit_test_options_t * options)
+unit_unit_test_02_36 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 3,
-      "unit_test_options_t", "unit_test_options_parse() part 1"
+      &status, options, 2, 36,
+      "unit_test_status_t", "Hardware counters"
    );
    if (ok)
    {
+      unit_test_status_t x_status_x;
       unit_test_options_t x_options_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* 1 more than last index  */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.
-       */
-
+      cbool_t available = xpccut_perf_available();
       ok = unit_test_options_init(&x_options_x);
       if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
 
-      if (ok)
+      if (ok && unit_test_options_is_verbose(options))
       {
-         /*
-          * Now modify the options structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          */
-
-         argv[0]  = "unit_test_test";              /* application name        */
-         argv[1]  = "--no-verbose";
-         argv[2]  = "--no-show-progress";          /* "--no-silent"           */
-         argv[3]  = "--no-show-values";
-         argv[4]  = "--no-show-step-numbers";
-         argv[5]  = "--no-text-synch";
-         argv[6]  = "--no-stop-on-error";
-         argv[7]  = "--no-batch-mode";
-         argv[8]  = "--no-interactive";
-         argv[9]  = "--no-beeps";
-         argv[10] = "--no-case-pause";
-         argv[11] = "--no-summarize";
-         argv[12] = "--group";
-         argv[13] = "1";
-         argv[14] = "--case";
-         argv[15] = "2";
-         argv[16] = "--sub-test";
-         argv[17] = "3";
-         argv[18] = "--sleep-time";
-         argv[19] = "4";
-         argv[20] = "--no-verbose";
-         argv[21] = "--no-verbose";
-         argc = 22;
-         ok = unit_test_options_parse
-         (
-            &x_options_x, argc, argv,
-            "Test 03.03", "version", "additionalhelp"
-         );
-      }
+         xpccut_print
+         (
+            "  %s\n", available ?
+               "Hardware counters are available." :
+               "Hardware counters are not available; counts are not checked."
+         );
+      }
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
-      {
-         cbool_t null_ok = ! unit_test_options_parse
-         (
-            nullptr, argc, argv,
-            "Test 03.03", "version", "additionalhelp"
-         );
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  2 */
-
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
-      {
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
-      {
-         ok = ! x_options_x.m_Is_Verbose;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
-
-      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
-      {
-         ok = ! x_options_x.m_Show_Values;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  5 */
-
-      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
-      {
-         ok = ! x_options_x.m_Text_Synch;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  6 */
-
-      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         ok = ! x_options_x.m_Show_Step_Numbers;
-         unit_test_status_pass(&status, ok);
-      }
+         cbool_t null_ok;
+         xpccut_perf_values_t v;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! xpccut_perf_read(nullptr);
+         if (null_ok)
+            null_ok = ! xpccut_perf_difference(nullptr, &v, &v);
 
-      /*  7 */
+         if (null_ok)
+            null_ok = ! xpccut_perf_difference(&v, &v, nullptr);
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
-      {
-         ok = ! x_options_x.m_Show_Progress;
-         unit_test_status_pass(&status, ok);
-      }
+         if (null_ok)
+            null_ok = unit_test_status_counters(nullptr) == nullptr;
 
-      /*  8 */
+         xpccut_perf_show(nullptr, nullptr, 1.0);      /* must not crash    */
+         if (! silent)
+            xpccut_allow_printing();
 
-      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
-      {
-         ok = ! x_options_x.m_Stop_On_Error;
-         unit_test_status_pass(&status, ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
-      /*  9 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
+      if (unit_test_status_next_subtest(&status, "Counter difference"))
       {
-         ok = ! x_options_x.m_Batch_Mode;
-         unit_test_status_pass(&status, ok);
-      }
+         xpccut_perf_values_t v1, v2, delta;
+         int c;
+         v1.m_Is_Valid = true;
+         for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+         {
+            v1.m_Have[c] = true;
+            v1.m_Values[c] = 1000 * (c + 1);
+         }
+         v2 = v1;
+         v2.m_Values[XPCCUT_PERF_CYCLES] += 500;
+         v2.m_Values[XPCCUT_PERF_INSTRUCTIONS] += 1200;
+         v2.m_Have[XPCCUT_PERF_CACHE_MISSES] = false;
+         ok = xpccut_perf_difference(&v1, &v2, &delta);
+         if (ok)
+            ok = delta.m_Is_Valid;
 
-      /* 10 */
+         if (ok)
+         {
+            ok = delta.m_Have[XPCCUT_PERF_CYCLES] &&
+               delta.m_Values[XPCCUT_PERF_CYCLES] == 500;
+         }
+         if (ok)
+         {
+            ok = delta.m_Have[XPCCUT_PERF_INSTRUCTIONS] &&
+               delta.m_Values[XPCCUT_PERF_INSTRUCTIONS] == 1200;
+         }
+         if (ok)                                /* not present in v2         */
+         {
+            ok = ! delta.m_Have[XPCCUT_PERF_CACHE_MISSES] &&
+               delta.m_Values[XPCCUT_PERF_CACHE_MISSES] == 0;
+         }
+         if (ok)
+         {
+            ok = delta.m_Have[XPCCUT_PERF_BRANCH_MISSES] &&
+               delta.m_Values[XPCCUT_PERF_BRANCH_MISSES] == 0;
+         }
+         if (ok)
+         {
+            for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+               v2.m_Have[c] = false;
 
-      if (unit_test_status_next_subtest(&status, "m_Interactive"))
-      {
-         ok = ! x_options_x.m_Interactive;
+            ok = xpccut_perf_difference(&v1, &v2, &delta);
+            if (ok)
+               ok = ! delta.m_Is_Valid;
+         }
          unit_test_status_pass(&status, ok);
       }
 
-      /* 11 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
+      if (unit_test_status_next_subtest(&status, "Counter names"))
       {
-         ok = ! x_options_x.m_Beep_Prompt;
-         unit_test_status_pass(&status, ok);
-      }
+         ok = strcmp(xpccut_perf_counter_name(XPCCUT_PERF_CYCLES), "cycles")
+            == 0;
 
-      /* 12 */
+         if (ok)
+         {
+            ok = strcmp
+            (
+               xpccut_perf_counter_name(XPCCUT_PERF_BRANCH_MISSES),
+               "branch misses"
+            ) == 0;
+         }
+         if (ok)
+            ok = strcmp(xpccut_perf_counter_name(XPCCUT_PERF_COUNT), "?") == 0;
 
-      if (unit_test_status_next_subtest(&status, "m_Summarize"))
-      {
-         ok = ! x_options_x.m_Summarize;
          unit_test_status_pass(&status, ok);
       }
 
-      /* 13 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
+      if (unit_test_status_next_subtest(&status, "Reading the counters"))
       {
-         ok = ! x_options_x.m_Case_Pause;
-         unit_test_status_pass(&status, ok);
-      }
+         xpccut_perf_values_t v1, v2, delta;
+         ok = xpccut_perf_read(&v1) == available;
+         if (ok)
+            ok = v1.m_Is_Valid == available;
 
-      /* 14 */
+         if (ok && available)
+         {
+            ok = xpccut_perf_read(&v2);
+            if (ok)
+               ok = xpccut_perf_difference(&v1, &v2, &delta);
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
-      {
-         ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
+            if (ok && delta.m_Have[XPCCUT_PERF_INSTRUCTIONS])
+               ok = delta.m_Values[XPCCUT_PERF_INSTRUCTIONS] >= 0;
+         }
+         if (ok)                                /* reopened after release    */
+         {
+            xpccut_perf_release();
+            ok = xpccut_perf_read(&v1) == available;
+         }
          unit_test_status_pass(&status, ok);
       }
 
-      /* 15 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      if (unit_test_status_next_subtest(&status, "Not counted"))
       {
-         ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+         {
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 99, 99, "x_status_x", "internal"
+            );
+         }
+         if (ok)
+            ok = unit_test_status_time_delta(&x_status_x, false) >= 0.0;
 
-      /* 16 */
+         if (ok)
+            ok = unit_test_status_counters(&x_status_x) == nullptr;
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
-      {
-         ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
          unit_test_status_pass(&status, ok);
       }
 
-      /* 17 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
+      if (unit_test_status_next_subtest(&status, "Counted"))
       {
-         ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
-         unit_test_status_pass(&status, ok);
-      }
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide "not available"     */
+         if (ok)
+            ok = unit_test_options_perf_counters_set(&x_options_x, true);
 
-      /* 18 */
+         if (! silent)
+            xpccut_allow_printing();
 
-      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
-      {
-         ok = ! x_options_x.m_Need_Subtests;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+         {
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 99, 99, "x_status_x", "internal"
+            );
+         }
+         if (ok)
+         {
+            xpccut_ticks_t wait = xpccut_get_ticks() + 1000000;
+            while (xpccut_get_ticks() < wait)            /* burn 1 ms of CPU */
+               ;
 
-      /* 19 */
+            ok = unit_test_status_time_delta(&x_status_x, false) >= 1.0;
+         }
+         if (ok)
+         {
+            const xpccut_perf_values_t * v =
+               unit_test_status_counters(&x_status_x);
 
-      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
-      {
-         ok = x_options_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+            ok = cut_not_nullptr(v) == available;
+            if (ok && available)
+            {
+               int c;
+               for (c = 0; c < XPCCUT_PERF_COUNT; c++)
+               {
+                  if (v->m_Have[c] && v->m_Values[c] < 0)
+                     ok = false;
+               }
+               if (ok && unit_test_options_is_verbose(options))
+                  xpccut_perf_show("Counters", v, 1.0);
+            }
+         }
          unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-#ifdef THIS_IS_POSSIBLE
-
-      /* 20 */
-
-      if (unit_test_status_next_subtest(&status, "Help text"))
-      {
-         /*
-          *    "testname", "version", "additionalhelp"
-          *
-          * We want to test the three additional parameters.  However, there's
-          * no easy way to see that the test-name got packed into the help text
-          * and know that we are correct.  And we can't even verify that the
-          * testname is \e somewhere in the help text, since the output
-          * buffer is freed as soon as it is printed.
-          *
-          *    char * substring = strstr
-          *    (
-          *       x_options_x.m_HELPTEXT, "testname"
-          *    );
-          *    ok = cut_not_nullptr(substring);
-          */
+/**
+ *    Holds the block that fake_leaky_unit_test_02_37() leaves allocated,
+ *    so that unit_unit_test_02_37() can free it afterward.
+ */
 
-         unit_test_status_pass(&status, ok);
-      }
+static void * gs_leak_02_37 = nullptr;
 
-#endif      /* THIS_IS_POSSIBLE */
+/**
+ *    Provides a fake test for unit_unit_test_02_37(), which allocates a
+ *    block, and does not free it.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
+static unit_test_status_t
+fake_leaky_unit_test_02_37 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, 1, "alloc", "leaky"
+   );
+   if (ok)
+   {
+      gs_leak_02_37 = malloc(64);
+      unit_test_status_pass(&status, cut_not_nullptr(gs_leak_02_37));
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the parse functionality
- *    handles turning on the options fields.
+ *    Provides a unit/regression test to verify the counting of the heap
+ *    allocations of each test, the "no allocations" check, and the list of
+ *    the tests that left memory allocated.  The test application links the
+ *    libxpccut_alloc library.  Where the library has nothing to count (on
+ *    a C library other than GNU's), the checks must pass quietly.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    4. unit_test_options_parse(), part 2.
+ *   37. Allocation counts.
  *
  * \test
- *    -  unit_test_options_parse()
+ *    -  xpccut_alloc_is_counting()
+ *    -  xpccut_alloc_read()
+ *    -  xpccut_alloc_difference()
+ *    -  xpccut_alloc_pause()
+ *    -  xpccut_alloc_resume()
+ *    -  unit_test_status_allocations()
+ *    -  unit_test_status_subtest_allocations()
+ *    -  unit_test_status_no_alloc_check()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -5188,245 +5404,540 @@ unit_unit_test_03_03 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_04 (const unit_test_options_t * options)
+unit_unit_test_02_37 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 4,
-      "unit_test_options_t", "unit_test_options_parse() part 2"
+      &status, options, 2, 37,
+      "unit_test_status_t", "Allocation counts"
    );
    if (ok)
    {
+      unit_test_status_t x_status_x;
       unit_test_options_t x_options_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* guarantee initialized   */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.
-       */
-
+      cbool_t counting = xpccut_alloc_is_counting();
       ok = unit_test_options_init(&x_options_x);
       if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
+
+      if (ok && unit_test_options_is_verbose(options))
+      {
+         xpccut_print
+         (
+            "  %s\n", counting ?
+               "Allocations are counted." :
+               "Allocations are not counted; counts are not checked."
+         );
+      }
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
          cbool_t null_ok;
-         argv[0] = "N/A";
-         argc = 1;
-         null_ok = ! unit_test_options_parse
-         (
-            nullptr, argc, argv,
-            "Test 03.04", "version", "additionalhelp"
-         );
+         xpccut_alloc_counts_t c;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! xpccut_alloc_read(nullptr);
          if (null_ok)
-         {
-            null_ok = ! unit_test_options_parse
-            (
-               &x_options_x, 0, argv,
-               "Test 03.04", "version", "additionalhelp"
-            );
-         }
+            null_ok = ! xpccut_alloc_difference(nullptr, &c, &c);
+
          if (null_ok)
-         {
-            null_ok = ! unit_test_options_parse
-            (
-               &x_options_x, argc, nullptr,
-               "Test 03.04", "version", "additionalhelp"
-            );
-         }
+            null_ok = ! xpccut_alloc_difference(&c, &c, nullptr);
+
+         if (null_ok)
+            null_ok = unit_test_status_allocations(nullptr) == nullptr;
+
+         if (null_ok)
+            null_ok = ! unit_test_status_subtest_allocations(nullptr, &c);
+
+         if (null_ok)
+            null_ok = ! unit_test_status_no_alloc_check(nullptr);
+
+         if (! silent)
+            xpccut_allow_printing();
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
-
-      if (ok)
+      if (unit_test_status_next_subtest(&status, "Counting malloc and free"))
       {
-         /*
-          * Now modify the options structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          *
-          * Also note that some options turn off the global output option or
-          * alter other options.  We disable them by tacking on "---ignore".
-          *
-          * The --summarize option does this, and the output looks weird.
-          */
+         xpccut_alloc_counts_t c1, c2, delta;
+         char * volatile block;                 /* keep the malloc() call    */
+         ok = xpccut_alloc_read(&c1) == counting;
+         if (ok)
+            ok = c1.m_Is_Valid == counting;
 
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--verbose";
-         argv[2]  = "--show-progress";
-         argv[3]  = "--show-values";
-         argv[4]  = "--show-step-numbers";
-         argv[5]  = "--text-synch";
-         argv[6]  = "--stop-on-error";
-         argv[7]  = "--batch-mode---ignore";
-         argv[8]  = "--interactive---ignore";
-         argv[9]  = "--beeps";
-         argv[10] = "--case-pause";
-         argv[11] = "--summarize---ignore";
-         argv[12] = "--group";
-         argv[13] = "1";
-         argv[14] = "--case";
-         argv[15] = "2";
-         argv[16] = "--sub-test";
-         argv[17] = "3";
-         argv[18] = "--sleep-time";
-         argv[19] = "4";
-         argc = 20;
-         ok = unit_test_options_parse
-         (
-            &x_options_x, argc, argv,
-            "Test 03.04", "version", "additionalhelp"
-         );
-      }
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
-      {
+         block = malloc(100);
+         ok = ok && cut_not_nullptr(block);
+         if (ok && counting)
+         {
+            (void) xpccut_alloc_read(&c2);
+            ok = xpccut_alloc_difference(&c1, &c2, &delta);
+            if (ok)
+            {
+               ok = delta.m_Allocations == 1 && delta.m_Frees == 0 &&
+                  delta.m_Bytes_Allocated >= 100 && delta.m_Bytes_Freed == 0;
+            }
+         }
+         free(block);
+         if (ok && counting)
+         {
+            (void) xpccut_alloc_read(&c2);
+            ok = xpccut_alloc_difference(&c1, &c2, &delta);
+            if (ok)
+            {
+               ok = delta.m_Allocations == 1 && delta.m_Frees == 1 &&
+                  delta.m_Bytes_Allocated == delta.m_Bytes_Freed;
+            }
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
-      {
-         ok = x_options_x.m_Is_Verbose;
+      if (unit_test_status_next_subtest(&status, "Pausing the counts"))
+      {
+         xpccut_alloc_counts_t c1, c2, delta;
+         char * volatile block;
+         (void) xpccut_alloc_read(&c1);
+         xpccut_alloc_pause();
+         xpccut_alloc_pause();                  /* the pauses can nest       */
+         block = malloc(100);
+         xpccut_alloc_resume();
+         free(block);
+         xpccut_alloc_resume();
+         ok = ! unit_test_status_subtest_allocations(&status, &c2) ||
+            c2.m_Allocations == 0;
+
+         if (ok && counting)
+         {
+            (void) xpccut_alloc_read(&c2);
+            ok = xpccut_alloc_difference(&c1, &c2, &delta);
+            if (ok)
+               ok = delta.m_Allocations == 0 && delta.m_Frees == 0;
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
+      if (unit_test_status_next_subtest(&status, "No-allocation check"))
       {
-         ok = x_options_x.m_Show_Values;
+         ok = unit_test_status_no_alloc_check(&status);
+         if (ok)
+         {
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 2, 37, "unit_test_status_t", "x"
+            );
+         }
+         if (ok)
+         {
+            char * volatile block;
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the failure message  */
+            block = malloc(16);
+            ok = unit_test_status_no_alloc_check(&x_status_x) != counting;
+            free(block);
+            if (ok)                             /* counting starts over      */
+               ok = unit_test_status_no_alloc_check(&x_status_x);
+
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+         {
+            xpccut_alloc_counts_t c;
+            ok = unit_test_status_subtest_allocations(&x_status_x, &c) ==
+               counting;
+
+            if (ok && counting)
+               ok = c.m_Allocations == 0 && c.m_Frees == 0;
+         }
+         if (ok)
+         {
+            ok = unit_test_status_error_count(&x_status_x) ==
+               (counting ? 1 : 0);
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      if (unit_test_status_next_subtest(&status, "Counts of a test"))
       {
-         ok = x_options_x.m_Text_Synch;
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 37, "unit_test_status_t", "x"
+         );
+         if (ok)
+         {
+            char * volatile block = malloc(200);
+            const xpccut_alloc_counts_t * c;
+            (void) unit_test_status_time_delta(&x_status_x, false);
+            free(block);
+            c = unit_test_status_allocations(&x_status_x);
+            ok = cut_not_nullptr(c) == counting;
+            if (ok && counting)
+            {
+               ok = c->m_Allocations == 1 && c->m_Frees == 0 &&
+                  c->m_Bytes_Allocated >= 200;
+            }
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
+      if (unit_test_status_next_subtest(&status, "Tests that leak"))
       {
-         ok = x_options_x.m_Show_Step_Numbers;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  7 */
+         unit_test_t x_test_x;
+         char * argv[3];
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = nullptr;
+         ok = unit_test_initialize
+         (
+            &x_test_x, 2, argv, "Test 02.37.6", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            ok = unit_test_register
+            (
+               &x_test_x, fake_leaky_unit_test_02_37, 98, 1, "alloc", "leaky"
+            );
+         }
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = unit_test_run(&x_test_x);
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         free(gs_leak_02_37);
+         gs_leak_02_37 = nullptr;
+         if (ok)
+            ok = x_test_x.m_Leak_Count == (counting ? 1 : 0);
 
-      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
-      {
-         ok = x_options_x.m_Show_Progress;
+         if (ok && counting)
+         {
+            const unit_test_leak_t * leak = &x_test_x.m_Leaks[0];
+            ok = leak->m_Test_Group == 98 && leak->m_Test_Case == 1 &&
+               leak->m_Blocks == 1 && leak->m_Bytes >= 64;
+         }
+         unit_test_destroy(&x_test_x);
          unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /*  8 */
+/**
+ *    Indicates that unit_unit_test_02_38() can make checks from several
+ *    threads at once.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
-      {
-         ok = x_options_x.m_Stop_On_Error;
-         unit_test_status_pass(&status, ok);
-      }
+#if XPC_HAVE_PTHREAD_H && ! defined WIN32
+#define USE_CHECK_THREADS 1
+#else
+#define USE_CHECK_THREADS 0
+#endif
 
-      /*  9 */
+/**
+ *    Provides the number of threads, and the number of checks made by
+ *    each, in unit_unit_test_02_38().  Every other check fails.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
-      {
-         ok = ! x_options_x.m_Batch_Mode;
-         unit_test_status_pass(&status, ok);
-      }
+#define CHECK_THREADS_02_38            4
+#define CHECKS_02_38                   1000
 
-      /* 10 */
+#if USE_CHECK_THREADS
 
-      if (unit_test_status_next_subtest(&status, "m_Interactive"))
-      {
-         ok = ! x_options_x.m_Interactive;
-         unit_test_status_pass(&status, ok);
-      }
+/**
+ *    Provides the thread function for unit_unit_test_02_38().  It makes
+ *    CHECKS_02_38 checks on the status shared by all of the threads, and
+ *    fails every other one.
+ *
+ * \param arg
+ *    Points to the unit_test_status_t shared by the threads.
+ *
+ * \return
+ *    Returns a null pointer.
+ */
 
-      /* 11 */
+static void *
+check_thread_02_38 (void * arg)
+{
+   unit_test_status_t * s = (unit_test_status_t *) arg;
+   int i;
+   for (i = 0; i < CHECKS_02_38; i++)
+   {
+      if ((i % 2) == 0)
+         (void) unit_test_status_bool_check(s, true, true);
+      else
+         (void) unit_test_status_int_check(s, 0, i);
+   }
+   return nullptr;
+}
 
-      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
-      {
-         ok = x_options_x.m_Beep_Prompt;
-         unit_test_status_pass(&status, ok);
-      }
+#endif
 
-      /* 12 */
+/**
+ *    Provides a unit/regression test to verify the recording of failed
+ *    checks in the failure log of a status, and the counting of the
+ *    failures of checks made from several threads at once.
+ *
+ * \group
+ *    2. unit_test_status_t functions.
+ *
+ * \case
+ *   38. Thread-safe checks.
+ *
+ * \test
+ *    -  unit_test_status_pass()
+ *    -  unit_test_status_failure_count()
+ *    -  unit_test_status_failure()
+ *    -  unit_test_status_failure_add()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-      if (unit_test_status_next_subtest(&status, "m_Summarize"))
-      {
-         ok = ! x_options_x.m_Summarize;
-         unit_test_status_pass(&status, ok);
-      }
+static unit_test_status_t
+unit_unit_test_02_38 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 2, 38,
+      "unit_test_status_t", "Thread-safe checks"
+   );
+   if (ok)
+   {
+      unit_test_status_t x_status_x;
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
 
-      /* 13 */
+      /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         ok = x_options_x.m_Case_Pause;
-         unit_test_status_pass(&status, ok);
-      }
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         ok = unit_test_status_failure_count(nullptr) == 0;
+         if (ok)
+            ok = unit_test_status_failure(nullptr, 0) == nullptr;
 
-      /* 14 */
+         if (ok)
+            ok = ! unit_test_status_failure_add(nullptr, 1, 1, "x");
+
+         if (! silent)
+            xpccut_allow_printing();
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
-      {
-         ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
          unit_test_status_pass(&status, ok);
       }
 
-      /* 15 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      if (unit_test_status_next_subtest(&status, "Failure log"))
       {
-         ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
-         unit_test_status_pass(&status, ok);
-      }
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 38, "unit_test_status_t", "x"
+         );
+         if (ok)
+            ok = unit_test_status_failure_count(&x_status_x) == 0;
 
-      /* 16 */
+         if (ok)
+            ok = unit_test_status_failure(&x_status_x, 0) == nullptr;
+
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the failure messages */
+            (void) unit_test_status_next_subtest(&x_status_x, "first");
+            (void) unit_test_status_bool_check(&x_status_x, true, true);
+            (void) unit_test_status_next_subtest(&x_status_x, "second");
+            (void) unit_test_status_int_check(&x_status_x, 1, 2);
+            (void) unit_test_status_next_subtest(&x_status_x, "third");
+            (void) unit_test_status_string_check(&x_status_x, "a", "b");
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+            ok = unit_test_status_failure_count(&x_status_x) == 2;
+
+         if (ok)
+            ok = unit_test_status_error_count(&x_status_x) == 2;
+
+         if (ok)
+            ok = unit_test_status_failed_subtest(&x_status_x) == 2;
+
+         if (ok)
+         {
+            const unit_test_failure_t * f0 =
+               unit_test_status_failure(&x_status_x, 0);
+
+            const unit_test_failure_t * f1 =
+               unit_test_status_failure(&x_status_x, 1);
+
+            ok = cut_not_nullptr(f0) && cut_not_nullptr(f1);
+            if (ok)
+               ok = f0->m_Subtest == 2 && f1->m_Subtest == 3;
+
+            if (ok)
+            {
+               ok = strcmp(f0->m_Subtest_Name, "second") == 0 &&
+                  strcmp(f1->m_Subtest_Name, "third") == 0;
+            }
+            if (ok)
+               ok = f0->m_Thread > 0 && f0->m_Thread == f1->m_Thread;
+         }
+         if (ok)
+            ok = unit_test_status_failure(&x_status_x, 2) == nullptr;
+
+         if (ok)
+            ok = unit_test_status_failure(&x_status_x, -1) == nullptr;
 
-      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
-      {
-         ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
          unit_test_status_pass(&status, ok);
       }
 
-      /* 17 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
+      if (unit_test_status_next_subtest(&status, "Full failure log"))
       {
-         ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 38, "unit_test_status_t", "x"
+         );
+         if (ok)
+         {
+            int i;
+            for (i = 0; i < 3 * XPCCUT_FAILURE_LOG_SIZE; i++)
+               (void) unit_test_status_fail(&x_status_x);
+
+            ok = unit_test_status_failure_count(&x_status_x) ==
+               3 * XPCCUT_FAILURE_LOG_SIZE;
+
+            for (i = 0; ok && i < XPCCUT_FAILURE_LOG_SIZE; i++)
+               ok = cut_not_nullptr(unit_test_status_failure(&x_status_x, i));
+         }
+         if (ok)
+         {
+            ok = unit_test_status_failure
+            (
+               &x_status_x, XPCCUT_FAILURE_LOG_SIZE
+            ) == nullptr;
+         }
          unit_test_status_pass(&status, ok);
       }
 
-      /* 18 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
+      if (unit_test_status_next_subtest(&status, "Checks from threads"))
       {
-         ok = ! x_options_x.m_Need_Subtests;
+#if USE_CHECK_THREADS
+         pthread_t t[CHECK_THREADS_02_38];
+         int started = 0;
+         int i;
+         cbool_t silent = xpccut_is_silent();
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 38, "unit_test_status_t", "x"
+         );
+         if (ok)
+            ok = unit_test_status_next_subtest(&x_status_x, "threads");
+
+         xpccut_silence_printing();             /* hide the failure messages */
+         for (i = 0; ok && i < CHECK_THREADS_02_38; i++)
+         {
+            ok = pthread_create
+            (
+               &t[i], nullptr, check_thread_02_38, &x_status_x
+            ) == 0;
+            if (ok)
+               started++;
+         }
+         for (i = 0; i < started; i++)
+            (void) pthread_join(t[i], nullptr);
+
+         if (! silent)
+            xpccut_allow_printing();
+
+         if (ok)
+         {
+            int failures = CHECK_THREADS_02_38 * CHECKS_02_38 / 2;
+            ok = unit_test_status_error_count(&x_status_x) == failures;
+            if (ok)
+               ok = unit_test_status_failure_count(&x_status_x) == failures;
+
+            if (ok)
+               ok = unit_test_status_failed_subtest(&x_status_x) == 1;
+         }
+         for (i = 0; ok && i < XPCCUT_FAILURE_LOG_SIZE; i++)
+         {
+            const unit_test_failure_t * f =
+               unit_test_status_failure(&x_status_x, i);
+
+            ok = cut_not_nullptr(f);
+            if (ok)
+               ok = f->m_Subtest == 1 && f->m_Thread > 0;
+         }
+#else
+         ok = true;
+         if (unit_test_options_is_verbose(options))
+            xpccut_print("  %s\n", "No threads; checks are not checked.");
+#endif
          unit_test_status_pass(&status, ok);
       }
 
-      /* 18 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
+      if (unit_test_status_next_subtest(&status, "Log made on failure"))
       {
-         ok = x_options_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 38, "unit_test_status_t", "x"
+         );
+         if (ok)
+         {
+            (void) unit_test_status_next_subtest(&x_status_x, "passes");
+            (void) unit_test_status_int_check(&x_status_x, 1, 1);
+            ok = cut_is_nullptr(x_status_x.m_Failures);  /* passing: no log */
+         }
+         if (ok)
+         {
+            char name[32];
+            const unit_test_failure_t * f;
+            snprintf(name, sizeof name, "%s", "added");
+            ok = unit_test_status_failure_add(&x_status_x, 7, 3, name);
+            name[0] = 0;                        /* the log keeps a copy    */
+            f = unit_test_status_failure(&x_status_x, 0);
+            if (ok)
+               ok = cut_not_nullptr(f) && f->m_Thread == 7 && f->m_Subtest == 3;
+
+            if (ok)
+               ok = f->m_Subtest_Name == xpccut_intern("added");
+
+            if (ok)
+               ok = unit_test_status_failure_count(&x_status_x) == 1;
+
+            if (ok)
+               ok = unit_test_status_error_count(&x_status_x) == 0;
+
+            if (ok)
+               ok = unit_test_status_passed(&x_status_x);
+         }
          unit_test_status_pass(&status, ok);
       }
    }
@@ -5434,21 +5945,27 @@ unit_unit_test_03_04 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the batch-mode,
- *    interactive-mode, summarize, and other tests that affect more than one
- *    flag at a time.
+ *    Provides the size of the buffers compared in unit_unit_test_02_39().
+ *    It spans several of the blocks of the bulk checks.
+ */
+
+#define BULK_SIZE_02_39          (3 * 4096 + 100)
+
+/**
+ *    Provides a unit/regression test to verify the bulk checks of buffers
+ *    and arrays, including mismatches at the edges of the blocks that they
+ *    compare at a time.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    5. unit_test_options_parse(), part 3, plus some output options.
+ *   39. Bulk checks.
  *
  * \test
- *    -  unit_test_options_parse()
- *    -  xpccut_is_silent() [indirectly]
- *    -  xpccut_silence_printing() [indirectly]
- *    -  xpccut_allow_printing() [indirectly]
+ *    -  unit_test_status_buffer_check()
+ *    -  unit_test_status_int_array_check()
+ *    -  unit_test_status_double_array_check()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -5458,327 +5975,330 @@ unit_unit_test_03_04 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_05 (const unit_test_options_t * options)
+unit_unit_test_02_39 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 5,
-      "unit_test_options_t", "unit_test_options_parse() part 3"
+      &status, options, 2, 39,
+      "unit_test_status_t", "Bulk checks"
    );
    if (ok)
    {
+      static unsigned char s_expected[BULK_SIZE_02_39];
+      static unsigned char s_actual[BULK_SIZE_02_39];
+      unit_test_status_t x_status_x;
       unit_test_options_t x_options_x;
-      cbool_t original_silence_setting;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* guarantee initialized   */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
-
-      /**
-       * Obtain the silence-setting that was specified on the command
-       * line, so that it can be restored at the end of some of the
-       * sub-tests.  If the user didn't specify --summarize, this value
-       * should be false by default.
-       */
-
-      original_silence_setting = xpccut_is_silent();
-
-      /*  1 */
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.
-       */
+      cbool_t silent = xpccut_is_silent();
+      int i;
+      for (i = 0; i < BULK_SIZE_02_39; i++)
+         s_expected[i] = s_actual[i] = (unsigned char) (i * 7);
 
       ok = unit_test_options_init(&x_options_x);
       if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
 
-      if (unit_test_status_next_subtest(&status, "--batch-mode test"))
+      if (ok)
       {
-         if (ok)
-         {
-            /*
-             * Force some options to be the opposite of what the test should
-             * result in.  Not completely airtight, but good enough.
-             *
-             * Here, we set only batch-mode, which also sets the
-             * show-progress mode off.
-             */
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 2, 39, "unit_test_status_t", "x"
+         );
+      }
 
-            x_options_x.m_Interactive        = true;
-            x_options_x.m_Show_Step_Numbers  = true;
-            x_options_x.m_Show_Values        = true;
-            x_options_x.m_Is_Verbose         = true;
-            x_options_x.m_Summarize          = false;
-            x_options_x.m_Need_Subtests      = false;
+      /*  1 */
 
-            /*
-             * Now run a simulated command-line.
-             */
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         xpccut_silence_printing();             /* hide the error messages   */
+         if (ok)
+            ok = ! unit_test_status_buffer_check(nullptr, "a", "a", 1);
 
-            argv[0]  = "unit_test_test";
-            argv[1]  = "--batch-mode";
-            argv[2]  = "--interactive---ignore";
-            argv[3] = "--summarize---ignore";
-            argc = 4;
-            ok = unit_test_options_parse
+         if (ok)
+         {
+            ok = unit_test_status_buffer_check
             (
-               &x_options_x, argc, argv,
-               "03.05", "version", "additionalhelp"
+               &x_status_x, nullptr, nullptr, 10
             );
          }
-
-         /*
-          * This stilted style makes it easy to catch error under a
-          * debugger.
-          */
-
-         if (ok)
-            ok = x_options_x.m_Interactive;              /* new */
-
-         if (ok)
-            ok = x_options_x.m_Show_Step_Numbers;        /* new */
-
          if (ok)
-            ok = ! x_options_x.m_Show_Values;
+            ok = ! unit_test_status_buffer_check(&x_status_x, "a", nullptr, 1);
 
          if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
-
+         {
+            int one = 1;
+            ok = ! unit_test_status_int_array_check
+            (
+               &x_status_x, &one, nullptr, 1
+            );
+         }
          if (ok)
-            ok = ! x_options_x.m_Summarize;
+            ok = unit_test_status_error_count(&x_status_x) == 2;
 
-         if (ok)
-            ok = ! x_options_x.m_Need_Subtests;
+         if (! silent)
+            xpccut_allow_printing();
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  2 */
 
-      if (ok)
-         ok = unit_test_options_init(&x_options_x);
-
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
-
-      if (unit_test_status_next_subtest(&status, "--interactive re-test"))
+      if (unit_test_status_next_subtest(&status, "Equal buffers"))
       {
          if (ok)
          {
-            x_options_x.m_Interactive = false;
-            argv[0]  = "unit_test_test";
-            argv[1]  = "--batch-mode--ignore";     /* affects other options   */
-            argv[2]  = "--interactive";
-            argv[3]  = "--summarize---ignore";     /* affects other options   */
-            argc = 4;
-            ok = unit_test_options_parse
+            ok = unit_test_status_buffer_check
             (
-               &x_options_x, argc, argv,
-               "03.05", "version", "additionalhelp"
+               &x_status_x, s_expected, s_actual, BULK_SIZE_02_39
             );
          }
          if (ok)
-            ok = x_options_x.m_Interactive;
+            ok = unit_test_status_buffer_check(&x_status_x, "a", "b", 0);
 
          if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
+            ok = unit_test_status_error_count(&x_status_x) == 2;
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Values;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
+      /*  3 */
 
-         if (ok)
-            ok = ! x_options_x.m_Summarize;
+      if (unit_test_status_next_subtest(&status, "Mismatched buffers"))
+      {
+         static const int s_offsets[] =
+         {
+            0, 15, 4095, 4096, 2 * 4096 + 1, BULK_SIZE_02_39 - 1
+         };
+         int count = (int) (sizeof s_offsets / sizeof s_offsets[0]);
+         for (i = 0; ok && i < count; i++)
+         {
+            int offset = s_offsets[i];
+            s_actual[offset] ^= 0x40;
+            xpccut_silence_printing();          /* hide the failure messages */
+            ok = ! unit_test_status_buffer_check
+            (
+               &x_status_x, s_expected, s_actual, BULK_SIZE_02_39
+            );
+            if (! silent)
+               xpccut_allow_printing();
 
+            s_actual[offset] ^= 0x40;
+         }
          if (ok)
-            ok = ! x_options_x.m_Need_Subtests;
+         {
+            ok = unit_test_status_buffer_check
+            (
+               &x_status_x, s_expected, s_actual, BULK_SIZE_02_39
+            );
+         }
+         if (ok)
+            ok = unit_test_status_error_count(&x_status_x) == 2 + count;
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
-
-      if (ok)
-         ok = unit_test_options_init(&x_options_x);
-
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "--summarize test"))
+      if (unit_test_status_next_subtest(&status, "Integer arrays"))
       {
+         int expected[1000];
+         int actual[1000];
+         for (i = 0; i < 1000; i++)
+            expected[i] = actual[i] = i - 500;
+
          if (ok)
          {
-            x_options_x.m_Interactive        = true;
-            x_options_x.m_Summarize          = true;
-            x_options_x.m_Case_Pause         = true;
-            argv[0]  = "unit_test_test";
-            argv[1]  = "--batch-mode---ignore";
-            argv[2]  = "--interactive---ignore";
-            argv[3]  = "--summarize";              /* affects other options   */
-            argc = 4;
-            ok = unit_test_options_parse
+            ok = unit_test_status_int_array_check
             (
-               &x_options_x, argc, argv,
-               "03.05", "version", "additionalhelp"
+               &x_status_x, expected, actual, 1000
             );
          }
+
          if (ok)
          {
-            /*
-             * --summarize no longer sets this variable.
-             *
-             * ok = xpccut_is_silent();            // did --summarize work?
-             */
-
-            /*
-             * Now restore the original setting of the silence flag, so that
-             * the output of the unit-test will have the appearance expected
-             * by the dude who ran this test.
-             */
-
-            if (original_silence_setting)
-               xpccut_silence_printing();
-            else
+            actual[999] = 0;
+            xpccut_silence_printing();          /* hide the failure messages */
+            ok = ! unit_test_status_int_array_check
+            (
+               &x_status_x, expected, actual, 1000
+            );
+            if (! silent)
                xpccut_allow_printing();
          }
+         if (ok)                                /* the tail is not compared  */
+         {
+            ok = unit_test_status_int_array_check
+            (
+               &x_status_x, expected, actual, 999
+            );
+         }
 
-         /*
-          * We check more than we really need to, here.
-          */
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Interactive;
+      /*  5 */
 
+      if (unit_test_status_next_subtest(&status, "Double arrays"))
+      {
+         double expected[13];
+         double actual[13];
+         volatile double zero = 0.0;
+         for (i = 0; i < 13; i++)
+         {
+            expected[i] = i * 0.5;
+            actual[i] = expected[i] + ((i % 2 == 0) ? 1.0e-9 : -1.0e-9);
+         }
          if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
-
+         {
+            ok = unit_test_status_double_array_check
+            (
+               &x_status_x, expected, actual, 13, 1.0e-6
+            );
+         }
          if (ok)
-            ok = ! x_options_x.m_Show_Values;
-
+         {
+            expected[3] = actual[3] = 1.0 / zero;     /* equal infinities    */
+            ok = unit_test_status_double_array_check
+            (
+               &x_status_x, expected, actual, 13, 1.0e-6
+            );
+         }
+         xpccut_silence_printing();             /* hide the failure messages */
          if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
-
+         {
+            ok = ! unit_test_status_double_array_check
+            (
+               &x_status_x, expected, actual, 13, 1.0e-12
+            );
+         }
          if (ok)
-            ok = ! x_options_x.m_Case_Pause;
-
+         {
+            actual[12] = zero / zero;                 /* NaN, in the tail    */
+            ok = ! unit_test_status_double_array_check
+            (
+               &x_status_x, expected, actual, 13, 1.0
+            );
+         }
          if (ok)
-            ok = x_options_x.m_Summarize;
+         {
+            actual[12] = expected[12];
+            actual[5] += 0.25;                        /* in the first group  */
+            ok = ! unit_test_status_double_array_check
+            (
+               &x_status_x, expected, actual, 13, 0.125
+            );
+         }
+         if (! silent)
+            xpccut_allow_printing();
 
          if (ok)
-            ok = ! x_options_x.m_Need_Subtests;
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  3 */
-
-      if (ok)
-         ok = unit_test_options_init(&x_options_x);
-
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
-
-      if (unit_test_status_next_subtest(&status, "--version test"))
-      {
-         cbool_t null_ok;
-         xpccut_silence_printing();
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--version";
-         argc = 2;
-         null_ok = ! unit_test_options_parse
-         (
-            &x_options_x, argc, argv,
-            "03.05", nullptr, "additionalhelp"
-         );
-         if (null_ok)
          {
-            null_ok = ! unit_test_options_parse
+            ok = unit_test_status_double_array_check
             (
-               &x_options_x, argc, argv,
-               "03.05", "version", "additionalhelp"
+               &x_status_x, expected, actual, 13, 0.5
             );
          }
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
 
-         /*
-          * Restore the original setting of the silence flag.
-          */
-
-         if (original_silence_setting)
-            xpccut_silence_printing();
-         else
-            xpccut_allow_printing();
+/**
+ *    Provides the name of the table file written by unit_unit_test_02_40().
+ */
 
-         unit_test_status_pass(&status, null_ok);
-      }
+#define TABLE_FILE_02_40         "unit_test_02_40.tab"
 
-      /*  4 */
+/**
+ *    Provides the rows of the inline table of unit_unit_test_02_40().  Each
+ *    row holds two numbers and their sum.
+ */
 
-      if (ok)
-         ok = unit_test_options_init(&x_options_x);
+static const char * const gs_rows_02_40[] =
+{
+   "1 2 3",
+   "10\t-20  -10",
+   "-2147483647 -1 -2147483648",
+   ""
+};
 
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+/**
+ *    Walks a table with a status whose --sub-test and --named-subtest
+ *    options are set, for unit_unit_test_02_40().
+ *
+ * \return
+ *    Returns the number of records returned, or -1 if the status could not
+ *    be set up.  The numbers of the records are added to \a numbers.
+ */
 
-      if (unit_test_status_next_subtest(&status, "--help test"))
-      {
-         cbool_t null_ok;
-         xpccut_silence_printing();
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--help";
-         argc = 2;
-         null_ok = ! unit_test_options_parse
-         (
-            &x_options_x, argc, argv, "03.05", "version", nullptr
-         );
-         if (null_ok)
-         {
-            null_ok = ! unit_test_options_parse
-            (
-               &x_options_x, argc, argv,
-               nullptr, "version", "additionalhelp"
-            );
-         }
-         if (null_ok)
-         {
-            null_ok = ! unit_test_options_parse
-            (
-               &x_options_x, argc, argv,
-               "03.05", "version", "additionalhelp"
-            );
-         }
+static int
+walk_unit_test_02_40
+(
+   const xpccut_table_t * table,
+   int subtest,
+   const char * named,
+   int * numbers
+)
+{
+   int result = -1;
+   unit_test_options_t x_options_x;
+   unit_test_status_t x_status_x;
+   cbool_t ok = unit_test_options_init(&x_options_x);
+   if (ok)
+      ok = unit_test_options_show_progress_set(&x_options_x, false);
 
-         /*
-          * Restore the original setting of the silence flag.
-          */
+   if (ok)
+      ok = unit_test_options_single_subtest_set(&x_options_x, subtest);
 
-         if (original_silence_setting)
-            xpccut_silence_printing();
-         else
-            xpccut_allow_printing();
+   if (ok && cut_not_nullptr(named))
+      ok = unit_test_options_named_subtest_set(&x_options_x, named);
 
-         unit_test_status_pass(&status, null_ok);
+   if (ok)
+   {
+      ok = unit_test_status_initialize
+      (
+         &x_status_x, &x_options_x, 2, 40, "unit_test_status_t", "x"
+      );
+   }
+   if (ok)
+   {
+      xpccut_record_t record = XPCCUT_RECORD_INIT;
+      result = 0;
+      *numbers = 0;
+      while (unit_test_status_next_record(&x_status_x, table, &record))
+      {
+         ++result;
+         *numbers += record.m_Number;
+         unit_test_status_pass(&x_status_x, true);
       }
+      if (unit_test_status_subtest(&x_status_x) != 4)
+         result = -1;                           /* every record is counted  */
    }
-   return status;
+   return result;
 }
 
 /**
- *    Provides a unit/regression test to verify the "is-verbose"
- *    functionality.
+ *    Provides a unit/regression test to verify the tables of data-driven
+ *    tests, made from rows in the source or from a file, and the walking
+ *    of their records as sub-tests.
  *
  * \group
- *    3. unit_test_options_t functions.
+ *    2. unit_test_status_t functions.
  *
  * \case
- *    6. Accessors for the --verbose option.
+ *   40. Data-driven tables.
  *
  * \test
- *    -  unit_test_options_is_verbose_set()
- *    -  unit_test_options_is_verbose()
+ *    -  xpccut_table_open()
+ *    -  xpccut_table_init_rows()
+ *    -  xpccut_table_close()
+ *    -  xpccut_table_name()
+ *    -  xpccut_table_next()
+ *    -  xpccut_record_field()
+ *    -  xpccut_record_long()
+ *    -  xpccut_record_equals()
+ *    -  unit_test_status_next_record()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -5788,283 +6308,267 @@ unit_unit_test_03_05 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_06 (const unit_test_options_t * options)
+unit_unit_test_02_40 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 6,
-      "unit_test_options_t", "unit_test_options_is_verbose...()"
+      &status, options, 2, 40,
+      "unit_test_status_t", "Data-driven tables"
    );
    if (ok)
    {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      xpccut_table_t rows;
+      cbool_t silent = xpccut_is_silent();
+      ok = xpccut_table_init_rows(&rows, "sums", gs_rows_02_40, 4);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         cbool_t null_ok = ! unit_test_options_is_verbose_set(nullptr, false);
-         if (null_ok)
-            null_ok = ! unit_test_options_is_verbose_set(nullptr, true);
+         xpccut_table_t table;
+         xpccut_record_t record = XPCCUT_RECORD_INIT;
+         xpccut_silence_printing();             /* hide the error messages   */
+         if (ok)
+            ok = ! xpccut_table_open(nullptr, TABLE_FILE_02_40);
 
-         unit_test_status_pass(&status, null_ok);
-      }
+         if (ok)
+            ok = ! xpccut_table_init_rows(&table, "x", nullptr, 2);
 
-      /*  2 */
+         if (ok)
+            ok = ! xpccut_table_init_rows(&table, "x", gs_rows_02_40, -1);
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
-      {
-         cbool_t null_ok =
-         (
-            unit_test_options_is_verbose(nullptr) == XPCCUT_IS_VERBOSE
-         );
-         unit_test_status_pass(&status, null_ok);
-      }
+         if (ok)
+            ok = cut_is_nullptr(xpccut_table_name(nullptr));
 
-      /*  3 */
+         if (ok)
+            ok = ! xpccut_table_next(nullptr, &record);
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
-      {
          if (ok)
-            ok = unit_test_options_is_verbose_set(&x_options_x, false);
+            ok = ! unit_test_status_next_record(&status, nullptr, &record);
 
          if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
+            ok = ! unit_test_status_next_record(nullptr, &rows, &record);
 
          if (ok)
-            ok = ! unit_test_options_is_verbose(&x_options_x);
+            ok = ! xpccut_record_long(&record, nullptr);
 
+         if (! silent)
+            xpccut_allow_printing();
+
+         xpccut_table_close(nullptr);
          unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "Rows"))
       {
+         xpccut_record_t record = XPCCUT_RECORD_INIT;
+         int count = 0;
          if (ok)
-            ok = unit_test_options_is_verbose_set(&x_options_x, true);
+            ok = strcmp(xpccut_table_name(&rows), "sums") == 0;
 
+         while (ok && xpccut_table_next(&rows, &record))
+         {
+            xpccut_record_t field;
+            long values[3];
+            int f;
+            ++count;
+            ok = record.m_Number == count && record.m_Line == count;
+            for (f = 0; ok && f < 3; ++f)
+            {
+               ok = xpccut_record_field(&record, f, &field);
+               if (ok)
+                  ok = xpccut_record_long(&field, &values[f]);
+            }
+            if (ok)
+            {
+               ok = values[0] + values[1] == values[2];
+               if (ok)
+                  ok = ! xpccut_record_field(&record, 3, &field);
+            }
+            else if (count == 4)
+            {
+               ok = record.m_Length == 0 &&
+                  ! xpccut_record_field(&record, 0, &field);
+            }
+         }
          if (ok)
-            ok = x_options_x.m_Is_Verbose;
+            ok = count == 4 && record.m_Number == 4;
 
          if (ok)
-            ok = unit_test_options_is_verbose(&x_options_x);
+            ok = ! xpccut_table_next(&rows, &record);
 
          unit_test_status_pass(&status, ok);
       }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "show-values"
- *    functionality.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *    7. Accessors for the --show-values option.
- *
- * \test
- *    -  unit_test_options_show_values_set()
- *    -  unit_test_options_show_values()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /*  3 */
 
-static unit_test_status_t
-unit_unit_test_03_07 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 7,
-      "unit_test_options_t", "unit_test_options_is_show_values...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
-
-      /*  1 */
-
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
-      {
-         cbool_t null_ok = ! unit_test_options_show_values_set(nullptr, false);
-         if (null_ok)
-            null_ok = ! unit_test_options_show_values_set(nullptr, true);
-
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  2 */
-
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "Fields"))
       {
-         cbool_t null_ok =
-         (
-            unit_test_options_show_values(nullptr) == XPCCUT_SHOW_VALUES
-         );
-         unit_test_status_pass(&status, null_ok);
-      }
+         xpccut_record_t record = XPCCUT_RECORD_INIT;
+         xpccut_record_t field;
+         long value = 0;
+         if (ok)
+            ok = xpccut_table_next(&rows, &record);
 
-      /*  3 */
+         if (ok)
+            ok = xpccut_record_equals(&record, "1 2 3");
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
-      {
          if (ok)
-            ok = unit_test_options_show_values_set(&x_options_x, false);
+            ok = ! xpccut_record_equals(&record, "1 2");
 
          if (ok)
-            ok = ! x_options_x.m_Show_Values;
+            ok = xpccut_record_field(&record, 2, &field);
 
          if (ok)
-            ok = ! unit_test_options_show_values(&x_options_x);
+            ok = xpccut_record_equals(&field, "3") && field.m_Number == 1;
 
+         if (ok)
+         {
+            field.m_Text = "+42x";
+            field.m_Length = 3;
+            ok = xpccut_record_long(&field, &value) && value == 42;
+         }
+         if (ok)
+         {
+            field.m_Length = 4;
+            ok = ! xpccut_record_long(&field, &value) && value == 42;
+         }
+         if (ok)
+         {
+            field.m_Text = "9223372036854775808";   /* LONG_MAX + 1 */
+            field.m_Length = (int) strlen(field.m_Text);
+            ok = ! xpccut_record_long(&field, &value);
+         }
+         if (ok)
+         {
+            field.m_Text = "-";
+            field.m_Length = 1;
+            ok = ! xpccut_record_long(&field, &value);
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "File"))
       {
+         FILE * f = fopen(TABLE_FILE_02_40, "wb");
+         ok = cut_not_nullptr(f);
          if (ok)
-            ok = unit_test_options_show_values_set(&x_options_x, true);
-
-         if (ok)
-            ok = x_options_x.m_Show_Values;
-
+         {
+            fprintf(f, "# a b sum\n1 2 3\r\n\n   4 5 9\n#\n\r\n7 8 15");
+            fclose(f);
+         }
          if (ok)
-            ok = unit_test_options_show_values(&x_options_x);
-
-         unit_test_status_pass(&status, ok);
-      }
-   }
-   return status;
-}
+         {
+            static const int s_lines[] = { 2, 4, 7 };
+            static const long s_sums[] = { 3, 9, 15 };
+            xpccut_table_t table;
+            xpccut_record_t record = XPCCUT_RECORD_INIT;
+            int count = 0;
+            ok = xpccut_table_open(&table, TABLE_FILE_02_40);
+            if (ok)
+               ok = strcmp(xpccut_table_name(&table), TABLE_FILE_02_40) == 0;
 
-/**
- *    Provides a unit/regression test to verify the "text-synch"
- *    functionality.
- *
- * \note
- *    Although the unit_test_options_t.m_Text_Synch variable is supported,
- *    the actual usage of a synchronization object has not yet been added.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *    8. Accessors for the --text-synch option.
- *
- * \test
- *    -  unit_test_options_use_text_synch_set()
- *    -  unit_test_options_use_text_synch()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+            while (ok && xpccut_table_next(&table, &record))
+            {
+               xpccut_record_t field;
+               long sum = 0;
+               ok = count < 3 && record.m_Line == s_lines[count];
+               ++count;
+               if (ok)
+                  ok = record.m_Number == count;
 
-static unit_test_status_t
-unit_unit_test_03_08 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 8,
-      "unit_test_options_t", "unit_test_options_use_text_synch...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+               if (ok)
+                  ok = xpccut_record_field(&record, 2, &field);
 
-      /*  1 */
+               if (ok)
+                  ok = xpccut_record_long(&field, &sum);
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
-      {
-         cbool_t null_ok = ! unit_test_options_use_text_synch_set(nullptr, false);
-         if (null_ok)
-            null_ok = ! unit_test_options_use_text_synch_set(nullptr, true);
+               if (ok)
+                  ok = sum == s_sums[count - 1];
+            }
+            if (ok)
+               ok = count == 3;
 
-         unit_test_status_pass(&status, null_ok);
-      }
+            xpccut_table_close(&table);
+         }
+         if (ok)
+         {
+            xpccut_table_t table;
+            xpccut_record_t record = XPCCUT_RECORD_INIT;
+            f = fopen(TABLE_FILE_02_40, "wb");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               fclose(f);
+               ok = xpccut_table_open(&table, TABLE_FILE_02_40);
+               if (ok)
+                  ok = ! xpccut_table_next(&table, &record);
 
-      /*  2 */
+               xpccut_table_close(&table);
+            }
+         }
+         (void) remove(TABLE_FILE_02_40);
+         if (ok)
+         {
+            xpccut_table_t table;
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = ! xpccut_table_open(&table, TABLE_FILE_02_40);
+            if (! silent)
+               xpccut_allow_printing();
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
-      {
-         cbool_t null_ok =
-         (
-            unit_test_options_use_text_synch(nullptr) == XPCCUT_TEXT_SYNCH
-         );
-         unit_test_status_pass(&status, null_ok);
+            xpccut_table_close(&table);
+         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "Records as sub-tests"))
       {
+         int numbers = 0;
          if (ok)
-            ok = unit_test_options_use_text_synch_set(&x_options_x, false);
+            ok = walk_unit_test_02_40(&rows, 0, nullptr, &numbers) == 4;
 
          if (ok)
-            ok = ! x_options_x.m_Text_Synch;
+            ok = numbers == 1 + 2 + 3 + 4;
 
          if (ok)
-            ok = ! unit_test_options_use_text_synch(&x_options_x);
-
-         unit_test_status_pass(&status, ok);
-      }
+            ok = walk_unit_test_02_40(&rows, 3, nullptr, &numbers) == 1;
 
-      /*  4 */
-
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
-      {
          if (ok)
-            ok = unit_test_options_use_text_synch_set(&x_options_x, true);
+            ok = numbers == 3;
 
          if (ok)
-            ok = x_options_x.m_Text_Synch;
+            ok = walk_unit_test_02_40(&rows, 0, "sums", &numbers) == 4;
 
          if (ok)
-            ok = unit_test_options_use_text_synch(&x_options_x);
+            ok = walk_unit_test_02_40(&rows, 0, "other", &numbers) == 0;
 
          unit_test_status_pass(&status, ok);
       }
+      xpccut_table_close(&rows);
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "step-numbers"
- *    functionality.
+ *    Provides a unit/regression test to verify that the basic
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *    9. Accessors for the --show-step-numbers option.
+ *    1. unit_test_options_init()
  *
  * \test
- *    -  unit_test_options_show_step_numbers_set()
- *    -  unit_test_options_show_step_numbers()
+ *    -  unit_test_options_init()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6074,355 +6578,311 @@ unit_unit_test_03_08 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_09 (const unit_test_options_t * options)
+unit_unit_test_03_01 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 9,
-      "unit_test_options_t", "unit_test_options_show_step_numbers...()"
+      &status, options, 3, 1,
+      "unit_test_options_t", "unit_test_options_init()"
    );
    if (ok)
    {
       unit_test_options_t x_options_x;
       ok = unit_test_options_init(&x_options_x);
+
+      /*
+       * This setting ensures that the user will see "Simulated TEST",
+       * rather than be confused by seeing bogus-looking "TEST" numbers.
+       */
+
       if (ok)
          ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = ! unit_test_options_show_step_numbers_set
-         (
-            nullptr, false
-         );
-         if (null_ok)
-            null_ok = ! unit_test_options_show_step_numbers_set(nullptr, true);
-
+         cbool_t null_ok = ! unit_test_options_init(nullptr);
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
       {
          /*
-          * Let's do this a different way, just to show another way to do
-          * it.
+          * Let's use the recent addition to our unit-test armaments:
           *
-          * cbool_t null_ok =
-          * (
-          *    unit_test_options_show_step_numbers(nullptr) ==
-          *       XPCCUT_SHOW_STEP_NUMBERS
-          * );
-          * unit_test_status_pass(&status, null_ok);
+          * ok = x_options_x.m_Is_Verbose == XPCCUT_IS_VERBOSE;
+          * unit_test_status_pass(&status, ok);
           */
 
-         (void) unit_test_status_bool_check
+         ok = unit_test_status_bool_check
          (
-            &status, unit_test_options_show_step_numbers(nullptr),
-            XPCCUT_SHOW_STEP_NUMBERS
+            &status, x_options_x.m_Is_Verbose, XPCCUT_IS_VERBOSE
          );
       }
 
-      /*  3 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
       {
-         if (ok)
-            ok = unit_test_options_show_step_numbers_set(&x_options_x, false);
+         /*
+          * ok = x_options_x.m_Show_Values == XPCCUT_SHOW_VALUES;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Show_Values, XPCCUT_SHOW_VALUES
+         );
+      }
 
-         if (ok)
-            ok = ! unit_test_options_show_step_numbers(&x_options_x);
+      /*  5 */
 
-         unit_test_status_pass(&status, ok);
+      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      {
+         /*
+          * ok = x_options_x.m_Text_Synch == XPCCUT_TEXT_SYNCH;
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Text_Synch, XPCCUT_TEXT_SYNCH
+         );
       }
 
-      /*  4 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
       {
-         if (ok)
-            ok = unit_test_options_show_step_numbers_set(&x_options_x, true);
+         /*
+          * ok = x_options_x.m_Show_Step_Numbers == XPCCUT_SHOW_STEP_NUMBERS;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = x_options_x.m_Show_Step_Numbers;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Show_Step_Numbers, XPCCUT_SHOW_STEP_NUMBERS
+         );
+      }
 
-         if (ok)
-            ok = unit_test_options_show_step_numbers(&x_options_x);
+      /*  7 */
 
-         unit_test_status_pass(&status, ok);
+      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
+      {
+         /*
+          * ok = x_options_x.m_Show_Progress == XPCCUT_SHOW_PROGRESS;
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Show_Progress, XPCCUT_SHOW_PROGRESS
+         );
       }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "show-progress"
- *    functionality.
- *
- * \note
- *    This function affects more than one field if the flag is set to false.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *   10. Accessors for the --show-progress option.
- *
- * \test
- *    -  unit_test_options_show_progress_set()
- *    -  unit_test_options_show_progress()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /*  8 */
 
-static unit_test_status_t
-unit_unit_test_03_10 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 10,
-      "unit_test_options_t", "unit_test_options_show_progress...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
+      {
+         /*
+          * ok = x_options_x.m_Stop_On_Error == XPCCUT_STOP_ON_ERROR;
+          * unit_test_status_pass(&status, ok);
+          */
 
-      /*  1 */
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Stop_On_Error, XPCCUT_STOP_ON_ERROR
+         );
+      }
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      /*  9 */
+
+      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
       {
-         cbool_t null_ok = ! unit_test_options_show_progress_set
+         /*
+          * ok = x_options_x.m_Batch_Mode == XPCCUT_BATCH_MODE;
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_bool_check
          (
-            nullptr, false
+            &status, x_options_x.m_Batch_Mode, XPCCUT_BATCH_MODE
          );
-         if (null_ok)
-            null_ok = ! unit_test_options_show_progress_set(nullptr, true);
-
-         unit_test_status_pass(&status, null_ok);
       }
 
-      /*  2 */
+      /* 10 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "m_Interactive"))
       {
-         cbool_t null_ok;
-         cbool_t match = XPCCUT_SHOW_PROGRESS;
+         /*
+          * ok = x_options_x.m_Interactive == XPCCUT_INTERACTIVE;
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Interactive, XPCCUT_INTERACTIVE
+         );
+      }
+
+      /* 11 */
 
+      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
+      {
          /*
-          * This makes no sense.  Besides, --hide-errors affects this
-          * function, and thus using it can make the unit-test fail.
-          * Useless!
-          *
-          * if (xpccut_is_silent())                   // --silent in force?
-          *    match = false;
-          *
-          * null_ok = unit_test_options_show_progress(nullptr) == match;
+          * ok = x_options_x.m_Beep_Prompt == XPCCUT_BEEP;
+          * unit_test_status_pass(&status, ok);
           */
 
-         null_ok = unit_test_options_show_progress(nullptr) == match;
-         unit_test_status_pass(&status, null_ok);
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Beep_Prompt, XPCCUT_BEEP
+         );
       }
 
-      /*  3 */
+      /* 12 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Summarize"))
       {
-         if (ok)
-            ok = unit_test_options_show_progress_set(&x_options_x, false);
+         /*
+          * ok = x_options_x.m_Summarize == XPCCUT_SUMMARIZE;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Progress;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Summarize, XPCCUT_SUMMARIZE
+         );
+      }
 
-         if (ok)
-            ok = ! unit_test_options_show_progress(&x_options_x);
+      /* 13 */
 
+      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
+      {
          /*
-          * These settings are side-effects.
+          * ok = x_options_x.m_Case_Pause == XPCCUT_CASE_PAUSE;
+          * unit_test_status_pass(&status, ok);
           */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Case_Pause, XPCCUT_CASE_PAUSE
+         );
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Values;
+      /* 14 */
 
-         if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
+      {
+         /*
+          * ok = x_options_x.m_Single_Test_Group == XPCCUT_NO_SINGLE_GROUP;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         unit_test_status_pass(&status, ok);
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Single_Test_Group, XPCCUT_NO_SINGLE_GROUP
+         );
       }
 
-      /*  4 */
+      /* 15 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
       {
-         if (ok)
-            ok = unit_test_options_show_progress_set(&x_options_x, true);
+         /*
+          * ok = x_options_x.m_Single_Test_Case == XPCCUT_NO_SINGLE_CASE;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = x_options_x.m_Show_Progress;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Single_Test_Case, XPCCUT_NO_SINGLE_CASE
+         );
+      }
 
+      /* 16 */
+
+      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      {
          /*
-          * These settings are side-effects, but the values are not changed
-          * when setting the flag to true.
+          * ok = x_options_x.m_Single_Sub_Test == XPCCUT_NO_SINGLE_SUB_TEST;
+          * unit_test_status_pass(&status, ok);
           */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Single_Sub_Test, XPCCUT_NO_SINGLE_SUB_TEST
+         );
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Values;
+      /* 17 */
 
-         if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
+      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
+      {
+         /*
+          * ok = x_options_x.m_Test_Sleep_Time == XPCCUT_TEST_SLEEP_TIME;
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-         {
-            /*
-             * This may be unwise, but the show-progress function also
-             * checks the --silent option internally.  At any rate, we have
-             * to account for that.
-             **
-             * \change ca 04/23/2008
-             *    No, this is no longer true.  We have to ignore this
-             *    sub-sub-test.
-             **
-             * if (xpccut_is_silent())
-             *    ok = ! unit_test_options_show_progress(&x_options_x);
-             * else
-             *    ok = unit_test_options_show_progress(&x_options_x);
-             */
+         ok = unit_test_status_bool_check
+         (
+            &status, x_options_x.m_Test_Sleep_Time, XPCCUT_TEST_SLEEP_TIME
+         );
          }
-         unit_test_status_pass(&status, ok);
-      }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "stop-on-error"
- *    functionality.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *   11. Accessors for the --stop-on-error option.
- *
- * \test
- *    -  unit_test_options_stop_on_error_set()
- *    -  unit_test_options_stop_on_error()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
-
-static unit_test_status_t
-unit_unit_test_03_11 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 11,
-      "unit_test_options_t", "unit_test_options_stop_on_error...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
-
-      /*  1 */
+      /* 18 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
       {
-         cbool_t null_ok = ! unit_test_options_stop_on_error_set
+         /*
+          * ok = x_options_x.m_Need_Subtests == XPCCUT_NEED_SUBTESTS;
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_bool_check
          (
-            nullptr, false
+            &status, x_options_x.m_Need_Subtests, XPCCUT_NEED_SUBTESTS
          );
-         if (null_ok)
-            null_ok = ! unit_test_options_stop_on_error_set(nullptr, true);
-
-         unit_test_status_pass(&status, null_ok);
       }
 
-      /*  2 */
+      /* 19 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
       {
-         cbool_t null_ok =
+         ok = unit_test_status_int_check
          (
-            unit_test_options_stop_on_error(nullptr) == XPCCUT_STOP_ON_ERROR
+            &status, x_options_x.m_Current_Test_Number,
+            XPCCUT_NO_CURRENT_TEST
          );
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
-      {
-         if (ok)
-            ok = unit_test_options_stop_on_error_set(&x_options_x, false);
-
-         if (ok)
-            ok = ! x_options_x.m_Stop_On_Error;
-
-         if (ok)
-            ok = ! unit_test_options_stop_on_error(&x_options_x);
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
-
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
-      {
-         if (ok)
-            ok = unit_test_options_stop_on_error_set(&x_options_x, true);
-
-         if (ok)
-            ok = x_options_x.m_Stop_On_Error;
-
-         if (ok)
-            ok = unit_test_options_stop_on_error(&x_options_x);
-
-         unit_test_status_pass(&status, ok);
       }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "batch-mode"
- *    functionality.
+ *    Provides a unit/regression test to verify that the basic
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   12. Accessors for the --batch-mode option.
+ *    2. unit_test_options_initialize()
  *
  * \test
- *    -  unit_test_options_batch_mode_set()
- *    -  unit_test_options_batch_mode()
+ *    -  unit_test_options_initialize()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6432,232 +6892,294 @@ unit_unit_test_03_11 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_12 (const unit_test_options_t * options)
+unit_unit_test_03_02 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 12,
-      "unit_test_options_t", "unit_test_options_batch_mode...()"
+      &status, options, 3, 2,
+      "unit_test_options_t", "unit_test_options_initialize()"
    );
    if (ok)
    {
       unit_test_options_t x_options_x;
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.
+       */
+
       ok = unit_test_options_init(&x_options_x);
       if (ok)
          ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /*  1 */
-
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (ok)
       {
-         cbool_t null_ok = ! unit_test_options_batch_mode_set
+         /**
+          * This test also modifies the options structure with the opposite
+          * values (or at least different values) for every accessible
+          * field, so that the resulting test is a bizarro-clone of test
+          * 03_01.
+          *
+          * \note
+          *    -  The unit_test_options_initialize() function does not
+          *       provide parameters for the single test group, case, and
+          *       sub-test names, the need-subtests option, the
+          *       force-failure option, the current-test number, the
+          *       response-before and response-after values, and the
+          *       is-simulated value.  It does set them all in a hard-wired
+          *       fashion, though.
+          *    -  It is important to realize that the settings made by
+          *       unit_test_options_initialize() can be a bit different
+          *       from the settings made by calling each of the setter
+          *       functions individually with the same values.  The reason
+          *       is that the following setters have side-effects on other
+          *       fields in the unit_test_options_t structure:
+          *       -  unit_test_options_batch_mode_set()
+          *       -  unit_test_options_show_progress_set()
+          *       -  unit_test_options_summary_set()
+          */
+
+         ok = unit_test_options_initialize
          (
-            nullptr, false
+            &x_options_x,
+            ! XPCCUT_IS_VERBOSE,          /* verbose           */
+            ! XPCCUT_SHOW_VALUES,         /* showvalues        */
+            ! XPCCUT_TEXT_SYNCH,          /* usetextsynch      */
+            ! XPCCUT_SHOW_STEP_NUMBERS,   /* showstepnumbers   */
+            ! XPCCUT_SHOW_PROGRESS,       /* showprogress      */
+            ! XPCCUT_STOP_ON_ERROR,       /* stoponerror       */
+            ! XPCCUT_BATCH_MODE,          /* batchmode         */
+            ! XPCCUT_INTERACTIVE,         /* interactive       */
+            ! XPCCUT_BEEP,                /* beeps             */
+            ! XPCCUT_SUMMARIZE,           /* summarize         */
+            ! XPCCUT_CASE_PAUSE,          /* casepause         */
+            XPCCUT_NO_SINGLE_GROUP+1,     /* singlegroup       */
+            XPCCUT_NO_SINGLE_CASE+2,      /* singlecase        */
+            XPCCUT_NO_SINGLE_SUB_TEST+3,  /* singlesubtest     */
+            XPCCUT_TEST_SLEEP_TIME+4      /* testsleeptime     */
          );
-         if (null_ok)
-            null_ok = ! unit_test_options_batch_mode_set(nullptr, true);
-
-         unit_test_status_pass(&status, null_ok);
       }
 
-      /*  2 */
+      /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok =
+         cbool_t null_ok = ! unit_test_options_initialize
          (
-            unit_test_options_batch_mode(nullptr) == XPCCUT_BATCH_MODE
+            nullptr,
+            false, false, false, false, false, false,
+            false, false, false, false, false,
+            0, 0, 0, 0
          );
          unit_test_status_pass(&status, null_ok);
       }
 
-      /*  3 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
       {
-         if (ok)
-            ok = unit_test_options_batch_mode_set(&x_options_x, false);
-
-         if (ok)
-            ok = ! x_options_x.m_Batch_Mode;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! unit_test_options_batch_mode(&x_options_x);
+      /*  3 */
 
+      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
+      {
          /*
-          * These settings are side-effects.
+          * Rather than use the recent unit_test_status_bool_check()
+          * function, like we did in 03_01 above, we'll leave these tests as
+          * they are.  This shows another way to do the checks, for more
+          * general comparisons or tests.
           */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
-
-         if (ok)
-            ok = ! x_options_x.m_Show_Values;
-
-         if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
-
+         ok = x_options_x.m_Is_Verbose != XPCCUT_IS_VERBOSE;
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
       {
-         if (ok)
-            ok = unit_test_options_batch_mode_set(&x_options_x, true);
-
-         if (ok)
-            ok = x_options_x.m_Batch_Mode;
+         ok = x_options_x.m_Show_Values != XPCCUT_SHOW_VALUES;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = unit_test_options_batch_mode(&x_options_x);
+      /*  5 */
 
-         /*
-          * The unit_test_options_batch_mode_set() function also sets these
-          * variables, but only if the boolean parameter is true.
-          */
+      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      {
+         ok = x_options_x.m_Text_Synch != XPCCUT_TEXT_SYNCH;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Interactive;
+      /*  6 */
 
-         if (ok)
-            ok = x_options_x.m_Response_Before = 'c';
+      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
+      {
+         ok = x_options_x.m_Show_Step_Numbers != XPCCUT_SHOW_STEP_NUMBERS;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Response_After = 'p';
+      /*  7 */
 
-         /*
-          * These settings are side-effects, but the values are not changed
-          * when setting the flag to true or false.
-          */
+      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
+      {
+         ok = x_options_x.m_Show_Progress != XPCCUT_SHOW_PROGRESS;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Step_Numbers;
+      /*  8 */
 
-         if (ok)
-            ok = ! x_options_x.m_Show_Values;
+      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
+      {
+         ok = x_options_x.m_Stop_On_Error != XPCCUT_STOP_ON_ERROR;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Is_Verbose;
+      /*  9 */
 
+      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
+      {
+         ok = x_options_x.m_Batch_Mode != XPCCUT_BATCH_MODE;
          unit_test_status_pass(&status, ok);
       }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "interactive"
- *    functionality.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *   13. Accessors for the --interactive option.
- *
- * \test
- *    -  unit_test_options_is_interactive_set()
- *    -  unit_test_options_is_interactive()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /* 10 */
 
-static unit_test_status_t
-unit_unit_test_03_13 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 13,
-      "unit_test_options_t", "unit_test_options_is_interactive...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      if (unit_test_status_next_subtest(&status, "m_Interactive"))
+      {
+         ok = x_options_x.m_Interactive != XPCCUT_INTERACTIVE;
+         unit_test_status_pass(&status, ok);
+      }
 
-      /*  1 */
+      /* 11 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
       {
-         cbool_t null_ok = ! unit_test_options_is_interactive_set
-         (
-            nullptr, false
-         );
-         if (null_ok)
-            null_ok = ! unit_test_options_is_interactive_set(nullptr, true);
+         ok = x_options_x.m_Beep_Prompt != XPCCUT_BEEP;
+         unit_test_status_pass(&status, ok);
+      }
 
-         unit_test_status_pass(&status, null_ok);
+      /* 12 */
+
+      if (unit_test_status_next_subtest(&status, "m_Summarize"))
+      {
+         ok = x_options_x.m_Summarize != XPCCUT_SUMMARIZE;
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  2 */
+      /* 13 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
       {
-         cbool_t null_ok =
+         ok = x_options_x.m_Case_Pause != XPCCUT_CASE_PAUSE;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 14 */
+
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
+      {
+         /*
+          * Let's use the recent addition to our unit-test armaments for
+          * these integer checks.
+          *
+          * ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_int_check
          (
-            unit_test_options_is_interactive(nullptr) == XPCCUT_INTERACTIVE
+            &status, x_options_x.m_Single_Test_Group, XPCCUT_NO_SINGLE_GROUP+1
          );
-         unit_test_status_pass(&status, null_ok);
       }
 
-      /*  3 */
+      /* 15 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
       {
-         if (ok)
-            ok = unit_test_options_is_interactive_set(&x_options_x, false);
+         /*
+          * ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = ! x_options_x.m_Interactive;
+         ok = unit_test_status_int_check
+         (
+            &status, x_options_x.m_Single_Test_Case, XPCCUT_NO_SINGLE_CASE+2
+         );
+      }
 
-         if (ok)
-            ok = ! unit_test_options_is_interactive(&x_options_x);
+      /* 16 */
 
-         unit_test_status_pass(&status, ok);
+      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      {
+         /*
+          * ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
+          * unit_test_status_pass(&status, ok);
+          */
+
+         ok = unit_test_status_int_check
+         (
+            &status, x_options_x.m_Single_Sub_Test, XPCCUT_NO_SINGLE_SUB_TEST+3
+         );
       }
 
-      /*  4 */
+      /* 17 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
       {
-         if (ok)
-            ok = unit_test_options_is_interactive_set(&x_options_x, true);
+         /*
+          * ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
+          * unit_test_status_pass(&status, ok);
+          */
 
-         if (ok)
-            ok = x_options_x.m_Interactive;
+         ok = unit_test_status_int_check
+         (
+            &status, x_options_x.m_Test_Sleep_Time, XPCCUT_TEST_SLEEP_TIME+4
+         );
+      }
 
-         if (ok)
-            ok = unit_test_options_is_interactive(&x_options_x);
+      /* 18 */
 
+      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
+      {
+         ok = x_options_x.m_Need_Subtests == XPCCUT_NEED_SUBTESTS;
          unit_test_status_pass(&status, ok);
       }
+
+      /* 19 */
+
+      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
+      {
+         ok = unit_test_status_int_check
+         (
+            &status, x_options_x.m_Current_Test_Number,
+            XPCCUT_NO_CURRENT_TEST
+         );
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "beep"
- *    functionality.
+ *    Provides a constant for allocation simulated command-line arguments.
+ */
+
+#define FULL_ARG_COUNT           24
+
+/**
+ *    Provides a unit/regression test to verify that the parse functionality
+ *    handles turning off the options.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   14. Accessors for the --beeps option.
+ *    3. unit_test_options_parse(), part 1.
  *
  * \test
- *    -  unit_test_options_do_beep_set()
- *    -  unit_test_options_do_beep()
+ *    -  unit_test_options_parse()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6667,212 +7189,266 @@ unit_unit_test_03_13 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_14 (const unit_test_options_t * options)
+unit_unit_test_03_03 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 14,
-      "unit_test_options_t", "unit_test_options_do_beep...()"
+      &status, options, 3, 3,
+      "unit_test_options_t", "unit_test_options_parse() part 1"
    );
    if (ok)
    {
       unit_test_options_t x_options_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* 1 more than last index  */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.
+       */
+
       ok = unit_test_options_init(&x_options_x);
       if (ok)
          ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
+      if (ok)
+      {
+         /*
+          * Now modify the options structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          */
+
+         argv[0]  = "unit_test_test";              /* application name        */
+         argv[1]  = "--no-verbose";
+         argv[2]  = "--no-show-progress";          /* "--no-silent"           */
+         argv[3]  = "--no-show-values";
+         argv[4]  = "--no-show-step-numbers";
+         argv[5]  = "--no-text-synch";
+         argv[6]  = "--no-stop-on-error";
+         argv[7]  = "--no-batch-mode";
+         argv[8]  = "--no-interactive";
+         argv[9]  = "--no-beeps";
+         argv[10] = "--no-case-pause";
+         argv[11] = "--no-summarize";
+         argv[12] = "--group";
+         argv[13] = "1";
+         argv[14] = "--case";
+         argv[15] = "2";
+         argv[16] = "--sub-test";
+         argv[17] = "3";
+         argv[18] = "--sleep-time";
+         argv[19] = "4";
+         argv[20] = "--no-verbose";
+         argv[21] = "--no-verbose";
+         argc = 22;
+         ok = unit_test_options_parse
+         (
+            &x_options_x, argc, argv,
+            "Test 03.03", "version", "additionalhelp"
+         );
+      }
+
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = ! unit_test_options_do_beep_set
+         cbool_t null_ok = ! unit_test_options_parse
          (
-            nullptr, false
+            nullptr, argc, argv,
+            "Test 03.03", "version", "additionalhelp"
          );
-         if (null_ok)
-            null_ok = ! unit_test_options_do_beep_set(nullptr, true);
-
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
       {
-         cbool_t null_ok =
-         (
-            unit_test_options_do_beep(nullptr) == XPCCUT_BEEP
-         );
-         unit_test_status_pass(&status, null_ok);
+         unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
       {
-         if (ok)
-            ok = unit_test_options_do_beep_set(&x_options_x, false);
+         ok = ! x_options_x.m_Is_Verbose;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Beep_Prompt;
+      /*  4 */
 
-         if (ok)
-            ok = ! unit_test_options_do_beep(&x_options_x);
+      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
+      {
+         ok = ! x_options_x.m_Show_Values;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
 
+      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      {
+         ok = ! x_options_x.m_Text_Synch;
          unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
       {
-         if (ok)
-            ok = unit_test_options_do_beep_set(&x_options_x, true);
+         ok = ! x_options_x.m_Show_Step_Numbers;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Beep_Prompt;
+      /*  7 */
 
-         if (ok)
-            ok = unit_test_options_do_beep(&x_options_x);
+      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
+      {
+         ok = ! x_options_x.m_Show_Progress;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
 
+      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
+      {
+         ok = ! x_options_x.m_Stop_On_Error;
          unit_test_status_pass(&status, ok);
       }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "summarize"
- *    functionality.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *   15. Accessors for the --summarize option.
- *
- * \test
- *    -  unit_test_options_is_summary_set()
- *    -  unit_test_options_is_summary()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /*  9 */
 
-static unit_test_status_t
-unit_unit_test_03_15 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 15,
-      "unit_test_options_t", "unit_test_options_is_summary...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
+      {
+         ok = ! x_options_x.m_Batch_Mode;
+         unit_test_status_pass(&status, ok);
+      }
 
-      /*  1 */
+      /* 10 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "m_Interactive"))
       {
-         cbool_t null_ok = ! unit_test_options_is_summary_set
-         (
-            nullptr, false
-         );
-         if (null_ok)
-            null_ok = ! unit_test_options_is_summary_set(nullptr, true);
+         ok = ! x_options_x.m_Interactive;
+         unit_test_status_pass(&status, ok);
+      }
 
-         unit_test_status_pass(&status, null_ok);
+      /* 11 */
+
+      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
+      {
+         ok = ! x_options_x.m_Beep_Prompt;
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  2 */
+      /* 12 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      if (unit_test_status_next_subtest(&status, "m_Summarize"))
       {
-         cbool_t null_ok =
-         (
-            unit_test_options_is_summary(nullptr) == XPCCUT_SUMMARIZE
-         );
-         unit_test_status_pass(&status, null_ok);
+         ok = ! x_options_x.m_Summarize;
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
+      /* 13 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
       {
-         if (ok)
-            ok = unit_test_options_is_summary_set(&x_options_x, false);
+         ok = ! x_options_x.m_Case_Pause;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Summarize;
+      /* 14 */
 
-         if (ok)
-            ok = ! unit_test_options_is_summary(&x_options_x);
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
+      {
+         ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
+         unit_test_status_pass(&status, ok);
+      }
 
-         /*
-          * The following settings are side-effects.
-          */
+      /* 15 */
 
-         if (ok)
-            ok = ! x_options_x.m_Interactive;
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      {
+         ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Case_Pause;
+      /* 16 */
 
+      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      {
+         ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
          unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /* 17 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
       {
-         if (ok)
-            ok = unit_test_options_is_summary_set(&x_options_x, true);
+         ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Summarize;
+      /* 18 */
 
-         if (ok)
-            ok = unit_test_options_is_summary(&x_options_x);
+      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
+      {
+         ok = ! x_options_x.m_Need_Subtests;
+         unit_test_status_pass(&status, ok);
+      }
 
-         /*
-          * The following settings are side-effects that do not get undone
-          * by setting the flag to true.
-          */
+      /* 19 */
 
-         if (ok)
-            ok = ! x_options_x.m_Interactive;
+      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
+      {
+         ok = x_options_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! x_options_x.m_Case_Pause;
+#ifdef THIS_IS_POSSIBLE
+
+      /* 20 */
+
+      if (unit_test_status_next_subtest(&status, "Help text"))
+      {
+         /*
+          *    "testname", "version", "additionalhelp"
+          *
+          * We want to test the three additional parameters.  However, there's
+          * no easy way to see that the test-name got packed into the help text
+          * and know that we are correct.  And we can't even verify that the
+          * testname is \e somewhere in the help text, since the output
+          * buffer is freed as soon as it is printed.
+          *
+          *    char * substring = strstr
+          *    (
+          *       x_options_x.m_HELPTEXT, "testname"
+          *    );
+          *    ok = cut_not_nullptr(substring);
+          */
 
          unit_test_status_pass(&status, ok);
       }
+
+#endif      /* THIS_IS_POSSIBLE */
+
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "pause"
- *    functionality.
+ *    Provides a unit/regression test to verify that the parse functionality
+ *    handles turning on the options fields.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   16. Accessors for the --case-pause option.
+ *    4. unit_test_options_parse(), part 2.
  *
  * \test
- *    -  unit_test_options_is_pause_set()
- *    -  unit_test_options_is_pause()
+ *    -  unit_test_options_parse()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6882,75 +7458,245 @@ unit_unit_test_03_15 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_16 (const unit_test_options_t * options)
+unit_unit_test_03_04 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 16,
-      "unit_test_options_t", "unit_test_options_is_pause...()"
+      &status, options, 3, 4,
+      "unit_test_options_t", "unit_test_options_parse() part 2"
    );
    if (ok)
    {
       unit_test_options_t x_options_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* guarantee initialized   */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.
+       */
+
       ok = unit_test_options_init(&x_options_x);
       if (ok)
          ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = ! unit_test_options_is_pause_set
+         cbool_t null_ok;
+         argv[0] = "N/A";
+         argc = 1;
+         null_ok = ! unit_test_options_parse
          (
-            nullptr, false
+            nullptr, argc, argv,
+            "Test 03.04", "version", "additionalhelp"
          );
          if (null_ok)
-            null_ok = ! unit_test_options_is_pause_set(nullptr, true);
-
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  2 */
-
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
-      {
-         cbool_t null_ok =
-         (
-            unit_test_options_is_pause(nullptr) == XPCCUT_CASE_PAUSE
-         );
+         {
+            null_ok = ! unit_test_options_parse
+            (
+               &x_options_x, 0, argv,
+               "Test 03.04", "version", "additionalhelp"
+            );
+         }
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, nullptr,
+               "Test 03.04", "version", "additionalhelp"
+            );
+         }
          unit_test_status_pass(&status, null_ok);
       }
 
-      /*  3 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      if (ok)
       {
-         if (ok)
-            ok = unit_test_options_is_pause_set(&x_options_x, false);
+         /*
+          * Now modify the options structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          *
+          * Also note that some options turn off the global output option or
+          * alter other options.  We disable them by tacking on "---ignore".
+          *
+          * The --summarize option does this, and the output looks weird.
+          */
 
-         if (ok)
-            ok = ! x_options_x.m_Case_Pause;
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--verbose";
+         argv[2]  = "--show-progress";
+         argv[3]  = "--show-values";
+         argv[4]  = "--show-step-numbers";
+         argv[5]  = "--text-synch";
+         argv[6]  = "--stop-on-error";
+         argv[7]  = "--batch-mode---ignore";
+         argv[8]  = "--interactive---ignore";
+         argv[9]  = "--beeps";
+         argv[10] = "--case-pause";
+         argv[11] = "--summarize---ignore";
+         argv[12] = "--group";
+         argv[13] = "1";
+         argv[14] = "--case";
+         argv[15] = "2";
+         argv[16] = "--sub-test";
+         argv[17] = "3";
+         argv[18] = "--sleep-time";
+         argv[19] = "4";
+         argc = 20;
+         ok = unit_test_options_parse
+         (
+            &x_options_x, argc, argv,
+            "Test 03.04", "version", "additionalhelp"
+         );
+      }
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = ! unit_test_options_is_pause(&x_options_x);
+      /*  3 */
 
+      if (unit_test_status_next_subtest(&status, "m_Is_Verbose"))
+      {
+         ok = x_options_x.m_Is_Verbose;
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      if (unit_test_status_next_subtest(&status, "m_Show_Values"))
       {
-         if (ok)
-            ok = unit_test_options_is_pause_set(&x_options_x, true);
+         ok = x_options_x.m_Show_Values;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Case_Pause;
+      /*  5 */
 
-         if (ok)
-            ok = unit_test_options_is_pause(&x_options_x);
+      if (unit_test_status_next_subtest(&status, "m_Text_Synch"))
+      {
+         ok = x_options_x.m_Text_Synch;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "m_Show_Step_Numbers"))
+      {
+         ok = x_options_x.m_Show_Step_Numbers;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "m_Show_Progress"))
+      {
+         ok = x_options_x.m_Show_Progress;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
+
+      if (unit_test_status_next_subtest(&status, "m_Stop_On_Error"))
+      {
+         ok = x_options_x.m_Stop_On_Error;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  9 */
+
+      if (unit_test_status_next_subtest(&status, "m_Batch_Mode"))
+      {
+         ok = ! x_options_x.m_Batch_Mode;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 10 */
+
+      if (unit_test_status_next_subtest(&status, "m_Interactive"))
+      {
+         ok = ! x_options_x.m_Interactive;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 11 */
+
+      if (unit_test_status_next_subtest(&status, "m_Beep_Prompt"))
+      {
+         ok = x_options_x.m_Beep_Prompt;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 12 */
+
+      if (unit_test_status_next_subtest(&status, "m_Summarize"))
+      {
+         ok = ! x_options_x.m_Summarize;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 13 */
+
+      if (unit_test_status_next_subtest(&status, "m_Case_Pause"))
+      {
+         ok = x_options_x.m_Case_Pause;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 14 */
+
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Group"))
+      {
+         ok = x_options_x.m_Single_Test_Group == (XPCCUT_NO_SINGLE_GROUP+1);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 15 */
+
+      if (unit_test_status_next_subtest(&status, "m_Single_Test_Case"))
+      {
+         ok = x_options_x.m_Single_Test_Case == (XPCCUT_NO_SINGLE_CASE+2);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 16 */
+
+      if (unit_test_status_next_subtest(&status, "m_Single_Sub_Test"))
+      {
+         ok = x_options_x.m_Single_Sub_Test == (XPCCUT_NO_SINGLE_SUB_TEST+3);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 17 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Sleep_Time"))
+      {
+         ok = x_options_x.m_Test_Sleep_Time == (XPCCUT_TEST_SLEEP_TIME+4);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 18 */
+
+      if (unit_test_status_next_subtest(&status, "m_Need_Subtests"))
+      {
+         ok = ! x_options_x.m_Need_Subtests;
+         unit_test_status_pass(&status, ok);
+      }
 
+      /* 18 */
+
+      if (unit_test_status_next_subtest(&status, "m_Current_Test_Number"))
+      {
+         ok = x_options_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
          unit_test_status_pass(&status, ok);
       }
    }
@@ -6958,18 +7704,21 @@ unit_unit_test_03_16 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "test group"
- *    functionality.
+ *    Provides a unit/regression test to verify the batch-mode,
+ *    interactive-mode, summarize, and other tests that affect more than one
+ *    flag at a time.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   17. Accessors for the --group option.
+ *    5. unit_test_options_parse(), part 3, plus some output options.
  *
  * \test
- *    -  unit_test_options_test_group_set()
- *    -  unit_test_options_test_group()
+ *    -  unit_test_options_parse()
+ *    -  xpccut_is_silent() [indirectly]
+ *    -  xpccut_silence_printing() [indirectly]
+ *    -  xpccut_allow_printing() [indirectly]
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -6979,334 +7728,327 @@ unit_unit_test_03_16 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_17 (const unit_test_options_t * options)
+unit_unit_test_03_05 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 17,
-      "unit_test_options_t", "unit_test_options_test_group...()"
+      &status, options, 3, 5,
+      "unit_test_options_t", "unit_test_options_parse() part 3"
    );
    if (ok)
    {
       unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+      cbool_t original_silence_setting;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* guarantee initialized   */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
 
-      /*  1 */
+      /**
+       * Obtain the silence-setting that was specified on the command
+       * line, so that it can be restored at the end of some of the
+       * sub-tests.  If the user didn't specify --summarize, this value
+       * should be false by default.
+       */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
-      {
-         cbool_t null_ok = ! unit_test_options_test_group_set(nullptr, 0);
-         if (null_ok)
-            null_ok = ! unit_test_options_test_group_set(nullptr, 1);
+      original_silence_setting = xpccut_is_silent();
 
-         unit_test_status_pass(&status, null_ok);
-      }
+      /*  1 */
 
-      /*  2 */
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.
+       */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      if (unit_test_status_next_subtest(&status, "--batch-mode test"))
       {
-         /*
-          * Let's do this another way, just to show it.
-          *
-          * cbool_t null_ok =
-          * (
-          *    unit_test_options_test_group(nullptr) == XPCCUT_NO_SINGLE_GROUP
-          * );
-          * unit_test_status_pass(&status, null_ok);
-          */
-
-         (void) unit_test_status_int_check
-         (
-            &status, unit_test_options_test_group(nullptr),
-            XPCCUT_NO_SINGLE_GROUP
-         );
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
-      {
-         /*
-          * Set explicitly to make sure the correct value replaces this one.
-          */
+         if (ok)
+         {
+            /*
+             * Force some options to be the opposite of what the test should
+             * result in.  Not completely airtight, but good enough.
+             *
+             * Here, we set only batch-mode, which also sets the
+             * show-progress mode off.
+             */
 
-         x_options_x.m_Single_Test_Group = 5;
-         ok = ! unit_test_options_test_group_set(&x_options_x, -1);
+            x_options_x.m_Interactive        = true;
+            x_options_x.m_Show_Step_Numbers  = true;
+            x_options_x.m_Show_Values        = true;
+            x_options_x.m_Is_Verbose         = true;
+            x_options_x.m_Summarize          = false;
+            x_options_x.m_Need_Subtests      = false;
 
-         /*
-          * Let's do this another way, just to see how it looks.
-          *
-          * if (ok)
-          *    ok = x_options_x.m_Single_Test_Group == 0;
-          *
-          * if (ok)
-          *    ok = unit_test_options_test_group(&x_options_x) == 0;
-          */
+            /*
+             * Now run a simulated command-line.
+             */
 
-         if (ok)
-         {
-            ok = unit_test_status_int_check
-            (
-               &status, x_options_x.m_Single_Test_Group, 0
-            );
-         }
-         if (ok)
-         {
-            ok = unit_test_status_int_check
+            argv[0]  = "unit_test_test";
+            argv[1]  = "--batch-mode";
+            argv[2]  = "--interactive---ignore";
+            argv[3] = "--summarize---ignore";
+            argc = 4;
+            ok = unit_test_options_parse
             (
-               &status, unit_test_options_test_group(&x_options_x), 0
+               &x_options_x, argc, argv,
+               "03.05", "version", "additionalhelp"
             );
          }
 
          /*
-          * Not needed, since we're using unit_test_status_int_check(),
-          * which calls this function under the covers:
-          *
-          * unit_test_status_pass(&status, ok);
+          * This stilted style makes it easy to catch error under a
+          * debugger.
           */
-      }
 
-      /*  4 */
+         if (ok)
+            ok = x_options_x.m_Interactive;              /* new */
 
-      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
-      {
-         x_options_x.m_Single_Test_Group = 5;
          if (ok)
-            ok = unit_test_options_test_group_set(&x_options_x, 0);
+            ok = x_options_x.m_Show_Step_Numbers;        /* new */
 
          if (ok)
-            ok = x_options_x.m_Single_Test_Group == 0;
+            ok = ! x_options_x.m_Show_Values;
 
          if (ok)
-            ok = unit_test_options_test_group(&x_options_x) == 0;
+            ok = ! x_options_x.m_Is_Verbose;
+
+         if (ok)
+            ok = ! x_options_x.m_Summarize;
+
+         if (ok)
+            ok = ! x_options_x.m_Need_Subtests;
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  5 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
+      if (ok)
+         ok = unit_test_options_init(&x_options_x);
+
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      if (unit_test_status_next_subtest(&status, "--interactive re-test"))
       {
-         x_options_x.m_Single_Test_Group = 5;
          if (ok)
-            ok = unit_test_options_test_group_set(&x_options_x, 1);
-
+         {
+            x_options_x.m_Interactive = false;
+            argv[0]  = "unit_test_test";
+            argv[1]  = "--batch-mode--ignore";     /* affects other options   */
+            argv[2]  = "--interactive";
+            argv[3]  = "--summarize---ignore";     /* affects other options   */
+            argc = 4;
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv,
+               "03.05", "version", "additionalhelp"
+            );
+         }
          if (ok)
-            ok = x_options_x.m_Single_Test_Group == 1;
+            ok = x_options_x.m_Interactive;
 
          if (ok)
-            ok = unit_test_options_test_group(&x_options_x) == 1;
-
-         unit_test_status_pass(&status, ok);
-      }
+            ok = ! x_options_x.m_Show_Step_Numbers;
 
-      /*  6 */
+         if (ok)
+            ok = ! x_options_x.m_Show_Values;
 
-      if (unit_test_status_next_subtest(&status, "Setting to 101, set/get"))
-      {
-         x_options_x.m_Single_Test_Group = 5;
          if (ok)
-            ok = ! unit_test_options_test_group_set(&x_options_x, 101);
+            ok = ! x_options_x.m_Is_Verbose;
 
          if (ok)
-            ok = x_options_x.m_Single_Test_Group == 0;
+            ok = ! x_options_x.m_Summarize;
 
          if (ok)
-            ok = unit_test_options_test_group(&x_options_x) == 0;
+            ok = ! x_options_x.m_Need_Subtests;
 
          unit_test_status_pass(&status, ok);
       }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit/regression test to verify the "test case"
- *    functionality.
- *
- * \group
- *    3. unit_test_options_t functions.
- *
- * \case
- *   18. Accessors for the --case option.
- *
- * \test
- *    -  unit_test_options_test_case_set()
- *    -  unit_test_options_test_case()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /*  3 */
 
-static unit_test_status_t
-unit_unit_test_03_18 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 3, 18,
-      "unit_test_options_t", "unit_test_options_test_case...()"
-   );
-   if (ok)
-   {
-      unit_test_options_t x_options_x;
-      ok = unit_test_options_init(&x_options_x);
       if (ok)
-         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+         ok = unit_test_options_init(&x_options_x);
 
-      /*  1 */
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      if (unit_test_status_next_subtest(&status, "--summarize test"))
       {
-         cbool_t null_ok = ! unit_test_options_test_case_set(nullptr, 0);
-         if (null_ok)
-            null_ok = ! unit_test_options_test_case_set(nullptr, 1);
-
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  2 */
+         if (ok)
+         {
+            x_options_x.m_Interactive        = true;
+            x_options_x.m_Summarize          = true;
+            x_options_x.m_Case_Pause         = true;
+            argv[0]  = "unit_test_test";
+            argv[1]  = "--batch-mode---ignore";
+            argv[2]  = "--interactive---ignore";
+            argv[3]  = "--summarize";              /* affects other options   */
+            argc = 4;
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv,
+               "03.05", "version", "additionalhelp"
+            );
+         }
+         if (ok)
+         {
+            /*
+             * --summarize no longer sets this variable.
+             *
+             * ok = xpccut_is_silent();            // did --summarize work?
+             */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
-      {
-         cbool_t null_ok =
-         (
-            unit_test_options_test_case(nullptr) == XPCCUT_NO_SINGLE_CASE
-         );
-         unit_test_status_pass(&status, null_ok);
-      }
+            /*
+             * Now restore the original setting of the silence flag, so that
+             * the output of the unit-test will have the appearance expected
+             * by the dude who ran this test.
+             */
 
-      /*  3 */
+            if (original_silence_setting)
+               xpccut_silence_printing();
+            else
+               xpccut_allow_printing();
+         }
 
-      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
-      {
          /*
-          * Set explicitly to make sure the correct value replaces this one.
+          * We check more than we really need to, here.
           */
 
-         x_options_x.m_Single_Test_Case = 5;
-         ok = ! unit_test_options_test_case_set(&x_options_x, -1);
          if (ok)
-            ok = x_options_x.m_Single_Test_Case == 0;
+            ok = ! x_options_x.m_Interactive;
 
          if (ok)
-            ok = unit_test_options_test_case(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
+            ok = ! x_options_x.m_Show_Step_Numbers;
 
-      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
-      {
-         x_options_x.m_Single_Test_Case = 5;
          if (ok)
-            ok = unit_test_options_test_case_set(&x_options_x, 0);
+            ok = ! x_options_x.m_Show_Values;
 
          if (ok)
-            ok = x_options_x.m_Single_Test_Case == 0;
+            ok = ! x_options_x.m_Is_Verbose;
 
          if (ok)
-            ok = unit_test_options_test_case(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
-      }
+            ok = ! x_options_x.m_Case_Pause;
 
-      /*  5 */
+         if (ok)
+            ok = x_options_x.m_Summarize;
 
-      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
-      {
-         x_options_x.m_Single_Test_Case = 5;
          if (ok)
-            ok = unit_test_options_test_case_set(&x_options_x, 1);
+            ok = ! x_options_x.m_Need_Subtests;
 
-         /*
-          * This is the first way to do this check:
-          */
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = x_options_x.m_Single_Test_Case == 1;
+      /*  3 */
 
-         /*
-          * This is another way to do this check:
-          */
+      if (ok)
+         ok = unit_test_options_init(&x_options_x);
 
-         if (ok)
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      if (unit_test_status_next_subtest(&status, "--version test"))
+      {
+         cbool_t null_ok;
+         xpccut_silence_printing();
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--version";
+         argc = 2;
+         null_ok = ! unit_test_options_parse
+         (
+            &x_options_x, argc, argv,
+            "03.05", nullptr, "additionalhelp"
+         );
+         if (null_ok)
          {
-            ok = unit_test_status_int_check
+            null_ok = ! unit_test_options_parse
             (
-               &status, x_options_x.m_Single_Test_Case, 1
+               &x_options_x, argc, argv,
+               "03.05", "version", "additionalhelp"
             );
          }
 
          /*
-          * This is yet another way to do this check.
+          * Restore the original setting of the silence flag.
           */
 
-         if (ok)
-            ok = unit_test_options_test_case(&x_options_x) == 1;
+         if (original_silence_setting)
+            xpccut_silence_printing();
+         else
+            xpccut_allow_printing();
 
-         /*
-          * This is yet another way to do this check.  Four different ways
-          * to do the same check!
-          */
+         unit_test_status_pass(&status, null_ok);
+      }
 
-         if (ok)
+      /*  4 */
+
+      if (ok)
+         ok = unit_test_options_init(&x_options_x);
+
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      if (unit_test_status_next_subtest(&status, "--help test"))
+      {
+         cbool_t null_ok;
+         xpccut_silence_printing();
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--help";
+         argc = 2;
+         null_ok = ! unit_test_options_parse
+         (
+            &x_options_x, argc, argv, "03.05", "version", nullptr
+         );
+         if (null_ok)
          {
-            ok = unit_test_status_int_check
+            null_ok = ! unit_test_options_parse
             (
-               &status, unit_test_options_test_case(&x_options_x), 1
+               &x_options_x, argc, argv,
+               nullptr, "version", "additionalhelp"
+            );
+         }
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, argv,
+               "03.05", "version", "additionalhelp"
             );
          }
 
          /*
-          * If all the checks above used unit_test_status_int_check(), this
-          * line of code would be redundant.
+          * Restore the original setting of the silence flag.
           */
 
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  6 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to 101, set/get"))
-      {
-         x_options_x.m_Single_Test_Case = 5;
-         if (ok)
-            ok = ! unit_test_options_test_case_set(&x_options_x, 101);
-
-         if (ok)
-            ok = x_options_x.m_Single_Test_Case == 0;
-
-         if (ok)
-            ok = unit_test_options_test_case(&x_options_x) == 0;
+         if (original_silence_setting)
+            xpccut_silence_printing();
+         else
+            xpccut_allow_printing();
 
-         unit_test_status_pass(&status, ok);
+         unit_test_status_pass(&status, null_ok);
       }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "subtest"
+ *    Provides a unit/regression test to verify the "is-verbose"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   19. Accessors for the --subtest or --sub-test option.
+ *    6. Accessors for the --verbose option.
  *
  * \test
- *    -  unit_test_options_single_subtest_set()
- *    -  unit_test_options_single_subtest()
+ *    -  unit_test_options_is_verbose_set()
+ *    -  unit_test_options_is_verbose()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7316,13 +8058,13 @@ unit_unit_test_03_18 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_19 (const unit_test_options_t * options)
+unit_unit_test_03_06 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 19,
-      "unit_test_options_t", "unit_test_options_single_subtest...()"
+      &status, options, 3, 6,
+      "unit_test_options_t", "unit_test_options_is_verbose...()"
    );
    if (ok)
    {
@@ -7335,9 +8077,9 @@ unit_unit_test_03_19 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_single_subtest_set(nullptr, 0);
+         cbool_t null_ok = ! unit_test_options_is_verbose_set(nullptr, false);
          if (null_ok)
-            null_ok = ! unit_test_options_single_subtest_set(nullptr, 1);
+            null_ok = ! unit_test_options_is_verbose_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7348,78 +8090,39 @@ unit_unit_test_03_19 (const unit_test_options_t * options)
       {
          cbool_t null_ok =
          (
-            unit_test_options_single_subtest(nullptr) ==
-               XPCCUT_NO_SINGLE_SUB_TEST
+            unit_test_options_is_verbose(nullptr) == XPCCUT_IS_VERBOSE
          );
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
-      {
-         /*
-          * Set explicitly to make sure the correct value replaces this one.
-          */
-
-         x_options_x.m_Single_Sub_Test = 5;
-         ok = ! unit_test_options_single_subtest_set(&x_options_x, -1);
-         if (ok)
-            ok = x_options_x.m_Single_Sub_Test == 0;
-
-         if (ok)
-            ok = unit_test_options_single_subtest(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
-      {
-         x_options_x.m_Single_Sub_Test = 5;
-         if (ok)
-            ok = unit_test_options_single_subtest_set(&x_options_x, 0);
-
-         if (ok)
-            ok = x_options_x.m_Single_Sub_Test == 0;
-
-         if (ok)
-            ok = unit_test_options_single_subtest(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  5 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         x_options_x.m_Single_Sub_Test = 5;
          if (ok)
-            ok = unit_test_options_single_subtest_set(&x_options_x, 1);
+            ok = unit_test_options_is_verbose_set(&x_options_x, false);
 
          if (ok)
-            ok = x_options_x.m_Single_Sub_Test == 1;
+            ok = ! x_options_x.m_Is_Verbose;
 
          if (ok)
-            ok = unit_test_options_single_subtest(&x_options_x) == 1;
+            ok = ! unit_test_options_is_verbose(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  6 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to 1001, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         x_options_x.m_Single_Sub_Test = 5;
          if (ok)
-            ok = ! unit_test_options_single_subtest_set(&x_options_x, 1001);
+            ok = unit_test_options_is_verbose_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Single_Sub_Test == 0;
+            ok = x_options_x.m_Is_Verbose;
 
          if (ok)
-            ok = unit_test_options_single_subtest(&x_options_x) == 0;
+            ok = unit_test_options_is_verbose(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -7428,18 +8131,18 @@ unit_unit_test_03_19 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "test sleep-time"
+ *    Provides a unit/regression test to verify the "show-values"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   20. Accessors for the --sleep-time option.
+ *    7. Accessors for the --show-values option.
  *
  * \test
- *    -  unit_test_options_test_sleep_time_set()
- *    -  unit_test_options_test_sleep_time()
+ *    -  unit_test_options_show_values_set()
+ *    -  unit_test_options_show_values()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7449,13 +8152,13 @@ unit_unit_test_03_19 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_20 (const unit_test_options_t * options)
+unit_unit_test_03_07 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 20,
-      "unit_test_options_t", "unit_test_options_test_sleep_time...()"
+      &status, options, 3, 7,
+      "unit_test_options_t", "unit_test_options_is_show_values...()"
    );
    if (ok)
    {
@@ -7468,12 +8171,9 @@ unit_unit_test_03_20 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_test_sleep_time_set
-         (
-            nullptr, false
-         );
+         cbool_t null_ok = ! unit_test_options_show_values_set(nullptr, false);
          if (null_ok)
-            null_ok = ! unit_test_options_test_sleep_time_set(nullptr, true);
+            null_ok = ! unit_test_options_show_values_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7484,98 +8184,63 @@ unit_unit_test_03_20 (const unit_test_options_t * options)
       {
          cbool_t null_ok =
          (
-            unit_test_options_test_sleep_time(nullptr) == XPCCUT_TEST_SLEEP_TIME
+            unit_test_options_show_values(nullptr) == XPCCUT_SHOW_VALUES
          );
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         /*
-          * Set explicitly to make sure the correct value replaces this one.
-          */
+         if (ok)
+            ok = unit_test_options_show_values_set(&x_options_x, false);
 
-         x_options_x.m_Test_Sleep_Time = 5;
-         ok = ! unit_test_options_test_sleep_time_set(&x_options_x, -1);
          if (ok)
-            ok = x_options_x.m_Test_Sleep_Time == 0;
+            ok = ! x_options_x.m_Show_Values;
 
          if (ok)
-            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
+            ok = ! unit_test_options_show_values(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         x_options_x.m_Test_Sleep_Time = 5;
          if (ok)
-            ok = unit_test_options_test_sleep_time_set(&x_options_x, 0);
+            ok = unit_test_options_show_values_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Test_Sleep_Time == 0;
+            ok = x_options_x.m_Show_Values;
 
          if (ok)
-            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
+            ok = unit_test_options_show_values(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
-
-      /*  5 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
-      {
-         x_options_x.m_Test_Sleep_Time = 5;
-         if (ok)
-            ok = unit_test_options_test_sleep_time_set(&x_options_x, 1);
-
-         if (ok)
-            ok = x_options_x.m_Test_Sleep_Time == 1;
-
-         if (ok)
-            ok = unit_test_options_test_sleep_time(&x_options_x) == 1;
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  6 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to 3600001, set/get"))
-      {
-         x_options_x.m_Test_Sleep_Time = 5;
-         if (ok)
-            ok = ! unit_test_options_test_sleep_time_set(&x_options_x, 3600001);
-
-         if (ok)
-            ok = x_options_x.m_Test_Sleep_Time == 0;
-
-         if (ok)
-            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
-      }
-   }
-   return status;
-}
+   }
+   return status;
+}
 
 /**
- *    Provides a unit/regression test to verify the "named test group"
+ *    Provides a unit/regression test to verify the "text-synch"
  *    functionality.
  *
+ * \note
+ *    Although the unit_test_options_t.m_Text_Synch variable is supported,
+ *    the actual usage of a synchronization object has not yet been added.
+ *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   21. Accessors for the --group option using the name of the test instead
- *       of the number of the test.
+ *    8. Accessors for the --text-synch option.
  *
  * \test
- *    -  unit_test_options_named_group_set()
- *    -  unit_test_options_named_group()
+ *    -  unit_test_options_use_text_synch_set()
+ *    -  unit_test_options_use_text_synch()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7585,13 +8250,13 @@ unit_unit_test_03_20 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_21 (const unit_test_options_t * options)
+unit_unit_test_03_08 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 21,
-      "unit_test_options_t", "unit_test_options_named_group...()"
+      &status, options, 3, 8,
+      "unit_test_options_t", "unit_test_options_use_text_synch...()"
    );
    if (ok)
    {
@@ -7604,9 +8269,9 @@ unit_unit_test_03_21 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_named_group_set(nullptr, nullptr);
+         cbool_t null_ok = ! unit_test_options_use_text_synch_set(nullptr, false);
          if (null_ok)
-            null_ok = ! unit_test_options_named_group_set(nullptr, "!");
+            null_ok = ! unit_test_options_use_text_synch_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7615,65 +8280,42 @@ unit_unit_test_03_21 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         cbool_t null_ok = cut_is_nullptr(unit_test_options_named_group(nullptr));
+         cbool_t null_ok =
+         (
+            unit_test_options_use_text_synch(nullptr) == XPCCUT_TEXT_SYNCH
+         );
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         /*
-          * Set explicitly to make sure the value is not modified.  We don't
-          * bother making sure a 3-character string can be copied here.
-          */
+         if (ok)
+            ok = unit_test_options_use_text_synch_set(&x_options_x, false);
 
-         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!");
-         ok = ! unit_test_options_named_group_set(&x_options_x, nullptr);
          if (ok)
-            ok = strcmp(x_options_x.m_Single_Test_Group_Name, "!!!") == 0;
+            ok = ! x_options_x.m_Text_Synch;
 
          if (ok)
-            ok = strcmp(unit_test_options_named_group(&x_options_x), "!!!") == 0;
+            ok = ! unit_test_options_use_text_synch(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!");
          if (ok)
-            ok = unit_test_options_named_group_set(&x_options_x, "");
-
-         if (ok)
-            ok = strlen(x_options_x.m_Single_Test_Group_Name) == 0;
-
-         if (ok)
-            ok = cut_is_nullptr(unit_test_options_named_group(&x_options_x));
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  5 */
+            ok = unit_test_options_use_text_synch_set(&x_options_x, true);
 
-      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
-      {
-         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!!!");
          if (ok)
-            ok = unit_test_options_named_group_set(&x_options_x, "0xDEADBEEF");
+            ok = x_options_x.m_Text_Synch;
 
          if (ok)
-            ok = strcmp(x_options_x.m_Single_Test_Group_Name, "0xDEADBEEF") == 0;
+            ok = unit_test_options_use_text_synch(&x_options_x);
 
-         if (ok)
-         {
-            ok = 0 == strcmp
-            (
-               unit_test_options_named_group(&x_options_x), "0xDEADBEEF"
-            );
-         }
          unit_test_status_pass(&status, ok);
       }
    }
@@ -7681,19 +8323,18 @@ unit_unit_test_03_21 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "named test case"
+ *    Provides a unit/regression test to verify the "step-numbers"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   22. Accessors for the --case option using the named of the test case
- *   instead of the test-case number.
+ *    9. Accessors for the --show-step-numbers option.
  *
  * \test
- *    -  unit_test_options_named_case_set()
- *    -  unit_test_options_named_case()
+ *    -  unit_test_options_show_step_numbers_set()
+ *    -  unit_test_options_show_step_numbers()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7703,13 +8344,13 @@ unit_unit_test_03_21 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_22 (const unit_test_options_t * options)
+unit_unit_test_03_09 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 22,
-      "unit_test_options_t", "unit_test_options_named_case...()"
+      &status, options, 3, 9,
+      "unit_test_options_t", "unit_test_options_show_step_numbers...()"
    );
    if (ok)
    {
@@ -7722,9 +8363,12 @@ unit_unit_test_03_22 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_named_case_set(nullptr, nullptr);
+         cbool_t null_ok = ! unit_test_options_show_step_numbers_set
+         (
+            nullptr, false
+         );
          if (null_ok)
-            null_ok = ! unit_test_options_named_case_set(nullptr, "!");
+            null_ok = ! unit_test_options_show_step_numbers_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7732,66 +8376,55 @@ unit_unit_test_03_22 (const unit_test_options_t * options)
       /*  2 */
 
       if (unit_test_status_next_subtest(&status, "Null 'this', get"))
-      {
-         cbool_t null_ok = cut_is_nullptr(unit_test_options_named_case(nullptr));
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
       {
          /*
-          * Set explicitly to make sure the value is not modified.  We don't
-          * bother making sure a 3-character string can be copied here.
+          * Let's do this a different way, just to show another way to do
+          * it.
+          *
+          * cbool_t null_ok =
+          * (
+          *    unit_test_options_show_step_numbers(nullptr) ==
+          *       XPCCUT_SHOW_STEP_NUMBERS
+          * );
+          * unit_test_status_pass(&status, null_ok);
           */
 
-         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!");
-         ok = ! unit_test_options_named_case_set(&x_options_x, nullptr);
-         if (ok)
-            ok = strcmp(x_options_x.m_Single_Test_Case_Name, "!!!") == 0;
-
-         if (ok)
-            ok = strcmp(unit_test_options_named_case(&x_options_x), "!!!") == 0;
-
-         unit_test_status_pass(&status, ok);
+         (void) unit_test_status_bool_check
+         (
+            &status, unit_test_options_show_step_numbers(nullptr),
+            XPCCUT_SHOW_STEP_NUMBERS
+         );
       }
 
-      /*  4 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!");
          if (ok)
-            ok = unit_test_options_named_case_set(&x_options_x, "");
+            ok = unit_test_options_show_step_numbers_set(&x_options_x, false);
 
          if (ok)
-            ok = strlen(x_options_x.m_Single_Test_Case_Name) == 0;
+            ok = ! x_options_x.m_Show_Step_Numbers;
 
          if (ok)
-            ok = cut_is_nullptr(unit_test_options_named_case(&x_options_x));
+            ok = ! unit_test_options_show_step_numbers(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  5 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!!!");
          if (ok)
-            ok = unit_test_options_named_case_set(&x_options_x, "0xDEADBEEF");
+            ok = unit_test_options_show_step_numbers_set(&x_options_x, true);
 
          if (ok)
-            ok = strcmp(x_options_x.m_Single_Test_Case_Name, "0xDEADBEEF") == 0;
+            ok = x_options_x.m_Show_Step_Numbers;
 
          if (ok)
-         {
-            ok = 0 == strcmp
-            (
-               unit_test_options_named_case(&x_options_x), "0xDEADBEEF"
-            );
-         }
+            ok = unit_test_options_show_step_numbers(&x_options_x);
+
          unit_test_status_pass(&status, ok);
       }
    }
@@ -7799,19 +8432,21 @@ unit_unit_test_03_22 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "named test sub-test"
+ *    Provides a unit/regression test to verify the "show-progress"
  *    functionality.
  *
+ * \note
+ *    This function affects more than one field if the flag is set to false.
+ *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   23. Accessors for the --subtest option using the name of the sub-test
- *       instead of the sub-test number.
+ *   10. Accessors for the --show-progress option.
  *
  * \test
- *    -  unit_test_options_named_subtest_set()
- *    -  unit_test_options_named_subtest()
+ *    -  unit_test_options_show_progress_set()
+ *    -  unit_test_options_show_progress()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7821,13 +8456,13 @@ unit_unit_test_03_22 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_23 (const unit_test_options_t * options)
+unit_unit_test_03_10 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 23,
-      "unit_test_options_t", "unit_test_options_named_subtest...()"
+      &status, options, 3, 10,
+      "unit_test_options_t", "unit_test_options_show_progress...()"
    );
    if (ok)
    {
@@ -7840,12 +8475,12 @@ unit_unit_test_03_23 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_named_subtest_set
+         cbool_t null_ok = ! unit_test_options_show_progress_set
          (
-            nullptr, nullptr
+            nullptr, false
          );
          if (null_ok)
-            null_ok = ! unit_test_options_named_subtest_set(nullptr, "!");
+            null_ok = ! unit_test_options_show_progress_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7854,67 +8489,93 @@ unit_unit_test_03_23 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         cbool_t null_ok =
-            cut_is_nullptr(unit_test_options_named_subtest(nullptr));
+         cbool_t null_ok;
+         cbool_t match = XPCCUT_SHOW_PROGRESS;
+
+         /*
+          * This makes no sense.  Besides, --hide-errors affects this
+          * function, and thus using it can make the unit-test fail.
+          * Useless!
+          *
+          * if (xpccut_is_silent())                   // --silent in force?
+          *    match = false;
+          *
+          * null_ok = unit_test_options_show_progress(nullptr) == match;
+          */
 
+         null_ok = unit_test_options_show_progress(nullptr) == match;
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
+         if (ok)
+            ok = unit_test_options_show_progress_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! x_options_x.m_Show_Progress;
+
+         if (ok)
+            ok = ! unit_test_options_show_progress(&x_options_x);
+
          /*
-          * Set explicitly to make sure the value is not modified.  We don't
-          * bother making sure a 3-character string can be copied here.
+          * These settings are side-effects.
           */
 
-         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!");
-         ok = ! unit_test_options_named_subtest_set(&x_options_x, nullptr);
          if (ok)
-            ok = strcmp(x_options_x.m_Single_Sub_Test_Name, "!!!") == 0;
+            ok = ! x_options_x.m_Show_Step_Numbers;
 
          if (ok)
-            ok = strcmp(unit_test_options_named_subtest(&x_options_x), "!!!")
-                     == 0;
+            ok = ! x_options_x.m_Show_Values;
+
+         if (ok)
+            ok = ! x_options_x.m_Is_Verbose;
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!");
-         if (ok)
-            ok = unit_test_options_named_subtest_set(&x_options_x, "");
-
          if (ok)
-            ok = strlen(x_options_x.m_Single_Sub_Test_Name) == 0;
+            ok = unit_test_options_show_progress_set(&x_options_x, true);
 
          if (ok)
-            ok = cut_is_nullptr(unit_test_options_named_subtest(&x_options_x));
+            ok = x_options_x.m_Show_Progress;
 
-         unit_test_status_pass(&status, ok);
-      }
+         /*
+          * These settings are side-effects, but the values are not changed
+          * when setting the flag to true.
+          */
 
-      /*  5 */
+         if (ok)
+            ok = ! x_options_x.m_Show_Step_Numbers;
 
-      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
-      {
-         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!!!");
          if (ok)
-            ok = unit_test_options_named_subtest_set(&x_options_x, "0xDEADBEEF");
+            ok = ! x_options_x.m_Show_Values;
 
          if (ok)
-            ok = strcmp(x_options_x.m_Single_Sub_Test_Name, "0xDEADBEEF") == 0;
+            ok = ! x_options_x.m_Is_Verbose;
 
          if (ok)
          {
-            ok = 0 == strcmp
-            (
-               unit_test_options_named_subtest(&x_options_x), "0xDEADBEEF"
-            );
+            /*
+             * This may be unwise, but the show-progress function also
+             * checks the --silent option internally.  At any rate, we have
+             * to account for that.
+             **
+             * \change ca 04/23/2008
+             *    No, this is no longer true.  We have to ignore this
+             *    sub-sub-test.
+             **
+             * if (xpccut_is_silent())
+             *    ok = ! unit_test_options_show_progress(&x_options_x);
+             * else
+             *    ok = unit_test_options_show_progress(&x_options_x);
+             */
          }
          unit_test_status_pass(&status, ok);
       }
@@ -7923,18 +8584,18 @@ unit_unit_test_03_23 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "require-sub-tests"
+ *    Provides a unit/regression test to verify the "stop-on-error"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   24. Accessors for the --require-subtests option.
+ *   11. Accessors for the --stop-on-error option.
  *
  * \test
- *    -  unit_test_options_need_subtests_set()
- *    -  unit_test_options_need_subtests()
+ *    -  unit_test_options_stop_on_error_set()
+ *    -  unit_test_options_stop_on_error()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -7944,13 +8605,13 @@ unit_unit_test_03_23 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_24 (const unit_test_options_t * options)
+unit_unit_test_03_11 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 24,
-      "unit_test_options_t", "unit_test_options_need_subtests...()"
+      &status, options, 3, 11,
+      "unit_test_options_t", "unit_test_options_stop_on_error...()"
    );
    if (ok)
    {
@@ -7963,12 +8624,12 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_need_subtests_set
+         cbool_t null_ok = ! unit_test_options_stop_on_error_set
          (
             nullptr, false
          );
          if (null_ok)
-            null_ok = ! unit_test_options_need_subtests_set(nullptr, true);
+            null_ok = ! unit_test_options_stop_on_error_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -7979,7 +8640,7 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
       {
          cbool_t null_ok =
          (
-            unit_test_options_need_subtests(nullptr) == XPCCUT_NEED_SUBTESTS
+            unit_test_options_stop_on_error(nullptr) == XPCCUT_STOP_ON_ERROR
          );
          unit_test_status_pass(&status, null_ok);
       }
@@ -7989,13 +8650,13 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
          if (ok)
-            ok = unit_test_options_need_subtests_set(&x_options_x, false);
+            ok = unit_test_options_stop_on_error_set(&x_options_x, false);
 
          if (ok)
-            ok = ! x_options_x.m_Need_Subtests;
+            ok = ! x_options_x.m_Stop_On_Error;
 
          if (ok)
-            ok = ! unit_test_options_need_subtests(&x_options_x);
+            ok = ! unit_test_options_stop_on_error(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -8005,13 +8666,13 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
          if (ok)
-            ok = unit_test_options_need_subtests_set(&x_options_x, true);
+            ok = unit_test_options_stop_on_error_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Need_Subtests;
+            ok = x_options_x.m_Stop_On_Error;
 
          if (ok)
-            ok = unit_test_options_need_subtests(&x_options_x);
+            ok = unit_test_options_stop_on_error(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -8020,18 +8681,18 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the "force-failure"
+ *    Provides a unit/regression test to verify the "batch-mode"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   25. Accessors for the --force-failure option.
+ *   12. Accessors for the --batch-mode option.
  *
  * \test
- *    -  unit_test_options_force_failure_set()
- *    -  unit_test_options_force_failure()
+ *    -  unit_test_options_batch_mode_set()
+ *    -  unit_test_options_batch_mode()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8041,13 +8702,13 @@ unit_unit_test_03_24 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_25 (const unit_test_options_t * options)
+unit_unit_test_03_12 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 25,
-      "unit_test_options_t", "unit_test_options_force_failure...()"
+      &status, options, 3, 12,
+      "unit_test_options_t", "unit_test_options_batch_mode...()"
    );
    if (ok)
    {
@@ -8060,12 +8721,12 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_force_failure_set
+         cbool_t null_ok = ! unit_test_options_batch_mode_set
          (
             nullptr, false
          );
          if (null_ok)
-            null_ok = ! unit_test_options_force_failure_set(nullptr, true);
+            null_ok = ! unit_test_options_batch_mode_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -8076,7 +8737,7 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
       {
          cbool_t null_ok =
          (
-            unit_test_options_force_failure(nullptr) == XPCCUT_FORCE_FAILURE
+            unit_test_options_batch_mode(nullptr) == XPCCUT_BATCH_MODE
          );
          unit_test_status_pass(&status, null_ok);
       }
@@ -8086,13 +8747,26 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
          if (ok)
-            ok = unit_test_options_force_failure_set(&x_options_x, false);
+            ok = unit_test_options_batch_mode_set(&x_options_x, false);
 
          if (ok)
-            ok = ! x_options_x.m_Force_Failure;
+            ok = ! x_options_x.m_Batch_Mode;
 
          if (ok)
-            ok = ! unit_test_options_force_failure(&x_options_x);
+            ok = ! unit_test_options_batch_mode(&x_options_x);
+
+         /*
+          * These settings are side-effects.
+          */
+
+         if (ok)
+            ok = ! x_options_x.m_Show_Step_Numbers;
+
+         if (ok)
+            ok = ! x_options_x.m_Show_Values;
+
+         if (ok)
+            ok = ! x_options_x.m_Is_Verbose;
 
          unit_test_status_pass(&status, ok);
       }
@@ -8102,13 +8776,41 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
          if (ok)
-            ok = unit_test_options_force_failure_set(&x_options_x, true);
+            ok = unit_test_options_batch_mode_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Force_Failure;
+            ok = x_options_x.m_Batch_Mode;
 
          if (ok)
-            ok = unit_test_options_force_failure(&x_options_x);
+            ok = unit_test_options_batch_mode(&x_options_x);
+
+         /*
+          * The unit_test_options_batch_mode_set() function also sets these
+          * variables, but only if the boolean parameter is true.
+          */
+
+         if (ok)
+            ok = x_options_x.m_Interactive;
+
+         if (ok)
+            ok = x_options_x.m_Response_Before = 'c';
+
+         if (ok)
+            ok = x_options_x.m_Response_After = 'p';
+
+         /*
+          * These settings are side-effects, but the values are not changed
+          * when setting the flag to true or false.
+          */
+
+         if (ok)
+            ok = ! x_options_x.m_Show_Step_Numbers;
+
+         if (ok)
+            ok = ! x_options_x.m_Show_Values;
+
+         if (ok)
+            ok = ! x_options_x.m_Is_Verbose;
 
          unit_test_status_pass(&status, ok);
       }
@@ -8117,19 +8819,18 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the
- *    "get-current-test-number" functionality.
- *
- *    There's probably more that can be done with this test.
+ *    Provides a unit/regression test to verify the "interactive"
+ *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   26. unit_test_options_current_test()
+ *   13. Accessors for the --interactive option.
  *
  * \test
- *    -  unit_test_options_current_test()
+ *    -  unit_test_options_is_interactive_set()
+ *    -  unit_test_options_is_interactive()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8139,13 +8840,13 @@ unit_unit_test_03_25 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_26 (const unit_test_options_t * options)
+unit_unit_test_03_13 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 26,
-      "unit_test_options_t", "unit_test_options_current_test()"
+      &status, options, 3, 13,
+      "unit_test_options_t", "unit_test_options_is_interactive...()"
    );
    if (ok)
    {
@@ -8156,20 +8857,57 @@ unit_unit_test_03_26 (const unit_test_options_t * options)
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_options_current_test(nullptr) ==
-            XPCCUT_NO_CURRENT_TEST;
+         cbool_t null_ok = ! unit_test_options_is_interactive_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_is_interactive_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "get"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         ok =  unit_test_options_current_test(&x_options_x) ==
-            XPCCUT_NO_CURRENT_TEST;
+         cbool_t null_ok =
+         (
+            unit_test_options_is_interactive(nullptr) == XPCCUT_INTERACTIVE
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
+      {
+         if (ok)
+            ok = unit_test_options_is_interactive_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! x_options_x.m_Interactive;
+
+         if (ok)
+            ok = ! unit_test_options_is_interactive(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
+      {
+         if (ok)
+            ok = unit_test_options_is_interactive_set(&x_options_x, true);
+
+         if (ok)
+            ok = x_options_x.m_Interactive;
+
+         if (ok)
+            ok = unit_test_options_is_interactive(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -8178,18 +8916,18 @@ unit_unit_test_03_26 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify the
- *    "prompt-before/response-before" functionality.
+ *    Provides a unit/regression test to verify the "beep"
+ *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   27. Accessors for the --response-before option.
+ *   14. Accessors for the --beeps option.
  *
  * \test
- *    -  unit_test_options_prompt_before_set()
- *    -  unit_test_options_prompt_before()
+ *    -  unit_test_options_do_beep_set()
+ *    -  unit_test_options_do_beep()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8199,13 +8937,13 @@ unit_unit_test_03_26 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_27 (const unit_test_options_t * options)
+unit_unit_test_03_14 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 27,
-      "unit_test_options_t", "unit_test_options_prompt_before()"
+      &status, options, 3, 14,
+      "unit_test_options_t", "unit_test_options_do_beep...()"
    );
    if (ok)
    {
@@ -8216,153 +8954,77 @@ unit_unit_test_03_27 (const unit_test_options_t * options)
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t not_ok = ! unit_test_options_prompt_before_set(nullptr, 0);
-         if (not_ok)
-            not_ok = unit_test_options_prompt_before(nullptr) == 0;
+         cbool_t null_ok = ! unit_test_options_do_beep_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_do_beep_set(nullptr, true);
 
-         unit_test_status_pass(&status, not_ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Zero value"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         ok = unit_test_options_prompt_before_set(&x_options_x, 0);
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok =
+         (
+            unit_test_options_do_beep(nullptr) == XPCCUT_BEEP
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "'c' value"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         /*
-          * Note how the upper-case value is mapped to lower-case when
-          * stored, for easier usage in the unit-test library.
-          */
-
-         ok = unit_test_options_prompt_before_set(&x_options_x, 'c');
          if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'c';
+            ok = unit_test_options_do_beep_set(&x_options_x, false);
 
          if (ok)
-            ok = unit_test_options_prompt_before_set(&x_options_x, 'C');
-
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'c';
-
-         if (ok)
-            ok = x_options_x.m_Response_Before = 'c';
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "'s' value"))
-      {
-         ok = unit_test_options_prompt_before_set(&x_options_x, 's');
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 's';
-
-         if (ok)
-            ok = unit_test_options_prompt_before_set(&x_options_x, 'S');
-
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 's';
+            ok = ! x_options_x.m_Beep_Prompt;
 
          if (ok)
-            ok = x_options_x.m_Response_Before = 's';
+            ok = ! unit_test_options_do_beep(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "'a' value"))
-      {
-         ok = unit_test_options_prompt_before_set(&x_options_x, 'a');
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'a';
-
-         if (ok)
-            ok = unit_test_options_prompt_before_set(&x_options_x, 'A');
-
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'a';
-
-         if (ok)
-            ok = x_options_x.m_Response_Before = 'a';
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  5 */
-
-      if (unit_test_status_next_subtest(&status, "'q' value"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         ok = unit_test_options_prompt_before_set(&x_options_x, 'q');
-         if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'q';
-
          if (ok)
-            ok = unit_test_options_prompt_before_set(&x_options_x, 'Q');
+            ok = unit_test_options_do_beep_set(&x_options_x, true);
 
          if (ok)
-            ok = unit_test_options_prompt_before(&x_options_x) == 'q';
+            ok = x_options_x.m_Beep_Prompt;
 
          if (ok)
-            ok = x_options_x.m_Response_Before = 'q';
+            ok = unit_test_options_do_beep(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
-
-      /*  6 */
-
-      if (unit_test_status_next_subtest(&status, "Unsupported value"))
-      {
-         if (ok)
-         {
-            cbool_t not_ok = ! unit_test_options_prompt_before_set
-            (
-               &x_options_x, '1'    /* '1' is not a valid response character  */
-            );
-
-            /*
-             * The value from the previous sub-test should still be in
-             * force.
-             */
-
-            if (not_ok)
-               not_ok = unit_test_options_prompt_before(&x_options_x) == 'q';
-
-            if (not_ok)
-               not_ok = x_options_x.m_Response_Before = 'q';
-
-            unit_test_status_pass(&status, not_ok);
-         }
-      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the
- *    "prompt-after/response-after" functionality.
+ *    Provides a unit/regression test to verify the "summarize"
+ *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   28. Accessors for the --response-after option.
+ *   15. Accessors for the --summarize option.
  *
  * \test
- *    -  unit_test_options_prompt_after_set()
- *    -  unit_test_options_prompt_after()
+ *    -  unit_test_options_is_summary_set()
+ *    -  unit_test_options_is_summary()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8372,13 +9034,13 @@ unit_unit_test_03_27 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_28 (const unit_test_options_t * options)
+unit_unit_test_03_15 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 28,
-      "unit_test_options_t", "unit_test_options_prompt_after()"
+      &status, options, 3, 15,
+      "unit_test_options_t", "unit_test_options_is_summary...()"
    );
    if (ok)
    {
@@ -8389,153 +9051,98 @@ unit_unit_test_03_28 (const unit_test_options_t * options)
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t not_ok = ! unit_test_options_prompt_after_set(nullptr, 0);
-         if (not_ok)
-            not_ok = unit_test_options_prompt_after(nullptr) == 0;
+         cbool_t null_ok = ! unit_test_options_is_summary_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_is_summary_set(nullptr, true);
 
-         unit_test_status_pass(&status, not_ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Zero value"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         ok = unit_test_options_prompt_after_set(&x_options_x, 0);
-         if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 0;
-
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok =
+         (
+            unit_test_options_is_summary(nullptr) == XPCCUT_SUMMARIZE
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "'p' value"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         /*
-          * Note how the upper-case value is mapped to lower-case when
-          * stored, for easier usage in the unit-test library.
-          */
-
-         ok = unit_test_options_prompt_after_set(&x_options_x, 'p');
-         if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'p';
-
-         if (ok)
-            ok = unit_test_options_prompt_after_set(&x_options_x, 'P');
-
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'p';
+            ok = unit_test_options_is_summary_set(&x_options_x, false);
 
          if (ok)
-            ok = x_options_x.m_Response_After = 'p';
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  3 */
+            ok = ! x_options_x.m_Summarize;
 
-      if (unit_test_status_next_subtest(&status, "'f' value"))
-      {
-         ok = unit_test_options_prompt_after_set(&x_options_x, 'f');
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'f';
+            ok = ! unit_test_options_is_summary(&x_options_x);
 
-         if (ok)
-            ok = unit_test_options_prompt_after_set(&x_options_x, 'F');
+         /*
+          * The following settings are side-effects.
+          */
 
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'f';
+            ok = ! x_options_x.m_Interactive;
 
          if (ok)
-            ok = x_options_x.m_Response_After = 'f';
+            ok = ! x_options_x.m_Case_Pause;
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "'a' value"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         ok = unit_test_options_prompt_after_set(&x_options_x, 'a');
-         if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'a';
-
-         if (ok)
-            ok = unit_test_options_prompt_after_set(&x_options_x, 'A');
-
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'a';
+            ok = unit_test_options_is_summary_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Response_After = 'a';
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  5 */
+            ok = x_options_x.m_Summarize;
 
-      if (unit_test_status_next_subtest(&status, "'q' value"))
-      {
-         ok = unit_test_options_prompt_after_set(&x_options_x, 'q');
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'q';
+            ok = unit_test_options_is_summary(&x_options_x);
 
-         if (ok)
-            ok = unit_test_options_prompt_after_set(&x_options_x, 'Q');
+         /*
+          * The following settings are side-effects that do not get undone
+          * by setting the flag to true.
+          */
 
          if (ok)
-            ok = unit_test_options_prompt_after(&x_options_x) == 'q';
+            ok = ! x_options_x.m_Interactive;
 
          if (ok)
-            ok = x_options_x.m_Response_After = 'q';
+            ok = ! x_options_x.m_Case_Pause;
 
          unit_test_status_pass(&status, ok);
       }
-
-      /*  6 */
-
-      if (unit_test_status_next_subtest(&status, "Unsupported value"))
-      {
-         if (ok)
-         {
-            cbool_t not_ok = ! unit_test_options_prompt_after_set
-            (
-               &x_options_x, '1'    /* '1' is not a valid response character  */
-            );
-
-            /*
-             * The value from the previous sub-test should still be in
-             * force.
-             */
-
-            if (not_ok)
-               not_ok = unit_test_options_prompt_after(&x_options_x) == 'q';
-
-            if (not_ok)
-               not_ok = x_options_x.m_Response_After = 'q';
-
-            unit_test_status_pass(&status, not_ok);
-         }
-      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "is-simulated"
+ *    Provides a unit/regression test to verify the "pause"
  *    functionality.
  *
  * \group
  *    3. unit_test_options_t functions.
  *
  * \case
- *   29. Accessors for the --simulated option.
+ *   16. Accessors for the --case-pause option.
  *
  * \test
- *    -  unit_test_options_is_simulated_set()
- *    -  unit_test_options_is_simulated()
+ *    -  unit_test_options_is_pause_set()
+ *    -  unit_test_options_is_pause()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8545,13 +9152,13 @@ unit_unit_test_03_28 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_03_29 (const unit_test_options_t * options)
+unit_unit_test_03_16 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 3, 29,
-      "unit_test_options_t", "unit_test_options_is_simulated...()"
+      &status, options, 3, 16,
+      "unit_test_options_t", "unit_test_options_is_pause...()"
    );
    if (ok)
    {
@@ -8564,12 +9171,12 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
 
       if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_options_is_simulated_set
+         cbool_t null_ok = ! unit_test_options_is_pause_set
          (
             nullptr, false
          );
          if (null_ok)
-            null_ok = ! unit_test_options_is_simulated_set(nullptr, true);
+            null_ok = ! unit_test_options_is_pause_set(nullptr, true);
 
          unit_test_status_pass(&status, null_ok);
       }
@@ -8580,7 +9187,7 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
       {
          cbool_t null_ok =
          (
-            unit_test_options_is_simulated(nullptr) == XPCCUT_IS_SIMULATED
+            unit_test_options_is_pause(nullptr) == XPCCUT_CASE_PAUSE
          );
          unit_test_status_pass(&status, null_ok);
       }
@@ -8590,13 +9197,13 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
          if (ok)
-            ok = unit_test_options_is_simulated_set(&x_options_x, false);
+            ok = unit_test_options_is_pause_set(&x_options_x, false);
 
          if (ok)
-            ok = ! x_options_x.m_Is_Simulated;
+            ok = ! x_options_x.m_Case_Pause;
 
          if (ok)
-            ok = ! unit_test_options_is_simulated(&x_options_x);
+            ok = ! unit_test_options_is_pause(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -8606,13 +9213,13 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
       if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
          if (ok)
-            ok = unit_test_options_is_simulated_set(&x_options_x, true);
+            ok = unit_test_options_is_pause_set(&x_options_x, true);
 
          if (ok)
-            ok = x_options_x.m_Is_Simulated;
+            ok = x_options_x.m_Case_Pause;
 
          if (ok)
-            ok = unit_test_options_is_simulated(&x_options_x);
+            ok = unit_test_options_is_pause(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
@@ -8621,29 +9228,18 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the basic "default"
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
- *
- *    The function tested is like a "C" version of a "C++" default
- *    constructor.
+ *    Provides a unit/regression test to verify the "test group"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    1. Initialization and setup functions.
+ *   17. Accessors for the --group option.
  *
  * \test
- *    -  unit_test_init()
- *    -  unit_test_clear() [indirect test of static function]
- *    -  unit_test_options_init() [indirect test of static function]
- *    -  unit_test_allocate_help() [indirect test of static function]
- *    -  unit_test_init_cases() [indirect test of static function]
- *
- * \todo
- *    It would be nice if we could verify the duration of the previous test
- *    to be correct to within plus-or-minus 10 ms.
+ *    -  unit_test_options_test_group_set()
+ *    -  unit_test_options_test_group()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8653,153 +9249,164 @@ unit_unit_test_03_29 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_01 (const unit_test_options_t * options)
+unit_unit_test_03_17 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 1,
-      "unit_test_t", "unit_test_init()"
+      &status, options, 3, 17,
+      "unit_test_options_t", "unit_test_options_test_group...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      (void) unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_init(nullptr);
+         cbool_t null_ok = ! unit_test_options_test_group_set(nullptr, 0);
+         if (null_ok)
+            null_ok = ! unit_test_options_test_group_set(nullptr, 1);
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  3 */
+         /*
+          * Let's do this another way, just to show it.
+          *
+          * cbool_t null_ok =
+          * (
+          *    unit_test_options_test_group(nullptr) == XPCCUT_NO_SINGLE_GROUP
+          * );
+          * unit_test_status_pass(&status, null_ok);
+          */
 
-      if (unit_test_status_next_subtest(&status, "m_App_Options"))
-      {
-         ok = default_options_check
+         (void) unit_test_status_int_check
          (
-            &x_test_x.m_App_Options,      /* check unit_test_options_init()   */
-            false                         /* no show-progress testing         */
+            &status, unit_test_options_test_group(nullptr),
+            XPCCUT_NO_SINGLE_GROUP
          );
-         unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Good help setup"))
+      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
       {
          /*
-          * This sub-test will check the call to the static function
-          * unit_test_allocate_help().
+          * Set explicitly to make sure the correct value replaces this one.
+          */
+
+         x_options_x.m_Single_Test_Group = 5;
+         ok = ! unit_test_options_test_group_set(&x_options_x, -1);
+
+         /*
+          * Let's do this another way, just to see how it looks.
+          *
+          * if (ok)
+          *    ok = x_options_x.m_Single_Test_Group == 0;
+          *
+          * if (ok)
+          *    ok = unit_test_options_test_group(&x_options_x) == 0;
           */
 
-         ok = cut_not_nullptr(x_test_x.m_Additional_Help);
          if (ok)
          {
-            ok = strlen(x_test_x.m_Additional_Help) > 0;
-            if (ok && unit_test_options_is_verbose(options))
-            {
-               fprintf
-               (
-                  stdout, "  %s:\n{\n%s\n}\n",
-                  _("The allocated help text is"),
-                  x_test_x.m_Additional_Help
-               );
-            }
-            else
-               xpccut_errprint(_("unit-test help text is empty"));
+            ok = unit_test_status_int_check
+            (
+               &status, x_options_x.m_Single_Test_Group, 0
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_status_int_check
+            (
+               &status, unit_test_options_test_group(&x_options_x), 0
+            );
          }
-         else
-            xpccut_errprint(_("unit-test help text not allocated"));
 
-         unit_test_status_pass(&status, ok);
+         /*
+          * Not needed, since we're using unit_test_status_int_check(),
+          * which calls this function under the covers:
+          *
+          * unit_test_status_pass(&status, ok);
+          */
       }
 
-      /*  5 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Good cases setup"))
+      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
       {
-         /*
-          * This sub-test will check the call to the static function
-          * unit_test_init_cases() and unit_test_allocate_cases.
-          */
+         x_options_x.m_Single_Test_Group = 5;
+         if (ok)
+            ok = unit_test_options_test_group_set(&x_options_x, 0);
 
          if (ok)
-         {
-            ok = cut_not_nullptr(x_test_x.m_Test_Cases);
-            if (ok)
-               ok = x_test_x.m_Total_Errors == 0;
+            ok = x_options_x.m_Single_Test_Group == 0;
 
-            if (ok)
-               ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+         if (ok)
+            ok = unit_test_options_test_group(&x_options_x) == 0;
 
-            if (ok)
-               ok = x_test_x.m_Test_Count == 0;
+         unit_test_status_pass(&status, ok);
+      }
 
-            if (ok)
-               ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+      /*  5 */
 
-            if (ok && unit_test_options_is_verbose(options))
-            {
-               fprintf
-               (
-                  stdout, "  %s:\n{\n%s\n}\n",
-                  _("The allocated help text is"),
-                  x_test_x.m_Additional_Help
-               );
-            }
-            else
-               xpccut_errprint(_("unit-test help text is empty"));
-         }
-         else
-            xpccut_errprint(_("unit-test help text not allocated"));
+      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
+      {
+         x_options_x.m_Single_Test_Group = 5;
+         if (ok)
+            ok = unit_test_options_test_group_set(&x_options_x, 1);
+
+         if (ok)
+            ok = x_options_x.m_Single_Test_Group == 1;
+
+         if (ok)
+            ok = unit_test_options_test_group(&x_options_x) == 1;
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.  Even
-       * little ol' unit_test_init() allocates them.  If the --leak-check
-       * option is in force, we don't call this "destructor".
-       */
+      /*  6 */
 
-      if (! g_do_leak_check)
-         unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Setting to 101, set/get"))
+      {
+         x_options_x.m_Single_Test_Group = 5;
+         if (ok)
+            ok = ! unit_test_options_test_group_set(&x_options_x, 101);
+
+         if (ok)
+            ok = x_options_x.m_Single_Test_Group == 0;
+
+         if (ok)
+            ok = unit_test_options_test_group(&x_options_x) == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "principal"
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
- *
- *    The function tested is like a "C" version of a "C++" principal
- *    constructor.
- *
- *    This is a "part 1" unit-test case for unit_test_initialize().
+ *    Provides a unit/regression test to verify the "test case"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    2. unit_test_initialize(), part 1.
+ *   18. Accessors for the --case option.
  *
  * \test
- *    -  unit_test_initialize()
- *
- * \todo
- *    It would be nice if we could verify the duration of the previous test
- *    to be correct to within plus-or-minus 10 ms.
+ *    -  unit_test_options_test_case_set()
+ *    -  unit_test_options_test_case()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -8809,277 +9416,300 @@ unit_unit_test_04_01 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_02 (const unit_test_options_t * options)
+unit_unit_test_03_18 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 2,
-      "unit_test_t", "unit_test_initialize() part 1"
+      &status, options, 3, 18,
+      "unit_test_options_t", "unit_test_options_test_case...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* guarantee initialized   */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.  We have to access the
-       * member field directly.
-       */
+      /*  1 */
 
-      ok = unit_test_options_init(&x_test_x.m_App_Options);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
+      {
+         cbool_t null_ok = ! unit_test_options_test_case_set(nullptr, 0);
+         if (null_ok)
+            null_ok = ! unit_test_options_test_case_set(nullptr, 1);
 
-      if (ok)
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         /*
-          * Now modify the test structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          */
+         cbool_t null_ok =
+         (
+            unit_test_options_test_case(nullptr) == XPCCUT_NO_SINGLE_CASE
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
 
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--no-verbose";
-         argv[2]  = "--no-show-progress";
-         argv[3]  = "--no-show-values";
-         argv[4]  = "--no-show-step-numbers";
-         argv[5]  = "--no-text-synch";
-         argv[6]  = "--no-stop-on-error";
-         argv[7]  = "--no-batch-mode";
-         argv[8]  = "--no-interactive";
-         argv[9]  = "--no-beeps";
-         argv[10] = "--no-case-pause";
-         argv[11] = "--no-summarize";
-         argv[12] = "--group";
-         argv[13] = "1";
-         argv[14] = "--case";
-         argv[15] = "2";
-         argv[16] = "--sub-test";
-         argv[17] = "3";
-         argv[18] = "--sleep-time";
-         argv[19] = "4";
-         argv[20] = "--no-verbose";
-         argv[21] = "--no-verbose";
-         argc = 22;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv,
-            "Test 04.02", "version", "additionalhelp"
-         );
-      }
-
-      /*  1 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
       {
-         cbool_t null_ok = ! unit_test_initialize
-         (
-            nullptr, argc, argv, "x", "y", "z"
-         );
-         unit_test_status_pass(&status, null_ok);
-      }
-
-      /*  2 */
+         /*
+          * Set explicitly to make sure the correct value replaces this one.
+          */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
-      {
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Single_Test_Case = 5;
+         ok = ! unit_test_options_test_case_set(&x_options_x, -1);
+         if (ok)
+            ok = x_options_x.m_Single_Test_Case == 0;
 
-      /*  3 */
+         if (ok)
+            ok = unit_test_options_test_case(&x_options_x) == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Is_Verbose;
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Values"))
+      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
       {
-         ok = ! x_test_x.m_App_Options.m_Show_Values;
+         x_options_x.m_Single_Test_Case = 5;
+         if (ok)
+            ok = unit_test_options_test_case_set(&x_options_x, 0);
+
+         if (ok)
+            ok = x_options_x.m_Single_Test_Case == 0;
+
+         if (ok)
+            ok = unit_test_options_test_case(&x_options_x) == 0;
+
          unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Text_Synch"))
+      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
       {
-         ok = ! x_test_x.m_App_Options.m_Text_Synch;
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Single_Test_Case = 5;
+         if (ok)
+            ok = unit_test_options_test_case_set(&x_options_x, 1);
 
-      /*  6 */
+         /*
+          * This is the first way to do this check:
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Step_Numbers"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Show_Step_Numbers;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = x_options_x.m_Single_Test_Case == 1;
 
-      /*  7 */
+         /*
+          * This is another way to do this check:
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Progress"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Show_Progress;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+         {
+            ok = unit_test_status_int_check
+            (
+               &status, x_options_x.m_Single_Test_Case, 1
+            );
+         }
 
-      /*  8 */
+         /*
+          * This is yet another way to do this check.
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Stop_On_Error"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Stop_On_Error;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = unit_test_options_test_case(&x_options_x) == 1;
 
-      /*  9 */
+         /*
+          * This is yet another way to do this check.  Four different ways
+          * to do the same check!
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Batch_Mode"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Batch_Mode;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+         {
+            ok = unit_test_status_int_check
+            (
+               &status, unit_test_options_test_case(&x_options_x), 1
+            );
+         }
 
-      /* 10 */
+         /*
+          * If all the checks above used unit_test_status_int_check(), this
+          * line of code would be redundant.
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Interactive"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Interactive;
          unit_test_status_pass(&status, ok);
       }
 
-      /* 11 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Beep_Prompt"))
+      if (unit_test_status_next_subtest(&status, "Setting to 101, set/get"))
       {
-         ok = ! x_test_x.m_App_Options.m_Beep_Prompt;
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Single_Test_Case = 5;
+         if (ok)
+            ok = ! unit_test_options_test_case_set(&x_options_x, 101);
 
-      /* 12 */
+         if (ok)
+            ok = x_options_x.m_Single_Test_Case == 0;
+
+         if (ok)
+            ok = unit_test_options_test_case(&x_options_x) == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Summarize"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Summarize;
          unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /* 13 */
+/**
+ *    Provides a unit/regression test to verify the "subtest"
+ *    functionality.
+ *
+ * \group
+ *    3. unit_test_options_t functions.
+ *
+ * \case
+ *   19. Accessors for the --subtest or --sub-test option.
+ *
+ * \test
+ *    -  unit_test_options_single_subtest_set()
+ *    -  unit_test_options_single_subtest()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Case_Pause"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Case_Pause;
-         unit_test_status_pass(&status, ok);
-      }
+static unit_test_status_t
+unit_unit_test_03_19 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 3, 19,
+      "unit_test_options_t", "unit_test_options_single_subtest...()"
+   );
+   if (ok)
+   {
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /* 14 */
+      /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Group"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         ok = x_test_x.m_App_Options.m_Single_Test_Group ==
-            (XPCCUT_NO_SINGLE_GROUP+1);
+         cbool_t null_ok = ! unit_test_options_single_subtest_set(nullptr, 0);
+         if (null_ok)
+            null_ok = ! unit_test_options_single_subtest_set(nullptr, 1);
 
-         unit_test_status_pass(&status, ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
-      /* 15 */
+      /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Case"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         ok = x_test_x.m_App_Options.m_Single_Test_Case ==
-            (XPCCUT_NO_SINGLE_CASE+2);
-
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok =
+         (
+            unit_test_options_single_subtest(nullptr) ==
+               XPCCUT_NO_SINGLE_SUB_TEST
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
-      /* 16 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Sub_Test"))
+      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
       {
-         ok = x_test_x.m_App_Options.m_Single_Sub_Test ==
-            (XPCCUT_NO_SINGLE_SUB_TEST+3);
-
-         unit_test_status_pass(&status, ok);
-      }
+         /*
+          * Set explicitly to make sure the correct value replaces this one.
+          */
 
-      /* 17 */
+         x_options_x.m_Single_Sub_Test = 5;
+         ok = ! unit_test_options_single_subtest_set(&x_options_x, -1);
+         if (ok)
+            ok = x_options_x.m_Single_Sub_Test == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Test_Sleep_Time"))
-      {
-         ok = x_test_x.m_App_Options.m_Test_Sleep_Time ==
-            (XPCCUT_TEST_SLEEP_TIME+4);
+         if (ok)
+            ok = unit_test_options_single_subtest(&x_options_x) == 0;
 
          unit_test_status_pass(&status, ok);
       }
 
-      /* 18 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
+      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
       {
-         /* "Test 04.02", "version", "additionalhelp" */
+         x_options_x.m_Single_Sub_Test = 5;
+         if (ok)
+            ok = unit_test_options_single_subtest_set(&x_options_x, 0);
+
+         if (ok)
+            ok = x_options_x.m_Single_Sub_Test == 0;
+
+         if (ok)
+            ok = unit_test_options_single_subtest(&x_options_x) == 0;
 
-         ok = strcmp(x_test_x.m_Test_Application_Name, "Test 04.02") == 0;
          unit_test_status_pass(&status, ok);
       }
 
-      /* 19 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
+      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
       {
-         ok = strcmp(x_test_x.m_Test_Application_Version, "version") == 0;
+         x_options_x.m_Single_Sub_Test = 5;
+         if (ok)
+            ok = unit_test_options_single_subtest_set(&x_options_x, 1);
+
+         if (ok)
+            ok = x_options_x.m_Single_Sub_Test == 1;
+
+         if (ok)
+            ok = unit_test_options_single_subtest(&x_options_x) == 1;
+
          unit_test_status_pass(&status, ok);
       }
 
-      /* 20 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
+      if (unit_test_status_next_subtest(&status, "Setting to 1001, set/get"))
       {
-         ok = strcmp(x_test_x.m_Additional_Help, "additionalhelp") == 0;
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Single_Sub_Test = 5;
+         if (ok)
+            ok = ! unit_test_options_single_subtest_set(&x_options_x, 1001);
 
-      /**
-       * Testing of null and blank app-names, version strings, and help
-       * strings is done in the next two unit-test cases.
-       */
+         if (ok)
+            ok = x_options_x.m_Single_Sub_Test == 0;
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+         if (ok)
+            ok = unit_test_options_single_subtest(&x_options_x) == 0;
 
-      unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the basic
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
- *
- *    The function tested is like a "C" version of a "C++" principal
- *    constructor.
- *
- *    This is a "part 2" unit-test case for unit_test_initialize().
+ *    Provides a unit/regression test to verify the "test sleep-time"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    3. unit_test_initialize(), part 2.
+ *   20. Accessors for the --sleep-time option.
  *
  * \test
- *    -  unit_test_initialize()
- *
- * \todo
- *    It would be nice if we could verify the duration of the previous test
- *    to be correct to within plus-or-minus 10 ms.
+ *    -  unit_test_options_test_sleep_time_set()
+ *    -  unit_test_options_test_sleep_time()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9089,302 +9719,133 @@ unit_unit_test_04_02 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_03 (const unit_test_options_t * options)
+unit_unit_test_03_20 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 3,
-      "unit_test_t", "unit_test_initialize() part 2"
+      &status, options, 3, 20,
+      "unit_test_options_t", "unit_test_options_test_sleep_time...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* guarantee initialized   */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.  We have to access the
-       * member field directly.
-       */
-
-      ok = unit_test_options_init(&x_test_x.m_App_Options);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
-
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
       if (ok)
-      {
-         /*
-          * Now modify the test structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          *
-          * Also note that some options turn off the global output option or
-          * alter other options.  We disable them by tacking on "---ignore".
-          *
-          * The --summarize option does this, and the output looks weird.
-          */
-
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--verbose";
-         argv[2]  = "--show-progress";
-         argv[3]  = "--show-values";
-         argv[4]  = "--show-step-numbers";
-         argv[5]  = "--text-synch";
-         argv[6]  = "--stop-on-error";
-         argv[7]  = "--batch-mode---ignore";
-         argv[8]  = "--interactive---ignore";
-         argv[9]  = "--beeps";
-         argv[10] = "--case-pause";
-         argv[11] = "--summarize---ignore";
-         argv[12] = "--group";
-         argv[13] = "1";
-         argv[14] = "--case";
-         argv[15] = "2";
-         argv[16] = "--sub-test";
-         argv[17] = "3";
-         argv[18] = "--sleep-time";
-         argv[19] = "4";
-         argc = 20;
-
-         /*
-          * This function call will fail due to the empty help text, but we
-          * can learn more by continuing nonetheless.
-          *
-          * ca 06/23/2008
-          * Actually, it will not fail now, since empties produce good
-          * defaults for the caller now.  Hence, the not (!) operator is
-          * gone.
-          */
-
-         ok = unit_test_initialize(&x_test_x, argc, argv, "", "", "");
-      }
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_initialize
+         cbool_t null_ok = ! unit_test_options_test_sleep_time_set
          (
-            nullptr, argc, argv, "x", "y", "z"
+            nullptr, false
          );
+         if (null_ok)
+            null_ok = ! unit_test_options_test_sleep_time_set(nullptr, true);
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok =
+         (
+            unit_test_options_test_sleep_time(nullptr) == XPCCUT_TEST_SLEEP_TIME
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
+      if (unit_test_status_next_subtest(&status, "Setting negative, set/get"))
       {
-         ok = x_test_x.m_App_Options.m_Is_Verbose;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
+         /*
+          * Set explicitly to make sure the correct value replaces this one.
+          */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Values"))
-      {
-         ok = x_test_x.m_App_Options.m_Show_Values;
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Test_Sleep_Time = 5;
+         ok = ! unit_test_options_test_sleep_time_set(&x_options_x, -1);
+         if (ok)
+            ok = x_options_x.m_Test_Sleep_Time == 0;
 
-      /*  5 */
+         if (ok)
+            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Text_Synch"))
-      {
-         ok = x_test_x.m_App_Options.m_Text_Synch;
          unit_test_status_pass(&status, ok);
       }
 
-      /*  6 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Step_Numbers"))
+      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
       {
-         ok = x_test_x.m_App_Options.m_Show_Step_Numbers;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  7 */
+         x_options_x.m_Test_Sleep_Time = 5;
+         if (ok)
+            ok = unit_test_options_test_sleep_time_set(&x_options_x, 0);
 
-      if (unit_test_status_next_subtest(&status, "internal m_Show_Progress"))
-      {
-         ok = x_test_x.m_App_Options.m_Show_Progress;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = x_options_x.m_Test_Sleep_Time == 0;
 
-      /*  8 */
+         if (ok)
+            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Stop_On_Error"))
-      {
-         ok = x_test_x.m_App_Options.m_Stop_On_Error;
          unit_test_status_pass(&status, ok);
       }
 
-      /*  9 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Batch_Mode"))
+      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
       {
-         ok = ! x_test_x.m_App_Options.m_Batch_Mode;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 10 */
+         x_options_x.m_Test_Sleep_Time = 5;
+         if (ok)
+            ok = unit_test_options_test_sleep_time_set(&x_options_x, 1);
 
-      if (unit_test_status_next_subtest(&status, "internal m_Interactive"))
-      {
-         ok = ! x_test_x.m_App_Options.m_Interactive;
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = x_options_x.m_Test_Sleep_Time == 1;
 
-      /* 11 */
+         if (ok)
+            ok = unit_test_options_test_sleep_time(&x_options_x) == 1;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Beep_Prompt"))
-      {
-         ok = x_test_x.m_App_Options.m_Beep_Prompt;
          unit_test_status_pass(&status, ok);
       }
 
-      /* 12 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Summarize"))
+      if (unit_test_status_next_subtest(&status, "Setting to 3600001, set/get"))
       {
-         ok = ! x_test_x.m_App_Options.m_Summarize;
-         unit_test_status_pass(&status, ok);
-      }
+         x_options_x.m_Test_Sleep_Time = 5;
+         if (ok)
+            ok = ! unit_test_options_test_sleep_time_set(&x_options_x, 3600001);
 
-      /* 13 */
+         if (ok)
+            ok = x_options_x.m_Test_Sleep_Time == 0;
+
+         if (ok)
+            ok = unit_test_options_test_sleep_time(&x_options_x) == 0;
 
-      if (unit_test_status_next_subtest(&status, "internal m_Case_Pause"))
-      {
-         ok = x_test_x.m_App_Options.m_Case_Pause;
          unit_test_status_pass(&status, ok);
       }
-
-      /* 14 */
-
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Group"))
-      {
-         ok = x_test_x.m_App_Options.m_Single_Test_Group ==
-            (XPCCUT_NO_SINGLE_GROUP+1);
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 15 */
-
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Case"))
-      {
-         ok = x_test_x.m_App_Options.m_Single_Test_Case ==
-            (XPCCUT_NO_SINGLE_CASE+2);
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 16 */
-
-      if (unit_test_status_next_subtest(&status, "internal m_Single_Sub_Test"))
-      {
-         ok = x_test_x.m_App_Options.m_Single_Sub_Test ==
-            (XPCCUT_NO_SINGLE_SUB_TEST+3);
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 17 */
-
-      if (unit_test_status_next_subtest(&status, "internal m_Test_Sleep_Time"))
-      {
-         ok = x_test_x.m_App_Options.m_Test_Sleep_Time ==
-            (XPCCUT_TEST_SLEEP_TIME+4);
-
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 18 */
-
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
-      {
-         /* "", "", "" */
-
-         ok = strcmp(x_test_x.m_Test_Application_Name, "") == 0;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 19 */
-
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
-      {
-         ok = strcmp(x_test_x.m_Test_Application_Version, "") == 0;
-         unit_test_status_pass(&status, ok);
-      }
-
-      /* 20 */
-
-      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
-      {
-         /*
-          * The text here is assigned internally from a static character
-          * string in the static function unit_test_allocate_help().
-          * However, we cannot then free this pointer in the call to
-          * unit_test_destroy() below.  So all we can do here is check for
-          * the null pointer.
-          *
-          * ok = strcmp
-          * (
-          *    x_test_x.m_Additional_Help, _("? unit_test_allocate_help() null")
-          * ) == 0;
-          *
-          * ca 06/23/2008
-          * Actually, it will not be null now, since empties produce good
-          * defaults for the caller.
-          * gone.
-          *
-          *    ok = cut_is_nullptr(x_test_x.m_Additional_Help);
-          */
-
-         ok = ! cut_is_nullptr(x_test_x.m_Additional_Help);
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
-   }
-   return status;
-}
+   }
+   return status;
+}
 
 /**
- *    Provides a unit/regression test to verify that the basic
- *    initialization function properly zeros or clears all fields to their
- *    "default" values.
- *
- *    The function tested is like a "C" version of a "C++" principal
- *    constructor.
- *
- *    This is a "part 3" unit-test case for unit_test_initialize().
+ *    Provides a unit/regression test to verify the "named test group"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    4. unit_test_initialize(), part 3.
+ *   21. Accessors for the --group option using the name of the test instead
+ *       of the number of the test.
  *
  * \test
- *    -  unit_test_initialize()
- *
- * \todo
- *    It would be nice if we could verify the duration of the previous test
- *    to be correct to within plus-or-minus 10 ms.
+ *    -  unit_test_options_named_group_set()
+ *    -  unit_test_options_named_group()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9394,126 +9855,115 @@ unit_unit_test_04_03 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_04 (const unit_test_options_t * options)
+unit_unit_test_03_21 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 4,
-      "unit_test_t", "unit_test_initialize() part 3"
+      &status, options, 3, 21,
+      "unit_test_options_t", "unit_test_options_named_group...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 1;                                /* guarantee initialized   */
-      argv[0] = "<unknown>";                       /* guarantee some value    */
-
-      /*
-       * Start out with default values so that we can take the opposite tack
-       * with the full initialization function.  We have to access the
-       * member field directly.
-       */
-
-      ok = unit_test_options_init(&x_test_x.m_App_Options);
-      if (ok)
-         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
-
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
       if (ok)
-      {
-         /*
-          * Now modify the test structure with the opposite values (or at
-          * least different values) for every accessible field, so that the
-          * resulting test is a bizarro-clone of test 03_01.
-          *
-          * Also note that some options turn off the global output option or
-          * alter other options.  We disable them by tacking on "---ignore".
-          *
-          * The --summarize option does this, and the output looks weird.
-          */
-
-         argv[0]  = "unit_test_test";
-         argv[1]  = "--verbose";
-         argc = 2;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, nullptr, nullptr, nullptr
-         );
-      }
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_initialize
-         (
-            nullptr, argc, argv, "x", "y", "z"
-         );
+         cbool_t null_ok = ! unit_test_options_named_group_set(nullptr, nullptr);
+         if (null_ok)
+            null_ok = ! unit_test_options_named_group_set(nullptr, "!");
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok = cut_is_nullptr(unit_test_options_named_group(nullptr));
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
+      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
       {
-         ok = x_test_x.m_App_Options.m_Is_Verbose;
+         /*
+          * Set explicitly to make sure the value is not modified.  We don't
+          * bother making sure a 3-character string can be copied here.
+          */
+
+         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!");
+         ok = ! unit_test_options_named_group_set(&x_options_x, nullptr);
+         if (ok)
+            ok = strcmp(x_options_x.m_Single_Test_Group_Name, "!!!") == 0;
+
+         if (ok)
+            ok = strcmp(unit_test_options_named_group(&x_options_x), "!!!") == 0;
+
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
+      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
       {
-         /* nullptr, nullptr, nullptr */
+         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!");
+         if (ok)
+            ok = unit_test_options_named_group_set(&x_options_x, "");
+
+         if (ok)
+            ok = strlen(x_options_x.m_Single_Test_Group_Name) == 0;
+
+         if (ok)
+            ok = cut_is_nullptr(unit_test_options_named_group(&x_options_x));
 
-         ok = strcmp(x_test_x.m_Test_Application_Name, _("Unit Test")) == 0;
          unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
+      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
       {
-         ok = strcmp(x_test_x.m_Test_Application_Version, "1.1") == 0;
-         unit_test_status_pass(&status, ok);
-      }
+         strcpy(x_options_x.m_Single_Test_Group_Name, "!!!!!");
+         if (ok)
+            ok = unit_test_options_named_group_set(&x_options_x, "0xDEADBEEF");
 
-      /*  6 */
+         if (ok)
+            ok = strcmp(x_options_x.m_Single_Test_Group_Name, "0xDEADBEEF") == 0;
 
-      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
-      {
-         ok = strcmp(x_test_x.m_Additional_Help, _("No help")) == 0;
+         if (ok)
+         {
+            ok = 0 == strcmp
+            (
+               unit_test_options_named_group(&x_options_x), "0xDEADBEEF"
+            );
+         }
          unit_test_status_pass(&status, ok);
       }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "test-loading"
- *    functionality works.
+ *    Provides a unit/regression test to verify the "named test case"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    5. Initialization and setup functions.
+ *   22. Accessors for the --case option using the named of the test case
+ *   instead of the test-case number.
  *
  * \test
- *    -  unit_test_load()
+ *    -  unit_test_options_named_case_set()
+ *    -  unit_test_options_named_case()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9523,165 +9973,115 @@ unit_unit_test_04_04 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_05 (const unit_test_options_t * options)
+unit_unit_test_03_22 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 5, "unit_test_t", "unit_test_load()"
+      &status, options, 3, 22,
+      "unit_test_options_t", "unit_test_options_named_case...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_load(nullptr, unit_unit_test_01_01);
+         cbool_t null_ok = ! unit_test_options_named_case_set(nullptr, nullptr);
+         if (null_ok)
+            null_ok = ! unit_test_options_named_case_set(nullptr, "!");
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         cbool_t null_ok = ! unit_test_load(&x_test_x, nullptr);
+         cbool_t null_ok = cut_is_nullptr(unit_test_options_named_case(nullptr));
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
       {
-         if (ok)
-            ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+         /*
+          * Set explicitly to make sure the value is not modified.  We don't
+          * bother making sure a 3-character string can be copied here.
+          */
 
+         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!");
+         ok = ! unit_test_options_named_case_set(&x_options_x, nullptr);
          if (ok)
-            ok = x_test_x.m_Test_Count == 1;
+            ok = strcmp(x_options_x.m_Single_Test_Case_Name, "!!!") == 0;
 
          if (ok)
-            ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+            ok = strcmp(unit_test_options_named_case(&x_options_x), "!!!") == 0;
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Second test"))
+      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
       {
+         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!");
          if (ok)
-            ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+            ok = unit_test_options_named_case_set(&x_options_x, "");
 
          if (ok)
-            ok = x_test_x.m_Test_Count == 2;
+            ok = strlen(x_options_x.m_Single_Test_Case_Name) == 0;
 
          if (ok)
-            ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+            ok = cut_is_nullptr(unit_test_options_named_case(&x_options_x));
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "Until next allocation"))
+      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
       {
+         strcpy(x_options_x.m_Single_Test_Case_Name, "!!!!!");
          if (ok)
-         {
-            int ti;
-            for (ti = x_test_x.m_Test_Count; ti < XPCCUT_CASE_ALLOCATION; ti++)
-            {
-               if (ok)
-                  ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
-
-               if (ok)
-                  ok = x_test_x.m_Test_Count == (ti + 1);
-
-               if (ok)
-                  ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
-
-               if (! ok)
-               {
-                  if (! xpccut_is_silent())
-                  {
-                     fprintf
-                     (
-                        stdout, "%s %d %s %d\n",
-                        _("load failed at count"), x_test_x.m_Test_Count,
-                        _("and allocation"), x_test_x.m_Allocation_Count
-                     );
-                  }
-                  break;
-               }
-            }
-            unit_test_status_pass(&status, ok);
-         }
-      }
+            ok = unit_test_options_named_case_set(&x_options_x, "0xDEADBEEF");
 
-      /*  6 */
+         if (ok)
+            ok = strcmp(x_options_x.m_Single_Test_Case_Name, "0xDEADBEEF") == 0;
 
-      if (unit_test_status_next_subtest(&status, "After next allocation"))
-      {
          if (ok)
          {
-            int ti;
-            for (ti = x_test_x.m_Test_Count; ti < 2*XPCCUT_CASE_ALLOCATION; ti++)
-            {
-               if (ok)
-                  ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
-
-               if (ok)
-                  ok = x_test_x.m_Test_Count == (ti + 1);
-
-               if (ok)
-                  ok = x_test_x.m_Allocation_Count == 2*XPCCUT_CASE_ALLOCATION;
-
-               if (! ok)
-               {
-                  if (! xpccut_is_silent())
-                  {
-                     fprintf
-                     (
-                        stdout, "%s %d %s %d\n",
-                        _("load failed at count"), x_test_x.m_Test_Count,
-                        _("and allocation"), x_test_x.m_Allocation_Count
-                     );
-                  }
-                  break;
-               }
-            }
-            unit_test_status_pass(&status, ok);
+            ok = 0 == strcmp
+            (
+               unit_test_options_named_case(&x_options_x), "0xDEADBEEF"
+            );
          }
+         unit_test_status_pass(&status, ok);
       }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the
- *    "test-load-counting" functionality is working, and also can be used by
- *    C++ code.
- *
- *    This functionality is /not/ tested in test 04.05 above, because the
- *    unit_test_load() function does its own counting.  The
- *    unit_test_cpp_load_count() is mean for usage in a C++ unit-test
- *    wrapper.
+ *    Provides a unit/regression test to verify the "named test sub-test"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    6. unit_test_cpp_load_count()
+ *   23. Accessors for the --subtest option using the name of the sub-test
+ *       instead of the sub-test number.
  *
  * \test
- *    -  unit_test_cpp_load_count()
+ *    -  unit_test_options_named_subtest_set()
+ *    -  unit_test_options_named_subtest()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9691,95 +10091,120 @@ unit_unit_test_04_05 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_06 (const unit_test_options_t * options)
+unit_unit_test_03_23 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 6, "unit_test_t", "unit_test_cpp_load_count()"
+      &status, options, 3, 23,
+      "unit_test_options_t", "unit_test_options_named_subtest...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = ! unit_test_cpp_load_count(nullptr);
+         cbool_t null_ok = ! unit_test_options_named_subtest_set
+         (
+            nullptr, nullptr
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_named_subtest_set(nullptr, "!");
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         if (ok)
-            ok = x_test_x.m_Test_Count == 0;
+         cbool_t null_ok =
+            cut_is_nullptr(unit_test_options_named_subtest(nullptr));
+
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting to null, set/get"))
       {
+         /*
+          * Set explicitly to make sure the value is not modified.  We don't
+          * bother making sure a 3-character string can be copied here.
+          */
+
+         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!");
+         ok = ! unit_test_options_named_subtest_set(&x_options_x, nullptr);
          if (ok)
-            ok = unit_test_cpp_load_count(&x_test_x);
+            ok = strcmp(x_options_x.m_Single_Sub_Test_Name, "!!!") == 0;
 
          if (ok)
-            ok = x_test_x.m_Test_Count == 1;
+            ok = strcmp(unit_test_options_named_subtest(&x_options_x), "!!!")
+                     == 0;
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting to empty, set/get"))
       {
+         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!");
          if (ok)
-         {
-            int ti;
-            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
-            {
-               if (ok)
-                  ok = unit_test_cpp_load_count(&x_test_x);
-               else
-               {
-                  if (! xpccut_is_silent())
-                  {
-                     fprintf
-                     (
-                        stdout, "%s %d\n",
-                        _("load failed at count"), x_test_x.m_Test_Count
-                     );
-                  }
-                  break;
-               }
-            }
-            if (ok)
-               ok = x_test_x.m_Test_Count == 1000;
-         }
+            ok = unit_test_options_named_subtest_set(&x_options_x, "");
+
+         if (ok)
+            ok = strlen(x_options_x.m_Single_Sub_Test_Name) == 0;
+
+         if (ok)
+            ok = cut_is_nullptr(unit_test_options_named_subtest(&x_options_x));
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  5 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Valid setting, set/get"))
+      {
+         strcpy(x_options_x.m_Single_Sub_Test_Name, "!!!!!");
+         if (ok)
+            ok = unit_test_options_named_subtest_set(&x_options_x, "0xDEADBEEF");
+
+         if (ok)
+            ok = strcmp(x_options_x.m_Single_Sub_Test_Name, "0xDEADBEEF") == 0;
+
+         if (ok)
+         {
+            ok = 0 == strcmp
+            (
+               unit_test_options_named_subtest(&x_options_x), "0xDEADBEEF"
+            );
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify the "test-dispose"
+ *    Provides a unit/regression test to verify the "require-sub-tests"
  *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    7. unit_test_dispose()
+ *   24. Accessors for the --require-subtests option.
  *
  * \test
- *    -  unit_test_dispose()
+ *    -  unit_test_options_need_subtests_set()
+ *    -  unit_test_options_need_subtests()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9789,101 +10214,75 @@ unit_unit_test_04_06 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_07 (const unit_test_options_t * options)
+unit_unit_test_03_24 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 7, "unit_test_t", "unit_test_dispose()"
+      &status, options, 3, 24,
+      "unit_test_options_t", "unit_test_options_need_subtests...()"
    );
    if (ok)
    {
-      unit_test_status_t x_status_x;
-      ok = unit_test_status_init(&x_status_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_dispose(nullptr);
-         if (ok)
-            ok = x_status_x.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+         cbool_t null_ok = ! unit_test_options_need_subtests_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_need_subtests_set(nullptr, true);
 
-         unit_test_status_pass(&status, ok && null_ok);
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "init verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         if (ok)
-            ok = x_status_x.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
-
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok =
+         (
+            unit_test_options_need_subtests(nullptr) == XPCCUT_NEED_SUBTESTS
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "CONTINUE"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         cbool_t quit;
-         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_CONTINUE;
-         quit = unit_test_dispose(&x_status_x);
-         ok = ! quit && unit_test_status_passed(&x_status_x);
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  4 */
+         if (ok)
+            ok = unit_test_options_need_subtests_set(&x_options_x, false);
 
-      if (unit_test_status_next_subtest(&status, "DNT"))
-      {
-         cbool_t quit;
-         x_status_x.m_Test_Result = true;
-         x_status_x.m_Subtest_Error_Count = 0;
-         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_DNT;
-         quit = unit_test_dispose(&x_status_x);
-         ok = ! quit && unit_test_status_passed(&x_status_x);
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = ! x_options_x.m_Need_Subtests;
 
-      /*  5 */
+         if (ok)
+            ok = ! unit_test_options_need_subtests(&x_options_x);
 
-      if (unit_test_status_next_subtest(&status, "FAILED"))
-      {
-         cbool_t quit;
-         x_status_x.m_Test_Result = true;
-         x_status_x.m_Subtest_Error_Count = 0;
-         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_FAILED;
-         quit = unit_test_dispose(&x_status_x);
-         show_deliberate_failure(options);
-         ok = ! quit && ! unit_test_status_passed(&x_status_x);
          unit_test_status_pass(&status, ok);
       }
 
-      /*  6 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "QUITTED"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         cbool_t quit;
-         x_status_x.m_Test_Result = true;
-         x_status_x.m_Subtest_Error_Count = 0;
-         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_QUITTED;
-         quit = unit_test_dispose(&x_status_x);
-         ok = quit && unit_test_status_passed(&x_status_x);
-         unit_test_status_pass(&status, ok);
-      }
+         if (ok)
+            ok = unit_test_options_need_subtests_set(&x_options_x, true);
 
-      /*  7 */
+         if (ok)
+            ok = x_options_x.m_Need_Subtests;
+
+         if (ok)
+            ok = unit_test_options_need_subtests(&x_options_x);
 
-      if (unit_test_status_next_subtest(&status, "ABORTED"))
-      {
-         cbool_t quit;
-         x_status_x.m_Test_Result = true;
-         x_status_x.m_Subtest_Error_Count = 0;
-         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_ABORTED;
-         quit = unit_test_dispose(&x_status_x);
-         show_deliberate_failure(options);
-         ok = quit && ! unit_test_status_passed(&x_status_x);
          unit_test_status_pass(&status, ok);
       }
    }
@@ -9891,20 +10290,18 @@ unit_unit_test_04_07 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit/regression test to verify that the "test-load-count"
- *    function works.
- *
- *    This test uses the same method as 04_06, but gets the count
- *    through the unit_test_count() accessor instead of directly.
+ *    Provides a unit/regression test to verify the "force-failure"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    8. unit_test_cpp_load_count()
+ *   25. Accessors for the --force-failure option.
  *
  * \test
- *    -  unit_test_cpp_load_count()
+ *    -  unit_test_options_force_failure_set()
+ *    -  unit_test_options_force_failure()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -9914,102 +10311,95 @@ unit_unit_test_04_07 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_08 (const unit_test_options_t * options)
+unit_unit_test_03_25 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 8, "unit_test_t", "unit_test_count()"
+      &status, options, 3, 25,
+      "unit_test_options_t", "unit_test_options_force_failure...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_count(nullptr) == 0;
+         cbool_t null_ok = ! unit_test_options_force_failure_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_force_failure_set(nullptr, true);
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         if (ok)
-            ok = unit_test_count(&x_test_x) == 0;
+         cbool_t null_ok =
+         (
+            unit_test_options_force_failure(nullptr) == XPCCUT_FORCE_FAILURE
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
          if (ok)
-            ok = unit_test_cpp_load_count(&x_test_x);
+            ok = unit_test_options_force_failure_set(&x_options_x, false);
 
          if (ok)
-            ok = unit_test_count(&x_test_x) == 1;
+            ok = ! x_options_x.m_Force_Failure;
+
+         if (ok)
+            ok = ! unit_test_options_force_failure(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
          if (ok)
-         {
-            int ti;
-            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
-            {
-               if (ok)
-                  ok = unit_test_cpp_load_count(&x_test_x);
-               else
-               {
-                  if (! xpccut_is_silent())
-                  {
-                     fprintf
-                     (
-                        stdout, "%s %d\n",
-                        _("load failed at count"), unit_test_count(&x_test_x)
-                     );
-                  }
-                  break;
-               }
-            }
-            if (ok)
-               ok = unit_test_count(&x_test_x) == 1000;
-         }
-      }
+            ok = unit_test_options_force_failure_set(&x_options_x, true);
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+         if (ok)
+            ok = x_options_x.m_Force_Failure;
 
-      unit_test_destroy(&x_test_x);
+         if (ok)
+            ok = unit_test_options_force_failure(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "test-number"
- *    functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_Current_Test_Number field is manipulated directly.
+ *    Provides a unit/regression test to verify the
+ *    "get-current-test-number" functionality.
  *
- *    For more extensive testing, see the unit-test for the
- *    unit_test_next_test() function:  unit_unit_test_04_10().
+ *    There's probably more that can be done with this test.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *    9. unit_test_number()
+ *   26. unit_test_options_current_test()
  *
  * \test
- *    -  unit_test_number()
+ *    -  unit_test_options_current_test()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10019,110 +10409,230 @@ unit_unit_test_04_08 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_09 (const unit_test_options_t * options)
+unit_unit_test_03_26 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 9, "unit_test_t", "unit_test_number()"
+      &status, options, 3, 26,
+      "unit_test_options_t", "unit_test_options_current_test()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
       if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = unit_test_number(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
+         cbool_t null_ok = unit_test_options_current_test(nullptr) ==
+            XPCCUT_NO_CURRENT_TEST;
 
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "get"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
+         ok =  unit_test_options_current_test(&x_options_x) ==
+            XPCCUT_NO_CURRENT_TEST;
 
-         if (ok)
-            ok = unit_test_number(&x_test_x) == XPCCUT_NO_CURRENT_TEST;
+         unit_test_status_pass(&status, ok);
       }
+   }
+   return status;
+}
 
-      /*  3 */
+/**
+ *    Provides a unit/regression test to verify the
+ *    "prompt-before/response-before" functionality.
+ *
+ * \group
+ *    3. unit_test_options_t functions.
+ *
+ * \case
+ *   27. Accessors for the --response-before option.
+ *
+ * \test
+ *    -  unit_test_options_prompt_before_set()
+ *    -  unit_test_options_prompt_before()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
-      {
-         x_test_x.m_Current_Test_Number = 0;
-         if (ok)
-            ok = unit_test_number(&x_test_x) == 0;
-      }
+static unit_test_status_t
+unit_unit_test_03_27 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 3, 27,
+      "unit_test_options_t", "unit_test_options_prompt_before()"
+   );
+   if (ok)
+   {
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /*  4 */
+      /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         x_test_x.m_Current_Test_Number = 1;
+         cbool_t not_ok = ! unit_test_options_prompt_before_set(nullptr, 0);
+         if (not_ok)
+            not_ok = unit_test_options_prompt_before(nullptr) == 0;
+
+         unit_test_status_pass(&status, not_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Zero value"))
+      {
+         ok = unit_test_options_prompt_before_set(&x_options_x, 0);
          if (ok)
-            ok = unit_test_number(&x_test_x) == 1;
+            ok = unit_test_options_prompt_before(&x_options_x) == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "'c' value"))
+      {
+         /*
+          * Note how the upper-case value is mapped to lower-case when
+          * stored, for easier usage in the unit-test library.
+          */
+
+         ok = unit_test_options_prompt_before_set(&x_options_x, 'c');
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 'c';
+
+         if (ok)
+            ok = unit_test_options_prompt_before_set(&x_options_x, 'C');
+
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 'c';
+
+         if (ok)
+            ok = x_options_x.m_Response_Before = 'c';
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "'s' value"))
+      {
+         ok = unit_test_options_prompt_before_set(&x_options_x, 's');
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 's';
+
+         if (ok)
+            ok = unit_test_options_prompt_before_set(&x_options_x, 'S');
+
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 's';
+
+         if (ok)
+            ok = x_options_x.m_Response_Before = 's';
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "'a' value"))
+      {
+         ok = unit_test_options_prompt_before_set(&x_options_x, 'a');
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 'a';
+
+         if (ok)
+            ok = unit_test_options_prompt_before_set(&x_options_x, 'A');
+
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 'a';
+
+         if (ok)
+            ok = x_options_x.m_Response_Before = 'a';
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      if (unit_test_status_next_subtest(&status, "'q' value"))
       {
+         ok = unit_test_options_prompt_before_set(&x_options_x, 'q');
          if (ok)
-         {
-            int ti;
-            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
-            {
-               if (ok)
-                  ok = unit_test_number(&x_test_x);
-               else
-               {
-                  if (! xpccut_is_silent())
-                  {
-                     fprintf
-                     (
-                        stdout, "%s %d\n",
-                        _("load failed at count"), x_test_x.m_Test_Count
-                     );
-                  }
-                  break;
-               }
-            }
-            if (ok)
-               ok = x_test_x.m_Test_Count == 1000;
-         }
+            ok = unit_test_options_prompt_before(&x_options_x) == 'q';
+
+         if (ok)
+            ok = unit_test_options_prompt_before_set(&x_options_x, 'Q');
+
+         if (ok)
+            ok = unit_test_options_prompt_before(&x_options_x) == 'q';
+
+         if (ok)
+            ok = x_options_x.m_Response_Before = 'q';
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  6 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Unsupported value"))
+      {
+         if (ok)
+         {
+            cbool_t not_ok = ! unit_test_options_prompt_before_set
+            (
+               &x_options_x, '1'    /* '1' is not a valid response character  */
+            );
+
+            /*
+             * The value from the previous sub-test should still be in
+             * force.
+             */
+
+            if (not_ok)
+               not_ok = unit_test_options_prompt_before(&x_options_x) == 'q';
+
+            if (not_ok)
+               not_ok = x_options_x.m_Response_Before = 'q';
+
+            unit_test_status_pass(&status, not_ok);
+         }
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "next test-number"
- *    functionality works.
+ *    Provides a unit/regression test to verify the
+ *    "prompt-after/response-after" functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   10. Next test-number functionality.
+ *   28. Accessors for the --response-after option.
  *
  * \test
- *    -  unit_test_next_test()
- *    -  unit_test_number() [an additional test]
+ *    -  unit_test_options_prompt_after_set()
+ *    -  unit_test_options_prompt_after()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10132,247 +10642,170 @@ unit_unit_test_04_09 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_10 (const unit_test_options_t * options)
+unit_unit_test_03_28 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 10, "unit_test_t", "unit_test_next_test()"
+      &status, options, 3, 28,
+      "unit_test_options_t", "unit_test_options_prompt_after()"
    );
    if (ok)
    {
-      /*
-       * Observe how we have to sneak in and turn off the show-progress
-       * option of the x_test_x object, otherwise the default value of this
-       * option will yield a lot of unhelpful output.
-       */
-
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
       if (ok)
-      {
-         ok = unit_test_options_show_progress_set
-         (
-            &x_test_x.m_App_Options, false
-         );
-      }
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
       if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = unit_test_next_test(nullptr) ==
-            XPCCUT_NO_CURRENT_TEST;
-
-         /*
-          * Now verify that the m_Current_Test_Number field is not modified
-          * in this situation.  How could it be?!
-          */
-
-         if (null_ok)
-            null_ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+         cbool_t not_ok = ! unit_test_options_prompt_after_set(nullptr, 0);
+         if (not_ok)
+            not_ok = unit_test_options_prompt_after(nullptr) == 0;
 
-         unit_test_status_pass(&status, null_ok);
+         unit_test_status_pass(&status, not_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Zero value"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.  Already done in another test, but
-          * if it gets broken, it is convenient to see it here, too, and we
-          * don't want to keep testing stuff that is already broken based on
-          * a bad result here.
-          */
-
+         ok = unit_test_options_prompt_after_set(&x_options_x, 0);
          if (ok)
-            ok = unit_test_number(&x_test_x) == XPCCUT_NO_CURRENT_TEST;
+            ok = unit_test_options_prompt_after(&x_options_x) == 0;
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "No tests loaded yet"))
+      if (unit_test_status_next_subtest(&status, "'p' value"))
       {
          /*
-          * At this point, no unit-test functions have been loaded into the
-          * x_test_x object, so it has an m_Test_Count field of 0.  So the
-          * unit_test_next_test() function should always fail.  However,
-          * internally the m_Current_Test_Number field is always
-          * incremented, so we do some white-box testing of it.  (This may
-          * cause us pain later!)
+          * Note how the upper-case value is mapped to lower-case when
+          * stored, for easier usage in the unit-test library.
           */
 
+         ok = unit_test_options_prompt_after_set(&x_options_x, 'p');
          if (ok)
-         {
-            int test = unit_test_next_test(&x_test_x);
-            ok = test == XPCCUT_NO_CURRENT_TEST;
-            if (ok)
-               ok = x_test_x.m_Current_Test_Number == 0;
-         }
-      }
+            ok = unit_test_options_prompt_after(&x_options_x) == 'p';
 
-      /*  4 */
+         if (ok)
+            ok = unit_test_options_prompt_after_set(&x_options_x, 'P');
 
-      if (unit_test_status_next_subtest(&status, "Still no tests loaded"))
-      {
          if (ok)
-         {
-            int test = unit_test_next_test(&x_test_x);
-            ok = test == XPCCUT_NO_CURRENT_TEST;
-            if (ok)
-               ok = x_test_x.m_Current_Test_Number == 1;
-         }
+            ok = unit_test_options_prompt_after(&x_options_x) == 'p';
+
+         if (ok)
+            ok = x_options_x.m_Response_After = 'p';
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  5 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Load 3 tests"))
+      if (unit_test_status_next_subtest(&status, "'f' value"))
       {
+         ok = unit_test_options_prompt_after_set(&x_options_x, 'f');
          if (ok)
-         {
-            ok = unit_test_init(&x_test_x);                 /* start again */
-            if (ok)
-            {
-               ok = unit_test_options_show_progress_set
-               (
-                  &x_test_x.m_App_Options, false
-               );
-            }
-            if (ok)
-               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+            ok = unit_test_options_prompt_after(&x_options_x) == 'f';
 
-            if (ok)
-               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+         if (ok)
+            ok = unit_test_options_prompt_after_set(&x_options_x, 'F');
 
-            if (ok)
-               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+         if (ok)
+            ok = unit_test_options_prompt_after(&x_options_x) == 'f';
 
-            if (ok)
-            {
-               int test = unit_test_next_test(&x_test_x);
-               ok = test == 0;
-            }
-            if (ok)
-            {
-               int test = unit_test_next_test(&x_test_x);
-               ok = test == 1;
-            }
-            if (ok)
-            {
-               int test = unit_test_next_test(&x_test_x);
-               ok = test == 2;
-            }
-            if (ok)
-            {
-               /*
-                * Here, will will exceed the three loaded tests.
-                */
+         if (ok)
+            ok = x_options_x.m_Response_After = 'f';
 
-               int test = unit_test_next_test(&x_test_x);
-               ok = test == XPCCUT_NO_CURRENT_TEST;
-            }
-         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  6 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "1000 fake tests loop"))
+      if (unit_test_status_next_subtest(&status, "'a' value"))
       {
+         ok = unit_test_options_prompt_after_set(&x_options_x, 'a');
          if (ok)
-         {
-            int ti;
-            int test;
-            ok = unit_test_init(&x_test_x);                 /* start again */
-            if (ok)
-            {
-               ok = unit_test_options_show_progress_set
-               (
-                  &x_test_x.m_App_Options, false
-               );
-            }
-            if (ok)
-            {
-               x_test_x.m_Test_Count = 1000;                /* 1000 fakes  */
-               for (ti = 0; ti < 1000; ti++)
-               {
-                  test = unit_test_next_test(&x_test_x);
-                  ok = test == ti;
-                  if (! ok)
-                  {
-                     if (! xpccut_is_silent())
-                     {
-                        fprintf
-                        (
-                           stdout, "%s %d\n", _("test failed at count"), ti
-                        );
-                     }
-                     break;
-                  }
-               }
-            }
-         }
+            ok = unit_test_options_prompt_after(&x_options_x) == 'a';
+
+         if (ok)
+            ok = unit_test_options_prompt_after_set(&x_options_x, 'A');
+
+         if (ok)
+            ok = unit_test_options_prompt_after(&x_options_x) == 'a';
+
+         if (ok)
+            ok = x_options_x.m_Response_After = 'a';
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  7 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "1000 fake while loop"))
+      if (unit_test_status_next_subtest(&status, "'q' value"))
       {
+         ok = unit_test_options_prompt_after_set(&x_options_x, 'q');
          if (ok)
-         {
-            int ti = 0;
-            int test;
-            ok = unit_test_init(&x_test_x);                 /* start again */
-            if (ok)
-            {
-               ok = unit_test_options_show_progress_set
-               (
-                  &x_test_x.m_App_Options, false
-               );
-            }
-            if (ok)
-            {
-               x_test_x.m_Test_Count = 1000;                /* 1000 fakes  */
-               while ((test = unit_test_next_test(&x_test_x)) <= 0)
-               {
-                  ti++;
-               }
-               ok = ti == 1000;
-               if (! ok)
-               {
-                  if (! xpccut_is_silent())
-                     fprintf(stdout, "  %s == %d\n", _("time counter"), ti);
-               }
-            }
-         }
+            ok = unit_test_options_prompt_after(&x_options_x) == 'q';
+
+         if (ok)
+            ok = unit_test_options_prompt_after_set(&x_options_x, 'Q');
+
+         if (ok)
+            ok = unit_test_options_prompt_after(&x_options_x) == 'q';
+
+         if (ok)
+            ok = x_options_x.m_Response_After = 'q';
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  6 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Unsupported value"))
+      {
+         if (ok)
+         {
+            cbool_t not_ok = ! unit_test_options_prompt_after_set
+            (
+               &x_options_x, '1'    /* '1' is not a valid response character  */
+            );
+
+            /*
+             * The value from the previous sub-test should still be in
+             * force.
+             */
+
+            if (not_ok)
+               not_ok = unit_test_options_prompt_after(&x_options_x) == 'q';
+
+            if (not_ok)
+               not_ok = x_options_x.m_Response_After = 'q';
+
+            unit_test_status_pass(&status, not_ok);
+         }
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "sub-test count"
- *    functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_Subtest_Count field is manipulated directly.
+ *    Provides a unit/regression test to verify the "is-simulated"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   11. unit_test_subtest_count()
+ *   29. Accessors for the --simulated option.
  *
  * \test
- *    -  unit_test_subtest_count()
+ *    -  unit_test_options_is_simulated_set()
+ *    -  unit_test_options_is_simulated()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10382,82 +10815,94 @@ unit_unit_test_04_10 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_11 (const unit_test_options_t * options)
+unit_unit_test_03_29 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 11, "unit_test_t", "unit_test_subtest_count()"
+      &status, options, 3, 29,
+      "unit_test_options_t", "unit_test_options_is_simulated...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_subtest_count(nullptr) == 0;
+         cbool_t null_ok = ! unit_test_options_is_simulated_set
+         (
+            nullptr, false
+         );
+         if (null_ok)
+            null_ok = ! unit_test_options_is_simulated_set(nullptr, true);
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
-
-         if (ok)
-            ok = unit_test_subtest_count(&x_test_x) == 0;
+         cbool_t null_ok =
+         (
+            unit_test_options_is_simulated(nullptr) == XPCCUT_IS_SIMULATED
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting false, set/get"))
       {
-         x_test_x.m_Subtest_Count = 0;
          if (ok)
-            ok = unit_test_subtest_count(&x_test_x) == 0;
+            ok = unit_test_options_is_simulated_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! x_options_x.m_Is_Simulated;
+
+         if (ok)
+            ok = ! unit_test_options_is_simulated(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting true, set/get"))
       {
-         x_test_x.m_Subtest_Count = 1;
          if (ok)
-            ok = unit_test_subtest_count(&x_test_x) == 1;
-      }
+            ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+         if (ok)
+            ok = x_options_x.m_Is_Simulated;
 
-      unit_test_destroy(&x_test_x);
+         if (ok)
+            ok = unit_test_options_is_simulated(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "failures count"
- *    functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_Total_Errors field is manipulated directly.
+ *    Provides a unit/regression test to verify the "job count"
+ *    functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   12. unit_test_failures()
+ *   30. Accessors for the --jobs option.
  *
  * \test
- *    -  unit_test_failures()
+ *    -  unit_test_options_job_count_set()
+ *    -  unit_test_options_job_count()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10467,84 +10912,179 @@ unit_unit_test_04_11 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_12 (const unit_test_options_t * options)
+unit_unit_test_03_30 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 12, "unit_test_t", "unit_test_failures()"
+      &status, options, 3, 30,
+      "unit_test_options_t", "unit_test_options_job_count...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
-
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_failures(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
-
+         cbool_t null_ok = ! unit_test_options_job_count_set(nullptr, 2);
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      {
+         cbool_t null_ok =
+         (
+            unit_test_options_job_count(nullptr) == XPCCUT_JOB_COUNT
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
+      {
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == XPCCUT_JOB_COUNT;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Setting to 0, set/get"))
       {
          /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
+          * Set explicitly to make sure the correct value replaces this one.
           */
 
+         x_options_x.m_Job_Count = 5;
          if (ok)
-            ok = unit_test_failures(&x_test_x) == 0;
+            ok = ! unit_test_options_job_count_set(&x_options_x, 0);
+
+         if (ok)
+            ok = x_options_x.m_Job_Count == XPCCUT_JOB_COUNT;
+
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == XPCCUT_JOB_COUNT;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
+      /*  5 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting to 1, set/get"))
       {
-         x_test_x.m_Total_Errors = 0;
+         x_options_x.m_Job_Count = 5;
          if (ok)
-            ok = unit_test_failures(&x_test_x) == 0;
+            ok = unit_test_options_job_count_set(&x_options_x, 1);
+
+         if (ok)
+            ok = x_options_x.m_Job_Count == 1;
+
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == 1;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Setting to maximum, set/get"))
       {
-         x_test_x.m_Total_Errors = 1;
+         x_options_x.m_Job_Count = 5;
          if (ok)
-            ok = unit_test_failures(&x_test_x) == 1;
+            ok = unit_test_options_job_count_set(&x_options_x, XPCCUT_JOBS_MAX);
+
+         if (ok)
+            ok = x_options_x.m_Job_Count == XPCCUT_JOBS_MAX;
+
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == XPCCUT_JOBS_MAX;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  7 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Setting past maximum, set/get"))
+      {
+         x_options_x.m_Job_Count = 5;
+         if (ok)
+         {
+            ok = ! unit_test_options_job_count_set
+            (
+               &x_options_x, XPCCUT_JOBS_MAX + 1
+            );
+         }
+         if (ok)
+            ok = x_options_x.m_Job_Count == XPCCUT_JOB_COUNT;
+
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == XPCCUT_JOB_COUNT;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
+
+      if (unit_test_status_next_subtest(&status, "Parsing --jobs and -j"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 4;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--jobs";
+         argv[3] = "6";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.30", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == 6;
+
+         argv[2] = "-j";
+         argv[3] = "3";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.30", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "first-failed-test"
- *    functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_First_Failed_Test field is manipulated directly.
+ *    Provides a unit/regression test to verify the "isolate" and "test
+ *    timeout" functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   13. unit_test_first_failed_test()
+ *   31. Accessors for the --isolate and --test-timeout options.
  *
  * \test
- *    -  unit_test_first_failed_test()
+ *    -  unit_test_options_is_isolated_set()
+ *    -  unit_test_options_is_isolated()
+ *    -  unit_test_options_test_timeout_set()
+ *    -  unit_test_options_test_timeout()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10554,84 +11094,184 @@ unit_unit_test_04_12 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_13 (const unit_test_options_t * options)
+unit_unit_test_03_31 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 13, "unit_test_t", "unit_test_first_failed_test()"
+      &status, options, 3, 31,
+      "unit_test_options_t", "unit_test_options_is_isolated...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_first_failed_test(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
+         cbool_t null_ok = ! unit_test_options_is_isolated_set(nullptr, true);
+         if (null_ok)
+            null_ok = ! unit_test_options_test_timeout_set(nullptr, 100);
 
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
-
-         if (ok)
-            ok = unit_test_first_failed_test(&x_test_x) == 0;
+         cbool_t null_ok =
+         (
+            unit_test_options_is_isolated(nullptr) == XPCCUT_IS_ISOLATED &&
+            unit_test_options_test_timeout(nullptr) == XPCCUT_TEST_TIMEOUT
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
       {
-         x_test_x.m_First_Failed_Test = 0;
          if (ok)
-            ok = unit_test_first_failed_test(&x_test_x) == 0;
+         {
+            ok = unit_test_options_is_isolated(&x_options_x) ==
+               XPCCUT_IS_ISOLATED;
+         }
+         if (ok)
+         {
+            ok = unit_test_options_test_timeout(&x_options_x) ==
+               XPCCUT_TEST_TIMEOUT;
+         }
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Isolation, set/get"))
       {
-         x_test_x.m_First_Failed_Test = 1;
          if (ok)
-            ok = unit_test_first_failed_test(&x_test_x) == 1;
+            ok = unit_test_options_is_isolated_set(&x_options_x, true);
+
+         if (ok)
+            ok = unit_test_options_is_isolated(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_is_isolated_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! unit_test_options_is_isolated(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  5 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Timeout range, set/get"))
+      {
+         x_options_x.m_Test_Timeout = 5;
+         if (ok)
+            ok = ! unit_test_options_test_timeout_set(&x_options_x, -1);
+
+         if (ok)
+            ok = x_options_x.m_Test_Timeout == XPCCUT_TEST_TIMEOUT;
+
+         if (ok)
+         {
+            ok = unit_test_options_test_timeout_set
+            (
+               &x_options_x, XPCCUT_TIMEOUT_MAX
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_test_timeout(&x_options_x) ==
+               XPCCUT_TIMEOUT_MAX;
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_test_timeout_set
+            (
+               &x_options_x, XPCCUT_TIMEOUT_MAX + 1
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_test_timeout(&x_options_x) ==
+               XPCCUT_TEST_TIMEOUT;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 5;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--isolate";
+         argv[3] = "--test-timeout";
+         argv[4] = "250";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.31", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_is_isolated(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_test_timeout(&x_options_x) == 250;
+
+         argv[2] = "--no-isolate";
+         argv[4] = "0";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.31", "version", "none"
+            );
+         }
+         if (ok)
+            ok = ! unit_test_options_is_isolated(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_test_timeout(&x_options_x) == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the
- *    "first-failed-group" functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_First_Failed_Group field is manipulated directly.
+ *    Provides a unit/regression test to verify the "shard" functionality.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   14. unit_test_first_failed_group()
+ *   32. Accessors for the --shard-count and related options.
  *
  * \test
- *    -  unit_test_first_failed_group()
+ *    -  unit_test_options_shard_count_set()
+ *    -  unit_test_options_shard_count()
+ *    -  unit_test_options_shard_index_set()
+ *    -  unit_test_options_shard_index()
+ *    -  unit_test_options_shard_mode_set()
+ *    -  unit_test_options_shard_mode()
+ *    -  unit_test_options_durations_file_set()
+ *    -  unit_test_options_durations_file()
+ *    -  unit_test_options_save_durations_file_set()
+ *    -  unit_test_options_save_durations_file()
+ *    -  unit_test_options_in_shard()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10641,171 +11281,347 @@ unit_unit_test_04_13 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_14 (const unit_test_options_t * options)
+unit_unit_test_03_32 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 14, "unit_test_t", "unit_test_first_failed_group()"
+      &status, options, 3, 32,
+      "unit_test_options_t", "unit_test_options_shard...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_first_failed_group(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
+         cbool_t null_ok = ! unit_test_options_shard_count_set(nullptr, 2);
+         if (null_ok)
+            null_ok = ! unit_test_options_shard_index_set(nullptr, 1);
+
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_shard_mode_set
+            (
+               nullptr, XPCCUT_SHARD_BY_HASH
+            );
+         }
+         if (null_ok)
+            null_ok = ! unit_test_options_durations_file_set(nullptr, "x");
+
+         if (null_ok)
+            null_ok = ! unit_test_options_save_durations_file_set(nullptr, "x");
 
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
-
-         if (ok)
-            ok = unit_test_first_failed_group(&x_test_x) == 0;
+         cbool_t null_ok =
+         (
+            unit_test_options_shard_count(nullptr) == XPCCUT_SHARD_COUNT &&
+            unit_test_options_shard_index(nullptr) == XPCCUT_SHARD_INDEX &&
+            unit_test_options_shard_mode(nullptr) == XPCCUT_SHARD_MODE &&
+            unit_test_options_durations_file(nullptr) == nullptr &&
+            unit_test_options_save_durations_file(nullptr) == nullptr &&
+            unit_test_options_in_shard(nullptr, "group", "case")
+         );
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
       {
-         x_test_x.m_First_Failed_Group = 0;
          if (ok)
-            ok = unit_test_first_failed_group(&x_test_x) == 0;
+            ok = unit_test_options_shard_count(&x_options_x) == 1;
+
+         if (ok)
+            ok = unit_test_options_shard_index(&x_options_x) == 0;
+
+         if (ok)
+         {
+            ok = unit_test_options_shard_mode(&x_options_x) ==
+               XPCCUT_SHARD_BY_INDEX;
+         }
+         if (ok)
+            ok = unit_test_options_durations_file(&x_options_x) == nullptr;
+
+         if (ok)
+         {
+            ok = unit_test_options_save_durations_file(&x_options_x) ==
+               nullptr;
+         }
+         if (ok)
+            ok = unit_test_options_in_shard(&x_options_x, "group", "case");
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Shard count, set/get"))
       {
-         x_test_x.m_First_Failed_Group = 1;
+         x_options_x.m_Shard_Count = 5;
          if (ok)
-            ok = unit_test_first_failed_group(&x_test_x) == 1;
+            ok = ! unit_test_options_shard_count_set(&x_options_x, 0);
+
+         if (ok)
+            ok = unit_test_options_shard_count(&x_options_x) == 1;
+
+         if (ok)
+         {
+            ok = unit_test_options_shard_count_set
+            (
+               &x_options_x, XPCCUT_SHARDS_MAX
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_shard_count(&x_options_x) ==
+               XPCCUT_SHARDS_MAX;
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_shard_count_set
+            (
+               &x_options_x, XPCCUT_SHARDS_MAX + 1
+            );
+         }
+         if (ok)
+            ok = unit_test_options_shard_count(&x_options_x) == 1;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  5 */
 
-      unit_test_destroy(&x_test_x);
-   }
-   return status;
-}
+      if (unit_test_status_next_subtest(&status, "Shard index, set/get"))
+      {
+         x_options_x.m_Shard_Index = 5;
+         if (ok)
+            ok = ! unit_test_options_shard_index_set(&x_options_x, -1);
 
-/**
- *    Provides a unit/regression test to verify that the "first-failed-case"
- *    functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_First_Failed_Case field is manipulated directly.
- *
- * \group
- *    4. unit_test_t functions.
- *
- * \case
- *   15. unit_test_first_failed_case()
- *
- * \test
- *    -  unit_test_first_failed_case()
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+         if (ok)
+            ok = unit_test_options_shard_index(&x_options_x) == 0;
 
-static unit_test_status_t
-unit_unit_test_04_15 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 4, 15, "unit_test_t", "unit_test_first_failed_case()"
-   );
-   if (ok)
-   {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+         if (ok)
+            ok = unit_test_options_shard_index_set(&x_options_x, 7);
 
-      /*  1 */
+         if (ok)
+            ok = unit_test_options_shard_index(&x_options_x) == 7;
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
-      {
-         cbool_t null_ok = unit_test_first_failed_case(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
+         if (ok)
+         {
+            ok = ! unit_test_options_shard_index_set
+            (
+               &x_options_x, XPCCUT_SHARDS_MAX
+            );
+         }
+         if (ok)
+            ok = unit_test_options_shard_index(&x_options_x) == 0;
 
-         unit_test_status_pass(&status, null_ok);
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  2 */
+      /*  6 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Shard mode, set/get"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
+         if (ok)
+         {
+            ok = unit_test_options_shard_mode_set
+            (
+               &x_options_x, XPCCUT_SHARD_BY_DURATION
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_shard_mode(&x_options_x) ==
+               XPCCUT_SHARD_BY_DURATION;
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_shard_mode_set
+            (
+               &x_options_x, (unit_test_shard_mode_t) 99
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_shard_mode(&x_options_x) ==
+               XPCCUT_SHARD_MODE;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
 
+      if (unit_test_status_next_subtest(&status, "File names, set/get"))
+      {
+         const char * name;
          if (ok)
-            ok = unit_test_first_failed_case(&x_test_x) == 0;
+            ok = unit_test_options_durations_file_set(&x_options_x, "in.dur");
+
+         if (ok)
+         {
+            name = unit_test_options_durations_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "in.dur") == 0;
+         }
+         if (ok)
+         {
+            ok = unit_test_options_save_durations_file_set
+            (
+               &x_options_x, "out.dur"
+            );
+         }
+         if (ok)
+         {
+            name = unit_test_options_save_durations_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "out.dur") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_durations_file_set(&x_options_x, "");
+
+         if (ok)
+            ok = unit_test_options_durations_file(&x_options_x) == nullptr;
+
+         if (ok)
+            ok = unit_test_options_save_durations_file_set(&x_options_x, "");
+
+         if (ok)
+         {
+            ok = unit_test_options_save_durations_file(&x_options_x) ==
+               nullptr;
+         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
+      /*  8 */
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      if (unit_test_status_next_subtest(&status, "In shard, by index"))
       {
-         x_test_x.m_First_Failed_Case = 0;
+         int running = unit_test_options_context_test();
+         (void) unit_test_options_shard_count_set(&x_options_x, 3);
+         (void) unit_test_options_shard_index_set(&x_options_x, 1);
+         (void) unit_test_options_shard_mode_set
+         (
+            &x_options_x, XPCCUT_SHARD_BY_INDEX
+         );
+         x_options_x.m_Current_Test_Number = XPCCUT_NO_CURRENT_TEST;
+         unit_test_options_context_set(XPCCUT_NO_CURRENT_TEST);  /* no runner */
          if (ok)
-            ok = unit_test_first_failed_case(&x_test_x) == 0;
+            ok = unit_test_options_in_shard(&x_options_x, "group", "case");
+
+         unit_test_options_context_set(running);
+         x_options_x.m_Current_Test_Number = 4;
+         if (ok)
+            ok = unit_test_options_in_shard(&x_options_x, "group", "case");
+
+         x_options_x.m_Current_Test_Number = 5;
+         if (ok)
+            ok = ! unit_test_options_in_shard(&x_options_x, "group", "case");
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  4 */
+      /*  9 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "In shard, by hash"))
       {
-         x_test_x.m_First_Failed_Case = 1;
+         int matches = 0;
+         int shard;
+         (void) unit_test_options_shard_mode_set
+         (
+            &x_options_x, XPCCUT_SHARD_BY_HASH
+         );
+         for (shard = 0; shard < 3; ++shard)
+         {
+            x_options_x.m_Shard_Index = shard;
+            x_options_x.m_Current_Test_Number = shard;   /* must not matter */
+            if (unit_test_options_in_shard(&x_options_x, "group", "case"))
+               ++matches;
+         }
          if (ok)
-            ok = unit_test_first_failed_case(&x_test_x) == 1;
+            ok = matches == 1;                  /* in exactly one shard      */
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /* 10 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 11;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--shard-count";
+         argv[3] = "8";
+         argv[4] = "--shard-index";
+         argv[5] = "6";
+         argv[6] = "--shard-by";
+         argv[7] = "hash";
+         argv[8] = "--durations";
+         argv[9] = "test.dur";
+         argv[10] = "--no-verbose";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.32", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_shard_count(&x_options_x) == 8;
+
+         if (ok)
+            ok = unit_test_options_shard_index(&x_options_x) == 6;
+
+         if (ok)
+         {
+            ok = unit_test_options_shard_mode(&x_options_x) ==
+               XPCCUT_SHARD_BY_HASH;
+         }
+         if (ok)
+         {
+            const char * name = unit_test_options_durations_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "test.dur") == 0;
+         }
+         argv[7] = "bogus";
+         argc = 8;                              /* the last option is bad   */
+         if (ok)
+         {
+            ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.32", "version", "none"
+            );
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the
- *    "first-failed-sub-test" functionality works.
- *
- *    This test is very rudimentary, and simply tests this function as a
- *    field accessor for unit_test_t, and little more.  The
- *    m_First_Failed_Subtest field is manipulated directly.
+ *    Provides a unit/regression test to verify the filter that decides if
+ *    a test is allowed to run.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   16. unit_test_first_failed_subtest()
+ *   33. unit_test_options_is_selected().
  *
  * \test
- *    -  unit_test_first_failed_subtest()
+ *    -  unit_test_options_is_selected()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10815,84 +11631,166 @@ unit_unit_test_04_15 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_16 (const unit_test_options_t * options)
+unit_unit_test_03_33 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 16,
-      "unit_test_t", "unit_test_first_failed_subtest()"
+      &status, options, 3, 33,
+      "unit_test_options_t", "unit_test_options_is_selected()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
       {
-         cbool_t null_ok = unit_test_first_failed_subtest(nullptr) ==
-            XPCCUT_INVALID_PARAMETER;
-
+         cbool_t null_ok = ! unit_test_options_is_selected
+         (
+            nullptr, 1, 1, "group", "case"
+         );
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 1, 1, nullptr, "case"
+            );
+         }
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 1, 1, "group", nullptr
+            );
+         }
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "No filters"))
       {
-         /*
-          * This sub-test provides additional verification that the field is
-          * properly initialized to -1.
-          */
-
          if (ok)
-            ok = unit_test_first_failed_subtest(&x_test_x) == 0;
-      }
-
-      /*  3 */
+         {
+            ok = unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "group", "case"
+            );
+         }
+         unit_test_status_pass(&status, ok);
+      }
 
-      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Group and case numbers"))
       {
-         x_test_x.m_First_Failed_Subtest = 0;
          if (ok)
-            ok = unit_test_first_failed_subtest(&x_test_x) == 0;
+            ok = unit_test_options_test_group_set(&x_options_x, 7);
+
+         if (ok)
+         {
+            ok = unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "group", "case"
+            );
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 8, 9, "group", "case"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_test_case_set(&x_options_x, 9);
+
+         if (ok)
+         {
+            ok = unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "group", "case"
+            );
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 7, 10, "group", "case"
+            );
+         }
+         (void) unit_test_options_test_group_set(&x_options_x, 0);
+         (void) unit_test_options_test_case_set(&x_options_x, 0);
+         unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      if (unit_test_status_next_subtest(&status, "Group and case names"))
       {
-         x_test_x.m_First_Failed_Subtest = 1;
          if (ok)
-            ok = unit_test_first_failed_subtest(&x_test_x) == 1;
-      }
+            ok = unit_test_options_named_group_set(&x_options_x, "group");
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+         if (ok)
+         {
+            ok = unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "group", "case"
+            );
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "grope", "case"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_named_case_set(&x_options_x, "case");
 
-      unit_test_destroy(&x_test_x);
+         if (ok)
+         {
+            ok = unit_test_options_is_selected
+            (
+               &x_options_x, 1, 2, "group", "case"
+            );
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_is_selected
+            (
+               &x_options_x, 7, 9, "group", "cast"
+            );
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "run-init"
- *    functionality works.
- *
- *    This test is important, as the unit_test_run_init() function is needed
- *    in any C++ unit-test wrapper library that one writes.
+ *    Provides a unit/regression test to verify the accessors of the
+ *    performance-baseline options.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   17. unit_test_run_init()
+ *   34. Accessors for the --baseline and related options.
  *
  * \test
- *    -  unit_test_run_init()
+ *    -  unit_test_options_baseline_file_set()
+ *    -  unit_test_options_baseline_file()
+ *    -  unit_test_options_write_baseline_file_set()
+ *    -  unit_test_options_write_baseline_file()
+ *    -  unit_test_options_perf_tolerance_set()
+ *    -  unit_test_options_perf_tolerance()
+ *    -  unit_test_options_baseline_set()
+ *    -  unit_test_options_baseline_find()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -10902,106 +11800,257 @@ unit_unit_test_04_16 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_17 (const unit_test_options_t * options)
+unit_unit_test_03_34 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 17, "unit_test_t", "unit_test_run_init()"
+      &status, options, 3, 34,
+      "unit_test_options_t", "unit_test_options_baseline...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      ok = unit_test_init(&x_test_x);
-
-      /*
-       * Reduce the amount of output.
-       */
-
-      ok = unit_test_options_show_progress_set(&x_test_x.m_App_Options, false);
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set"))
       {
-         cbool_t null_ok = unit_test_run_init(nullptr) == 0;
+         cbool_t null_ok = ! unit_test_options_baseline_file_set(nullptr, "x");
+         if (null_ok)
+            null_ok = ! unit_test_options_write_baseline_file_set(nullptr, "x");
+
+         if (null_ok)
+            null_ok = ! unit_test_options_perf_tolerance_set(nullptr, 10);
+
+         if (null_ok)
+            null_ok = ! unit_test_options_baseline_set(nullptr, nullptr, 0);
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', get"))
+      {
+         cbool_t null_ok =
+         (
+            unit_test_options_baseline_file(nullptr) == nullptr &&
+            unit_test_options_write_baseline_file(nullptr) == nullptr &&
+            unit_test_options_perf_tolerance(nullptr) ==
+               XPCCUT_PERF_TOLERANCE &&
+            unit_test_options_baseline_find(nullptr, 1, 1, "x") == nullptr
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
       {
+         if (ok)
+            ok = unit_test_options_baseline_file(&x_options_x) == nullptr;
+
+         if (ok)
+            ok = unit_test_options_write_baseline_file(&x_options_x) == nullptr;
+
          if (ok)
          {
-            ok = x_test_x.m_Start_Time_us.tv_sec == 0;
-            if (ok)
-               ok = x_test_x.m_Start_Time_us.tv_sec == 0;
+            ok = unit_test_options_perf_tolerance(&x_options_x) ==
+               XPCCUT_PERF_TOLERANCE;
          }
+         if (ok)
+         {
+            ok = unit_test_options_baseline_find(&x_options_x, 1, 1, "x") ==
+               nullptr;
+         }
+         unit_test_status_pass(&status, ok);
       }
 
-      /*  3 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Perf tolerance, set/get"))
       {
-         x_test_x.m_Test_Count = 10;
          if (ok)
-            ok = unit_test_run_init(&x_test_x) == 10;
+            ok = ! unit_test_options_perf_tolerance_set(&x_options_x, -1);
 
          if (ok)
-            ok = x_test_x.m_Current_Test_Number  == XPCCUT_NO_CURRENT_TEST;
+         {
+            ok = ! unit_test_options_perf_tolerance_set
+            (
+               &x_options_x, XPCCUT_PERF_TOLERANCE_MAX + 1
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_perf_tolerance(&x_options_x) ==
+               XPCCUT_PERF_TOLERANCE;
+         }
+         if (ok)
+            ok = unit_test_options_perf_tolerance_set(&x_options_x, 0);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Test    ==  0;
+            ok = unit_test_options_perf_tolerance(&x_options_x) == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
 
+      if (unit_test_status_next_subtest(&status, "File names, set/get"))
+      {
+         const char * name;
          if (ok)
-            ok = x_test_x.m_First_Failed_Group   ==  0;
+            ok = unit_test_options_baseline_file_set(&x_options_x, "in.base");
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Case    ==  0;
+         {
+            name = unit_test_options_baseline_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "in.base") == 0;
+         }
+         if (ok)
+         {
+            ok = unit_test_options_write_baseline_file_set
+            (
+               &x_options_x, "out.base"
+            );
+         }
+         if (ok)
+         {
+            name = unit_test_options_write_baseline_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "out.base") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_baseline_file_set(&x_options_x, "");
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Subtest ==  0;
+            ok = unit_test_options_baseline_file(&x_options_x) == nullptr;
 
          if (ok)
-            ok = x_test_x.m_Total_Errors         ==  0;
+            ok = unit_test_options_write_baseline_file_set(&x_options_x, "");
 
-         /*
-          * How to test?:  the value of the m_Start_Time_us field.
-          */
+         if (ok)
+            ok = unit_test_options_write_baseline_file(&x_options_x) == nullptr;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Baseline, set/find"))
+      {
+         static const unit_test_baseline_t s_baseline[3] =
+         {
+            { 1, 2, 10.0, 1.0, "alpha" },
+            { 1, 3, 20.0, 2.0, "alpha" },
+            { 1, 2, 30.0, 3.0, "alpha" }
+         };
+         const unit_test_baseline_t * entry;
+         if (ok)
+            ok = ! unit_test_options_baseline_set(&x_options_x, s_baseline, -1);
+
+         if (ok)
+            ok = unit_test_options_baseline_set(&x_options_x, s_baseline, 3);
 
          if (ok)
          {
-            ok = x_test_x.m_Start_Time_us.tv_sec > 0;
-            if (ok)
-               ok = x_test_x.m_Start_Time_us.tv_sec >= 0;
+            entry = unit_test_options_baseline_find
+            (
+               &x_options_x, 1, 2, "alpha"
+            );
+            ok = entry == &s_baseline[2];       /* the last one is used      */
          }
+         if (ok)
+         {
+            entry = unit_test_options_baseline_find
+            (
+               &x_options_x, 1, 3, "alpha"
+            );
+            ok = entry == &s_baseline[1];
+         }
+         if (ok)
+         {
+            entry = unit_test_options_baseline_find(&x_options_x, 1, 2, "beta");
+            ok = entry == nullptr;
+         }
+         if (ok)
+            ok = unit_test_options_baseline_set(&x_options_x, nullptr, 3);
+
+         if (ok)
+            ok = x_options_x.m_Baseline_Count == 0;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  7 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 9;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--baseline";
+         argv[3] = "test.base";
+         argv[4] = "--write-baseline";
+         argv[5] = "new.base";
+         argv[6] = "--perf-tolerance";
+         argv[7] = "40";
+         argv[8] = "--no-verbose";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.34", "version", "none"
+            );
+         }
+         if (ok)
+         {
+            const char * name = unit_test_options_baseline_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "test.base") == 0;
+         }
+         if (ok)
+         {
+            const char * name = unit_test_options_write_baseline_file
+            (
+               &x_options_x
+            );
+            ok = cut_not_nullptr(name) && strcmp(name, "new.base") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_perf_tolerance(&x_options_x) == 40;
+
+         argv[7] = "-5";
+         argc = 8;                              /* the last option is bad   */
+         if (ok)
+         {
+            ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.34", "version", "none"
+            );
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "dispose-of-test"
- *    functionality works.
- *
- *    This test could potentially be quite complex.  I may get tired before
- *    finishing it!
+ *    Provides a unit/regression test to verify the accessors of the
+ *    --profile option.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   18. unit_test_dispose_of_test()
+ *   35. Accessors for the --profile option.
  *
  * \test
- *    -  unit_test_dispose_of_test()
+ *    -  unit_test_options_is_profiled_set()
+ *    -  unit_test_options_is_profiled()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11011,283 +12060,236 @@ unit_unit_test_04_17 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_18 (const unit_test_options_t * options)
+unit_unit_test_03_35 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 18, "unit_test_t", "unit_test_dispose_of_test()"
+      &status, options, 3, 35,
+      "unit_test_options_t", "unit_test_options_is_profiled...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
       unit_test_options_t x_options_x;
-      unit_test_status_t x_status_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 4;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      /*
-       * Now modify the test structure with the opposite values (or at
-       * least different values) for every accessible field, so that the
-       * resulting test is a bizarro-clone of test 03_01.
-       *
-       *    ok = unit_test_init(&x_test_x);
-       */
+      /*  1 */
 
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      argv[2] = "--sleep-time";
-      argv[3] = "10";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.18.1", "version", "additionalhelp"
-      );
-      if (ok)
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
       {
-         x_options_x = x_test_x.m_App_Options;     /* copy fake test options  */
-         ok = unit_test_status_initialize
-         (
-            &x_status_x, &x_options_x, 91, 1, _("Test 04.18"), _("Disposal")
-         );
-      }
-
-      /*  1 */
-
-      if (unit_test_status_next_subtest(&status, "Null 'this'"))
-      {
-         /**
-          * Recall that unit_test_dispose_of_test() returns 'true' only if
-          * the caller should cause the unit-test application to quit.
-          */
-
-         cbool_t null_ok = ! unit_test_dispose_of_test(nullptr, nullptr, nullptr);
+         cbool_t null_ok = ! unit_test_options_is_profiled_set(nullptr, true);
+         if (null_ok)
+         {
+            null_ok = unit_test_options_is_profiled(nullptr) ==
+               XPCCUT_IS_PROFILED;
+         }
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Partial init verification"))
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
       {
          if (ok)
          {
-            ok = x_test_x.m_Start_Time_us.tv_sec == 0;
-            if (ok)
-               ok = x_test_x.m_Start_Time_us.tv_sec == 0;
-
-            if (ok)
-               ok = unit_test_options_test_sleep_time(&x_test_x.m_App_Options)
-                     == 10;
+            ok = unit_test_options_is_profiled(&x_options_x) ==
+               XPCCUT_IS_PROFILED;
          }
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      if (unit_test_status_next_subtest(&status, "Profile flag, set/get"))
       {
-         /*
-          * In this sub-test, since we're passing in a null status pointer,
-          * there's no way to fail the test [which can only be done inside
-          * the unit_dispose_of_test() function via a call to
-          * unit_test_dispose(), which requires a good status pointer.]
-          *
-          * Therefore, no failure values can occur in this sub-test.
-          */
-
-         x_test_x.m_Test_Count = 10;
-         if (ok)
-            ok = ! unit_test_dispose_of_test(&x_test_x, nullptr, nullptr);
-
-         if (ok)
-            ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
-
          if (ok)
-            ok = x_test_x.m_Total_Errors == 0;              /* and not 1      */
-
-         if (ok)
-            ok = x_test_x.m_First_Failed_Test == 0;         /* and not -1     */
+            ok = unit_test_options_is_profiled_set(&x_options_x, true);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Group == 0;        /* and not -1     */
+            ok = unit_test_options_is_profiled(&x_options_x);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Case == 0;         /* and not -1     */
+            ok = unit_test_options_is_profiled_set(&x_options_x, false);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Subtest == 0;      /* and not -1     */
+            ok = ! unit_test_options_is_profiled(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Reinitialize"))
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
       {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 3;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--profile";
          if (ok)
          {
-            argv[0] = "unit_test_test";
-            argv[1] = "--no-show-progress";
-            argc = 2;
-            ok = unit_test_initialize
+            ok = unit_test_options_parse
             (
-               &x_test_x, argc, argv, "Test 04.18", "version", "additionalhelp"
+               &x_options_x, argc, argv, "Test 03.35", "version", "none"
             );
          }
          if (ok)
-            ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+            ok = unit_test_options_is_profiled(&x_options_x);
 
+         argv[2] = "--no-profile";
          if (ok)
-            ok = x_test_x.m_Total_Errors == 0;
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.35", "version", "none"
+            );
+         }
+         if (ok)
+            ok = ! unit_test_options_is_profiled(&x_options_x);
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify the accessors of the
+ *    --perf-counters option.
+ *
+ * \group
+ *    3. unit_test_options_t functions.
+ *
+ * \case
+ *   36. Accessors for the --perf-counters option.
+ *
+ * \test
+ *    -  unit_test_options_perf_counters_set()
+ *    -  unit_test_options_perf_counters()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_03_36 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 3, 36,
+      "unit_test_options_t", "unit_test_options_perf_counters...()"
+   );
+   if (ok)
+   {
+      unit_test_options_t x_options_x;
+      cbool_t silent = xpccut_is_silent();
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      xpccut_silence_printing();             /* hide "not available" notes  */
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
+      {
+         cbool_t null_ok = ! unit_test_options_perf_counters_set(nullptr, true);
+         if (null_ok)
+         {
+            null_ok = unit_test_options_perf_counters(nullptr) ==
+               XPCCUT_PERF_COUNTERS;
+         }
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
 
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
+      {
          if (ok)
-            ok = x_test_x.m_First_Failed_Test == 0;
+         {
+            ok = unit_test_options_perf_counters(&x_options_x) ==
+               XPCCUT_PERF_COUNTERS;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
 
+      if (unit_test_status_next_subtest(&status, "Counter flag, set/get"))
+      {
          if (ok)
-            ok = x_test_x.m_First_Failed_Group == 0;
+            ok = unit_test_options_perf_counters_set(&x_options_x, true);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Case == 0;
+            ok = unit_test_options_perf_counters(&x_options_x);
 
          if (ok)
-            ok = x_test_x.m_First_Failed_Subtest == 0;
+            ok = unit_test_options_perf_counters_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! unit_test_options_perf_counters(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  5 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Stop-on-error test, passed"))
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
       {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 3;
          argv[0] = "unit_test_test";
          argv[1] = "--no-show-progress";
-         argv[2] = "--stop-on-error";
-         argc = 3;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
-         );
+         argv[2] = "--perf-counters";
          if (ok)
          {
-            x_options_x = x_test_x.m_App_Options;        /* fake options      */
-            ok = unit_test_status_initialize
+            ok = unit_test_options_parse
             (
-               &x_status_x, &x_options_x, 92, 2,
-               _("Test 04.18"), _("Disposal")
+               &x_options_x, argc, argv, "Test 03.36", "version", "none"
             );
-            if (ok)
-            {
-               cbool_t runresult;
-               ok = ! unit_test_dispose_of_test          /* false == no quit  */
-               (
-                  &x_test_x, &x_status_x, &runresult
-               );
-               if (ok)
-                  ok = runresult;                        /* made it pass      */
-            }
          }
-         unit_test_status_pass(&status, ok);
-      }
-
-      /*  6 */
+         if (ok)
+            ok = unit_test_options_perf_counters(&x_options_x);
 
-      if (unit_test_status_next_subtest(&status, "Stop-on-error test, no quit"))
-      {
-         argv[0] = "unit_test_test";
-         argv[1] = "--no-show-progress";
-         argv[2] = "--stop-on-error";
-         argc = 3;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
-         );
+         argv[2] = "--no-perf-counters";
          if (ok)
          {
-            x_options_x = x_test_x.m_App_Options;     /* fake test options    */
-            ok = unit_test_status_initialize
+            ok = unit_test_options_parse
             (
-               &x_status_x, &x_options_x, 92, 2,
-               _("Test 04.18"), _("Disposal")
+               &x_options_x, argc, argv, "Test 03.36", "version", "none"
             );
-            if (ok)
-               ok = unit_test_status_fail(&x_status_x);
-
-            if (ok)
-            {
-               cbool_t runresult;
-               ok = unit_test_dispose_of_test               /* true == quit   */
-               (
-                  &x_test_x, &x_status_x, &runresult
-               );
-               if (ok)
-                  ok = ! runresult;                         /* made it fail   */
-            }
-
-            /*
-             * Since we're setting up an artificial situation where we
-             * haven't called certain setup functions, a few of the
-             * results are weird, but accepted.
-             */
-
-            if (ok)
-               ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
-
-            if (ok)
-               ok = x_test_x.m_Total_Errors == 1;
-
-            if (ok)
-               ok = x_test_x.m_First_Failed_Test == XPCCUT_NO_CURRENT_TEST;
-
-            if (ok)
-               ok = x_test_x.m_First_Failed_Group == 92;
-
-            if (ok)
-               ok = x_test_x.m_First_Failed_Case == 2;
-
-            if (ok)
-               ok = x_test_x.m_First_Failed_Subtest == 0;   /* weird but true */
          }
+         if (ok)
+            ok = ! unit_test_options_perf_counters(&x_options_x);
+
          unit_test_status_pass(&status, ok);
       }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
+      if (! silent)
+         xpccut_allow_printing();
    }
    return status;
 }
 
 /**
- *    Provides a fake test to use in unit_unit_test_04_19().
+ *    Provides a unit/regression test to verify the accessors of the
+ *    --fuzz-jobs option.
  *
- *    This function does not call unit_test_status_next_subtest().
+ * \group
+ *    3. unit_test_options_t functions.
  *
- * \param options
- *    Provides the command-line options for the unit-test application.
+ * \case
+ *   37. Accessors for the --fuzz-jobs option.
  *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
-
-static unit_test_status_t
-fake_unit_test_04_19 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 4, 19,
-      _("Unit-test fake run"), "unit_test_run()"
-   );
-   if (ok)
-      unit_test_status_pass(&status, true);                    /* fake a pass */
-
-   return status;
-}
-
-/**
- *    Provides a fake test to use in unit_unit_test_04_19() to test the
- *    --force-failure option.
+ * \test
+ *    -  unit_test_options_fuzz_job_count_set()
+ *    -  unit_test_options_fuzz_job_count()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11297,25 +12299,131 @@ fake_unit_test_04_19 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-fake_unit_test_04_19_force_fail (const unit_test_options_t * options)
+unit_unit_test_03_37 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 19, _("Unit-test force-fail run"), "unit_test_run()"
+      &status, options, 3, 37,
+      "unit_test_options_t", "unit_test_options_fuzz_job_count...()"
    );
    if (ok)
    {
-      cbool_t result = ! unit_test_options_force_failure(options);
-      unit_test_status_pass(&status, result);                  /* fake a fail */
-   }
-   return status;
-}
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
+      {
+         cbool_t null_ok = ! unit_test_options_fuzz_job_count_set(nullptr, 2);
+         if (null_ok)
+         {
+            null_ok = unit_test_options_fuzz_job_count(nullptr) ==
+               XPCCUT_FUZZ_JOB_COUNT;
+         }
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
+      {
+         if (ok)
+         {
+            ok = unit_test_options_fuzz_job_count(&x_options_x) ==
+               XPCCUT_FUZZ_JOB_COUNT;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Range limits, set/get"))
+      {
+         x_options_x.m_Fuzz_Job_Count = 5;
+         if (ok)
+            ok = ! unit_test_options_fuzz_job_count_set(&x_options_x, 0);
+
+         if (ok)
+         {
+            ok = unit_test_options_fuzz_job_count(&x_options_x) ==
+               XPCCUT_FUZZ_JOB_COUNT;
+         }
+         if (ok)
+         {
+            ok = unit_test_options_fuzz_job_count_set
+            (
+               &x_options_x, XPCCUT_JOBS_MAX
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_fuzz_job_count(&x_options_x) ==
+               XPCCUT_JOBS_MAX;
+         }
+         if (ok)
+         {
+            ok = ! unit_test_options_fuzz_job_count_set
+            (
+               &x_options_x, XPCCUT_JOBS_MAX + 1
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_fuzz_job_count(&x_options_x) ==
+               XPCCUT_FUZZ_JOB_COUNT;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Parsing --fuzz-jobs"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 4;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--fuzz-jobs";
+         argv[3] = "8";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.37", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_fuzz_job_count(&x_options_x) == 8;
+
+         if (ok)
+            ok = unit_test_options_job_count(&x_options_x) == XPCCUT_JOB_COUNT;
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
 
 /**
- *    Provides a fake test to use in unit_unit_test_04_19().
+ *    Provides a unit/regression test to verify the accessors and parsing of
+ *    the --report-format and --report-file options.
  *
- *    This function does call unit_test_status_next_subtest().
+ * \group
+ *    3. unit_test_options_t functions.
+ *
+ * \case
+ *   38. Accessors for the --report-format and --report-file options.
+ *
+ * \test
+ *    -  unit_test_options_report_format_set()
+ *    -  unit_test_options_report_format()
+ *    -  unit_test_options_report_file_set()
+ *    -  unit_test_options_report_file()
+ *    -  xpccut_report_default_file()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11325,49 +12433,186 @@ fake_unit_test_04_19_force_fail (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-fake_subtest_unit_test_04_19 (const unit_test_options_t * options)
+unit_unit_test_03_38 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 19, _("Unit-test fake run"), "unit_test_run()"
+      &status, options, 3, 38,
+      "unit_test_options_t", "unit_test_options_report_...()"
    );
    if (ok)
    {
-      if (unit_test_status_next_subtest(&status, "Do-nothing test 1"))
-         unit_test_status_pass(&status, true);
-   }
-   if (ok)
-   {
-      if (unit_test_status_next_subtest(&status, "Do-nothing test 2"))
-         unit_test_status_pass(&status, true);
+      unit_test_options_t x_options_x;
+      cbool_t silent = xpccut_is_silent();
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
+
+      xpccut_silence_printing();             /* hide the bad-value errors   */
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
+      {
+         cbool_t null_ok = ! unit_test_options_report_format_set
+         (
+            nullptr, XPCCUT_REPORT_JUNIT
+         );
+         if (null_ok)
+         {
+            null_ok = unit_test_options_report_format(nullptr) ==
+               XPCCUT_REPORT_FORMAT;
+         }
+         if (null_ok)
+            null_ok = ! unit_test_options_report_file_set(nullptr, "x");
+
+         if (null_ok)
+            null_ok = cut_is_nullptr(unit_test_options_report_file(nullptr));
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
+      {
+         if (ok)
+         {
+            ok = unit_test_options_report_format(&x_options_x) ==
+               XPCCUT_REPORT_FORMAT;
+         }
+         if (ok)
+            ok = cut_is_nullptr(unit_test_options_report_file(&x_options_x));
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Formats and file names"))
+      {
+         if (ok)
+         {
+            ok = ! unit_test_options_report_format_set
+            (
+               &x_options_x, (unit_test_report_format_t) 99
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_report_format_set
+            (
+               &x_options_x, XPCCUT_REPORT_TAP
+            );
+         }
+         if (ok)
+         {
+            ok = strcmp
+            (
+               unit_test_options_report_file(&x_options_x),
+               "unit_test_report.tap"
+            ) == 0;
+         }
+         if (ok)
+            ok = unit_test_options_report_file_set(&x_options_x, "r.txt");
+
+         if (ok)
+         {
+            ok = strcmp(unit_test_options_report_file(&x_options_x), "r.txt")
+               == 0;
+         }
+         if (ok)
+            ok = unit_test_options_report_file_set(&x_options_x, "");
+
+         if (ok)
+         {
+            ok = strcmp
+            (
+               xpccut_report_default_file(XPCCUT_REPORT_JUNIT),
+               "unit_test_report.xml"
+            ) == 0;
+         }
+         if (ok)
+            ok = cut_is_nullptr(xpccut_report_default_file(XPCCUT_REPORT_NONE));
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 6;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--report-format";
+         argv[3] = "jsonl";
+         argv[4] = "--report-file";
+         argv[5] = "results.jsonl";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.38", "version", "none"
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_report_format(&x_options_x) ==
+               XPCCUT_REPORT_JSONL;
+         }
+         if (ok)
+         {
+            ok = strcmp
+            (
+               unit_test_options_report_file(&x_options_x), "results.jsonl"
+            ) == 0;
+         }
+         argc = 4;
+         argv[3] = "xml";
+         if (ok)
+         {
+            ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.38", "version", "none"
+            );
+         }
+         argv[3] = "none";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.38", "version", "none"
+            );
+         }
+         if (ok)
+            ok = cut_is_nullptr(unit_test_options_report_file(&x_options_x));
+
+         unit_test_status_pass(&status, ok);
+      }
+      if (! silent)
+         xpccut_allow_printing();
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "run"
- *    functionality works.
- *
- *    This test could be complex.  Since this function obviously already
- *    passes the smoke test (we know this because the unit-test application
- *    succeeds, and we've seen it succeed under the debugger), here we
- *    mainly test for the obvious error conditions that can occur in
- *    unit_test_run().
- *
- * Group 4:
- *
- *    unit_test_t functions.
+ *    Provides a unit/regression test to verify the per-thread test context
+ *    that holds the number of the running test, so that the options of a
+ *    run can be shared.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   19. Running and sub-test functionality.
+ *   39. The test context.
  *
  * \test
- *    -  unit_test_run()
- *    -  unit_test_initialize()
+ *    -  unit_test_options_context_set()
+ *    -  unit_test_options_context_test()
+ *    -  unit_test_options_test_number()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11377,231 +12622,217 @@ fake_subtest_unit_test_04_19 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_19 (const unit_test_options_t * options)
+unit_unit_test_03_39 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 19, "unit_test_t", "unit_test_run()"
+      &status, options, 3, 39,
+      "unit_test_options_t", "unit_test_options_context_...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 2;
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.19.1", "version", "additionalhelp"
-      );
+      unit_test_options_t x_options_x;
+      int running = unit_test_options_context_test();
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_show_progress_set(&x_options_x, false);
 
       /*  1 */
 
       if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         cbool_t null_ok = ! unit_test_run(nullptr);
+         cbool_t null_ok = unit_test_options_test_number(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Empty test list"))
+      if (unit_test_status_next_subtest(&status, "Shared options"))
       {
          /*
-          * This test insures (indirectly) that unit_test_run() calls
-          * unit_test_run_init() to set up the test.
+          * The runner put the number of this test in the context, and left
+          * the options, which every test shares, alone.
           */
 
+         ok = running >= 0;
          if (ok)
-            ok = ! unit_test_run(&x_test_x);
+            ok = options->m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+         if (ok)
+            ok = unit_test_options_test_number(options) == running;
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "No sub-test test part 1"))
+      if (unit_test_status_next_subtest(&status, "Set and get"))
       {
-         /*
-          * This test checks that the caller used the
-          * unit_test_status_next_subtest() function.  Right now, this is a
-          * bit of a weird test.  If the caller specified
-          * --require-sub-tests on the command-line of this unit-test
-          *  application, then we call the fake test function that does
-          *  provide a unit test, and vice versa.
-          */
+         unit_test_options_context_set(42);
+         ok = unit_test_options_context_test() == 42;
+         if (ok)
+            ok = unit_test_options_test_number(&x_options_x) == 42;
 
-         if (unit_test_options_force_failure(options))
-         {
-            if (ok)
-               ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
-         }
-         else
+         if (ok)
          {
-            if (ok)
-               ok = unit_test_load(&x_test_x, fake_unit_test_04_19);
+            ok = unit_test_options_current_test(&x_options_x) ==
+               XPCCUT_NO_CURRENT_TEST;
          }
-
+         unit_test_options_context_set(running);
          if (ok)
-            ok = unit_test_run(&x_test_x);
+            ok = unit_test_options_context_test() == running;
 
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "No sub-test test part 2"))
+      if (unit_test_status_next_subtest(&status, "Options number wins"))
       {
-         /*
-          * Tests that not having sub-test properly fails if they are
-          * required.  It temporarily modifies this option to force it on.
-          * This loaded test should cause unit_test_run() to fail.
-          */
+         ok = unit_test_options_current_test_set(&x_options_x, 7);
+         if (ok)
+            ok = unit_test_options_test_number(&x_options_x) == 7;
 
-         cbool_t force_failure = unit_test_options_force_failure
-         (
-            &x_test_x.m_App_Options
-         );
-         if (ok)
-            ok = unit_test_load(&x_test_x, fake_unit_test_04_19);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
 
-         (void) unit_test_options_force_failure_set
-         (
-            &x_test_x.m_App_Options, true                /* force option on   */
-         );
+/**
+ *    Provides a unit/regression test to verify the accessors of the
+ *    --huge-pages option.
+ *
+ * \group
+ *    3. unit_test_options_t functions.
+ *
+ * \case
+ *   40. Accessors for the --huge-pages option.
+ *
+ * \test
+ *    -  unit_test_options_huge_pages_set()
+ *    -  unit_test_options_huge_pages()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
 
-         /*
-          * Even though --force-failure is now set, the fake unit-test
-          * function that is loaded does not support it.  Therefore, the
-          * following call succeeds (returns 'true').
-          */
+static unit_test_status_t
+unit_unit_test_03_40 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 3, 40,
+      "unit_test_options_t", "unit_test_options_huge_pages...()"
+   );
+   if (ok)
+   {
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-         if (ok)
-            ok = unit_test_run(&x_test_x);
+      /*  1 */
 
-         /*
-          * Now use a test that supports the --force-failure option.
-          */
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
+      {
+         cbool_t null_ok = ! unit_test_options_huge_pages_set(nullptr, true);
+         if (null_ok)
+         {
+            null_ok = unit_test_options_huge_pages(nullptr) ==
+               XPCCUT_HUGE_PAGES;
+         }
+         unit_test_status_pass(&status, null_ok);
+      }
 
-         if (ok)
-            ok = unit_test_load(&x_test_x, fake_unit_test_04_19_force_fail);
+      /*  2 */
 
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
+      {
          if (ok)
-            ok = ! unit_test_run(&x_test_x);
+         {
+            ok = unit_test_options_huge_pages(&x_options_x) ==
+               XPCCUT_HUGE_PAGES;
+         }
 
-         (void) unit_test_options_force_failure_set
-         (
-            &x_test_x.m_App_Options, force_failure
-         );
          unit_test_status_pass(&status, ok);
       }
 
-      /*  5 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Stop-on-error test, passed"))
+      if (unit_test_status_next_subtest(&status, "Huge-page flag, set/get"))
       {
-         unit_test_options_t x_options_x;
-         unit_test_status_t x_status_x;
-         argv[0] = "unit_test_test";
-         argv[1] = "--no-show-progress";
-         argv[2] = "--stop-on-error";
-         argc = 3;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
-         );
          if (ok)
-         {
-            x_options_x = x_test_x.m_App_Options;        /* fake options      */
-            ok = unit_test_status_initialize
-            (
-               &x_status_x, &x_options_x, 92, 2,
-               _("Test 04.18"), _("Disposal")
-            );
-            if (ok)
-            {
-               /*
-                * TODO:
-                * Now we need to set up the status structure to indicate
-                * that unit_test_run() should quit (and quit with a "passed"
-                * status).
-                *
-                *    1. Need to LOAD a test.
-                *    2. Need to set up the status structure properly.
-                */
+            ok = unit_test_options_huge_pages_set(&x_options_x, true);
 
-               if (ok)
-                  ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+         if (ok)
+            ok = unit_test_options_huge_pages(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_huge_pages_set(&x_options_x, false);
+
+         if (ok)
+            ok = ! unit_test_options_huge_pages(&x_options_x);
 
-               if (ok)
-                  ok = unit_test_run(&x_test_x);
-            }
-         }
          unit_test_status_pass(&status, ok);
       }
 
-      /*  6 */
+      /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Stop-on-error test, no quit"))
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
       {
-         unit_test_options_t x_options_x;
-         unit_test_status_t x_status_x;
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 3;
          argv[0] = "unit_test_test";
          argv[1] = "--no-show-progress";
-         argv[2] = "--stop-on-error";
-         argc = 3;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
-         );
+         argv[2] = "--huge-pages";
          if (ok)
          {
-            x_options_x = x_test_x.m_App_Options;     /* fake test options    */
-            ok = unit_test_status_initialize
+            ok = unit_test_options_parse
             (
-               &x_status_x, &x_options_x, 92, 2,
-               _("Test 04.18"), _("Disposal")
+               &x_options_x, argc, argv, "Test 03.40", "version", "none"
             );
-            if (ok)
-               ok = unit_test_status_fail(&x_status_x);
-
-            if (ok)
-            {
-               /*
-                * Now we need to set up the status structure to indicate
-                * that unit_test_run() should quit (and quit with a "passed"
-                * status).
-                */
+         }
+         if (ok)
+            ok = unit_test_options_huge_pages(&x_options_x);
 
-               if (ok)
-                  ok = ! unit_test_run(&x_test_x);
-            }
+         argv[2] = "--no-huge-pages";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.40", "version", "none"
+            );
          }
+         if (ok)
+            ok = ! unit_test_options_huge_pages(&x_options_x);
+
          unit_test_status_pass(&status, ok);
       }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "before-run"
- *    functionality works.
+ *    Provides a unit/regression test to verify the accessors for the
+ *    --trace-file option.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   20. unit_test_run_a_test_before()
+ *   41. Accessors for the --trace-file option.
  *
  * \test
- *    -  unit_test_run_a_test_before()
+ *    -  unit_test_options_trace_file_set()
+ *    -  unit_test_options_trace_file()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11611,80 +12842,110 @@ unit_unit_test_04_19 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_20 (const unit_test_options_t * options)
+unit_unit_test_03_41 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 20,
-      "unit_test_t", "unit_test_run_a_test_before()"
+      &status, options, 3, 41,
+      "unit_test_options_t", "unit_test_options_trace_file...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 2;
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.20.1", "version", "additionalhelp"
-      );
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
       {
-         cbool_t null_ok = ! unit_test_run_a_test_before
-         (
-            nullptr, (intptr_t) nullptr
-         );
+         cbool_t null_ok = ! unit_test_options_trace_file_set(nullptr, "x");
+         if (null_ok)
+            null_ok = ! unit_test_options_trace_file_set(&x_options_x, nullptr);
+
+         if (null_ok)
+            null_ok = unit_test_options_trace_file(nullptr) == nullptr;
+
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      if (unit_test_status_next_subtest(&status, "Default value, get"))
       {
-         cbool_t null_ok = ! unit_test_run_a_test_before
-         (
-            nullptr, (intptr_t) fake_unit_test_04_19
-         );
-         unit_test_status_pass(&status, null_ok);
+         if (ok)
+            ok = unit_test_options_trace_file(&x_options_x) == nullptr;
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
+      if (unit_test_status_next_subtest(&status, "Trace file name, set/get"))
       {
-         cbool_t null_ok = ! unit_test_run_a_test_before
-         (
-            &x_test_x, (intptr_t) nullptr
-         );
-         unit_test_status_pass(&status, null_ok);
+         const char * name;
+         if (ok)
+            ok = unit_test_options_trace_file_set(&x_options_x, "run.json");
+
+         if (ok)
+         {
+            name = unit_test_options_trace_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "run.json") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_trace_file_set(&x_options_x, "");
+
+         if (ok)
+            ok = unit_test_options_trace_file(&x_options_x) == nullptr;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  4 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 4;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--trace-file";
+         argv[3] = "parsed.json";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.41", "version", "none"
+            );
+         }
+         if (ok)
+         {
+            const char * name = unit_test_options_trace_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "parsed.json") == 0;
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "after-run"
- *    functionality works.
+ *    Provides a unit/regression test to verify the accessors for the
+ *    --history and --order options.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   21. unit_test_run_a_test_after()
+ *   42. Accessors for the --history and --order options.
  *
  * \test
- *    -  unit_test_run_a_test_after()
+ *    -  unit_test_options_history_file_set()
+ *    -  unit_test_options_history_file()
+ *    -  unit_test_options_order_set()
+ *    -  unit_test_options_order()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11694,83 +12955,176 @@ unit_unit_test_04_20 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_21 (const unit_test_options_t * options)
+unit_unit_test_03_42 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 21,
-      "unit_test_t", "unit_test_run_a_test_after()"
+      &status, options, 3, 42,
+      "unit_test_options_t", "unit_test_options_history/order...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      unit_test_status_t x_status_x;
       unit_test_options_t x_options_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 2;
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.20.1", "version", "additionalhelp"
-      );
+      ok = unit_test_options_init(&x_options_x);
       if (ok)
-         x_options_x = x_test_x.m_App_Options;
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
-      if (ok)
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
       {
-         ok = unit_test_status_initialize
-         (
-            &x_status_x, &x_options_x, 90, 3, _("Test 04.21"), _("Disposal")
-         );
-      }
+         cbool_t null_ok = ! unit_test_options_history_file_set(nullptr, "x");
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_history_file_set
+            (
+               &x_options_x, nullptr
+            );
+         }
+         if (null_ok)
+            null_ok = unit_test_options_history_file(nullptr) == nullptr;
 
-      /*  1 */
+         if (null_ok)
+         {
+            null_ok = ! unit_test_options_order_set
+            (
+               nullptr, XPCCUT_ORDER_FAILED_FIRST
+            );
+         }
+         if (null_ok)
+            null_ok = unit_test_options_order(nullptr) == XPCCUT_ORDER;
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
-      {
-         cbool_t null_ok = ! unit_test_run_a_test_after(nullptr, nullptr);
          unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
       {
-         cbool_t null_ok = ! unit_test_run_a_test_after(nullptr, &x_status_x);
-         unit_test_status_pass(&status, null_ok);
+         if (ok)
+            ok = unit_test_options_history_file(&x_options_x) == nullptr;
+
+         if (ok)
+            ok = unit_test_options_order(&x_options_x) == XPCCUT_ORDER_LOAD;
+
+         unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Null status-pointer"))
+      if (unit_test_status_next_subtest(&status, "History and order, set/get"))
       {
-         cbool_t null_ok = ! unit_test_run_a_test_after(&x_test_x, nullptr);
-         unit_test_status_pass(&status, null_ok);
+         const char * name;
+         if (ok)
+            ok = unit_test_options_history_file_set(&x_options_x, "run.hist");
+
+         if (ok)
+         {
+            name = unit_test_options_history_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "run.hist") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_history_file_set(&x_options_x, "");
+
+         if (ok)
+            ok = unit_test_options_history_file(&x_options_x) == nullptr;
+
+         if (ok)
+         {
+            ok = unit_test_options_order_set
+            (
+               &x_options_x, XPCCUT_ORDER_FASTEST_FIRST
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_order(&x_options_x) ==
+               XPCCUT_ORDER_FASTEST_FIRST;
+         }
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = ! unit_test_options_order_set
+            (
+               &x_options_x, (unit_test_order_t) 99
+            );
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+            ok = unit_test_options_order(&x_options_x) == XPCCUT_ORDER;
+
+         unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  4 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 5;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--history";
+         argv[3] = "parsed.hist";
+         argv[4] = "--order=failed-first";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.42", "version", "none"
+            );
+         }
+         if (ok)
+         {
+            const char * name = unit_test_options_history_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "parsed.hist") == 0;
+         }
+         if (ok)
+         {
+            ok = unit_test_options_order(&x_options_x) ==
+               XPCCUT_ORDER_FAILED_FIRST;
+         }
+         argc = 4;
+         argv[2] = "--order";
+         argv[3] = "fastest-first";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.42", "version", "none"
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_order(&x_options_x) ==
+               XPCCUT_ORDER_FASTEST_FIRST;
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "run-a-test"
- *    functionality works.
+ *    Provides a unit/regression test to verify the accessors for the
+ *    --cache-file, --cache-key, and --cache options.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   22. unit_test_run_a_test()
+ *   43. Accessors for the --cache-file, --cache-key, and --cache options.
  *
  * \test
- *    -  unit_test_run_a_test()
+ *    -  unit_test_options_cache_file_set()
+ *    -  unit_test_options_cache_file()
+ *    -  unit_test_options_cache_key_set()
+ *    -  unit_test_options_cache_key()
+ *    -  unit_test_options_use_cache_set()
+ *    -  unit_test_options_use_cache()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11780,192 +13134,180 @@ unit_unit_test_04_21 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_22 (const unit_test_options_t * options)
+unit_unit_test_03_43 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 22,
-      "unit_test_t", "unit_test_run_a_test()"
+      &status, options, 3, 43,
+      "unit_test_options_t", "unit_test_options_cache...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 2;
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.22.1", "version", "additionalhelp"
-      );
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
       {
-         /**
-          * Sub-test 1:
-          *
-          * In the unit_test_run_a_test() function, unit_test_status_init()
-          * is always called before checking the arguments.  This is
-          * necessary even in the event of failure.  So this sub-test checks
-          * both the return result and the internal values of the resulting
-          * unit_test_status_t structure.
-          */
-
-         unit_test_status_t result = unit_test_run_a_test(nullptr, nullptr);
-         cbool_t ok = ! unit_test_status_passed(&result);
-         if (ok)
-         {
-            show_deliberate_failure(options);
-            ok = result.m_Test_Options == nullptr;
-         }
-         if (ok)
-            ok = strlen(result.m_Group_Name) == 0;
-
-         if (ok)
-            ok = strlen(result.m_Case_Description) == 0;
-
-         if (ok)
-            ok = strlen(result.m_Subtest_Name) == 0;
+         cbool_t null_ok = ! unit_test_options_cache_file_set(nullptr, "x");
+         if (null_ok)
+            null_ok = ! unit_test_options_cache_file_set(&x_options_x, nullptr);
 
-         if (ok)
-            ok = result.m_Test_Group == 0;
+         if (null_ok)
+            null_ok = unit_test_options_cache_file(nullptr) == nullptr;
 
-         if (ok)
-            ok = result.m_Test_Case == 0;
+         if (null_ok)
+            null_ok = ! unit_test_options_cache_key_set(nullptr, "x");
 
-         if (ok)
-            ok = result.m_Test_Result == false;       /* it failed, remember? */
+         if (null_ok)
+            null_ok = ! unit_test_options_cache_key_set(&x_options_x, nullptr);
 
-         if (ok)
-            ok = result.m_Subtest_Error_Count == 1;   /* Yup.  It failed.     */
+         if (null_ok)
+            null_ok = unit_test_options_cache_key(nullptr) == nullptr;
 
-         if (ok)
-            ok = result.m_Failed_Subtest == 0;
+         if (null_ok)
+            null_ok = ! unit_test_options_use_cache_set(nullptr, false);
 
-         if (ok)
-            ok = result.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+         if (null_ok)
+            null_ok = unit_test_options_use_cache(nullptr) == XPCCUT_USE_CACHE;
 
-         if (ok)
-            ok = result.m_Start_Time_us.tv_sec == 0;
+         unit_test_status_pass(&status, null_ok);
+      }
 
-         if (ok)
-            ok = result.m_Start_Time_us.tv_usec == 0;
+      /*  2 */
 
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
+      {
          if (ok)
-            ok = result.m_End_Time_us.tv_sec == 0;
+            ok = unit_test_options_cache_file(&x_options_x) == nullptr;
 
          if (ok)
-            ok = result.m_End_Time_us.tv_sec == 0;
+            ok = unit_test_options_cache_key(&x_options_x) == nullptr;
 
          if (ok)
-            ok = result.m_Test_Duration_ms == 0.0;
+            ok = unit_test_options_use_cache(&x_options_x);
 
          unit_test_status_pass(&status, ok);
       }
 
-      /*  2 */
+      /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      if (unit_test_status_next_subtest(&status, "File, key, flag, set/get"))
       {
-         unit_test_status_t result = unit_test_run_a_test
-         (
-            nullptr, fake_unit_test_04_19
-         );
-         cbool_t ok = ! unit_test_status_passed(&result);
+         const char * name;
+         if (ok)
+            ok = unit_test_options_cache_file_set(&x_options_x, "run.cache");
+
          if (ok)
          {
-            show_deliberate_failure(options);
-            ok = result.m_Test_Options == nullptr;
+            name = unit_test_options_cache_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "run.cache") == 0;
          }
          if (ok)
-            ok = strlen(result.m_Group_Name) == 0;
+            ok = unit_test_options_cache_file_set(&x_options_x, "");
 
          if (ok)
-            ok = strlen(result.m_Case_Description) == 0;
+            ok = unit_test_options_cache_file(&x_options_x) == nullptr;
 
          if (ok)
-            ok = strlen(result.m_Subtest_Name) == 0;
+            ok = unit_test_options_cache_key_set(&x_options_x, "r1234");
 
          if (ok)
-            ok = result.m_Test_Group == 0;
-
+         {
+            name = unit_test_options_cache_key(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "r1234") == 0;
+         }
          if (ok)
-            ok = result.m_Test_Case == 0;
+            ok = unit_test_options_cache_key_set(&x_options_x, "");
 
          if (ok)
-            ok = result.m_Test_Result == false;       /* it failed, remember? */
+            ok = unit_test_options_cache_key(&x_options_x) == nullptr;
 
          if (ok)
-            ok = result.m_Subtest_Error_Count == 1;   /* Yup.  It failed.     */
+            ok = unit_test_options_use_cache_set(&x_options_x, false);
 
          if (ok)
-            ok = result.m_Failed_Subtest == 0;
+            ok = ! unit_test_options_use_cache(&x_options_x);
 
-         if (ok)
-            ok = result.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+         unit_test_status_pass(&status, ok);
+      }
 
-         if (ok)
-            ok = result.m_Start_Time_us.tv_sec == 0;
+      /*  4 */
 
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 6;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--cache-file";
+         argv[3] = "parsed.cache";
+         argv[4] = "--cache-key";
+         argv[5] = "abc";
          if (ok)
-            ok = result.m_Start_Time_us.tv_usec == 0;
+            ok = unit_test_options_use_cache_set(&x_options_x, true);
 
          if (ok)
-            ok = result.m_End_Time_us.tv_sec == 0;
-
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.43", "version", "none"
+            );
+         }
          if (ok)
-            ok = result.m_End_Time_us.tv_sec == 0;
-
+         {
+            const char * name = unit_test_options_cache_file(&x_options_x);
+            ok = cut_not_nullptr(name) && strcmp(name, "parsed.cache") == 0;
+         }
          if (ok)
-            ok = result.m_Test_Duration_ms == 0.0;
-      }
-
-      /*  3 */
-
-      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
-      {
-         /**
-          * \todo
-          *    Try casting to function type unit_test_func_t.
-          *
-          * @gcc warns:
-          *
-          *    unit_test_run_a_test(&x_test_x, (intptr_t) nullptr);
-          */
-
-         unit_test_status_t s =
-            unit_test_run_a_test(&x_test_x, (const unit_test_func_t) nullptr);
+         {
+            const char * key = unit_test_options_cache_key(&x_options_x);
+            ok = cut_not_nullptr(key) && strcmp(key, "abc") == 0;
+         }
+         if (ok)
+            ok = unit_test_options_use_cache(&x_options_x);
 
+         argc = 3;
+         argv[2] = "--no-cache";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.43", "version", "none"
+            );
+         }
+         if (ok)
+            ok = ! unit_test_options_use_cache(&x_options_x);
 
-         ok = ! unit_test_status_passed(&s);
-         show_deliberate_failure(options);
          unit_test_status_pass(&status, ok);
       }
-
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
-
-      unit_test_destroy(&x_test_x);
    }
    return status;
 }
 
 /**
- *    Provides a unit/regression test to verify that the "check-subtest"
- *    functionality works.
+ *    Provides a unit/regression test to verify the accessors for the
+ *    --repeat, --until-fail, --shuffle, and --shuffle-seed options.
  *
  * \group
- *    4. unit_test_t functions.
+ *    3. unit_test_options_t functions.
  *
  * \case
- *   23. unit_test_check_subtests()
+ *   44. Accessors for the --repeat, --until-fail, and --shuffle options.
  *
  * \test
- *    -  unit_test_check_subtests()
+ *    -  unit_test_options_repeat_count_set()
+ *    -  unit_test_options_repeat_count()
+ *    -  unit_test_options_until_fail_set()
+ *    -  unit_test_options_until_fail()
+ *    -  unit_test_options_shuffle_set()
+ *    -  unit_test_options_shuffle()
+ *    -  unit_test_options_shuffle_seed_set()
+ *    -  unit_test_options_shuffle_seed()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -11975,99 +13317,248 @@ unit_unit_test_04_22 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_04_23 (const unit_test_options_t * options)
+unit_unit_test_03_44 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 4, 23,
-      "unit_test_t", "unit_test_check_subtests()"
+      &status, options, 3, 44,
+      "unit_test_options_t", "unit_test_options_repeat...()"
    );
    if (ok)
    {
-      unit_test_t x_test_x;
-      unit_test_status_t x_status_x;
-      char * argv[FULL_ARG_COUNT + 1];
-      int argc = 2;
-      argv[0] = "unit_test_test";
-      argv[1] = "--no-show-progress";
-      ok = unit_test_initialize
-      (
-         &x_test_x, argc, argv, "Test 04.23.1", "version", "additionalhelp"
-      );
+      unit_test_options_t x_options_x;
+      ok = unit_test_options_init(&x_options_x);
       if (ok)
-         ok = unit_test_status_init(&x_status_x);
+         ok = unit_test_options_is_simulated_set(&x_options_x, true);
 
       /*  1 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      if (unit_test_status_next_subtest(&status, "Null 'this', set/get"))
       {
-         int result = unit_test_check_subtests(nullptr, nullptr);
-         ok = result == XPCCUT_INVALID_PARAMETER;
-         unit_test_status_pass(&status, ok);
+         cbool_t null_ok = ! unit_test_options_repeat_count_set(nullptr, 2);
+         if (null_ok)
+         {
+            null_ok = unit_test_options_repeat_count(nullptr) ==
+               XPCCUT_REPEAT_COUNT;
+         }
+         if (null_ok)
+            null_ok = ! unit_test_options_until_fail_set(nullptr, true);
+
+         if (null_ok)
+         {
+            null_ok = unit_test_options_until_fail(nullptr) ==
+               XPCCUT_UNTIL_FAIL;
+         }
+         if (null_ok)
+            null_ok = ! unit_test_options_shuffle_set(nullptr, true);
+
+         if (null_ok)
+            null_ok = unit_test_options_shuffle(nullptr) == XPCCUT_SHUFFLE;
+
+         if (null_ok)
+            null_ok = ! unit_test_options_shuffle_seed_set(nullptr, 5);
+
+         if (null_ok)
+         {
+            null_ok = unit_test_options_shuffle_seed(nullptr) ==
+               XPCCUT_SHUFFLE_SEED;
+         }
+         unit_test_status_pass(&status, null_ok);
       }
 
       /*  2 */
 
-      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      if (unit_test_status_next_subtest(&status, "Default values, get"))
       {
-         int result = unit_test_check_subtests(nullptr, &x_status_x);
-         ok = result == XPCCUT_INVALID_PARAMETER;
+         if (ok)
+            ok = unit_test_options_repeat_count(&x_options_x) == 1;
+
+         if (ok)
+            ok = ! unit_test_options_until_fail(&x_options_x);
+
+         if (ok)
+            ok = ! unit_test_options_shuffle(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_shuffle_seed(&x_options_x) == 0;
+
          unit_test_status_pass(&status, ok);
       }
 
       /*  3 */
 
-      if (unit_test_status_next_subtest(&status, "Null status-pointer"))
+      if (unit_test_status_next_subtest(&status, "Repeat count, set/get"))
       {
-         int result = unit_test_check_subtests(&x_test_x, nullptr);
-         ok = result == XPCCUT_INVALID_PARAMETER;
+         if (ok)
+            ok = unit_test_options_repeat_count_set(&x_options_x, 25);
+
+         if (ok)
+            ok = unit_test_options_repeat_count(&x_options_x) == 25;
+
+         if (ok)
+            ok = ! unit_test_options_repeat_count_set(&x_options_x, 0);
+
+         if (ok)
+            ok = unit_test_options_repeat_count(&x_options_x) == 1;
+
+         if (ok)
+         {
+            ok = ! unit_test_options_repeat_count_set
+            (
+               &x_options_x, XPCCUT_REPEAT_MAX + 1
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_repeat_count_set
+            (
+               &x_options_x, XPCCUT_REPEAT_MAX
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_options_repeat_count(&x_options_x) ==
+               XPCCUT_REPEAT_MAX;
+         }
          unit_test_status_pass(&status, ok);
       }
 
       /*  4 */
 
-      if (unit_test_status_next_subtest(&status, "Null status, need subtest"))
+      if (unit_test_status_next_subtest(&status, "Flags and seed, set/get"))
       {
-         int result = unit_test_check_subtests(&x_test_x, nullptr);
-         argv[0] = "unit_test_test";
-         argv[1] = "--no-show-progress";
-         argv[2] = "--require-sub-tests";
-         argc = 3;
-         ok = unit_test_initialize
-         (
-            &x_test_x, argc, argv, "Test 04.23.1", "version", "additionalhelp"
-         );
          if (ok)
-            ok = result == XPCCUT_INVALID_PARAMETER;  /* checked before init  */
+            ok = unit_test_options_until_fail_set(&x_options_x, true);
 
-         result = unit_test_check_subtests(&x_test_x, nullptr);
          if (ok)
-            ok = result == XPCCUT_INVALID_PARAMETER;  /* checked after init   */
+            ok = unit_test_options_until_fail(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_shuffle_set(&x_options_x, true);
+
+         if (ok)
+            ok = unit_test_options_shuffle(&x_options_x);
 
+         if (ok)
+            ok = unit_test_options_shuffle_set(&x_options_x, false);
+
+         if (ok)
+            ok = unit_test_options_shuffle_seed_set(&x_options_x, 4000000000u);
+
+         if (ok)                                /* the seed implies shuffle */
+            ok = unit_test_options_shuffle(&x_options_x);
+
+         if (ok)
+         {
+            ok = unit_test_options_shuffle_seed(&x_options_x) ==
+               4000000000u;
+         }
          unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now destroy all allocated resources in the test object.
-       */
+      /*  5 */
 
-      unit_test_destroy(&x_test_x);
+      if (unit_test_status_next_subtest(&status, "Parsing the options"))
+      {
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 7;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--repeat";
+         argv[3] = "7";
+         argv[4] = "--no-until-fail";
+         argv[5] = "--shuffle-seed";
+         argv[6] = "31";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.44", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_repeat_count(&x_options_x) == 7;
+
+         if (ok)
+            ok = ! unit_test_options_until_fail(&x_options_x);
+
+         if (ok)
+         {
+            ok = unit_test_options_shuffle(&x_options_x) &&
+               unit_test_options_shuffle_seed(&x_options_x) == 31;
+         }
+         argc = 4;
+         argv[2] = "--no-shuffle";
+         argv[3] = "--until-fail";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.44", "version", "none"
+            );
+         }
+         if (ok)
+            ok = ! unit_test_options_shuffle(&x_options_x);
+
+         if (ok)
+            ok = unit_test_options_until_fail(&x_options_x);
+
+         argc = 3;
+         argv[2] = "--shuffle";
+         if (ok)
+         {
+            ok = unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.44", "version", "none"
+            );
+         }
+         if (ok)
+            ok = unit_test_options_shuffle(&x_options_x);
+
+         argc = 3;
+         argv[2] = "--shuffle-seed";
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = ! unit_test_options_parse
+            (
+               &x_options_x, argc, argv, "Test 03.44", "version", "none"
+            );
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         unit_test_status_pass(&status, ok);
+      }
    }
    return status;
 }
 
 /**
- *    This test demonstrates the simplistic setting up of language support.
+ *    Provides a unit/regression test to verify that the basic "default"
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
+ *
+ *    The function tested is like a "C" version of a "C++" default
+ *    constructor.
  *
  * \group
- *    5. Additional functions.
+ *    4. unit_test_t functions.
  *
  * \case
- *    1. Verbosity settings and text-domain support.
+ *    1. Initialization and setup functions.
  *
  * \test
- *    -  xpccut_text_domain()
+ *    -  unit_test_init()
+ *    -  unit_test_clear() [indirect test of static function]
+ *    -  unit_test_options_init() [indirect test of static function]
+ *    -  unit_test_allocate_help() [indirect test of static function]
+ *    -  unit_test_init_cases() [indirect test of static function]
+ *
+ * \todo
+ *    It would be nice if we could verify the duration of the previous test
+ *    to be correct to within plus-or-minus 10 ms.
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12077,229 +13568,153 @@ unit_unit_test_04_23 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_05_01 (const unit_test_options_t * options)
+unit_unit_test_04_01 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 5, 1, _("xpccut_text_domain()"), _("Smoke Test")
+      &status, options, 4, 1,
+      "unit_test_t", "unit_test_init()"
    );
    if (ok)
    {
+      unit_test_t x_test_x;
+      (void) unit_test_init(&x_test_x);
+
       /*  1 */
 
-      cbool_t original_silence_setting = xpccut_is_silent();
-      if (original_silence_setting)
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         if (unit_test_options_is_verbose(options))
-            xpccut_allow_printing();
+         cbool_t null_ok = ! unit_test_init(nullptr);
+         unit_test_status_pass(&status, null_ok);
       }
-      if (unit_test_status_next_subtest(&status, "1"))
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
       {
-#if ! defined WIN32 && defined USE_GETTEXT
-         ok = xpccut_text_domain();
          unit_test_status_pass(&status, ok);
-#else
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "m_App_Options"))
+      {
+         ok = default_options_check
+         (
+            &x_test_x.m_App_Options,      /* check unit_test_options_init()   */
+            false                         /* no show-progress testing         */
+         );
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Good help setup"))
+      {
          /*
-          * xpccut_errprint_func
-          * (
-          *    _(
-          *       "comment out this test if gettext() for Win32 is not "
-          *       "important to you"
-          *     )
-          * );
+          * This sub-test will check the call to the static function
+          * unit_test_allocate_help().
           */
-#endif
+
+         ok = cut_not_nullptr(x_test_x.m_Additional_Help);
+         if (ok)
+         {
+            ok = strlen(x_test_x.m_Additional_Help) > 0;
+            if (ok && unit_test_options_is_verbose(options))
+            {
+               xpccut_print
+               (
+                  "  %s:\n{\n%s\n}\n",
+                  _("The allocated help text is"),
+                  x_test_x.m_Additional_Help
+               );
+            }
+            else
+               xpccut_errprint(_("unit-test help text is empty"));
+         }
+         else
+            xpccut_errprint(_("unit-test help text not allocated"));
+
          unit_test_status_pass(&status, ok);
       }
 
-      /*
-       * Now restore the original setting of the silence flag, so that
-       * the output of the unit-test will have the appearance expected
-       * by the dude who ran this test.
-       */
+      /*  5 */
 
-      if (original_silence_setting)
-         xpccut_silence_printing();
-      else
-         xpccut_allow_printing();
-   }
-   return status;
-}
+      if (unit_test_status_next_subtest(&status, "Good cases setup"))
+      {
+         /*
+          * This sub-test will check the call to the static function
+          * unit_test_init_cases() and unit_test_allocate_cases.
+          */
 
-/**
- *    This test demonstrates the usage of the unit-test prompt facility.  If
- *    the user answers all the prompts as directed, the test will pass.  This
- *    means that the user cannot abort this test (grin).
- *
- * \group
- *    5. Additional functions.
- *
- * \case
- *    2. Support for interactive prompting in tests.
- *
- * \test
- *    This unit-test function perforce tests more than one unit from the
- *    unit-test library (libxpccut):
- *    -  unit_test_status_initialize()
- *    -  unit_test_status_pass()
- *    -  unit_test_status_fail()
- *    -  unit_test_options_show_values(options) [by user visualization only]
- *    -  unit_test_status_is_verbose() [by user visualization only]
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
-
-/* static */ unit_test_status_t
-unit_unit_test_05_02 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 5, 2, _("XPCCUT Test"), _("Prompts")
-   );
-   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
-      unit_test_status_pass(&status, true);        /* no, force it to pass    */
-   else if (ok)
-   {
-      if (unit_test_status_next_subtest(&status, _("'C' test")))
-      {
-         cbool_t ok = unit_test_status_prompt
-         (
-            &status,
-            _("This sequence of tests runs through the various responses\n"
-            "possible when using the prompting facility of the code-and-\n"
-            "unit test library.  For this first prompt, please simply hit\n"
-            "'p' or 'c', and then the Enter key.")
-         );
          if (ok)
          {
-            unit_test_status_pass
-            (
-               &status,
-               unit_test_status_disposition(&status) ==
-                  XPCCUT_DISPOSITION_CONTINUE
-            );
+            ok = cut_not_nullptr(x_test_x.m_Test_Cases);
+            if (ok)
+               ok = x_test_x.m_Total_Errors == 0;
+
+            if (ok)
+               ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+            if (ok)
+               ok = x_test_x.m_Test_Count == 0;
+
+            if (ok)
+               ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+
+            if (ok && unit_test_options_is_verbose(options))
+            {
+               xpccut_print
+               (
+                  "  %s:\n{\n%s\n}\n",
+                  _("The allocated help text is"),
+                  x_test_x.m_Additional_Help
+               );
+            }
+            else
+               xpccut_errprint(_("unit-test help text is empty"));
          }
          else
-            unit_test_status_pass(&status, true);
-      }
-      if
-      (
-         unit_test_status_next_subtest(&status, _("'S' test"))
-      )
-      {
-         (void) unit_test_status_prompt
-         (
-            &status, _("Press 's' or 'S' followed by the Enter key")
-         );
-
-         /*
-          * From here on we'll use accessor functions for comparision.  In
-          * batch mode (--batch), this function cannot pass, because the
-          * answer returned in batch mode is that given by the 'c' key
-          * (continue testing).  That is, isSkipped() returns false.  So if
-          * we're in batch mode, we'll return true.  The same applies to
-          * interactive mode.  Rather than call two functions, we will just
-          * call the isOkay() function.
-          */
+            xpccut_errprint(_("unit-test help text not allocated"));
 
-         unit_test_status_pass
-         (
-            &status,
-            unit_test_status_is_skipped(&status) ||
-            unit_test_status_is_okay(&status)
-         );
+         unit_test_status_pass(&status, ok);
       }
 
       /*
-       * We used to do checks like this:
-       *
-       *    if (unit_test_status_passed(&status) &&
-       *       unit_test_status_next_subtest(&status, _("'F' test")))
-       *
-       * However, the status-passed call is done in the next-subtest call,
-       * and also keeps track of the stop-on-error option.  So the test
-       * becomes much easier to fit on a single line.
-       */
-
-      /*
-       * There is no 'f' option for prompting, so this test keeps
-       * reprompting over and over until the user realizes (perhaps)
-       * that 'f' is not supported.
-       *
-       *    if (unit_test_status_next_subtest(&status, _("'F' test")))
-       *    {
-       *       (void) unit_test_status_prompt
-       *       (
-       *          &status, _("Press 'f' or 'F' followed by the Enter key")
-       *       );
-       *       (void) unit_test_status_pass
-       *       (
-       *          &status,
-       *          unit_test_status_is_failed(&status) ||
-       *          unit_test_status_is_okay(&status)
-       *       );
-       *    }
-       *
+       * Now destroy all allocated resources in the test object.  Even
+       * little ol' unit_test_init() allocates them.  If the --leak-check
+       * option is in force, we don't call this "destructor".
        */
 
-      if (unit_test_status_next_subtest(&status, _("'Q' test")))
-      {
-         (void) unit_test_status_prompt
-         (
-            &status, _("Press 'q' or 'Q' followed by the Enter key")
-         );
-         (void) unit_test_status_pass
-         (
-            &status,
-            unit_test_status_is_quitted(&status) ||
-            unit_test_status_is_okay(&status)
-         );
-      }
-      if (unit_test_status_next_subtest(&status, _("'A' test")))
-      {
-         (void) unit_test_status_prompt
-         (
-            &status, _("Press 'a' or 'A' followed by the Enter key")
-         );
-         (void) unit_test_status_pass
-         (
-            &status,
-            unit_test_status_is_aborted(&status) ||
-            unit_test_status_is_okay(&status)
-         );
-      }
-      if (! unit_test_status_passed(&status))
-         xpccut_errprint(_("Hey, why did you disobey me?!"));
+      if (! g_do_leak_check)
+         unit_test_destroy(&x_test_x);
    }
-   unit_test_status_reset(&status);    /* prevent premature test termination  */
    return status;
 }
 
 /**
- *    This test demonstrates the usage of the unit-test prompt facility.  If
- *    the user answers all the prompts as directed, the test will pass.  This
- *    means that the user cannot abort this test (grin).
+ *    Provides a unit/regression test to verify that the "principal"
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
+ *
+ *    The function tested is like a "C" version of a "C++" principal
+ *    constructor.
+ *
+ *    This is a "part 1" unit-test case for unit_test_initialize().
  *
  * \group
- *    5. Additional functions.
+ *    4. unit_test_t functions.
  *
  * \case
- *    3. More prompt support -- quitting.
+ *    2. unit_test_initialize(), part 1.
  *
  * \test
- *    This unit-test function perforce tests more than one unit from the
- *    unit-test library (libxpccut):
+ *    -  unit_test_initialize()
  *
- *    -  unit_test_status_initialize()
- *    -  unit_test_status_pass()
- *    -  unit_test_status_fail()
- *    -  unit_test_status_is_verbose() [by user visualization only]
+ * \todo
+ *    It would be nice if we could verify the duration of the previous test
+ *    to be correct to within plus-or-minus 10 ms.
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12308,95 +13723,278 @@ unit_unit_test_05_02 (const unit_test_options_t * options)
  *    Returns the unit-test status object needed by the protocol.
  */
 
-/* static */ unit_test_status_t
-unit_unit_test_05_03 (const unit_test_options_t * options)
+static unit_test_status_t
+unit_unit_test_04_02 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 5, 3, _("XPCCUT Test"), _("Disposal")
+      &status, options, 4, 2,
+      "unit_test_t", "unit_test_initialize() part 1"
    );
-   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
-      unit_test_status_pass(&status, true);        /* no, force it to pass    */
-   else if (ok)
+   if (ok)
    {
-      if (unit_test_status_next_subtest(&status, _("'Q' test")))
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* guarantee initialized   */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.  We have to access the
+       * member field directly.
+       */
+
+      ok = unit_test_options_init(&x_test_x.m_App_Options);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
+
+      if (ok)
       {
-         (void) unit_test_status_prompt
+         /*
+          * Now modify the test structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          */
+
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--no-verbose";
+         argv[2]  = "--no-show-progress";
+         argv[3]  = "--no-show-values";
+         argv[4]  = "--no-show-step-numbers";
+         argv[5]  = "--no-text-synch";
+         argv[6]  = "--no-stop-on-error";
+         argv[7]  = "--no-batch-mode";
+         argv[8]  = "--no-interactive";
+         argv[9]  = "--no-beeps";
+         argv[10] = "--no-case-pause";
+         argv[11] = "--no-summarize";
+         argv[12] = "--group";
+         argv[13] = "1";
+         argv[14] = "--case";
+         argv[15] = "2";
+         argv[16] = "--sub-test";
+         argv[17] = "3";
+         argv[18] = "--sleep-time";
+         argv[19] = "4";
+         argv[20] = "--no-verbose";
+         argv[21] = "--no-verbose";
+         argc = 22;
+         ok = unit_test_initialize
          (
-            &status,
-            _("Press 'q' or 'a' to halt with success or failure, at your option")
+            &x_test_x, argc, argv,
+            "Test 04.02", "version", "additionalhelp"
          );
       }
-   }
-   return status;
-}
 
-/**
- *    This test demonstrates the usage of the unit-test prompt facility.  If
- *    the user answers all the prompts as directed, the test will pass.  This
- *    means that the user cannot abort this test (grin).
- *
- * \group
- *    5. Additional functions.
- *
- * \case
- *    4. More prompt support -- continuing.
- *
- * \test
- *    This unit-test function perforce tests more than one unit from the
- *    unit-test library (libxpccut):
- *
- *    -  unit_test_status_initialize()
- *    -  unit_test_status_pass()
- *    -  unit_test_status_fail()
- *    -  unit_test_status_is_verbose() [by user visualization only]
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+      /*  1 */
 
-/* static */ unit_test_status_t
-unit_unit_test_05_04 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 5, 4, _("XPCCUT Test"), _("Continuation")
-   );
-   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
-      unit_test_status_pass(&status, true);        /* no, force it to pass    */
-   else if (ok)
-   {
-      unit_test_status_pass(&status, true);
-      if (unit_test_options_is_verbose(options))
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
       {
-         fprintf
+         cbool_t null_ok = ! unit_test_initialize
          (
-            stdout, "  %s\n",
-            _("You will see this message only if you didn't answer 'q' before")
+            nullptr, argc, argv, "x", "y", "z"
          );
+         unit_test_status_pass(&status, null_ok);
       }
-      if (unit_test_status_next_subtest(&status, _("Continuation test")))
-         (void) unit_test_status_prompt(&status, _("Answer as you wish"));
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Is_Verbose;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Values"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Show_Values;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Text_Synch"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Text_Synch;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Step_Numbers"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Show_Step_Numbers;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Progress"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Show_Progress;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Stop_On_Error"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Stop_On_Error;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  9 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Batch_Mode"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Batch_Mode;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 10 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Interactive"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Interactive;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 11 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Beep_Prompt"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Beep_Prompt;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 12 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Summarize"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Summarize;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 13 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Case_Pause"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Case_Pause;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 14 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Group"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Test_Group ==
+            (XPCCUT_NO_SINGLE_GROUP+1);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 15 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Case"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Test_Case ==
+            (XPCCUT_NO_SINGLE_CASE+2);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 16 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Sub_Test"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Sub_Test ==
+            (XPCCUT_NO_SINGLE_SUB_TEST+3);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 17 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Test_Sleep_Time"))
+      {
+         ok = x_test_x.m_App_Options.m_Test_Sleep_Time ==
+            (XPCCUT_TEST_SLEEP_TIME+4);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 18 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
+      {
+         /* "Test 04.02", "version", "additionalhelp" */
+
+         ok = strcmp(x_test_x.m_Test_Application_Name, "Test 04.02") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 19 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
+      {
+         ok = strcmp(x_test_x.m_Test_Application_Version, "version") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 20 */
+
+      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
+      {
+         ok = strcmp(x_test_x.m_Additional_Help, "additionalhelp") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /**
+       * Testing of null and blank app-names, version strings, and help
+       * strings is done in the next two unit-test cases.
+       */
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
    }
    return status;
 }
 
 /**
- *    Recapitulates unit_unit_test_01_01().
+ *    Provides a unit/regression test to verify that the basic
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
  *
- *    Why?  To make it easy to check up on some aspects of the --summarize
- *    option.
+ *    The function tested is like a "C" version of a "C++" principal
+ *    constructor.
+ *
+ *    This is a "part 2" unit-test case for unit_test_initialize().
  *
  * \group
- *    6. Test recapitulation.
+ *    4. unit_test_t functions.
  *
  * \case
- *    1. 01.01 smoke-test recapitulation.
+ *    3. unit_test_initialize(), part 2.
+ *
+ * \test
+ *    -  unit_test_initialize()
+ *
+ * \todo
+ *    It would be nice if we could verify the duration of the previous test
+ *    to be correct to within plus-or-minus 10 ms.
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12406,247 +14004,10414 @@ unit_unit_test_05_04 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_06_01 (const unit_test_options_t * options)
+unit_unit_test_04_03 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 6, 1, "XPCCUT", _("01.01 Smoke Test Recap")
+      &status, options, 4, 3,
+      "unit_test_t", "unit_test_initialize() part 2"
    );
    if (ok)
    {
-      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
-      {
-         unit_test_status_pass(&status, true);     /* no, force it to pass    */
-      }
-      else
-      {
-         if (unit_test_options_show_values(options))
-            fprintf(stdout, "  %s\n", _("No values to show in this test"));
-
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* guarantee initialized   */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.  We have to access the
+       * member field directly.
+       */
+
+      ok = unit_test_options_init(&x_test_x.m_App_Options);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
+
+      if (ok)
+      {
+         /*
+          * Now modify the test structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          *
+          * Also note that some options turn off the global output option or
+          * alter other options.  We disable them by tacking on "---ignore".
+          *
+          * The --summarize option does this, and the output looks weird.
+          */
+
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--verbose";
+         argv[2]  = "--show-progress";
+         argv[3]  = "--show-values";
+         argv[4]  = "--show-step-numbers";
+         argv[5]  = "--text-synch";
+         argv[6]  = "--stop-on-error";
+         argv[7]  = "--batch-mode---ignore";
+         argv[8]  = "--interactive---ignore";
+         argv[9]  = "--beeps";
+         argv[10] = "--case-pause";
+         argv[11] = "--summarize---ignore";
+         argv[12] = "--group";
+         argv[13] = "1";
+         argv[14] = "--case";
+         argv[15] = "2";
+         argv[16] = "--sub-test";
+         argv[17] = "3";
+         argv[18] = "--sleep-time";
+         argv[19] = "4";
+         argc = 20;
+
+         /*
+          * This function call will fail due to the empty help text, but we
+          * can learn more by continuing nonetheless.
+          *
+          * ca 06/23/2008
+          * Actually, it will not fail now, since empties produce good
+          * defaults for the caller now.  Hence, the not (!) operator is
+          * gone.
+          */
+
+         ok = unit_test_initialize(&x_test_x, argc, argv, "", "", "");
+      }
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = ! unit_test_initialize
+         (
+            nullptr, argc, argv, "x", "y", "z"
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
+      {
+         ok = x_test_x.m_App_Options.m_Is_Verbose;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Values"))
+      {
+         ok = x_test_x.m_App_Options.m_Show_Values;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Text_Synch"))
+      {
+         ok = x_test_x.m_App_Options.m_Text_Synch;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Step_Numbers"))
+      {
+         ok = x_test_x.m_App_Options.m_Show_Step_Numbers;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Show_Progress"))
+      {
+         ok = x_test_x.m_App_Options.m_Show_Progress;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Stop_On_Error"))
+      {
+         ok = x_test_x.m_App_Options.m_Stop_On_Error;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  9 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Batch_Mode"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Batch_Mode;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 10 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Interactive"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Interactive;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 11 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Beep_Prompt"))
+      {
+         ok = x_test_x.m_App_Options.m_Beep_Prompt;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 12 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Summarize"))
+      {
+         ok = ! x_test_x.m_App_Options.m_Summarize;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 13 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Case_Pause"))
+      {
+         ok = x_test_x.m_App_Options.m_Case_Pause;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 14 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Group"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Test_Group ==
+            (XPCCUT_NO_SINGLE_GROUP+1);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 15 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Test_Case"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Test_Case ==
+            (XPCCUT_NO_SINGLE_CASE+2);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 16 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Single_Sub_Test"))
+      {
+         ok = x_test_x.m_App_Options.m_Single_Sub_Test ==
+            (XPCCUT_NO_SINGLE_SUB_TEST+3);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 17 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Test_Sleep_Time"))
+      {
+         ok = x_test_x.m_App_Options.m_Test_Sleep_Time ==
+            (XPCCUT_TEST_SLEEP_TIME+4);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 18 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
+      {
+         /* "", "", "" */
+
+         ok = strcmp(x_test_x.m_Test_Application_Name, "") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 19 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
+      {
+         ok = strcmp(x_test_x.m_Test_Application_Version, "") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 20 */
+
+      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
+      {
+         /*
+          * The text here is assigned internally from a static character
+          * string in the static function unit_test_allocate_help().
+          * However, we cannot then free this pointer in the call to
+          * unit_test_destroy() below.  So all we can do here is check for
+          * the null pointer.
+          *
+          * ok = strcmp
+          * (
+          *    x_test_x.m_Additional_Help, _("? unit_test_allocate_help() null")
+          * ) == 0;
+          *
+          * ca 06/23/2008
+          * Actually, it will not be null now, since empties produce good
+          * defaults for the caller.
+          * gone.
+          *
+          *    ok = cut_is_nullptr(x_test_x.m_Additional_Help);
+          */
+
+         ok = ! cut_is_nullptr(x_test_x.m_Additional_Help);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the basic
+ *    initialization function properly zeros or clears all fields to their
+ *    "default" values.
+ *
+ *    The function tested is like a "C" version of a "C++" principal
+ *    constructor.
+ *
+ *    This is a "part 3" unit-test case for unit_test_initialize().
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    4. unit_test_initialize(), part 3.
+ *
+ * \test
+ *    -  unit_test_initialize()
+ *
+ * \todo
+ *    It would be nice if we could verify the duration of the previous test
+ *    to be correct to within plus-or-minus 10 ms.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_04 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 4,
+      "unit_test_t", "unit_test_initialize() part 3"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 1;                                /* guarantee initialized   */
+      argv[0] = "<unknown>";                       /* guarantee some value    */
+
+      /*
+       * Start out with default values so that we can take the opposite tack
+       * with the full initialization function.  We have to access the
+       * member field directly.
+       */
+
+      ok = unit_test_options_init(&x_test_x.m_App_Options);
+      if (ok)
+         ok = unit_test_options_is_simulated_set(&x_test_x.m_App_Options, true);
+
+      if (ok)
+      {
+         /*
+          * Now modify the test structure with the opposite values (or at
+          * least different values) for every accessible field, so that the
+          * resulting test is a bizarro-clone of test 03_01.
+          *
+          * Also note that some options turn off the global output option or
+          * alter other options.  We disable them by tacking on "---ignore".
+          *
+          * The --summarize option does this, and the output looks weird.
+          */
+
+         argv[0]  = "unit_test_test";
+         argv[1]  = "--verbose";
+         argc = 2;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, nullptr, nullptr, nullptr
+         );
+      }
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = ! unit_test_initialize
+         (
+            nullptr, argc, argv, "x", "y", "z"
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "internal m_Is_Verbose"))
+      {
+         ok = x_test_x.m_App_Options.m_Is_Verbose;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Name"))
+      {
+         /* nullptr, nullptr, nullptr */
+
+         ok = strcmp(x_test_x.m_Test_Application_Name, _("Unit Test")) == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "m_Test_Application_Version"))
+      {
+         ok = strcmp(x_test_x.m_Test_Application_Version, "1.1") == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "m_Additional_Help"))
+      {
+         ok = strcmp(x_test_x.m_Additional_Help, _("No help")) == 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "test-loading"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    5. Initialization and setup functions.
+ *
+ * \test
+ *    -  unit_test_load()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_05 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 5, "unit_test_t", "unit_test_load()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = ! unit_test_load(nullptr, unit_unit_test_01_01);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
+      {
+         cbool_t null_ok = ! unit_test_load(&x_test_x, nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Good 'this'"))
+      {
+         if (ok)
+            ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+         if (ok)
+            ok = x_test_x.m_Test_Count == 1;
+
+         if (ok)
+            ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Second test"))
+      {
+         if (ok)
+            ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+         if (ok)
+            ok = x_test_x.m_Test_Count == 2;
+
+         if (ok)
+            ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Until next allocation"))
+      {
+         if (ok)
+         {
+            int ti;
+            for (ti = x_test_x.m_Test_Count; ti < XPCCUT_CASE_ALLOCATION; ti++)
+            {
+               if (ok)
+                  ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+               if (ok)
+                  ok = x_test_x.m_Test_Count == (ti + 1);
+
+               if (ok)
+                  ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+
+               if (! ok)
+               {
+                  if (! xpccut_is_silent())
+                  {
+                     xpccut_print
+                     (
+                        "%s %d %s %d\n",
+                        _("load failed at count"), x_test_x.m_Test_Count,
+                        _("and allocation"), x_test_x.m_Allocation_Count
+                     );
+                  }
+                  break;
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "After next allocation"))
+      {
+         if (ok)
+         {
+            int ti;
+            for (ti = x_test_x.m_Test_Count; ti < 2*XPCCUT_CASE_ALLOCATION; ti++)
+            {
+               if (ok)
+                  ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+               if (ok)
+                  ok = x_test_x.m_Test_Count == (ti + 1);
+
+               if (ok)
+                  ok = x_test_x.m_Allocation_Count == 2*XPCCUT_CASE_ALLOCATION;
+
+               if (! ok)
+               {
+                  if (! xpccut_is_silent())
+                  {
+                     xpccut_print
+                     (
+                        "%s %d %s %d\n",
+                        _("load failed at count"), x_test_x.m_Test_Count,
+                        _("and allocation"), x_test_x.m_Allocation_Count
+                     );
+                  }
+                  break;
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the
+ *    "test-load-counting" functionality is working, and also can be used by
+ *    C++ code.
+ *
+ *    This functionality is /not/ tested in test 04.05 above, because the
+ *    unit_test_load() function does its own counting.  The
+ *    unit_test_cpp_load_count() is mean for usage in a C++ unit-test
+ *    wrapper.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    6. unit_test_cpp_load_count()
+ *
+ * \test
+ *    -  unit_test_cpp_load_count()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_06 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 6, "unit_test_t", "unit_test_cpp_load_count()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = ! unit_test_cpp_load_count(nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         if (ok)
+            ok = x_test_x.m_Test_Count == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         if (ok)
+            ok = unit_test_cpp_load_count(&x_test_x);
+
+         if (ok)
+            ok = x_test_x.m_Test_Count == 1;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      {
+         if (ok)
+         {
+            int ti;
+            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
+            {
+               if (ok)
+                  ok = unit_test_cpp_load_count(&x_test_x);
+               else
+               {
+                  if (! xpccut_is_silent())
+                  {
+                     xpccut_print
+                     (
+                        "%s %d\n",
+                        _("load failed at count"), x_test_x.m_Test_Count
+                     );
+                  }
+                  break;
+               }
+            }
+            if (ok)
+               ok = x_test_x.m_Test_Count == 1000;
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify the "test-dispose"
+ *    functionality.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    7. unit_test_dispose()
+ *
+ * \test
+ *    -  unit_test_dispose()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_07 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 7, "unit_test_t", "unit_test_dispose()"
+   );
+   if (ok)
+   {
+      unit_test_status_t x_status_x;
+      ok = unit_test_status_init(&x_status_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_dispose(nullptr);
+         if (ok)
+            ok = x_status_x.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+
+         unit_test_status_pass(&status, ok && null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "init verifaction"))
+      {
+         if (ok)
+            ok = x_status_x.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "CONTINUE"))
+      {
+         cbool_t quit;
+         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_CONTINUE;
+         quit = unit_test_dispose(&x_status_x);
+         ok = ! quit && unit_test_status_passed(&x_status_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "DNT"))
+      {
+         cbool_t quit;
+         x_status_x.m_Test_Result = true;
+         x_status_x.m_Subtest_Error_Count = 0;
+         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_DNT;
+         quit = unit_test_dispose(&x_status_x);
+         ok = ! quit && unit_test_status_passed(&x_status_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "FAILED"))
+      {
+         cbool_t quit;
+         x_status_x.m_Test_Result = true;
+         x_status_x.m_Subtest_Error_Count = 0;
+         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_FAILED;
+         quit = unit_test_dispose(&x_status_x);
+         show_deliberate_failure(options);
+         ok = ! quit && ! unit_test_status_passed(&x_status_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "QUITTED"))
+      {
+         cbool_t quit;
+         x_status_x.m_Test_Result = true;
+         x_status_x.m_Subtest_Error_Count = 0;
+         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_QUITTED;
+         quit = unit_test_dispose(&x_status_x);
+         ok = quit && unit_test_status_passed(&x_status_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "ABORTED"))
+      {
+         cbool_t quit;
+         x_status_x.m_Test_Result = true;
+         x_status_x.m_Subtest_Error_Count = 0;
+         x_status_x.m_Test_Disposition = XPCCUT_DISPOSITION_ABORTED;
+         quit = unit_test_dispose(&x_status_x);
+         show_deliberate_failure(options);
+         ok = quit && ! unit_test_status_passed(&x_status_x);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "test-load-count"
+ *    function works.
+ *
+ *    This test uses the same method as 04_06, but gets the count
+ *    through the unit_test_count() accessor instead of directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    8. unit_test_cpp_load_count()
+ *
+ * \test
+ *    -  unit_test_cpp_load_count()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_08 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 8, "unit_test_t", "unit_test_count()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_count(nullptr) == 0;
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         if (ok)
+            ok = unit_test_count(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         if (ok)
+            ok = unit_test_cpp_load_count(&x_test_x);
+
+         if (ok)
+            ok = unit_test_count(&x_test_x) == 1;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      {
+         if (ok)
+         {
+            int ti;
+            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
+            {
+               if (ok)
+                  ok = unit_test_cpp_load_count(&x_test_x);
+               else
+               {
+                  if (! xpccut_is_silent())
+                  {
+                     xpccut_print
+                     (
+                        "%s %d\n",
+                        _("load failed at count"), unit_test_count(&x_test_x)
+                     );
+                  }
+                  break;
+               }
+            }
+            if (ok)
+               ok = unit_test_count(&x_test_x) == 1000;
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "test-number"
+ *    functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_Current_Test_Number field is manipulated directly.
+ *
+ *    For more extensive testing, see the unit-test for the
+ *    unit_test_next_test() function:  unit_unit_test_04_10().
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *    9. unit_test_number()
+ *
+ * \test
+ *    -  unit_test_number()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_09 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 9, "unit_test_t", "unit_test_number()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_number(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_number(&x_test_x) == XPCCUT_NO_CURRENT_TEST;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_Current_Test_Number = 0;
+         if (ok)
+            ok = unit_test_number(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_Current_Test_Number = 1;
+         if (ok)
+            ok = unit_test_number(&x_test_x) == 1;
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "1000 verifaction"))
+      {
+         if (ok)
+         {
+            int ti;
+            for (ti = x_test_x.m_Test_Count; ti < 1000; ti++)
+            {
+               if (ok)
+                  ok = unit_test_number(&x_test_x);
+               else
+               {
+                  if (! xpccut_is_silent())
+                  {
+                     xpccut_print
+                     (
+                        "%s %d\n",
+                        _("load failed at count"), x_test_x.m_Test_Count
+                     );
+                  }
+                  break;
+               }
+            }
+            if (ok)
+               ok = x_test_x.m_Test_Count == 1000;
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "next test-number"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   10. Next test-number functionality.
+ *
+ * \test
+ *    -  unit_test_next_test()
+ *    -  unit_test_number() [an additional test]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_10 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 10, "unit_test_t", "unit_test_next_test()"
+   );
+   if (ok)
+   {
+      /*
+       * Observe how we have to sneak in and turn off the show-progress
+       * option of the x_test_x object, otherwise the default value of this
+       * option will yield a lot of unhelpful output.
+       */
+
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+      if (ok)
+      {
+         ok = unit_test_options_show_progress_set
+         (
+            &x_test_x.m_App_Options, false
+         );
+      }
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_next_test(nullptr) ==
+            XPCCUT_NO_CURRENT_TEST;
+
+         /*
+          * Now verify that the m_Current_Test_Number field is not modified
+          * in this situation.  How could it be?!
+          */
+
+         if (null_ok)
+            null_ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.  Already done in another test, but
+          * if it gets broken, it is convenient to see it here, too, and we
+          * don't want to keep testing stuff that is already broken based on
+          * a bad result here.
+          */
+
+         if (ok)
+            ok = unit_test_number(&x_test_x) == XPCCUT_NO_CURRENT_TEST;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "No tests loaded yet"))
+      {
+         /*
+          * At this point, no unit-test functions have been loaded into the
+          * x_test_x object, so it has an m_Test_Count field of 0.  So the
+          * unit_test_next_test() function should always fail.  However,
+          * internally the m_Current_Test_Number field is always
+          * incremented, so we do some white-box testing of it.  (This may
+          * cause us pain later!)
+          */
+
+         if (ok)
+         {
+            int test = unit_test_next_test(&x_test_x);
+            ok = test == XPCCUT_NO_CURRENT_TEST;
+            if (ok)
+               ok = x_test_x.m_Current_Test_Number == 0;
+         }
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Still no tests loaded"))
+      {
+         if (ok)
+         {
+            int test = unit_test_next_test(&x_test_x);
+            ok = test == XPCCUT_NO_CURRENT_TEST;
+            if (ok)
+               ok = x_test_x.m_Current_Test_Number == 1;
+         }
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Load 3 tests"))
+      {
+         if (ok)
+         {
+            ok = unit_test_init(&x_test_x);                 /* start again */
+            if (ok)
+            {
+               ok = unit_test_options_show_progress_set
+               (
+                  &x_test_x.m_App_Options, false
+               );
+            }
+            if (ok)
+               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+            if (ok)
+               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+            if (ok)
+               ok = unit_test_load(&x_test_x, unit_unit_test_01_01);
+
+            if (ok)
+            {
+               int test = unit_test_next_test(&x_test_x);
+               ok = test == 0;
+            }
+            if (ok)
+            {
+               int test = unit_test_next_test(&x_test_x);
+               ok = test == 1;
+            }
+            if (ok)
+            {
+               int test = unit_test_next_test(&x_test_x);
+               ok = test == 2;
+            }
+            if (ok)
+            {
+               /*
+                * Here, will will exceed the three loaded tests.
+                */
+
+               int test = unit_test_next_test(&x_test_x);
+               ok = test == XPCCUT_NO_CURRENT_TEST;
+            }
+         }
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "1000 fake tests loop"))
+      {
+         if (ok)
+         {
+            int ti;
+            int test;
+            ok = unit_test_init(&x_test_x);                 /* start again */
+            if (ok)
+            {
+               ok = unit_test_options_show_progress_set
+               (
+                  &x_test_x.m_App_Options, false
+               );
+            }
+            if (ok)
+            {
+               x_test_x.m_Test_Count = 1000;                /* 1000 fakes  */
+               for (ti = 0; ti < 1000; ti++)
+               {
+                  test = unit_test_next_test(&x_test_x);
+                  ok = test == ti;
+                  if (! ok)
+                  {
+                     if (! xpccut_is_silent())
+                     {
+                        xpccut_print
+                        (
+                           "%s %d\n", _("test failed at count"), ti
+                        );
+                     }
+                     break;
+                  }
+               }
+            }
+         }
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "1000 fake while loop"))
+      {
+         if (ok)
+         {
+            int ti = 0;
+            int test;
+            ok = unit_test_init(&x_test_x);                 /* start again */
+            if (ok)
+            {
+               ok = unit_test_options_show_progress_set
+               (
+                  &x_test_x.m_App_Options, false
+               );
+            }
+            if (ok)
+            {
+               x_test_x.m_Test_Count = 1000;                /* 1000 fakes  */
+               while ((test = unit_test_next_test(&x_test_x)) <= 0)
+               {
+                  ti++;
+               }
+               ok = ti == 1000;
+               if (! ok)
+               {
+                  if (! xpccut_is_silent())
+                     xpccut_print("  %s == %d\n", _("time counter"), ti);
+               }
+            }
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "sub-test count"
+ *    functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_Subtest_Count field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   11. unit_test_subtest_count()
+ *
+ * \test
+ *    -  unit_test_subtest_count()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_11 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 11, "unit_test_t", "unit_test_subtest_count()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_subtest_count(nullptr) == 0;
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_Subtest_Count = 0;
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_Subtest_Count = 1;
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "failures count"
+ *    functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_Total_Errors field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   12. unit_test_failures()
+ *
+ * \test
+ *    -  unit_test_failures()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_12 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 12, "unit_test_t", "unit_test_failures()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_failures(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_Total_Errors = 0;
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_Total_Errors = 1;
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "first-failed-test"
+ *    functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_First_Failed_Test field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   13. unit_test_first_failed_test()
+ *
+ * \test
+ *    -  unit_test_first_failed_test()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_13 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 13, "unit_test_t", "unit_test_first_failed_test()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_first_failed_test(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_First_Failed_Test = 0;
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_First_Failed_Test = 1;
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the
+ *    "first-failed-group" functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_First_Failed_Group field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   14. unit_test_first_failed_group()
+ *
+ * \test
+ *    -  unit_test_first_failed_group()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_14 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 14, "unit_test_t", "unit_test_first_failed_group()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_first_failed_group(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_first_failed_group(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_First_Failed_Group = 0;
+         if (ok)
+            ok = unit_test_first_failed_group(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_First_Failed_Group = 1;
+         if (ok)
+            ok = unit_test_first_failed_group(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "first-failed-case"
+ *    functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_First_Failed_Case field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   15. unit_test_first_failed_case()
+ *
+ * \test
+ *    -  unit_test_first_failed_case()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_15 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 15, "unit_test_t", "unit_test_first_failed_case()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_first_failed_case(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_first_failed_case(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_First_Failed_Case = 0;
+         if (ok)
+            ok = unit_test_first_failed_case(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_First_Failed_Case = 1;
+         if (ok)
+            ok = unit_test_first_failed_case(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the
+ *    "first-failed-sub-test" functionality works.
+ *
+ *    This test is very rudimentary, and simply tests this function as a
+ *    field accessor for unit_test_t, and little more.  The
+ *    m_First_Failed_Subtest field is manipulated directly.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   16. unit_test_first_failed_subtest()
+ *
+ * \test
+ *    -  unit_test_first_failed_subtest()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_16 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 16,
+      "unit_test_t", "unit_test_first_failed_subtest()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_first_failed_subtest(nullptr) ==
+            XPCCUT_INVALID_PARAMETER;
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * This sub-test provides additional verification that the field is
+          * properly initialized to -1.
+          */
+
+         if (ok)
+            ok = unit_test_first_failed_subtest(&x_test_x) == 0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Zero verifaction"))
+      {
+         x_test_x.m_First_Failed_Subtest = 0;
+         if (ok)
+            ok = unit_test_first_failed_subtest(&x_test_x) == 0;
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "One verifaction"))
+      {
+         x_test_x.m_First_Failed_Subtest = 1;
+         if (ok)
+            ok = unit_test_first_failed_subtest(&x_test_x) == 1;
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run-init"
+ *    functionality works.
+ *
+ *    This test is important, as the unit_test_run_init() function is needed
+ *    in any C++ unit-test wrapper library that one writes.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   17. unit_test_run_init()
+ *
+ * \test
+ *    -  unit_test_run_init()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_17 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 17, "unit_test_t", "unit_test_run_init()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*
+       * Reduce the amount of output.
+       */
+
+      ok = unit_test_options_show_progress_set(&x_test_x.m_App_Options, false);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = unit_test_run_init(nullptr) == 0;
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         if (ok)
+         {
+            ok = x_test_x.m_Start_Time_us.tv_sec == 0;
+            if (ok)
+               ok = x_test_x.m_Start_Time_us.tv_sec == 0;
+         }
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         x_test_x.m_Test_Count = 10;
+         if (ok)
+            ok = unit_test_run_init(&x_test_x) == 10;
+
+         if (ok)
+            ok = x_test_x.m_Current_Test_Number  == XPCCUT_NO_CURRENT_TEST;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Test    ==  0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Group   ==  0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Case    ==  0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Subtest ==  0;
+
+         if (ok)
+            ok = x_test_x.m_Total_Errors         ==  0;
+
+         /*
+          * How to test?:  the value of the m_Start_Time_us field.
+          */
+
+         if (ok)
+         {
+            ok = x_test_x.m_Start_Time_us.tv_sec > 0;
+            if (ok)
+               ok = x_test_x.m_Start_Time_us.tv_sec >= 0;
+         }
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "dispose-of-test"
+ *    functionality works.
+ *
+ *    This test could potentially be quite complex.  I may get tired before
+ *    finishing it!
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   18. unit_test_dispose_of_test()
+ *
+ * \test
+ *    -  unit_test_dispose_of_test()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_18 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 18, "unit_test_t", "unit_test_dispose_of_test()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      unit_test_options_t x_options_x;
+      unit_test_status_t x_status_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 4;
+
+      /*
+       * Now modify the test structure with the opposite values (or at
+       * least different values) for every accessible field, so that the
+       * resulting test is a bizarro-clone of test 03_01.
+       *
+       *    ok = unit_test_init(&x_test_x);
+       */
+
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--sleep-time";
+      argv[3] = "10";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.18.1", "version", "additionalhelp"
+      );
+      if (ok)
+      {
+         x_options_x = x_test_x.m_App_Options;     /* copy fake test options  */
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 91, 1, _("Test 04.18"), _("Disposal")
+         );
+      }
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         /**
+          * Recall that unit_test_dispose_of_test() returns 'true' only if
+          * the caller should cause the unit-test application to quit.
+          */
+
+         cbool_t null_ok = ! unit_test_dispose_of_test(nullptr, nullptr, nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Partial init verification"))
+      {
+         if (ok)
+         {
+            ok = x_test_x.m_Start_Time_us.tv_sec == 0;
+            if (ok)
+               ok = x_test_x.m_Start_Time_us.tv_sec == 0;
+
+            if (ok)
+               ok = unit_test_options_test_sleep_time(&x_test_x.m_App_Options)
+                     == 10;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Initialization verifaction"))
+      {
+         /*
+          * In this sub-test, since we're passing in a null status pointer,
+          * there's no way to fail the test [which can only be done inside
+          * the unit_dispose_of_test() function via a call to
+          * unit_test_dispose(), which requires a good status pointer.]
+          *
+          * Therefore, no failure values can occur in this sub-test.
+          */
+
+         x_test_x.m_Test_Count = 10;
+         if (ok)
+            ok = ! unit_test_dispose_of_test(&x_test_x, nullptr, nullptr);
+
+         if (ok)
+            ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+         if (ok)
+            ok = x_test_x.m_Total_Errors == 0;              /* and not 1      */
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Test == 0;         /* and not -1     */
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Group == 0;        /* and not -1     */
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Case == 0;         /* and not -1     */
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Subtest == 0;      /* and not -1     */
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Reinitialize"))
+      {
+         if (ok)
+         {
+            argv[0] = "unit_test_test";
+            argv[1] = "--no-show-progress";
+            argc = 2;
+            ok = unit_test_initialize
+            (
+               &x_test_x, argc, argv, "Test 04.18", "version", "additionalhelp"
+            );
+         }
+         if (ok)
+            ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+         if (ok)
+            ok = x_test_x.m_Total_Errors == 0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Test == 0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Group == 0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Case == 0;
+
+         if (ok)
+            ok = x_test_x.m_First_Failed_Subtest == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error test, passed"))
+      {
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--stop-on-error";
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            x_options_x = x_test_x.m_App_Options;        /* fake options      */
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 92, 2,
+               _("Test 04.18"), _("Disposal")
+            );
+            if (ok)
+            {
+               cbool_t runresult;
+               ok = ! unit_test_dispose_of_test          /* false == no quit  */
+               (
+                  &x_test_x, &x_status_x, &runresult
+               );
+               if (ok)
+                  ok = runresult;                        /* made it pass      */
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error test, no quit"))
+      {
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--stop-on-error";
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            x_options_x = x_test_x.m_App_Options;     /* fake test options    */
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 92, 2,
+               _("Test 04.18"), _("Disposal")
+            );
+            if (ok)
+               ok = unit_test_status_fail(&x_status_x);
+
+            if (ok)
+            {
+               cbool_t runresult;
+               ok = unit_test_dispose_of_test               /* true == quit   */
+               (
+                  &x_test_x, &x_status_x, &runresult
+               );
+               if (ok)
+                  ok = ! runresult;                         /* made it fail   */
+            }
+
+            /*
+             * Since we're setting up an artificial situation where we
+             * haven't called certain setup functions, a few of the
+             * results are weird, but accepted.
+             */
+
+            if (ok)
+               ok = x_test_x.m_Current_Test_Number == XPCCUT_NO_CURRENT_TEST;
+
+            if (ok)
+               ok = x_test_x.m_Total_Errors == 1;
+
+            if (ok)
+               ok = x_test_x.m_First_Failed_Test == XPCCUT_NO_CURRENT_TEST;
+
+            if (ok)
+               ok = x_test_x.m_First_Failed_Group == 92;
+
+            if (ok)
+               ok = x_test_x.m_First_Failed_Case == 2;
+
+            if (ok)
+               ok = x_test_x.m_First_Failed_Subtest == 0;   /* weird but true */
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in unit_unit_test_04_19().
+ *
+ *    This function does not call unit_test_status_next_subtest().
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_unit_test_04_19 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 19,
+      _("Unit-test fake run"), "unit_test_run()"
+   );
+   if (ok)
+      unit_test_status_pass(&status, true);                    /* fake a pass */
+
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in unit_unit_test_04_19() to test the
+ *    --force-failure option.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_unit_test_04_19_force_fail (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 19, _("Unit-test force-fail run"), "unit_test_run()"
+   );
+   if (ok)
+   {
+      cbool_t result = ! unit_test_options_force_failure(options);
+      unit_test_status_pass(&status, result);                  /* fake a fail */
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test to use in unit_unit_test_04_19().
+ *
+ *    This function does call unit_test_status_next_subtest().
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_subtest_unit_test_04_19 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 19, _("Unit-test fake run"), "unit_test_run()"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Do-nothing test 1"))
+         unit_test_status_pass(&status, true);
+   }
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Do-nothing test 2"))
+         unit_test_status_pass(&status, true);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run"
+ *    functionality works.
+ *
+ *    This test could be complex.  Since this function obviously already
+ *    passes the smoke test (we know this because the unit-test application
+ *    succeeds, and we've seen it succeed under the debugger), here we
+ *    mainly test for the obvious error conditions that can occur in
+ *    unit_test_run().
+ *
+ * Group 4:
+ *
+ *    unit_test_t functions.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   19. Running and sub-test functionality.
+ *
+ * \test
+ *    -  unit_test_run()
+ *    -  unit_test_initialize()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_19 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 19, "unit_test_t", "unit_test_run()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 2;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.19.1", "version", "additionalhelp"
+      );
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this'"))
+      {
+         cbool_t null_ok = ! unit_test_run(nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Empty test list"))
+      {
+         /*
+          * This test insures (indirectly) that unit_test_run() calls
+          * unit_test_run_init() to set up the test.
+          */
+
+         if (ok)
+            ok = ! unit_test_run(&x_test_x);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "No sub-test test part 1"))
+      {
+         /*
+          * This test checks that the caller used the
+          * unit_test_status_next_subtest() function.  Right now, this is a
+          * bit of a weird test.  If the caller specified
+          * --require-sub-tests on the command-line of this unit-test
+          *  application, then we call the fake test function that does
+          *  provide a unit test, and vice versa.
+          */
+
+         if (unit_test_options_force_failure(options))
+         {
+            if (ok)
+               ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+         }
+         else
+         {
+            if (ok)
+               ok = unit_test_load(&x_test_x, fake_unit_test_04_19);
+         }
+
+         if (ok)
+            ok = unit_test_run(&x_test_x);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "No sub-test test part 2"))
+      {
+         /*
+          * Tests that not having sub-test properly fails if they are
+          * required.  It temporarily modifies this option to force it on.
+          * This loaded test should cause unit_test_run() to fail.
+          */
+
+         cbool_t force_failure = unit_test_options_force_failure
+         (
+            &x_test_x.m_App_Options
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_unit_test_04_19);
+
+         (void) unit_test_options_force_failure_set
+         (
+            &x_test_x.m_App_Options, true                /* force option on   */
+         );
+
+         /*
+          * Even though --force-failure is now set, the fake unit-test
+          * function that is loaded does not support it.  Therefore, the
+          * following call succeeds (returns 'true').
+          */
+
+         if (ok)
+            ok = unit_test_run(&x_test_x);
+
+         /*
+          * Now use a test that supports the --force-failure option.
+          */
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_unit_test_04_19_force_fail);
+
+         if (ok)
+            ok = ! unit_test_run(&x_test_x);
+
+         (void) unit_test_options_force_failure_set
+         (
+            &x_test_x.m_App_Options, force_failure
+         );
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error test, passed"))
+      {
+         unit_test_options_t x_options_x;
+         unit_test_status_t x_status_x;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--stop-on-error";
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            x_options_x = x_test_x.m_App_Options;        /* fake options      */
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 92, 2,
+               _("Test 04.18"), _("Disposal")
+            );
+            if (ok)
+            {
+               /*
+                * TODO:
+                * Now we need to set up the status structure to indicate
+                * that unit_test_run() should quit (and quit with a "passed"
+                * status).
+                *
+                *    1. Need to LOAD a test.
+                *    2. Need to set up the status structure properly.
+                */
+
+               if (ok)
+                  ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+
+               if (ok)
+                  ok = unit_test_run(&x_test_x);
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error test, no quit"))
+      {
+         unit_test_options_t x_options_x;
+         unit_test_status_t x_status_x;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--stop-on-error";
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.18.5", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            x_options_x = x_test_x.m_App_Options;     /* fake test options    */
+            ok = unit_test_status_initialize
+            (
+               &x_status_x, &x_options_x, 92, 2,
+               _("Test 04.18"), _("Disposal")
+            );
+            if (ok)
+               ok = unit_test_status_fail(&x_status_x);
+
+            if (ok)
+            {
+               /*
+                * Now we need to set up the status structure to indicate
+                * that unit_test_run() should quit (and quit with a "passed"
+                * status).
+                */
+
+               if (ok)
+                  ok = ! unit_test_run(&x_test_x);
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "before-run"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   20. unit_test_run_a_test_before()
+ *
+ * \test
+ *    -  unit_test_run_a_test_before()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_20 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 20,
+      "unit_test_t", "unit_test_run_a_test_before()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 2;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.20.1", "version", "additionalhelp"
+      );
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_before
+         (
+            nullptr, (intptr_t) nullptr
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_before
+         (
+            nullptr, (intptr_t) fake_unit_test_04_19
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_before
+         (
+            &x_test_x, (intptr_t) nullptr
+         );
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "after-run"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   21. unit_test_run_a_test_after()
+ *
+ * \test
+ *    -  unit_test_run_a_test_after()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_21 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 21,
+      "unit_test_t", "unit_test_run_a_test_after()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      unit_test_status_t x_status_x;
+      unit_test_options_t x_options_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 2;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.20.1", "version", "additionalhelp"
+      );
+      if (ok)
+         x_options_x = x_test_x.m_App_Options;
+
+      if (ok)
+      {
+         ok = unit_test_status_initialize
+         (
+            &x_status_x, &x_options_x, 90, 3, _("Test 04.21"), _("Disposal")
+         );
+      }
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_after(nullptr, nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_after(nullptr, &x_status_x);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Null status-pointer"))
+      {
+         cbool_t null_ok = ! unit_test_run_a_test_after(&x_test_x, nullptr);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run-a-test"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   22. unit_test_run_a_test()
+ *
+ * \test
+ *    -  unit_test_run_a_test()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_22 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 22,
+      "unit_test_t", "unit_test_run_a_test()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 2;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.22.1", "version", "additionalhelp"
+      );
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      {
+         /**
+          * Sub-test 1:
+          *
+          * In the unit_test_run_a_test() function, unit_test_status_init()
+          * is always called before checking the arguments.  This is
+          * necessary even in the event of failure.  So this sub-test checks
+          * both the return result and the internal values of the resulting
+          * unit_test_status_t structure.
+          */
+
+         unit_test_status_t result = unit_test_run_a_test(nullptr, nullptr);
+         cbool_t ok = ! unit_test_status_passed(&result);
+         if (ok)
+         {
+            show_deliberate_failure(options);
+            ok = result.m_Test_Options == nullptr;
+         }
+         if (ok)
+            ok = strlen(result.m_Group_Name) == 0;
+
+         if (ok)
+            ok = strlen(result.m_Case_Description) == 0;
+
+         if (ok)
+            ok = strlen(result.m_Subtest_Name) == 0;
+
+         if (ok)
+            ok = result.m_Test_Group == 0;
+
+         if (ok)
+            ok = result.m_Test_Case == 0;
+
+         if (ok)
+            ok = result.m_Test_Result == false;       /* it failed, remember? */
+
+         if (ok)
+            ok = result.m_Subtest_Error_Count == 1;   /* Yup.  It failed.     */
+
+         if (ok)
+            ok = result.m_Failed_Subtest == 0;
+
+         if (ok)
+            ok = result.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+
+         if (ok)
+            ok = result.m_Start_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_Start_Time_us.tv_usec == 0;
+
+         if (ok)
+            ok = result.m_End_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_End_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_Test_Duration_ms == 0.0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      {
+         unit_test_status_t result = unit_test_run_a_test
+         (
+            nullptr, fake_unit_test_04_19
+         );
+         cbool_t ok = ! unit_test_status_passed(&result);
+         if (ok)
+         {
+            show_deliberate_failure(options);
+            ok = result.m_Test_Options == nullptr;
+         }
+         if (ok)
+            ok = strlen(result.m_Group_Name) == 0;
+
+         if (ok)
+            ok = strlen(result.m_Case_Description) == 0;
+
+         if (ok)
+            ok = strlen(result.m_Subtest_Name) == 0;
+
+         if (ok)
+            ok = result.m_Test_Group == 0;
+
+         if (ok)
+            ok = result.m_Test_Case == 0;
+
+         if (ok)
+            ok = result.m_Test_Result == false;       /* it failed, remember? */
+
+         if (ok)
+            ok = result.m_Subtest_Error_Count == 1;   /* Yup.  It failed.     */
+
+         if (ok)
+            ok = result.m_Failed_Subtest == 0;
+
+         if (ok)
+            ok = result.m_Test_Disposition == XPCCUT_DISPOSITION_ABORTED;
+
+         if (ok)
+            ok = result.m_Start_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_Start_Time_us.tv_usec == 0;
+
+         if (ok)
+            ok = result.m_End_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_End_Time_us.tv_sec == 0;
+
+         if (ok)
+            ok = result.m_Test_Duration_ms == 0.0;
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Null test-pointer"))
+      {
+         /**
+          * \todo
+          *    Try casting to function type unit_test_func_t.
+          *
+          * @gcc warns:
+          *
+          *    unit_test_run_a_test(&x_test_x, (intptr_t) nullptr);
+          */
+
+         unit_test_status_t s =
+            unit_test_run_a_test(&x_test_x, (const unit_test_func_t) nullptr);
+
+
+         ok = ! unit_test_status_passed(&s);
+         show_deliberate_failure(options);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "check-subtest"
+ *    functionality works.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   23. unit_test_check_subtests()
+ *
+ * \test
+ *    -  unit_test_check_subtests()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_23 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 23,
+      "unit_test_t", "unit_test_check_subtests()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      unit_test_status_t x_status_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 2;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      ok = unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.23.1", "version", "additionalhelp"
+      );
+      if (ok)
+         ok = unit_test_status_init(&x_status_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 1"))
+      {
+         int result = unit_test_check_subtests(nullptr, nullptr);
+         ok = result == XPCCUT_INVALID_PARAMETER;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Null 'this' 2"))
+      {
+         int result = unit_test_check_subtests(nullptr, &x_status_x);
+         ok = result == XPCCUT_INVALID_PARAMETER;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Null status-pointer"))
+      {
+         int result = unit_test_check_subtests(&x_test_x, nullptr);
+         ok = result == XPCCUT_INVALID_PARAMETER;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Null status, need subtest"))
+      {
+         int result = unit_test_check_subtests(&x_test_x, nullptr);
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--require-sub-tests";
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.23.1", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = result == XPCCUT_INVALID_PARAMETER;  /* checked before init  */
+
+         result = unit_test_check_subtests(&x_test_x, nullptr);
+         if (ok)
+            ok = result == XPCCUT_INVALID_PARAMETER;  /* checked after init   */
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now destroy all allocated resources in the test object.
+       */
+
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Provides the number of fake tests that unit_unit_test_04_24() loads.
+ */
+
+#define JOB_TEST_COUNT           9
+
+/**
+ *    Loads the fake tests used by unit_unit_test_04_24().  When the
+ *    force-failure option is in force, the tests at index 2 and index 5
+ *    fail, and the rest pass, no matter which order the workers run them
+ *    in.
+ *
+ * \return
+ *    Returns 'true' if all of the tests loaded.
+ */
+
+static cbool_t
+load_unit_test_04_24 (unit_test_t * tests)
+{
+   cbool_t result = true;
+   int i;
+   for (i = 0; i < JOB_TEST_COUNT; i++)
+   {
+      if (i == 2 || i == 5)
+         result = unit_test_load(tests, fake_unit_test_04_19_force_fail);
+      else
+         result = unit_test_load(tests, fake_subtest_unit_test_04_19);
+
+      if (! result)
+         break;
+   }
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    works with a pool of worker threads.
+ *
+ *    The main point is that the totals and first-failure numbers must come
+ *    out the same as for a run in a single thread, in load order, every
+ *    time.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   24. Running with the --jobs option.
+ *
+ * \test
+ *    -  unit_test_run_jobs()
+ *    -  unit_test_use_jobs()
+ *    -  unit_test_run() [with --jobs]
+ *    -  unit_test_run_a_job() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_24 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 24, "unit_test_t", "unit_test_run_jobs()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 4;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--jobs";
+      argv[3] = "4";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         cbool_t null_ok = ! unit_test_run_jobs(nullptr, nullptr, nullptr);
+         if (null_ok)
+            null_ok = ! unit_test_use_jobs(nullptr);
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "unit_test_use_jobs()"))
+      {
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.24.2", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_use_jobs(&x_test_x);
+
+         if (ok)
+         {
+            (void) unit_test_options_job_count_set(&x_test_x.m_App_Options, 1);
+            ok = ! unit_test_use_jobs(&x_test_x);
+            (void) unit_test_options_job_count_set(&x_test_x.m_App_Options, 4);
+         }
+         if (ok)
+         {
+            (void) unit_test_options_is_pause_set(&x_test_x.m_App_Options, true);
+            ok = ! unit_test_use_jobs(&x_test_x);
+            (void) unit_test_options_is_pause_set
+            (
+               &x_test_x.m_App_Options, false
+            );
+         }
+         if (ok)
+            ok = unit_test_use_jobs(&x_test_x);
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "All tests pass"))
+      {
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.24.3", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+            ok = unit_test_run(&x_test_x);
+
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 0;
+
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 2 * (JOB_TEST_COUNT - 2);
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Failures in load order"))
+      {
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.24.4", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            ok = unit_test_options_force_failure_set  /* not --force-failure */
+            (
+               &x_test_x.m_App_Options, true          /* it silences output   */
+            );
+         }
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+         {
+            int run;
+            for (run = 0; run < 8; run++)          /* must not vary by run    */
+            {
+               ok = ! unit_test_run(&x_test_x);
+               if (ok)
+                  ok = unit_test_failures(&x_test_x) == 2;
+
+               if (ok)
+                  ok = unit_test_first_failed_test(&x_test_x) == 2;
+
+               if (ok)
+                  ok = unit_test_first_failed_group(&x_test_x) == 4;
+
+               if (ok)
+                  ok = unit_test_first_failed_case(&x_test_x) == 19;
+
+               if (! ok)
+                  break;
+            }
+         }
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Same as serial run"))
+      {
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.24.5", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            ok = unit_test_options_force_failure_set  /* not --force-failure */
+            (
+               &x_test_x.m_App_Options, true          /* it silences output   */
+            );
+         }
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+         {
+            int failures, first_test, subtests;
+            (void) unit_test_run(&x_test_x);
+            failures = unit_test_failures(&x_test_x);
+            first_test = unit_test_first_failed_test(&x_test_x);
+            subtests = unit_test_subtest_count(&x_test_x);
+            (void) unit_test_options_job_count_set(&x_test_x.m_App_Options, 1);
+            ok = ! unit_test_use_jobs(&x_test_x);
+            if (ok)
+               ok = ! unit_test_run(&x_test_x);
+
+            if (ok)
+               ok = unit_test_failures(&x_test_x) == failures;
+
+            if (ok)
+               ok = unit_test_first_failed_test(&x_test_x) == first_test;
+
+            if (ok)
+               ok = unit_test_subtest_count(&x_test_x) == 2 * subtests;
+         }
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error with jobs"))
+      {
+         argv[4] = "--stop-on-error";
+         argc = 5;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.24.6", "version", "additionalhelp"
+         );
+         if (ok)
+         {
+            ok = unit_test_options_force_failure_set  /* not --force-failure */
+            (
+               &x_test_x.m_App_Options, true          /* it silences output   */
+            );
+         }
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+            ok = ! unit_test_run(&x_test_x);
+
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 1;
+
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 2;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Indicates that unit_test_run_jobs() can run tests in child processes.
+ *    Otherwise, the fake tests below would take down the test application.
+ */
+
+#if XPC_HAVE_UNISTD_H && XPC_HAVE_SYS_WAIT_H && XPC_HAVE_POLL_H && \
+ ! defined WIN32
+#define USE_ISOLATE_TESTS 1
+#else
+#define USE_ISOLATE_TESTS 0
+#endif
+
+#if USE_ISOLATE_TESTS
+
+/**
+ *    Provides a fake test, for unit_unit_test_04_25(), that crashes.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Never returns.
+ */
+
+static unit_test_status_t
+fake_crash_unit_test_04_25 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   (void) unit_test_status_initialize
+   (
+      &status, options, 4, 25, _("Unit-test fake crash"), "abort()"
+   );
+   abort();
+   return status;
+}
+
+/**
+ *    Provides a fake test, for unit_unit_test_04_25(), that takes far
+ *    longer than the --test-timeout value.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol, but only
+ *    if the test is not killed first.
+ */
+
+static unit_test_status_t
+fake_hang_unit_test_04_25 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 25, _("Unit-test fake hang"), "xpccut_ms_sleep()"
+   );
+   if (ok)
+   {
+      xpccut_ms_sleep(10000);
+      unit_test_status_pass(&status, true);
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test, for unit_unit_test_04_25(), that exits without
+ *    returning a status.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Never returns.
+ */
+
+static unit_test_status_t
+fake_exit_unit_test_04_25 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   (void) unit_test_status_initialize
+   (
+      &status, options, 4, 25, _("Unit-test fake exit"), "_exit()"
+   );
+   _exit(3);
+   return status;
+}
+
+/**
+ *    Provides a fake test, for unit_unit_test_04_25(), that fails a check
+ *    in its second sub-test, so that its failure log has to come back from
+ *    the child process.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_fail_unit_test_04_25 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 25, _("Unit-test fake failure"), "int_check()"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Passes a check"))
+         (void) unit_test_status_int_check(&status, 1, 1);
+
+      if (unit_test_status_next_subtest(&status, "Fails a check"))
+         (void) unit_test_status_int_check(&status, 1, 2);
+   }
+   return status;
+}
+
+#endif   /* USE_ISOLATE_TESTS */
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    works with each test in a child process of its own.
+ *
+ *    A test that crashes, exits, or hangs must count as one failure, and
+ *    must not stop the tests loaded after it.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   25. Running with the --isolate option.
+ *
+ * \test
+ *    -  unit_test_run_jobs() [with --isolate]
+ *    -  unit_test_use_jobs()
+ *    -  unit_test_first_failed_status()
+ *    -  unit_test_status_failure_add()
+ *    -  unit_test_run_isolated() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_25 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 25, "unit_test_t", "unit_test_run_jobs() isolated"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      char * argv[FULL_ARG_COUNT + 1];
+      int argc = 4;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--isolate";
+      argv[3] = "--no-isolate";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "unit_test_use_jobs()"))
+      {
+         argc = 3;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.25.1", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_use_jobs(&x_test_x);          /* even for 1 job */
+
+         if (ok)
+         {
+            (void) unit_test_options_is_summary_set
+            (
+               &x_test_x.m_App_Options, true
+            );
+            ok = ! unit_test_use_jobs(&x_test_x);
+         }
+         unit_test_destroy(&x_test_x);
+         argc = 4;
+         if (ok)
+         {
+            ok = unit_test_initialize
+            (
+               &x_test_x, argc, argv, "Test 04.25.1", "version", "additional"
+            );
+         }
+         if (ok)
+            ok = ! unit_test_use_jobs(&x_test_x);        /* --no-isolate   */
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Isolated, all pass"))
+      {
+         argv[3] = "--jobs";
+         argv[4] = "3";
+         argc = 5;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.25.2", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+            ok = unit_test_run(&x_test_x);
+
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 0;
+
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 2 * (JOB_TEST_COUNT - 2);
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+#if USE_ISOLATE_TESTS
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Crash, exit, and hang"))
+      {
+         argv[5] = "--test-timeout";
+         argv[6] = "200";
+         argc = 7;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.25.3", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_crash_unit_test_04_25);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_hang_unit_test_04_25);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_exit_unit_test_04_25);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the failure messages */
+            ok = ! unit_test_run(&x_test_x);
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 3;
+
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 1;
+
+         if (ok)
+            ok = unit_test_subtest_count(&x_test_x) == 2 + 3 + 2;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Stop-on-error, isolated"))
+      {
+         argv[5] = "--stop-on-error";
+         argc = 6;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.25.4", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_crash_unit_test_04_25);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_hang_unit_test_04_25);
+
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the failure messages */
+            ok = ! unit_test_run(&x_test_x);
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+            ok = unit_test_failures(&x_test_x) == 1;   /* the hang is killed */
+
+         if (ok)
+            ok = unit_test_first_failed_test(&x_test_x) == 0;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Failure log, isolated"))
+      {
+         argc = 5;                              /* --isolate --jobs 3      */
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.25.5", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_first_failed_status(&x_test_x) == nullptr;
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_subtest_unit_test_04_19);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_fail_unit_test_04_25);
+
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the failure messages */
+            ok = ! unit_test_run(&x_test_x);
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (ok)
+         {
+            const unit_test_status_t * failed =
+               unit_test_first_failed_status(&x_test_x);
+
+            const unit_test_failure_t * entry =
+               unit_test_status_failure(failed, 0);
+
+            ok = cut_not_nullptr(entry);
+            if (ok)
+               ok = unit_test_status_failure_count(failed) == 1;
+
+            if (ok)
+               ok = unit_test_status_failure(failed, 1) == nullptr;
+
+            if (ok)
+               ok = entry->m_Subtest == 2 && entry->m_Thread > 0;
+
+            if (ok)
+            {
+               ok = entry->m_Subtest_Name == xpccut_intern_in
+               (
+                  &x_test_x.m_Names, "Fails a check"
+               );
+            }
+            if (ok)
+            {
+               /*
+                * Show the status, as cut_status::show() does, into a
+                * capture of our own, so that the names of the log are read
+                * in this process.  The capture of a --jobs worker, if any,
+                * is put back afterward.
+                */
+
+               int length = 0;
+               char * outer = nullptr;
+               cbool_t capturing = xpccut_output_is_capturing();
+               char * block;
+               int size;
+               if (capturing)
+                  outer = xpccut_output_capture_end(&length);
+
+               xpccut_output_capture_begin();
+               ok = unit_test_status_show(failed);
+               xpccut_output_flush();
+               block = xpccut_output_capture_end(&size);
+               if (ok && ! xpccut_is_silent())
+                  ok = cut_not_nullptr(block) && size > 0;
+
+               free(block);
+               if (capturing)
+               {
+                  xpccut_output_capture_begin();
+                  xpccut_output_replay(outer, length);
+               }
+               free(outer);
+            }
+         }
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+#endif   /* USE_ISOLATE_TESTS */
+
+   }
+   return status;
+}
+
+/**
+ *    Provides the name of the durations file written and read by
+ *    unit_unit_test_04_26().
+ */
+
+#define SHARD_DURATIONS_FILE     "unit_test_04_26.dur"
+
+/**
+ *    Runs the fake tests of load_unit_test_04_24() as one of three shards.
+ *
+ * \return
+ *    Returns the number of tests that the shard actually ran, or -1 if the
+ *    run failed.
+ */
+
+static int
+run_shard_unit_test_04_26
+(
+   int shardindex,
+   const char * mode,
+   const char * filename
+)
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   char index[12];
+   char * argv[FULL_ARG_COUNT + 1];
+   int argc = 8;
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   argv[2] = "--shard-count";
+   argv[3] = "3";
+   argv[4] = "--shard-index";
+   argv[5] = index;
+   argv[6] = "--shard-by";
+   argv[7] = (char *) mode;
+   argv[8] = "--durations";
+   argv[9] = (char *) filename;
+   if (cut_not_nullptr(filename))
+      argc = 10;
+
+   (void) snprintf(index, sizeof index, "%d", shardindex);
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.26", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = load_unit_test_04_24(&x_test_x);
+      if (ok)
+      {
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the SHARD summary   */
+         ok = unit_test_run(&x_test_x);
+         if (! silent)
+            xpccut_allow_printing();
+      }
+      if (ok)
+         result = unit_test_run_count(&x_test_x);
+   }
+   unit_test_destroy(&x_test_x);
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    runs only the tests of the shard selected by --shard-index.
+ *
+ *    The main point is that the shards together run every test exactly
+ *    once, no matter which --shard-by mode is used.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   26. Running with the --shard-count and --shard-index options.
+ *
+ * \test
+ *    -  unit_test_run() [with --shard-count]
+ *    -  unit_test_run_count()
+ *    -  unit_test_options_in_shard()
+ *    -  unit_test_options_shard_map_set() [indirect]
+ *    -  unit_test_setup_shards() [indirect test of static function]
+ *    -  unit_test_balance_shards() [indirect test of static function]
+ *    -  unit_test_save_durations() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_26 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 26, "unit_test_t", "unit_test_run() sharded"
+   );
+   if (ok)
+   {
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         cbool_t null_ok =
+            unit_test_run_count(nullptr) == XPCCUT_INVALID_PARAMETER;
+         if (null_ok)
+            null_ok = ! unit_test_options_shard_map_set(nullptr, nullptr);
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Shard by index"))
+      {
+         int shard;
+         for (shard = 0; shard < 3; ++shard)
+         {
+            if (ok)
+            {
+               ok = run_shard_unit_test_04_26(shard, "index", nullptr) ==
+                  JOB_TEST_COUNT / 3;
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Shard by hash"))
+      {
+         int total = 0;
+         int largest = 0;
+         int shard;
+         for (shard = 0; shard < 3; ++shard)
+         {
+            int count = run_shard_unit_test_04_26(shard, "hash", nullptr);
+            if (count < 0)
+               ok = false;
+
+            total += count;
+            if (count > largest)
+               largest = count;
+         }
+         if (ok)
+            ok = total == JOB_TEST_COUNT;
+
+         if (ok)
+            ok = largest == JOB_TEST_COUNT;     /* the fakes share one name */
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Bad shard index"))
+      {
+         unit_test_t x_test_x;
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 6;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--shard-count";
+         argv[3] = "3";
+         argv[4] = "--shard-index";
+         argv[5] = "3";
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.26.4", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = ! unit_test_run(&x_test_x);
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Shard by duration"))
+      {
+         FILE * f = fopen(SHARD_DURATIONS_FILE, "w");
+         ok = cut_not_nullptr(f);
+         if (ok)
+         {
+            int i;
+            fprintf(f, "# Test 04.26.5: test duration_ms\n");
+            fprintf(f, "1 100.0\n");            /* the first test is long   */
+            for (i = 2; i <= JOB_TEST_COUNT; ++i)
+               fprintf(f, "%d 1.0\n", i);
+
+            fclose(f);
+         }
+         if (ok)
+         {
+            ok = run_shard_unit_test_04_26
+            (
+               0, "duration", SHARD_DURATIONS_FILE
+            ) == 1;
+         }
+         if (ok)
+         {
+            ok = run_shard_unit_test_04_26
+            (
+               1, "duration", SHARD_DURATIONS_FILE
+            ) == (JOB_TEST_COUNT - 1) / 2;
+         }
+         if (ok)
+         {
+            ok = run_shard_unit_test_04_26
+            (
+               2, "duration", SHARD_DURATIONS_FILE
+            ) == (JOB_TEST_COUNT - 1) / 2;
+         }
+         (void) remove(SHARD_DURATIONS_FILE);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Save durations"))
+      {
+         unit_test_t x_test_x;
+         char * argv[FULL_ARG_COUNT + 1];
+         int argc = 4;
+         argv[0] = "unit_test_test";
+         argv[1] = "--no-show-progress";
+         argv[2] = "--save-durations";
+         argv[3] = SHARD_DURATIONS_FILE;
+         ok = unit_test_initialize
+         (
+            &x_test_x, argc, argv, "Test 04.26.6", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = load_unit_test_04_24(&x_test_x);
+
+         if (ok)
+            ok = unit_test_run(&x_test_x);
+
+         unit_test_destroy(&x_test_x);
+         if (ok)
+         {
+            FILE * f = fopen(SHARD_DURATIONS_FILE, "r");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               char line[XPCCUT_STRLEN];
+               int count = 0;
+               while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+               {
+                  if (line[0] != '#')
+                     ++count;
+               }
+               fclose(f);
+               ok = count == JOB_TEST_COUNT;
+            }
+         }
+         (void) remove(SHARD_DURATIONS_FILE);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Counts the calls to the fake tests of unit_unit_test_04_27(), which
+ *    unit_unit_test_04_34() also runs.  The runs that use the count are
+ *    serialized by gs_lock_04_27, since --jobs can run both tests at once,
+ *    and --repeat two copies of one of them, while the fake tests can run
+ *    in the --jobs workers of the nested run.
+ */
+
+static int gs_calls_04_27 = 0;
+
+/**
+ *    Indicates that the runs of the fake tests of unit_unit_test_04_27()
+ *    can lock each other out.  The pthread header is already included for
+ *    unit_unit_test_02_34().
+ */
+
+#define USE_CALLS_LOCK_04_27  USE_STOPWATCH_THREADS
+
+#if USE_CALLS_LOCK_04_27
+
+/**
+ *    Serializes the runs that use gs_calls_04_27.
+ */
+
+static pthread_mutex_t gs_lock_04_27 = PTHREAD_MUTEX_INITIALIZER;
+
+#endif
+
+/**
+ *    Provides the code shared by the fake tests of unit_unit_test_04_27().
+ *    Each test counts the call, and then has one sub-test that passes.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_common_unit_test_04_27
+(
+   const unit_test_options_t * options,
+   int testgroup,
+   int testcase,
+   const char * groupname,
+   const char * casename
+)
+{
+   unit_test_status_t status;
+   cbool_t ok;
+   ++gs_calls_04_27;
+   ok = unit_test_status_initialize
+   (
+      &status, options, testgroup, testcase, groupname, casename
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Counted test"))
+         unit_test_status_pass(&status, true);
+   }
+   return status;
+}
+
+/**
+ *    Provides the first fake test for unit_unit_test_04_27().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_first_unit_test_04_27 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_27(options, 4, 27, "registered", "first");
+}
+
+/**
+ *    Provides the second fake test for unit_unit_test_04_27().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_second_unit_test_04_27 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_27(options, 4, 28, "registered", "second");
+}
+
+/**
+ *    Provides the third fake test for unit_unit_test_04_27().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_third_unit_test_04_27 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_27(options, 5, 1, "other", "third");
+}
+
+/**
+ *    Registers the fake tests of unit_unit_test_04_27(), with the same
+ *    group and case information that the tests use, and runs them.
+ *
+ * \return
+ *    Returns the number of fake tests that were called, or -1 if the run
+ *    failed.
+ */
+
+static int
+run_unit_test_04_27 (int argc, char * argv [])
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   cbool_t ok;
+#if USE_CALLS_LOCK_04_27
+   pthread_mutex_lock(&gs_lock_04_27);
+#endif
+   ok = unit_test_initialize
+   (
+      &x_test_x, argc, argv, "Test 04.27", "version", "additionalhelp"
+   );
+   if (ok)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_first_unit_test_04_27, 4, 27, "registered", "first"
+      );
+   }
+   if (ok)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_second_unit_test_04_27, 4, 28, "registered", "second"
+      );
+   }
+   if (ok)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_third_unit_test_04_27, 5, 1, "other", "third"
+      );
+   }
+   if (ok)
+   {
+      cbool_t silent = xpccut_is_silent();
+      xpccut_silence_printing();                /* hide the --summarize list */
+      gs_calls_04_27 = 0;
+      ok = unit_test_run(&x_test_x);
+      if (! silent)
+         xpccut_allow_printing();
+   }
+   if (ok)
+      ok = unit_test_count(&x_test_x) == 3;
+
+   if (ok)
+      result = gs_calls_04_27;
+
+   unit_test_destroy(&x_test_x);
+#if USE_CALLS_LOCK_04_27
+   pthread_mutex_unlock(&gs_lock_04_27);
+#endif
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that tests loaded with
+ *    their group and case information are filtered without being called.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   27. unit_test_register() and unit_test_skip_a_test().
+ *
+ * \test
+ *    -  unit_test_register()
+ *    -  unit_test_cpp_load_info()
+ *    -  unit_test_skip_a_test()
+ *    -  unit_test_run() [with registered tests]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_27 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 27, "unit_test_t", "unit_test_register()"
+   );
+   if (ok)
+   {
+      char * argv[FULL_ARG_COUNT + 1];
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         unit_test_t x_test_x;
+         unit_test_status_t x_status_x;
+         cbool_t null_ok = unit_test_init(&x_test_x);
+         if (null_ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error messages   */
+            null_ok = ! unit_test_register
+            (
+               nullptr, fake_first_unit_test_04_27, 4, 27, "group", "case"
+            );
+            if (null_ok)
+            {
+               null_ok = ! unit_test_register
+               (
+                  &x_test_x, nullptr, 4, 27, "group", "case"
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_register
+               (
+                  &x_test_x, fake_first_unit_test_04_27, 0, 27, "group", "case"
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_register
+               (
+                  &x_test_x, fake_first_unit_test_04_27, 4, 27, nullptr, "case"
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_cpp_load_info
+               (
+                  nullptr, 4, 27, "group", "case"
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_cpp_load_info
+               (
+                  &x_test_x, 4, 0, "group", "case"
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_skip_a_test
+               (
+                  nullptr, 0, options, &x_status_x
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_skip_a_test
+               (
+                  &x_test_x, 0, options, &x_status_x     /* none loaded  */
+               );
+            }
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (null_ok)
+            null_ok = unit_test_count(&x_test_x) == 0;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "No filter, all called"))
+      {
+         ok = run_unit_test_04_27(2, argv) == 3;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "--case, one called"))
+      {
+         argv[2] = "--case";
+         argv[3] = "28";
+         if (ok)
+            ok = run_unit_test_04_27(4, argv) == 1;
+
+         if (ok)
+         {
+            argv[2] = "--group";
+            argv[3] = "other";
+            ok = run_unit_test_04_27(4, argv) == 1;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "--summarize, none called"))
+      {
+         argv[2] = "--summarize";
+         if (ok)
+            ok = run_unit_test_04_27(3, argv) == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "--jobs, one called"))
+      {
+         argv[2] = "--jobs";
+         argv[3] = "3";
+         argv[4] = "--case";
+         argv[5] = "first";
+         if (ok)
+            ok = run_unit_test_04_27(6, argv) == 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Skipped status"))
+      {
+         unit_test_t x_test_x;
+         unit_test_status_t x_status_x;
+         argv[2] = "--case";
+         argv[3] = "28";
+         ok = unit_test_initialize
+         (
+            &x_test_x, 4, argv, "Test 04.27.6", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_first_unit_test_04_27);
+
+         if (ok)
+         {
+            ok = unit_test_cpp_load_info
+            (
+               &x_test_x, 4, 27, "registered", "first"
+            );
+         }
+         if (ok)
+         {
+            ok = ! unit_test_skip_a_test          /* unit_test_load() test   */
+            (
+               &x_test_x, 0, &x_test_x.m_App_Options, &x_status_x
+            );
+         }
+         if (ok)
+         {
+            ok = unit_test_skip_a_test
+            (
+               &x_test_x, 1, &x_test_x.m_App_Options, &x_status_x
+            );
+         }
+         if (ok)
+            ok = unit_test_status_is_skipped(&x_status_x);
+
+         if (ok)
+            ok = unit_test_status_case(&x_status_x) == 27;
+
+         if (ok)
+         {
+            ok = ! unit_test_skip_a_test               /* out of range      */
+            (
+               &x_test_x, 2, &x_test_x.m_App_Options, &x_status_x
+            );
+         }
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the case-list can be
+ *    sized in advance.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   28. unit_test_reserve().
+ *
+ * \test
+ *    -  unit_test_reserve()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_28 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 28, "unit_test_t", "unit_test_reserve()"
+   );
+   if (ok)
+   {
+      unit_test_t x_test_x;
+      ok = unit_test_init(&x_test_x);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         cbool_t null_ok;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! unit_test_reserve(nullptr, 10);
+         if (null_ok && ok)
+            null_ok = ! unit_test_reserve(&x_test_x, -1);
+
+         if (! silent)
+            xpccut_allow_printing();
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Reserve and load"))
+      {
+         int i;
+         if (ok)
+            ok = unit_test_reserve(&x_test_x, 1);  /* already big enough     */
+
+         if (ok)
+            ok = x_test_x.m_Allocation_Count == XPCCUT_CASE_ALLOCATION;
+
+         if (ok)
+         {
+            ok = unit_test_reserve
+            (
+               &x_test_x, 2 * XPCCUT_CASE_ALLOCATION + 1
+            );
+         }
+         if (ok)
+            ok = x_test_x.m_Allocation_Count == 3 * XPCCUT_CASE_ALLOCATION;
+
+         for (i = 0; ok && i < 2 * XPCCUT_CASE_ALLOCATION + 1; ++i)
+         {
+            ok = unit_test_register
+            (
+               &x_test_x, fake_first_unit_test_04_27,
+               4, 27, "registered", "first"
+            );
+         }
+         if (ok)
+            ok = x_test_x.m_Allocation_Count == 3 * XPCCUT_CASE_ALLOCATION;
+
+         if (ok)
+            ok = unit_test_count(&x_test_x) == 2 * XPCCUT_CASE_ALLOCATION + 1;
+
+         if (ok)
+         {
+            int last = 2 * XPCCUT_CASE_ALLOCATION;
+            ok = x_test_x.m_Test_Info[last].m_Test_Case == 27;
+         }
+
+         unit_test_status_pass(&status, ok);
+      }
+      unit_test_destroy(&x_test_x);
+   }
+   return status;
+}
+
+/**
+ *    Holds the counts kept by the fixture functions and the fake tests of
+ *    unit_unit_test_04_29().
+ */
+
+typedef struct
+{
+   int m_Setups;                    /**< The calls to the setup function.     */
+   int m_Teardowns;                 /**< The calls to the teardown function.  */
+   int m_Uses;                      /**< The fake tests that saw the fixture. */
+   int m_Up;                        /**< 1 from setup until teardown.         */
+   int m_Lost;                      /**< Fake tests that saw it torn down.    */
+   cbool_t m_Fail_Setup;            /**< Makes the setup function fail.       */
+
+} fixture_counts_04_29_t;
+
+/**
+ *    Provides the counts for unit_unit_test_04_29().  The fixture functions
+ *    get no context, so the counts are shared.  The runs that use them are
+ *    serialized by gs_lock_04_29, since --jobs and --repeat can run two
+ *    copies of unit_unit_test_04_29() at once.
+ */
+
+static fixture_counts_04_29_t gs_counts_04_29;
+
+/**
+ *    Indicates that run_unit_test_04_29() can lock out the other copies of
+ *    unit_unit_test_04_29().  The pthread header is already included for
+ *    unit_unit_test_02_34().
+ */
+
+#define USE_FIXTURE_LOCK_04_29  USE_STOPWATCH_THREADS
+
+#if USE_FIXTURE_LOCK_04_29
+
+/**
+ *    Serializes the runs of run_unit_test_04_29().
+ */
+
+static pthread_mutex_t gs_lock_04_29 = PTHREAD_MUTEX_INITIALIZER;
+
+#endif
+
+/**
+ *    Adds to one of the counts of unit_unit_test_04_29(), which the fake
+ *    tests change from the --jobs workers of the nested run.  An amount of
+ *    0 simply reads the count.
+ *
+ * \return
+ *    Returns the new value of the count.
+ */
+
+static int
+fixture_add_04_29 (int * count, int amount)
+{
+#if defined __GNUC__
+   return __sync_add_and_fetch(count, amount);
+#else
+   *count += amount;
+   return *count;
+#endif
+}
+
+/**
+ *    Provides a setup function for unit_unit_test_04_29().  The shared
+ *    state is the gs_counts_04_29 structure.
+ *
+ * \return
+ *    Returns 'true', unless the m_Fail_Setup flag is set.
+ */
+
+static cbool_t
+fixture_setup_04_29 (void ** data)
+{
+   (void) fixture_add_04_29(&gs_counts_04_29.m_Setups, 1);
+   *data = &gs_counts_04_29;
+   if (! gs_counts_04_29.m_Fail_Setup)
+      (void) fixture_add_04_29(&gs_counts_04_29.m_Up, 1);
+
+   return ! gs_counts_04_29.m_Fail_Setup;
+}
+
+/**
+ *    Provides a teardown function for unit_unit_test_04_29().
+ */
+
+static void
+fixture_teardown_04_29 (void * data)
+{
+   if (data == &gs_counts_04_29)
+   {
+      (void) fixture_add_04_29(&gs_counts_04_29.m_Teardowns, 1);
+      (void) fixture_add_04_29(&gs_counts_04_29.m_Up, -1);
+   }
+}
+
+/**
+ *    Provides a fake test for unit_unit_test_04_29().  It passes if it
+ *    gets the shared state of the fixture of its group.  It also counts
+ *    itself in m_Lost if the fixture is torn down while it is in use,
+ *    which it gives a moment to happen.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_unit_test_04_29 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, 1, "fixture group", "fixture user"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Shared state"))
+      {
+         fixture_counts_04_29_t * counts = unit_test_fixture_data();
+         ok = counts == &gs_counts_04_29;
+         if (ok)
+         {
+            (void) fixture_add_04_29(&counts->m_Uses, 1);
+            if (fixture_add_04_29(&counts->m_Up, 0) != 1)
+               (void) fixture_add_04_29(&counts->m_Lost, 1);
+            else
+            {
+               xpccut_ms_sleep(2);
+               if (fixture_add_04_29(&counts->m_Up, 0) != 1)
+                  (void) fixture_add_04_29(&counts->m_Lost, 1);
+            }
+         }
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Registers three copies of fake_unit_test_04_29() in group 98, along
+ *    with the fixture of the group, and runs them.
+ *
+ * \param argc
+ *    The number of arguments for the run.
+ *
+ * \param argv
+ *    The arguments for the run.
+ *
+ * \param failsetup
+ *    If true, the setup function of the fixture fails.
+ *
+ * \param [out] counts
+ *    Receives the counts left by the run.
+ *
+ * \return
+ *    Returns the result of unit_test_run(), or 'false' if the loading
+ *    failed.
+ */
+
+static cbool_t
+run_unit_test_04_29
+(
+   int argc,
+   char * argv [],
+   cbool_t failsetup,
+   fixture_counts_04_29_t * counts
+)
+{
+   unit_test_t x_test_x;
+   int c;
+   cbool_t ok;
+#if USE_FIXTURE_LOCK_04_29
+   pthread_mutex_lock(&gs_lock_04_29);
+#endif
+   gs_counts_04_29.m_Setups = 0;
+   gs_counts_04_29.m_Teardowns = 0;
+   gs_counts_04_29.m_Uses = 0;
+   gs_counts_04_29.m_Up = 0;
+   gs_counts_04_29.m_Lost = 0;
+   gs_counts_04_29.m_Fail_Setup = failsetup;
+   ok = unit_test_initialize
+   (
+      &x_test_x, argc, argv, "Test 04.29", "version", "additionalhelp"
+   );
+   if (ok)
+   {
+      ok = unit_test_fixture
+      (
+         &x_test_x, 98, fixture_setup_04_29, fixture_teardown_04_29
+      );
+   }
+   for (c = 1; ok && c <= 3; ++c)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_unit_test_04_29, 98, c,
+         "fixture group", "fixture user"
+      );
+   }
+   if (ok)
+      ok = unit_test_run(&x_test_x);
+
+   unit_test_destroy(&x_test_x);
+   *counts = gs_counts_04_29;
+#if USE_FIXTURE_LOCK_04_29
+   pthread_mutex_unlock(&gs_lock_04_29);
+#endif
+   return ok;
+}
+
+/**
+ *    Provides a unit/regression test to verify that a group fixture is set
+ *    up once, lazily, and torn down after the last case of its group, and
+ *    that each round of --repeat counts the cases afresh.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   29. unit_test_fixture().
+ *
+ * \test
+ *    -  unit_test_fixture()
+ *    -  unit_test_fixture_data()
+ *    -  unit_test_fixture_enter()
+ *    -  unit_test_fixture_leave()
+ *    -  xpccut_fixture_add()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_29 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 29, "unit_test_t", "unit_test_fixture()"
+   );
+   if (ok)
+   {
+      char * argv[FULL_ARG_COUNT + 1];
+      fixture_counts_04_29_t counts;
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--group";
+      argv[3] = "98";
+      argv[4] = "--jobs";
+      argv[5] = "2";
+      argv[6] = "--repeat";
+      argv[7] = "2";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Bad parameters"))
+      {
+         unit_test_t x_test_x;
+         cbool_t null_ok = unit_test_init(&x_test_x);
+         if (null_ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error messages   */
+            null_ok = ! unit_test_fixture
+            (
+               nullptr, 98, fixture_setup_04_29, fixture_teardown_04_29
+            );
+            if (null_ok)
+            {
+               null_ok = ! unit_test_fixture
+               (
+                  &x_test_x, 0, fixture_setup_04_29, fixture_teardown_04_29
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = ! unit_test_fixture
+               (
+                  &x_test_x, 98, nullptr, fixture_teardown_04_29
+               );
+            }
+            if (null_ok)
+            {
+               null_ok = unit_test_fixture       /* no teardown is all right */
+               (
+                  &x_test_x, 98, fixture_setup_04_29, nullptr
+               );
+            }
+
+            if (null_ok)
+            {
+               null_ok = ! unit_test_fixture              /* a second one   */
+               (
+                  &x_test_x, 98, fixture_setup_04_29, fixture_teardown_04_29
+               );
+            }
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (null_ok)
+            null_ok = x_test_x.m_Fixtures.m_Count == 1;
+
+         if (null_ok)
+            null_ok = cut_is_nullptr(unit_test_fixture_data());
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "One setup for the group"))
+      {
+         ok = run_unit_test_04_29(2, argv, false, &counts);
+         if (ok)
+            ok = counts.m_Setups == 1;
+
+         if (ok)
+            ok = counts.m_Uses == 3;
+
+         if (ok)
+            ok = counts.m_Teardowns == 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Group filtered out"))
+      {
+         argv[3] = "97";
+         ok = run_unit_test_04_29(4, argv, false, &counts);
+         argv[3] = "98";
+         if (ok)
+            ok = counts.m_Setups == 0;
+
+         if (ok)
+            ok = counts.m_Uses == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Failed setup"))
+      {
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the setup error      */
+         ok = ! run_unit_test_04_29(4, argv, true, &counts);
+         if (! silent)
+            xpccut_allow_printing();
+
+         if (ok)
+            ok = counts.m_Setups == 1;             /* not tried again        */
+
+         if (ok)
+            ok = counts.m_Uses == 0;
+
+         if (ok)
+            ok = counts.m_Teardowns == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Shared by --jobs workers"))
+      {
+         ok = run_unit_test_04_29(6, argv, false, &counts);
+         if (ok)
+            ok = counts.m_Setups == 1;
+
+         if (ok)
+            ok = counts.m_Uses == 3;
+
+         if (ok)
+            ok = counts.m_Teardowns == 1;
+
+         if (ok)
+            ok = counts.m_Lost == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Each round of --repeat"))
+      {
+         argv[5] = "4";
+         ok = run_unit_test_04_29(8, argv, false, &counts);
+         argv[5] = "2";
+         if (ok)                                /* rounds can overlap        */
+            ok = counts.m_Setups >= 1 && counts.m_Setups <= 2;
+
+         if (ok)
+            ok = counts.m_Uses == 6 && counts.m_Lost == 0;
+
+         if (ok)
+            ok = counts.m_Teardowns == counts.m_Setups;
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Counts the calls to the fake tests of unit_unit_test_04_30().  The
+ *    runs that use the count are serialized by gs_lock_04_30, since
+ *    --repeat can run two copies of the test at once under --jobs.
+ */
+
+static int gs_calls_04_30 = 0;
+
+/**
+ *    Indicates that the runs of run_unit_test_04_30() can lock each other
+ *    out.  The pthread header is already included for
+ *    unit_unit_test_02_34().
+ */
+
+#define USE_CALLS_LOCK_04_30  USE_STOPWATCH_THREADS
+
+#if USE_CALLS_LOCK_04_30
+
+/**
+ *    Serializes the runs of run_unit_test_04_30().
+ */
+
+static pthread_mutex_t gs_lock_04_30 = PTHREAD_MUTEX_INITIALIZER;
+
+#endif
+
+/**
+ *    Provides a fake test for unit_unit_test_04_30() that runs well past
+ *    the timeout it is given, and still passes its sub-test.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_late_unit_test_04_30 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, 1, "watchdog", "late"
+   );
+   ++gs_calls_04_30;
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Sleeps too long"))
+      {
+         xpccut_ms_sleep(100);
+         unit_test_status_pass(&status, true);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test for unit_unit_test_04_30() that returns at once.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_prompt_unit_test_04_30 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, 2, "watchdog", "prompt"
+   );
+   ++gs_calls_04_30;
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Returns at once"))
+         unit_test_status_pass(&status, true);
+   }
+   return status;
+}
+
+/**
+ *    Registers the fake tests of unit_unit_test_04_30(), giving the late
+ *    one a timeout of 10 ms, and the prompt one a timeout of 10 seconds,
+ *    and runs them.
+ *
+ * \return
+ *    Returns the number of failed tests, or -1 if the loading failed, or
+ *    not every test was called.
+ */
+
+static int
+run_unit_test_04_30 (int argc, char * argv [])
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   cbool_t ok;
+#if USE_CALLS_LOCK_04_30
+   pthread_mutex_lock(&gs_lock_04_30);
+#endif
+   ok = unit_test_initialize
+   (
+      &x_test_x, argc, argv, "Test 04.30", "version", "additionalhelp"
+   );
+   if (ok)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_late_unit_test_04_30, 98, 1, "watchdog", "late"
+      );
+   }
+   if (ok)
+      ok = unit_test_load_timeout(&x_test_x, 10);
+
+   if (ok)
+   {
+      ok = unit_test_register
+      (
+         &x_test_x, fake_prompt_unit_test_04_30, 98, 2, "watchdog", "prompt"
+      );
+   }
+   if (ok)
+      ok = unit_test_load_timeout(&x_test_x, 10000);
+
+   if (ok)
+   {
+      cbool_t silent = xpccut_is_silent();
+      xpccut_silence_printing();                /* hide the timeout report   */
+      gs_calls_04_30 = 0;
+      (void) unit_test_run(&x_test_x);
+      if (! silent)
+         xpccut_allow_printing();
+
+      if (unit_test_options_is_isolated(&x_test_x.m_App_Options))
+         gs_calls_04_30 = 2;                    /* called in the children    */
+
+      if (gs_calls_04_30 == 2)
+         result = unit_test_failures(&x_test_x);
+   }
+   unit_test_destroy(&x_test_x);
+#if USE_CALLS_LOCK_04_30
+   pthread_mutex_unlock(&gs_lock_04_30);
+#endif
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify the per-test timeouts, and
+ *    the watchdog that enforces them in-process.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   30. unit_test_load_timeout().
+ *
+ * \test
+ *    -  unit_test_load_timeout()
+ *    -  unit_test_test_timeout()
+ *    -  unit_test_watchdog_arm()
+ *    -  unit_test_watchdog_disarm()
+ *    -  xpccut_watchdog_arm()
+ *    -  xpccut_watchdog_disarm()
+ *    -  xpccut_watchdog_step()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_30 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 30, "unit_test_t", "unit_test_load_timeout()"
+   );
+   if (ok)
+   {
+      char * argv[FULL_ARG_COUNT + 1];
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--test-timeout";
+      argv[3] = "5000";
+      argv[4] = "--jobs";
+      argv[5] = "2";
+      argv[6] = "--isolate";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Bad parameters"))
+      {
+         unit_test_t x_test_x;
+         cbool_t null_ok = unit_test_init(&x_test_x);
+         if (null_ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error messages   */
+            null_ok = ! unit_test_load_timeout(nullptr, 10);
+            if (null_ok)
+               null_ok = ! unit_test_load_timeout(&x_test_x, 10); /* empty   */
+
+            if (null_ok)
+               null_ok = unit_test_load(&x_test_x, fake_prompt_unit_test_04_30);
+
+            if (null_ok)
+               null_ok = ! unit_test_load_timeout(&x_test_x, -1);
+
+            if (null_ok)
+            {
+               null_ok = ! unit_test_load_timeout
+               (
+                  &x_test_x, XPCCUT_TIMEOUT_MAX + 1
+               );
+            }
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         if (null_ok)
+            null_ok = unit_test_test_timeout(nullptr, 0) == 0;
+
+         if (null_ok)
+            null_ok = unit_test_test_timeout(&x_test_x, 1) == 0;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Timeout of a test"))
+      {
+         unit_test_t x_test_x;
+         ok = unit_test_initialize
+         (
+            &x_test_x, 4, argv, "Test 04.30.2", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_prompt_unit_test_04_30);
+
+         if (ok)
+            ok = unit_test_test_timeout(&x_test_x, 0) == 5000;
+
+         if (ok)
+            ok = unit_test_load_timeout(&x_test_x, 50);
+
+         if (ok)
+            ok = unit_test_test_timeout(&x_test_x, 0) == 50;
+
+         if (ok)
+            ok = unit_test_load_timeout(&x_test_x, 0);
+
+         if (ok)
+            ok = unit_test_test_timeout(&x_test_x, 0) == 5000;
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Sequence trace"))
+      {
+         xpccut_watch_t watch;
+         xpccut_watchdog_arm(&watch, 0, 0, nullptr, nullptr);
+         xpccut_watchdog_step(1, "not watched");
+         ok = watch.m_Steps == 0;
+         if (ok)
+            ok = ! xpccut_watchdog_disarm(&watch);
+
+         if (ok && xpccut_watchdog_is_available())
+         {
+            int s;
+            xpccut_watchdog_arm(&watch, 10000, 0, "group", "case");
+            for (s = 1; s <= XPCCUT_WATCH_TRACE + 2; ++s)
+               xpccut_watchdog_step(s, "step");
+
+            ok = ! xpccut_watchdog_disarm(&watch);
+            xpccut_watchdog_step(99, "after");
+            if (ok)
+               ok = watch.m_Steps == XPCCUT_WATCH_TRACE + 2;
+
+            if (ok)
+            {
+               const xpccut_watch_step_t * last = &watch.m_Trace
+               [
+                  (XPCCUT_WATCH_TRACE + 1) % XPCCUT_WATCH_TRACE
+               ];
+               ok = last->m_Subtest == XPCCUT_WATCH_TRACE + 2;
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Late test fails"))
+      {
+         if (xpccut_watchdog_is_available())
+            ok = run_unit_test_04_30(4, argv) == 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Late test fails, --jobs"))
+      {
+         if (xpccut_watchdog_is_available())
+            ok = run_unit_test_04_30(6, argv) == 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Late child is killed"))
+      {
+         if (xpccut_watchdog_is_available())    /* else nothing watches    */
+            ok = run_unit_test_04_30(7, argv) == 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Records the case numbers of the fake tests of unit_unit_test_04_31(),
+ *    in the order in which they ran.  Each run of unit_unit_test_04_31(),
+ *    unit_unit_test_04_32(), and unit_unit_test_04_33() has its own.
+ */
+
+typedef struct
+{
+   int m_Order[8];                  /**< The case numbers, in order.          */
+   int m_Count;                     /**< The number of entries in m_Order[].  */
+
+} fake_order_04_31_t;
+
+/**
+ *    Points to the record of the test whose nested run the calling thread
+ *    is making.  The fake tests record their case numbers only in a run
+ *    without --jobs, and such a run calls them in the thread of the test
+ *    that made it, so the runs of these tests in a --jobs pool, even of
+ *    the same test in overlapping --repeat rounds, keep out of each
+ *    other's way.
+ */
+
+static XPCCUT_THREAD_LOCAL fake_order_04_31_t * gs_order_04_31 = nullptr;
+
+/**
+ *    Provides the code shared by the fake tests of unit_unit_test_04_31().
+ *    Each test records its case number, unless the tests run in a pool,
+ *    and then passes or fails.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_common_unit_test_04_31
+(
+   const unit_test_options_t * options,
+   int testcase,
+   cbool_t passes
+)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, testcase, "ordered", "fake"
+   );
+   if (ok)
+   {
+      fake_order_04_31_t * order = gs_order_04_31;
+      if (unit_test_options_job_count(options) == 1 && cut_not_nullptr(order))
+      {
+         if (order->m_Count < 8)
+            order->m_Order[order->m_Count++] = testcase;
+      }
+      if (unit_test_status_next_subtest(&status, "Ordered test"))
+         unit_test_status_pass(&status, passes);
+   }
+   return status;
+}
+
+/**
+ *    Provides the first fake test for unit_unit_test_04_31().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_first_unit_test_04_31 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_31(options, 1, true);
+}
+
+/**
+ *    Provides the second fake test for unit_unit_test_04_31().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_second_unit_test_04_31 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_31(options, 2, true);
+}
+
+/**
+ *    Provides the third fake test for unit_unit_test_04_31().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_third_unit_test_04_31 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_31(options, 3, true);
+}
+
+/**
+ *    Provides the second fake test for unit_unit_test_04_31(), as one that
+ *    fails.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_second_fails_unit_test_04_31 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_31(options, 2, false);
+}
+
+/**
+ *    Provides the third fake test for unit_unit_test_04_31(), as one that
+ *    fails.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_third_fails_unit_test_04_31 (const unit_test_options_t * options)
+{
+   return fake_common_unit_test_04_31(options, 3, false);
+}
+
+/**
+ *    Registers the three fake tests of unit_unit_test_04_31() in group 98.
+ *    A fake test that fails is put in place of the case \a failcase, which
+ *    can be 2, 3, or 0 for none.  Unlike a flag that the fake tests would
+ *    read, this works when the tests run in the threads of a pool.
+ *
+ * \return
+ *    Returns 'true' if the tests were registered.
+ */
+
+static cbool_t
+load_fakes_unit_test_04_31
+(
+   unit_test_t * tests,             /**< The tests to load.                   */
+   const char * groupname,          /**< The name of the group of the tests.  */
+   int failcase                     /**< The case that fails, or 0.           */
+)
+{
+   cbool_t result = unit_test_register
+   (
+      tests, fake_first_unit_test_04_31, 98, 1, groupname, "first"
+   );
+   if (result)
+   {
+      result = unit_test_register
+      (
+         tests, failcase == 2 ? fake_second_fails_unit_test_04_31 :
+            fake_second_unit_test_04_31, 98, 2, groupname, "second"
+      );
+   }
+   if (result)
+   {
+      result = unit_test_register
+      (
+         tests, failcase == 3 ? fake_third_fails_unit_test_04_31 :
+            fake_third_unit_test_04_31, 98, 3, groupname, "third"
+      );
+   }
+   return result;
+}
+
+/**
+ *    Writes the history file for unit_unit_test_04_31().  The second test
+ *    failed, and the third is the fastest.
+ *
+ * \return
+ *    Returns 'true' if the file could be written.
+ */
+
+static cbool_t
+write_history_unit_test_04_31 (const char * filename)
+{
+   FILE * f = fopen(filename, "w");
+   cbool_t result = cut_not_nullptr(f);
+   if (result)
+   {
+      fprintf(f, "# Test 04.31: test group case failed duration_ms\n");
+      fprintf(f, "1 98 1 0 5.0\n");
+      fprintf(f, "2 98 2 1 1.0\n");
+      fprintf(f, "3 98 3 0 0.5\n");
+      fclose(f);
+   }
+   return result;
+}
+
+/**
+ *    Runs the fake tests of unit_unit_test_04_31() with the given options,
+ *    which follow "--no-show-progress".
+ *
+ * \return
+ *    Returns the number of tests that ran, or -1 if the tests could not be
+ *    set up.  The first failed test, if any, goes to \a firstfailed.
+ */
+
+static int
+run_order_unit_test_04_31
+(
+   int argc,                        /**< The number of extra options.         */
+   char * extra [],                 /**< The extra options.                   */
+   int failcase,                    /**< The fake test that fails, or 0.      */
+   fake_order_04_31_t * order,      /**< Receives the order of the tests.     */
+   int * firstfailed                /**< Receives the first failed test.      */
+)
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   char * argv[FULL_ARG_COUNT + 1];
+   int i;
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   for (i = 0; i < argc; ++i)
+      argv[i + 2] = extra[i];
+
+   order->m_Count = 0;
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc + 2, argv, "Test 04.31", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = load_fakes_unit_test_04_31(&x_test_x, "ordered", failcase);
+      if (ok)
+      {
+         fake_order_04_31_t * outer = gs_order_04_31;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the failures        */
+         gs_order_04_31 = order;
+         (void) unit_test_run(&x_test_x);
+         gs_order_04_31 = outer;
+         if (! silent)
+            xpccut_allow_printing();
+
+         result = unit_test_run_count(&x_test_x);
+         *firstfailed = unit_test_first_failed_test(&x_test_x);
+      }
+   }
+   unit_test_destroy(&x_test_x);
+   return result;
+}
+
+/**
+ *    Checks the case numbers recorded by the fake tests of
+ *    unit_unit_test_04_31().
+ *
+ * \return
+ *    Returns 'true' if the tests ran in the order given.
+ */
+
+static cbool_t
+check_order_unit_test_04_31
+(
+   const fake_order_04_31_t * order,
+   int first,
+   int second,
+   int third
+)
+{
+   return
+      order->m_Count == 3 && order->m_Order[0] == first &&
+      order->m_Order[1] == second && order->m_Order[2] == third;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    follows the --order option, using the --history file, and keeps that
+ *    file up to date.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   31. Running with the --history and --order options.
+ *
+ * \test
+ *    -  unit_test_run() [with --order]
+ *    -  unit_test_next_test()
+ *    -  unit_test_setup_order() [indirect test of static function]
+ *    -  unit_test_read_history() [indirect test of static function]
+ *    -  unit_test_sort_tests() [indirect test of static function]
+ *    -  unit_test_save_history() [indirect test of static function]
+ *    -  unit_test_scheduled_test() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_31 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 31, "unit_test_t", "unit_test_run() ordered"
+   );
+   if (ok)
+   {
+      char history[TEST_FILE_NAME_SIZE];
+      char * extra[8];
+      fake_order_04_31_t order;
+      int failcase = 0;
+      int failed = -1;
+      extra[0] = "--history";
+      extra[1] = test_file_name(history, "unit_test_04_31", ".hist");
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Load order with a history"))
+      {
+         ok = write_history_unit_test_04_31(history);
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               2, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         if (ok)
+            ok = check_order_unit_test_04_31(&order, 1, 2, 3) && failed == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Failed first, stop on error"))
+      {
+         extra[2] = "--order=failed-first";
+         extra[3] = "--stop-on-error";
+         failcase = 2;
+         if (ok)
+            ok = write_history_unit_test_04_31(history);
+
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               4, extra, failcase, &order, &failed
+            ) == 1;
+         }
+         if (ok)                                /* load-order number kept   */
+            ok = order.m_Count == 1 && failed == 1;
+
+         failcase = 0;
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               3, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         if (ok)
+            ok = check_order_unit_test_04_31(&order, 2, 1, 3);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "History written back"))
+      {
+         FILE * f = fopen(history, "r");
+         ok = cut_not_nullptr(f);
+         if (ok)
+         {
+            char line[XPCCUT_STRLEN];
+            int count = 0;
+            int failures = 0;
+            while (cut_not_nullptr(fgets(line, (int) sizeof line, f)))
+            {
+               int n, g, c, fail;
+               double ms;
+               if (line[0] == '#')
+                  continue;
+
+               if
+               (
+                  sscanf(line, "%d %d %d %d %lf", &n, &g, &c, &fail, &ms) == 5
+               )
+               {
+                  if (n == c && g == 98 && ms >= 0.0)
+                     ++count;
+
+                  failures += fail;
+               }
+            }
+            fclose(f);
+            ok = count == 3 && failures == 0;   /* the last run passed      */
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Fastest first"))
+      {
+         extra[2] = "--order";
+         extra[3] = "fastest-first";
+         if (ok)
+            ok = write_history_unit_test_04_31(history);
+
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               4, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         if (ok)
+            ok = check_order_unit_test_04_31(&order, 3, 2, 1);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Order without a history"))
+      {
+         extra[0] = "--order";
+         extra[1] = "fastest-first";
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               2, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         if (ok)
+            ok = check_order_unit_test_04_31(&order, 1, 2, 3);
+
+         extra[0] = "--history";
+         extra[1] = history;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Longest first in a pool"))
+      {
+         extra[2] = "--jobs";
+         extra[3] = "2";
+         if (ok)
+            ok = write_history_unit_test_04_31(history);
+
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               4, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         if (ok)
+            ok = failed == 0;
+
+         extra[4] = "--order";
+         extra[5] = "failed-first";
+         if (ok)
+         {
+            ok = run_order_unit_test_04_31
+            (
+               6, extra, failcase, &order, &failed
+            ) == 3;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+      (void) remove(history);
+   }
+   return status;
+}
+
+/**
+ *    Runs the fake tests of unit_unit_test_04_31() with the given options,
+ *    which follow "--no-show-progress", for unit_unit_test_04_32().
+ *
+ * \return
+ *    Returns the number of tests that ran, or -1 if the tests could not be
+ *    set up.  The number of cached passes goes to \a cached.
+ */
+
+static int
+run_cache_unit_test_04_32
+(
+   int argc,                        /**< The number of extra options.         */
+   char * extra [],                 /**< The extra options.                   */
+   int failcase,                    /**< The fake test that fails, or 0.      */
+   fake_order_04_31_t * order,      /**< Receives the order of the tests.     */
+   int * cached                     /**< Receives the cached-pass count.      */
+)
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   char * argv[FULL_ARG_COUNT + 1];
+   int i;
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   for (i = 0; i < argc; ++i)
+      argv[i + 2] = extra[i];
+
+   order->m_Count = 0;
+   *cached = -1;
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc + 2, argv, "Test 04.32", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = load_fakes_unit_test_04_31(&x_test_x, "cached", failcase);
+      if (ok)
+      {
+         fake_order_04_31_t * outer = gs_order_04_31;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the failures        */
+         gs_order_04_31 = order;
+         (void) unit_test_run(&x_test_x);
+         gs_order_04_31 = outer;
+         if (! silent)
+            xpccut_allow_printing();
+
+         result = unit_test_run_count(&x_test_x);
+         *cached = unit_test_cached_count(&x_test_x);
+      }
+   }
+   unit_test_destroy(&x_test_x);
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    reports the tests that passed under the same --cache-file key as
+ *    cached passes, without running them.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   32. Running with the --cache-file option.
+ *
+ * \test
+ *    -  unit_test_run() [with --cache-file]
+ *    -  unit_test_skip_a_test()
+ *    -  unit_test_cached_count()
+ *    -  unit_test_setup_cache() [indirect test of static function]
+ *    -  unit_test_cache_content() [indirect test of static function]
+ *    -  unit_test_read_cache() [indirect test of static function]
+ *    -  unit_test_save_cache() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_32 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 32, "unit_test_t", "unit_test_run() cached"
+   );
+   if (ok)
+   {
+      char cachefile[TEST_FILE_NAME_SIZE];
+      char * extra[8];
+      fake_order_04_31_t order;
+      int failcase = 0;
+      int cached = -1;
+      extra[0] = "--cache-file";
+      extra[1] = test_file_name(cachefile, "unit_test_04_32", ".cache");
+      extra[2] = "--cache-key";
+      extra[3] = "key-1";
+      (void) remove(cachefile);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "First run fills the cache"))
+      {
+         ok = run_cache_unit_test_04_32
+         (
+            4, extra, failcase, &order, &cached
+         ) == 3;
+         if (ok)
+            ok = cached == 0 && order.m_Count == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Second run is cached"))
+      {
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               4, extra, failcase, &order, &cached
+            ) == 0;
+         }
+         if (ok)
+            ok = cached == 3 && order.m_Count == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "New key, failure not cached"))
+      {
+         extra[3] = "key-2";
+         failcase = 2;
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               4, extra, failcase, &order, &cached
+            ) == 3;
+         }
+         if (ok)
+            ok = cached == 0;
+
+         failcase = 0;
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               4, extra, failcase, &order, &cached
+            ) == 1;
+         }
+         if (ok)
+         {
+            ok = cached == 2 && order.m_Count == 1 &&
+               order.m_Order[0] == 2;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "No cache, then cached"))
+      {
+         extra[4] = "--no-cache";
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               5, extra, failcase, &order, &cached
+            ) == 3;
+         }
+         if (ok)
+            ok = cached == 0;
+
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               4, extra, failcase, &order, &cached
+            ) == 0;
+         }
+         if (ok)
+            ok = cached == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Force failure ignores cache"))
+      {
+         cbool_t silent = xpccut_is_silent();  /* --force-failure silences */
+         extra[4] = "--force-failure";
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               5, extra, failcase, &order, &cached
+            ) == 3;
+         }
+         if (! silent)
+            xpccut_allow_printing();
+
+         if (ok)
+            ok = cached == 0;
+
+         if (ok)                                /* file left as it was      */
+            ok = run_cache_unit_test_04_32
+            (
+               4, extra, failcase, &order, &cached
+            ) == 0;
+
+         if (ok)
+            ok = cached == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Cached in a pool"))
+      {
+         extra[4] = "--jobs";
+         extra[5] = "2";
+         if (ok)
+         {
+            ok = run_cache_unit_test_04_32
+            (
+               6, extra, failcase, &order, &cached
+            ) == 0;
+         }
+         if (ok)
+            ok = cached == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "Key from the application"))
+      {
+         FILE * f = fopen("/proc/self/exe", "rb");
+         if (cut_not_nullptr(f))
+         {
+            fclose(f);
+            if (ok)
+            {
+               ok = run_cache_unit_test_04_32
+               (
+                  2, extra, failcase, &order, &cached
+               ) == 3;
+            }
+            if (ok)
+               ok = cached == 0;
+
+            if (ok)
+            {
+               ok = run_cache_unit_test_04_32
+               (
+                  2, extra, failcase, &order, &cached
+               ) == 0;
+            }
+            if (ok)
+               ok = cached == 3;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+      (void) remove(cachefile);
+   }
+   return status;
+}
+
+/**
+ *    Runs the fake tests of unit_unit_test_04_31() with the given options,
+ *    which follow "--no-show-progress", for unit_unit_test_04_33().
+ *
+ * \return
+ *    Returns the number of tests that ran, or -1 if the tests could not be
+ *    set up.  The number of failed runs goes to \a failures.
+ */
+
+static int
+run_repeat_unit_test_04_33
+(
+   int argc,                        /**< The number of extra options.         */
+   char * extra [],                 /**< The extra options.                   */
+   int failcase,                    /**< The fake test that fails, or 0.      */
+   fake_order_04_31_t * order,      /**< Receives the order of the tests.     */
+   int * failures                   /**< Receives the failed-run count.       */
+)
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   char * argv[FULL_ARG_COUNT + 1];
+   int i;
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   for (i = 0; i < argc; ++i)
+      argv[i + 2] = extra[i];
+
+   order->m_Count = 0;
+   *failures = -1;
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc + 2, argv, "Test 04.33", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = load_fakes_unit_test_04_31(&x_test_x, "repeated", failcase);
+      if (ok)
+      {
+         fake_order_04_31_t * outer = gs_order_04_31;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the failures        */
+         gs_order_04_31 = order;
+         (void) unit_test_run(&x_test_x);
+         gs_order_04_31 = outer;
+         if (! silent)
+            xpccut_allow_printing();
+
+         result = unit_test_run_count(&x_test_x);
+         *failures = unit_test_failures(&x_test_x);
+      }
+   }
+   unit_test_destroy(&x_test_x);
+   return result;
+}
+
+/**
+ *    Checks that each round recorded by the fake tests of
+ *    unit_unit_test_04_31() ran each of the three tests once.
+ *
+ * \return
+ *    Returns 'true' if the first \a rounds rounds are in \a record.
+ */
+
+static cbool_t
+check_rounds_unit_test_04_33 (const fake_order_04_31_t * record, int rounds)
+{
+   cbool_t result = record->m_Count >= rounds * 3;
+   int r;
+   for (r = 0; r < rounds && result; ++r)
+   {
+      const int * order = &record->m_Order[r * 3];
+      result = order[0] + order[1] + order[2] == 6 &&
+         order[0] != order[1] && order[1] != order[2] && order[0] != order[2];
+   }
+   return result;
+}
+
+/**
+ *    Provides a fake test for unit_unit_test_04_33() that makes a nested
+ *    run of the fake tests of unit_unit_test_04_31(), which writes a
+ *    report file of its own.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_nested_unit_test_04_33 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 97, 1, "nested", "report"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Nested run"))
+      {
+         char report[TEST_FILE_NAME_SIZE];
+         char * extra[4];
+         fake_order_04_31_t order;
+         int failures = -1;
+         extra[0] = "--report-format";
+         extra[1] = "jsonl";
+         extra[2] = "--report-file";
+         extra[3] = test_file_name(report, "unit_test_04_33", ".jsonl");
+         ok = run_repeat_unit_test_04_33
+         (
+            4, extra, 0, &order, &failures
+         ) == 3;
+         if (ok)
+            ok = failures == 0;
+
+         (void) remove(report);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Runs fake_nested_unit_test_04_33(), and then the first fake test of
+ *    unit_unit_test_04_31(), writing a JUnit report, for
+ *    unit_unit_test_04_33().
+ *
+ * \return
+ *    Returns 'true' if the report holds the records of both tests, and
+ *    is finished, so that the nested run left the report file alone.
+ */
+
+static cbool_t
+run_nested_unit_test_04_33 (void)
+{
+   cbool_t result = false;
+   char report[TEST_FILE_NAME_SIZE];
+   unit_test_t x_test_x;
+   char * argv[6];
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   argv[2] = "--report-format";
+   argv[3] = "junit";
+   argv[4] = "--report-file";
+   argv[5] = test_file_name(report, "unit_test_04_33", ".xml");
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, 6, argv, "Test 04.33", "version", "additionalhelp"
+      )
+   )
+   {
+      result = unit_test_register
+      (
+         &x_test_x, fake_nested_unit_test_04_33, 97, 1, "nested", "report"
+      );
+      if (result)
+      {
+         result = unit_test_register
+         (
+            &x_test_x, fake_first_unit_test_04_31, 98, 1, "after", "first"
+         );
+      }
+      if (result)
+      {
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();
+         result = unit_test_run(&x_test_x);
+         if (! silent)
+            xpccut_allow_printing();
+      }
+   }
+   unit_test_destroy(&x_test_x);                /* closes the report        */
+   if (result)
+   {
+      FILE * f = fopen(report, "r");
+      result = cut_not_nullptr(f);
+      if (result)
+      {
+         char text[4 * XPCCUT_STRLEN * 4];
+         size_t count = fread(text, 1, sizeof text - 1, f);
+         const char * ending = "</testsuite>\n</testsuites>\n";
+         size_t length = strlen(ending);
+         text[count] = 0;
+         fclose(f);
+         result = count > length &&
+            strcmp(&text[count - length], ending) == 0;
+
+         if (result)
+            result = cut_not_nullptr(strstr(text, "\"97.01.01 report:"));
+
+         if (result)
+            result = cut_not_nullptr(strstr(text, "\"98.01.01 fake:"));
+
+         if (result)                         /* no records of the nested run */
+            result = cut_is_nullptr(strstr(text, "\"group\""));
+      }
+   }
+   (void) remove(report);
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the "run" functionality
+ *    runs the tests in rounds for the --repeat and --until-fail options,
+ *    shuffles each round for the --shuffle option, and reports the runs of
+ *    each test.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   33. Running with the --repeat, --until-fail, and --shuffle options.
+ *
+ * \test
+ *    -  unit_test_run() [with --repeat]
+ *    -  unit_test_next_test()
+ *    -  unit_test_run_jobs()
+ *    -  xpccut_report_repeats()
+ *    -  unit_test_setup_rounds() [indirect test of static function]
+ *    -  unit_test_prepare_rounds() [indirect test of static function]
+ *    -  unit_test_round_slot() [indirect test of static function]
+ *    -  unit_test_show_repeats() [indirect test of static function]
+ *    -  unit_test_open_report() [indirect test of static function]
+ *    -  unit_test_close_report() [indirect test of static function]
+ *    -  xpccut_output_get_report_file()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_33 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 33, "unit_test_t", "unit_test_run() repeated"
+   );
+   if (ok)
+   {
+      char report[TEST_FILE_NAME_SIZE];
+      char * extra[8];
+      fake_order_04_31_t order;
+      int failcase = 0;
+      int failures = -1;
+      extra[0] = "--repeat";
+      extra[1] = "3";
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Three rounds"))
+      {
+         ok = run_repeat_unit_test_04_33
+         (
+            2, extra, failcase, &order, &failures
+         ) == 9;
+         if (ok)
+            ok = failures == 0 && order.m_Count == 8;
+
+         if (ok)
+         {
+            ok = order.m_Order[0] == 1 && order.m_Order[3] == 1 &&
+               order.m_Order[4] == 2 && order.m_Order[7] == 2;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "A failure in each round"))
+      {
+         failcase = 2;
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               2, extra, failcase, &order, &failures
+            ) == 9;
+         }
+         if (ok)
+            ok = failures == 3;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Until a failure"))
+      {
+         extra[0] = "--until-fail";
+         if (ok)                                /* the round is finished    */
+            ok = run_repeat_unit_test_04_33
+            (
+               1, extra, failcase, &order, &failures
+            ) == 3;
+
+         if (ok)
+            ok = failures == 1 && order.m_Count == 3;
+
+         failcase = 0;
+         extra[1] = "--repeat";
+         extra[2] = "2";
+         if (ok)                                /* no failure, so 2 rounds  */
+            ok = run_repeat_unit_test_04_33
+            (
+               3, extra, failcase, &order, &failures
+            ) == 6;
+
+         if (ok)
+            ok = failures == 0;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Shuffled rounds repeat"))
+      {
+         int first[6];
+         int i;
+         extra[0] = "--shuffle-seed";
+         extra[1] = "1234";
+         extra[2] = "--repeat";
+         extra[3] = "2";
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               4, extra, failcase, &order, &failures
+            ) == 6;
+         }
+         if (ok)
+            ok = check_rounds_unit_test_04_33(&order, 2);
+
+         for (i = 0; i < 6; ++i)
+            first[i] = order.m_Order[i];
+
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               4, extra, failcase, &order, &failures
+            ) == 6;
+         }
+         for (i = 0; ok && i < 6; ++i)
+            ok = order.m_Order[i] == first[i];
+
+         extra[1] = "1235";                     /* the second round alone   */
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               2, extra, failcase, &order, &failures
+            ) == 3;
+         }
+         for (i = 0; ok && i < 3; ++i)
+            ok = order.m_Order[i] == first[i + 3];
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Repeated in a pool"))
+      {
+         extra[0] = "--repeat";
+         extra[1] = "4";
+         extra[2] = "--jobs";
+         extra[3] = "3";
+         failcase = 3;
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               4, extra, failcase, &order, &failures
+            ) == 12;
+         }
+         if (ok)
+            ok = failures == 4;
+
+         extra[4] = "--shuffle";
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               5, extra, failcase, &order, &failures
+            ) == 12;
+         }
+         if (ok)
+            ok = failures == 4;
+
+         extra[4] = "--isolate";
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               5, extra, failcase, &order, &failures
+            ) == 12;
+         }
+         if (ok)
+            ok = failures == 4;
+
+         failcase = 0;
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Runs in the report"))
+      {
+         extra[0] = "--repeat";
+         extra[1] = "2";
+         extra[2] = "--report-format";
+         extra[3] = "jsonl";
+         extra[4] = "--report-file";
+         extra[5] = test_file_name(report, "unit_test_04_33", ".jsonl");
+         if (ok)
+         {
+            ok = run_repeat_unit_test_04_33
+            (
+               6, extra, failcase, &order, &failures
+            ) == 6;
+         }
+         if (ok && unit_test_options_job_count(options) == 1)
+         {
+            /*
+             * A --jobs worker captures the report along with its output, so
+             * the file is only checked when this test runs by itself.
+             */
+
+            FILE * f = fopen(report, "r");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               char line[4 * XPCCUT_STRLEN];      /* a whole record       */
+               int records = 0;
+               int summaries = 0;
+               while (cut_not_nullptr(fgets(line, sizeof line, f)))
+               {
+                  ++records;
+                  if (cut_not_nullptr(strstr(line, "\"runs\":2,")))
+                     ++summaries;
+               }
+               fclose(f);
+               ok = records == 9 && summaries == 3;
+            }
+         }
+         (void) remove(report);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "Nested run in the report"))
+      {
+         /*
+          * As above, a --jobs worker captures the report, so the report
+          * file of the outer run is only checked by itself.
+          */
+
+         if (ok && unit_test_options_job_count(options) == 1)
+            ok = run_nested_unit_test_04_33();
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides the number of rows in the table of unit_unit_test_04_34().
+ */
+
+#define SPREAD_ROW_COUNT         10
+
+/**
+ *    Holds a bit for each record of the table that the fake test of
+ *    unit_unit_test_04_34() has walked.  The nested runs have no --jobs
+ *    workers, so the fake test runs in the thread of the test.
+ */
+
+static XPCCUT_THREAD_LOCAL unsigned gs_records_04_34 = 0;
+
+/**
+ *    Counts the records walked by the fake test of unit_unit_test_04_34().
+ */
+
+static XPCCUT_THREAD_LOCAL int gs_record_count_04_34 = 0;
+
+/**
+ *    Provides a fake data-driven test for unit_unit_test_04_34(), which
+ *    walks a table of SPREAD_ROW_COUNT rows, and notes the records it gets.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_walk_unit_test_04_34 (const unit_test_options_t * options)
+{
+   static const char * const s_rows[SPREAD_ROW_COUNT] =
+   {
+      "0", "1", "2", "3", "4", "5", "6", "7", "8", "9"
+   };
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 35, "spread", "walk"
+   );
+   if (ok)
+   {
+      xpccut_table_t table;
+      ok = xpccut_table_init_rows(&table, "digits", s_rows, SPREAD_ROW_COUNT);
+      if (ok)
+      {
+         xpccut_record_t record = XPCCUT_RECORD_INIT;
+         while (unit_test_status_next_record(&status, &table, &record))
+         {
+            long value = -1;
+            ok = xpccut_record_long(&record, &value);
+            if (ok)
+               ok = value == record.m_Number - 1;
+
+            gs_records_04_34 |= 1U << (record.m_Number - 1);
+            ++gs_record_count_04_34;
+            unit_test_status_pass(&status, ok);
+         }
+         xpccut_table_close(&table);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Runs the fake tests for unit_unit_test_04_34(): the walk test, marked
+ *    with unit_test_load_spread(), and the two tests of
+ *    unit_unit_test_04_27(), in one shard of \a shards.
+ *
+ * \param shards
+ *    The number of shards.
+ *
+ * \param shardindex
+ *    The shard to run.
+ *
+ * \param [out] calls
+ *    Receives the number of calls to the tests of unit_unit_test_04_27().
+ *
+ * \return
+ *    Returns the number of tests that ran, or -1 if the run failed.
+ */
+
+static int
+run_spread_unit_test_04_34 (int shards, int shardindex, int * calls)
+{
+   int result = -1;
+   unit_test_t x_test_x;
+   char count[8];
+   char index[12];
+   char * argv[FULL_ARG_COUNT + 1];
+   int argc = 6;
+   argv[0] = "unit_test_test";
+   argv[1] = "--no-show-progress";
+   argv[2] = "--shard-count";
+   argv[3] = count;
+   argv[4] = "--shard-index";
+   argv[5] = index;
+   (void) sprintf(count, "%d", shards);
+   (void) snprintf(index, sizeof index, "%d", shardindex);
+#if USE_CALLS_LOCK_04_27
+   pthread_mutex_lock(&gs_lock_04_27);
+#endif
+   gs_calls_04_27 = 0;
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.34", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = unit_test_load(&x_test_x, fake_walk_unit_test_04_34);
+      if (ok)
+         ok = unit_test_load_spread(&x_test_x);
+
+      if (ok)
+         ok = unit_test_load(&x_test_x, fake_first_unit_test_04_27);
+
+      if (ok)
+         ok = unit_test_load(&x_test_x, fake_second_unit_test_04_27);
+
+      if (ok)
+      {
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the SHARD summary   */
+         ok = unit_test_run(&x_test_x);
+         if (! silent)
+            xpccut_allow_printing();
+      }
+      if (ok)
+         result = unit_test_run_count(&x_test_x);
+   }
+   unit_test_destroy(&x_test_x);
+   *calls = gs_calls_04_27;
+#if USE_CALLS_LOCK_04_27
+   pthread_mutex_unlock(&gs_lock_04_27);
+#endif
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that the records of a
+ *    data-driven test marked by unit_test_load_spread() are split among
+ *    the shards, while the test itself runs in every shard.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   34. Spreading the records of a table among the shards.
+ *
+ * \test
+ *    -  unit_test_load_spread()
+ *    -  unit_test_options_record_in_shard()
+ *    -  unit_test_status_next_record() [with --shard-count]
+ *    -  unit_test_spread_shards() [indirect test of static function]
+ *    -  unit_test_options_is_spread() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_34 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 34, "unit_test_t", "unit_test_load_spread()"
+   );
+   if (ok)
+   {
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         unit_test_t x_test_x;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         ok = ! unit_test_load_spread(nullptr);
+         if (ok)
+         {
+            char * argv[2];
+            argv[0] = "unit_test_test";
+            argv[1] = "--no-show-progress";
+            ok = unit_test_initialize
+            (
+               &x_test_x, 2, argv, "Test 04.34.1", "version", "additionalhelp"
+            );
+            if (ok)
+               ok = ! unit_test_load_spread(&x_test_x);   /* nothing loaded */
+
+            unit_test_destroy(&x_test_x);
+         }
+         if (! silent)
+            xpccut_allow_printing();
+
+         if (ok)
+            ok = unit_test_options_record_in_shard(options, 2);
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "One shard"))
+      {
+         int calls = -1;
+         gs_records_04_34 = 0;
+         gs_record_count_04_34 = 0;
+         if (ok)
+            ok = run_spread_unit_test_04_34(1, 0, &calls) == 3;
+
+         if (ok)
+            ok = gs_record_count_04_34 == SPREAD_ROW_COUNT;
+
+         if (ok)
+            ok = gs_records_04_34 == (1U << SPREAD_ROW_COUNT) - 1;
+
+         if (ok)
+            ok = calls == 2;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Records in every shard"))
+      {
+         int shard;
+         int calls = -1;
+         gs_records_04_34 = 0;
+         gs_record_count_04_34 = 0;
+         for (shard = 0; ok && shard < 3; ++shard)
+         {
+            unsigned before = gs_records_04_34;
+            int count = gs_record_count_04_34;
+            unsigned r;
+            int tests = shard == 0 ? 1 : 2 ;     /* the walk test, and one */
+            ok = run_spread_unit_test_04_34(3, shard, &calls) == tests;
+            for (r = 0; ok && r < SPREAD_ROW_COUNT; ++r)
+            {
+               cbool_t walked = ((gs_records_04_34 & ~before) >> r) & 1U;
+               ok = walked == ((r % 3) == (unsigned) shard);
+            }
+            if (ok)
+               ok = gs_record_count_04_34 - count == (shard == 0 ? 4 : 3) ;
+         }
+         if (ok)
+            ok = gs_records_04_34 == (1U << SPREAD_ROW_COUNT) - 1;
+
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides the number of fake tests that unit_unit_test_04_35() loads.
+ *    The tests at index 2 and index 5 are marked serial.
+ */
+
+#define SERIAL_TEST_COUNT        8
+
+/**
+ *    Indicates that the fake tests of unit_unit_test_04_35() count each
+ *    other under a lock, since they run in the --jobs workers of the
+ *    nested run.
+ */
+
+#define USE_SERIAL_LOCK_04_35  USE_STOPWATCH_THREADS
+
+#if USE_SERIAL_LOCK_04_35
+
+/**
+ *    Protects the counts of the fake tests of unit_unit_test_04_35().
+ */
+
+static pthread_mutex_t gs_lock_04_35 = PTHREAD_MUTEX_INITIALIZER;
+
+#endif
+
+/**
+ *    Counts the fake tests of unit_unit_test_04_35() that are running.
+ */
+
+static int gs_running_04_35 = 0;
+
+/**
+ *    Indicates that a serial fake test of unit_unit_test_04_35() is
+ *    running.
+ */
+
+static cbool_t gs_serial_running_04_35 = false;
+
+/**
+ *    Counts the times that a fake test of unit_unit_test_04_35() found
+ *    another test running beside a serial one.
+ */
+
+static int gs_overlaps_04_35 = 0;
+
+/**
+ *    Provides the code shared by the fake tests of unit_unit_test_04_35().
+ *    The test notes that it is running, spins for a millisecond so that
+ *    the tests of other workers have a chance to overlap it, and checks
+ *    that no test ran beside a serial test.
+ *
+ * \param serial
+ *    Indicates that the test was marked by unit_test_load_serial().
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+shared_unit_test_04_35 (const unit_test_options_t * options, cbool_t serial)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 35, "serial", serial ? "alone" : "beside"
+   );
+   if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, "Runs alone if serial"))
+      {
+         xpccut_ticks_t wait;
+#if USE_SERIAL_LOCK_04_35
+         pthread_mutex_lock(&gs_lock_04_35);
+#endif
+         ++gs_running_04_35;
+         if (gs_serial_running_04_35 || (serial && gs_running_04_35 != 1))
+            ++gs_overlaps_04_35;
+
+         if (serial)
+            gs_serial_running_04_35 = true;
+#if USE_SERIAL_LOCK_04_35
+         pthread_mutex_unlock(&gs_lock_04_35);
+#endif
+         wait = xpccut_get_ticks() + XPCCUT_TICKS_PER_MS;
+         while (xpccut_get_ticks() < wait)
+            ;
+
+#if USE_SERIAL_LOCK_04_35
+         pthread_mutex_lock(&gs_lock_04_35);
+#endif
+         if (serial)
+         {
+            if (gs_running_04_35 != 1)
+               ++gs_overlaps_04_35;
+
+            gs_serial_running_04_35 = false;
+         }
+         --gs_running_04_35;
+#if USE_SERIAL_LOCK_04_35
+         pthread_mutex_unlock(&gs_lock_04_35);
+#endif
+         unit_test_status_pass(&status, true);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a fake test for unit_unit_test_04_35() that can run beside
+ *    other tests.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_plain_unit_test_04_35 (const unit_test_options_t * options)
+{
+   return shared_unit_test_04_35(options, false);
+}
+
+/**
+ *    Provides a fake test for unit_unit_test_04_35() that is marked serial.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_serial_unit_test_04_35 (const unit_test_options_t * options)
+{
+   return shared_unit_test_04_35(options, true);
+}
+
+/**
+ *    Runs SERIAL_TEST_COUNT fake tests for unit_unit_test_04_35(), with
+ *    the ones at index 2 and index 5 marked serial.
+ *
+ * \param argc
+ *    The number of arguments in \a argv.
+ *
+ * \param argv
+ *    The options of the run.
+ *
+ * \return
+ *    Returns 'true' if the run passed, and no test ran beside a serial
+ *    test, as far as the tests of this process can tell.
+ */
+
+static cbool_t
+run_serial_unit_test_04_35 (int argc, char * argv [])
+{
+   cbool_t result = false;
+   unit_test_t x_test_x;
+   if
+   (
+      unit_test_initialize
+      (
+         &x_test_x, argc, argv, "Test 04.35", "version", "additionalhelp"
+      )
+   )
+   {
+      cbool_t ok = true;
+      int i;
+      for (i = 0; ok && i < SERIAL_TEST_COUNT; ++i)
+      {
+         if (i == 2 || i == 5)
+         {
+            ok = unit_test_load(&x_test_x, fake_serial_unit_test_04_35);
+            if (ok)
+               ok = unit_test_load_serial(&x_test_x);
+         }
+         else
+            ok = unit_test_load(&x_test_x, fake_plain_unit_test_04_35);
+      }
+      if (ok)
+      {
+         cbool_t silent = xpccut_is_silent();
+         gs_overlaps_04_35 = 0;
+         xpccut_silence_printing();             /* hide the summary         */
+         result = unit_test_run(&x_test_x);
+         if (! silent)
+            xpccut_allow_printing();
+      }
+      if (result)
+         result = gs_overlaps_04_35 == 0;
+   }
+   unit_test_destroy(&x_test_x);
+   return result;
+}
+
+/**
+ *    Provides a unit/regression test to verify that a test marked by
+ *    unit_test_load_serial() runs alone, when the other tests run in the
+ *    --jobs workers or the --isolate children.
+ *
+ * \group
+ *    4. unit_test_t functions.
+ *
+ * \case
+ *   35. Running serial tests alone.
+ *
+ * \test
+ *    -  unit_test_load_serial()
+ *    -  unit_test_test_is_serial()
+ *    -  unit_test_pool_worker() [indirect test of static function]
+ *    -  unit_test_child_must_wait() [indirect test of static function]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_04_35 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 4, 35, "unit_test_t", "unit_test_load_serial()"
+   );
+   if (ok)
+   {
+      char * argv[FULL_ARG_COUNT + 1];
+      argv[0] = "unit_test_test";
+      argv[1] = "--no-show-progress";
+      argv[2] = "--jobs";
+      argv[3] = "4";
+      argv[4] = "--isolate";
+      argv[5] = nullptr;
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         unit_test_t x_test_x;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         ok = ! unit_test_load_serial(nullptr);
+         if (ok)
+            ok = ! unit_test_test_is_serial(nullptr, 0);
+
+         if (ok)
+         {
+            ok = unit_test_initialize
+            (
+               &x_test_x, 2, argv, "Test 04.35.1", "version", "additionalhelp"
+            );
+            if (ok)
+               ok = ! unit_test_load_serial(&x_test_x);   /* nothing loaded */
+
+            if (ok)
+               ok = ! unit_test_test_is_serial(&x_test_x, 0);
+
+            unit_test_destroy(&x_test_x);
+         }
+         if (! silent)
+            xpccut_allow_printing();
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Marked test"))
+      {
+         unit_test_t x_test_x;
+         ok = unit_test_initialize
+         (
+            &x_test_x, 2, argv, "Test 04.35.2", "version", "additionalhelp"
+         );
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_plain_unit_test_04_35);
+
+         if (ok)
+            ok = unit_test_load(&x_test_x, fake_serial_unit_test_04_35);
+
+         if (ok)
+            ok = unit_test_load_serial(&x_test_x);
+
+         if (ok)
+            ok = ! unit_test_test_is_serial(&x_test_x, 0);
+
+         if (ok)
+            ok = unit_test_test_is_serial(&x_test_x, 1);
+
+         if (ok)
+            ok = ! unit_test_test_is_serial(&x_test_x, 2);
+
+         if (ok)
+            ok = ! unit_test_test_is_serial(&x_test_x, -1);
+
+         unit_test_destroy(&x_test_x);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "Alone among workers"))
+      {
+         ok = run_serial_unit_test_04_35(4, argv);      /* --jobs 4         */
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Alone among children"))
+      {
+#if USE_ISOLATE_TESTS
+         ok = run_serial_unit_test_04_35(5, argv);      /* and --isolate    */
+#endif
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    This test demonstrates the simplistic setting up of language support.
+ *
+ * \group
+ *    5. Additional functions.
+ *
+ * \case
+ *    1. Verbosity settings and text-domain support.
+ *
+ * \test
+ *    -  xpccut_text_domain()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_05_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 5, 1, _("xpccut_text_domain()"), _("Smoke Test")
+   );
+   if (ok)
+   {
+      /*  1 */
+
+      cbool_t original_silence_setting = xpccut_is_silent();
+      if (original_silence_setting)
+      {
+         if (unit_test_options_is_verbose(options))
+            xpccut_allow_printing();
+      }
+      if (unit_test_status_next_subtest(&status, "1"))
+      {
+#if ! defined WIN32 && defined USE_GETTEXT
+         ok = xpccut_text_domain();
+         unit_test_status_pass(&status, ok);
+#else
+         /*
+          * xpccut_errprint_func
+          * (
+          *    _(
+          *       "comment out this test if gettext() for Win32 is not "
+          *       "important to you"
+          *     )
+          * );
+          */
+#endif
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*
+       * Now restore the original setting of the silence flag, so that
+       * the output of the unit-test will have the appearance expected
+       * by the dude who ran this test.
+       */
+
+      if (original_silence_setting)
+         xpccut_silence_printing();
+      else
+         xpccut_allow_printing();
+   }
+   return status;
+}
+
+/**
+ *    This test demonstrates the usage of the unit-test prompt facility.  If
+ *    the user answers all the prompts as directed, the test will pass.  This
+ *    means that the user cannot abort this test (grin).
+ *
+ * \group
+ *    5. Additional functions.
+ *
+ * \case
+ *    2. Support for interactive prompting in tests.
+ *
+ * \test
+ *    This unit-test function perforce tests more than one unit from the
+ *    unit-test library (libxpccut):
+ *    -  unit_test_status_initialize()
+ *    -  unit_test_status_pass()
+ *    -  unit_test_status_fail()
+ *    -  unit_test_options_show_values(options) [by user visualization only]
+ *    -  unit_test_status_is_verbose() [by user visualization only]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+/* static */ unit_test_status_t
+unit_unit_test_05_02 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 5, 2, _("XPCCUT Test"), _("Prompts")
+   );
+   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
+      unit_test_status_pass(&status, true);        /* no, force it to pass    */
+   else if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, _("'C' test")))
+      {
+         cbool_t ok = unit_test_status_prompt
+         (
+            &status,
+            _("This sequence of tests runs through the various responses\n"
+            "possible when using the prompting facility of the code-and-\n"
+            "unit test library.  For this first prompt, please simply hit\n"
+            "'p' or 'c', and then the Enter key.")
+         );
+         if (ok)
+         {
+            unit_test_status_pass
+            (
+               &status,
+               unit_test_status_disposition(&status) ==
+                  XPCCUT_DISPOSITION_CONTINUE
+            );
+         }
+         else
+            unit_test_status_pass(&status, true);
+      }
+      if
+      (
+         unit_test_status_next_subtest(&status, _("'S' test"))
+      )
+      {
+         (void) unit_test_status_prompt
+         (
+            &status, _("Press 's' or 'S' followed by the Enter key")
+         );
+
+         /*
+          * From here on we'll use accessor functions for comparision.  In
+          * batch mode (--batch), this function cannot pass, because the
+          * answer returned in batch mode is that given by the 'c' key
+          * (continue testing).  That is, isSkipped() returns false.  So if
+          * we're in batch mode, we'll return true.  The same applies to
+          * interactive mode.  Rather than call two functions, we will just
+          * call the isOkay() function.
+          */
+
+         unit_test_status_pass
+         (
+            &status,
+            unit_test_status_is_skipped(&status) ||
+            unit_test_status_is_okay(&status)
+         );
+      }
+
+      /*
+       * We used to do checks like this:
+       *
+       *    if (unit_test_status_passed(&status) &&
+       *       unit_test_status_next_subtest(&status, _("'F' test")))
+       *
+       * However, the status-passed call is done in the next-subtest call,
+       * and also keeps track of the stop-on-error option.  So the test
+       * becomes much easier to fit on a single line.
+       */
+
+      /*
+       * There is no 'f' option for prompting, so this test keeps
+       * reprompting over and over until the user realizes (perhaps)
+       * that 'f' is not supported.
+       *
+       *    if (unit_test_status_next_subtest(&status, _("'F' test")))
+       *    {
+       *       (void) unit_test_status_prompt
+       *       (
+       *          &status, _("Press 'f' or 'F' followed by the Enter key")
+       *       );
+       *       (void) unit_test_status_pass
+       *       (
+       *          &status,
+       *          unit_test_status_is_failed(&status) ||
+       *          unit_test_status_is_okay(&status)
+       *       );
+       *    }
+       *
+       */
+
+      if (unit_test_status_next_subtest(&status, _("'Q' test")))
+      {
+         (void) unit_test_status_prompt
+         (
+            &status, _("Press 'q' or 'Q' followed by the Enter key")
+         );
+         (void) unit_test_status_pass
+         (
+            &status,
+            unit_test_status_is_quitted(&status) ||
+            unit_test_status_is_okay(&status)
+         );
+      }
+      if (unit_test_status_next_subtest(&status, _("'A' test")))
+      {
+         (void) unit_test_status_prompt
+         (
+            &status, _("Press 'a' or 'A' followed by the Enter key")
+         );
+         (void) unit_test_status_pass
+         (
+            &status,
+            unit_test_status_is_aborted(&status) ||
+            unit_test_status_is_okay(&status)
+         );
+      }
+      if (! unit_test_status_passed(&status))
+         xpccut_errprint(_("Hey, why did you disobey me?!"));
+   }
+   unit_test_status_reset(&status);    /* prevent premature test termination  */
+   return status;
+}
+
+/**
+ *    This test demonstrates the usage of the unit-test prompt facility.  If
+ *    the user answers all the prompts as directed, the test will pass.  This
+ *    means that the user cannot abort this test (grin).
+ *
+ * \group
+ *    5. Additional functions.
+ *
+ * \case
+ *    3. More prompt support -- quitting.
+ *
+ * \test
+ *    This unit-test function perforce tests more than one unit from the
+ *    unit-test library (libxpccut):
+ *
+ *    -  unit_test_status_initialize()
+ *    -  unit_test_status_pass()
+ *    -  unit_test_status_fail()
+ *    -  unit_test_status_is_verbose() [by user visualization only]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+/* static */ unit_test_status_t
+unit_unit_test_05_03 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 5, 3, _("XPCCUT Test"), _("Disposal")
+   );
+   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
+      unit_test_status_pass(&status, true);        /* no, force it to pass    */
+   else if (ok)
+   {
+      if (unit_test_status_next_subtest(&status, _("'Q' test")))
+      {
+         (void) unit_test_status_prompt
+         (
+            &status,
+            _("Press 'q' or 'a' to halt with success or failure, at your option")
+         );
+      }
+   }
+   return status;
+}
+
+/**
+ *    This test demonstrates the usage of the unit-test prompt facility.  If
+ *    the user answers all the prompts as directed, the test will pass.  This
+ *    means that the user cannot abort this test (grin).
+ *
+ * \group
+ *    5. Additional functions.
+ *
+ * \case
+ *    4. More prompt support -- continuing.
+ *
+ * \test
+ *    This unit-test function perforce tests more than one unit from the
+ *    unit-test library (libxpccut):
+ *
+ *    -  unit_test_status_initialize()
+ *    -  unit_test_status_pass()
+ *    -  unit_test_status_fail()
+ *    -  unit_test_status_is_verbose() [by user visualization only]
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+/* static */ unit_test_status_t
+unit_unit_test_05_04 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 5, 4, _("XPCCUT Test"), _("Continuation")
+   );
+   if (! unit_test_status_can_proceed(&status))    /* is test allowed to run? */
+      unit_test_status_pass(&status, true);        /* no, force it to pass    */
+   else if (ok)
+   {
+      unit_test_status_pass(&status, true);
+      if (unit_test_options_is_verbose(options))
+      {
+         xpccut_print
+         (
+            "  %s\n",
+            _("You will see this message only if you didn't answer 'q' before")
+         );
+      }
+      if (unit_test_status_next_subtest(&status, _("Continuation test")))
+         (void) unit_test_status_prompt(&status, _("Answer as you wish"));
+   }
+   return status;
+}
+
+/**
+ *    Recapitulates unit_unit_test_01_01().
+ *
+ *    Why?  To make it easy to check up on some aspects of the --summarize
+ *    option.
+ *
+ * \group
+ *    6. Test recapitulation.
+ *
+ * \case
+ *    1. 01.01 smoke-test recapitulation.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_06_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 6, 1, "XPCCUT", _("01.01 Smoke Test Recap")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         if (unit_test_options_show_values(options))
+            xpccut_print("  %s\n", _("No values to show in this test"));
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "unit_test_status_pass()"))
+         {
+            unit_test_status_pass(&status, true);
+            ok =
+            (
+               (status.m_Subtest_Error_Count == 0) &&
+               (status.m_Failed_Subtest == 0)
+            );
+            if (! ok)
+            {
+               (void) unit_test_status_fail(&status);    /* create a failure  */
+               if (unit_test_options_is_verbose(options))
+               {
+                  xpccut_print_error
+                  (
+                     "%s %s\n",
+                     "unit_test_status_pass()", _("internal failure")
+                  );
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if
+         (
+            ok &&
+            unit_test_status_next_subtest(&status, "unit_test_status_fail()")
+         )
+         {
+            ok = unit_test_status_fail_deliberately(&status);
+            if (ok)
+            {
+               ok =
+               (
+                  (status.m_Subtest_Error_Count == 1) &&
+                  (status.m_Failed_Subtest == 2)
+               );
+               unit_test_status_pass(&status, ok); /* convert it to a "pass"  */
+               if (ok)
+               {
+                  status.m_Subtest_Error_Count--;  /* direct access (bad) !!! */
+                  status.m_Failed_Subtest = 0;     /* direct access (bad) !!! */
+               }
+            }
+         }
+         /*
+          * This visual duration check is useless.
+          *
+          * if (ok)
+          *    xpccut_ms_sleep(500);               // a visual duration check
+          *
+          */
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides tests of some of the macros, so we can verify they are being
+ *    defined properly.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    1. cut_not_nullptr() and cut_is_nullptr() macros.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 1, "XPCCUT", _("cut_xxx_nullptr() tests")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         const char * good = "allo";
+         const char * bad = nullptr;
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "cut_not_nullptr()"))
+         {
+#ifdef XPC_NO_NULLPTR
+            ok = cut_not_nullptr(good) == true;
+            if (ok)
+               ok = cut_not_nullptr(bad) == true;
+#else
+            ok = cut_not_nullptr(good) == true;
+            if (ok)
+               ok = cut_not_nullptr(bad) == false;
+#endif
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "cut_is_nullptr()"))
+         {
+#ifdef XPC_NO_NULLPTR
+            ok = cut_is_nullptr(good) == false;
+            if (ok)
+               ok = cut_is_nullptr(bad) == false;
+#else
+            ok = cut_is_nullptr(good) == false;
+            if (ok)
+               ok = cut_is_nullptr(bad) == true;
+#endif
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides tests of some of the macros, so we can verify they are being
+ *    defined properly.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    2. cut_not_thisptr() and cut_is_thisptr() macros.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_02 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 2, "XPCCUT", _("cut_xxx_thisptr() tests")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+#ifndef XPC_NO_THISPTR
+         const char * good = "allo";
+         const char * bad = nullptr;
+#endif
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "cut_not_thisptr()"))
+         {
+#ifdef XPC_NO_THISPTR
+
+            /*
+             * Note that this code will never be run -- it is prevented in
+             * main(), since the trying to do stuff with a null pointer is
+             * inevitably a segfault.
+             */
+
+            ok = cut_not_thisptr(nullptr) == false;
+            if (ok)
+               ok = cut_not_thisptr(nullptr) == false;
+#else
+            ok = cut_not_thisptr(good) == false;
+            if (ok)
+               ok = cut_not_thisptr(bad) == true;
+#endif
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "cut_is_thisptr()"))
+         {
+#ifdef XPC_NO_THISPTR
+            ok = cut_is_thisptr(nullptr) == true;
+            if (ok)
+               ok = cut_is_thisptr(nullptr) == true;
+#else
+            ok = cut_is_thisptr(good) == true;
+            if (ok)
+               ok = cut_is_thisptr(bad) == false;
+#endif
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides tests of some of the macros, so we can verify they are being
+ *    defined properly.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    3. xpccut_thisptr() macro.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_03 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 3, "XPCCUT", _("xpccut_thisptr() tests")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+#ifndef XPC_NO_THISPTR
+         const char * good = "allo";
+         const char * bad = nullptr;
+#endif
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_thisptr()"))
+         {
+
+#ifdef XPC_NO_THISPTR
+
+            /*
+             * Note that this code will never be run -- it is prevented in
+             * main(), since the trying to do stuff with a null pointer is
+             * inevitably a segfault.
+             */
+
+            ok = xpccut_thisptr(nullptr) == true;
+            if (ok)
+               ok = xpccut_thisptr(nullptr) == true;
+#else
+            ok = xpccut_thisptr(good) == true;
+            if (ok)
+               ok = xpccut_thisptr(bad) == false;
+#endif
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Holds what output_test_sink() has been given.
+ */
+
+typedef struct
+{
+   char m_Text[3][12000];  /**< The text for stdout, stderr, and the report.  */
+   int m_Length[3];        /**< The number of bytes in each m_Text.           */
+   int m_Calls;            /**< The number of batches, on either channel.     */
+   cbool_t m_Overflow;     /**< Set if more text arrived than would fit.      */
+
+} output_test_t;
+
+/**
+ *    Provides a sink for unit-tests 07.04 and 07.05 that keeps the output
+ *    in an output_test_t, so that the test can look at it.
+ */
+
+static void
+output_test_sink
+(
+   void * context,
+   xpccut_output_channel_t channel,
+   const char * text,
+   int length
+)
+{
+   output_test_t * t = (output_test_t *) context;
+   int c = channel == XPCCUT_OUTPUT_STDERR ? 1 :
+      (channel == XPCCUT_OUTPUT_REPORT ? 2 : 0) ;
+   ++t->m_Calls;
+   if (t->m_Length[c] + length < (int) sizeof t->m_Text[c])
+   {
+      memcpy(t->m_Text[c] + t->m_Length[c], text, (size_t) length);
+      t->m_Length[c] += length;
+   }
+   else
+      t->m_Overflow = true;
+}
+
+/**
+ *    Points the output of the calling thread at a fresh output_test_t.  If
+ *    the thread is capturing its output, as the --jobs workers do, that
+ *    capture is ended, and handed back, so that the test sees its own
+ *    output.
+ *
+ * \return
+ *    Returns the captured output of the caller, or null.
+ */
+
+static char *
+output_test_begin
+(
+   output_test_t * t,               /**< The structure to keep the output.    */
+   cbool_t * capturing,             /**< Gets the capture state of the caller.*/
+   int * length                     /**< Gets the size of the returned block. */
+)
+{
+   char * result = nullptr;
+   *length = 0;
+   *capturing = xpccut_output_is_capturing();
+   if (*capturing)
+      result = xpccut_output_capture_end(length);
+   else
+      xpccut_output_flush();
+
+   memset(t, 0, sizeof *t);
+   xpccut_output_set_sink(output_test_sink, t);
+   return result;
+}
+
+/**
+ *    Undoes output_test_begin().  The sink is put back to the default, and
+ *    the capture of the caller, if any, is started again.
+ */
+
+static void
+output_test_end
+(
+   char * captured,                 /**< The block from output_test_begin().  */
+   cbool_t capturing,               /**< The capture state of the caller.     */
+   int length                       /**< The size of \a captured.             */
+)
+{
+   xpccut_output_set_sink(nullptr, nullptr);
+   if (capturing)
+   {
+      xpccut_output_capture_begin();
+      xpccut_output_replay(captured, length);
+   }
+   free(captured);
+}
+
+/**
+ *    Provides a unit test of the buffered output layer of the output.c
+ *    module.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    4. Buffered output
+ *
+ * \test
+ *    -  xpccut_output_set_sink()
+ *    -  xpccut_output_get_sink()
+ *    -  xpccut_output_write()
+ *    -  xpccut_output_printf()
+ *    -  xpccut_print()
+ *    -  xpccut_print_error()
+ *    -  xpccut_output_flush()
+ *    -  xpccut_output_capture_begin()
+ *    -  xpccut_output_is_capturing()
+ *    -  xpccut_output_capture_end()
+ *    -  xpccut_output_replay()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_04 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 4, "XPCCUT", _("Buffered output")
+   );
+   if (ok)
+   {
+      output_test_t * output = malloc(sizeof *output);   /* big for stack */
+      if (cut_is_nullptr(output))
+         unit_test_status_pass(&status, false);    /* cannot run the test     */
+      else if (! unit_test_status_can_proceed(&status))   /* allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         cbool_t capturing;
+         int length;
+         char * outer;
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "Batches"))
+         {
+            void * context = nullptr;
+            int i;
+            outer = output_test_begin(output, &capturing, &length);
+            ok = xpccut_output_get_sink(&context) == output_test_sink;
+            if (ok)
+               ok = context == output;
+
+            for (i = 0; i < 100; ++i)
+               xpccut_print("  %s %d\n", "Line", i);
+
+            xpccut_output_write(XPCCUT_OUTPUT_STDOUT, "end\n", -1);
+            if (ok)
+               ok = output->m_Calls == 0;       /* nothing sent early      */
+
+            xpccut_output_flush();
+            if (ok)
+               ok = output->m_Calls == 1;       /* one batch for it all    */
+
+            if (ok)
+            {
+               ok = output->m_Length[0] == 100 * 10 - 10 + 4 &&
+                  strncmp(output->m_Text[0], "  Line 0\n  Line 1\n", 18) == 0;
+            }
+            output_test_end(outer, capturing, length);
+            if (ok)
+               ok = cut_is_nullptr(xpccut_output_get_sink(nullptr));
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Channel order"))
+         {
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_print("out 1\n");
+            xpccut_output_printf(XPCCUT_OUTPUT_STDERR, "err %d\n", 2);
+            ok = output->m_Calls == 2;          /* errors go out at once   */
+            xpccut_print("out 3\n");
+            xpccut_print_error("err 4\n");
+            xpccut_output_flush();
+            if (ok)
+               ok = output->m_Calls == 4;
+
+            if (ok)
+            {
+               ok = output->m_Length[0] == 12 && output->m_Length[1] == 12 &&
+                  memcmp(output->m_Text[0], "out 1\nout 3\n", 12) == 0 &&
+                  memcmp(output->m_Text[1], "err 2\nerr 4\n", 12) == 0;
+            }
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Big output"))
+         {
+            char big[XPCCUT_OUTPUT_BUFFER_SIZE * 2 + 1];
+            int i;
+            memset(big, 'x', sizeof big - 1);
+            big[sizeof big - 1] = 0;
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_print("<");
+            xpccut_print("%s", big);            /* bigger than the buffer  */
+            xpccut_output_write(XPCCUT_OUTPUT_STDOUT, big, 10);
+            for (i = 0; i < XPCCUT_OUTPUT_BUFFER_SIZE / 4; ++i)
+               xpccut_print("%d", i % 10);      /* fills the buffer again  */
+
+            xpccut_output_flush();
+            ok = ! output->m_Overflow && output->m_Calls >= 3;
+            if (ok)
+            {
+               int expected = 1 + (int) sizeof big - 1 + 10 +
+                  XPCCUT_OUTPUT_BUFFER_SIZE / 4;
+
+               ok = output->m_Length[0] == expected;
+            }
+            if (ok)
+            {
+               const char * t = output->m_Text[0];
+               ok = t[0] == '<' && t[1] == 'x' && t[sizeof big + 9] == 'x';
+               if (ok)
+               {
+                  t += sizeof big + 10;
+                  for (i = 0; i < XPCCUT_OUTPUT_BUFFER_SIZE / 4; ++i)
+                  {
+                     if (t[i] != '0' + i % 10)
+                     {
+                        ok = false;
+                        break;
+                     }
+                  }
+               }
+            }
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Capture and replay"))
+         {
+            char * block;
+            int size;
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_output_capture_begin();
+            ok = xpccut_output_is_capturing();
+            xpccut_print("captured %d\n", 1);
+            xpccut_print_error("captured %d\n", 2);
+            xpccut_print("captured %d\n", 3);
+            xpccut_output_flush();
+            block = xpccut_output_capture_end(&size);
+            if (ok)
+               ok = ! xpccut_output_is_capturing();
+
+            if (ok)
+               ok = output->m_Calls == 0 && cut_not_nullptr(block) && size > 0;
+
+            if (ok)
+            {
+               xpccut_output_replay(block, size);
+               xpccut_output_flush();
+               ok = output->m_Calls == 3 &&
+                  output->m_Length[0] == 22 && output->m_Length[1] == 11 &&
+                  memcmp(output->m_Text[0], "captured 1\ncaptured 3\n", 22)
+                     == 0 &&
+                  memcmp(output->m_Text[1], "captured 2\n", 11) == 0;
+            }
+            free(block);
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Empty and null output"))
+         {
+            char * block;
+            int size = 99;
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_output_write(XPCCUT_OUTPUT_STDOUT, nullptr, 10);
+            xpccut_output_write(XPCCUT_OUTPUT_STDOUT, "", -1);
+            xpccut_output_printf(XPCCUT_OUTPUT_STDOUT, nullptr);
+            xpccut_output_replay(nullptr, 10);
+            xpccut_output_flush();
+            ok = output->m_Calls == 0;
+            xpccut_output_capture_begin();
+            block = xpccut_output_capture_end(&size);
+            if (ok)
+               ok = cut_is_nullptr(block) && size == 0;
+
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+      }
+      free(output);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test of the report writers of the report_format.c
+ *    module, and of the sub-test records written by the status functions.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    5. Report formats
+ *
+ * \test
+ *    -  xpccut_report_begin()
+ *    -  xpccut_report_record()
+ *    -  xpccut_report_end()
+ *    -  xpccut_output_set_report_file()
+ *    -  unit_test_status_next_subtest()
+ *    -  unit_test_status_time_delta()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_05 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 5, "XPCCUT", _("Report formats")
+   );
+   if (ok)
+   {
+      output_test_t * output = malloc(sizeof *output);   /* big for stack */
+      if (cut_is_nullptr(output))
+         unit_test_status_pass(&status, false);    /* cannot run the test     */
+      else if (! unit_test_status_can_proceed(&status))   /* allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         const char * report = output->m_Text[2];
+         xpccut_report_record_t r;
+         cbool_t capturing;
+         int length;
+         char * outer;
+         r.m_Group = 7;
+         r.m_Group_Name = "G<\"&'>";
+         r.m_Case = 5;
+         r.m_Case_Name = "C\\#";
+         r.m_Subtest = 1;
+         r.m_Subtest_Name = "S\n";
+         r.m_Disposition = "passed";
+         r.m_Duration_ms = 1.5;
+         r.m_Error_Count = 0;
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "JSON Lines"))
+         {
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_report_begin(XPCCUT_REPORT_JSONL, "app");
+            xpccut_report_record(XPCCUT_REPORT_JSONL, &r);
+            xpccut_report_end(XPCCUT_REPORT_JSONL, 1);
+            xpccut_output_flush();
+            ok = strcmp
+            (
+               report,
+               "{\"group\":7,\"group_name\":\"G<\\\"&'>\",\"case\":5,"
+               "\"case_name\":\"C\\\\#\",\"subtest\":1,"
+               "\"subtest_name\":\"S\\u000a\",\"disposition\":\"passed\","
+               "\"duration_ms\":1.500,\"errors\":0}\n"
+            ) == 0;
+            if (ok)
+               ok = output->m_Length[0] == 0 && output->m_Length[1] == 0;
+
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "JUnit XML"))
+         {
+            const char * expected =
+               "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               "<testsuites name=\"a&amp;b\">\n<testsuite name=\"a&amp;b\">\n"
+               "<testcase classname=\"G&lt;&quot;&amp;&apos;&gt;\" "
+               "name=\"07.05.01 C\\#: S \" time=\"0.001500\"/>\n";
+
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_report_begin(XPCCUT_REPORT_JUNIT, "a&b");
+            xpccut_report_record(XPCCUT_REPORT_JUNIT, &r);
+            r.m_Disposition = "failed";
+            r.m_Error_Count = 2;
+            xpccut_report_record(XPCCUT_REPORT_JUNIT, &r);
+            r.m_Disposition = "skipped";
+            r.m_Error_Count = 0;
+            xpccut_report_record(XPCCUT_REPORT_JUNIT, &r);
+            xpccut_report_end(XPCCUT_REPORT_JUNIT, 3);
+            xpccut_output_flush();
+            ok = strncmp(report, expected, strlen(expected)) == 0;
+            if (ok)
+            {
+               ok = cut_not_nullptr
+               (
+                  strstr(report, "><failure message=\"failed, 2 errors\"/>")
+               );
+            }
+            if (ok)
+               ok = cut_not_nullptr(strstr(report, "><skipped/></testcase>\n"));
+
+            if (ok)
+            {
+               ok = strcmp
+               (
+                  report + strlen(report) - 27, "</testsuite>\n</testsuites>\n"
+               ) == 0;
+            }
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "TAP"))
+         {
+            const char * expected =
+               "TAP version 13\n"
+               "ok - G<\"&'> 07.05.01 C\\\\\\#: S \n  ---\n"
+               "  disposition: passed\n  duration_ms: 1.500\n  errors: 0\n"
+               "  ...\nnot ok - ";
+
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_report_begin(XPCCUT_REPORT_TAP, "app");
+            r.m_Disposition = "passed";
+            xpccut_report_record(XPCCUT_REPORT_TAP, &r);
+            r.m_Disposition = "failed";
+            r.m_Error_Count = 1;
+            xpccut_report_record(XPCCUT_REPORT_TAP, &r);
+            r.m_Disposition = "skipped";
+            r.m_Error_Count = 0;
+            xpccut_report_record(XPCCUT_REPORT_TAP, &r);
+            xpccut_report_end(XPCCUT_REPORT_TAP, 3);
+            xpccut_output_flush();
+            ok = strncmp(report, expected, strlen(expected)) == 0;
+            if (ok)
+               ok = cut_not_nullptr(strstr(report, "S  # SKIP\n"));
+
+            if (ok)
+               ok = strcmp(report + strlen(report) - 5, "1..3\n") == 0;
+
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Report lane"))
+         {
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_print("out 1\n");
+            xpccut_output_write(XPCCUT_OUTPUT_REPORT, "rec 1\n", -1);
+            xpccut_print("out 2\n");
+            xpccut_output_write(XPCCUT_OUTPUT_REPORT, "rec 2\n", -1);
+            ok = output->m_Calls == 0;          /* no batch broken up      */
+            xpccut_output_flush();
+            if (ok)
+               ok = output->m_Calls == 2;
+
+            if (ok)
+            {
+               ok = strcmp(output->m_Text[0], "out 1\nout 2\n") == 0 &&
+                  strcmp(report, "rec 1\nrec 2\n") == 0;
+            }
+            if (ok)
+            {
+               char * captured;
+               int size;
+               memset(output, 0, sizeof *output);
+               xpccut_output_capture_begin();
+               xpccut_output_write(XPCCUT_OUTPUT_REPORT, "rec 3\n", -1);
+               captured = xpccut_output_capture_end(&size);
+               ok = output->m_Calls == 0;
+               xpccut_output_replay(captured, size);
+               xpccut_output_flush();
+               free(captured);
+               if (ok)
+                  ok = strcmp(report, "rec 3\n") == 0;
+            }
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Sub-test records"))
+         {
+            unit_test_options_t x_options_x;
+            unit_test_status_t x_status_x;
+            cbool_t silent = xpccut_is_silent();
+            outer = output_test_begin(output, &capturing, &length);
+            xpccut_silence_printing();          /* hide the failure note   */
+            ok = unit_test_options_init(&x_options_x);
+            if (ok)
+            {
+               ok = unit_test_options_show_progress_set(&x_options_x, false);
+               if (ok)
+               {
+                  ok = unit_test_options_report_format_set
+                  (
+                     &x_options_x, XPCCUT_REPORT_JSONL
+                  );
+               }
+            }
+            if (ok)
+            {
+               ok = unit_test_status_initialize
+               (
+                  &x_status_x, &x_options_x, 7, 5, "G", "C"
+               );
+            }
+            if (ok)
+               ok = unit_test_status_next_subtest(&x_status_x, "one");
+
+            if (ok)
+            {
+               (void) unit_test_status_fail(&x_status_x);
+               ok = unit_test_status_next_subtest(&x_status_x, "two");
+            }
+            if (ok)
+            {
+               (void) unit_test_status_pass(&x_status_x, true);
+               (void) unit_test_status_time_delta(&x_status_x, false);
+               xpccut_output_flush();
+               ok = x_status_x.m_Report_Count == 2;
+            }
+            if (ok)
+            {
+               const char * second = strchr(report, '\n');
+               ok = cut_not_nullptr(second);
+               if (ok)
+               {
+                  const char * expected =
+                     "{\"group\":7,\"group_name\":\"G\",\"case\":5,"
+                     "\"case_name\":\"C\",\"subtest\":1,"
+                     "\"subtest_name\":\"one\",\"disposition\":\"failed\"";
+
+                  ok = strncmp(report, expected, strlen(expected)) == 0;
+               }
+               if (ok)
+               {
+                  ok = cut_not_nullptr
+                  (
+                     strstr(second, "\"subtest_name\":\"two\","
+                        "\"disposition\":\"passed\"")
+                  );
+               }
+               if (ok)
+                  ok = cut_not_nullptr(strstr(second, "\"errors\":0}\n"));
+            }
+            if (! silent)
+               xpccut_allow_printing();
+
+            output_test_end(outer, capturing, length);
+            unit_test_status_pass(&status, ok);
+         }
+      }
+      free(output);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test of the interned names of the intern.c module,
+ *    and of the names of the unit_test_status_t structure that use them.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    6. Interned names
+ *
+ * \test
+ *    -  xpccut_intern()
+ *    -  xpccut_intern_count()
+ *    -  xpccut_intern_acquire()
+ *    -  xpccut_intern_release()
+ *    -  xpccut_intern_in()
+ *    -  xpccut_intern_table_init()
+ *    -  xpccut_intern_table_destroy()
+ *    -  xpccut_intern_table_count()
+ *    -  xpccut_intern_table_blocks()
+ *    -  unit_test_options_names_set()
+ *    -  unit_test_options_names()
+ *    -  unit_test_status_initialize()
+ *    -  unit_test_status_next_subtest()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_06 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 6, "XPCCUT", _("Interned names")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         char longname[XPCCUT_STRLEN * 3];         /* longer than the old max */
+         memset(longname, 'n', sizeof longname - 1);
+         longname[sizeof longname - 1] = 0;
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "Same string, same copy"))
+         {
+            char name[32];
+            const char * first = xpccut_intern("07.06 interned name");
+            int count = xpccut_intern_count();
+            snprintf(name, sizeof name, "%s", "07.06 interned name");
+            ok = cut_not_nullptr(first) && first != name;
+            if (ok)
+               ok = strcmp(first, name) == 0;
+
+            if (ok)
+               ok = xpccut_intern(name) == first;
+
+            if (ok)
+               ok = xpccut_intern_count() == count;
+
+            if (ok)
+            {
+               static int s_run = 0;            /* new name for --repeat   */
+               const char * other;
+               snprintf(name, sizeof name, "07.06 other name %d", ++s_run);
+               other = xpccut_intern(name);
+               ok = other != first && strcmp(other, name) == 0;
+            }
+            if (ok)
+               ok = xpccut_intern_count() == count + 1;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Null and empty"))
+         {
+            int count = xpccut_intern_count();
+            const char * empty = xpccut_intern("");
+            ok = cut_not_nullptr(empty) && *empty == 0;
+            if (ok)
+            {
+               const char * null = xpccut_intern(nullptr);
+               ok = cut_not_nullptr(null) && *null == 0;
+            }
+            if (ok)
+               ok = xpccut_intern_count() == count;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Many names"))
+         {
+            const char * names[1000];
+            char name[32];
+            int i;
+            for (i = 0; i < 1000; ++i)          /* grows the table a lot   */
+            {
+               snprintf(name, sizeof name, "07.06 name %d", i);
+               names[i] = xpccut_intern(name);
+            }
+            ok = true;
+            for (i = 0; i < 1000 && ok; ++i)
+            {
+               snprintf(name, sizeof name, "07.06 name %d", i);
+               ok = xpccut_intern(name) == names[i] &&
+                  strcmp(names[i], name) == 0;
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Long status names"))
+         {
+            unit_test_options_t x_options_x;
+            unit_test_status_t x_status_x;
+            ok = unit_test_options_init(&x_options_x);
+            if (ok)
+               ok = unit_test_options_show_progress_set(&x_options_x, false);
+
+            if (ok)
+            {
+               ok = unit_test_status_initialize
+               (
+                  &x_status_x, &x_options_x, 7, 6, longname, longname
+               );
+            }
+            if (ok)
+               ok = unit_test_status_next_subtest(&x_status_x, longname);
+
+            if (ok)
+            {
+               ok = strlen(unit_test_status_group_name(&x_status_x)) ==
+                  sizeof longname - 1;
+            }
+            if (ok)
+            {
+               ok = strcmp(unit_test_status_case_name(&x_status_x), longname)
+                  == 0;
+            }
+            if (ok)
+            {
+               ok = strcmp(unit_test_status_subtest_name(&x_status_x), longname)
+                  == 0;
+            }
+            if (ok)
+            {
+               ok = x_status_x.m_Group_Name == x_status_x.m_Case_Description
+                  && x_status_x.m_Group_Name == x_status_x.m_Subtest_Name;
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Hot fields first"))
+         {
+            /*
+             * The fields used by every sub-test should fit in the first
+             * 64 bytes of the status, where pointers are 8 bytes or less.
+             */
+
+            ok = offsetof(unit_test_status_t, m_Report_Count) + sizeof(int)
+               <= 64;
+
+            if (ok)
+            {
+               ok = offsetof(unit_test_status_t, m_Subtest_Name) <
+                  offsetof(unit_test_status_t, m_Group_Name);
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "Buffer given again"))
+         {
+            char name[32];
+            const char * first;
+            const char * second;
+            snprintf(name, sizeof name, "%s", "07.06 buffer first");
+            first = xpccut_intern(name);              /* now in the cache */
+            snprintf(name, sizeof name, "%s", "07.06 buffer second");
+            second = xpccut_intern(name);             /* same pointer     */
+            ok = second != first && strcmp(second, name) == 0;
+            if (ok)
+            {
+               snprintf(name, sizeof name, "%s", "07.06 buffer first");
+               ok = xpccut_intern(name) == first;
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  7 */
+
+         if (unit_test_status_next_subtest(&status, "Kept by the outer run"))
+         {
+            unit_test_t x_test_x;
+            const char * first;
+            ok = unit_test_init(&x_test_x);
+            first = xpccut_intern("07.06 nested name");
+            unit_test_destroy(&x_test_x);          /* this run still holds */
+            if (ok)
+               ok = xpccut_intern("07.06 nested name") == first;
+
+            if (ok)
+               ok = strcmp(first, "07.06 nested name") == 0;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  8 */
+
+         if (unit_test_status_next_subtest(&status, "Kept in the run's table"))
+         {
+            unit_test_t x_test_x;
+            ok = unit_test_init(&x_test_x);
+            if (ok)
+            {
+               unit_test_status_t x_status_x;
+               ok = unit_test_status_initialize
+               (
+                  &x_status_x, &x_test_x.m_App_Options, 1, 1,
+                  "07.06 run group", "07.06 run case"
+               );
+               if (ok)
+               {
+                  ok = unit_test_status_next_subtest
+                  (
+                     &x_status_x, "07.06 run sub-test"
+                  );
+               }
+               if (ok)
+                  ok = xpccut_intern_table_count(&x_test_x.m_Names) == 3;
+
+               if (ok)
+               {
+                  ok = x_status_x.m_Subtest_Name ==
+                     xpccut_intern_in(&x_test_x.m_Names, "07.06 run sub-test");
+               }
+               if (ok)
+               {
+                  ok = x_status_x.m_Subtest_Name !=
+                     xpccut_intern("07.06 run sub-test");
+               }
+            }
+            unit_test_destroy(&x_test_x);
+            if (ok)
+               ok = xpccut_intern_table_count(&x_test_x.m_Names) == 0;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  9 */
+
+         if (unit_test_status_next_subtest(&status, "Same names each round"))
+         {
+            unit_test_t x_test_x;
+            int blocks = 0;
+            int count = 0;
+            int round;
+            ok = unit_test_init(&x_test_x);
+            for (round = 0; ok && round < 3; ++round)
+            {
+               unit_test_status_t x_status_x;
+               int row;
+               ok = unit_test_status_initialize
+               (
+                  &x_status_x, &x_test_x.m_App_Options, 1, 1,
+                  "07.06 round group", "07.06 round case"
+               );
+               for (row = 0; ok && row < 500; ++row)
+               {
+                  char name[48];                /* a new buffer each time     */
+                  snprintf(name, sizeof name, "07.06 round row %d", row);
+                  ok = unit_test_status_next_subtest(&x_status_x, name);
+               }
+               if (ok)
+               {
+                  xpccut_intern_table_t * names = &x_test_x.m_Names;
+                  if (round == 0)
+                  {
+                     blocks = xpccut_intern_table_blocks(names);
+                     count = xpccut_intern_table_count(names);
+                     ok = blocks > 0 && count == 502;
+                  }
+                  else
+                  {
+                     ok = xpccut_intern_table_blocks(names) == blocks &&
+                        xpccut_intern_table_count(names) == count;
+                  }
+               }
+            }
+            unit_test_destroy(&x_test_x);
+            if (ok)
+               ok = xpccut_intern_table_blocks(&x_test_x.m_Names) == 0;
+
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Holds the size of the test arena seen by fake_arena_unit_test_07_07(),
+ *    so that unit_unit_test_07_07() can check that the runner took the
+ *    blocks of the test back.
+ */
+
+static size_t gs_arena_used_07_07 = 0;
+
+/**
+ *    Provides a fake test for unit_unit_test_07_07(), which takes a block
+ *    from the test arena, and does not give it back.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+fake_arena_unit_test_07_07 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 98, 1, "arena", "scratch"
+   );
+   if (ok)
+   {
+      char * block = xpccut_arena_alloc(xpccut_test_arena(), 1000);
+      ok = cut_not_nullptr(block);
+      if (ok)
+      {
+         (void) memset(block, 'x', 1000);
+         gs_arena_used_07_07 = xpccut_arena_allocated(xpccut_test_arena());
+      }
+      unit_test_status_pass(&status, ok);
+   }
+   return status;
+}
+
+/**
+ *    Indicates if a block is aligned as the arenas promise.
+ */
+
+#define ARENA_ALIGNED(p)   (((size_t) (p) % XPCCUT_ARENA_ALIGNMENT) == 0)
+
+/**
+ *    Provides a unit/regression test to verify the arenas that hold the
+ *    scratch buffers of the tests, the test arena of each thread, and the
+ *    fuzz functions that allocate from an arena.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    7. Scratch arenas.
+ *
+ * \test
+ *    -  xpccut_arena_init()
+ *    -  xpccut_arena_destroy()
+ *    -  xpccut_arena_alloc()
+ *    -  xpccut_arena_calloc()
+ *    -  xpccut_arena_strdup()
+ *    -  xpccut_arena_mark()
+ *    -  xpccut_arena_rewind()
+ *    -  xpccut_arena_reset()
+ *    -  xpccut_arena_trim()
+ *    -  xpccut_arena_allocated()
+ *    -  xpccut_arena_capacity()
+ *    -  xpccut_test_arena()
+ *    -  xpccut_test_arena_release()
+ *    -  xpccut_arena_fuzz()
+ *    -  xpccut_arena_garbled_string()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_07 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 7, "XPCCUT", _("Scratch arenas")
+   );
+   if (ok)
+   {
+      xpccut_arena_t arena;
+      ok = xpccut_arena_init(&arena, 1024, XPCCUT_ARENA_NORMAL);
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null parameters"))
+      {
+         cbool_t null_ok;
+         cbool_t silent = xpccut_is_silent();
+         xpccut_silence_printing();             /* hide the error messages   */
+         null_ok = ! xpccut_arena_init(nullptr, 0, XPCCUT_ARENA_NORMAL);
+         if (null_ok)
+            null_ok = cut_is_nullptr(xpccut_arena_alloc(nullptr, 10));
+
+         if (null_ok)
+            null_ok = cut_is_nullptr(xpccut_arena_strdup(&arena, nullptr));
+
+         if (null_ok)
+         {
+            null_ok = cut_is_nullptr
+            (
+               xpccut_arena_garbled_string(&arena, nullptr, 4, nullptr)
+            );
+         }
+         if (null_ok)
+            null_ok = xpccut_arena_capacity(nullptr) == 0;
+
+         xpccut_arena_destroy(nullptr);
+         xpccut_arena_reset(nullptr);
+         if (! silent)
+            xpccut_allow_printing();
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      /*  2 */
+
+      if (unit_test_status_next_subtest(&status, "Aligned blocks"))
+      {
+         if (ok)
+            ok = xpccut_arena_capacity(&arena) == 0;   /* nothing yet       */
+
+         if (ok)
+         {
+            char * b1 = xpccut_arena_alloc(&arena, 3);
+            char * b2 = xpccut_arena_alloc(&arena, 5);
+            ok = cut_not_nullptr(b1) && cut_not_nullptr(b2);
+            if (ok)
+               ok = ARENA_ALIGNED(b1) && ARENA_ALIGNED(b2) && b2 == b1 + 16;
+
+            if (ok)
+               ok = xpccut_arena_allocated(&arena) == 21;
+
+            if (ok)
+               ok = xpccut_arena_capacity(&arena) == 1024;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  3 */
+
+      if (unit_test_status_next_subtest(&status, "A block larger than a chunk"))
+      {
+         if (ok)
+         {
+            char * big = xpccut_arena_alloc(&arena, 4000);
+            ok = cut_not_nullptr(big) && ARENA_ALIGNED(big);
+            if (ok)
+            {
+               (void) memset(big, 0x55, 4000);
+               ok = xpccut_arena_capacity(&arena) == 1024 + 4000;
+            }
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  4 */
+
+      if (unit_test_status_next_subtest(&status, "Rewinding to a mark"))
+      {
+         xpccut_arena_mark_t mark;
+         size_t used = xpccut_arena_allocated(&arena);
+         size_t capacity = 0;
+         int round;
+         xpccut_arena_mark(&arena, &mark);
+         for (round = 0; ok && round < 2; ++round)
+         {
+            int i;
+            for (i = 0; ok && i < 30; ++i)
+               ok = cut_not_nullptr(xpccut_arena_alloc(&arena, 100));
+
+            if (ok && round == 0)
+            {
+               capacity = xpccut_arena_capacity(&arena);
+               ok = capacity > 1024 + 4000;
+            }
+            else if (ok)
+               ok = xpccut_arena_capacity(&arena) == capacity; /* reused  */
+
+            xpccut_arena_rewind(&arena, &mark);
+            if (ok)
+               ok = xpccut_arena_allocated(&arena) == used;
+
+            xpccut_arena_mark(&arena, &mark);
+         }
+         xpccut_arena_rewind(&arena, &mark);
+         xpccut_arena_rewind(&arena, &mark);    /* a cleared mark: no-op     */
+         if (ok)
+            ok = xpccut_arena_allocated(&arena) == used;
+
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  5 */
+
+      if (unit_test_status_next_subtest(&status, "Cleared arrays and strings"))
+      {
+         if (ok)
+         {
+            int * array = xpccut_arena_calloc(&arena, 50, sizeof(int));
+            ok = cut_not_nullptr(array);
+            if (ok)
+            {
+               int i;
+               for (i = 0; i < 50; ++i)
+               {
+                  if (array[i] != 0)
+                     ok = false;
+               }
+            }
+         }
+         if (ok)
+         {
+            char * copy = xpccut_arena_strdup(&arena, "arena text");
+            ok = cut_not_nullptr(copy) && strcmp(copy, "arena text") == 0;
+         }
+         if (ok)
+         {
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();          /* hide the error message    */
+            ok = cut_is_nullptr
+            (
+               xpccut_arena_calloc(&arena, ((size_t) -1) / 2, 4)
+            );
+            if (! silent)
+               xpccut_allow_printing();
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  6 */
+
+      if (unit_test_status_next_subtest(&status, "Reset, trim, and destroy"))
+      {
+         size_t capacity = xpccut_arena_capacity(&arena);
+         xpccut_arena_reset(&arena);
+         if (ok)
+         {
+            ok = xpccut_arena_allocated(&arena) == 0 &&
+               xpccut_arena_capacity(&arena) == capacity;
+         }
+         if (ok)
+         {
+            ok = cut_not_nullptr(xpccut_arena_alloc(&arena, 10));
+            xpccut_arena_trim(&arena);          /* keeps the first chunk     */
+            if (ok)
+               ok = xpccut_arena_capacity(&arena) == 1024;
+         }
+         xpccut_arena_reset(&arena);
+         xpccut_arena_trim(&arena);             /* an empty arena: all gone  */
+         if (ok)
+            ok = xpccut_arena_capacity(&arena) == 0;
+
+         if (ok)
+            ok = cut_not_nullptr(xpccut_arena_alloc(&arena, 10));
+
+         xpccut_arena_destroy(&arena);
+         if (ok)
+         {
+            ok = xpccut_arena_capacity(&arena) == 0 &&
+               xpccut_arena_allocated(&arena) == 0;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  7 */
+
+      if (unit_test_status_next_subtest(&status, "Counting the allocations"))
+      {
+         xpccut_alloc_counts_t c1, c2, delta;
+         cbool_t counting = xpccut_alloc_read(&c1);
+         if (ok)
+         {
+            ok = cut_not_nullptr(xpccut_arena_alloc(&arena, 50000));
+            xpccut_arena_destroy(&arena);
+         }
+         if (ok && counting)
+         {
+            (void) xpccut_alloc_read(&c2);
+            ok = xpccut_alloc_difference(&c1, &c2, &delta);
+            if (ok)
+               ok = delta.m_Allocations == 0 && delta.m_Frees == 0;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  8 */
+
+      if (unit_test_status_next_subtest(&status, "Huge pages"))
+      {
+         if (ok)
+            ok = xpccut_arena_init(&arena, 4096, XPCCUT_ARENA_HUGE_PAGES);
+
+         if (ok)
+         {
+            char * block = xpccut_arena_alloc(&arena, 10000);
+            ok = cut_not_nullptr(block) && ARENA_ALIGNED(block);
+            if (ok)
+            {
+               (void) memset(block, 0xAA, 10000);
+               ok = xpccut_arena_capacity(&arena) >= 10000;
+            }
+         }
+         xpccut_arena_destroy(&arena);
+         unit_test_status_pass(&status, ok);
+      }
+
+      /*  9 */
+
+      if (unit_test_status_next_subtest(&status, "The test arena"))
+      {
+         xpccut_arena_t * scratch = xpccut_test_arena();
+         size_t used = xpccut_arena_allocated(scratch);
+         ok = cut_not_nullptr(scratch) && scratch == xpccut_test_arena();
+         if (ok)
+         {
+            char * block = xpccut_arena_alloc(scratch, 64);
+            ok = cut_not_nullptr(block);
+            if (ok)
+               ok = xpccut_arena_allocated(scratch) >= used + 64;
+
+            used = xpccut_arena_allocated(scratch);  /* taken back later     */
+         }
+         if (ok)
+         {
+            unit_test_t x_test_x;
+            char * argv[3];
+            argv[0] = "unit_test_test";
+            argv[1] = "--no-show-progress";
+            argv[2] = nullptr;
+            ok = unit_test_initialize
+            (
+               &x_test_x, 2, argv, "Test 07.07.9", "version", "additionalhelp"
+            );
+            if (ok)
+            {
+               ok = unit_test_register
+               (
+                  &x_test_x, fake_arena_unit_test_07_07, 98, 1,
+                  "arena", "scratch"
+               );
+            }
+            if (ok)
+            {
+               cbool_t silent = xpccut_is_silent();
+               gs_arena_used_07_07 = 0;
+               xpccut_silence_printing();
+               ok = unit_test_run(&x_test_x);
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            if (ok)
+               ok = gs_arena_used_07_07 >= used + 1000;
+
+            if (ok)                             /* the runner took it back   */
+               ok = xpccut_arena_allocated(scratch) == used;
+
+            unit_test_destroy(&x_test_x);       /* keeps our scratch block   */
+            if (ok)
+               ok = xpccut_arena_capacity(scratch) > 0;
+         }
+         unit_test_status_pass(&status, ok);
+      }
+
+      /* 10 */
+
+      if (unit_test_status_next_subtest(&status, "Fuzz strings in an arena"))
+      {
+         if (ok)
+            ok = xpccut_arena_init(&arena, 0, XPCCUT_ARENA_NORMAL);
+
+         if (ok)
+         {
+            unsigned int seed = 12345;
+            char * fuzz = xpccut_arena_fuzz
+            (
+               &arena, 40, &seed, XPCCUT_FF_DEFAULT, "abc",
+               nullptr, nullptr, nullptr
+            );
+            ok = cut_not_nullptr(fuzz) && seed == 12345;
+            if (ok)
+               ok = strlen(fuzz) == 40 && strspn(fuzz, "abc") == 40;
+         }
+         if (ok)
+         {
+            static const char * const s_text = "A string to be garbled";
+            int length = (int) strlen(s_text);
+            int changes = -1;
+            char * garbled = xpccut_arena_garbled_string
+            (
+               &arena, s_text, length, &changes
+            );
+            ok = cut_not_nullptr(garbled) && changes >= 0;
+            if (ok)
+            {
+               int i;
+               int differ = 0;
+               for (i = 0; i <= length; ++i)
+               {
+                  if (garbled[i] != s_text[i])
+                     ++differ;
+               }
+               ok = differ == changes &&
+                  strcmp(s_text, "A string to be garbled") == 0;
+            }
+         }
+         xpccut_arena_destroy(&arena);
+         unit_test_status_pass(&status, ok);
+      }
+   }
+   return status;
+}
+
+/**
+ *    Indicates that unit_unit_test_07_08() can record the trace in two
+ *    threads at once.  The pthread header is already included for
+ *    unit_unit_test_02_34().
+ */
+
+#define USE_TRACE_THREADS  USE_STOPWATCH_THREADS
+
+#if USE_TRACE_THREADS
+
+/**
+ *    Records one scope in the trace from its own thread, for
+ *    unit_unit_test_07_08().
+ *
+ * \param arg
+ *    Receives the count of events of the thread, as an int.
+ *
+ * \return
+ *    Returns null.
+ */
+
+static void *
+trace_thread (void * arg)
+{
+   int * count = (int *) arg;
+   xpccut_trace_enter("trace_thread");
+   xpccut_trace_exit("trace_thread");
+   *count = xpccut_trace_thread_count();
+   return nullptr;
+}
+
+#endif      /* USE_TRACE_THREADS */
+
+/**
+ *    Reads the whole of a small file into a buffer, for
+ *    unit_unit_test_07_08().
+ *
+ * \return
+ *    Returns 'true' if something was read.
+ */
+
+static cbool_t
+read_trace_file
+(
+   FILE * input,                    /**< The file, already written.           */
+   char * buffer,                   /**< Receives the contents.               */
+   size_t size                      /**< The size of the buffer.              */
+)
+{
+   size_t count;
+   rewind(input);
+   count = fread(buffer, 1, size - 1, input);
+   buffer[count] = 0;
+   return count > 0;
+}
+
+/**
+ *    Provides a unit/regression test to verify the trace buffer, and its
+ *    export in the trace event format.
+ *
+ * \group
+ *    7. Macro tests
+ *
+ * \case
+ *    8. Trace buffer.
+ *
+ * \test
+ *    -  xpccut_trace_enable()
+ *    -  xpccut_trace_is_enabled()
+ *    -  xpccut_trace_enter()
+ *    -  xpccut_trace_exit()
+ *    -  xpccut_trace_clear()
+ *    -  xpccut_trace_thread_count()
+ *    -  xpccut_trace_dropped()
+ *    -  xpccut_trace_write()
+ *    -  xpccut_trace_export()
+ *
+ * \note
+ *    The sub-tests after the first one clear the trace, so they are not run
+ *    when the trace is already enabled, as by the --trace-file option.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_07_08 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 7, 8, _("Macro tests"), _("Trace buffer")
+   );
+   if (ok)
+   {
+      cbool_t was_enabled = xpccut_trace_is_enabled();
+      char text[1024];
+
+      /*  1 */
+
+      if (unit_test_status_next_subtest(&status, "Null file pointer"))
+      {
+         cbool_t null_ok = xpccut_trace_write(nullptr) == -1;
+         if (null_ok)
+            null_ok = ! xpccut_trace_export(nullptr);
+
+         unit_test_status_pass(&status, null_ok);
+      }
+
+      if (! was_enabled)                  /* keep the trace of the run */
+      {
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Disabled, no events"))
+         {
+            int count;
+            xpccut_trace_enable(false);
+            ok = ! xpccut_trace_is_enabled();
+            count = xpccut_trace_thread_count();
+            xpccut_trace_enter("disabled");
+            xpccut_trace_exit("disabled");
+            if (ok)
+               ok = xpccut_trace_thread_count() == count;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Enter and exit recorded"))
+         {
+            xpccut_trace_clear();
+            xpccut_trace_enable(true);
+            ok = xpccut_trace_is_enabled();
+            if (ok)
+               ok = xpccut_trace_thread_count() == 0;
+
+            xpccut_trace_enter("scope_07_08");
+            xpccut_trace_exit("scope_07_08");
+            xpccut_trace_enable(false);
+            if (ok)
+               ok = xpccut_trace_thread_count() == 2;
+
+            if (ok)
+               ok = xpccut_trace_dropped() == 0;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Writing the events"))
+         {
+            FILE * output = tmpfile();
+            ok = cut_not_nullptr(output);
+            if (ok)
+            {
+               ok = xpccut_trace_write(output) >= 2;
+               if (ok)
+                  ok = read_trace_file(output, text, sizeof text);
+
+               if (ok)
+               {
+                  ok =
+                     strncmp(text, "{\"traceEvents\":[", 16) == 0 &&
+                     cut_not_nullptr(strstr(text, "\"scope_07_08\"")) &&
+                     cut_not_nullptr(strstr(text, "\"ph\":\"B\"")) &&
+                     cut_not_nullptr(strstr(text, "\"ph\":\"E\"")) &&
+                     cut_not_nullptr(strstr(text, "\"displayTimeUnit\""));
+               }
+               fclose(output);
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Escaping of names"))
+         {
+            FILE * output = tmpfile();
+            ok = cut_not_nullptr(output);
+            if (ok)
+            {
+               xpccut_trace_clear();
+               xpccut_trace_enable(true);
+               xpccut_trace_enter("say \"hi\"\\");
+               xpccut_trace_exit(nullptr);
+               xpccut_trace_enable(false);
+               ok = xpccut_trace_write(output) >= 2;
+               if (ok)
+                  ok = read_trace_file(output, text, sizeof text);
+
+               if (ok)
+               {
+                  ok =
+                     cut_not_nullptr(strstr(text, "say \\\"hi\\\"\\\\\"")) &&
+                     cut_not_nullptr(strstr(text, "\"name\":\"???\""));
+               }
+               fclose(output);
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "Wrapping of the ring"))
+         {
+            int i;
+            xpccut_trace_clear();
+            xpccut_trace_enable(true);
+            for (i = 0; i < XPCCUT_TRACE_EVENTS + 10; ++i)
+               xpccut_trace_enter("wrap");
+
+            xpccut_trace_enable(false);
+            ok = xpccut_trace_thread_count() == XPCCUT_TRACE_EVENTS;
+            if (ok)
+               ok = xpccut_trace_dropped() >= 10;
+
+            xpccut_trace_clear();
+            if (ok)
+               ok = xpccut_trace_thread_count() == 0;
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  7 */
+
+         if (unit_test_status_next_subtest(&status, "Rings of two threads"))
+         {
+   #if USE_TRACE_THREADS
+            pthread_t t1, t2;
+            int count_1 = 0;
+            int count_2 = 0;
+            xpccut_trace_clear();
+            xpccut_trace_enable(true);
+            ok = pthread_create(&t1, nullptr, trace_thread, &count_1) == 0;
+            if (ok)
+            {
+               ok = pthread_create(&t2, nullptr, trace_thread, &count_2) == 0;
+               if (ok)
+                  (void) pthread_join(t2, nullptr);
+
+               (void) pthread_join(t1, nullptr);
+            }
+            xpccut_trace_enable(false);
+            if (ok)
+               ok = count_1 == 2 && count_2 == 2;
+
+            if (ok)
+               ok = xpccut_trace_thread_count() == 0;    /* not this thread  */
+
+            if (ok)
+            {
+               FILE * output = tmpfile();
+               ok = cut_not_nullptr(output);
+               if (ok)
+               {
+                  ok = xpccut_trace_write(output) >= 4;     /* --jobs too */
+                  fclose(output);
+               }
+            }
+   #endif
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  8 */
+
+         if (unit_test_status_next_subtest(&status, "Export to a file"))
+         {
+            static const char * const s_name = "unit_test_07_08.json";
+            FILE * input;
+            if (ok)
+               ok = xpccut_trace_export(s_name);
+
+            input = fopen(s_name, "r");
+            if (ok)
+               ok = cut_not_nullptr(input);
+
+            if (cut_not_nullptr(input))
+            {
+               if (ok)
+                  ok = read_trace_file(input, text, sizeof text);
+
+               if (ok)
+                  ok = strncmp(text, "{\"traceEvents\":[", 16) == 0;
+
+               fclose(input);
+            }
+            (void) remove(s_name);
+            unit_test_status_pass(&status, ok);
+         }
+         xpccut_trace_clear();
+      }
+      xpccut_trace_enable(was_enabled);
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test for xpccut_nullptr() in the portable_subset.c
+ *    module.
+ *
+ *    Why?  We don't really want deep testing on this purely internal
+ *    module, but we need a good example of the usage of coverage testing.
+ *
+ *    Hence, this test group is provided.  It can be disabled via the
+ *    USE_XPCCUT_NULLPTR_TEST in order to test the usefulness of coverage
+ *    testing.
+ *
+ * \group
+ *    8. Special null-pointer test.
+ *
+ * \case
+ *    1. xxxx
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_08_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 8, 1, "xpccut_nullptr", _("01.01 Coverage Test Recap")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+
+#ifdef USE_XPCCUT_NULLPTR_TEST
+
+         if (unit_test_options_show_values(options))
+            xpccut_print("  %s\n", _("No values to show in this test"));
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_nullptr()"))
+         {
+            ok = ! xpccut_nullptr(nullptr, nullptr, nullptr);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (ok && unit_test_status_next_subtest(&status, "xpccut_nullptr()"))
+         {
+            // more to come
+         }
+#else
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+
+#endif      // USE_XPCCUT_NULLPTR_TEST
+
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides the number of data points we have for checking
+ *    xpccut_random().
+ */
+
+#define SEED_1_RESULTS_SIZE         60
+
+/**
+ *    Provides regression data to test the random-number generator.
+ *
+ *    The values generated with a seed of 1 should match this list.  There
+ *    are 60 values in this list.
+ */
+
+static unsigned int gs_selinger_results[SEED_1_RESULTS_SIZE] =
+{
+   1804289383,  846930886, 1681692777, 1714636915, 1957747793,
+    424238335,  719885386, 1649760492,  596516649, 1189641421,
+   1025202362, 1350490027,  783368690, 1102520059, 2044897763,
+   1967513926, 1365180540, 1540383426,  304089172, 1303455736,
+     35005211,  521595368,  294702567, 1726956429,  336465782,
+    861021530,  278722862,  233665123, 2145174067,  468703135,
+   1101513929, 1801979802, 1315634022,  635723058, 1369133069,
+   1125898167, 1059961393, 2089018456,  628175011, 1656478042,
+   1131176229, 1653377373,  859484421, 1914544919,  608413784,
+    756898537, 1734575198, 1973594324,  149798315, 2038664370,
+   1129566413,  184803526,  412776091, 1424268980, 1911759956,
+    749241873,  137806862,   42999170,  982906996,  135497281
+};
+
+/**
+ *    Provides the maximum number of xpccut_random() calls for subtest 3 of
+ *    test 09.01.
+ *
+ *    We used UINT_MAX, but this makes the unit test take a few minutes.
+ *    So, having already verified that we never get a value equal to the
+ *    first random number we pulled within UINT_MAX tries, we content
+ *    ourselves with skipping past this test, essentially.
+ */
+
+#define MAX_COUNT_09_01_03    100      //  UINT_MAX
+
+/**
+ *    Provides a unit test for the random number functions.
+ *
+ * \group
+ *    9. Random numbers
+ *
+ * \case
+ *    1. Basics
+ *
+ * \test
+ *    -  xpccut_srandom()
+ *    -  xpccut_random()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_09_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 9, 1, "Random numbers", _("Basics")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_srandom()"))
+         {
+            unsigned int s = xpccut_srandom(1);    /* set the default seed    */
+            ok = s == 1;
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_random()"))
+         {
+            int i;
+            unsigned int our_results[SEED_1_RESULTS_SIZE];
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_print
+               (
+                  "\n"
+                  "The following results should match the table found at\n"
+                  "http://www.mscs.dal.ca/~selinger/random/\n\n"
+               );
+            }
+            for (i = 0; i < SEED_1_RESULTS_SIZE; i++)
+            {
+               unsigned int o = xpccut_random();
+               ok = o == gs_selinger_results[i];
+               if (ok)
+               {
+                  our_results[i] = o;
+               }
+               else
+               {
+                  xpccut_errprint(_("bad random value"));
+                  break;
+               }
+            }
+            if (ok)
+            {
+               if (unit_test_options_show_values(options))
+               {
+                  int i;
+                  int j;
+                  for (i = 0; i < 12; i++)
+                  {
+                     int k = i;
+                     for (j = 0; j < SEED_1_RESULTS_SIZE/12; j++)
+                     {
+                        int o = our_results[k];
+                        xpccut_print("%2d: %10d  ", k, o);
+                        k += 12;
+                     }
+                     xpccut_print("\n");
+                  }
+                  xpccut_print("\n");
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Repeats"))
+         {
+            unsigned int s = xpccut_srandom(1234);
+            ok = s == 1234;
+            if (ok)
+            {
+               unsigned int i;
+               unsigned int q;
+               unsigned int r = xpccut_random();
+               for (i = 0; i < MAX_COUNT_09_01_03; i++)
+               {
+                  q = xpccut_random();
+                  if (q == r)
+                  {
+                     ok = false;
+                     if (! xpccut_is_silent())
+                     {
+                        xpccut_print
+                        (
+                           "Duplicate random number after %u iterations.\n", i
+                        );
+                     }
+                     break;
+                  }
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test for the random number functions.
+ *
+ * \group
+ *    9. Random numbers
+ *
+ * \case
+ *    2. Comparison to GNU random()
+ *
+ * \test
+ *    -  xpccut_srandom()
+ *    -  xpccut_random()
+ *    -  xpccut_rand()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+/**
+ *    Indicates that unit_unit_test_09_02() compares against the re-entrant
+ *    random_r() of glibc, rather than random(), whose state is shared by
+ *    the whole process, since --repeat can run two copies of the test at
+ *    once under --jobs.
+ */
+
+#if defined __GLIBC__
+#define USE_GNU_RANDOM_R   1
+#else
+#define USE_GNU_RANDOM_R   0
+#endif
+
+/**
+ *    The size of the state of the GNU generator, the size used by
+ *    random() itself, so that the results are the same.
+ */
+
+#define GNU_RANDOM_STATE_SIZE    128
+
+static unit_test_status_t
+unit_unit_test_09_02 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 9, 2, "Random numbers", _("Comparison to GNU random()")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+#if USE_GNU_RANDOM_R
+         struct random_data gnu;                   /* the GNU generator       */
+         char gnustate[GNU_RANDOM_STATE_SIZE];
+         memset(&gnu, 0, sizeof gnu);              /* initstate_r() needs it  */
+#endif
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "Seeding"))
+         {
+            unsigned int s = xpccut_srandom(1);    /* set the default seed    */
+            ok = s == 1;
+
+#if USE_GNU_RANDOM_R
+            if (ok)                                /* seed the GNU version    */
+               ok = initstate_r(1, gnustate, sizeof gnustate, &gnu) == 0;
+#elif ! defined WIN32
+            if (ok)
+               srandom(1);                         /* seed the GNU version    */
+#endif
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_random()"))
+         {
+            int i;
+            for (i = 0; i < 10000000; i++)         /* 10 million tries        */
+            {
+#if USE_GNU_RANDOM_R
+               int32_t r = 0;
+               unsigned int g;
+               (void) random_r(&gnu, &r);
+               g = (unsigned int) r;
+#elif ! defined WIN32
+               unsigned int g = random();
+#endif
+               unsigned int o = xpccut_random();
+               if (i < SEED_1_RESULTS_SIZE)
+                  ok = o == gs_selinger_results[i];
+
+#ifndef WIN32
+               if (ok)
+                  ok = o == g;
+#endif
+
+               if (! ok)
+               {
+                  xpccut_errprint(_("random() results don't match"));
+                  break;
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_rand()"))
+         {
+            int i;
+            for (i = 0; i < 10000000; i++)         /* 10 million tries        */
+            {
+               unsigned int o = xpccut_rand(1000000);
+               ok = /* (o >= 0) && */ (o < 1000000);
+               if (! ok)
+               {
+                  xpccut_errprint(_("xpccut_rand() gave unexpected result"));
+                  break;
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test for the memcmp() function.
+ *
+ * \group
+ *    9. Random numbers (sort of)
+ *
+ * \case
+ *    3. memcmp()
+ *
+ * \test
+ *    -  memcmp()
+ *
+ *    The reason for this test is to clarify what memcmp() returns and to
+ *    make sure it returns the same set of values on any platform.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_09_03 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 9, 3, "Random numbers", _("Comparison to GNU random()")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "Equal"))
+         {
+            int s = memcmp("012345", "012345", 6);
+            ok = s == 0;
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Less than (1)"))
+         {
+            int s = memcmp("012345", "A12345", 6);
+            ok = s == -1;
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Less than (2)"))
+         {
+            int s = memcmp("012345", "0B2345", 6);
+            ok = s == -1;
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Greater than (1)"))
+         {
+            int s = memcmp("A12345", "012345", 6);
+            ok = s == 1;
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Greater than (2)"))
+         {
+            int s = memcmp("0B2345", "012345", 6);
+            ok = s == 1;
+            unit_test_status_pass(&status, ok);
+         }
+
+      }
+   }
+   return status;
+}
+
+/**
+ *    Provides a unit test for the re-entrant random-number generators.
+ *
+ * \group
+ *    9. Random numbers.
+ *
+ * \case
+ *    4. Re-entrant generators.
+ *
+ * \test
+ *    -  xpccut_rng_init()
+ *    -  xpccut_rng_next()
+ *    -  xpccut_rng_range()
+ *    -  xpccut_rng_fill()
+ *    -  xpccut_rng_fill_bytes()
+ *    -  xpccut_rng_default()
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+static unit_test_status_t
+unit_unit_test_09_04 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 9, 4, "Random numbers", _("Re-entrant generators")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         xpccut_rng_t rng1, rng2;
+
+         /*  1 */
+
+         if (unit_test_status_next_subtest(&status, "Null and bad parameters"))
+         {
+            unsigned int v;
+            unsigned char b;
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();             /* hide the error messages */
+            ok = ! xpccut_rng_init(nullptr, XPCCUT_RNG_GLIBC, 2);
+            if (ok)
+               ok = ! xpccut_rng_init(&rng1, (xpccut_rng_engine_t) 99, 2);
+
+            if (ok)
+               ok = xpccut_rng_next(nullptr) == 0;
+
+            if (ok)
+               ok = xpccut_rng_range(nullptr, 10) == (unsigned int) -1;
+
+            if (ok)
+               ok = xpccut_rng_init(&rng1, XPCCUT_RNG_GLIBC, 2);
+
+            if (ok)
+               ok = xpccut_rng_range(&rng1, 0) == (unsigned int) -1;
+
+            if (ok)
+               ok = ! xpccut_rng_fill(nullptr, &v, 1);
+
+            if (ok)
+               ok = ! xpccut_rng_fill(&rng1, nullptr, 1);
+
+            if (ok)
+               ok = ! xpccut_rng_fill(&rng1, &v, -1);
+
+            if (ok)
+               ok = ! xpccut_rng_fill_bytes(&rng1, &b, -1);
+
+            if (ok)
+               ok = ! xpccut_rng_fill_bytes(nullptr, &b, 1);
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "glibc engine"))
+         {
+            int i;
+            ok = xpccut_rng_init(&rng1, XPCCUT_RNG_GLIBC, 1);
+            for (i = 0; ok && i < SEED_1_RESULTS_SIZE; i++)
+               ok = xpccut_rng_next(&rng1) == gs_selinger_results[i];
+
+            if (ok)
+            {
+               (void) xpccut_srandom(1234);
+               ok = xpccut_rng_init(&rng1, XPCCUT_RNG_GLIBC, 1234);
+               for (i = 0; ok && i < 1000; i++)
+               {
+                  if (i % 2 == 0)
+                     ok = xpccut_rng_next(&rng1) == xpccut_random();
+                  else
+                     ok = xpccut_rng_range(&rng1, 77) == xpccut_rand(77);
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "xoshiro256** engine"))
+         {
+            static const unsigned char s_reference[24] =   /* 11520, 0,  */
+            {                                               /* 1509978240 */
+               0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x80, 0x70, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00
+            };
+            unsigned char bytes[24];
+            ok = xpccut_rng_init(&rng1, XPCCUT_RNG_XOSHIRO, 2);
+            if (ok)
+            {
+               rng1.m_S[0] = 1;                 /* the reference test state  */
+               rng1.m_S[1] = 2;
+               rng1.m_S[2] = 3;
+               rng1.m_S[3] = 4;
+               ok = xpccut_rng_fill_bytes(&rng1, bytes, 24);
+            }
+            if (ok)
+               ok = memcmp(bytes, s_reference, sizeof s_reference) == 0;
+
+            if (ok)
+            {
+               int i;
+               int same = 0;
+               ok = xpccut_rng_init(&rng1, XPCCUT_RNG_XOSHIRO, 99);
+               if (ok)
+                  ok = xpccut_rng_init(&rng2, XPCCUT_RNG_XOSHIRO, 100);
+
+               for (i = 0; ok && i < 1000; i++)
+               {
+                  unsigned int v = xpccut_rng_next(&rng1);
+                  ok = v <= 0x7FFFFFFFU;          /* 31 bits     */
+                  if (v == xpccut_rng_next(&rng2))
+                     same++;
+               }
+               if (ok)
+                  ok = same < 5;                /* different seeds differ    */
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Reseeding reproduces"))
+         {
+            xpccut_rng_engine_t e;
+            for (e = XPCCUT_RNG_GLIBC; ok && e <= XPCCUT_RNG_XOSHIRO; e++)
+            {
+               unsigned int first[50];
+               int i;
+               ok = xpccut_rng_init(&rng1, e, 4321);
+               if (ok)
+                  ok = xpccut_rng_fill(&rng1, first, 50);
+
+               if (ok)
+                  ok = xpccut_rng_init(&rng1, e, 4321);
+
+               for (i = 0; ok && i < 50; i++)
+                  ok = xpccut_rng_next(&rng1) == first[i];
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Bulk fills"))
+         {
+            xpccut_rng_engine_t e;
+            for (e = XPCCUT_RNG_GLIBC; ok && e <= XPCCUT_RNG_XOSHIRO; e++)
+            {
+               unsigned int values[100];
+               unsigned char bytes[37];
+               unsigned char again[37];
+               int i;
+               ok = xpccut_rng_init(&rng1, e, 777);
+               if (ok)
+                  ok = xpccut_rng_init(&rng2, e, 777);
+
+               if (ok)
+                  ok = xpccut_rng_fill(&rng1, values, 100);
+
+               for (i = 0; ok && i < 100; i++)
+                  ok = xpccut_rng_next(&rng2) == values[i];
+
+               if (ok)
+                  ok = xpccut_rng_fill_bytes(&rng1, bytes, 37);
+
+               if (ok)
+                  ok = xpccut_rng_fill_bytes(&rng2, again, 37);
+
+               if (ok)
+                  ok = memcmp(bytes, again, sizeof bytes) == 0;
+
+               for (i = 0; ok && i < 1000; i++)
+                  ok = xpccut_rng_range(&rng1, 10) < 10;
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "xpccut_rng_default()"))
+         {
+            xpccut_rng_t * rng = xpccut_rng_default();
+            ok = cut_not_nullptr(rng);
+            if (ok)
+               ok = xpccut_rng_init(rng, XPCCUT_RNG_XOSHIRO, 55);
+
+            if (ok)
+               ok = xpccut_rng_init(&rng1, XPCCUT_RNG_XOSHIRO, 56);
+
+            if (ok)                             /* srandom() keeps engine    */
+               ok = xpccut_srandom(56) == 56 && rng->m_Engine ==
+                  XPCCUT_RNG_XOSHIRO;
+
+            if (ok)
+               ok = xpccut_random() == xpccut_rng_next(&rng1);
+
+            if (cut_not_nullptr(rng))           /* restore the default       */
+               (void) xpccut_rng_init(rng, XPCCUT_RNG_GLIBC, 1);
+
+            unit_test_status_pass(&status, ok);
+         }
+      }
+   }
+   return status;
+}
+
+/**
+ * \param s1
+ *    Provides the first string to match.
+ *
+ * \param s2
+ *    Provides the second string to match.
+ *
+ * \param bytecount
+ *    The number of bytes to compare.
+ */
+
+static cbool_t
+xpccut_match
+(
+   const char * s1,
+   const char * s2,
+   int bytecount
+)
+{
+   int mismatch = memcmp(s1, s2, bytecount);
+   cbool_t ok = mismatch == 0;
+   if (! ok)
+   {
+      if (! xpccut_is_silent())
+      {
+         if (mismatch < 0)
+            mismatch = -mismatch;
+
+         xpccut_print
+         (
+            "? Mismatch at character %d ('0x%02x' versus '0x%02x')\n",
+            mismatch, s1[mismatch], s2[mismatch]
+         );
+      }
+   }
+   return ok;
+}
+
+/**
+ *    Provides a unit test for the fuzz-related functions.
+ *
+ * \group
+ *   10. Fuzz-testing
+ *
+ * \case
+ *    1. Character-set building
+ *
+ * \test
+ *    -  xpccut_fuzz(), with XPCCUT_FF_DUMP_CHARSET set.  Nothing is done
+ *       except to build the character-set that would be used to construct
+ *       the fuzz string, and return this character set for verification.
+ *    -  xpccut_build_character_set() is the hidden (static) function that
+ *       builds the character set.
+ *    -  xpccut_exclude_characters() pares out any "excluded characters"
+ *       that were specified.
+ *    -  xpccut_dump_string() provides a visual test of the output if the
+ *       user specifies the --show-values option on the command-line.
+ *
+ * \param options
+ *    Provides the command-line options for the unit-test application.
+ *
+ * \return
+ *    Returns the unit-test status object needed by the protocol.
+ */
+
+#define FAKE_SIZE  1                   // avoids an error
+
+static unit_test_status_t
+unit_unit_test_10_01 (const unit_test_options_t * options)
+{
+   unit_test_status_t status;
+   cbool_t ok = unit_test_status_initialize
+   (
+      &status, options, 10, 1, "Fuzz functions", _("Character-set building")
+   );
+   if (ok)
+   {
+      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
+      {
+         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+      }
+      else
+      {
+         /*
+          * This comparision string is useful in checking some of the
+          * results.  The bytes in it range from 0 to 256.  To use it, pick
+          * the right offset and size to match the string you want to
+          * compare.
+          */
+
+         char comparison_string[260];
+         int i;
+         for (i = 0; i < 256; i++)
+            comparison_string[i] = (char) i;
+
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "unit_test_status_pass()"))
+         if (unit_test_status_next_subtest(&status, "xpccut_dump_string()"))
          {
-            unit_test_status_pass(&status, true);
-            ok =
-            (
-               (status.m_Subtest_Error_Count == 0) &&
-               (status.m_Failed_Subtest == 0)
-            );
-            if (! ok)
+            if (unit_test_options_show_values(options))
             {
-               (void) unit_test_status_fail(&status);    /* create a failure  */
-               if (unit_test_options_is_verbose(options))
+               /*
+                * This test is just toying around.
+                *
+                * const char * teststring =
+                *    "(void) unit_test_load(&testbattery, unit_unit_test_02_27);"
+                *    "g\n\a\t\b\v\"\\g"
+                *    "g\x01\x02\x03\x04\x05\x06\x07\x08\x09g"
+                *    "\0"
+                *    ;
+                *
+                * We extend the string by one character to be able to output
+                * the final null character.
+                *
+                * xpccut_dump_string(teststring, strlen(teststring)+1);
+                */
+
+               char teststring[260];
+               int i;
+               for (i = 0; i < 260; i++)
+                  teststring[i] = (char) i;
+
+               xpccut_dump_string(teststring, 260);
+
+               /*
+                * This test is a bit bogus, but it is just a sanity check.
+                */
+
+               ok = xpccut_match(&teststring[0], &comparison_string[0], 256);
+               if (! ok)
                {
-                  fprintf
-                  (
-                     stderr, "%s %s\n",
-                     "unit_test_status_pass()", _("internal failure")
-                  );
+                  xpccut_print("=========== Comparison String ===========\n");
+                  xpccut_dump_string(comparison_string, 260);
                }
+               unit_test_status_pass(&status, ok);
             }
-            unit_test_status_pass(&status, ok);
          }
 
          /*  2 */
 
-         if
-         (
-            ok &&
-            unit_test_status_next_subtest(&status, "unit_test_status_fail()")
-         )
+         if (unit_test_status_next_subtest(&status, "Default character set"))
          {
-            ok = unit_test_status_fail_deliberately(&status);
+            char character_set[256];
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], sizeof(character_set), FAKE_SIZE,
+               XPCCUT_SEED_SKIP,
+               XPCCUT_FF_DUMP_CHARSET,
+               nullptr, nullptr, nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, sizeof(character_set));
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
             if (ok)
+               ok = xpccut_match(&character_set[0], &comparison_string[1], 255);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Letters only"))
+         {
+            char character_set[256];
+            int size_to_use = 54;         // don't need sizeof(character_set)
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr, nullptr, nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
             {
-               ok =
-               (
-                  (status.m_Subtest_Error_Count == 1) &&
-                  (status.m_Failed_Subtest == 2)
-               );
-               unit_test_status_pass(&status, ok); /* convert it to a "pass"  */
-               if (ok)
-               {
-                  status.m_Subtest_Error_Count--;  /* direct access (bad) !!! */
-                  status.m_Failed_Subtest = 0;     /* direct access (bad) !!! */
-               }
+               xpccut_dump_string(character_set, size_to_use);
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &comparison_string[65], 26);
+
+            if (ok)
+               ok = xpccut_match(&character_set[26], &comparison_string[97], 26);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Numbers only"))
+         {
+            char character_set[256];
+            int size_to_use = 18;         // don't need sizeof(character_set)
+            const char * number_stuff = "0123456789+-.";
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_NUMBERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr, nullptr, nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, size_to_use);
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &number_stuff[0], 13);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Letters and numbers"))
+         {
+            char character_set[256];
+            int size_to_use = 66;         // don't need sizeof(character_set)
+            const char * char_stuff =
+               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+               "abcdefghijklmnopqrstuvwxyz"
+               "0123456789+-."
+               ;
+            int length = strlen(char_stuff);
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_NUMBERS_ONLY |
+                   XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr, nullptr, nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, size_to_use);
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "Uppcase letters/numbers"))
+         {
+            char character_set[256];
+            int size_to_use = 42;         // don't need sizeof(character_set)
+            const char * char_stuff =
+               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+               "0123456789+-."
+               ;
+            int length = strlen(char_stuff);
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_NUMBERS_ONLY |
+                   XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr,
+               "abcdefghijklmnopqrstuvwxyz",
+               nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, size_to_use);
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  7 */
+
+         if (unit_test_status_next_subtest(&status, "Lowercase letters special"))
+         {
+            char character_set[256];
+            int size_to_use = 30;         // don't need sizeof(character_set)
+            const char * char_stuff = "abcdefghijklmnopqrstuvwxyz";
+            int length = strlen(char_stuff);
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_DUMP_CHARSET,
+               char_stuff,
+               nullptr, nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, size_to_use);
+            }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  8 */
+
+         if (unit_test_status_next_subtest(&status, "Lowercase consonants"))
+         {
+            char character_set[256];
+            int size_to_use = 30;         // don't need sizeof(character_set)
+            const char * char_stuff = "abcdefghijklmnopqrstuvwxyz";
+            const char * consonants = "bcdfghjklmnpqrstvwxyz";
+            int length = strlen(consonants);
+            unsigned int seed = xpccut_fuzz
+            (
+               &character_set[0], size_to_use,
+               FAKE_SIZE, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_DUMP_CHARSET,
+               char_stuff,
+               "aeiou",
+               nullptr, nullptr
+            );
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_dump_string(character_set, size_to_use);
             }
+            ok = seed != XPCCUT_SEED_ERROR;
+            if (ok)
+               ok = xpccut_match(&character_set[0], &consonants[0], length);
+
+            unit_test_status_pass(&status, ok);
          }
-         /*
-          * This visual duration check is useless.
-          *
-          * if (ok)
-          *    xpccut_ms_sleep(500);               // a visual duration check
-          *
-          */
       }
    }
    return status;
 }
 
 /**
- *    Provides tests of some of the macros, so we can verify they are being
- *    defined properly.
- *
- * \group
- *    7. Macro tests
+ *    Generates a single random character.
+ *    The main purpose of this function is to test the randomness of the
+ *    generated characters, mostly to make sure our algorithms are not
+ *    flawed.
  *
- * \case
- *    1. cut_not_nullptr() and cut_is_nullptr() macros.
+ * \param destination
+ *    Provides the destination buffer.
  *
- * \param options
- *    Provides the command-line options for the unit-test application.
+ * \param dlength
+ *    Provides the length of the destination buffer.
  *
  * \return
- *    Returns the unit-test status object needed by the protocol.
+ *    Returns 'true' if the function succeeded.
  */
 
-static unit_test_status_t
-unit_unit_test_07_01 (const unit_test_options_t * options)
+static cbool_t
+xpccut_fuzz_single_character
+(
+   char * destination,
+   int dlength
+)
 {
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
+   int number_of_bytes = 1;                           /* very short integers  */
+   int seed = xpccut_fuzz
    (
-      &status, options, 7, 1, "XPCCUT", _("cut_xxx_nullptr() tests")
+      destination, dlength,
+      number_of_bytes,
+      XPCCUT_SEED_SKIP,
+      XPCCUT_FF_DEFAULT,
+      nullptr,                                        /* allowed characters   */
+      nullptr,                                        /* excluded characters  */
+      nullptr,                                        /* prologue characters  */
+      nullptr                                         /* epilogue characters  */
    );
-   if (ok)
-   {
-      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
-      {
-         unit_test_status_pass(&status, true);     /* no, force it to pass    */
-      }
-      else
-      {
-         const char * good = "allo";
-         const char * bad = nullptr;
-
-         /*  1 */
-
-         if (unit_test_status_next_subtest(&status, "cut_not_nullptr()"))
-         {
-#ifdef XPC_NO_NULLPTR
-            ok = cut_not_nullptr(good) == true;
-            if (ok)
-               ok = cut_not_nullptr(bad) == true;
-#else
-            ok = cut_not_nullptr(good) == true;
-            if (ok)
-               ok = cut_not_nullptr(bad) == false;
-#endif
-            unit_test_status_pass(&status, ok);
-         }
-
-         /*  2 */
-
-         if (unit_test_status_next_subtest(&status, "cut_is_nullptr()"))
-         {
-#ifdef XPC_NO_NULLPTR
-            ok = cut_is_nullptr(good) == false;
-            if (ok)
-               ok = cut_is_nullptr(bad) == false;
-#else
-            ok = cut_is_nullptr(good) == false;
-            if (ok)
-               ok = cut_is_nullptr(bad) == true;
-#endif
-            unit_test_status_pass(&status, ok);
-         }
-      }
-   }
-   return status;
+   return seed != XPCCUT_SEED_ERROR;
 }
 
 /**
- *    Provides tests of some of the macros, so we can verify they are being
- *    defined properly.
+ *    Generates a two-digit random number string.
  *
- * \group
- *    7. Macro tests
+ * \param destination
+ *    Provides the destination buffer.
  *
- * \case
- *    2. cut_not_thisptr() and cut_is_thisptr() macros.
+ * \param dlength
+ *    Provides the length of the destination buffer.
  *
- * \param options
- *    Provides the command-line options for the unit-test application.
+ * \param extra_flags
+ *    Additional flags over and above the built-in XPCCUT_FF_NUMBERS_ONLY
+ *    flag.
  *
  * \return
- *    Returns the unit-test status object needed by the protocol.
+ *    Returns 'true' if the function succeeded.
  */
 
-static unit_test_status_t
-unit_unit_test_07_02 (const unit_test_options_t * options)
+static cbool_t
+xpccut_fuzz_two_byte_integers
+(
+   char * destination,
+   int dlength,
+   xpccut_fuzz_flags_t extra_flags
+)
 {
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
+   int number_of_bytes = 2;                           /* very short integers  */
+   xpccut_fuzz_flags_t flags = XPCCUT_FF_NUMBERS_ONLY | extra_flags;
+   int seed = xpccut_fuzz
    (
-      &status, options, 7, 2, "XPCCUT", _("cut_xxx_thisptr() tests")
+      destination, dlength,
+      number_of_bytes,
+      XPCCUT_SEED_SKIP,
+      flags,
+      nullptr,                                        /* allowed characters   */
+      "+-.",                                          /* excluded characters  */
+      nullptr,                                        /* prologue characters  */
+      nullptr                                         /* epilogue characters  */
    );
-   if (ok)
-   {
-      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
-      {
-         unit_test_status_pass(&status, true);     /* no, force it to pass    */
-      }
-      else
-      {
-#ifndef XPC_NO_THISPTR
-         const char * good = "allo";
-         const char * bad = nullptr;
-#endif
-
-         /*  1 */
-
-         if (unit_test_status_next_subtest(&status, "cut_not_thisptr()"))
-         {
-#ifdef XPC_NO_THISPTR
-
-            /*
-             * Note that this code will never be run -- it is prevented in
-             * main(), since the trying to do stuff with a null pointer is
-             * inevitably a segfault.
-             */
-
-            ok = cut_not_thisptr(nullptr) == false;
-            if (ok)
-               ok = cut_not_thisptr(nullptr) == false;
-#else
-            ok = cut_not_thisptr(good) == false;
-            if (ok)
-               ok = cut_not_thisptr(bad) == true;
-#endif
-            unit_test_status_pass(&status, ok);
-         }
+   return seed != XPCCUT_SEED_ERROR;
+}
 
-         /*  2 */
+/**
+ *    Generates a random string of random size from 0 to 10 characters.
+ *    The main purpose of this function is to test the randomness of the
+ *    generated characters, mostly to make sure our algorithms are not
+ *    flawed.
+ *
+ * \param destination
+ *    Provides the destination buffer.
+ *
+ * \param dlength
+ *    Provides the length of the destination buffer.
+ *
+ * \return
+ *    Returns 'true' if the function succeeded.
+ */
 
-         if (unit_test_status_next_subtest(&status, "cut_is_thisptr()"))
-         {
-#ifdef XPC_NO_THISPTR
-            ok = cut_is_thisptr(nullptr) == true;
-            if (ok)
-               ok = cut_is_thisptr(nullptr) == true;
-#else
-            ok = cut_is_thisptr(good) == true;
-            if (ok)
-               ok = cut_is_thisptr(bad) == false;
-#endif
-            unit_test_status_pass(&status, ok);
-         }
-      }
-   }
-   return status;
+static cbool_t
+xpccut_fuzz_random_size_string
+(
+   char * destination,
+   int dlength
+)
+{
+   int number_of_bytes = 10;                          /* very short integers  */
+   int seed = xpccut_fuzz
+   (
+      destination, dlength,
+      number_of_bytes,
+      XPCCUT_SEED_SKIP,
+      XPCCUT_FF_RANDOM_SIZE,
+      nullptr,                                        /* allowed characters   */
+      nullptr,                                        /* excluded characters  */
+      nullptr,                                        /* prologue characters  */
+      nullptr                                         /* epilogue characters  */
+   );
+   return seed != XPCCUT_SEED_ERROR;
 }
 
 /**
- *    Provides tests of some of the macros, so we can verify they are being
- *    defined properly.
+ *    Provides a unit test for the fuzz-related functions.
  *
  * \group
- *    7. Macro tests
+ *   10. Fuzz-testing
  *
  * \case
- *    3. xpccut_thisptr() macro.
+ *    2. Small numeric strings.
+ *
+ * \test
+ *    -  xpccut_fuzz()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12656,12 +24421,12 @@ unit_unit_test_07_02 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_07_03 (const unit_test_options_t * options)
+unit_unit_test_10_02 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 7, 3, "XPCCUT", _("xpccut_thisptr() tests")
+      &status, options, 10, 2, "Fuzz functions", _("Small numeric strings")
    );
    if (ok)
    {
@@ -12671,32 +24436,67 @@ unit_unit_test_07_03 (const unit_test_options_t * options)
       }
       else
       {
-#ifndef XPC_NO_THISPTR
-         const char * good = "allo";
-         const char * bad = nullptr;
-#endif
-
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_thisptr()"))
-         {
+         if (unit_test_status_next_subtest(&status, "2-byte integers"))
+         {
+            int i, j, k;
+            char destination[4];
+            int histogram[100];
+            if (unit_test_options_show_values(options))
+            {
+               // nada
+            }
+
+            for (i = 0; i < 100; i++)
+               histogram[i] = 0;
+
+            (void) xpccut_set_seed(99);
 
-#ifdef XPC_NO_THISPTR
+            // for (i = 0; i < 100000; i++)
 
-            /*
-             * Note that this code will never be run -- it is prevented in
-             * main(), since the trying to do stuff with a null pointer is
-             * inevitably a segfault.
-             */
+            for (i = 0; i < 1000; i++)
+            {
+               int value;
+               ok = xpccut_fuzz_two_byte_integers
+               (
+                  destination, sizeof(destination),
+                  XPCCUT_FF_DEFAULT
+               );
+               if (ok)
+               {
+                  value = atoi(destination);
+                  if (unit_test_options_show_values(options))
+                     xpccut_print("%2d\n", value);
 
-            ok = xpccut_thisptr(nullptr) == true;
-            if (ok)
-               ok = xpccut_thisptr(nullptr) == true;
-#else
-            ok = xpccut_thisptr(good) == true;
-            if (ok)
-               ok = xpccut_thisptr(bad) == false;
-#endif
+                  if (value >= 0 && value < 100)
+                     histogram[value]++;
+                  else
+                  {
+                     xpccut_errprint(_("bad numerical value encountered"));
+                     break;
+                  }
+               }
+               else
+                  break;
+            }
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_print
+               (
+         "        0     1     2     3     4     5     6     7     8     9\n"
+         "  ==============================================================\n"
+               );
+               for (i = 0, k = 0; i < 10; i++)
+               {
+                  xpccut_print("%2d| ", i);
+                  for (j = 0; j < 10; j++)
+                  {
+                     xpccut_print(" %4d ", histogram[k++]);
+                  }
+                  xpccut_print("\n");
+               }
+            }
             unit_test_status_pass(&status, ok);
          }
       }
@@ -12705,21 +24505,32 @@ unit_unit_test_07_03 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit test for xpccut_nullptr() in the portable_subset.c
- *    module.
- *
- *    Why?  We don't really want deep testing on this purely internal
- *    module, but we need a good example of the usage of coverage testing.
- *
- *    Hence, this test group is provided.  It can be disabled via the
- *    USE_XPCCUT_NULLPTR_TEST in order to test the usefulness of coverage
- *    testing.
+ *    Provides a unit test for the fuzz-related functions.
  *
  * \group
- *    8. Special null-pointer test.
+ *   10. Fuzz-testing
  *
  * \case
- *    1. xxxx
+ *    3. Single-character randomness test
+ *
+ * \test
+ *    -  xpccut_fuzz()
+ *
+ *    This test is a bit different.  Here is its features:
+ *
+ *       -  Generates only single-character strings
+ *       -  Outputs the characters to standard output in a format suitable
+ *          for usage with the dieharder application.
+ *
+ \verbatim
+      $ ./unit_test_test --group 9 --case 3 --silent --dump-text > 10_03.input
+      $  dieharder -a -g 202 -f 10_03.input
+ \endverbatim
+ *
+ *    With the use of the crappy rand() function, the output looks random,
+ *    but FAILs all of the dieharder tests (which all told take a lot of
+ *    minutes).  Not yet sure if we really need to use an improved random
+ *    number generator or not.
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12729,12 +24540,13 @@ unit_unit_test_07_03 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_08_01 (const unit_test_options_t * options)
+unit_unit_test_10_03 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 8, 1, "xpccut_nullptr", _("01.01 Coverage Test Recap")
+      &status, options, 10, 3, "Fuzz functions",
+      _("Single-character randomness test")
    );
    if (ok)
    {
@@ -12744,90 +24556,101 @@ unit_unit_test_08_01 (const unit_test_options_t * options)
       }
       else
       {
-
-#ifdef USE_XPCCUT_NULLPTR_TEST
-
-         if (unit_test_options_show_values(options))
-            fprintf(stdout, "  %s\n", _("No values to show in this test"));
-
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_nullptr()"))
+         if (unit_test_status_next_subtest(&status, "Single character"))
          {
-            ok = ! xpccut_nullptr(nullptr, nullptr, nullptr);
-            unit_test_status_pass(&status, ok);
-         }
-
-         /*  2 */
+            int i, j, k;
+            char dest[4];
+            int histogram[256];
+            int count = 1000 * 256;
+            int seed = 22;
+            if (unit_test_options_show_values(options))
+            {
+               // nada
+            }
 
-         if (ok && unit_test_status_next_subtest(&status, "xpccut_nullptr()"))
-         {
-            // more to come
-         }
-#else
-         unit_test_status_pass(&status, true);     /* no, force it to pass    */
+            for (i = 0; i < 256; i++)
+               histogram[i] = 0;
 
-#endif      // USE_XPCCUT_NULLPTR_TEST
+            xpccut_set_seed(seed);
+            if (g_do_dump_text)
+            {
+               xpccut_print
+               (
+      "#==================================================================\n"
+      "# generator xpccut_fuzz seed = %d\n"
+      "#==================================================================\n"
+      "type: d\n"
+      "count: %d\n"
+      "numbit: 8\n"
+                  ,
+                  seed, count
+               );
+            }
+            for (i = 0; i < count; i++)
+            {
+               unsigned value;
+               ok = xpccut_fuzz_single_character(dest, sizeof(dest));
+               if (ok)
+               {
+                  value = (unsigned) dest[0];
+                  value &= 0xff;
+                  histogram[value]++;
+                  if (value >= 256)
+                  {
+                     xpccut_errprint(_("bad character value encountered"));
+                     break;
+                  }
+                  if (g_do_dump_text)
+                     xpccut_print("%d\n", value);
+               }
+               else
+               {
+                  xpccut_errprint_func(_("fuzz error"));
+                  break;
+               }
+            }
 
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_print
+               (
+         "        0     1     2     3     4     5     6     7     8     9\n"
+         "  ==============================================================\n"
+               );
+               for (i = 0, k = 0; i < (256/10+1); i++)
+               {
+                  xpccut_print("%2d| ", i);
+                  for (j = 0; j < 10; j++)
+                  {
+                     xpccut_print(" %4d ", histogram[k++]);
+                     if (k >= 256)
+                        break;
+                  }
+                  xpccut_print("\n");
+                  if (k >= 256)
+                     break;
+               }
+            }
+            unit_test_status_pass(&status, ok);
+         }
       }
    }
    return status;
 }
 
 /**
- *    Provides the number of data points we have for checking
- *    xpccut_random().
- */
-
-#define SEED_1_RESULTS_SIZE         60
-
-/**
- *    Provides regression data to test the random-number generator.
- *
- *    The values generated with a seed of 1 should match this list.  There
- *    are 60 values in this list.
- */
-
-static unsigned int gs_selinger_results[SEED_1_RESULTS_SIZE] =
-{
-   1804289383,  846930886, 1681692777, 1714636915, 1957747793,
-    424238335,  719885386, 1649760492,  596516649, 1189641421,
-   1025202362, 1350490027,  783368690, 1102520059, 2044897763,
-   1967513926, 1365180540, 1540383426,  304089172, 1303455736,
-     35005211,  521595368,  294702567, 1726956429,  336465782,
-    861021530,  278722862,  233665123, 2145174067,  468703135,
-   1101513929, 1801979802, 1315634022,  635723058, 1369133069,
-   1125898167, 1059961393, 2089018456,  628175011, 1656478042,
-   1131176229, 1653377373,  859484421, 1914544919,  608413784,
-    756898537, 1734575198, 1973594324,  149798315, 2038664370,
-   1129566413,  184803526,  412776091, 1424268980, 1911759956,
-    749241873,  137806862,   42999170,  982906996,  135497281
-};
-
-/**
- *    Provides the maximum number of xpccut_random() calls for subtest 3 of
- *    test 09.01.
- *
- *    We used UINT_MAX, but this makes the unit test take a few minutes.
- *    So, having already verified that we never get a value equal to the
- *    first random number we pulled within UINT_MAX tries, we content
- *    ourselves with skipping past this test, essentially.
- */
-
-#define MAX_COUNT_09_01_03    100      //  UINT_MAX
-
-/**
- *    Provides a unit test for the random number functions.
+ *    Provides a unit test for the fuzz-related functions.
  *
  * \group
- *    9. Random numbers
+ *   10. Fuzz-testing
  *
  * \case
- *    1. Basics
+ *    4. Random-size strings
  *
  * \test
- *    -  xpccut_srandom()
- *    -  xpccut_random()
+ *    -  xpccut_fuzz()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12837,12 +24660,12 @@ static unsigned int gs_selinger_results[SEED_1_RESULTS_SIZE] =
  */
 
 static unit_test_status_t
-unit_unit_test_09_01 (const unit_test_options_t * options)
+unit_unit_test_10_04 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 9, 1, "Random numbers", _("Basics")
+      &status, options, 10, 4, "Fuzz functions", _("Random-size strings")
    );
    if (ok)
    {
@@ -12854,93 +24677,31 @@ unit_unit_test_09_01 (const unit_test_options_t * options)
       {
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_srandom()"))
-         {
-            unsigned int s = xpccut_srandom(1);    /* set the default seed    */
-            ok = s == 1;
-            unit_test_status_pass(&status, ok);
-         }
-
-         /*  2 */
-
-         if (unit_test_status_next_subtest(&status, "xpccut_random()"))
+         if (unit_test_status_next_subtest(&status, "Random character count"))
          {
-            int i;
-            unsigned int our_results[SEED_1_RESULTS_SIZE];
-            if (unit_test_options_show_values(options))
-            {
-               fprintf
-               (
-                  stdout,
-                  "\n"
-                  "The following results should match the table found at\n"
-                  "http://www.mscs.dal.ca/~selinger/random/\n\n"
-               );
-            }
-            for (i = 0; i < SEED_1_RESULTS_SIZE; i++)
+            char dest[64];
+            int count = 20;
+            int seed = 22;
+            int i;
+            if (unit_test_options_show_values(options))
             {
-               unsigned int o = xpccut_random();
-               ok = o == gs_selinger_results[i];
-               if (ok)
-               {
-                  our_results[i] = o;
-               }
-               else
-               {
-                  xpccut_errprint(_("bad random value"));
-                  break;
-               }
+               // nada
             }
-            if (ok)
+            xpccut_set_seed(seed);
+            for (i = 0; i < count; i++)
             {
-               if (unit_test_options_show_values(options))
+               ok = xpccut_fuzz_random_size_string(dest, sizeof(dest));
+               if (ok)
                {
-                  int i;
-                  int j;
-                  for (i = 0; i < 12; i++)
+                  if (unit_test_options_show_values(options))
                   {
-                     int k = i;
-                     for (j = 0; j < SEED_1_RESULTS_SIZE/12; j++)
-                     {
-                        int o = our_results[k];
-                        fprintf(stdout, "%2d: %10d  ", k, o);
-                        k += 12;
-                     }
-                     fprintf(stdout, "\n");
+                     xpccut_print("  '%s'\n", dest);    // TOO SIMPLE
                   }
-                  fprintf(stdout, "\n");
                }
-            }
-            unit_test_status_pass(&status, ok);
-         }
-
-         /*  3 */
-
-         if (unit_test_status_next_subtest(&status, "Repeats"))
-         {
-            unsigned int s = xpccut_srandom(1234);
-            ok = s == 1234;
-            if (ok)
-            {
-               unsigned int i;
-               unsigned int q;
-               unsigned int r = xpccut_random();
-               for (i = 0; i < MAX_COUNT_09_01_03; i++)
+               else
                {
-                  q = xpccut_random();
-                  if (q == r)
-                  {
-                     ok = false;
-                     if (! xpccut_is_silent())
-                     {
-                        fprintf
-                        (
-                           stdout,
-                           "Duplicate random number after %u iterations.\n", i
-                        );
-                     }
-                     break;
-                  }
+                  xpccut_errprint_func(_("fuzz error"));
+                  break;
                }
             }
             unit_test_status_pass(&status, ok);
@@ -12951,18 +24712,16 @@ unit_unit_test_09_01 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit test for the random number functions.
+ *    Provides a unit test for the fuzz-related functions.
  *
  * \group
- *    9. Random numbers
+ *   10. Fuzz-testing
  *
  * \case
- *    2. Comparison to GNU random()
+ *    4. xpccut_garbled_string()
  *
  * \test
- *    -  xpccut_srandom()
- *    -  xpccut_random()
- *    -  xpccut_rand()
+ *    -  xpccut_garbled_string()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -12972,12 +24731,12 @@ unit_unit_test_09_01 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_09_02 (const unit_test_options_t * options)
+unit_unit_test_10_05 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 9, 2, "Random numbers", _("Comparison to GNU random()")
+      &status, options, 10, 5, "Fuzz functions", _("xpccut_garbled_string()")
    );
    if (ok)
    {
@@ -12989,41 +24748,63 @@ unit_unit_test_09_02 (const unit_test_options_t * options)
       {
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "Seeding"))
+         if (unit_test_status_next_subtest(&status, "Parameter checks"))
          {
-            unsigned int s = xpccut_srandom(1);    /* set the default seed    */
-            ok = s == 1;
+            int r;
+            char source[4] =
+            {
+               "hi!"
+            };
+            if (unit_test_options_show_values(options))
+            {
+               // nada
+            }
+            r = xpccut_garbled_string(nullptr, 1);
+            ok = r < 0;
+            if (ok)
+               r = xpccut_garbled_string(source, 0);
 
-#ifndef WIN32
+            ok = r < 0;
             if (ok)
-               srandom(1);                         /* seed the GNU version    */
-#endif
+               r = xpccut_garbled_string(source, -1);
 
             unit_test_status_pass(&status, ok);
          }
 
          /*  2 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_random()"))
+         if (unit_test_status_next_subtest(&status, "hi!"))
          {
+            unsigned int seed = 10210;
+            char source[4] =
+            {
+               "hi!"
+            };
+            int trial_count = 10;
             int i;
-            for (i = 0; i < 10000000; i++)         /* 10 million tries        */
+            if (unit_test_options_show_values(options))
             {
-#ifndef WIN32
-               unsigned int g = random();
-#endif
-               unsigned int o = xpccut_random();
-               if (i < SEED_1_RESULTS_SIZE)
-                  ok = o == gs_selinger_results[i];
-
-#ifndef WIN32
+               // nada
+            }
+            xpccut_set_seed(seed);
+            for (i = 0; i < trial_count; i++)
+            {
+               int r = xpccut_garbled_string(source, strlen(source));
+               ok = r >= 0;
                if (ok)
-                  ok = o == g;
-#endif
-
-               if (! ok)
                {
-                  xpccut_errprint(_("random() results don't match"));
+                  if (unit_test_options_show_values(options))
+                  {
+                     xpccut_print
+                     (
+                        "  '%s', %d characters changed\n",
+                        source, r
+                     );
+                  }
+               }
+               else
+               {
+                  xpccut_errprint_func(_("fuzz error"));
                   break;
                }
             }
@@ -13032,16 +24813,58 @@ unit_unit_test_09_02 (const unit_test_options_t * options)
 
          /*  3 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_rand()"))
+         if (unit_test_status_next_subtest(&status, "Embedded hi!"))
          {
+            unsigned int seed = 10210;
+            char source[32] =
+            {
+               "I say hi! You say ho!"
+            };
+            int trial_count = 10;
             int i;
-            for (i = 0; i < 10000000; i++)         /* 10 million tries        */
+            int character_change_count[10] =
             {
-               unsigned int o = xpccut_rand(1000000);
-               ok = /* (o >= 0) && */ (o < 1000000);
-               if (! ok)
+               1, 2, 1, 1, 2, 1, 0, 0, 1, 0
+            };
+            if (unit_test_options_show_values(options))
+            {
+               // nada
+            }
+
+            /*
+             * Reset the seed.  We have some control over the random
+             * sequence -- we can make it the same by setting the seed the
+             * same each time.
+             *
+             * We can also make sure the changes are the expected ones, as
+             * an added test of the randomization.
+             */
+
+            xpccut_set_seed(seed);
+            for (i = 0; i < trial_count; i++)
+            {
+               int r = xpccut_garbled_string(&source[6], strlen("hi!"));
+               ok = r >= 0;
+               if (ok)
                {
-                  xpccut_errprint(_("xpccut_rand() gave unexpected result"));
+                  ok = r == character_change_count[i];
+                  if (unit_test_options_show_values(options))
+                  {
+                     xpccut_print
+                     (
+                        "  '%s', %d characters changed\n",
+                        source, r
+                     );
+                  }
+                  if (! ok)
+                  {
+                     xpccut_errprint_func(_("unexpected character change count"));
+                     break;
+                  }
+               }
+               else
+               {
+                  xpccut_errprint_func(_("fuzz error"));
                   break;
                }
             }
@@ -13053,19 +24876,19 @@ unit_unit_test_09_02 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit test for the memcmp() function.
+ *    Provides a unit test for the bulk fuzz functions.
  *
  * \group
- *    9. Random numbers (sort of)
+ *   10. Fuzz-testing
  *
  * \case
- *    3. memcmp()
+ *    6. Bulk fuzz generation
  *
  * \test
- *    -  memcmp()
- *
- *    The reason for this test is to clarify what memcmp() returns and to
- *    make sure it returns the same set of values on any platform.
+ *    -  xpccut_fuzz_charset_init()
+ *    -  xpccut_fuzz_fill()
+ *    -  xpccut_fuzz(), with XPCCUT_FF_BULK set, and the caching of its
+ *       character set
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13075,12 +24898,12 @@ unit_unit_test_09_02 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_09_03 (const unit_test_options_t * options)
+unit_unit_test_10_06 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 9, 3, "Random numbers", _("Comparison to GNU random()")
+      &status, options, 10, 6, "Fuzz functions", _("Bulk fuzz generation")
    );
    if (ok)
    {
@@ -13092,112 +24915,339 @@ unit_unit_test_09_03 (const unit_test_options_t * options)
       {
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "Equal"))
+         if (unit_test_status_next_subtest(&status, "Parameter checks"))
          {
-            int s = memcmp("012345", "012345", 6);
-            ok = s == 0;
+            xpccut_fuzz_charset_t charset;
+            xpccut_rng_t rng;
+            char dest[8];
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = ! xpccut_fuzz_charset_init
+            (
+               nullptr, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
+            {
+               ok = xpccut_fuzz_charset_init
+               (
+                  &charset, XPCCUT_FF_NUMBERS_ONLY, nullptr, nullptr
+               );
+            }
+            if (ok)
+               ok = xpccut_rng_init(&rng, XPCCUT_RNG_XOSHIRO, 10610);
+
+            if (ok)
+               ok = ! xpccut_fuzz_fill(nullptr, &charset, dest, 4);
+
+            if (ok)
+               ok = ! xpccut_fuzz_fill(&rng, nullptr, dest, 4);
+
+            if (ok)
+               ok = ! xpccut_fuzz_fill(&rng, &charset, nullptr, 4);
+
+            if (ok)
+               ok = ! xpccut_fuzz_fill(&rng, &charset, dest, -1);
+
+            if (ok)
+               ok = xpccut_fuzz_fill(&rng, &charset, dest, 0);
+
+            if (ok)
+            {
+               ok = ! xpccut_fuzz_charset_init
+               (
+                  &charset, XPCCUT_FF_NUMBERS_ONLY, nullptr, "0123456789+-."
+               );
+               if (ok)
+                  ok = charset.m_Size == 0;
+
+               if (ok)
+                  ok = ! xpccut_fuzz_fill(&rng, &charset, dest, 4);
+            }
+            if (! silent)
+               xpccut_allow_printing();
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Unbiased byte maps"))
+         {
+            static const xpccut_fuzz_flags_t s_flags[4] =
+            {
+               XPCCUT_FF_DEFAULT, XPCCUT_FF_LETTERS_ONLY,
+               XPCCUT_FF_NUMBERS_ONLY, XPCCUT_FF_DEFAULT
+            };
+            static const char * const s_allowed[4] =
+            {
+               nullptr, nullptr, nullptr, "ab"
+            };
+            int set;
+            for (set = 0; set < 4; set++)
+            {
+               xpccut_fuzz_charset_t charset;
+               int counts[256];
+               int rejects = 0;
+               int b;
+               ok = xpccut_fuzz_charset_init
+               (
+                  &charset, s_flags[set], s_allowed[set], nullptr
+               );
+               if (! ok)
+                  break;
+
+               (void) memset(counts, 0, sizeof(counts));
+               for (b = 0; b < 256; b++)
+               {
+                  if (charset.m_Map[b] == 0)
+                     ++rejects;
+                  else
+                     ++counts[charset.m_Map[b]];
+               }
+               ok = rejects == 256 % charset.m_Size;
+               for (b = 0; ok && b < charset.m_Size; b++)
+               {
+                  unsigned char c = (unsigned char) charset.m_Characters[b];
+                  ok = counts[c] == 256 / charset.m_Size;
+               }
+               if (unit_test_options_show_values(options))
+               {
+                  xpccut_print
+                  (
+                     "  %d characters, %d rejected byte values\n",
+                     charset.m_Size, rejects
+                  );
+               }
+               if (! ok)
+               {
+                  xpccut_errprint_func(_("biased byte map"));
+                  break;
+               }
+            }
             unit_test_status_pass(&status, ok);
          }
 
-         /*  2 */
+         /*  3 */
 
-         if (unit_test_status_next_subtest(&status, "Less than (1)"))
+         if (unit_test_status_next_subtest(&status, "Reproducible fills"))
          {
-            int s = memcmp("012345", "A12345", 6);
-            ok = s == -1;
-            unit_test_status_pass(&status, ok);
-         }
+            char dest_1[5000];
+            char dest_2[5000];
+            xpccut_fuzz_charset_t charset;
+            int engine;
+            ok = xpccut_fuzz_charset_init
+            (
+               &charset, XPCCUT_FF_LETTERS_ONLY, nullptr, nullptr
+            );
+            for (engine = 0; ok && engine < 2; engine++)
+            {
+               xpccut_rng_engine_t e = engine == 0 ?
+                  XPCCUT_RNG_GLIBC : XPCCUT_RNG_XOSHIRO ;
 
-         /*  3 */
+               xpccut_rng_t rng;
+               int i;
+               ok = xpccut_rng_init(&rng, e, 10630);
+               if (ok)
+                  ok = xpccut_fuzz_fill(&rng, &charset, dest_1, 5000);
 
-         if (unit_test_status_next_subtest(&status, "Less than (2)"))
-         {
-            int s = memcmp("012345", "0B2345", 6);
-            ok = s == -1;
+               if (ok)
+                  ok = xpccut_rng_init(&rng, e, 10630);
+
+               if (ok)
+                  ok = xpccut_fuzz_fill(&rng, &charset, dest_2, 5000);
+
+               if (ok)
+                  ok = memcmp(dest_1, dest_2, sizeof(dest_1)) == 0;
+
+               for (i = 0; ok && i < 5000; i++)
+               {
+                  char c = dest_1[i];
+                  ok = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+               }
+
+               if (! ok)
+                  xpccut_errprint_func(_("fill not reproducible"));
+            }
             unit_test_status_pass(&status, ok);
          }
 
          /*  4 */
 
-         if (unit_test_status_next_subtest(&status, "Greater than (1)"))
+         if (unit_test_status_next_subtest(&status, "Even distribution"))
          {
-            int s = memcmp("A12345", "012345", 6);
-            ok = s == 1;
+            char dest[52 * 2000];
+            xpccut_fuzz_charset_t charset;
+            xpccut_rng_t rng;
+            ok = xpccut_fuzz_charset_init
+            (
+               &charset, XPCCUT_FF_LETTERS_ONLY, nullptr, nullptr
+            );
+            if (ok)
+               ok = xpccut_rng_init(&rng, XPCCUT_RNG_XOSHIRO, 10640);
+
+            if (ok)
+               ok = xpccut_fuzz_fill(&rng, &charset, dest, sizeof(dest));
+
+            if (ok)
+            {
+               int counts[256];
+               int i;
+               (void) memset(counts, 0, sizeof(counts));
+               for (i = 0; i < (int) sizeof(dest); i++)
+                  ++counts[(unsigned char) dest[i]];
+
+               for (i = 0; ok && i < charset.m_Size; i++)
+               {
+                  int n = counts[(unsigned char) charset.m_Characters[i]];
+                  ok = n > 1800 && n < 2200;
+                  if (! ok)
+                     xpccut_errprint_func(_("uneven distribution"));
+               }
+            }
             unit_test_status_pass(&status, ok);
          }
 
          /*  5 */
 
-         if (unit_test_status_next_subtest(&status, "Greater than (2)"))
+         if (unit_test_status_next_subtest(&status, "XPCCUT_FF_BULK"))
          {
-            int s = memcmp("0B2345", "012345", 6);
-            ok = s == 1;
+            char dest_1[2001];
+            char dest_2[2001];
+            xpccut_fuzz_charset_t charset;
+            unsigned int seed = xpccut_fuzz
+            (
+               dest_1, sizeof(dest_1), 2000, 10650,
+               XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_BULK,
+               nullptr, nullptr, nullptr, nullptr
+            );
+            ok = seed == 10650;
+            if (ok)
+            {
+               ok = xpccut_fuzz_charset_init
+               (
+                  &charset, XPCCUT_FF_LETTERS_ONLY, nullptr, nullptr
+               );
+            }
+            if (ok)
+            {
+               (void) memset(dest_2, 0, sizeof(dest_2));
+               (void) xpccut_set_seed(10650);
+               ok = xpccut_fuzz_fill
+               (
+                  xpccut_rng_default(), &charset, dest_2, 2000
+               );
+            }
+            if (ok)
+               ok = strlen(dest_1) == 2000;
+
+            if (ok)
+               ok = memcmp(dest_1, dest_2, sizeof(dest_1)) == 0;
+
+            if (unit_test_options_show_values(options))
+               xpccut_print("  '%.40s...'\n", dest_1);
+
+            if (! ok)
+               xpccut_errprint_func(_("bulk string differs from fill"));
+
             unit_test_status_pass(&status, ok);
          }
 
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "Character-set cache"))
+         {
+            char dest_1[256];
+            char dest_2[256];
+            (void) xpccut_fuzz
+            (
+               dest_1, sizeof(dest_1), 8, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr, "abc", nullptr, nullptr
+            );
+            (void) xpccut_fuzz
+            (
+               dest_2, sizeof(dest_2), 8, XPCCUT_SEED_SKIP,
+               XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+               nullptr, "xyz", nullptr, nullptr
+            );
+            ok = strlen(dest_1) == 49 && strlen(dest_2) == 49;
+            if (ok)
+            {
+               ok = cut_is_nullptr(strchr(dest_1, 'a')) &&
+                  cut_not_nullptr(strchr(dest_1, 'x')) &&
+                  cut_not_nullptr(strchr(dest_2, 'a')) &&
+                  cut_is_nullptr(strchr(dest_2, 'x'));
+            }
+            if (ok)
+            {
+               (void) xpccut_fuzz
+               (
+                  dest_2, sizeof(dest_2), 8, XPCCUT_SEED_SKIP,
+                  XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
+                  nullptr, "abc", nullptr, nullptr
+               );
+               ok = strcmp(dest_1, dest_2) == 0;
+            }
+            if (! ok)
+               xpccut_errprint_func(_("stale cached character set"));
+
+            unit_test_status_pass(&status, ok);
+         }
       }
    }
    return status;
 }
 
 /**
- * \param s1
- *    Provides the first string to match.
- *
- * \param s2
- *    Provides the second string to match.
+ *    Provides the context of fuzz_stream_sink(), used by unit-test 10.07.
+ */
+
+typedef struct
+{
+   long long m_Bytes;            /**< The number of bytes received so far.    */
+   unsigned m_Checksum;          /**< A simple sum of the bytes.              */
+   int m_Chunks;                 /**< The number of chunks received so far.   */
+   int m_Chunk_Limit;            /**< Refuse chunks after this many, if > 0.  */
+
+} fuzz_stream_tally_t;
+
+/**
+ *    Receives the chunks of a fuzz stream for unit-test 10.07, and tallies
+ *    them.
  *
- * \param bytecount
- *    The number of bytes to compare.
+ * \return
+ *    Returns 'false' once the chunk limit is reached.
  */
 
 static cbool_t
-xpccut_match
-(
-   const char * s1,
-   const char * s2,
-   int bytecount
-)
+fuzz_stream_sink (void * context, const char * data, int count)
 {
-   int mismatch = memcmp(s1, s2, bytecount);
-   cbool_t ok = mismatch == 0;
-   if (! ok)
-   {
-      if (! xpccut_is_silent())
-      {
-         if (mismatch < 0)
-            mismatch = -mismatch;
-
-         fprintf
-         (
-            stdout,
-            "? Mismatch at character %d ('0x%02x' versus '0x%02x')\n",
-            mismatch, s1[mismatch], s2[mismatch]
-         );
-      }
-   }
-   return ok;
+   fuzz_stream_tally_t * tally = (fuzz_stream_tally_t *) context;
+   int i;
+   for (i = 0; i < count; i++)
+      tally->m_Checksum += (unsigned char) data[i];
+
+   tally->m_Bytes += count;
+   ++tally->m_Chunks;
+   return tally->m_Chunk_Limit == 0 || tally->m_Chunks < tally->m_Chunk_Limit;
 }
 
 /**
- *    Provides a unit test for the fuzz-related functions.
+ *    Provides a unit test for the fuzz-stream functions.
  *
  * \group
  *   10. Fuzz-testing
  *
  * \case
- *    1. Character-set building
+ *    7. Fuzz streams
  *
  * \test
- *    -  xpccut_fuzz(), with XPCCUT_FF_DUMP_CHARSET set.  Nothing is done
- *       except to build the character-set that would be used to construct
- *       the fuzz string, and return this character set for verification.
- *    -  xpccut_build_character_set() is the hidden (static) function that
- *       builds the character set.
- *    -  xpccut_exclude_characters() pares out any "excluded characters"
- *       that were specified.
- *    -  xpccut_dump_string() provides a visual test of the output if the
- *       user specifies the --show-values option on the command-line.
+ *    -  xpccut_fuzz_stream_init()
+ *    -  xpccut_fuzz_stream_length()
+ *    -  xpccut_fuzz_stream_seed()
+ *    -  xpccut_fuzz_stream_read()
+ *    -  xpccut_fuzz_stream_next()
+ *    -  xpccut_fuzz_stream_generate()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13206,15 +25256,13 @@ xpccut_match
  *    Returns the unit-test status object needed by the protocol.
  */
 
-#define FAKE_SIZE  1                   // avoids an error
-
 static unit_test_status_t
-unit_unit_test_10_01 (const unit_test_options_t * options)
+unit_unit_test_10_07 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 10, 1, "Fuzz functions", _("Character-set building")
+      &status, options, 10, 7, "Fuzz functions", _("Fuzz streams")
    );
    if (ok)
    {
@@ -13224,251 +25272,318 @@ unit_unit_test_10_01 (const unit_test_options_t * options)
       }
       else
       {
-         /*
-          * This comparision string is useful in checking some of the
-          * results.  The bytes in it range from 0 to 256.  To use it, pick
-          * the right offset and size to match the string you want to
-          * compare.
-          */
-
-         char comparison_string[260];
-         int i;
-         for (i = 0; i < 256; i++)
-            comparison_string[i] = (char) i;
+         xpccut_fuzz_stream_t stream;
+         char whole[10007];
+         char parts[10007];
 
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "xpccut_dump_string()"))
-         {
-            if (unit_test_options_show_values(options))
-            {
-               /*
-                * This test is just toying around.
-                *
-                * const char * teststring =
-                *    "(void) unit_test_load(&testbattery, unit_unit_test_02_27);"
-                *    "g\n\a\t\b\v\"\\g"
-                *    "g\x01\x02\x03\x04\x05\x06\x07\x08\x09g"
-                *    "\0"
-                *    ;
-                *
-                * We extend the string by one character to be able to output
-                * the final null character.
-                *
-                * xpccut_dump_string(teststring, strlen(teststring)+1);
-                */
-
-               char teststring[260];
-               int i;
-               for (i = 0; i < 260; i++)
-                  teststring[i] = (char) i;
-
-               xpccut_dump_string(teststring, 260);
-
-               /*
-                * This test is a bit bogus, but it is just a sanity check.
-                */
-
-               ok = xpccut_match(&teststring[0], &comparison_string[0], 256);
-               if (! ok)
-               {
-                  fprintf(stdout, "=========== Comparison String ===========\n");
-                  xpccut_dump_string(comparison_string, 260);
-               }
-               unit_test_status_pass(&status, ok);
-            }
-         }
-
-         /*  2 */
-
-         if (unit_test_status_next_subtest(&status, "Default character set"))
+         if (unit_test_status_next_subtest(&status, "Parameter checks"))
          {
-            char character_set[256];
-            unsigned int seed = xpccut_fuzz
+            char dest[8];
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = ! xpccut_fuzz_stream_init
             (
-               &character_set[0], sizeof(character_set), FAKE_SIZE,
-               XPCCUT_SEED_SKIP,
-               XPCCUT_FF_DUMP_CHARSET,
+               nullptr, 100, 10710, XPCCUT_FF_DEFAULT,
                nullptr, nullptr, nullptr, nullptr
             );
-            if (unit_test_options_show_values(options))
+            if (ok)
             {
-               xpccut_dump_string(character_set, sizeof(character_set));
+               ok = ! xpccut_fuzz_stream_init
+               (
+                  &stream, 6, 10710, XPCCUT_FF_DEFAULT,
+                  nullptr, nullptr, "<p>", "</p>"
+               );
             }
-            ok = seed != XPCCUT_SEED_ERROR;
             if (ok)
-               ok = xpccut_match(&character_set[0], &comparison_string[1], 255);
+               ok = xpccut_fuzz_stream_length(&stream) == 0;
 
-            unit_test_status_pass(&status, ok);
-         }
+            if (ok)
+            {
+               ok = ! xpccut_fuzz_stream_init
+               (
+                  &stream, 100, 10710, XPCCUT_FF_NUMBERS_ONLY,
+                  nullptr, "0123456789+-.", nullptr, nullptr
+               );
+            }
+            if (ok)
+            {
+               ok = xpccut_fuzz_stream_init
+               (
+                  &stream, 7, 10710, XPCCUT_FF_DEFAULT,
+                  nullptr, nullptr, "<p>", "</p>"
+               );
+            }
+            if (ok)
+               ok = xpccut_fuzz_stream_read(&stream, -1, dest, 4) == -1;
 
-         /*  3 */
+            if (ok)
+               ok = xpccut_fuzz_stream_read(&stream, 0, nullptr, 4) == -1;
 
-         if (unit_test_status_next_subtest(&status, "Letters only"))
-         {
-            char character_set[256];
-            int size_to_use = 54;         // don't need sizeof(character_set)
-            unsigned int seed = xpccut_fuzz
-            (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
-               nullptr, nullptr, nullptr, nullptr
-            );
-            if (unit_test_options_show_values(options))
+            if (ok)
+               ok = xpccut_fuzz_stream_next(nullptr, dest, 4) == -1;
+
+            if (ok)
+               ok = ! xpccut_fuzz_stream_generate(&stream, nullptr, nullptr);
+
+            if (ok)
             {
-               xpccut_dump_string(character_set, size_to_use);
+               ok = xpccut_fuzz_stream_read(&stream, 0, dest, 8) == 7 &&
+                  memcmp(dest, "<p></p>", 7) == 0;
             }
-            ok = seed != XPCCUT_SEED_ERROR;
             if (ok)
-               ok = xpccut_match(&character_set[0], &comparison_string[65], 26);
+               ok = xpccut_fuzz_stream_read(&stream, 7, dest, 8) == 0;
 
-            if (ok)
-               ok = xpccut_match(&character_set[26], &comparison_string[97], 26);
+            if (! silent)
+               xpccut_allow_printing();
 
             unit_test_status_pass(&status, ok);
          }
 
-         /*  4 */
+         /*  2 */
 
-         if (unit_test_status_next_subtest(&status, "Numbers only"))
+         if (unit_test_status_next_subtest(&status, "Chunks match the whole"))
          {
-            char character_set[256];
-            int size_to_use = 18;         // don't need sizeof(character_set)
-            const char * number_stuff = "0123456789+-.";
-            unsigned int seed = xpccut_fuzz
+            int total = 0;
+            int i;
+            ok = xpccut_fuzz_stream_init
             (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_NUMBERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
-               nullptr, nullptr, nullptr, nullptr
+               &stream, 10007, 10720, XPCCUT_FF_LETTERS_ONLY,
+               nullptr, nullptr, "<p>", "</p>"
             );
-            if (unit_test_options_show_values(options))
+            if (ok)
             {
-               xpccut_dump_string(character_set, size_to_use);
+               ok = xpccut_fuzz_stream_read
+               (
+                  &stream, 0, whole, sizeof(whole)
+               ) == 10007;
+            }
+            while (ok)
+            {
+               int count = xpccut_fuzz_stream_next
+               (
+                  &stream, &parts[total], 333
+               );
+               ok = count >= 0 && total + count <= 10007;
+               if (count <= 0)
+                  break;
+
+               total += count;
             }
-            ok = seed != XPCCUT_SEED_ERROR;
             if (ok)
-               ok = xpccut_match(&character_set[0], &number_stuff[0], 13);
+               ok = total == 10007;
+
+            if (ok)
+               ok = memcmp(whole, parts, sizeof(whole)) == 0;
+
+            if (ok)
+            {
+               ok = memcmp(whole, "<p>", 3) == 0 &&
+                  memcmp(&whole[10003], "</p>", 4) == 0;
+            }
+            for (i = 3; ok && i < 10003; i++)
+            {
+               char c = whole[i];
+               ok = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+            }
+            if (unit_test_options_show_values(options))
+               xpccut_print("  '%.40s...'\n", whole);
+
+            if (! ok)
+               xpccut_errprint_func(_("chunks differ from whole stream"));
 
             unit_test_status_pass(&status, ok);
          }
 
-         /*  5 */
+         /*  3 */
 
-         if (unit_test_status_next_subtest(&status, "Letters and numbers"))
+         if (unit_test_status_next_subtest(&status, "Random access"))
          {
-            char character_set[256];
-            int size_to_use = 66;         // don't need sizeof(character_set)
-            const char * char_stuff =
-               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-               "abcdefghijklmnopqrstuvwxyz"
-               "0123456789+-."
-               ;
-            int length = strlen(char_stuff);
-            unsigned int seed = xpccut_fuzz
+            static const long long s_offsets[5] =
+            {
+               5000, 4090, 0, 9990, 8195
+            };
+            int o;
+            ok = xpccut_fuzz_stream_init
             (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_NUMBERS_ONLY |
-                   XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
-               nullptr, nullptr, nullptr, nullptr
+               &stream, 10007, 10720, XPCCUT_FF_LETTERS_ONLY,
+               nullptr, nullptr, "<p>", "</p>"
             );
-            if (unit_test_options_show_values(options))
+            for (o = 0; ok && o < 5; o++)
             {
-               xpccut_dump_string(character_set, size_to_use);
-            }
-            ok = seed != XPCCUT_SEED_ERROR;
-            if (ok)
-               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+               char dest[100];
+               long long offset = s_offsets[o];
+               int wanted = offset + 100 > 10007 ? 10007 - (int) offset : 100 ;
+               ok = xpccut_fuzz_stream_read
+               (
+                  &stream, offset, dest, 100
+               ) == wanted;
+               if (ok)
+                  ok = memcmp(dest, &whole[offset], wanted) == 0;
 
+               if (! ok)
+                  xpccut_errprint_func(_("random read differs"));
+            }
             unit_test_status_pass(&status, ok);
          }
 
-         /*  6 */
+         /*  4 */
 
-         if (unit_test_status_next_subtest(&status, "Uppcase letters/numbers"))
+         if (unit_test_status_next_subtest(&status, "Terabyte stream"))
          {
-            char character_set[256];
-            int size_to_use = 42;         // don't need sizeof(character_set)
-            const char * char_stuff =
-               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-               "0123456789+-."
-               ;
-            int length = strlen(char_stuff);
-            unsigned int seed = xpccut_fuzz
+            long long length = 1LL << 40;
+            long long offset = 300000000007LL;
+            char dest_1[64];
+            char dest_2[64];
+            ok = xpccut_fuzz_stream_init
             (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_NUMBERS_ONLY |
-                   XPCCUT_FF_LETTERS_ONLY | XPCCUT_FF_DUMP_CHARSET,
-               nullptr,
-               "abcdefghijklmnopqrstuvwxyz",
-               nullptr, nullptr
+               &stream, length, 10740, XPCCUT_FF_DEFAULT,
+               nullptr, nullptr, nullptr, "EOF"
             );
-            if (unit_test_options_show_values(options))
+            if (ok)
             {
-               xpccut_dump_string(character_set, size_to_use);
+               ok = xpccut_fuzz_stream_read
+               (
+                  &stream, offset, dest_1, 64
+               ) == 64;
             }
-            ok = seed != XPCCUT_SEED_ERROR;
+
             if (ok)
-               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+            {
+               ok = xpccut_fuzz_stream_read
+               (
+                  &stream, length - 10, dest_2, 64
+               ) == 10;
+            }
+            if (ok)
+               ok = memcmp(&dest_2[7], "EOF", 3) == 0;
+
+            if (ok)
+            {
+               ok = xpccut_fuzz_stream_init
+               (
+                  &stream, length, 10740, XPCCUT_FF_DEFAULT,
+                  nullptr, nullptr, nullptr, "EOF"
+               );
+            }
+            if (ok)
+            {
+               ok = xpccut_fuzz_stream_read
+               (
+                  &stream, offset, dest_2, 64
+               ) == 64;
+            }
+
+            if (ok)
+               ok = memcmp(dest_1, dest_2, sizeof(dest_1)) == 0;
+
+            if (! ok)
+               xpccut_errprint_func(_("terabyte stream not reproducible"));
 
             unit_test_status_pass(&status, ok);
          }
 
-         /*  7 */
+         /*  5 */
 
-         if (unit_test_status_next_subtest(&status, "Lowercase letters special"))
+         if (unit_test_status_next_subtest(&status, "Callback"))
          {
-            char character_set[256];
-            int size_to_use = 30;         // don't need sizeof(character_set)
-            const char * char_stuff = "abcdefghijklmnopqrstuvwxyz";
-            int length = strlen(char_stuff);
-            unsigned int seed = xpccut_fuzz
+            fuzz_stream_tally_t tally;
+            unsigned checksum = 0;
+            int i;
+            for (i = 0; i < 10007; i++)
+               checksum += (unsigned char) whole[i];
+
+            (void) memset(&tally, 0, sizeof(tally));
+            ok = xpccut_fuzz_stream_init
             (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_DUMP_CHARSET,
-               char_stuff,
-               nullptr, nullptr, nullptr
+               &stream, 10007, 10720, XPCCUT_FF_LETTERS_ONLY,
+               nullptr, nullptr, "<p>", "</p>"
             );
-            if (unit_test_options_show_values(options))
+            if (ok)
             {
-               xpccut_dump_string(character_set, size_to_use);
+               ok = xpccut_fuzz_stream_generate
+               (
+                  &stream, fuzz_stream_sink, &tally
+               );
             }
-            ok = seed != XPCCUT_SEED_ERROR;
+
             if (ok)
-               ok = xpccut_match(&character_set[0], &char_stuff[0], length);
+               ok = tally.m_Bytes == 10007 && tally.m_Checksum == checksum;
+
+            if (ok)
+            {
+               char dest[4];
+               (void) memset(&tally, 0, sizeof(tally));
+               tally.m_Chunk_Limit = 1;
+               ok = xpccut_fuzz_stream_init
+               (
+                  &stream, 10007, 10720, XPCCUT_FF_LETTERS_ONLY,
+                  nullptr, nullptr, "<p>", "</p>"
+               );
+               if (ok)
+               {
+                  ok = ! xpccut_fuzz_stream_generate
+                  (
+                     &stream, fuzz_stream_sink, &tally
+                  );
+               }
+               if (ok)
+                  ok = tally.m_Bytes == XPCCUT_FUZZ_STREAM_BLOCK;
+
+               if (ok)
+                  ok = xpccut_fuzz_stream_next(&stream, dest, 4) == 4;
+
+               if (ok)
+               {
+                  ok = memcmp
+                  (
+                     dest, &whole[XPCCUT_FUZZ_STREAM_BLOCK], 4
+                  ) == 0;
+               }
+            }
+            if (! ok)
+               xpccut_errprint_func(_("callback stream differs"));
 
             unit_test_status_pass(&status, ok);
          }
 
-         /*  8 */
+         /*  6 */
 
-         if (unit_test_status_next_subtest(&status, "Lowercase consonants"))
+         if (unit_test_status_next_subtest(&status, "Random size and seeds"))
          {
-            char character_set[256];
-            int size_to_use = 30;         // don't need sizeof(character_set)
-            const char * char_stuff = "abcdefghijklmnopqrstuvwxyz";
-            const char * consonants = "bcdfghjklmnpqrstvwxyz";
-            int length = strlen(consonants);
-            unsigned int seed = xpccut_fuzz
-            (
-               &character_set[0], size_to_use,
-               FAKE_SIZE, XPCCUT_SEED_SKIP,
-               XPCCUT_FF_DUMP_CHARSET,
-               char_stuff,
-               "aeiou",
-               nullptr, nullptr
-            );
+            long long length = 0;
+            unsigned int seed = 0;
+            int trial;
+            for (trial = 0; ok && trial < 2; trial++)
+            {
+               (void) xpccut_set_seed(10760);
+               ok = xpccut_fuzz_stream_init
+               (
+                  &stream, 5000, XPCCUT_SEED_SKIP, XPCCUT_FF_RANDOM_SIZE,
+                  nullptr, nullptr, "<p>", "</p>"
+               );
+               if (ok)
+               {
+                  long long l = xpccut_fuzz_stream_length(&stream);
+                  unsigned int s = xpccut_fuzz_stream_seed(&stream);
+                  ok = l >= 7 && l <= 5000 && s > XPCCUT_SEED_SKIP;
+                  if (ok && trial > 0)
+                     ok = l == length && s == seed;
+
+                  length = l;
+                  seed = s;
+               }
+            }
             if (unit_test_options_show_values(options))
             {
-               xpccut_dump_string(character_set, size_to_use);
+               xpccut_print
+               (
+                  "  seed %u, length %lld\n", seed, length
+               );
             }
-            ok = seed != XPCCUT_SEED_ERROR;
-            if (ok)
-               ok = xpccut_match(&character_set[0], &consonants[0], length);
+            if (! ok)
+               xpccut_errprint_func(_("random size not reproducible"));
 
             unit_test_status_pass(&status, ok);
          }
@@ -13478,133 +25593,113 @@ unit_unit_test_10_01 (const unit_test_options_t * options)
 }
 
 /**
- *    Generates a single random character.
- *    The main purpose of this function is to test the randomness of the
- *    generated characters, mostly to make sure our algorithms are not
- *    flawed.
- *
- * \param destination
- *    Provides the destination buffer.
- *
- * \param dlength
- *    Provides the length of the destination buffer.
- *
- * \return
- *    Returns 'true' if the function succeeded.
- */
-
-static cbool_t
-xpccut_fuzz_single_character
-(
-   char * destination,
-   int dlength
-)
-{
-   int number_of_bytes = 1;                           /* very short integers  */
-   int seed = xpccut_fuzz
-   (
-      destination, dlength,
-      number_of_bytes,
-      XPCCUT_SEED_SKIP,
-      XPCCUT_FF_DEFAULT,
-      nullptr,                                        /* allowed characters   */
-      nullptr,                                        /* excluded characters  */
-      nullptr,                                        /* prologue characters  */
-      nullptr                                         /* epilogue characters  */
-   );
-   return seed != XPCCUT_SEED_ERROR;
-}
-
-/**
- *    Generates a two-digit random number string.
- *
- * \param destination
- *    Provides the destination buffer.
- *
- * \param dlength
- *    Provides the length of the destination buffer.
- *
- * \param extra_flags
- *    Additional flags over and above the built-in XPCCUT_FF_NUMBERS_ONLY
- *    flag.
+ *    Provides a target for the guided fuzzer of unit-test 10.08.  It fails
+ *    only for inputs that start with "FUZ!", and marks each character of
+ *    the prefix that it matches with xpccut_coverage_hit(), the way a
+ *    parser instrumented by -fsanitize-coverage would report its edges.
  *
  * \return
- *    Returns 'true' if the function succeeded.
+ *    Returns 'false' if the input starts with "FUZ!".
  */
 
 static cbool_t
-xpccut_fuzz_two_byte_integers
-(
-   char * destination,
-   int dlength,
-   xpccut_fuzz_flags_t extra_flags
-)
+guided_magic_target (void * context, const char * data, int size)
 {
-   int number_of_bytes = 2;                           /* very short integers  */
-   xpccut_fuzz_flags_t flags = XPCCUT_FF_NUMBERS_ONLY | extra_flags;
-   int seed = xpccut_fuzz
-   (
-      destination, dlength,
-      number_of_bytes,
-      XPCCUT_SEED_SKIP,
-      flags,
-      nullptr,                                        /* allowed characters   */
-      "+-.",                                          /* excluded characters  */
-      nullptr,                                        /* prologue characters  */
-      nullptr                                         /* epilogue characters  */
-   );
-   return seed != XPCCUT_SEED_ERROR;
+   cbool_t result = true;
+   (void) context;
+   if (size > 0 && data[0] == 'F')
+   {
+      xpccut_coverage_hit(1);
+      if (size > 1 && data[1] == 'U')
+      {
+         xpccut_coverage_hit(2);
+         if (size > 2 && data[2] == 'Z')
+         {
+            xpccut_coverage_hit(3);
+            if (size > 3 && data[3] == '!')
+               result = false;
+         }
+      }
+   }
+   return result;
 }
 
 /**
- *    Generates a random string of random size from 0 to 10 characters.
- *    The main purpose of this function is to test the randomness of the
- *    generated characters, mostly to make sure our algorithms are not
- *    flawed.
- *
- * \param destination
- *    Provides the destination buffer.
+ *    Provides the guards of guided_guard_target(), numbered by
+ *    __sanitizer_cov_trace_pc_guard_init() in unit-test 10.08.
+ */
+
+static unsigned int gs_guided_guards[3];
+
+/**
+ *    Provides a target for the guided fuzzer of unit-test 10.08, which
+ *    calls the trace-pc-guard hook itself, as instrumented code does.
  *
- * \param dlength
- *    Provides the length of the destination buffer.
+ * \return
+ *    Returns 'false' if the input starts with "<a>".
+ */
+
+static cbool_t
+guided_guard_target (void * context, const char * data, int size)
+{
+   cbool_t result = true;
+   int * calls = (int *) context;
+   ++*calls;
+   if (size > 0 && data[0] == '<')
+   {
+      __sanitizer_cov_trace_pc_guard(&gs_guided_guards[0]);
+      if (size > 1 && data[1] == 'a')
+      {
+         __sanitizer_cov_trace_pc_guard(&gs_guided_guards[1]);
+         if (size > 2 && data[2] == '>')
+         {
+            __sanitizer_cov_trace_pc_guard(&gs_guided_guards[2]);
+            result = false;
+         }
+      }
+   }
+   return result;
+}
+
+/**
+ *    Provides a target for the guided fuzzer of unit-test 10.08 that never
+ *    fails.
  *
  * \return
- *    Returns 'true' if the function succeeded.
+ *    Always returns 'true'.
  */
 
 static cbool_t
-xpccut_fuzz_random_size_string
-(
-   char * destination,
-   int dlength
-)
+guided_null_target (void * context, const char * data, int size)
 {
-   int number_of_bytes = 10;                          /* very short integers  */
-   int seed = xpccut_fuzz
-   (
-      destination, dlength,
-      number_of_bytes,
-      XPCCUT_SEED_SKIP,
-      XPCCUT_FF_RANDOM_SIZE,
-      nullptr,                                        /* allowed characters   */
-      nullptr,                                        /* excluded characters  */
-      nullptr,                                        /* prologue characters  */
-      nullptr                                         /* epilogue characters  */
-   );
-   return seed != XPCCUT_SEED_ERROR;
+   (void) context;
+   (void) data;
+   (void) size;
+   return true;
 }
 
 /**
- *    Provides a unit test for the fuzz-related functions.
+ *    Provides a unit test for the coverage-guided fuzzer.
  *
  * \group
  *   10. Fuzz-testing
  *
  * \case
- *    2. Small numeric strings.
+ *    8. Coverage-guided fuzzing
  *
  * \test
- *    -  xpccut_fuzz()
+ *    -  xpccut_guided_init()
+ *    -  xpccut_guided_free()
+ *    -  xpccut_guided_add()
+ *    -  xpccut_guided_run()
+ *    -  xpccut_guided_crash()
+ *    -  xpccut_guided_corpus_entry()
+ *    -  xpccut_guided_corpus_count()
+ *    -  xpccut_guided_edge_count()
+ *    -  xpccut_guided_iterations()
+ *    -  xpccut_coverage_hit()
+ *    -  __sanitizer_cov_trace_pc_guard_init()
+ *    -  __sanitizer_cov_trace_pc_guard()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13614,12 +25709,12 @@ xpccut_fuzz_random_size_string
  */
 
 static unit_test_status_t
-unit_unit_test_10_02 (const unit_test_options_t * options)
+unit_unit_test_10_08 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 10, 2, "Fuzz functions", _("Small numeric strings")
+      &status, options, 10, 8, "Fuzz functions", _("Coverage-guided fuzzing")
    );
    if (ok)
    {
@@ -13629,206 +25724,280 @@ unit_unit_test_10_02 (const unit_test_options_t * options)
       }
       else
       {
+         xpccut_guided_fuzz_t fuzzer;
+         char crash[8];
+         long long crash_iterations = 0;
+
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "2-byte integers"))
+         if (unit_test_status_next_subtest(&status, "Parameter checks"))
          {
-            int i, j, k;
-            char destination[4];
-            int histogram[100];
-            if (unit_test_options_show_values(options))
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = ! xpccut_guided_init
+            (
+               nullptr, 10810, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               // nada
+               ok = ! xpccut_guided_init
+               (
+                  &fuzzer, 10810, 0, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+               xpccut_guided_free(&fuzzer);
+            }
+            if (ok)
+            {
+               ok = xpccut_guided_init
+               (
+                  &fuzzer, 10810, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
             }
+            if (ok)
+               ok = ! xpccut_guided_run(&fuzzer, nullptr, nullptr, 10, 0.0);
 
-            for (i = 0; i < 100; i++)
-               histogram[i] = 0;
+            if (ok)
+            {
+               ok = ! xpccut_guided_run
+               (
+                  &fuzzer, guided_null_target, nullptr, -1, 0.0
+               );
+            }
+            if (ok)
+               ok = ! xpccut_guided_add(&fuzzer, "abc", -1);
 
-            (void) xpccut_set_seed(99);
+            if (ok)
+               ok = ! xpccut_guided_add(&fuzzer, nullptr, 3);
 
-            // for (i = 0; i < 100000; i++)
+            if (ok)
+            {
+               int size = 0;
+               ok = cut_is_nullptr(xpccut_guided_crash(&fuzzer, &size));
+               if (ok)
+                  ok = size == -1 && xpccut_guided_corpus_count(&fuzzer) == 0;
+            }
+            xpccut_guided_free(&fuzzer);
+            if (! silent)
+               xpccut_allow_printing();
 
-            for (i = 0; i < 1000; i++)
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Finds a deep failure"))
+         {
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 10820, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               int value;
-               ok = xpccut_fuzz_two_byte_integers
+               ok = ! xpccut_guided_run
                (
-                  destination, sizeof(destination),
-                  XPCCUT_FF_DEFAULT
+                  &fuzzer, guided_magic_target, nullptr, 1000000, 10000.0
                );
+            }
+            if (ok)
+            {
+               int size = 0;
+               const char * input = xpccut_guided_crash(&fuzzer, &size);
+               ok = cut_not_nullptr(input) && size >= 4;
+               if (ok)
+                  ok = memcmp(input, "FUZ!", 4) == 0;
+
                if (ok)
                {
-                  value = atoi(destination);
-                  if (unit_test_options_show_values(options))
-                     fprintf(stdout, "%2d\n", value);
+                  (void) memcpy(crash, input, 4);
+                  crash_iterations = xpccut_guided_iterations(&fuzzer);
+                  ok = xpccut_guided_edge_count(&fuzzer) == 3;
+               }
+               if (ok)
+                  ok = xpccut_guided_corpus_count(&fuzzer) >= 4;
 
-                  if (value >= 0 && value < 100)
-                     histogram[value]++;
-                  else
-                  {
-                     xpccut_errprint(_("bad numerical value encountered"));
-                     break;
-                  }
+               if (unit_test_options_show_values(options))
+               {
+                  xpccut_print
+                  (
+                     "  found after %lld runs, %d edges, corpus of %d\n",
+                     xpccut_guided_iterations(&fuzzer),
+                     xpccut_guided_edge_count(&fuzzer),
+                     xpccut_guided_corpus_count(&fuzzer)
+                  );
                }
-               else
-                  break;
             }
-            if (unit_test_options_show_values(options))
+            xpccut_guided_free(&fuzzer);
+            if (! ok)
+               xpccut_errprint_func(_("guided fuzzer missed the failure"));
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Reproducible by seed"))
+         {
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 10820, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               fprintf
+               ok = ! xpccut_guided_run
                (
-                  stdout,
-         "        0     1     2     3     4     5     6     7     8     9\n"
-         "  ==============================================================\n"
+                  &fuzzer, guided_magic_target, nullptr, 1000000, 10000.0
                );
-               for (i = 0, k = 0; i < 10; i++)
+            }
+            if (ok)
+            {
+               const char * input = xpccut_guided_crash(&fuzzer, nullptr);
+               ok = xpccut_guided_iterations(&fuzzer) == crash_iterations;
+               if (ok)
+                  ok = memcmp(input, crash, 4) == 0;
+            }
+            if (ok)
+            {
+               int size = 0;
+               const char * entry = xpccut_guided_corpus_entry
+               (
+                  &fuzzer, 0, &size
+               );
+               ok = cut_not_nullptr(entry) && size == 0;
+               if (ok)
                {
-                  fprintf(stdout, "%2d| ", i);
-                  for (j = 0; j < 10; j++)
-                  {
-                     fprintf(stdout, " %4d ", histogram[k++]);
-                  }
-                  fprintf(stdout, "\n");
+                  entry = xpccut_guided_corpus_entry(&fuzzer, -1, &size);
+                  ok = cut_is_nullptr(entry) && size == -1;
                }
             }
+            xpccut_guided_free(&fuzzer);
             unit_test_status_pass(&status, ok);
          }
-      }
-   }
-   return status;
-}
 
-/**
- *    Provides a unit test for the fuzz-related functions.
- *
- * \group
- *   10. Fuzz-testing
- *
- * \case
- *    3. Single-character randomness test
- *
- * \test
- *    -  xpccut_fuzz()
- *
- *    This test is a bit different.  Here is its features:
- *
- *       -  Generates only single-character strings
- *       -  Outputs the characters to standard output in a format suitable
- *          for usage with the dieharder application.
- *
- \verbatim
-      $ ./unit_test_test --group 9 --case 3 --silent --dump-text > 10_03.input
-      $  dieharder -a -g 202 -f 10_03.input
- \endverbatim
- *
- *    With the use of the crappy rand() function, the output looks random,
- *    but FAILs all of the dieharder tests (which all told take a lot of
- *    minutes).  Not yet sure if we really need to use an improved random
- *    number generator or not.
- *
- * \param options
- *    Provides the command-line options for the unit-test application.
- *
- * \return
- *    Returns the unit-test status object needed by the protocol.
- */
+         /*  4 */
 
-static unit_test_status_t
-unit_unit_test_10_03 (const unit_test_options_t * options)
-{
-   unit_test_status_t status;
-   cbool_t ok = unit_test_status_initialize
-   (
-      &status, options, 10, 3, "Fuzz functions",
-      _("Single-character randomness test")
-   );
-   if (ok)
-   {
-      if (! unit_test_status_can_proceed(&status)) /* is test allowed to run? */
-      {
-         unit_test_status_pass(&status, true);     /* no, force it to pass    */
-      }
-      else
-      {
-         /*  1 */
+         if (unit_test_status_next_subtest(&status, "Iteration budget"))
+         {
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 10840, 16, XPCCUT_FF_LETTERS_ONLY, nullptr, nullptr
+            );
+            if (ok)
+               ok = xpccut_guided_add(&fuzzer, "hello", 5);
 
-         if (unit_test_status_next_subtest(&status, "Single character"))
+            if (ok)
+            {
+               ok = xpccut_guided_run
+               (
+                  &fuzzer, guided_null_target, nullptr, 1000, 0.0
+               );
+            }
+            if (ok)
+               ok = xpccut_guided_iterations(&fuzzer) == 1000;
+
+            if (ok)
+            {
+               ok = xpccut_guided_run
+               (
+                  &fuzzer, guided_null_target, nullptr, 500, 0.0
+               );
+            }
+            if (ok)
+               ok = xpccut_guided_iterations(&fuzzer) == 1500;
+
+            if (ok)
+            {
+               ok = xpccut_guided_corpus_count(&fuzzer) == 1 &&
+                  xpccut_guided_edge_count(&fuzzer) == 0;
+            }
+            xpccut_guided_free(&fuzzer);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Time budget"))
          {
-            int i, j, k;
-            char dest[4];
-            int histogram[256];
-            int count = 1000 * 256;
-            int seed = 22;
-            if (unit_test_options_show_values(options))
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 10850, 16, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               // nada
+               xpccut_ticks_t start = xpccut_get_ticks();
+               double ms;
+               ok = xpccut_guided_run
+               (
+                  &fuzzer, guided_null_target, nullptr, 0, 20.0
+               );
+               ms = (double) (xpccut_get_ticks() - start) /
+                  (double) XPCCUT_TICKS_PER_MS;
+
+               if (ok)
+                  ok = ms >= 20.0 && xpccut_guided_iterations(&fuzzer) > 1;
+
+               if (unit_test_options_show_values(options))
+               {
+                  xpccut_print
+                  (
+                     "  %lld runs in %.1f ms\n",
+                     xpccut_guided_iterations(&fuzzer), ms
+                  );
+               }
             }
+            xpccut_guided_free(&fuzzer);
+            unit_test_status_pass(&status, ok);
+         }
 
-            for (i = 0; i < 256; i++)
-               histogram[i] = 0;
+         /*  6 */
 
-            xpccut_set_seed(seed);
-            if (g_do_dump_text)
+         if (unit_test_status_next_subtest(&status, "Trace-pc-guard hooks"))
+         {
+            int calls = 0;
+            __sanitizer_cov_trace_pc_guard_init
+            (
+               &gs_guided_guards[0], &gs_guided_guards[3]
+            );
+            ok = gs_guided_guards[0] != 0 &&
+               gs_guided_guards[1] == gs_guided_guards[0] + 1 &&
+               gs_guided_guards[2] == gs_guided_guards[1] + 1;
+
+            if (ok)
             {
-               fprintf
+               unsigned int first = gs_guided_guards[0];
+               __sanitizer_cov_trace_pc_guard_init    /* already numbered  */
                (
-                  stdout,
-      "#==================================================================\n"
-      "# generator xpccut_fuzz seed = %d\n"
-      "#==================================================================\n"
-      "type: d\n"
-      "count: %d\n"
-      "numbit: 8\n"
-                  ,
-                  seed, count
+                  &gs_guided_guards[0], &gs_guided_guards[3]
                );
+               ok = gs_guided_guards[0] == first;
             }
-            for (i = 0; i < count; i++)
+            if (ok)
+               ok = guided_guard_target(&calls, "<a>", 3) == false;
+
+            if (ok)
             {
-               unsigned value;
-               ok = xpccut_fuzz_single_character(dest, sizeof(dest));
-               if (ok)
-               {
-                  value = (unsigned) dest[0];
-                  value &= 0xff;
-                  histogram[value]++;
-                  if (value >= 256)
-                  {
-                     xpccut_errprint(_("bad character value encountered"));
-                     break;
-                  }
-                  if (g_do_dump_text)
-                     fprintf(stdout, "%d\n", value);
-               }
-               else
-               {
-                  xpccut_errprint_func(_("fuzz error"));
-                  break;
-               }
+               ok = xpccut_guided_init
+               (
+                  &fuzzer, 10860, 32, XPCCUT_FF_DEFAULT, "<>/ab", nullptr
+               );
             }
+            if (ok)
+               ok = xpccut_guided_add(&fuzzer, "<b></b>", 7);
 
-            if (unit_test_options_show_values(options))
+            if (ok)
             {
-               fprintf
+               ok = ! xpccut_guided_run
                (
-                  stdout,
-         "        0     1     2     3     4     5     6     7     8     9\n"
-         "  ==============================================================\n"
+                  &fuzzer, guided_guard_target, &calls, 1000000, 10000.0
                );
-               for (i = 0, k = 0; i < (256/10+1); i++)
-               {
-                  fprintf(stdout, "%2d| ", i);
-                  for (j = 0; j < 10; j++)
-                  {
-                     fprintf(stdout, " %4d ", histogram[k++]);
-                     if (k >= 256)
-                        break;
-                  }
-                  fprintf(stdout, "\n");
-                  if (k >= 256)
-                     break;
-               }
             }
+            if (ok)
+            {
+               const char * input = xpccut_guided_crash(&fuzzer, nullptr);
+               ok = cut_not_nullptr(input) && memcmp(input, "<a>", 3) == 0;
+               if (ok)
+                  ok = xpccut_guided_iterations(&fuzzer) == calls - 1;
+            }
+            xpccut_guided_free(&fuzzer);
             unit_test_status_pass(&status, ok);
          }
       }
@@ -13837,16 +26006,41 @@ unit_unit_test_10_03 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit test for the fuzz-related functions.
+ *    Provides a target for the corpus replay of unit-test 10.09.  It counts
+ *    its calls, and fails on the input "7777".
+ *
+ * \return
+ *    Returns 'false' if the input is "7777".
+ */
+
+static cbool_t
+corpus_count_target (void * context, const char * data, int size)
+{
+   int * calls = (int *) context;
+   ++*calls;
+   return ! (size == 4 && memcmp(data, "7777", 4) == 0);
+}
+
+/**
+ *    Provides a unit test for the corpus files of the fuzzers.
  *
  * \group
  *   10. Fuzz-testing
  *
  * \case
- *    4. Random-size strings
+ *    9. Fuzz corpus files
  *
  * \test
- *    -  xpccut_fuzz()
+ *    -  xpccut_corpus_open()
+ *    -  xpccut_corpus_close()
+ *    -  xpccut_corpus_count()
+ *    -  xpccut_corpus_next()
+ *    -  xpccut_corpus_replay()
+ *    -  xpccut_corpus_create()
+ *    -  xpccut_corpus_append()
+ *    -  xpccut_corpus_path()
+ *    -  xpccut_guided_directory()
+ *    -  xpccut_guided_crash_file()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13856,12 +26050,12 @@ unit_unit_test_10_03 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_10_04 (const unit_test_options_t * options)
+unit_unit_test_10_09 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 10, 4, "Fuzz functions", _("Random-size strings")
+      &status, options, 10, 9, "Fuzz functions", _("Fuzz corpus files")
    );
    if (ok)
    {
@@ -13871,35 +26065,338 @@ unit_unit_test_10_04 (const unit_test_options_t * options)
       }
       else
       {
+         char filename[TEST_FILE_NAME_SIZE];
+         char directory[TEST_FILE_NAME_SIZE];
+         xpccut_corpus_t corpus;
+         (void) test_file_name(filename, "unit-test-10-09", ".xcc");
+         (void) test_file_name(directory, "unit-test-10-09", ".dir");
+
          /*  1 */
 
-         if (unit_test_status_next_subtest(&status, "Random character count"))
+         if (unit_test_status_next_subtest(&status, "Parameter checks"))
+         {
+            char path[16];
+            long long cursor = 0;
+            int size = 0;
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = ! xpccut_corpus_open(nullptr, filename);
+            if (ok)
+               ok = ! xpccut_corpus_open(&corpus, nullptr);
+
+            if (ok)
+               ok = ! xpccut_corpus_append(nullptr, "abc", 3);
+
+            if (ok)
+               ok = ! xpccut_corpus_append(filename, nullptr, 3);
+
+            if (ok)
+               ok = ! xpccut_corpus_append(filename, "abc", -1);
+
+            if (ok)
+            {
+               ok = ! xpccut_corpus_path
+               (
+                  path, sizeof path, "abcdefghij", "klmno"
+               );
+            }
+
+            if (ok)
+            {
+               ok = xpccut_corpus_path(path, sizeof path, "abc/", "def");
+               if (ok)
+                  ok = strcmp(path, "abc/def") == 0;
+            }
+            if (ok)
+            {
+               ok = xpccut_corpus_path(path, sizeof path, "abc", "def");
+               if (ok)
+                  ok = strcmp(path, "abc/def") == 0;
+            }
+            if (ok)
+            {
+               ok = cut_is_nullptr(xpccut_corpus_next(nullptr, &cursor, &size));
+               if (ok)
+                  ok = size == -1;
+            }
+            if (ok)
+               ok = ! xpccut_corpus_replay(nullptr, guided_null_target, 0, 0);
+
+            if (! silent)
+               xpccut_allow_printing();
+
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  2 */
+
+         if (unit_test_status_next_subtest(&status, "Missing file is empty"))
+         {
+            long long cursor = 0;
+            (void) remove(filename);
+            ok = xpccut_corpus_open(&corpus, filename);
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 0;
+
+            if (ok)
+               ok = cut_is_nullptr(xpccut_corpus_next(&corpus, &cursor, 0));
+
+            xpccut_corpus_close(&corpus);
+            if (ok)
+               ok = xpccut_corpus_create(filename);
+
+            if (ok)
+               ok = xpccut_corpus_open(&corpus, filename);
+
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 0 && corpus.m_Size == 8;
+
+            xpccut_corpus_close(&corpus);
+            if (ok)
+               ok = xpccut_corpus_create(filename);     /* leaves it alone  */
+
+            (void) remove(filename);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "Round trip"))
+         {
+            ok = xpccut_corpus_append(filename, "abc", 3);
+            if (ok)
+               ok = xpccut_corpus_append(filename, "", 0);
+
+            if (ok)
+               ok = xpccut_corpus_append(filename, "a\0b", 3);
+
+            if (ok)
+               ok = xpccut_corpus_open(&corpus, filename);
+
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 3;
+
+            if (ok)
+            {
+               long long cursor = 0;
+               int size = 0;
+               const char * input = xpccut_corpus_next(&corpus, &cursor, &size);
+               ok = cut_not_nullptr(input) && size == 3;
+               if (ok)
+                  ok = memcmp(input, "abc", 3) == 0;
+
+               if (ok)
+               {
+                  input = xpccut_corpus_next(&corpus, &cursor, &size);
+                  ok = cut_not_nullptr(input) && size == 0;
+               }
+               if (ok)
+               {
+                  input = xpccut_corpus_next(&corpus, &cursor, &size);
+                  ok = cut_not_nullptr(input) && size == 3;
+                  if (ok)
+                     ok = memcmp(input, "a\0b", 3) == 0;
+               }
+               if (ok)
+               {
+                  input = xpccut_corpus_next(&corpus, &cursor, &size);
+                  ok = cut_is_nullptr(input) && size == -1;
+               }
+            }
+            xpccut_corpus_close(&corpus);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Cut-short input"))
+         {
+            FILE * f = fopen(filename, "ab");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               static const char s_partial[] = "\x64\0\0\0abcdefghij";
+               ok = fwrite(s_partial, 1, 14, f) == 14;
+               if (fclose(f) != 0)
+                  ok = false;
+            }
+            if (ok)
+               ok = xpccut_corpus_open(&corpus, filename);
+
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 3;
+
+            xpccut_corpus_close(&corpus);
+            if (ok)
+               ok = xpccut_corpus_append(filename, "xyz", 3);
+
+            if (ok)
+               ok = xpccut_corpus_open(&corpus, filename);
+
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 3;   /* still cut short  */
+
+            xpccut_corpus_close(&corpus);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Bad magic string"))
+         {
+            FILE * f = fopen(filename, "wb");
+            ok = cut_not_nullptr(f);
+            if (ok)
+            {
+               ok = fwrite("NOTMAGIC\0\0\0\0", 1, 12, f) == 12;
+               if (fclose(f) != 0)
+                  ok = false;
+            }
+            if (ok)
+            {
+               cbool_t silent = xpccut_is_silent();
+               xpccut_silence_printing();
+               ok = ! xpccut_corpus_open(&corpus, filename);
+               xpccut_corpus_close(&corpus);
+               if (! silent)
+                  xpccut_allow_printing();
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  6 */
+
+         if (unit_test_status_next_subtest(&status, "Large replay"))
          {
-            char dest[64];
-            int count = 20;
-            int seed = 22;
             int i;
-            if (unit_test_options_show_values(options))
+            (void) remove(filename);
+            for (i = 0; ok && i < 10000; i++)
+            {
+               char input[16];
+               int size = snprintf(input, sizeof input, "%d", i);
+               ok = xpccut_corpus_append(filename, input, size);
+            }
+            if (ok)
+               ok = xpccut_corpus_open(&corpus, filename);
+
+            if (ok)
+               ok = xpccut_corpus_count(&corpus) == 10000;
+
+            if (ok)
+            {
+               int calls = 0;
+               int failed = 0;
+               xpccut_ticks_t start = xpccut_get_ticks();
+               ok = ! xpccut_corpus_replay
+               (
+                  &corpus, corpus_count_target, &calls, &failed
+               );
+               if (ok)
+                  ok = failed == 7777 && calls == 7778;
+
+               if (unit_test_options_show_values(options))
+               {
+                  xpccut_print
+                  (
+                     "  replayed %d inputs in %.3f ms\n", calls,
+                     (double) (xpccut_get_ticks() - start) /
+                        (double) XPCCUT_TICKS_PER_MS
+                  );
+               }
+            }
+            xpccut_corpus_close(&corpus);
+            (void) remove(filename);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  7 */
+
+         if (unit_test_status_next_subtest(&status, "Corpus directory"))
+         {
+            xpccut_guided_fuzz_t fuzzer;
+            char path[XPCCUT_CORPUS_PATH_MAX];
+            char crashfile[XPCCUT_CORPUS_PATH_MAX];
+            const char * name = nullptr;
+            crashfile[0] = 0;
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 10970, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
+               ok = xpccut_guided_directory(&fuzzer, directory);
+
+            if (ok)
+               ok = cut_is_nullptr(xpccut_guided_crash_file(&fuzzer));
+
+            if (ok)
+            {
+               ok = ! xpccut_guided_run
+               (
+                  &fuzzer, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+            }
+            if (ok)
+            {
+               name = xpccut_guided_crash_file(&fuzzer);
+               ok = cut_not_nullptr(name);
+            }
+            if (ok)
+            {
+               char bytes[8];
+               FILE * f = fopen(name, "rb");
+               ok = cut_not_nullptr(f);
+               (void) strcpy(crashfile, name);
+               if (ok)
+               {
+                  ok = fread(bytes, 1, 4, f) == 4;
+                  if (ok)
+                     ok = memcmp(bytes, "FUZ!", 4) == 0;
+
+                  (void) fclose(f);
+               }
+            }
+            xpccut_guided_free(&fuzzer);
+            if (ok)
+            {
+               ok = xpccut_guided_init
+               (
+                  &fuzzer, 10971, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+            }
+            if (ok)
+               ok = xpccut_guided_directory(&fuzzer, directory);
+
+            if (ok)
+               ok = xpccut_guided_corpus_count(&fuzzer) >= 4;
+
+            if (ok)
             {
-               // nada
+               ok = ! xpccut_guided_run
+               (
+                  &fuzzer, guided_magic_target, nullptr, 1000000, 10000.0
+               );
             }
-            xpccut_set_seed(seed);
-            for (i = 0; i < count; i++)
+            if (ok)
+               ok = xpccut_guided_iterations(&fuzzer) == 1;    /* replayed */
+
+            if (ok)
             {
-               ok = xpccut_fuzz_random_size_string(dest, sizeof(dest));
+               name = xpccut_guided_crash_file(&fuzzer);
+               ok = cut_not_nullptr(name);
                if (ok)
-               {
-                  if (unit_test_options_show_values(options))
-                  {
-                     fprintf(stdout, "  '%s'\n", dest);    // TOO SIMPLE
-                  }
-               }
-               else
-               {
-                  xpccut_errprint_func(_("fuzz error"));
-                  break;
-               }
+                  ok = strcmp(name, crashfile) == 0;
             }
+            xpccut_guided_free(&fuzzer);
+            if (crashfile[0] != 0)
+               (void) remove(crashfile);
+
+            if (xpccut_corpus_path(path, 1024, directory, "corpus.xcc"))
+               (void) remove(path);
+
+            if (xpccut_corpus_path(path, 1024, directory, "crashes.xcc"))
+               (void) remove(path);
+
+            (void) remove(directory);
             unit_test_status_pass(&status, ok);
          }
       }
@@ -13908,16 +26405,50 @@ unit_unit_test_10_04 (const unit_test_options_t * options)
 }
 
 /**
- *    Provides a unit test for the fuzz-related functions.
+ *    Provides a target for the fuzz campaigns of unit-test 10.10 that never
+ *    fails, but marks an edge for each first byte and each size of its
+ *    input, so that the workers have plenty of new inputs to share.
+ *
+ * \return
+ *    Always returns 'true'.
+ */
+
+static cbool_t
+campaign_spread_target (void * context, const char * data, int size)
+{
+   (void) context;
+   if (size > 0)
+      xpccut_coverage_hit((unsigned char) data[0]);
+
+   xpccut_coverage_hit(256 + (unsigned int) size);
+   return true;
+}
+
+/**
+ *    Provides a unit test for the fuzz campaigns of the --fuzz-jobs
+ *    option.
  *
  * \group
  *   10. Fuzz-testing
  *
  * \case
- *    4. xpccut_garbled_string()
+ *   10. Parallel fuzz campaigns
  *
  * \test
- *    -  xpccut_garbled_string()
+ *    -  xpccut_campaign_seed()
+ *    -  xpccut_campaign_init()
+ *    -  xpccut_campaign_free()
+ *    -  xpccut_campaign_add()
+ *    -  xpccut_campaign_directory()
+ *    -  xpccut_campaign_run()
+ *    -  xpccut_campaign_crash()
+ *    -  xpccut_campaign_crash_file()
+ *    -  xpccut_campaign_fuzzer()
+ *    -  xpccut_campaign_job_count()
+ *    -  xpccut_campaign_failed_job()
+ *    -  xpccut_campaign_shared_count()
+ *    -  xpccut_campaign_edge_count()
+ *    -  xpccut_campaign_iterations()
  *
  * \param options
  *    Provides the command-line options for the unit-test application.
@@ -13927,12 +26458,12 @@ unit_unit_test_10_04 (const unit_test_options_t * options)
  */
 
 static unit_test_status_t
-unit_unit_test_10_05 (const unit_test_options_t * options)
+unit_unit_test_10_10 (const unit_test_options_t * options)
 {
    unit_test_status_t status;
    cbool_t ok = unit_test_status_initialize
    (
-      &status, options, 10, 5, "Fuzz functions", _("xpccut_garbled_string()")
+      &status, options, 10, 10, "Fuzz functions", _("Parallel fuzz campaigns")
    );
    if (ok)
    {
@@ -13942,128 +26473,302 @@ unit_unit_test_10_05 (const unit_test_options_t * options)
       }
       else
       {
+         xpccut_campaign_t campaign;
+         int jobs = unit_test_options_fuzz_job_count(options);
+         if (jobs < 4)
+            jobs = 4;
+
          /*  1 */
 
          if (unit_test_status_next_subtest(&status, "Parameter checks"))
          {
-            int r;
-            char source[4] =
+            cbool_t silent = xpccut_is_silent();
+            xpccut_silence_printing();
+            ok = ! xpccut_campaign_init
+            (
+               nullptr, 2, 11010, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               "hi!"
-            };
-            if (unit_test_options_show_values(options))
+               ok = ! xpccut_campaign_init
+               (
+                  &campaign, 0, 11010, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+               xpccut_campaign_free(&campaign);
+            }
+            if (ok)
             {
-               // nada
+               ok = ! xpccut_campaign_init
+               (
+                  &campaign, XPCCUT_JOBS_MAX + 1, 11010, 64,
+                  XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+               xpccut_campaign_free(&campaign);
             }
-            r = xpccut_garbled_string(nullptr, 1);
-            ok = r < 0;
             if (ok)
-               r = xpccut_garbled_string(source, 0);
+            {
+               ok = xpccut_campaign_init
+               (
+                  &campaign, 2, 11010, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+            }
+            if (ok)
+               ok = ! xpccut_campaign_run(&campaign, nullptr, nullptr, 1, 0);
 
-            ok = r < 0;
             if (ok)
-               r = xpccut_garbled_string(source, -1);
+            {
+               int size = 0;
+               ok = cut_is_nullptr(xpccut_campaign_crash(&campaign, &size));
+               if (ok)
+                  ok = size == -1;
+
+               if (ok)
+                  ok = xpccut_campaign_failed_job(&campaign) < 0;
+            }
+            if (ok)
+            {
+               ok = xpccut_campaign_job_count(&campaign) == 2 &&
+                  cut_not_nullptr(xpccut_campaign_fuzzer(&campaign, 1)) &&
+                  cut_is_nullptr(xpccut_campaign_fuzzer(&campaign, 2));
+            }
+            xpccut_campaign_free(&campaign);
+            if (! silent)
+               xpccut_allow_printing();
 
             unit_test_status_pass(&status, ok);
          }
 
          /*  2 */
 
-         if (unit_test_status_next_subtest(&status, "hi!"))
+         if (unit_test_status_next_subtest(&status, "Derived seeds"))
          {
-            unsigned int seed = 10210;
-            char source[4] =
+            int j;
+            ok = xpccut_campaign_seed(11020, 0) == 11020;
+            for (j = 1; ok && j < 16; j++)
             {
-               "hi!"
-            };
-            int trial_count = 10;
-            int i;
-            if (unit_test_options_show_values(options))
+               unsigned int seed = xpccut_campaign_seed(11020, j);
+               int k;
+               ok = seed >= 2 && seed == xpccut_campaign_seed(11020, j);
+               if (ok)
+                  ok = seed != xpccut_campaign_seed(11021, j);
+
+               for (k = 0; ok && k < j; k++)
+                  ok = seed != xpccut_campaign_seed(11020, k);
+            }
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  3 */
+
+         if (unit_test_status_next_subtest(&status, "One job is one fuzzer"))
+         {
+            xpccut_guided_fuzz_t fuzzer;
+            long long iterations = 0;
+            ok = xpccut_guided_init
+            (
+               &fuzzer, 11030, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
             {
-               // nada
+               ok = ! xpccut_guided_run
+               (
+                  &fuzzer, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+               iterations = xpccut_guided_iterations(&fuzzer);
             }
-            xpccut_set_seed(seed);
-            for (i = 0; i < trial_count; i++)
+            xpccut_guided_free(&fuzzer);
+            if (ok)
             {
-               int r = xpccut_garbled_string(source, strlen(source));
-               ok = r >= 0;
+               ok = xpccut_campaign_init
+               (
+                  &campaign, 1, 11030, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
+            }
+            if (ok)
+            {
+               ok = ! xpccut_campaign_run
+               (
+                  &campaign, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+            }
+            if (ok)
+            {
+               ok = xpccut_campaign_iterations(&campaign) == iterations &&
+                  xpccut_campaign_failed_job(&campaign) == 0;
+            }
+            xpccut_campaign_free(&campaign);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  4 */
+
+         if (unit_test_status_next_subtest(&status, "Parallel jobs fail fast"))
+         {
+            xpccut_ticks_t start = xpccut_get_ticks();
+            ok = xpccut_campaign_init
+            (
+               &campaign, jobs, 11040, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
+            {
+               ok = ! xpccut_campaign_run
+               (
+                  &campaign, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+            }
+            if (ok)
+            {
+               int size = 0;
+               const char * input = xpccut_campaign_crash(&campaign, &size);
+               ok = cut_not_nullptr(input) && size >= 4;
+               if (ok)
+                  ok = memcmp(input, "FUZ!", 4) == 0;
+
                if (ok)
                {
-                  if (unit_test_options_show_values(options))
-                  {
-                     fprintf
-                     (
-                        stdout, "  '%s', %d characters changed\n",
-                        source, r
-                     );
-                  }
+                  int failed = xpccut_campaign_failed_job(&campaign);
+                  ok = failed >= 0 && failed < jobs;
                }
-               else
+               if (ok)
+                  ok = xpccut_campaign_edge_count(&campaign) == 3;
+            }
+            if (unit_test_options_show_values(options))
+            {
+               xpccut_print
+               (
+                  "  %d jobs: %lld runs in %.3f ms\n", jobs,
+                  xpccut_campaign_iterations(&campaign),
+                  (double) (xpccut_get_ticks() - start) /
+                     (double) XPCCUT_TICKS_PER_MS
+               );
+            }
+            xpccut_campaign_free(&campaign);
+            unit_test_status_pass(&status, ok);
+         }
+
+         /*  5 */
+
+         if (unit_test_status_next_subtest(&status, "Workers share inputs"))
+         {
+            ok = xpccut_campaign_init
+            (
+               &campaign, 3, 11050, 16, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
+               ok = xpccut_campaign_add(&campaign, "seed", 4);
+
+            if (ok)
+            {
+               ok = xpccut_campaign_run
+               (
+                  &campaign, campaign_spread_target, nullptr, 3000, 0.0
+               );
+            }
+            if (ok)
+               ok = xpccut_campaign_iterations(&campaign) == 9000;
+
+            if (ok)
+               ok = xpccut_campaign_shared_count(&campaign) > 0;
+
+            if (ok)
+            {
+               cbool_t imported = false;
+               int j;
+               for (j = 0; j < 3; j++)
                {
-                  xpccut_errprint_func(_("fuzz error"));
-                  break;
+                  const xpccut_guided_fuzz_t * f =
+                     xpccut_campaign_fuzzer(&campaign, j);
+
+                  int own = 0;
+                  int i;
+                  for (i = 0; i < campaign.m_Shared_Count; i++)
+                  {
+                     if (campaign.m_Shared_Owners[i] == j)
+                        ++own;
+                  }
+                  if (xpccut_guided_corpus_count(f) > own + 1)
+                     imported = true;
+
+                  if (xpccut_guided_edge_count(f) >
+                     xpccut_campaign_edge_count(&campaign))
+                     ok = false;
                }
+               if (ok)
+                  ok = imported;
             }
+            xpccut_campaign_free(&campaign);
             unit_test_status_pass(&status, ok);
          }
 
-         /*  3 */
+         /*  6 */
 
-         if (unit_test_status_next_subtest(&status, "Embedded hi!"))
+         if (unit_test_status_next_subtest(&status, "Shared corpus directory"))
          {
-            unsigned int seed = 10210;
-            char source[32] =
+            char directory[TEST_FILE_NAME_SIZE];
+            char path[XPCCUT_CORPUS_PATH_MAX];
+            char crashfile[XPCCUT_CORPUS_PATH_MAX];
+            crashfile[0] = 0;
+            (void) test_file_name(directory, "unit-test-10-10", ".dir");
+            ok = xpccut_campaign_init
+            (
+               &campaign, 1, 11060, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+            );
+            if (ok)
+               ok = xpccut_campaign_directory(&campaign, directory);
+
+            if (ok)
             {
-               "I say hi! You say ho!"
-            };
-            int trial_count = 10;
-            int i;
-            int character_change_count[10] =
+               ok = ! xpccut_campaign_run
+               (
+                  &campaign, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+            }
+            if (ok)
             {
-               1, 2, 1, 1, 2, 1, 0, 0, 1, 0
-            };
-            if (unit_test_options_show_values(options))
+               const char * name = xpccut_campaign_crash_file(&campaign);
+               ok = cut_not_nullptr(name);
+               if (ok)
+                  (void) strcpy(crashfile, name);
+            }
+            xpccut_campaign_free(&campaign);
+            if (ok)
             {
-               // nada
+               ok = xpccut_campaign_init
+               (
+                  &campaign, 2, 11061, 64, XPCCUT_FF_DEFAULT, nullptr, nullptr
+               );
             }
+            if (ok)
+               ok = xpccut_campaign_directory(&campaign, directory);
 
-            /*
-             * Reset the seed.  We have some control over the random
-             * sequence -- we can make it the same by setting the seed the
-             * same each time.
-             *
-             * We can also make sure the changes are the expected ones, as
-             * an added test of the randomization.
-             */
+            if (ok)
+            {
+               ok = ! xpccut_campaign_run
+               (
+                  &campaign, guided_magic_target, nullptr, 1000000, 10000.0
+               );
+            }
+            if (ok)
+               ok = xpccut_campaign_iterations(&campaign) <= 2;    /* replay */
 
-            xpccut_set_seed(seed);
-            for (i = 0; i < trial_count; i++)
+            if (ok)
             {
-               int r = xpccut_garbled_string(&source[6], strlen("hi!"));
-               ok = r >= 0;
+               const char * name = xpccut_campaign_crash_file(&campaign);
+               ok = cut_not_nullptr(name);
                if (ok)
-               {
-                  ok = r == character_change_count[i];
-                  if (unit_test_options_show_values(options))
-                  {
-                     fprintf
-                     (
-                        stdout, "  '%s', %d characters changed\n",
-                        source, r
-                     );
-                  }
-                  if (! ok)
-                  {
-                     xpccut_errprint_func(_("unexpected character change count"));
-                     break;
-                  }
-               }
-               else
-               {
-                  xpccut_errprint_func(_("fuzz error"));
-                  break;
-               }
+                  ok = strcmp(name, crashfile) == 0;
             }
+            xpccut_campaign_free(&campaign);
+            if (crashfile[0] != 0)
+               (void) remove(crashfile);
+
+            if (xpccut_corpus_path(path, 1024, directory, "corpus.xcc"))
+               (void) remove(path);
+
+            if (xpccut_corpus_path(path, 1024, directory, "crashes.xcc"))
+               (void) remove(path);
+
+            (void) remove(directory);
             unit_test_status_pass(&status, ok);
          }
       }
@@ -14223,6 +26928,10 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
          {
             /*
              * xpccut_infoprint(_("loading the tests"));
+             *
+             * The tests that silence printing, turn the trace on, or time
+             * themselves, are marked by unit_test_load_serial(), so that
+             * --jobs runs each of them alone.
              */
 
             ok = unit_test_load(&testbattery, unit_unit_test_01_01);
@@ -14233,10 +26942,12 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                (void) unit_test_load(&testbattery, unit_unit_test_02_03);
                (void) unit_test_load(&testbattery, unit_unit_test_02_04);
                (void) unit_test_load(&testbattery, unit_unit_test_02_05);
+               (void) unit_test_load_serial(&testbattery);
                (void) unit_test_load(&testbattery, unit_unit_test_02_06);
                (void) unit_test_load(&testbattery, unit_unit_test_02_07);
                (void) unit_test_load(&testbattery, unit_unit_test_02_08);
                (void) unit_test_load(&testbattery, unit_unit_test_02_09);
+               (void) unit_test_load_serial(&testbattery);
                (void) unit_test_load(&testbattery, unit_unit_test_02_10);
                (void) unit_test_load(&testbattery, unit_unit_test_02_11);
                (void) unit_test_load(&testbattery, unit_unit_test_02_12);
@@ -14265,7 +26976,26 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                 * lump all tests in one group together.
                 */
 
-               ok = unit_test_load(&testbattery, unit_unit_test_02_31);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_31);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_32);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_33);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_34);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_35);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_36);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_37);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_38);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_02_39);
+               (void) unit_test_load_serial(&testbattery);
+               ok = unit_test_load(&testbattery, unit_unit_test_02_40);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
@@ -14274,6 +27004,7 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                (void) unit_test_load(&testbattery, unit_unit_test_03_03);
                (void) unit_test_load(&testbattery, unit_unit_test_03_04);
                (void) unit_test_load(&testbattery, unit_unit_test_03_05);
+               (void) unit_test_load_serial(&testbattery);
                (void) unit_test_load(&testbattery, unit_unit_test_03_06);
                (void) unit_test_load(&testbattery, unit_unit_test_03_07);
                (void) unit_test_load(&testbattery, unit_unit_test_03_08);
@@ -14297,7 +27028,27 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                (void) unit_test_load(&testbattery, unit_unit_test_03_26);
                (void) unit_test_load(&testbattery, unit_unit_test_03_27);
                (void) unit_test_load(&testbattery, unit_unit_test_03_28);
-               ok = unit_test_load(&testbattery, unit_unit_test_03_29);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_29);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_30);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_31);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_32);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_33);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_34);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_35);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_36);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_37);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_38);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_39);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_40);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_41);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_42);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_03_43);
+               ok = unit_test_load(&testbattery, unit_unit_test_03_44);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
@@ -14323,11 +27074,37 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                (void) unit_test_load(&testbattery, unit_unit_test_04_20);
                (void) unit_test_load(&testbattery, unit_unit_test_04_21);
                (void) unit_test_load(&testbattery, unit_unit_test_04_22);
-               ok = unit_test_load(&testbattery, unit_unit_test_04_23);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_23);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_24);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_25);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_26);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_27);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_28);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_29);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_30);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_31);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_32);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_33);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_04_34);
+               (void) unit_test_load_serial(&testbattery);
+               ok = unit_test_load(&testbattery, unit_unit_test_04_35);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
                ok = unit_test_load(&testbattery, unit_unit_test_05_01);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
@@ -14359,7 +27136,16 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
             {
                (void) unit_test_load(&testbattery, unit_unit_test_07_01);
                (void) unit_test_load(&testbattery, unit_unit_test_07_02);
-               ok = unit_test_load(&testbattery, unit_unit_test_07_03);
+               (void) unit_test_load(&testbattery, unit_unit_test_07_03);
+               (void) unit_test_load(&testbattery, unit_unit_test_07_04);
+               (void) unit_test_load(&testbattery, unit_unit_test_07_05);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_07_06);
+               (void) unit_test_load(&testbattery, unit_unit_test_07_07);
+               (void) unit_test_load_serial(&testbattery);
+               ok = unit_test_load(&testbattery, unit_unit_test_07_08);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
@@ -14369,7 +27155,10 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
             {
                (void) unit_test_load(&testbattery, unit_unit_test_09_01);
                (void) unit_test_load(&testbattery, unit_unit_test_09_02);
-               ok = unit_test_load(&testbattery, unit_unit_test_09_03);
+               (void) unit_test_load(&testbattery, unit_unit_test_09_03);
+               ok = unit_test_load(&testbattery, unit_unit_test_09_04);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
             if (ok)
             {
@@ -14377,7 +27166,18 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                (void) unit_test_load(&testbattery, unit_unit_test_10_02);
                (void) unit_test_load(&testbattery, unit_unit_test_10_03);
                (void) unit_test_load(&testbattery, unit_unit_test_10_04);
-               ok = unit_test_load(&testbattery, unit_unit_test_10_05);
+               (void) unit_test_load(&testbattery, unit_unit_test_10_05);
+               (void) unit_test_load(&testbattery, unit_unit_test_10_06);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_10_07);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_10_08);
+               (void) unit_test_load_serial(&testbattery);
+               (void) unit_test_load(&testbattery, unit_unit_test_10_09);
+               (void) unit_test_load_serial(&testbattery);
+               ok = unit_test_load(&testbattery, unit_unit_test_10_10);
+               if (ok)
+                  ok = unit_test_load_serial(&testbattery);
             }
          }
          if (ok)
@@ -14395,9 +27195,8 @@ _("Configured with XPC_NO_THISPTR defined, test will segfault, aborting!!!")
                if (g_duration_out_of_range != 0)
                {
 
-            fprintf
+            xpccut_print
             (
-                  stdout,
                "%s: %d\n%s.\n"
                "===============================================================\n"
                ,